@@ -650,6 +650,10 @@ function config() {
   ${APOLLO_ROOT_DIR}/scripts/configurator.sh
 }
 
+function pnc_benchmark() {
+  ${APOLLO_ROOT_DIR}/scripts/pnc_benchmark.sh $@
+}
+
 function print_usage() {
   RED='\033[0;31m'
   BLUE='\033[0;34m'
@@ -679,6 +683,7 @@ function print_usage() {
   ${BLUE}coverage${NONE}: generate test coverage report
   ${BLUE}doc${NONE}: generate doxygen document
   ${BLUE}lint${NONE}: run code style check
+  ${BLUE}pnc_benchmark${NONE}: run planning+prediction+routing against dreamview SimControl and print a throughput scorecard
   ${BLUE}usage${NONE}: print this menu
   ${BLUE}release${NONE}: build release version
   ${BLUE}test${NONE}: run all unit tests
@@ -822,6 +827,9 @@ function main() {
     coverage)
       gen_coverage $@
       ;;
+    pnc_benchmark)
+      pnc_benchmark $@
+      ;;
     clean)
       clean
       ;;
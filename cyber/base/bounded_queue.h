@@ -23,6 +23,8 @@
 #include <atomic>
 #include <cstdlib>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "cyber/base/macros.h"
 #include "cyber/base/wait_strategy.h"
@@ -50,6 +52,7 @@ class BoundedQueue {
   bool WaitEnqueue(T&& element);
   bool Dequeue(T* element);
   bool WaitDequeue(T* element);
+  uint64_t DequeueAll(std::vector<T>* elements);
   uint64_t Size();
   bool Empty();
   void SetWaitStrategy(WaitStrategy* WaitStrategy);
@@ -166,6 +169,16 @@ bool BoundedQueue<T>::Dequeue(T* element) {
   return true;
 }
 
+template <typename T>
+uint64_t BoundedQueue<T>::DequeueAll(std::vector<T>* elements) {
+  elements->clear();
+  T element;
+  while (Dequeue(&element)) {
+    elements->emplace_back(std::move(element));
+  }
+  return elements->size();
+}
+
 template <typename T>
 bool BoundedQueue<T>::WaitEnqueue(const T& element) {
   while (!break_all_wait_) {
@@ -48,6 +48,21 @@ TEST(BoundedQueueTest, Dequeue) {
   EXPECT_FALSE(queue.Dequeue(&value));
 }
 
+TEST(BoundedQueueTest, DequeueAll) {
+  BoundedQueue<int> queue;
+  queue.Init(100, new FutexWaitStrategy());
+  std::vector<int> elements;
+  EXPECT_EQ(0, queue.DequeueAll(&elements));
+  for (int i = 0; i < 50; i++) {
+    EXPECT_TRUE(queue.Enqueue(i));
+  }
+  EXPECT_EQ(50, queue.DequeueAll(&elements));
+  for (int i = 0; i < 50; i++) {
+    EXPECT_EQ(i, elements[i]);
+  }
+  EXPECT_TRUE(queue.Empty());
+}
+
 TEST(BoundedQueueTest, concurrency) {
   BoundedQueue<int> queue;
   queue.Init(10);
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Microbenchmarks for the concurrency primitives underneath every channel.
+// Run before touching BoundedQueue/AtomicHashMap/CCObjectPool/AtomicRWLock:
+//   bazel run //cyber/base:concurrency_benchmark -- \
+//       --benchmark_format=json > baseline.json
+// and diff the json against the previous baseline. Use numactl/taskset to
+// pin the process to one socket (or split it across sockets) when the
+// cross-socket cost is what you want to measure.
+
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/base/atomic_hash_map.h"
+#include "cyber/base/atomic_rw_lock.h"
+#include "cyber/base/bounded_queue.h"
+#include "cyber/base/concurrent_object_pool.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+namespace {
+
+constexpr uint32_t kQueueSize = 1024;
+constexpr uint32_t kPoolSize = 1024;
+
+BoundedQueue<int>* GlobalQueue() {
+  static BoundedQueue<int>* queue = []() {
+    auto* instance = new BoundedQueue<int>();
+    instance->Init(kQueueSize);
+    return instance;
+  }();
+  return queue;
+}
+
+std::shared_ptr<CCObjectPool<int>> GlobalPool() {
+  static auto pool = []() {
+    auto instance = std::make_shared<CCObjectPool<int>>(kPoolSize);
+    instance->ConstructAll(0);
+    return instance;
+  }();
+  return pool;
+}
+
+void BM_BoundedQueueEnqueueDequeue(benchmark::State& state) {
+  auto* queue = GlobalQueue();
+  int value = 0;
+  while (state.KeepRunning()) {
+    queue->Enqueue(value);
+    queue->Dequeue(&value);
+  }
+}
+BENCHMARK(BM_BoundedQueueEnqueueDequeue)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(32);
+
+void BM_AtomicHashMapSetGet(benchmark::State& state) {
+  static AtomicHashMap<uint64_t, uint64_t> map;
+  uint64_t key = static_cast<uint64_t>(state.thread_index);
+  uint64_t value = 0;
+  while (state.KeepRunning()) {
+    map.Set(key, value);
+    map.Get(key, &value);
+  }
+}
+BENCHMARK(BM_AtomicHashMapSetGet)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(32);
+
+void BM_CCObjectPoolGetRelease(benchmark::State& state) {
+  auto pool = GlobalPool();
+  while (state.KeepRunning()) {
+    auto object = pool->GetObject();
+    benchmark::DoNotOptimize(object);
+  }
+}
+BENCHMARK(BM_CCObjectPoolGetRelease)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(32);
+
+void BM_AtomicRWLockReadOnly(benchmark::State& state) {
+  static AtomicRWLock rw_lock;
+  while (state.KeepRunning()) {
+    ReadLockGuard<AtomicRWLock> lock(rw_lock);
+  }
+}
+BENCHMARK(BM_AtomicRWLockReadOnly)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(32);
+
+// One writer contends with the remaining reader threads, the channel-wise
+// common case for the factory and topology maps guarded by AtomicRWLock.
+void BM_AtomicRWLockOneWriter(benchmark::State& state) {
+  static AtomicRWLock rw_lock;
+  if (state.thread_index == 0 && state.threads > 1) {
+    while (state.KeepRunning()) {
+      WriteLockGuard<AtomicRWLock> lock(rw_lock);
+    }
+  } else {
+    while (state.KeepRunning()) {
+      ReadLockGuard<AtomicRWLock> lock(rw_lock);
+    }
+  }
+}
+BENCHMARK(BM_AtomicRWLockOneWriter)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(32);
+
+}  // namespace
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -17,13 +17,16 @@
 #ifndef CYBER_BASE_CONCURRENT_OBJECT_POOL_H_
 #define CYBER_BASE_CONCURRENT_OBJECT_POOL_H_
 
+#include <algorithm>
 #include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "cyber/base/for_each.h"
 #include "cyber/base/macros.h"
@@ -35,7 +38,12 @@ namespace base {
 template <typename T>
 class CCObjectPool : public std::enable_shared_from_this<CCObjectPool<T>> {
  public:
-  explicit CCObjectPool(uint32_t size);
+  // When auto_grow is set the pool appends a chunk of default-constructed
+  // objects each time it runs dry, up to kMaxGrowthFactor times the initial
+  // size, so burst load degrades into a slow-path allocation instead of a
+  // miss. Only meaningful for pools filled with ConstructAll; pools handing
+  // out objects via ConstructObject keep their fixed capacity.
+  explicit CCObjectPool(uint32_t size, bool auto_grow = false);
   virtual ~CCObjectPool();
 
   template <typename... Args>
@@ -48,6 +56,13 @@ class CCObjectPool : public std::enable_shared_from_this<CCObjectPool<T>> {
   void ReleaseObject(T *);
   uint32_t size() const;
 
+  // telemetry, updated with relaxed atomics on the hot path
+  uint64_t hit_num() const { return hit_num_.load(); }
+  uint64_t miss_num() const { return miss_num_.load(); }
+  uint64_t grow_num() const { return grow_num_.load(); }
+
+  static const uint32_t kMaxGrowthFactor = 4;
+
  private:
   struct Node {
     T object;
@@ -63,24 +78,36 @@ class CCObjectPool : public std::enable_shared_from_this<CCObjectPool<T>> {
   CCObjectPool(CCObjectPool &) = delete;
   CCObjectPool &operator=(CCObjectPool &) = delete;
   bool FindFreeHead(Head *head);
+  bool Grow();
 
   std::atomic<Head> free_head_;
   Node *node_arena_ = nullptr;
-  uint32_t capacity_ = 0;
+  std::atomic<uint32_t> capacity_ = {0};
+  uint32_t base_capacity_ = 0;
+  bool auto_grow_ = false;
+  std::mutex grow_mutex_;
+  std::vector<Node *> grown_chunks_;
+  std::atomic<uint64_t> hit_num_ = {0};
+  std::atomic<uint64_t> miss_num_ = {0};
+  std::atomic<uint64_t> grow_num_ = {0};
 };
 
 template <typename T>
-CCObjectPool<T>::CCObjectPool(uint32_t size) : capacity_(size) {
-  node_arena_ = static_cast<Node *>(CheckedCalloc(capacity_, sizeof(Node)));
-  FOR_EACH(i, 0, capacity_ - 1) { node_arena_[i].next = node_arena_ + 1 + i; }
-  node_arena_[capacity_ - 1].next = nullptr;
+const uint32_t CCObjectPool<T>::kMaxGrowthFactor;
+
+template <typename T>
+CCObjectPool<T>::CCObjectPool(uint32_t size, bool auto_grow)
+    : capacity_(size), base_capacity_(size), auto_grow_(auto_grow) {
+  node_arena_ = static_cast<Node *>(CheckedCalloc(size, sizeof(Node)));
+  FOR_EACH(i, 0, size - 1) { node_arena_[i].next = node_arena_ + 1 + i; }
+  node_arena_[size - 1].next = nullptr;
   free_head_.store({0, node_arena_}, std::memory_order_relaxed);
 }
 
 template <typename T>
 template <typename... Args>
 void CCObjectPool<T>::ConstructAll(Args &&... args) {
-  FOR_EACH(i, 0, capacity_) {
+  FOR_EACH(i, 0, base_capacity_) {
     new (node_arena_ + i) T(std::forward<Args>(args)...);
   }
 }
@@ -88,6 +115,36 @@ void CCObjectPool<T>::ConstructAll(Args &&... args) {
 template <typename T>
 CCObjectPool<T>::~CCObjectPool() {
   std::free(node_arena_);
+  for (auto *chunk : grown_chunks_) {
+    std::free(chunk);
+  }
+}
+
+template <typename T>
+bool CCObjectPool<T>::Grow() {
+  std::lock_guard<std::mutex> lock(grow_mutex_);
+  // another thread may have refilled the free list while we waited
+  if (free_head_.load(std::memory_order_acquire).node != nullptr) {
+    return true;
+  }
+  const uint32_t max_capacity = base_capacity_ * kMaxGrowthFactor;
+  const uint32_t capacity = capacity_.load(std::memory_order_relaxed);
+  if (capacity >= max_capacity) {
+    return false;
+  }
+  const uint32_t chunk_size =
+      std::min(std::max(base_capacity_ / 2, 1u), max_capacity - capacity);
+  Node *chunk = static_cast<Node *>(CheckedCalloc(chunk_size, sizeof(Node)));
+  FOR_EACH(i, 0, chunk_size) {
+    new (chunk + i) T();
+    ReleaseObject(reinterpret_cast<T *>(chunk + i));
+  }
+  grown_chunks_.push_back(chunk);
+  capacity_.store(capacity + chunk_size, std::memory_order_relaxed);
+  grow_num_.fetch_add(1, std::memory_order_relaxed);
+  std::cerr << "CCObjectPool grown by " << chunk_size << " to "
+            << capacity + chunk_size << " objects" << std::endl;
+  return true;
 }
 
 template <typename T>
@@ -111,8 +168,12 @@ template <typename T>
 std::shared_ptr<T> CCObjectPool<T>::GetObject() {
   Head free_head;
   if (unlikely(!FindFreeHead(&free_head))) {
-    return nullptr;
+    if (!auto_grow_ || !Grow() || !FindFreeHead(&free_head)) {
+      miss_num_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
   }
+  hit_num_.fetch_add(1, std::memory_order_relaxed);
   auto self = this->shared_from_this();
   return std::shared_ptr<T>(reinterpret_cast<T *>(free_head.node),
                             [self](T *object) { self->ReleaseObject(object); });
@@ -123,8 +184,10 @@ template <typename... Args>
 std::shared_ptr<T> CCObjectPool<T>::ConstructObject(Args &&... args) {
   Head free_head;
   if (unlikely(!FindFreeHead(&free_head))) {
+    miss_num_.fetch_add(1, std::memory_order_relaxed);
     return nullptr;
   }
+  hit_num_.fetch_add(1, std::memory_order_relaxed);
   auto self = this->shared_from_this();
   T *ptr = new (free_head.node) T(std::forward<Args>(args)...);
   return std::shared_ptr<T>(ptr, [self](T *object) {
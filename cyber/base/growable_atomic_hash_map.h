@@ -0,0 +1,256 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_GROWABLE_ATOMIC_HASH_MAP_H_
+#define CYBER_BASE_GROWABLE_ATOMIC_HASH_MAP_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief A growable variant of the lock-free hash map
+ *
+ * Unlike AtomicHashMap the bucket count is not fixed: when the element count
+ * reaches the bucket count a writer allocates a table with twice the buckets
+ * and each subsequent Set copies a couple of old buckets over, so the cost
+ * of growth is amortized across inserts and lookup stays O(1) as the
+ * topology grows. Lookups are always lock-free: old chains are never
+ * structurally modified during migration, readers check the new table first
+ * and fall back to the old one. Writers serialize on a short spinlock,
+ * which keeps migration simple and is cheap next to the allocation a Set
+ * performs anyway. Use the fixed AtomicHashMap on hot paths that can
+ * pre-size and want zero resize cost.
+ *
+ * @tparam K Type of key, must be integral
+ * @tparam V Type of value
+ */
+template <typename K, typename V,
+          typename std::enable_if<std::is_integral<K>::value, int>::type = 0>
+class GrowableAtomicHashMap {
+ public:
+  explicit GrowableAtomicHashMap(uint64_t init_capacity = 128)
+      : old_table_(nullptr), retired_(nullptr), migrate_pos_(0), size_(0) {
+    uint64_t capacity = 64;
+    while (capacity < init_capacity) {
+      capacity <<= 1;
+    }
+    table_.store(new Table(capacity), std::memory_order_release);
+  }
+
+  GrowableAtomicHashMap(const GrowableAtomicHashMap &other) = delete;
+  GrowableAtomicHashMap &operator=(const GrowableAtomicHashMap &other) =
+      delete;
+
+  ~GrowableAtomicHashMap() {
+    delete table_.load(std::memory_order_acquire);
+    delete old_table_.load(std::memory_order_acquire);
+    Table *retired = retired_.load(std::memory_order_acquire);
+    while (retired != nullptr) {
+      auto next = retired->next_retired;
+      delete retired;
+      retired = next;
+    }
+  }
+
+  bool Has(K key) {
+    V *value = nullptr;
+    return Get(key, &value);
+  }
+
+  bool Get(K key, V **value) {
+    // the new table is authoritative, the old one keeps not-yet-copied keys
+    Entry *entry = FindEntry(table_.load(std::memory_order_acquire), key);
+    if (entry == nullptr) {
+      Table *old_table = old_table_.load(std::memory_order_acquire);
+      if (old_table != nullptr) {
+        entry = FindEntry(old_table, key);
+      }
+    }
+    if (entry == nullptr) {
+      return false;
+    }
+    *value = entry->value_ptr.load(std::memory_order_acquire);
+    return true;
+  }
+
+  bool Get(K key, V *value) {
+    V *val = nullptr;
+    if (!Get(key, &val)) {
+      return false;
+    }
+    *value = *val;
+    return true;
+  }
+
+  void Set(K key) { SetValue(key, new V()); }
+  void Set(K key, const V &value) { SetValue(key, new V(value)); }
+  void Set(K key, V &&value) { SetValue(key, new V(std::forward<V>(value))); }
+
+  uint64_t Size() { return size_.load(std::memory_order_acquire); }
+
+ private:
+  struct Entry {
+    Entry(K key, V *value) : key(key), value_ptr(value) {}
+    ~Entry() {
+      if (owns_value) {
+        delete value_ptr.load(std::memory_order_acquire);
+      }
+    }
+
+    K key;
+    std::atomic<V *> value_ptr;
+    std::atomic<Entry *> next = {nullptr};
+    // cleared when the entry's value is handed over to its migrated copy
+    bool owns_value = true;
+  };
+
+  struct Table {
+    explicit Table(uint64_t capacity)
+        : capacity(capacity), mode_num(capacity - 1) {
+      heads = new std::atomic<Entry *>[capacity];
+      for (uint64_t i = 0; i < capacity; ++i) {
+        heads[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    ~Table() {
+      for (uint64_t i = 0; i < capacity; ++i) {
+        Entry *entry = heads[i].load(std::memory_order_acquire);
+        while (entry != nullptr) {
+          auto next = entry->next.load(std::memory_order_acquire);
+          delete entry;
+          entry = next;
+        }
+      }
+      delete[] heads;
+    }
+
+    uint64_t capacity;
+    uint64_t mode_num;
+    std::atomic<Entry *> *heads;
+    Table *next_retired = nullptr;
+  };
+
+  Entry *FindEntry(Table *table, K key) {
+    Entry *entry =
+        table->heads[key & table->mode_num].load(std::memory_order_acquire);
+    while (entry != nullptr) {
+      if (entry->key == key) {
+        return entry;
+      }
+      entry = entry->next.load(std::memory_order_acquire);
+    }
+    return nullptr;
+  }
+
+  void PushEntry(Table *table, Entry *entry) {
+    auto &head = table->heads[entry->key & table->mode_num];
+    entry->next.store(head.load(std::memory_order_acquire),
+                      std::memory_order_release);
+    head.store(entry, std::memory_order_release);
+  }
+
+  void SetValue(K key, V *new_value) {
+    while (lock_.test_and_set(std::memory_order_acquire)) {
+    }
+
+    MigrateSome();
+
+    Table *table = table_.load(std::memory_order_acquire);
+    Entry *entry = FindEntry(table, key);
+    if (entry == nullptr) {
+      Table *old_table = old_table_.load(std::memory_order_acquire);
+      if (old_table != nullptr) {
+        entry = FindEntry(old_table, key);
+      }
+    }
+
+    if (entry != nullptr) {
+      auto old_value = entry->value_ptr.exchange(new_value,
+                                                 std::memory_order_acq_rel);
+      delete old_value;
+    } else {
+      PushEntry(table, new Entry(key, new_value));
+      size_.fetch_add(1, std::memory_order_acq_rel);
+      GrowIfNeeded(table);
+    }
+
+    lock_.clear(std::memory_order_release);
+  }
+
+  void GrowIfNeeded(Table *table) {
+    if (size_.load(std::memory_order_acquire) < table->capacity ||
+        old_table_.load(std::memory_order_acquire) != nullptr) {
+      return;
+    }
+    auto new_table = new Table(table->capacity << 1);
+    old_table_.store(table, std::memory_order_release);
+    migrate_pos_ = 0;
+    table_.store(new_table, std::memory_order_release);
+  }
+
+  void MigrateSome() {
+    Table *old_table = old_table_.load(std::memory_order_acquire);
+    if (old_table == nullptr) {
+      return;
+    }
+    Table *table = table_.load(std::memory_order_acquire);
+    for (int step = 0; step < kMigrateStep; ++step) {
+      if (migrate_pos_ >= old_table->capacity) {
+        // fully copied: readers no longer need the old table, retire it
+        old_table_.store(nullptr, std::memory_order_release);
+        old_table->next_retired = retired_.load(std::memory_order_acquire);
+        retired_.store(old_table, std::memory_order_release);
+        return;
+      }
+      Entry *entry =
+          old_table->heads[migrate_pos_].load(std::memory_order_acquire);
+      ++migrate_pos_;
+      // copy entries over without touching the old chain, so a concurrent
+      // reader walking it never misses a key
+      while (entry != nullptr) {
+        if (FindEntry(table, entry->key) == nullptr) {
+          PushEntry(table,
+                    new Entry(entry->key,
+                              entry->value_ptr.load(std::memory_order_acquire)));
+          entry->owns_value = false;
+        }
+        entry = entry->next.load(std::memory_order_acquire);
+      }
+    }
+  }
+
+  static const int kMigrateStep = 2;
+
+  std::atomic<Table *> table_;
+  std::atomic<Table *> old_table_;
+  std::atomic<Table *> retired_;
+  uint64_t migrate_pos_;
+  std::atomic<uint64_t> size_;
+  std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_GROWABLE_ATOMIC_HASH_MAP_H_
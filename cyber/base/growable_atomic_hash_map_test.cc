@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/growable_atomic_hash_map.h"
+
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(GrowableAtomicHashMapTest, int_int) {
+  GrowableAtomicHashMap<int, int> map(64);
+  int value = 0;
+  for (int i = 0; i < 10000; i++) {
+    map.Set(i, i);
+    EXPECT_TRUE(map.Has(i));
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_EQ(10000, map.Size());
+
+  // every key survives growth and updates stick
+  for (int i = 0; i < 10000; i++) {
+    map.Set(i, i + 1);
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(i + 1, value);
+  }
+  EXPECT_EQ(10000, map.Size());
+}
+
+TEST(GrowableAtomicHashMapTest, int_str) {
+  GrowableAtomicHashMap<int, std::string> map;
+  std::string value("");
+  for (int i = 0; i < 1000; i++) {
+    map.Set(i, std::to_string(i));
+    EXPECT_TRUE(map.Has(i));
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(std::to_string(i), value);
+  }
+  map.Set(100);
+  EXPECT_TRUE(map.Get(100, &value));
+  EXPECT_TRUE(value.empty());
+  map.Set(100, std::move(std::string("test")));
+  EXPECT_TRUE(map.Get(100, &value));
+  EXPECT_EQ("test", value);
+}
+
+TEST(GrowableAtomicHashMapTest, concurrency) {
+  GrowableAtomicHashMap<int, std::string> map(64);
+  int thread_num = 32;
+  std::thread t[32];
+  volatile bool ready = false;
+
+  for (int i = 0; i < thread_num; i++) {
+    t[i] = std::thread([&, i]() {
+      while (!ready) {
+        std::this_thread::yield();
+      }
+      for (int j = 0; j < 1000; ++j) {
+        auto key = i * 1000 + j;
+        map.Set(key, std::to_string(key));
+      }
+    });
+  }
+
+  ready = true;
+  for (int i = 0; i < thread_num; i++) {
+    t[i].join();
+  }
+
+  std::string value;
+  for (int i = 0; i < thread_num * 1000; ++i) {
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(std::to_string(i), value);
+  }
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -127,6 +127,29 @@ TEST(CCObjectPoolTest, construct_all) {
   vec.clear();
 }
 
+TEST(CCObjectPoolTest, auto_grow) {
+  const uint32_t capacity = 16;
+  const uint32_t max_capacity =
+      capacity * CCObjectPool<TestNode>::kMaxGrowthFactor;
+  std::vector<std::shared_ptr<TestNode>> vec;
+  auto pool = std::make_shared<CCObjectPool<TestNode>>(capacity, true);
+  pool->ConstructAll();
+
+  FOR_EACH(i, 0, max_capacity) {
+    auto obj = pool->GetObject();
+    ASSERT_NE(nullptr, obj);
+    EXPECT_TRUE(obj->inited);
+    vec.push_back(obj);
+  }
+  EXPECT_EQ(nullptr, pool->GetObject());
+  EXPECT_EQ(max_capacity, pool->hit_num());
+  EXPECT_EQ(1, pool->miss_num());
+  EXPECT_GT(pool->grow_num(), 0);
+
+  vec.clear();
+  EXPECT_NE(nullptr, pool->GetObject());
+}
+
 TEST(ObjectPoolTest, get_object) {
   auto pool = std::make_shared<ObjectPool<TestNode>>(100, 10);
   FOR_EACH(i, 0, 10) { EXPECT_EQ(10, pool->GetObject()->value); }
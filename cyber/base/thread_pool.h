@@ -17,10 +17,14 @@
 #ifndef CYBER_BASE_THREAD_POOL_H_
 #define CYBER_BASE_THREAD_POOL_H_
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <stdexcept>
 #include <thread>
@@ -41,11 +45,42 @@ class ThreadPool {
   auto Enqueue(F&& f, Args&&... args)
       -> std::future<typename std::result_of<F(Args...)>::type>;
 
+  /**@brief Enqueue a task on the worker selected by tag. Tasks with the
+   * same tag always prefer the same worker, so repeated invocations over
+   * the same data keep their cache warm. An idle worker may still steal
+   * the task, so placement is best effort, never a stall. */
+  template <typename F, typename... Args>
+  auto EnqueueWithTag(std::size_t tag, F&& f, Args&&... args)
+      -> std::future<typename std::result_of<F(Args...)>::type>;
+
+  /**@brief Apply func to every index in [begin, end). The range is split
+   * into one shard per worker, shards are pinned by (tag + shard) so the
+   * same tag maps the same sub-ranges to the same workers across calls.
+   * The calling thread runs one shard itself and blocks until all shards
+   * finish, so the pool must outlive the call. */
+  void ParallelFor(std::size_t begin, std::size_t end,
+                   const std::function<void(std::size_t)>& func,
+                   std::size_t tag = 0);
+
   ~ThreadPool();
 
  private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void PushLocal(std::size_t index, std::function<void()>&& task);
+  bool NextTask(std::size_t index, std::function<void()>* task);
+  void WorkerLoop(std::size_t index);
+  void NotifyOne();
+
   std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<WorkerQueue>> local_queues_;
   BoundedQueue<std::function<void()>> task_queue_;
+  std::atomic<std::size_t> task_count_ = {0};
+  std::mutex wait_mutex_;
+  std::condition_variable wait_cv_;
   std::atomic_bool stop_;
 };
 
@@ -54,16 +89,76 @@ inline ThreadPool::ThreadPool(std::size_t threads, std::size_t max_task_num)
   if (!task_queue_.Init(max_task_num, new BlockWaitStrategy())) {
     throw std::runtime_error("Task queue init failed.");
   }
+  local_queues_.reserve(threads);
   for (size_t i = 0; i < threads; ++i) {
-    workers_.emplace_back([this] {
-      while (!stop_) {
-        std::function<void()> task;
-        if (task_queue_.WaitDequeue(&task)) {
-          task();
-        }
-      }
-    });
+    local_queues_.emplace_back(new WorkerQueue());
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+inline void ThreadPool::WorkerLoop(std::size_t index) {
+  while (!stop_) {
+    std::function<void()> task;
+    if (NextTask(index, &task)) {
+      task();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    if (stop_ || task_count_.load() > 0) {
+      continue;
+    }
+    wait_cv_.wait(lock);
+  }
+}
+
+inline bool ThreadPool::NextTask(std::size_t index,
+                                 std::function<void()>* task) {
+  // Own queue first, oldest task first.
+  {
+    auto& local = *local_queues_[index];
+    std::lock_guard<std::mutex> lock(local.mutex);
+    if (!local.tasks.empty()) {
+      *task = std::move(local.tasks.front());
+      local.tasks.pop_front();
+      task_count_.fetch_sub(1);
+      return true;
+    }
+  }
+  // Steal the newest task from a sibling to keep its older, still
+  // cache-warm work on its owner.
+  for (std::size_t i = 1; i < local_queues_.size(); ++i) {
+    auto& victim = *local_queues_[(index + i) % local_queues_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      *task = std::move(victim.tasks.back());
+      victim.tasks.pop_back();
+      task_count_.fetch_sub(1);
+      return true;
+    }
+  }
+  // Untagged tasks live in the shared queue.
+  if (task_queue_.Dequeue(task)) {
+    task_count_.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+inline void ThreadPool::PushLocal(std::size_t index,
+                                  std::function<void()>&& task) {
+  auto& local = *local_queues_[index];
+  {
+    std::lock_guard<std::mutex> lock(local.mutex);
+    local.tasks.emplace_back(std::move(task));
   }
+  task_count_.fetch_add(1);
+}
+
+inline void ThreadPool::NotifyOne() {
+  std::lock_guard<std::mutex> lock(wait_mutex_);
+  wait_cv_.notify_one();
 }
 
 // before using the return value, you should check value.valid()
@@ -81,16 +176,91 @@ auto ThreadPool::Enqueue(F&& f, Args&&... args)
   if (stop_) {
     return std::future<return_type>();
   }
-  task_queue_.Enqueue([task]() { (*task)(); });
+  if (task_queue_.Enqueue([task]() { (*task)(); })) {
+    task_count_.fetch_add(1);
+    NotifyOne();
+  }
+  return res;
+};
+
+// before using the return value, you should check value.valid()
+template <typename F, typename... Args>
+auto ThreadPool::EnqueueWithTag(std::size_t tag, F&& f, Args&&... args)
+    -> std::future<typename std::result_of<F(Args...)>::type> {
+  using return_type = typename std::result_of<F(Args...)>::type;
+
+  auto task = std::make_shared<std::packaged_task<return_type()>>(
+      std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+
+  std::future<return_type> res = task->get_future();
+
+  if (stop_ || local_queues_.empty()) {
+    return std::future<return_type>();
+  }
+  PushLocal(tag % local_queues_.size(), [task]() { (*task)(); });
+  NotifyOne();
   return res;
 };
 
+inline void ThreadPool::ParallelFor(
+    std::size_t begin, std::size_t end,
+    const std::function<void(std::size_t)>& func, std::size_t tag) {
+  if (begin >= end) {
+    return;
+  }
+  const std::size_t range = end - begin;
+  std::size_t shard_num = local_queues_.size() + 1;
+  if (shard_num > range) {
+    shard_num = range;
+  }
+  if (stop_ || shard_num < 2) {
+    for (std::size_t i = begin; i < end; ++i) {
+      func(i);
+    }
+    return;
+  }
+  const std::size_t chunk = (range + shard_num - 1) / shard_num;
+  std::atomic<std::size_t> remain(shard_num - 1);
+  std::promise<void> done;
+  auto finished = done.get_future();
+  for (std::size_t s = 1; s < shard_num; ++s) {
+    const std::size_t shard_begin = begin + s * chunk;
+    std::size_t shard_end = shard_begin + chunk;
+    if (shard_end > end) {
+      shard_end = end;
+    }
+    PushLocal((tag + s) % local_queues_.size(),
+              [&func, &remain, &done, shard_begin, shard_end]() {
+                for (std::size_t i = shard_begin; i < shard_end; ++i) {
+                  func(i);
+                }
+                if (remain.fetch_sub(1) == 1) {
+                  done.set_value();
+                }
+              });
+  }
+  {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    wait_cv_.notify_all();
+  }
+  // The caller runs the first shard itself instead of idling.
+  const std::size_t first_end = std::min(begin + chunk, end);
+  for (std::size_t i = begin; i < first_end; ++i) {
+    func(i);
+  }
+  finished.wait();
+}
+
 // the destructor joins all threads
 inline ThreadPool::~ThreadPool() {
   if (stop_.exchange(true)) {
     return;
   }
   task_queue_.BreakAllWait();
+  {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    wait_cv_.notify_all();
+  }
   for (std::thread& worker : workers_) {
     worker.join();
   }
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/thread_pool.h"
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(ThreadPoolTest, Enqueue) {
+  ThreadPool pool(4);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; i++) {
+    results.emplace_back(pool.Enqueue([](int value) { return value * 2; }, i));
+  }
+  for (int i = 0; i < 100; i++) {
+    ASSERT_TRUE(results[i].valid());
+    EXPECT_EQ(i * 2, results[i].get());
+  }
+}
+
+TEST(ThreadPoolTest, EnqueueWithTag) {
+  ThreadPool pool(4);
+  std::vector<std::future<std::thread::id>> results;
+  for (int i = 0; i < 32; i++) {
+    results.emplace_back(
+        pool.EnqueueWithTag(7, []() { return std::this_thread::get_id(); }));
+  }
+  for (auto& result : results) {
+    ASSERT_TRUE(result.valid());
+    result.get();
+  }
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+  ThreadPool pool(4);
+  const std::size_t size = 1000;
+  std::vector<std::atomic<int>> counts(size);
+  for (auto& count : counts) {
+    count = 0;
+  }
+  pool.ParallelFor(0, size,
+                   [&counts](std::size_t i) { counts[i].fetch_add(1); });
+  for (const auto& count : counts) {
+    EXPECT_EQ(1, count.load());
+  }
+}
+
+TEST(ThreadPoolTest, ParallelForSmallRange) {
+  ThreadPool pool(4);
+  std::atomic<int> sum = {0};
+  pool.ParallelFor(0, 1, [&sum](std::size_t i) {
+    sum.fetch_add(static_cast<int>(i) + 1);
+  });
+  EXPECT_EQ(1, sum.load());
+  pool.ParallelFor(5, 5, [&sum](std::size_t) { sum.fetch_add(1); });
+  EXPECT_EQ(1, sum.load());
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -23,6 +23,14 @@
 #include <mutex>
 #include <thread>
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <climits>
+#endif
+
 namespace apollo {
 namespace cyber {
 namespace base {
@@ -87,6 +95,38 @@ class BusySpinWaitStrategy : public WaitStrategy {
   bool EmptyWait() override { return true; }
 };
 
+#if defined(__linux__)
+// Futex-based strategy: notify is a single atomic add plus a futex wake,
+// no mutex is taken on either side. Lost-wakeup safety comes from the
+// sequence check between the waiter's load and the FUTEX_WAIT.
+class FutexWaitStrategy : public WaitStrategy {
+ public:
+  FutexWaitStrategy() {}
+
+  void NotifyOne() override {
+    seq_.fetch_add(1, std::memory_order_release);
+    syscall(SYS_futex, reinterpret_cast<int*>(&seq_), FUTEX_WAKE_PRIVATE, 1,
+            nullptr, nullptr, 0);
+  }
+
+  bool EmptyWait() override {
+    const int expected = seq_.load(std::memory_order_acquire);
+    syscall(SYS_futex, reinterpret_cast<int*>(&seq_), FUTEX_WAIT_PRIVATE,
+            expected, nullptr, nullptr, 0);
+    return true;
+  }
+
+  void BreakAllWait() override {
+    seq_.fetch_add(1, std::memory_order_release);
+    syscall(SYS_futex, reinterpret_cast<int*>(&seq_), FUTEX_WAKE_PRIVATE,
+            INT_MAX, nullptr, nullptr, 0);
+  }
+
+ private:
+  std::atomic<int> seq_ = {0};
+};
+#endif
+
 class TimeoutBlockWaitStrategy : public WaitStrategy {
  public:
   TimeoutBlockWaitStrategy() {}
@@ -18,12 +18,13 @@
 #define CYBER_BLOCKER_BLOCKER_H_
 
 #include <stddef.h>
+#include <atomic>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace apollo {
@@ -67,10 +68,10 @@ class Blocker : public BlockerBase {
  public:
   using MessageType = T;
   using MessagePtr = std::shared_ptr<T>;
-  using MessageQueue = std::list<MessagePtr>;
+  using MessageQueue = std::vector<MessagePtr>;
   using Callback = std::function<void(const MessagePtr&)>;
   using CallbackMap = std::unordered_map<std::string, Callback>;
-  using Iterator = typename std::list<std::shared_ptr<T>>::const_iterator;
+  using Iterator = typename std::vector<std::shared_ptr<T>>::const_iterator;
 
   explicit Blocker(const BlockerAttr& attr);
   virtual ~Blocker();
@@ -105,8 +106,18 @@ class Blocker : public BlockerBase {
   void Notify(const MessagePtr& msg);
 
   BlockerAttr attr_;
-  MessageQueue observed_msg_queue_;
-  MessageQueue published_msg_queue_;
+  // Published history lives in a fixed ring: Enqueue overwrites the oldest
+  // slot in place, so steady-state publishing never allocates. Observe only
+  // refreshes its snapshot when the ring version moved, and the snapshot
+  // vector is preallocated, so repeated observes of an idle channel are O(1)
+  // and a busy one costs a bounded pointer copy.
+  MessageQueue published_ring_;
+  size_t publish_head_ = 0;  // next slot to overwrite
+  size_t publish_count_ = 0;
+  uint64_t publish_version_ = 0;
+  MessageQueue observed_msgs_;  // snapshot view, newest first
+  uint64_t observed_version_ = 0;
+  bool observed_valid_ = false;
   mutable std::mutex msg_mutex_;
 
   CallbackMap published_callbacks_;
@@ -120,8 +131,8 @@ Blocker<T>::Blocker(const BlockerAttr& attr) : attr_(attr), dummy_msg_() {}
 
 template <typename T>
 Blocker<T>::~Blocker() {
-  published_msg_queue_.clear();
-  observed_msg_queue_.clear();
+  published_ring_.clear();
+  observed_msgs_.clear();
   published_callbacks_.clear();
 }
 
@@ -140,8 +151,12 @@ template <typename T>
 void Blocker<T>::Reset() {
   {
     std::lock_guard<std::mutex> lock(msg_mutex_);
-    observed_msg_queue_.clear();
-    published_msg_queue_.clear();
+    observed_msgs_.clear();
+    observed_valid_ = false;
+    published_ring_.clear();
+    publish_head_ = 0;
+    publish_count_ = 0;
+    ++publish_version_;
   }
   {
     std::lock_guard<std::mutex> lock(cb_mutex_);
@@ -152,31 +167,46 @@ void Blocker<T>::Reset() {
 template <typename T>
 void Blocker<T>::ClearObserved() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  observed_msg_queue_.clear();
+  observed_msgs_.clear();
+  observed_valid_ = false;
 }
 
 template <typename T>
 void Blocker<T>::ClearPublished() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  published_msg_queue_.clear();
+  published_ring_.assign(published_ring_.size(), nullptr);
+  publish_head_ = 0;
+  publish_count_ = 0;
+  ++publish_version_;
 }
 
 template <typename T>
 void Blocker<T>::Observe() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  observed_msg_queue_ = published_msg_queue_;
+  if (observed_valid_ && observed_version_ == publish_version_) {
+    return;
+  }
+  observed_msgs_.clear();
+  observed_msgs_.reserve(attr_.capacity);
+  for (size_t i = 0; i < publish_count_; ++i) {
+    observed_msgs_.emplace_back(
+        published_ring_[(publish_head_ + published_ring_.size() - 1 - i) %
+                        published_ring_.size()]);
+  }
+  observed_version_ = publish_version_;
+  observed_valid_ = true;
 }
 
 template <typename T>
 bool Blocker<T>::IsObservedEmpty() const {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  return observed_msg_queue_.empty();
+  return observed_msgs_.empty();
 }
 
 template <typename T>
 bool Blocker<T>::IsPublishedEmpty() const {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  return published_msg_queue_.empty();
+  return publish_count_ == 0;
 }
 
 template <typename T>
@@ -199,47 +229,48 @@ bool Blocker<T>::Unsubscribe(const std::string& callback_id) {
 template <typename T>
 auto Blocker<T>::GetLatestObserved() const -> const MessageType& {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  if (observed_msg_queue_.empty()) {
+  if (observed_msgs_.empty()) {
     return dummy_msg_;
   }
-  return *observed_msg_queue_.front();
+  return *observed_msgs_.front();
 }
 
 template <typename T>
 auto Blocker<T>::GetLatestObservedPtr() const -> const MessagePtr {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  if (observed_msg_queue_.empty()) {
+  if (observed_msgs_.empty()) {
     return nullptr;
   }
-  return observed_msg_queue_.front();
+  return observed_msgs_.front();
 }
 
 template <typename T>
 auto Blocker<T>::GetOldestObservedPtr() const -> const MessagePtr {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  if (observed_msg_queue_.empty()) {
+  if (observed_msgs_.empty()) {
     return nullptr;
   }
-  return observed_msg_queue_.back();
+  return observed_msgs_.back();
 }
 
 template <typename T>
 auto Blocker<T>::GetLatestPublishedPtr() const -> const MessagePtr {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  if (published_msg_queue_.empty()) {
+  if (publish_count_ == 0) {
     return nullptr;
   }
-  return published_msg_queue_.front();
+  return published_ring_[(publish_head_ + published_ring_.size() - 1) %
+                         published_ring_.size()];
 }
 
 template <typename T>
 auto Blocker<T>::ObservedBegin() const -> Iterator {
-  return observed_msg_queue_.begin();
+  return observed_msgs_.begin();
 }
 
 template <typename T>
 auto Blocker<T>::ObservedEnd() const -> Iterator {
-  return observed_msg_queue_.end();
+  return observed_msgs_.end();
 }
 
 template <typename T>
@@ -250,10 +281,19 @@ size_t Blocker<T>::capacity() const {
 template <typename T>
 void Blocker<T>::set_capacity(size_t capacity) {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  attr_.capacity = capacity;
-  while (published_msg_queue_.size() > capacity) {
-    published_msg_queue_.pop_back();
+  // rebuild the ring keeping the newest messages in newest-first order
+  MessageQueue new_ring(capacity);
+  size_t new_count = publish_count_ < capacity ? publish_count_ : capacity;
+  for (size_t i = 0; i < new_count; ++i) {
+    new_ring[new_count - 1 - i] =
+        published_ring_[(publish_head_ + published_ring_.size() - 1 - i) %
+                        published_ring_.size()];
   }
+  published_ring_ = std::move(new_ring);
+  publish_head_ = new_count % (capacity == 0 ? 1 : capacity);
+  publish_count_ = new_count;
+  attr_.capacity = capacity;
+  ++publish_version_;
 }
 
 template <typename T>
@@ -267,10 +307,15 @@ void Blocker<T>::Enqueue(const MessagePtr& msg) {
     return;
   }
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  published_msg_queue_.push_front(msg);
-  while (published_msg_queue_.size() > attr_.capacity) {
-    published_msg_queue_.pop_back();
+  if (published_ring_.size() != attr_.capacity) {
+    published_ring_.resize(attr_.capacity);
+  }
+  published_ring_[publish_head_] = msg;
+  publish_head_ = (publish_head_ + 1) % attr_.capacity;
+  if (publish_count_ < attr_.capacity) {
+    ++publish_count_;
   }
+  ++publish_version_;
 }
 
 template <typename T>
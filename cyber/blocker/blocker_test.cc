@@ -76,6 +76,42 @@ TEST(BlockerTest, publish) {
   EXPECT_TRUE(blocker.IsObservedEmpty());
 }
 
+TEST(BlockerTest, ring_history) {
+  BlockerAttr attr(3, "channel");
+  Blocker<UnitTest> blocker(attr);
+
+  for (int i = 0; i < 5; ++i) {
+    auto msg = std::make_shared<UnitTest>();
+    msg->set_case_name("publish_" + std::to_string(i));
+    blocker.Publish(msg);
+  }
+
+  blocker.Observe();
+  EXPECT_EQ(blocker.GetLatestObservedPtr()->case_name(), "publish_4");
+  EXPECT_EQ(blocker.GetOldestObservedPtr()->case_name(), "publish_2");
+
+  size_t count = 0;
+  for (auto it = blocker.ObservedBegin(); it != blocker.ObservedEnd(); ++it) {
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+
+  // observing again without new publishes keeps the same snapshot
+  blocker.Observe();
+  EXPECT_EQ(blocker.GetLatestObservedPtr()->case_name(), "publish_4");
+
+  // shrinking the capacity keeps the newest messages
+  blocker.set_capacity(2);
+  blocker.Observe();
+  EXPECT_EQ(blocker.GetLatestObservedPtr()->case_name(), "publish_4");
+  EXPECT_EQ(blocker.GetOldestObservedPtr()->case_name(), "publish_3");
+
+  blocker.ClearObserved();
+  EXPECT_TRUE(blocker.IsObservedEmpty());
+  blocker.Observe();
+  EXPECT_FALSE(blocker.IsObservedEmpty());
+}
+
 TEST(BlockerTest, subscribe) {
   BlockerAttr attr(10, "channel");
   Blocker<UnitTest> blocker(attr);
@@ -18,8 +18,8 @@
 #define CYBER_BLOCKER_INTRA_READER_H_
 
 #include <functional>
-#include <list>
 #include <memory>
+#include <vector>
 
 #include "cyber/blocker/blocker_manager.h"
 #include "cyber/common/log.h"
@@ -36,7 +36,7 @@ class IntraReader : public apollo::cyber::Reader<MessageT> {
   using MessagePtr = std::shared_ptr<MessageT>;
   using Callback = std::function<void(const std::shared_ptr<MessageT>&)>;
   using Iterator =
-      typename std::list<std::shared_ptr<MessageT>>::const_iterator;
+      typename std::vector<std::shared_ptr<MessageT>>::const_iterator;
 
   IntraReader(const proto::RoleAttributes& attr, const Callback& callback);
   virtual ~IntraReader();
@@ -23,9 +23,9 @@ namespace cyber {
 namespace class_loader {
 namespace utility {
 
-std::recursive_mutex& GetClassFactoryMapMapMutex() {
-  static std::recursive_mutex m;
-  return m;
+base::AtomicRWLock& GetClassFactoryMapMapLock() {
+  static base::AtomicRWLock lock;
+  return lock;
 }
 
 std::recursive_mutex& GetLibPathPocoShareLibMutex() {
@@ -93,7 +93,7 @@ ClassFactoryVector GetAllClassFactoryObjects(
 }
 
 ClassFactoryVector GetAllClassFactoryObjects() {
-  std::lock_guard<std::recursive_mutex> lck(GetClassFactoryMapMapMutex());
+  base::ReadLockGuard<base::AtomicRWLock> lock(GetClassFactoryMapMapLock());
 
   ClassFactoryVector all_class_factory_objs;
   BaseToClassFactoryMapMap& factory_map_map = GetClassFactoryMapMap();
@@ -142,7 +142,7 @@ void DestroyClassFactoryObjectsOfLibrary(
 
 void DestroyClassFactoryObjectsOfLibrary(const std::string& library_path,
                                          const ClassLoader* loader) {
-  std::lock_guard<std::recursive_mutex> lck(GetClassFactoryMapMapMutex());
+  base::WriteLockGuard<base::AtomicRWLock> lock(GetClassFactoryMapMapLock());
 
   BaseToClassFactoryMapMap& factory_map_map = GetClassFactoryMapMap();
   for (auto& baseclass_map : factory_map_map) {
@@ -28,6 +28,7 @@
 #include <utility>
 #include <vector>
 
+#include "cyber/base/atomic_rw_lock.h"
 #include "cyber/class_loader/utility/class_factory.h"
 #include "cyber/common/log.h"
 
@@ -51,9 +52,14 @@ using LibpathPocolibVector =
 using ClassFactoryVector = std::vector<AbstractClassFactoryBase*>;
 
 BaseToClassFactoryMapMap& GetClassFactoryMapMap();
-std::recursive_mutex& GetClassFactoryMapMapMutex();
+// Factory registration and unloading are rare; object creation happens all
+// the time. The factory map is therefore guarded by a reader/writer lock so
+// concurrent CreateClassObj calls never serialize on each other.
+base::AtomicRWLock& GetClassFactoryMapMapLock();
 LibpathPocolibVector& GetLibPathPocoShareLibVector();
 std::recursive_mutex& GetLibPathPocoShareLibMutex();
+// Note: creates the map for the base class when it doesn't exist yet, so it
+// may only be called while holding the write lock.
 ClassClassFactoryMap& GetClassFactoryMapByBaseClass(
     const std::string& typeid_base_class_name);
 std::string GetCurLoadingLibraryName();
@@ -83,24 +89,29 @@ void RegisterClass(const std::string& class_name,
   new_class_factrory_obj->AddOwnedClassLoader(GetCurActiveClassLoader());
   new_class_factrory_obj->SetRelativeLibraryPath(GetCurLoadingLibraryName());
 
-  GetClassFactoryMapMapMutex().lock();
-  ClassClassFactoryMap& factory_map =
-      GetClassFactoryMapByBaseClass(typeid(Base).name());
-  factory_map[class_name] = new_class_factrory_obj;
-  GetClassFactoryMapMapMutex().unlock();
+  {
+    base::WriteLockGuard<base::AtomicRWLock> lock(GetClassFactoryMapMapLock());
+    ClassClassFactoryMap& factory_map =
+        GetClassFactoryMapByBaseClass(typeid(Base).name());
+    factory_map[class_name] = new_class_factrory_obj;
+  }
 }
 
 template <typename Base>
 Base* CreateClassObj(const std::string& class_name, ClassLoader* loader) {
-  GetClassFactoryMapMapMutex().lock();
-  ClassClassFactoryMap& factoryMap =
-      GetClassFactoryMapByBaseClass(typeid(Base).name());
   AbstractClassFactory<Base>* factory = nullptr;
-  if (factoryMap.find(class_name) != factoryMap.end()) {
-    factory = dynamic_cast<utility::AbstractClassFactory<Base>*>(
-        factoryMap[class_name]);
+  {
+    base::ReadLockGuard<base::AtomicRWLock> lock(GetClassFactoryMapMapLock());
+    BaseToClassFactoryMapMap& factory_map_map = GetClassFactoryMapMap();
+    auto base_iter = factory_map_map.find(typeid(Base).name());
+    if (base_iter != factory_map_map.end()) {
+      auto class_iter = base_iter->second.find(class_name);
+      if (class_iter != base_iter->second.end()) {
+        factory = dynamic_cast<utility::AbstractClassFactory<Base>*>(
+            class_iter->second);
+      }
+    }
   }
-  GetClassFactoryMapMapMutex().unlock();
 
   Base* classobj = nullptr;
   if (factory && factory->IsOwnedBy(loader)) {
@@ -112,12 +123,15 @@ Base* CreateClassObj(const std::string& class_name, ClassLoader* loader) {
 
 template <typename Base>
 std::vector<std::string> GetValidClassNames(ClassLoader* loader) {
-  std::lock_guard<std::recursive_mutex> lck(GetClassFactoryMapMapMutex());
+  base::ReadLockGuard<base::AtomicRWLock> lock(GetClassFactoryMapMapLock());
 
-  ClassClassFactoryMap& factoryMap =
-      GetClassFactoryMapByBaseClass(typeid(Base).name());
   std::vector<std::string> classes;
-  for (auto& class_factory : factoryMap) {
+  BaseToClassFactoryMapMap& factory_map_map = GetClassFactoryMapMap();
+  auto base_iter = factory_map_map.find(typeid(Base).name());
+  if (base_iter == factory_map_map.end()) {
+    return classes;
+  }
+  for (auto& class_factory : base_iter->second) {
     AbstractClassFactoryBase* factory = class_factory.second;
     if (factory && factory->IsOwnedBy(loader)) {
       classes.emplace_back(class_factory.first);
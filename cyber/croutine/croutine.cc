@@ -37,6 +37,7 @@ thread_local char *CRoutine::main_stack_ = nullptr;
 namespace {
 std::shared_ptr<base::CCObjectPool<RoutineContext>> context_pool = nullptr;
 std::once_flag pool_init_flag;
+size_t default_stack_size = STACK_SIZE;
 
 void CRoutineEntry(void *arg) {
   CRoutine *r = static_cast<CRoutine *>(arg);
@@ -45,7 +46,8 @@ void CRoutineEntry(void *arg) {
 }
 }  // namespace
 
-CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
+CRoutine::CRoutine(const std::function<void()> &func, size_t stack_size)
+    : func_(func) {
   std::call_once(pool_init_flag, [&]() {
     auto routine_num = 100;
     auto &global_conf = common::GlobalData::Instance()->Config();
@@ -53,7 +55,12 @@ CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
         global_conf.scheduler_conf().has_routine_num()) {
       routine_num = global_conf.scheduler_conf().routine_num();
     }
-    context_pool.reset(new base::CCObjectPool<RoutineContext>(routine_num));
+    if (global_conf.has_scheduler_conf() &&
+        global_conf.scheduler_conf().has_routine_stack_size()) {
+      default_stack_size = global_conf.scheduler_conf().routine_stack_size();
+    }
+    context_pool.reset(
+        new base::CCObjectPool<RoutineContext>(routine_num, true));
   });
 
   context_ = context_pool->GetObject();
@@ -63,12 +70,28 @@ CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
     context_.reset(new RoutineContext());
   }
 
+  // stacks are pooled with their context and only remapped when the
+  // requested size changes
+  auto want_size = stack_size > 0 ? stack_size : default_stack_size;
+  if (context_->stack_size != want_size) {
+    if (!AllocStack(context_.get(), want_size)) {
+      AERROR << "failed to allocate stack for croutine, fall back to "
+             << STACK_SIZE << " bytes.";
+      ACHECK(AllocStack(context_.get(), STACK_SIZE));
+    }
+  }
+
   MakeContext(CRoutineEntry, this, context_.get());
   state_ = RoutineState::READY;
   updated_.test_and_set(std::memory_order_release);
 }
 
-CRoutine::~CRoutine() { context_ = nullptr; }
+CRoutine::~CRoutine() {
+  if (context_ != nullptr) {
+    ReclaimStack(context_.get());
+  }
+  context_ = nullptr;
+}
 
 RoutineState CRoutine::Resume() {
   if (unlikely(force_stop_)) {
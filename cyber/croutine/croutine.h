@@ -39,7 +39,7 @@ enum class RoutineState { READY, FINISHED, SLEEP, IO_WAIT, DATA_WAIT };
 
 class CRoutine {
  public:
-  explicit CRoutine(const RoutineFunc &func);
+  explicit CRoutine(const RoutineFunc &func, size_t stack_size = 0);
   virtual ~CRoutine();
 
   // static interfaces
@@ -83,6 +83,15 @@ class CRoutine {
   int processor_id() const;
   void set_processor_id(int processor_id);
 
+  // Processor that last resumed this croutine; -1 before the first resume.
+  // Unlike processor_id(), which records the choreography assignment, this
+  // follows the croutine across steals and is used to count migrations.
+  int last_exec_processor() const;
+  void set_last_exec_processor(int processor_id);
+
+  uint32_t migration_count() const;
+  void IncreaseMigrationCount();
+
   uint32_t priority() const;
   void set_priority(uint32_t priority);
 
@@ -113,6 +122,8 @@ class CRoutine {
   bool force_stop_ = false;
 
   int processor_id_ = -1;
+  int last_exec_processor_ = -1;
+  uint32_t migration_count_ = 0;
   uint32_t priority_ = 0;
   uint64_t id_ = 0;
 
@@ -173,6 +184,18 @@ inline void CRoutine::set_processor_id(int processor_id) {
   processor_id_ = processor_id;
 }
 
+inline int CRoutine::last_exec_processor() const {
+  return last_exec_processor_;
+}
+
+inline void CRoutine::set_last_exec_processor(int processor_id) {
+  last_exec_processor_ = processor_id;
+}
+
+inline uint32_t CRoutine::migration_count() const { return migration_count_; }
+
+inline void CRoutine::IncreaseMigrationCount() { ++migration_count_; }
+
 inline RoutineState CRoutine::UpdateState() {
   // Synchronous Event Mechanism
   if (state_ == RoutineState::SLEEP &&
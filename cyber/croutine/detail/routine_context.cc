@@ -16,6 +16,9 @@
 
 #include "cyber/croutine/detail/routine_context.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 namespace apollo {
 namespace cyber {
 namespace croutine {
@@ -38,14 +41,54 @@ namespace croutine {
 // ctx->sp  =>  |        RBP       |
 //              +------------------+
 void MakeContext(const func &f1, const void *arg, RoutineContext *ctx) {
-  ctx->sp = ctx->stack + STACK_SIZE - 2 * sizeof(void *) - REGISTERS_SIZE;
+  ctx->sp = ctx->stack + ctx->stack_size - 2 * sizeof(void *) - REGISTERS_SIZE;
   std::memset(ctx->sp, 0, REGISTERS_SIZE);
-  char *sp = ctx->stack + STACK_SIZE - 2 * sizeof(void *);
+  char *sp = ctx->stack + ctx->stack_size - 2 * sizeof(void *);
   *reinterpret_cast<void **>(sp) = reinterpret_cast<void *>(f1);
   sp -= sizeof(void *);
   *reinterpret_cast<void **>(sp) = const_cast<void *>(arg);
 }
 
+bool AllocStack(RoutineContext *ctx, size_t stack_size) {
+  FreeStack(ctx);
+
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  stack_size = (stack_size + page_size - 1) / page_size * page_size;
+  void *mem = mmap(nullptr, stack_size + page_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (mem == MAP_FAILED) {
+    AERROR << "failed to map croutine stack of size " << stack_size;
+    return false;
+  }
+  // lowest page guards against overflow, a hit faults instead of corrupting
+  if (mprotect(mem, page_size, PROT_NONE) != 0) {
+    AERROR << "failed to protect croutine stack guard page.";
+    munmap(mem, stack_size + page_size);
+    return false;
+  }
+
+  ctx->stack = static_cast<char *>(mem) + page_size;
+  ctx->stack_size = stack_size;
+  return true;
+}
+
+void FreeStack(RoutineContext *ctx) {
+  if (ctx->stack == nullptr) {
+    return;
+  }
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  munmap(ctx->stack - page_size, ctx->stack_size + page_size);
+  ctx->stack = nullptr;
+  ctx->stack_size = 0;
+}
+
+void ReclaimStack(RoutineContext *ctx) {
+  if (ctx->stack == nullptr) {
+    return;
+  }
+  madvise(ctx->stack, ctx->stack_size, MADV_DONTNEED);
+}
+
 }  // namespace croutine
 }  // namespace cyber
 }  // namespace apollo
@@ -36,10 +36,19 @@ constexpr size_t REGISTERS_SIZE = 56;
 
 typedef void (*func)(void*);
 struct RoutineContext {
-  char stack[STACK_SIZE];
+  char* stack = nullptr;
+  size_t stack_size = 0;
   char* sp = nullptr;
 };
 
+// Maps a lazily-committed stack of stack_size bytes with a PROT_NONE guard
+// page below it, replacing any stack already attached to the context.
+bool AllocStack(RoutineContext* ctx, size_t stack_size);
+void FreeStack(RoutineContext* ctx);
+// Returns committed stack pages to the kernel but keeps the mapping, so a
+// pooled context costs no resident memory until it is reused.
+void ReclaimStack(RoutineContext* ctx);
+
 void MakeContext(const func& f1, const void* arg, RoutineContext* ctx);
 
 inline void SwapContext(char** src_sp, char** dest_sp) {
@@ -58,9 +58,11 @@ RoutineFactory CreateRoutineFactory(
       for (;;) {
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg)) {
+          dv->NotifyUnblocked();
           f(msg);
           CRoutine::Yield(RoutineState::READY);
         } else {
+          dv->NotifyBlocked();
           CRoutine::Yield();
         }
       }
@@ -81,9 +83,11 @@ RoutineFactory CreateRoutineFactory(
       for (;;) {
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg0, msg1)) {
+          dv->NotifyUnblocked();
           f(msg0, msg1);
           CRoutine::Yield(RoutineState::READY);
         } else {
+          dv->NotifyBlocked();
           CRoutine::Yield();
         }
       }
@@ -105,9 +109,11 @@ RoutineFactory CreateRoutineFactory(
       for (;;) {
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg0, msg1, msg2)) {
+          dv->NotifyUnblocked();
           f(msg0, msg1, msg2);
           CRoutine::Yield(RoutineState::READY);
         } else {
+          dv->NotifyBlocked();
           CRoutine::Yield();
         }
       }
@@ -130,9 +136,11 @@ RoutineFactory CreateRoutineFactory(
       for (;;) {
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg0, msg1, msg2, msg3)) {
+          dv->NotifyUnblocked();
           f(msg0, msg1, msg2, msg3);
           CRoutine::Yield(RoutineState::READY);
         } else {
+          dv->NotifyBlocked();
           CRoutine::Yield();
         }
       }
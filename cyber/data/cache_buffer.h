@@ -18,6 +18,7 @@
 #define CYBER_DATA_CACHE_BUFFER_H_
 
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace apollo {
@@ -67,6 +68,26 @@ class CacheBuffer {
     }
   }
 
+  // Changes the buffer depth while keeping the newest elements and their
+  // absolute positions. The caller must hold Mutex().
+  void Resize(uint64_t size) {
+    const uint64_t capacity = size + 1;
+    if (capacity == capacity_) {
+      return;
+    }
+    std::vector<T> buffer(capacity);
+    if (tail_ - head_ > capacity - 1) {
+      head_ = tail_ - (capacity - 1);
+    }
+    for (uint64_t pos = head_ + 1; pos <= tail_; ++pos) {
+      buffer[pos % capacity] = std::move(buffer_[GetIndex(pos)]);
+    }
+    buffer_ = std::move(buffer);
+    capacity_ = capacity;
+  }
+
+  uint64_t Capacity() const { return capacity_; }
+
   std::mutex& Mutex() { return mutex_; }
 
  private:
@@ -52,6 +52,33 @@ TEST(CacheBufferTest, cache_buffer_test) {
   EXPECT_TRUE(buffer1.Full());
 }
 
+TEST(CacheBufferTest, cache_buffer_resize) {
+  CacheBuffer<int> buffer(4);
+  for (int i = 0; i < 6; i++) {
+    buffer.Fill(std::move(i));
+  }
+  EXPECT_EQ(4, buffer.Size());
+  EXPECT_EQ(3, buffer.Head());
+  EXPECT_EQ(6, buffer.Tail());
+
+  // growing keeps all elements and their absolute positions
+  buffer.Resize(8);
+  EXPECT_EQ(9, buffer.Capacity());
+  EXPECT_EQ(4, buffer.Size());
+  EXPECT_EQ(2, buffer.Front());
+  EXPECT_EQ(5, buffer.Back());
+  EXPECT_EQ(3, buffer.at(4));
+  buffer.Fill(6);
+  EXPECT_EQ(5, buffer.Size());
+  EXPECT_EQ(6, buffer.Back());
+
+  // shrinking drops the oldest elements beyond the new depth
+  buffer.Resize(2);
+  EXPECT_EQ(2, buffer.Size());
+  EXPECT_EQ(5, buffer.Front());
+  EXPECT_EQ(6, buffer.Back());
+}
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
@@ -25,6 +25,7 @@
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/data/data_notifier.h"
+#include "cyber/data/qos_tuner.h"
 #include "cyber/proto/component_conf.pb.h"
 
 namespace apollo {
@@ -38,7 +39,9 @@ class ChannelBuffer {
  public:
   using BufferType = CacheBuffer<std::shared_ptr<T>>;
   ChannelBuffer(uint64_t channel_id, BufferType* buffer)
-      : channel_id_(channel_id), buffer_(buffer) {}
+      : channel_id_(channel_id),
+        buffer_(buffer),
+        tuner_(new QosTuner(channel_id, buffer_->Capacity() - 1)) {}
 
   bool Fetch(uint64_t* index, std::shared_ptr<T>& m);  // NOLINT
 
@@ -52,6 +55,7 @@ class ChannelBuffer {
  private:
   uint64_t channel_id_;
   std::shared_ptr<BufferType> buffer_;
+  std::shared_ptr<QosTuner> tuner_;
 };
 
 template <typename T>
@@ -62,18 +66,24 @@ bool ChannelBuffer<T>::Fetch(uint64_t* index,
     return false;
   }
 
+  uint64_t dropped = 0;
   if (*index == 0) {
     *index = buffer_->Tail();
   } else if (*index == buffer_->Tail() + 1) {
     return false;
   } else if (*index < buffer_->Head()) {
-    auto interval = buffer_->Tail() - *index;
+    dropped = buffer_->Tail() - *index;
     AWARN << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
-          << "read buffer overflow, drop_message[" << interval << "] pre_index["
+          << "read buffer overflow, drop_message[" << dropped << "] pre_index["
           << *index << "] current_index[" << buffer_->Tail() << "] ";
     *index = buffer_->Tail();
   }
   m = buffer_->at(*index);
+  const auto depth = tuner_->Update(dropped, buffer_->Tail() - *index,
+                                    buffer_->Capacity() - 1);
+  if (depth != 0) {
+    buffer_->Resize(depth);
+  }
   return true;
 }
 
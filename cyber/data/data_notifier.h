@@ -17,6 +17,7 @@
 #ifndef CYBER_DATA_DATA_NOTIFIER_H_
 #define CYBER_DATA_DATA_NOTIFIER_H_
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -37,6 +38,13 @@ using apollo::cyber::event::PerfEventCache;
 
 struct Notifier {
   std::function<void()> callback;
+  // batching mode: fire the callback once per batch_size messages or when
+  // batch_deadline_ns has passed since the last fire, whichever comes first;
+  // batch_size <= 1 keeps the notify-per-message behavior
+  uint32_t batch_size = 1;
+  uint64_t batch_deadline_ns = 0;
+  std::atomic<uint32_t> pending = {0};
+  std::atomic<uint64_t> last_fire_ns = {0};
 };
 
 class DataNotifier {
@@ -74,7 +82,21 @@ inline bool DataNotifier::Notify(const uint64_t channel_id) {
   NotifyVector* notifies = nullptr;
   if (notifies_map_.Get(channel_id, &notifies)) {
     for (auto& notifier : *notifies) {
-      if (notifier->callback) {
+      if (!notifier->callback) {
+        continue;
+      }
+      if (notifier->batch_size <= 1) {
+        notifier->callback();
+        continue;
+      }
+      auto pending =
+          notifier->pending.fetch_add(1, std::memory_order_acq_rel) + 1;
+      auto now = Time::Now().ToNanosecond();
+      auto last = notifier->last_fire_ns.load(std::memory_order_acquire);
+      if (pending >= notifier->batch_size ||
+          now - last >= notifier->batch_deadline_ns) {
+        notifier->pending.store(0, std::memory_order_release);
+        notifier->last_fire_ns.store(now, std::memory_order_release);
         notifier->callback();
       }
     }
@@ -61,6 +61,9 @@ class DataVisitor : public DataVisitorBase {
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
     DataDispatcher<M3>::Instance()->AddBuffer(buffer_m3_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
+    for (const auto& config : configs) {
+      channel_ids_.emplace_back(config.channel_id);
+    }
     data_fusion_ = new fusion::AllLatest<M0, M1, M2, M3>(
         buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_);
   }
@@ -103,6 +106,9 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
+    for (const auto& config : configs) {
+      channel_ids_.emplace_back(config.channel_id);
+    }
     data_fusion_ =
         new fusion::AllLatest<M0, M1, M2>(buffer_m0_, buffer_m1_, buffer_m2_);
   }
@@ -141,6 +147,9 @@ class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
+    for (const auto& config : configs) {
+      channel_ids_.emplace_back(config.channel_id);
+    }
     data_fusion_ = new fusion::AllLatest<M0, M1>(buffer_m0_, buffer_m1_);
   }
 
@@ -172,12 +181,14 @@ class DataVisitor<M0, NullType, NullType, NullType> : public DataVisitorBase {
       : buffer_(configs.channel_id, new BufferType<M0>(configs.queue_size)) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_);
     data_notifier_->AddNotifier(buffer_.channel_id(), notifier_);
+    channel_ids_.emplace_back(configs.channel_id);
   }
 
   DataVisitor(uint64_t channel_id, uint32_t queue_size)
       : buffer_(channel_id, new BufferType<M0>(queue_size)) {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_);
     data_notifier_->AddNotifier(buffer_.channel_id(), notifier_);
+    channel_ids_.emplace_back(channel_id);
   }
 
   bool TryFetch(std::shared_ptr<M0>& m0) {  // NOLINT
@@ -39,6 +39,47 @@ class DataVisitorBase {
     notifier_->callback = callback;
   }
 
+  // Batch wakeups for high-rate channels: the croutine is only notified once
+  // per batch_size messages or when deadline_ns has passed since the last
+  // wakeup. Messages stay latched in the channel buffers meanwhile, so a
+  // batched fetch sees all of them.
+  void SetNotifyBatch(uint32_t batch_size, uint64_t deadline_ns) {
+    notifier_->batch_size = batch_size;
+    notifier_->batch_deadline_ns = deadline_ns;
+  }
+
+  // Hooks for the scheduler's priority inheritance: on_block fires when the
+  // croutine is about to block on empty buffers, on_unblock once a fetch
+  // succeeds again.
+  void RegisterBlockCallbacks(std::function<void()>&& on_block,
+                              std::function<void()>&& on_unblock) {
+    on_block_ = std::move(on_block);
+    on_unblock_ = std::move(on_unblock);
+  }
+
+  // Both run in the owning croutine's own context, so blocked_ needs no
+  // synchronization.
+  void NotifyBlocked() {
+    if (!blocked_) {
+      blocked_ = true;
+      if (on_block_ != nullptr) {
+        on_block_();
+      }
+    }
+  }
+
+  void NotifyUnblocked() {
+    if (blocked_) {
+      blocked_ = false;
+      if (on_unblock_ != nullptr) {
+        on_unblock_();
+      }
+    }
+  }
+
+  // Ids of all channels this visitor fetches from.
+  const std::vector<uint64_t>& channel_ids() const { return channel_ids_; }
+
  protected:
   DataVisitorBase(const DataVisitorBase&) = delete;
   DataVisitorBase& operator=(const DataVisitorBase&) = delete;
@@ -46,6 +87,10 @@ class DataVisitorBase {
   uint64_t next_msg_index_ = 0;
   DataNotifier* data_notifier_ = DataNotifier::Instance();
   std::shared_ptr<Notifier> notifier_;
+  std::vector<uint64_t> channel_ids_;
+  bool blocked_ = false;
+  std::function<void()> on_block_;
+  std::function<void()> on_unblock_;
 };
 
 }  // namespace data
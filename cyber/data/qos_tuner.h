@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_DATA_QOS_TUNER_H_
+#define CYBER_DATA_QOS_TUNER_H_
+
+#include <algorithm>
+#include <cstdint>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace data {
+
+// Adapts the effective depth of one consumer's channel buffer inside a
+// bounded envelope. The consumer feeds every fetch result in here, so the
+// controller sees both overflow drops (the writer outran the depth) and
+// backlog (consumer lag). Depth doubles when messages were lost and decays
+// back to the configured value once a full window passes without drops and
+// with low backlog, so bursts are absorbed without permanently buffering
+// stale frames.
+class QosTuner {
+ public:
+  QosTuner(uint64_t channel_id, uint64_t configured_depth)
+      : channel_id_(channel_id),
+        configured_depth_(configured_depth > 0 ? configured_depth : 1),
+        max_depth_(configured_depth_ * kGrowthLimit > kDepthCeiling
+                       ? kDepthCeiling
+                       : configured_depth_ * kGrowthLimit) {}
+
+  // Feeds one fetch observation. dropped is the number of messages lost
+  // since the last fetch, backlog the number of filled but unread slots and
+  // depth the current buffer depth. Returns the depth the buffer should
+  // switch to, or 0 to keep the current one. Must be called with the
+  // buffer mutex held.
+  uint64_t Update(uint64_t dropped, uint64_t backlog, uint64_t depth) {
+    ++fetch_count_;
+    peak_backlog_ = std::max(peak_backlog_, backlog);
+    if (dropped > 0) {
+      if (depth < max_depth_) {
+        const uint64_t next = std::min(depth * 2, max_depth_);
+        AINFO << "channel["
+              << common::GlobalData::GetChannelById(channel_id_)
+              << "] dropped " << dropped << " messages, grow depth " << depth
+              << " -> " << next;
+        ResetWindow();
+        return next;
+      }
+      if (!saturated_) {
+        saturated_ = true;
+        AWARN << "channel["
+              << common::GlobalData::GetChannelById(channel_id_)
+              << "] still dropping at depth cap " << max_depth_
+              << ", keeping latest messages only";
+      }
+      ResetWindow();
+      return 0;
+    }
+    if (fetch_count_ < kWindowSize) {
+      return 0;
+    }
+    uint64_t next = 0;
+    if (depth > configured_depth_ &&
+        peak_backlog_ * kShrinkHeadroom <= depth) {
+      next = std::max(depth / 2, configured_depth_);
+      saturated_ = false;
+      AINFO << "channel[" << common::GlobalData::GetChannelById(channel_id_)
+            << "] calm for " << kWindowSize << " fetches, shrink depth "
+            << depth << " -> " << next;
+    }
+    ResetWindow();
+    return next;
+  }
+
+  uint64_t ConfiguredDepth() const { return configured_depth_; }
+  uint64_t MaxDepth() const { return max_depth_; }
+
+ private:
+  void ResetWindow() {
+    fetch_count_ = 0;
+    peak_backlog_ = 0;
+  }
+
+  // fetches without a drop before the depth is allowed to decay
+  enum : uint64_t { kWindowSize = 32 };
+  // envelope: never more than kGrowthLimit times the configured depth
+  enum : uint64_t { kGrowthLimit = 4 };
+  enum : uint64_t { kDepthCeiling = 1024 };
+  // shrink only while the peak backlog stays below depth / kShrinkHeadroom
+  enum : uint64_t { kShrinkHeadroom = 4 };
+
+  uint64_t channel_id_;
+  uint64_t configured_depth_;
+  uint64_t max_depth_;
+  uint64_t fetch_count_ = 0;
+  uint64_t peak_backlog_ = 0;
+  bool saturated_ = false;
+};
+
+}  // namespace data
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_DATA_QOS_TUNER_H_
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/data/qos_tuner.h"
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace data {
+
+auto qos_channel = common::Hash("/qos_channel");
+
+TEST(QosTunerTest, grow_on_drop) {
+  QosTuner tuner(qos_channel, 8);
+  EXPECT_EQ(8, tuner.ConfiguredDepth());
+  EXPECT_EQ(32, tuner.MaxDepth());
+  EXPECT_EQ(0, tuner.Update(0, 0, 8));
+  EXPECT_EQ(16, tuner.Update(3, 8, 8));
+  EXPECT_EQ(32, tuner.Update(1, 16, 16));
+  // at the envelope cap no further growth is possible
+  EXPECT_EQ(0, tuner.Update(5, 32, 32));
+}
+
+TEST(QosTunerTest, shrink_when_calm) {
+  QosTuner tuner(qos_channel, 8);
+  EXPECT_EQ(16, tuner.Update(3, 8, 8));
+  uint64_t depth = 0;
+  for (int i = 0; i < 32; ++i) {
+    depth = tuner.Update(0, 1, 16);
+  }
+  // a full calm window with low backlog decays back toward the
+  // configured depth
+  EXPECT_EQ(8, depth);
+  for (int i = 0; i < 32; ++i) {
+    depth = tuner.Update(0, 1, 8);
+  }
+  EXPECT_EQ(0, depth);
+}
+
+TEST(QosTunerTest, no_shrink_with_backlog) {
+  QosTuner tuner(qos_channel, 8);
+  EXPECT_EQ(16, tuner.Update(3, 8, 8));
+  uint64_t depth = 0;
+  for (int i = 0; i < 32; ++i) {
+    depth = tuner.Update(0, 8, 16);
+  }
+  // the consumer is still lagging half the depth, keep the headroom
+  EXPECT_EQ(0, depth);
+}
+
+}  // namespace data
+}  // namespace cyber
+}  // namespace apollo
@@ -37,6 +37,7 @@ enum class SchedPerf {
   NOTIFY_IN = 3,
   NEXT_RT = 4,
   RT_CREATE = 5,
+  MIGRATE = 6,
 };
 
 class EventBase {
@@ -66,6 +67,8 @@ class EventBase {
 // 2 swap_out
 // 3 notify_in
 // 4 next_routine
+// 5 rt_create
+// 6 migrate
 class SchedEvent : public EventBase {
  public:
   SchedEvent() { etype_ = static_cast<int>(EventType::SCHED_EVENT); }
@@ -118,6 +121,18 @@ class TransportEvent : public EventBase {
   uint64_t channel_id_ = UINT64_MAX;
 };
 
+// Fixed-size binary record for the always-on flight recorder. Hot-path
+// writers only fill POD fields; symbolic names are resolved at dump time.
+struct alignas(8) FlightRecord {
+  uint64_t stamp = 0;
+  uint64_t id = 0;  // cr_id for sched events, channel_id for transport
+  uint64_t msg_seq = 0;
+  int32_t etype = 0;
+  int32_t eid = 0;
+  int32_t proc_id = -1;
+  int32_t cr_state = -1;
+};
+
 }  // namespace event
 }  // namespace cyber
 }  // namespace apollo
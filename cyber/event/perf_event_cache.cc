@@ -16,6 +16,9 @@
 
 #include "cyber/event/perf_event_cache.h"
 
+#include <sched.h>
+
+#include <csignal>
 #include <string>
 
 #include "cyber/base/macros.h"
@@ -31,6 +34,8 @@ namespace event {
 
 using common::GetEnv;
 
+std::atomic<bool> PerfEventCache::dump_requested_ = {false};
+
 PerfEventCache::PerfEventCache() {
   auto trans_perf = GetEnv("cyber_trans_perf");
   if (trans_perf != "" && std::stoi(trans_perf)) {
@@ -40,6 +45,23 @@ PerfEventCache::PerfEventCache() {
   if (sched_perf != "" && std::stoi(sched_perf)) {
     enable_sched_perf_ = true;
   }
+  auto flight_recorder = GetEnv("cyber_flight_recorder");
+  if (flight_recorder != "" && !std::stoi(flight_recorder)) {
+    enable_flight_recorder_ = false;
+  }
+
+  if (enable_flight_recorder_) {
+    ring_num_ = std::thread::hardware_concurrency();
+    if (ring_num_ == 0) {
+      ring_num_ = 1;
+    }
+    rings_.reset(new FlightRing[ring_num_]);
+    for (uint32_t i = 0; i < ring_num_; ++i) {
+      rings_[i].records.reset(new FlightRecord[kFlightRingSize]);
+    }
+    std::signal(SIGUSR2, &PerfEventCache::OnDumpSignal);
+    dump_thread_ = std::thread(&PerfEventCache::DumpThreadFunc, this);
+  }
 
   if (enable_sched_perf_ || enable_trans_perf_) {
     if (!event_queue_.Init(kEventQueueSize)) {
@@ -51,11 +73,15 @@ PerfEventCache::PerfEventCache() {
 }
 
 PerfEventCache::~PerfEventCache() {
-  if (!enable_sched_perf_ && !enable_trans_perf_) {
+  if (shutdown_.exchange(true)) {
     return;
   }
 
-  if (shutdown_.exchange(true)) {
+  if (dump_thread_.joinable()) {
+    dump_thread_.join();
+  }
+
+  if (!enable_sched_perf_ && !enable_trans_perf_) {
     return;
   }
 
@@ -72,6 +98,17 @@ PerfEventCache::~PerfEventCache() {
 void PerfEventCache::AddSchedEvent(const SchedPerf event_id,
                                    const uint64_t cr_id, const int proc_id,
                                    const int cr_state) {
+  if (enable_flight_recorder_) {
+    FlightRecord record;
+    record.stamp = Time::Now().ToNanosecond();
+    record.id = cr_id;
+    record.etype = static_cast<int32_t>(EventType::SCHED_EVENT);
+    record.eid = static_cast<int32_t>(event_id);
+    record.proc_id = proc_id;
+    record.cr_state = cr_state;
+    RecordFlight(record);
+  }
+
   if (likely(!enable_sched_perf_)) {
     return;
   }
@@ -89,6 +126,16 @@ void PerfEventCache::AddSchedEvent(const SchedPerf event_id,
 void PerfEventCache::AddTransportEvent(const TransPerf event_id,
                                        const uint64_t channel_id,
                                        const uint64_t msg_seq) {
+  if (enable_flight_recorder_) {
+    FlightRecord record;
+    record.stamp = Time::Now().ToNanosecond();
+    record.id = channel_id;
+    record.msg_seq = msg_seq;
+    record.etype = static_cast<int32_t>(EventType::TRANS_EVENT);
+    record.eid = static_cast<int32_t>(event_id);
+    RecordFlight(record);
+  }
+
   if (likely(!enable_trans_perf_)) {
     return;
   }
@@ -125,6 +172,68 @@ void PerfEventCache::Start() {
   io_thread_ = std::thread(&PerfEventCache::Run, this);
 }
 
+void PerfEventCache::RecordFlight(const FlightRecord& record) {
+  int cpu = sched_getcpu();
+  if (cpu < 0) {
+    cpu = 0;
+  }
+  auto& ring = rings_[static_cast<uint32_t>(cpu) % ring_num_];
+  uint64_t pos =
+      ring.next.fetch_add(1, std::memory_order_relaxed) % kFlightRingSize;
+  // a writer migrated off-core mid-store can tear one record on wrap;
+  // acceptable for a flight recorder and keeps recording lock-free
+  ring.records[pos] = record;
+}
+
+void PerfEventCache::OnDumpSignal(int sig) {
+  (void)sig;
+  dump_requested_.store(true, std::memory_order_relaxed);
+}
+
+void PerfEventCache::DumpThreadFunc() {
+  while (!shutdown_.load()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (dump_requested_.exchange(false)) {
+      std::string file_name =
+          "cyber_flight_" + Time::Now().ToString() + ".data";
+      DumpFlightData(file_name);
+    }
+  }
+}
+
+bool PerfEventCache::DumpFlightData(const std::string& file_name) {
+  if (!enable_flight_recorder_) {
+    return false;
+  }
+  std::ofstream of(file_name, std::ios::trunc);
+  if (!of.is_open()) {
+    AERROR << "failed to open flight data file: " << file_name;
+    return false;
+  }
+  of << Time::Now().ToNanosecond() << std::endl;
+  for (uint32_t i = 0; i < ring_num_; ++i) {
+    auto& ring = rings_[i];
+    uint64_t total = ring.next.load(std::memory_order_relaxed);
+    uint64_t count = total < kFlightRingSize ? total : kFlightRingSize;
+    uint64_t begin = total - count;
+    for (uint64_t j = 0; j < count; ++j) {
+      const auto& record = ring.records[(begin + j) % kFlightRingSize];
+      of << record.etype << "\t" << record.eid << "\t";
+      if (record.etype == static_cast<int32_t>(EventType::SCHED_EVENT)) {
+        of << common::GlobalData::GetTaskNameById(record.id) << "\t"
+           << record.proc_id << "\t" << record.cr_state << "\t";
+      } else {
+        of << common::GlobalData::GetChannelById(record.id) << "\t"
+           << record.msg_seq << "\t";
+      }
+      of << record.stamp << std::endl;
+    }
+  }
+  of.close();
+  AINFO << "flight data dumped to " << file_name;
+  return true;
+}
+
 }  // namespace event
 }  // namespace cyber
 }  // namespace apollo
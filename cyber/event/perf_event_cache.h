@@ -17,9 +17,11 @@
 #ifndef CYBER_EVENT_CACHE_H_
 #define CYBER_EVENT_CACHE_H_
 
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <memory>
+#include <string>
 #include <thread>
 
 #include "cyber/base/bounded_queue.h"
@@ -40,21 +42,44 @@ class PerfEventCache {
   void AddTransportEvent(const TransPerf event_id, const uint64_t channel_id,
                          const uint64_t msg_seq);
 
+  // Decode the flight-recorder rings into a perf-format text file, oldest
+  // record first. Safe to call at any time; records written while the dump
+  // runs may be missed or duplicated. Triggered on demand by SIGUSR2.
+  bool DumpFlightData(const std::string& file_name);
+
  private:
+  // One ring per core so hot-path recording never contends across cores.
+  struct FlightRing {
+    std::unique_ptr<FlightRecord[]> records;
+    std::atomic<uint64_t> next = {0};
+  };
+
   void Start();
   void Run();
+  void RecordFlight(const FlightRecord& record);
+  void DumpThreadFunc();
+  static void OnDumpSignal(int sig);
 
   std::thread io_thread_;
+  std::thread dump_thread_;
   std::ofstream of_;
 
   bool enable_trans_perf_ = false;
   bool enable_sched_perf_ = false;
+  bool enable_flight_recorder_ = true;
   std::atomic<bool> shutdown_ = {false};
+  static std::atomic<bool> dump_requested_;
+
+  uint32_t ring_num_ = 0;
+  std::unique_ptr<FlightRing[]> rings_;
 
   base::BoundedQueue<EventBasePtr> event_queue_;
 
   const int kFlushSize = 512;
   const uint64_t kEventQueueSize = 8192;
+  // 8192 records per core covers a few seconds of scheduling at typical
+  // event rates, enough to look back past any planning deadline miss
+  static const uint64_t kFlightRingSize = 8192;
 
   DECLARE_SINGLETON(PerfEventCache)
 };
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/file_handler.h"
+#include "cyber/common/log.h"
+#include "cyber/io/file_io_dispatcher.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+using croutine::CRoutine;
+using croutine::RoutineState;
+
+FileHandler::FileHandler(int fd)
+    : fd_(fd), is_blocking_(false), routine_(nullptr) {}
+
+ssize_t FileHandler::Read(void* buf, size_t size, off_t offset) {
+  return Transfer(buf, size, offset, true);
+}
+
+ssize_t FileHandler::Write(const void* buf, size_t size, off_t offset) {
+  return Transfer(const_cast<void*>(buf), size, offset, false);
+}
+
+ssize_t FileHandler::Transfer(void* buf, size_t size, off_t offset,
+                              bool is_read) {
+  if (fd_ < 0) {
+    AERROR << "invalid fd[" << fd_ << "]";
+    return -1;
+  }
+
+  routine_ = CRoutine::GetCurrentRoutine();
+  if (routine_ == nullptr) {
+    AERROR << "routine nullptr, please use IO in routine context.";
+    return -1;
+  }
+
+  if (is_blocking_.exchange(true)) {
+    AINFO << "file handler is blocking.";
+    return -1;
+  }
+
+  auto request = std::make_shared<FileIoRequest>();
+  request->fd = fd_;
+  request->buf = buf;
+  request->size = size;
+  request->offset = offset;
+  request->is_read = is_read;
+  request->callback =
+      std::bind(&FileHandler::ResponseCallback, this, std::placeholders::_1);
+
+  if (!FileIoDispatcher::Instance()->Submit(request)) {
+    is_blocking_.exchange(false);
+    return -1;
+  }
+
+  routine_->Yield(RoutineState::IO_WAIT);
+
+  is_blocking_.exchange(false);
+  return response_.nbytes;
+}
+
+void FileHandler::ResponseCallback(const FileIoResponse& rsp) {
+  if (!is_blocking_.load() || routine_ == nullptr) {
+    return;
+  }
+
+  response_ = rsp;
+
+  // The flag is harmless when the backend finishes before the yield: the
+  // scheduler only flips IO_WAIT routines back to READY.
+  routine_->SetUpdateFlag();
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
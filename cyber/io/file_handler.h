@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_FILE_HANDLER_H_
+#define CYBER_IO_FILE_HANDLER_H_
+
+#include <atomic>
+#include <memory>
+
+#include "cyber/croutine/croutine.h"
+#include "cyber/io/file_io_data.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+// Croutine-aware file I/O, the file counterpart of PollHandler. Read and
+// Write submit the operation to the FileIoDispatcher backend thread and
+// yield the calling croutine with IO_WAIT, so bulk loads (map tiles, model
+// weights, calibration files) no longer stall a scheduler processor. The
+// croutine resumes once the backend reports completion. Must be called
+// from croutine context.
+class FileHandler {
+ public:
+  explicit FileHandler(int fd);
+  virtual ~FileHandler() = default;
+
+  // Reads/writes exactly size bytes unless EOF or an error cuts the
+  // transfer short. A negative offset uses the current file position.
+  // Returns the number of bytes transferred, or -1 on failure.
+  ssize_t Read(void* buf, size_t size, off_t offset = -1);
+  ssize_t Write(const void* buf, size_t size, off_t offset = -1);
+
+  int fd() const { return fd_; }
+  void set_fd(int fd) { fd_ = fd; }
+
+ private:
+  ssize_t Transfer(void* buf, size_t size, off_t offset, bool is_read);
+  void ResponseCallback(const FileIoResponse& rsp);
+
+  int fd_;
+  FileIoResponse response_;
+  std::atomic<bool> is_blocking_;
+  croutine::CRoutine* routine_;
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_FILE_HANDLER_H_
@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_FILE_IO_DATA_H_
+#define CYBER_IO_FILE_IO_DATA_H_
+
+#include <sys/types.h>
+#include <functional>
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+struct FileIoResponse {
+  // bytes transferred, or -1 on failure with err holding errno
+  ssize_t nbytes = -1;
+  int err = 0;
+};
+
+struct FileIoRequest {
+  int fd = -1;
+  void* buf = nullptr;
+  size_t size = 0;
+  // file offset for pread/pwrite, or -1 to use the current file position
+  off_t offset = -1;
+  bool is_read = true;
+  std::function<void(const FileIoResponse&)> callback = nullptr;
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_FILE_IO_DATA_H_
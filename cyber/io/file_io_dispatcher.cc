@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/file_io_dispatcher.h"
+
+#include <errno.h>
+#include <unistd.h>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+FileIoDispatcher::FileIoDispatcher() {
+  is_shutdown_.store(false);
+  thread_ = std::thread(&FileIoDispatcher::ThreadFunc, this);
+}
+
+FileIoDispatcher::~FileIoDispatcher() { Shutdown(); }
+
+void FileIoDispatcher::Shutdown() {
+  if (is_shutdown_.exchange(true)) {
+    return;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+bool FileIoDispatcher::Submit(const RequestPtr& request) {
+  if (is_shutdown_.load()) {
+    AERROR << "please submit request before shutdown.";
+    return false;
+  }
+  if (request->fd < 0 || request->buf == nullptr ||
+      request->callback == nullptr) {
+    AERROR << "invalid request, fd: " << request->fd;
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.emplace_back(request);
+  }
+  cv_.notify_one();
+  return true;
+}
+
+void FileIoDispatcher::ThreadFunc() {
+  while (!is_shutdown_.load()) {
+    RequestPtr request = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] {
+        return !requests_.empty() || is_shutdown_.load();
+      });
+      if (requests_.empty()) {
+        break;
+      }
+      request = requests_.front();
+      requests_.pop_front();
+    }
+    Execute(request);
+  }
+}
+
+void FileIoDispatcher::Execute(const RequestPtr& request) {
+  FileIoResponse response;
+  char* buf = static_cast<char*>(request->buf);
+  size_t transferred = 0;
+  while (transferred < request->size) {
+    ssize_t count = 0;
+    if (request->offset >= 0) {
+      const off_t offset =
+          request->offset + static_cast<off_t>(transferred);
+      count = request->is_read
+                  ? pread(request->fd, buf + transferred,
+                          request->size - transferred, offset)
+                  : pwrite(request->fd, buf + transferred,
+                           request->size - transferred, offset);
+    } else {
+      count = request->is_read ? read(request->fd, buf + transferred,
+                                      request->size - transferred)
+                               : write(request->fd, buf + transferred,
+                                       request->size - transferred);
+    }
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      AERROR << "file io failed, fd: " << request->fd
+             << ", errno: " << errno;
+      response.err = errno;
+      response.nbytes = -1;
+      request->callback(response);
+      return;
+    }
+    if (count == 0) {  // end of file
+      break;
+    }
+    transferred += count;
+  }
+  response.nbytes = static_cast<ssize_t>(transferred);
+  request->callback(response);
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
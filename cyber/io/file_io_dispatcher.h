@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_FILE_IO_DISPATCHER_H_
+#define CYBER_IO_FILE_IO_DISPATCHER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "cyber/common/macros.h"
+#include "cyber/io/file_io_data.h"
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+// Executes file read/write requests on a backend thread and reports
+// completion through the request callback. Blocking on disk therefore
+// happens here instead of on a scheduler processor; FileHandler yields the
+// submitting croutine until the callback fires.
+class FileIoDispatcher {
+ public:
+  using RequestPtr = std::shared_ptr<FileIoRequest>;
+
+  virtual ~FileIoDispatcher();
+
+  void Shutdown();
+
+  bool Submit(const RequestPtr& request);
+
+ private:
+  void ThreadFunc();
+  void Execute(const RequestPtr& request);
+
+  std::thread thread_;
+  std::atomic<bool> is_shutdown_ = {true};
+  std::deque<RequestPtr> requests_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+  DECLARE_SINGLETON(FileIoDispatcher)
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_FILE_IO_DISPATCHER_H_
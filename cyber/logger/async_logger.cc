@@ -17,9 +17,13 @@
 #include "cyber/logger/async_logger.h"
 
 #include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "cyber/base/macros.h"
 #include "cyber/logger/log_file_object.h"
@@ -31,14 +35,23 @@ namespace logger {
 
 static std::unordered_map<std::string, LogFileObject*> moduleLoggerMap;
 
+namespace {
+
+// rough per-record budget used to turn the byte limit into a ring size
+constexpr int kApproxBytesPerRecord = 512;
+
+}  // namespace
+
 AsyncLogger::AsyncLogger(google::base::Logger* wrapped, int max_buffer_bytes)
-    : max_buffer_bytes_(max_buffer_bytes),
-      wrapped_(wrapped),
-      active_buf_(new Buffer()),
-      flushing_buf_(new Buffer()) {
+    : max_buffer_bytes_(max_buffer_bytes), wrapped_(wrapped) {
   if (max_buffer_bytes_ <= 0) {
     max_buffer_bytes_ = 2 * 1024 * 1024;
   }
+  const uint64_t queue_size =
+      std::max(1024, max_buffer_bytes_ / kApproxBytesPerRecord);
+  // SleepWaitStrategy keeps Enqueue free of wakeup syscalls; the drain
+  // thread polls the ring instead of being signaled per record
+  msg_queue_.Init(queue_size, new base::SleepWaitStrategy());
 }
 
 AsyncLogger::~AsyncLogger() {
@@ -50,65 +63,67 @@ AsyncLogger::~AsyncLogger() {
 }
 
 void AsyncLogger::Start() {
-  CHECK_EQ(state_, INITTED);
+  CHECK(state_ == INITTED);
   state_ = RUNNING;
   thread_ = std::thread(&AsyncLogger::RunThread, this);
   // std::cout << "Async Logger Start!" << std::endl;
 }
 
 void AsyncLogger::Stop() {
-  {
-    std::unique_lock<std::mutex> lock(mutex_);
-    CHECK_EQ(state_, RUNNING);
-    state_ = STOPPED;
-    wake_flusher_cv_.notify_one();
-  }
+  CHECK(state_ == RUNNING);
+  state_ = STOPPED;
+  msg_queue_.BreakAllWait();
   thread_.join();
-  CHECK(active_buf_->messages.empty());
-  CHECK(flushing_buf_->messages.empty());
+  // A writer that passed the RUNNING check in Write() without holding a
+  // lock may complete its enqueue after the drain thread already observed
+  // the stopped state and exited; write such leftover records here instead
+  // of asserting the ring empty.
+  std::vector<Msg> leftover;
+  if (msg_queue_.DequeueAll(&leftover) > 0) {
+    for (auto& msg : leftover) {
+      if (msg.level < 0 && msg.message.empty()) {
+        // flush marker from Flush()
+        continue;
+      }
+      WriteMsg(msg);
+    }
+    for (auto& module_logger : moduleLoggerMap) {
+      module_logger.second->Flush();
+    }
+  }
   // std::cout << "Async Logger Stop!" << std::endl;
 }
 
 void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
                         int message_len) {
-  // drop message when acitve buffer full
-  if (unlikely(BufferFull(*active_buf_))) {
+  if (state_.load(std::memory_order_acquire) != RUNNING) {
+    // std::cout << "Async Logger not running!" << std::endl;
     return;
   }
-  {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (state_ != RUNNING) {
-      // std::cout << "Async Logger not running!" << std::endl;
-      return;
-    }
 
-    switch (message[0]) {
-      case 'F': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 3),
-                         force_flush);
-        break;
-      }
-      case 'E': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 2),
-                         force_flush);
-        break;
-      }
-      case 'W': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 1),
-                         force_flush);
-        break;
-      }
-      case 'I': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 0),
-                         force_flush);
-        break;
-      }
-      default: {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), -1),
-                         force_flush);
-      }
-    }
-    wake_flusher_cv_.notify_one();
+  int32_t level = -1;
+  switch (message[0]) {
+    case 'F':
+      level = 3;
+      break;
+    case 'E':
+      level = 2;
+      break;
+    case 'W':
+      level = 1;
+      break;
+    case 'I':
+      level = 0;
+      break;
+    default:
+      break;
+  }
+  // force_flush is handled per record by the drain thread via the level;
+  // a full ring drops the record instead of ever blocking the writer
+  (void)force_flush;
+  if (unlikely(!msg_queue_.Enqueue(
+          Msg(timestamp, std::string(message, message_len), level)))) {
+    drop_count_.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -119,68 +134,85 @@ void AsyncLogger::Flush() {
     return;
   }
 
-  // Wake up the writer thread at least twice.
-  // This ensures both buffers were completely flushed.
+  // Wait for the drain thread to complete at least two more cycles.
+  // This ensures every record enqueued before this call was written.
+  // The markers wake the drain thread even when the ring is idle.
   uint64_t orig_flush_count = flush_count_;
   while (flush_count_ < (orig_flush_count + 2) && state_ == RUNNING) {
-    active_buf_->flush = true;
-    wake_flusher_cv_.notify_one();
-    flush_complete_cv_.wait(lock);
+    msg_queue_.Enqueue(Msg(time(nullptr), std::string(), -1));
+    flush_complete_cv_.wait_for(lock, std::chrono::milliseconds(100));
   }
 }
 
 uint32_t AsyncLogger::LogSize() { return wrapped_->LogSize(); }
 
+void AsyncLogger::WriteMsg(const Msg& msg) {
+  std::string module_name;
+  std::string message = msg.message;
+  FindModuleName(&message, &module_name);
+
+  LogFileObject* fileobject = nullptr;
+  if (moduleLoggerMap.find(module_name) != moduleLoggerMap.end()) {
+    fileobject = moduleLoggerMap[module_name];
+  } else {
+    fileobject = new LogFileObject(google::INFO, module_name.c_str());
+    fileobject->SetSymlinkBasename(module_name.c_str());
+    moduleLoggerMap[module_name] = fileobject;
+  }
+  if (fileobject) {
+    const bool should_flush = msg.level > 0;
+    fileobject->Write(should_flush, msg.ts, message.data(),
+                      static_cast<int>(message.size()));
+  }
+}
+
 void AsyncLogger::RunThread() {
-  std::unique_lock<std::mutex> lock(mutex_);
-  while (state_ == RUNNING || active_buf_->needs_flush_or_write()) {
-    while (!active_buf_->needs_flush_or_write() && state_ == RUNNING) {
-      if (wake_flusher_cv_.wait_for(lock, std::chrono::seconds(2)) ==
-          std::cv_status::timeout) {
-        active_buf_->flush = true;
+  std::vector<Msg> batch;
+  uint64_t reported_drop_count = 0;
+  while (state_ == RUNNING || !msg_queue_.Empty()) {
+    if (msg_queue_.DequeueAll(&batch) == 0 && state_ == RUNNING) {
+      // the ring is idle; sleep through the wait strategy until a writer
+      // commits a record or a flush marker arrives
+      Msg msg;
+      if (msg_queue_.WaitDequeue(&msg)) {
+        batch.emplace_back(std::move(msg));
       }
     }
 
-    active_buf_.swap(flushing_buf_);
-    lock.unlock();
-
-    for (auto& msg : flushing_buf_->messages) {
-      std::string module_name;
-      FindModuleName(&msg.message, &module_name);
-
-      LogFileObject* fileobject = nullptr;
-      if (moduleLoggerMap.find(module_name) != moduleLoggerMap.end()) {
-        fileobject = moduleLoggerMap[module_name];
-      } else {
-        fileobject = new LogFileObject(google::INFO, module_name.c_str());
-        fileobject->SetSymlinkBasename(module_name.c_str());
-        moduleLoggerMap[module_name] = fileobject;
-      }
-      if (fileobject) {
-        const bool should_flush = msg.level > 0;
-        fileobject->Write(should_flush, msg.ts, msg.message.data(),
-                          static_cast<int>(msg.message.size()));
+    bool flush = false;
+    for (auto& msg : batch) {
+      if (msg.level < 0 && msg.message.empty()) {
+        // flush marker from Flush()
+        flush = true;
+        continue;
       }
+      flush |= msg.level > 0;
+      WriteMsg(msg);
     }
+    batch.clear();
 
-    if (flushing_buf_->flush) {
+    if (flush) {
       for (auto& module_logger : moduleLoggerMap) {
         module_logger.second->Flush();
       }
     }
-    flushing_buf_->clear();
 
-    lock.lock();
-    flush_count_++;
+    const uint64_t dropped = drop_count_.load(std::memory_order_relaxed);
+    if (unlikely(dropped != reported_drop_count)) {
+      std::cerr << "AsyncLogger dropped " << dropped - reported_drop_count
+                << " records on a full ring, " << dropped << " in total"
+                << std::endl;
+      reported_drop_count = dropped;
+    }
+
+    {
+      std::lock_guard<std::mutex> flush_lock(mutex_);
+      flush_count_++;
+    }
     flush_complete_cv_.notify_all();
   }
 }
 
-bool AsyncLogger::BufferFull(const Buffer& buf) const {
-  // We evenly divide our total buffer space into two buffers.
-  return buf.size > (max_buffer_bytes_ / 2);
-}
-
 }  // namespace logger
 }  // namespace cyber
 }  // namespace apollo
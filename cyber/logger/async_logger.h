@@ -29,6 +29,7 @@
 #include <utility>
 #include <vector>
 
+#include "cyber/base/bounded_queue.h"
 #include "cyber/common/macros.h"
 #include "glog/logging.h"
 
@@ -38,17 +39,18 @@ namespace logger {
 
 // Wrapper for a glog Logger which asynchronously writes log messages.
 // This class starts a new thread responsible for forwarding the messages
-// to the logger, and performs double buffering. Writers append to the
-// current buffer and then wake up the logger thread. The logger swaps in
-// a new buffer and writes any accumulated messages to the wrapped
-// Logger.
+// to the logger. Writers push bounded log records onto a lock-free ring
+// (cyber::base::BoundedQueue), so a Write from a 100Hz callback costs one
+// record copy and two CAS loops - no mutex, no condition variable signal
+// and no file IO. The drain thread dequeues the records, resolves the
+// module logger of each and performs all writes and flushes.
 //
-// This double-buffering design dramatically improves performance, especially
-// for logging messages which require flushing the underlying file (i.e WARNING
-// and above for default). The flush can take a couple of milliseconds, and in
+// This design dramatically improves performance, especially for logging
+// messages which require flushing the underlying file (i.e WARNING and
+// above for default). The flush can take a couple of milliseconds, and in
 // some cases can even block for hundreds of milliseconds or more. With the
-// double-buffered approach, threads can proceed with useful work while the IO
-// thread blocks.
+// ring approach, threads can proceed with useful work while the IO thread
+// blocks.
 //
 // The semantics provided by this wrapper are slightly weaker than the default
 // glog semantics. By default, glog will immediately (synchronously) flush
@@ -59,10 +61,12 @@ namespace logger {
 // worth it. We do take care that a glog FATAL message flushes all buffered log
 // messages before exiting.
 //
-// NOTE: the logger limits the total amount of buffer space, so if the
-// underlying
-// log blocks for too long, eventually the threads generating the log messages
-// will block as well. This prevents runaway memory usage.
+// NOTE: unlike the earlier double-buffered implementation, writers are
+// never blocked when the IO thread falls behind; once the ring is full new
+// records are dropped and counted, and the drain thread reports the drop
+// count when it catches up. On an autonomous vehicle losing a burst of
+// log lines is preferable to stalling a croutine in a driving-critical
+// callback.
 class AsyncLogger : public google::base::Logger {
  public:
   explicit AsyncLogger(google::base::Logger* wrapped, int max_buffer_bytes);
@@ -104,58 +108,31 @@ class AsyncLogger : public google::base::Logger {
 
   const std::thread* LogThread() const { return &thread_; }
 
+  // Count of records dropped because the ring was full.
+  uint64_t DropCount() const {
+    return drop_count_.load(std::memory_order_relaxed);
+  }
+
  private:
-  // A buffered message.
+  // A bounded log record riding in the ring. A negative level marks a
+  // flush request enqueued by Flush().
   //
   // TODO(todd): using std::string for buffered messages is convenient but not
   // as efficient as it could be. It's better to make the buffers just be
   // Arenas and allocate both the message data and Msg struct from them, forming
   // a linked list.
   struct Msg {
-    time_t ts;
+    time_t ts = 0;
     std::string message;
-    int32_t level;
+    int32_t level = -1;
 
+    Msg() {}
     Msg(time_t ts, std::string&& message, int32_t level)
         : ts(ts), message(std::move(message)), level(level) {}
   };
 
-  // A buffer of messages waiting to be flushed.
-  struct Buffer {
-    std::vector<Msg> messages;
-
-    // Estimate of the size of 'messages'.
-    std::atomic<int> size = {0};
-
-    // Whether this buffer needs an explicit flush of the
-    // underlying logger.
-    bool flush = false;
-
-    Buffer() {}
-
-    inline void clear() {
-      messages.clear();
-      size = 0;
-      flush = false;
-    }
-
-    inline void add(Msg&& msg, bool force_flush) {
-      size +=
-          static_cast<int>(sizeof(msg)) + static_cast<int>(msg.message.size());
-      messages.emplace_back(std::move(msg));
-      flush |= force_flush;
-    }
-
-    inline bool needs_flush_or_write() const {
-      return flush || !messages.empty();
-    }
-
-   private:
-    DISALLOW_COPY_AND_ASSIGN(Buffer);
-  };
-
-  bool BufferFull(const Buffer& buf) const;
   void RunThread();
+  void WriteMsg(const Msg& msg);
 
   // The maximum number of bytes used by the entire class.
   int max_buffer_bytes_;
@@ -163,39 +140,26 @@ class AsyncLogger : public google::base::Logger {
   google::base::Logger* const wrapped_;
   std::thread thread_;
 
-  // Count of how many times the writer thread has flushed the buffers.
+  // The lock-free ring between writers and the drain thread.
+  base::BoundedQueue<Msg> msg_queue_;
+
+  // Count of how many drain cycles the writer thread has completed.
   // 64 bits should be enough to never worry about overflow.
   uint64_t flush_count_ = 0;
 
-  // Count of how many times the writer thread has dropped the log messages.
-  // 64 bits should be enough to never worry about overflow.
-  uint64_t drop_count_ = 0;
+  // Count of how many records writers have dropped on a full ring.
+  std::atomic<uint64_t> drop_count_ = {0};
 
-  // Protects buffers as well as 'state_'.
+  // Protects 'flush_count_' for the Flush() handshake; never touched by
+  // the Write() hot path.
   std::mutex mutex_;
 
-  // Signaled by app threads to wake up the flusher, either for new
-  // data or because 'state_' changed.
-  std::condition_variable wake_flusher_cv_;
-
-  // Signaled by the flusher thread when the flusher has swapped in
-  // a free buffer to write to.
-  // std::condition_variable free_buffer_cv_;
-
-  // Signaled by the flusher thread when it has completed flushing
-  // the current buffer.
+  // Signaled by the drain thread when it has completed a drain cycle.
   std::condition_variable flush_complete_cv_;
 
-  // The buffer to which application threads append new log messages.
-  std::unique_ptr<Buffer> active_buf_;
-
-  // The buffer currently being flushed by the logger thread, cleared
-  // after a successful flush.
-  std::unique_ptr<Buffer> flushing_buf_;
-
   // Trigger for the logger thread to stop.
   enum State { INITTED, RUNNING, STOPPED };
-  State state_ = INITTED;
+  std::atomic<State> state_ = {INITTED};
 
   DISALLOW_COPY_AND_ASSIGN(AsyncLogger);
 };
@@ -16,6 +16,7 @@
 
 #include "cyber/mainboard/module_controller.h"
 
+#include <chrono>
 #include <utility>
 
 #include "cyber/common/environment.h"
@@ -26,6 +27,16 @@ namespace apollo {
 namespace cyber {
 namespace mainboard {
 
+namespace {
+
+double MillisecondsSince(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
 ModuleController::ModuleController(const ModuleArgument& args) { args_ = args; }
 
 ModuleController::~ModuleController() {}
@@ -41,6 +52,7 @@ void ModuleController::Clear() {
 }
 
 bool ModuleController::LoadAll() {
+  const auto load_all_start = std::chrono::steady_clock::now();
   const std::string work_root = common::WorkRoot();
   const std::string current_path = common::GetCurrentPath();
   const std::string dag_root_path = common::GetAbsolutePath(work_root, "dag");
@@ -66,6 +78,8 @@ bool ModuleController::LoadAll() {
       return false;
     }
   }
+  AINFO << "Loading all modules took " << MillisecondsSince(load_all_start)
+        << " ms.";
   return true;
 }
 
@@ -86,7 +100,10 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
       return false;
     }
 
+    const auto load_library_start = std::chrono::steady_clock::now();
     class_loader_manager_.LoadLibrary(load_path);
+    AINFO << "Loading library " << load_path << " took "
+          << MillisecondsSince(load_library_start) << " ms.";
 
     for (auto& component : module_config.components()) {
       const std::string& class_name = component.class_name();
@@ -96,9 +113,12 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
         return false;
       }
 
+      const auto init_start = std::chrono::steady_clock::now();
       if (!base->Initialize(component.config())) {
         return false;
       }
+      AINFO << "Initializing component " << class_name << " took "
+            << MillisecondsSince(init_start) << " ms.";
       component_list_.emplace_back(std::move(base));
     }
 
@@ -110,9 +130,12 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
         return false;
       }
 
+      const auto init_start = std::chrono::steady_clock::now();
       if (!base->Initialize(component.config())) {
         return false;
       }
+      AINFO << "Initializing timer component " << class_name << " took "
+            << MillisecondsSince(init_start) << " ms.";
       component_list_.emplace_back(std::move(base));
     }
   }
@@ -43,15 +43,27 @@ struct ReaderConfig {
     qos_profile.set_durability(proto::QosDurabilityPolicy::DURABILITY_VOLATILE);
 
     pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE;
+    conflate_latest = false;
+    conflation_rate_hz = 0;
   }
   ReaderConfig(const ReaderConfig& other)
       : channel_name(other.channel_name),
         qos_profile(other.qos_profile),
-        pending_queue_size(other.pending_queue_size) {}
+        pending_queue_size(other.pending_queue_size),
+        conflate_latest(other.conflate_latest),
+        conflation_rate_hz(other.conflation_rate_hz) {}
 
   std::string channel_name;
   proto::QosProfile qos_profile;
   uint32_t pending_queue_size;
+  // Conflating mode for consumers that only need the newest state of a
+  // high-rate channel (e.g. chassis or localization at 100Hz). The pending
+  // queue shrinks to one slot so newer messages overwrite older ones, and
+  // with conflation_rate_hz > 0 the reader croutine is woken up at most
+  // that many times per second instead of per message. A coalesced message
+  // is delivered on the next arrival once the interval has elapsed.
+  bool conflate_latest;
+  uint32_t conflation_rate_hz;
 };
 
 class NodeChannelImpl {
@@ -108,7 +120,8 @@ class NodeChannelImpl {
   template <typename MessageT>
   auto CreateReader(const proto::RoleAttributes& role_attr,
                     const CallbackFunc<MessageT>& reader_func,
-                    uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE)
+                    uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE,
+                    uint32_t conflation_rate_hz = 0)
       -> std::shared_ptr<Reader<MessageT>>;
 
   template <typename MessageT>
@@ -170,14 +183,21 @@ auto NodeChannelImpl::CreateReader(const ReaderConfig& config,
   proto::RoleAttributes role_attr;
   role_attr.set_channel_name(config.channel_name);
   role_attr.mutable_qos_profile()->CopyFrom(config.qos_profile);
-  return this->template CreateReader<MessageT>(role_attr, reader_func,
-                                               config.pending_queue_size);
+  uint32_t pending_queue_size = config.pending_queue_size;
+  uint32_t conflation_rate_hz = 0;
+  if (config.conflate_latest) {
+    pending_queue_size = 1;
+    conflation_rate_hz = config.conflation_rate_hz;
+  }
+  return this->template CreateReader<MessageT>(
+      role_attr, reader_func, pending_queue_size, conflation_rate_hz);
 }
 
 template <typename MessageT>
 auto NodeChannelImpl::CreateReader(const proto::RoleAttributes& role_attr,
                                    const CallbackFunc<MessageT>& reader_func,
-                                   uint32_t pending_queue_size)
+                                   uint32_t pending_queue_size,
+                                   uint32_t conflation_rate_hz)
     -> std::shared_ptr<Reader<MessageT>> {
   if (!role_attr.has_channel_name() || role_attr.channel_name().empty()) {
     AERROR << "Can't create a reader with empty channel name!";
@@ -192,8 +212,8 @@ auto NodeChannelImpl::CreateReader(const proto::RoleAttributes& role_attr,
     reader_ptr =
         std::make_shared<blocker::IntraReader<MessageT>>(new_attr, reader_func);
   } else {
-    reader_ptr = std::make_shared<Reader<MessageT>>(new_attr, reader_func,
-                                                    pending_queue_size);
+    reader_ptr = std::make_shared<Reader<MessageT>>(
+        new_attr, reader_func, pending_queue_size, conflation_rate_hz);
   }
 
   RETURN_VAL_IF_NULL(reader_ptr, nullptr);
@@ -18,7 +18,7 @@
 #define CYBER_NODE_READER_H_
 
 #include <algorithm>
-#include <list>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -55,11 +55,12 @@ class Reader : public ReaderBase {
   using ChangeConnection =
       typename service_discovery::Manager::ChangeConnection;
   using Iterator =
-      typename std::list<std::shared_ptr<MessageT>>::const_iterator;
+      typename std::vector<std::shared_ptr<MessageT>>::const_iterator;
 
   explicit Reader(const proto::RoleAttributes& role_attr,
                   const CallbackFunc<MessageT>& reader_func = nullptr,
-                  uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE);
+                  uint32_t pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE,
+                  uint32_t conflation_rate_hz = 0);
   virtual ~Reader();
 
   bool Init() override;
@@ -86,6 +87,7 @@ class Reader : public ReaderBase {
   double latest_recv_time_sec_ = -1.0;
   double second_to_lastest_recv_time_sec_ = -1.0;
   uint32_t pending_queue_size_;
+  uint32_t conflation_rate_hz_ = 0;
 
  private:
   void JoinTheTopology();
@@ -105,9 +107,11 @@ class Reader : public ReaderBase {
 template <typename MessageT>
 Reader<MessageT>::Reader(const proto::RoleAttributes& role_attr,
                          const CallbackFunc<MessageT>& reader_func,
-                         uint32_t pending_queue_size)
+                         uint32_t pending_queue_size,
+                         uint32_t conflation_rate_hz)
     : ReaderBase(role_attr),
       pending_queue_size_(pending_queue_size),
+      conflation_rate_hz_(conflation_rate_hz),
       reader_func_(reader_func) {
   blocker_.reset(new blocker::Blocker<MessageT>(blocker::BlockerAttr(
       role_attr.qos_profile().depth(), role_attr.channel_name())));
@@ -148,6 +152,13 @@ bool Reader<MessageT>::Init() {
   croutine_name_ = role_attr_.node_name() + "_" + role_attr_.channel_name();
   auto dv = std::make_shared<data::DataVisitor<MessageT>>(
       role_attr_.channel_id(), pending_queue_size_);
+  if (conflation_rate_hz_ > 0) {
+    // Coalesce wakeups to the declared consume rate. Newer messages
+    // meanwhile overwrite the pending queue entries, so after each wakeup
+    // the croutine drains whatever is latched and goes back to sleep.
+    dv->SetNotifyBatch(std::numeric_limits<uint32_t>::max(),
+                       1000000000ULL / conflation_rate_hz_);
+  }
   // Using factory to wrap templates.
   croutine::RoutineFactory factory =
       croutine::CreateRoutineFactory<MessageT>(std::move(func), dv);
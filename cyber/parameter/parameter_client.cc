@@ -23,7 +23,7 @@ namespace cyber {
 
 ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
                                  const std::string& service_node_name)
-    : node_(node) {
+    : node_(node), service_node_name_(service_node_name) {
   get_parameter_client_ = node_->CreateClient<ParamName, Param>(
       FixParameterServiceName(service_node_name, GET_PARAMETER_SERVICE_NAME));
 
@@ -36,6 +36,18 @@ ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
 
 bool ParameterClient::GetParameter(const std::string& param_name,
                                    Parameter* parameter) {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (replica_active_) {
+      auto ite = param_cache_.find(param_name);
+      if (ite != param_cache_.end()) {
+        parameter->FromProtoParam(ite->second);
+        return true;
+      }
+      // fall through to the service call: the miss is either a
+      // parameter that does not exist or a lost notification
+    }
+  }
   auto request = std::make_shared<ParamName>();
   request->set_value(param_name);
   auto response = get_parameter_client_->SendRequest(request);
@@ -62,6 +74,17 @@ bool ParameterClient::SetParameter(const Parameter& parameter) {
 }
 
 bool ParameterClient::ListParameters(std::vector<Parameter>* parameters) {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (replica_active_) {
+      for (auto& item : param_cache_) {
+        Parameter parameter;
+        parameter.FromProtoParam(item.second);
+        parameters->emplace_back(parameter);
+      }
+      return true;
+    }
+  }
   auto request = std::make_shared<NodeName>();
   request->set_value(node_->Name());
   auto response = list_parameters_client_->SendRequest(request);
@@ -77,5 +100,37 @@ bool ParameterClient::ListParameters(std::vector<Parameter>* parameters) {
   return true;
 }
 
+bool ParameterClient::EnableReadReplica() {
+  if (events_reader_ == nullptr) {
+    // subscribe before the snapshot is pulled so no change published
+    // after the snapshot can be missed; per-key last-writer wins
+    events_reader_ = node_->CreateReader<Param>(
+        FixParameterServiceName(service_node_name_,
+                                PARAMETER_EVENTS_CHANNEL_NAME),
+        [this](const std::shared_ptr<Param>& param) {
+          std::lock_guard<std::mutex> lock(cache_mutex_);
+          param_cache_[param->name()] = *param;
+        });
+  }
+
+  auto request = std::make_shared<NodeName>();
+  request->set_value(node_->Name());
+  auto response = list_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    AERROR << "Call " << list_parameters_client_->ServiceName() << " failed";
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  for (auto& param : response->param()) {
+    // changes already applied by the events reader are newer than the
+    // snapshot, keep them
+    if (param_cache_.find(param.name()) == param_cache_.end()) {
+      param_cache_[param.name()] = param;
+    }
+  }
+  replica_active_ = true;
+  return true;
+}
+
 }  // namespace cyber
 }  // namespace apollo
@@ -18,9 +18,12 @@
 #define CYBER_PARAMETER_PARAMETER_CLIENT_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "cyber/node/reader.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/client.h"
@@ -79,11 +82,29 @@ class ParameterClient {
    */
   bool ListParameters(std::vector<Parameter>* parameters);
 
+  /**
+   * @brief Pull one bulk snapshot of all parameters and keep it fresh
+   * through the server's change notification channel. Once enabled,
+   * GetParameter and ListParameters are served from local memory; a
+   * cache miss still falls back to the service call, so a lost
+   * notification can not return a wrong answer.
+   *
+   * @return true the snapshot was pulled and the replica is active
+   * @return false call service fail or timeout, replica not enabled
+   */
+  bool EnableReadReplica();
+
  private:
   std::shared_ptr<Node> node_;
+  std::string service_node_name_;
   std::shared_ptr<GetParameterClient> get_parameter_client_;
   std::shared_ptr<SetParameterClient> set_parameter_client_;
   std::shared_ptr<ListParametersClient> list_parameters_client_;
+  std::shared_ptr<Reader<Param>> events_reader_;
+
+  std::mutex cache_mutex_;
+  std::unordered_map<std::string, Param> param_cache_;
+  bool replica_active_ = false;
 };
 
 }  // namespace cyber
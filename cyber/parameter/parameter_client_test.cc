@@ -76,6 +76,29 @@ TEST_F(ParameterClientTest, get_parameter) {
   EXPECT_FALSE(pc_->GetParameter("int", &parameter));
 }
 
+TEST_F(ParameterClientTest, read_replica) {
+  ps_->SetParameter(Parameter("int", 1));
+  EXPECT_TRUE(pc_->EnableReadReplica());
+
+  Parameter parameter;
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(1, parameter.AsInt64());
+
+  // a change on the server is propagated to the replica
+  ps_->SetParameter(Parameter("int", 2));
+  usleep(100000);
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(2, parameter.AsInt64());
+
+  // replica reads are local and survive the server going away
+  ps_.reset();
+  std::vector<Parameter> parameters;
+  EXPECT_TRUE(pc_->ListParameters(&parameters));
+  EXPECT_EQ(1, parameters.size());
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(2, parameter.AsInt64());
+}
+
 TEST_F(ParameterClientTest, list_parameter) {
   ps_->SetParameter(Parameter("int", 1));
   std::vector<Parameter> parameters;
@@ -24,6 +24,9 @@ namespace cyber {
 ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
     : node_(node) {
   auto name = node_->Name();
+  events_writer_ = node_->CreateWriter<Param>(
+      FixParameterServiceName(name, PARAMETER_EVENTS_CHANNEL_NAME));
+
   get_parameter_service_ = node_->CreateService<ParamName, Param>(
       FixParameterServiceName(name, GET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<ParamName>& request,
@@ -42,6 +45,7 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
              std::shared_ptr<BoolResult>& response) {
         std::lock_guard<std::mutex> lock(param_map_mutex_);
         param_map_[request->name()] = *request;
+        events_writer_->Write(request);
         response->set_value(true);
       });
 
@@ -59,7 +63,9 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
 
 void ParameterServer::SetParameter(const Parameter& parameter) {
   std::lock_guard<std::mutex> lock(param_map_mutex_);
-  param_map_[parameter.Name()] = parameter.ToProtoParam();
+  auto param = std::make_shared<Param>(parameter.ToProtoParam());
+  param_map_[parameter.Name()] = *param;
+  events_writer_->Write(param);
 }
 
 bool ParameterServer::GetParameter(const std::string& parameter_name,
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "cyber/node/writer.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/service.h"
@@ -74,6 +75,9 @@ class ParameterServer {
   std::shared_ptr<Service<ParamName, Param>> get_parameter_service_;
   std::shared_ptr<Service<Param, BoolResult>> set_parameter_service_;
   std::shared_ptr<Service<NodeName, Params>> list_parameters_service_;
+  // every change is published here so client read replicas stay fresh
+  // without polling
+  std::shared_ptr<Writer<Param>> events_writer_;
 
   std::mutex param_map_mutex_;
   std::unordered_map<std::string, Param> param_map_;
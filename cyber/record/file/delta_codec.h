@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_RECORD_FILE_DELTA_CODEC_H_
+#define CYBER_RECORD_FILE_DELTA_CODEC_H_
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/common/log.h"
+#include "cyber/proto/record.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+// XOR-delta codec for high-rate channels whose consecutive payloads differ
+// in a few fields only. Encoding XORs the payload byte-wise with the
+// previous payload of the same channel, turning unchanged serialized fields
+// into zero runs that the chunk compression then collapses. The transform
+// is its own inverse, so the same function decodes a delta payload given
+// the reconstructed previous payload. Bytes past the length of the shorter
+// payload are kept raw in both directions.
+inline void DeltaXor(const std::string& prev, std::string* content) {
+  const size_t common = std::min(prev.size(), content->size());
+  for (size_t i = 0; i < common; ++i) {
+    (*content)[i] ^= prev[i];
+  }
+}
+
+// Decode every delta payload of a chunk in place, so its messages can be
+// consumed or re-written individually. Delta chains never cross chunks:
+// the first message of a channel in a chunk is raw, every later delta
+// payload XORs against the reconstructed previous message of the channel
+// in the same chunk. A delta message whose base is missing (truncated or
+// corrupted chunk) cannot be reconstructed and is removed, together with
+// any later deltas chained on it. Returns the number of dropped messages.
+inline int DecodeChunkDeltas(proto::ChunkBody* chunk) {
+  std::unordered_map<std::string, int> last_index;
+  std::vector<bool> drop(chunk->messages_size(), false);
+  int num_dropped = 0;
+  for (int i = 0; i < chunk->messages_size(); ++i) {
+    auto* message = chunk->mutable_messages(i);
+    if (message->content_delta()) {
+      const auto it = last_index.find(message->channel_name());
+      if (it == last_index.end()) {
+        AERROR << "Delta message without a base in chunk, dropping, channel: "
+               << message->channel_name();
+        drop[i] = true;
+        ++num_dropped;
+        continue;
+      }
+      DeltaXor(chunk->messages(it->second).content(),
+               message->mutable_content());
+      message->clear_content_delta();
+    }
+    last_index[message->channel_name()] = i;
+  }
+  if (num_dropped > 0) {
+    int dst = 0;
+    for (int i = 0; i < chunk->messages_size(); ++i) {
+      if (drop[i]) {
+        continue;
+      }
+      if (dst != i) {
+        chunk->mutable_messages()->SwapElements(dst, i);
+      }
+      ++dst;
+    }
+    chunk->mutable_messages()->DeleteSubrange(dst,
+                                              chunk->messages_size() - dst);
+  }
+  return num_dropped;
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_RECORD_FILE_DELTA_CODEC_H_
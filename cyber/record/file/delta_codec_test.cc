@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/record/file/delta_codec.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+TEST(DeltaCodecTest, round_trip) {
+  const std::string prev("pose:123456789");
+  const std::string raw("pose:123456790");
+
+  std::string content(raw);
+  DeltaXor(prev, &content);
+  EXPECT_NE(content, raw);
+  // Unchanged leading bytes collapse to zeros.
+  for (size_t i = 0; i < raw.size() - 2; ++i) {
+    EXPECT_EQ(content[i], '\0');
+  }
+
+  DeltaXor(prev, &content);
+  EXPECT_EQ(content, raw);
+}
+
+TEST(DeltaCodecTest, length_change) {
+  const std::string prev("chassis");
+  const std::string raw("chassis-grown");
+
+  std::string content(raw);
+  DeltaXor(prev, &content);
+  // The tail past the previous payload stays raw.
+  EXPECT_EQ(content.substr(prev.size()), "-grown");
+  DeltaXor(prev, &content);
+  EXPECT_EQ(content, raw);
+
+  std::string shrunk("cha");
+  std::string encoded(shrunk);
+  DeltaXor(prev, &encoded);
+  DeltaXor(prev, &encoded);
+  EXPECT_EQ(encoded, shrunk);
+}
+
+TEST(DeltaCodecTest, empty_base) {
+  const std::string raw("imu");
+  std::string content(raw);
+  DeltaXor("", &content);
+  EXPECT_EQ(content, raw);
+}
+
+TEST(DeltaCodecTest, decode_chunk_deltas) {
+  const std::string base("pose:123456789");
+  const std::string raw("pose:123456790");
+
+  proto::ChunkBody chunk;
+  auto* first = chunk.add_messages();
+  first->set_channel_name("/chassis");
+  first->set_content(base);
+  auto* second = chunk.add_messages();
+  second->set_channel_name("/chassis");
+  std::string encoded(raw);
+  DeltaXor(base, &encoded);
+  second->set_content(encoded);
+  second->set_content_delta(true);
+
+  EXPECT_EQ(0, DecodeChunkDeltas(&chunk));
+  ASSERT_EQ(2, chunk.messages_size());
+  EXPECT_EQ(base, chunk.messages(0).content());
+  EXPECT_EQ(raw, chunk.messages(1).content());
+  EXPECT_FALSE(chunk.messages(1).content_delta());
+}
+
+TEST(DeltaCodecTest, decode_chunk_deltas_missing_base) {
+  // An orphan delta cannot be reconstructed; it and the delta chained on
+  // it are dropped, while other channels are untouched.
+  proto::ChunkBody chunk;
+  auto* orphan = chunk.add_messages();
+  orphan->set_channel_name("/chassis");
+  orphan->set_content("garbage");
+  orphan->set_content_delta(true);
+  auto* chained = chunk.add_messages();
+  chained->set_channel_name("/chassis");
+  chained->set_content("garbage2");
+  chained->set_content_delta(true);
+  auto* other = chunk.add_messages();
+  other->set_channel_name("/imu");
+  other->set_content("imu-raw");
+
+  EXPECT_EQ(2, DecodeChunkDeltas(&chunk));
+  ASSERT_EQ(1, chunk.messages_size());
+  EXPECT_EQ("/imu", chunk.messages(0).channel_name());
+  EXPECT_EQ("imu-raw", chunk.messages(0).content());
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
@@ -130,6 +130,21 @@ bool RecordFileReader::ReadSection(Section* section) {
   return true;
 }
 
+bool RecordFileReader::ReadSectionRaw(uint64_t size, std::string* data) {
+  if (size > INT_MAX) {
+    AERROR << "Size is larger than " << INT_MAX;
+    return false;
+  }
+  data->resize(size);
+  ssize_t count = read(fd_, const_cast<char*>(data->data()), size);
+  if (count != static_cast<ssize_t>(size)) {
+    AERROR << "Read fd failed, fd_: " << fd_ << ", expect count: " << size
+           << ", actual count: " << count;
+    return false;
+  }
+  return true;
+}
+
 bool RecordFileReader::SkipSection(uint64_t size) {
   uint64_t c = CurrentPosition();
   if (!SetPosition(c + size)) {
@@ -51,6 +51,9 @@ class RecordFileReader : public RecordFileBase {
   bool SkipSection(uint64_t size);
   template <typename T>
   bool ReadSection(uint64_t size, T* message);
+  // Reads the section body as raw bytes without parsing, so the parse can
+  // run on another thread.
+  bool ReadSectionRaw(uint64_t size, std::string* data);
   bool ReadIndex();
   bool EndOfFile() { return end_of_file_; }
 
@@ -19,6 +19,7 @@
 #include <fcntl.h>
 
 #include "cyber/common/file.h"
+#include "cyber/record/file/delta_codec.h"
 #include "cyber/time/time.h"
 
 namespace apollo {
@@ -43,8 +44,18 @@ bool RecordFileWriter::Open(const std::string& path) {
     return false;
   }
   chunk_active_.reset(new Chunk());
-  chunk_flush_.reset(new Chunk());
+  delta_prev_map_.clear();
   is_writing_ = true;
+  uint32_t encode_thread_num = std::thread::hardware_concurrency() / 2;
+  if (encode_thread_num < 1) {
+    encode_thread_num = 1;
+  } else if (encode_thread_num > 4) {
+    encode_thread_num = 4;
+  }
+  for (uint32_t i = 0; i < encode_thread_num; ++i) {
+    encode_threads_.emplace_back(
+        std::make_shared<std::thread>([this]() { this->Encode(); }));
+  }
   flush_thread_ = std::make_shared<std::thread>([this]() { this->Flush(); });
   if (flush_thread_ == nullptr) {
     AERROR << "Init flush thread error.";
@@ -55,25 +66,31 @@ bool RecordFileWriter::Open(const std::string& path) {
 
 void RecordFileWriter::Close() {
   if (is_writing_) {
-    // wait for the flush operation that may exist now
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // queue whatever the active chunk still holds
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      if (!chunk_active_->empty()) {
+        flush_queue_.emplace_back(
+            std::make_shared<ChunkFlushTask>(std::move(chunk_active_)));
+        chunk_active_.reset(new Chunk());
+      }
+      flush_cv_.notify_all();
     }
 
-    // last swap
+    // wait until every queued chunk has been committed in order
     {
       std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-      chunk_flush_.swap(chunk_active_);
-      flush_cv_.notify_one();
+      flush_cv_.wait(flush_lock, [this] { return flush_queue_.empty(); });
+      is_writing_ = false;
+      flush_cv_.notify_all();
     }
 
-    // wait for the last flush opertation
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    for (auto& encode_thread : encode_threads_) {
+      if (encode_thread && encode_thread->joinable()) {
+        encode_thread->join();
+      }
     }
-
-    is_writing_ = false;
-    flush_cv_.notify_all();
+    encode_threads_.clear();
     if (flush_thread_ && flush_thread_->joinable()) {
       flush_thread_->join();
       flush_thread_ = nullptr;
@@ -147,7 +164,7 @@ bool RecordFileWriter::WriteChannel(const Channel& channel) {
 }
 
 bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
-                                  const ChunkBody& chunk_body) {
+                                  const std::string& body_buf) {
   std::lock_guard<std::mutex> lock(mutex_);
   if (!WriteSection<ChunkHeader>(chunk_header)) {
     AERROR << "Write chunk header fail";
@@ -162,10 +179,20 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   chunk_header_cache->set_message_number(chunk_header.message_number());
   chunk_header_cache->set_raw_size(chunk_header.raw_size());
   single_index->set_allocated_chunk_header_cache(chunk_header_cache);
-  if (!WriteSection<ChunkBody>(chunk_body)) {
-    AERROR << "Write chunk body fail";
+  // the body was encoded by a worker, write the bytes as a section here
+  Section section = {SectionType::SECTION_CHUNK_BODY,
+                     (uint64_t)body_buf.size()};
+  ssize_t count = write(fd_, &section, sizeof(section));
+  if (count != sizeof(section)) {
+    AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
+    return false;
+  }
+  count = write(fd_, body_buf.data(), body_buf.size());
+  if (count != static_cast<ssize_t>(body_buf.size())) {
+    AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
     return false;
   }
+  header_.set_size(CurrentPosition());
   header_.set_chunk_number(header_.chunk_number() + 1);
   if (header_.begin_time() == 0) {
     header_.set_begin_time(chunk_header.begin_time());
@@ -177,13 +204,33 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   single_index->set_type(SectionType::SECTION_CHUNK_BODY);
   single_index->set_position(CurrentPosition());
   ChunkBodyCache* chunk_body_cache = new ChunkBodyCache();
-  chunk_body_cache->set_message_number(chunk_body.messages_size());
+  chunk_body_cache->set_message_number(chunk_header.message_number());
   single_index->set_allocated_chunk_body_cache(chunk_body_cache);
   return true;
 }
 
+void RecordFileWriter::SetDeltaEncodedChannels(
+    const std::unordered_set<std::string>& channels) {
+  delta_channels_ = channels;
+}
+
 bool RecordFileWriter::WriteMessage(const SingleMessage& message) {
-  chunk_active_->add(message);
+  if (delta_channels_.count(message.channel_name()) > 0) {
+    SingleMessage encoded(message);
+    auto prev = delta_prev_map_.find(message.channel_name());
+    if (prev != delta_prev_map_.end()) {
+      DeltaXor(prev->second, encoded.mutable_content());
+      encoded.set_content_delta(true);
+      prev->second = message.content();
+    } else {
+      // First message of the channel in this chunk stays raw and seeds
+      // the chain.
+      delta_prev_map_[message.channel_name()] = message.content();
+    }
+    chunk_active_->add(encoded);
+  } else {
+    chunk_active_->add(message);
+  }
   auto it = channel_message_number_map_.find(message.channel_name());
   if (it != channel_message_number_map_.end()) {
     it->second++;
@@ -206,27 +253,74 @@ bool RecordFileWriter::WriteMessage(const SingleMessage& message) {
   }
   {
     std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    chunk_flush_.swap(chunk_active_);
-    flush_cv_.notify_one();
+    flush_queue_.emplace_back(
+        std::make_shared<ChunkFlushTask>(std::move(chunk_active_)));
+    chunk_active_.reset(new Chunk());
+    delta_prev_map_.clear();
+    flush_cv_.notify_all();
   }
   return true;
 }
 
-void RecordFileWriter::Flush() {
-  while (is_writing_) {
-    std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    flush_cv_.wait(flush_lock,
-                   [this] { return !chunk_flush_->empty() || !is_writing_; });
-    if (!is_writing_) {
-      break;
+std::shared_ptr<ChunkFlushTask> RecordFileWriter::NextUnclaimedTask() {
+  for (auto& task : flush_queue_) {
+    if (!task->claimed_.load()) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+void RecordFileWriter::Encode() {
+  while (true) {
+    std::shared_ptr<ChunkFlushTask> task = nullptr;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_cv_.wait(flush_lock, [this, &task] {
+        task = NextUnclaimedTask();
+        return task != nullptr || !is_writing_;
+      });
+      if (task == nullptr) {
+        break;
+      }
+      task->claimed_.store(true);
     }
-    if (chunk_flush_->empty()) {
-      continue;
+    // the heavy part runs outside the lock, so workers encode in parallel
+    task->chunk_->body_.SerializeToString(&task->body_buf_);
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      task->done_.store(true);
+      flush_cv_.notify_all();
     }
-    if (!WriteChunk(chunk_flush_->header_, chunk_flush_->body_)) {
+  }
+}
+
+void RecordFileWriter::Flush() {
+  while (true) {
+    std::shared_ptr<ChunkFlushTask> task = nullptr;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_cv_.wait(flush_lock, [this] {
+        return (!flush_queue_.empty() && flush_queue_.front()->done_.load()) ||
+               !is_writing_;
+      });
+      if (flush_queue_.empty() || !flush_queue_.front()->done_.load()) {
+        if (!is_writing_) {
+          break;
+        }
+        continue;
+      }
+      task = flush_queue_.front();
+    }
+    // commit strictly in submission order so sections keep the file layout
+    if (!WriteChunk(task->chunk_->header_, task->body_buf_)) {
       AERROR << "Write chunk fail.";
     }
-    chunk_flush_->clear();
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_queue_.pop_front();
+      flush_cv_.notify_all();
+    }
   }
   return;
 }
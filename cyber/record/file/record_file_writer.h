@@ -20,14 +20,18 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
 #include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "cyber/record/file/record_file_base.h"
@@ -76,6 +80,19 @@ struct Chunk {
   ChunkBody body_;
 };
 
+// One chunk moving through the flush pipeline: an encode worker claims it,
+// serializes the body into body_buf and marks it done, then the commit stage
+// writes queued chunks to the file strictly in submission order.
+struct ChunkFlushTask {
+  explicit ChunkFlushTask(std::unique_ptr<Chunk>&& chunk)
+      : chunk_(std::move(chunk)) {}
+
+  std::unique_ptr<Chunk> chunk_;
+  std::string body_buf_;
+  std::atomic<bool> claimed_ = {false};
+  std::atomic<bool> done_ = {false};
+};
+
 class RecordFileWriter : public RecordFileBase {
  public:
   RecordFileWriter();
@@ -87,19 +104,31 @@ class RecordFileWriter : public RecordFileBase {
   bool WriteMessage(const SingleMessage& message);
   uint64_t GetMessageNumber(const std::string& channel_name) const;
 
+  // Channels whose payloads get XOR-delta encoded against the previous
+  // message of the same channel before chunk compression. The chain
+  // restarts with a raw payload in every chunk, so chunks stay
+  // self-contained for seeking.
+  void SetDeltaEncodedChannels(const std::unordered_set<std::string>& channels);
+
  private:
-  bool WriteChunk(const ChunkHeader& chunk_header, const ChunkBody& chunk_body);
+  bool WriteChunk(const ChunkHeader& chunk_header, const std::string& body_buf);
   template <typename T>
   bool WriteSection(const T& message);
   bool WriteIndex();
+  std::shared_ptr<ChunkFlushTask> NextUnclaimedTask();
+  void Encode();
   void Flush();
   bool is_writing_ = false;
   std::unique_ptr<Chunk> chunk_active_ = nullptr;
-  std::unique_ptr<Chunk> chunk_flush_ = nullptr;
+  std::deque<std::shared_ptr<ChunkFlushTask>> flush_queue_;
+  std::vector<std::shared_ptr<std::thread>> encode_threads_;
   std::shared_ptr<std::thread> flush_thread_ = nullptr;
   std::mutex flush_mutex_;
   std::condition_variable flush_cv_;
   std::unordered_map<std::string, uint64_t> channel_message_number_map_;
+  std::unordered_set<std::string> delta_channels_;
+  // Raw payload of the last message per delta channel in the active chunk.
+  std::unordered_map<std::string, std::string> delta_prev_map_;
 };
 
 template <typename T>
@@ -16,8 +16,11 @@
 
 #include "cyber/record/record_reader.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "cyber/record/file/delta_codec.h"
+
 namespace apollo {
 namespace cyber {
 namespace record {
@@ -39,6 +42,19 @@ RecordReader::RecordReader(const std::string& file) {
     const int kIndexSize = index_.indexes_size();
     for (int i = 0; i < kIndexSize; ++i) {
       auto single_idx = index_.mutable_indexes(i);
+      if (single_idx->type() == SectionType::SECTION_CHUNK_HEADER) {
+        if (!single_idx->has_chunk_header_cache()) {
+          AERROR << "single chunk header index does not have "
+                    "chunk_header_cache.";
+          continue;
+        }
+        // the writer records the position right after the chunk header
+        // section, which is where the chunk body section starts
+        const auto& cache = single_idx->chunk_header_cache();
+        chunk_index_.push_back(
+            {cache.begin_time(), cache.end_time(), single_idx->position()});
+        continue;
+      }
       if (single_idx->type() != SectionType::SECTION_CHANNEL) {
         continue;
       }
@@ -61,6 +77,29 @@ void RecordReader::Reset() {
   chunk_ = ChunkBody();
 }
 
+bool RecordReader::Seek(uint64_t begin_time) {
+  Reset();
+  if (!is_valid_ || chunk_index_.empty()) {
+    return is_valid_;
+  }
+  // first chunk whose time range has not entirely passed begin_time
+  auto it = std::lower_bound(
+      chunk_index_.begin(), chunk_index_.end(), begin_time,
+      [](const ChunkIndexEntry& entry, uint64_t time) {
+        return entry.end_time < time;
+      });
+  if (it == chunk_index_.end()) {
+    reach_end_ = true;
+    return true;
+  }
+  if (!file_reader_->SetPosition(it->position)) {
+    AERROR << "Seek to chunk position failed, file: "
+           << file_reader_->GetPath() << ", position: " << it->position;
+    return false;
+  }
+  return true;
+}
+
 std::set<std::string> RecordReader::GetChannelList() const {
   std::set<std::string> channel_list;
   for (auto& item : channel_info_) {
@@ -154,6 +193,7 @@ bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
           AERROR << "Failed to read chunk body section.";
           return false;
         }
+        DecodeChunkDeltas();
         return true;
       }
       default: {
@@ -166,6 +206,16 @@ bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
   return false;
 }
 
+void RecordReader::DecodeChunkDeltas() {
+  // Undecodable delta messages are dropped rather than handed to
+  // consumers as if their still-encoded bytes were valid payload.
+  const int num_dropped = record::DecodeChunkDeltas(&chunk_);
+  if (num_dropped > 0) {
+    AERROR << "Dropped " << num_dropped
+           << " undecodable delta message(s) in chunk.";
+  }
+}
+
 uint64_t RecordReader::GetMessageNumber(const std::string& channel_name) const {
   auto search = channel_info_.find(channel_name);
   if (search == channel_info_.end()) {
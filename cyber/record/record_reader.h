@@ -21,6 +21,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cyber/proto/record.pb.h"
 #include "cyber/record/file/record_file_reader.h"
@@ -45,6 +46,13 @@ class RecordReader : public RecordBase {
                    uint64_t end_time = UINT64_MAX);
   void Reset();
 
+  // Reset and jump straight to the first chunk that can hold messages at or
+  // after begin_time, using the chunk positions cached from the index
+  // section. Seeking is O(log chunk_number) instead of a scan over every
+  // chunk header between the file head and the target. Falls back to a
+  // plain Reset when the file carries no index.
+  bool Seek(uint64_t begin_time);
+
   uint64_t GetMessageNumber(const std::string& channel_name) const override;
 
   const std::string& GetMessageType(
@@ -60,6 +68,14 @@ class RecordReader : public RecordBase {
 
  private:
   bool ReadNextChunk(uint64_t begin_time, uint64_t end_time);
+  void DecodeChunkDeltas();
+
+  // chunk positions distilled from the index section, ordered by time
+  struct ChunkIndexEntry {
+    uint64_t begin_time;
+    uint64_t end_time;
+    uint64_t position;  // file position of the chunk body section
+  };
 
   bool is_valid_ = false;
   bool reach_end_ = false;
@@ -67,6 +83,7 @@ class RecordReader : public RecordBase {
   proto::Index index_;
   int message_index_ = 0;
   ChannelInfoMap channel_info_;
+  std::vector<ChunkIndexEntry> chunk_index_;
   FileReaderPtr file_reader_;
 };
 
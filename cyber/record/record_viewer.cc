@@ -104,7 +104,8 @@ void RecordViewer::Sort() {
 
 void RecordViewer::Reset() {
   for (auto& reader : readers_) {
-    reader->Reset();
+    // jump to the replay window instead of scanning from the file head
+    reader->Seek(begin_time_);
   }
   curr_begin_time_ = begin_time_;
   msg_buffer_.clear();
@@ -46,6 +46,7 @@ bool RecordWriter::Open(const std::string& file) {
     path_ = file_;
   }
   file_writer_.reset(new RecordFileWriter());
+  file_writer_->SetDeltaEncodedChannels(delta_channels_);
   if (!file_writer_->Open(path_)) {
     AERROR << "open outfile failed. file: " << path_;
     return false;
@@ -64,6 +65,7 @@ void RecordWriter::Close() {
 
 bool RecordWriter::SplitOutfile() {
   file_writer_.reset(new RecordFileWriter());
+  file_writer_->SetDeltaEncodedChannels(delta_channels_);
   if (file_index_ > 99999) {
     AWARN << "More than 9999 record files had been recored, will restart"
           << " counting from 0.";
@@ -156,6 +158,16 @@ bool RecordWriter::SetSizeOfFileSegmentation(uint64_t size_kilobytes) {
   return true;
 }
 
+bool RecordWriter::SetDeltaEncodedChannels(
+    const std::unordered_set<std::string>& channels) {
+  if (is_opened_) {
+    AWARN << "please call this interface before opening file.";
+    return false;
+  }
+  delta_channels_ = channels;
+  return true;
+}
+
 bool RecordWriter::SetIntervalOfFileSegmentation(uint64_t time_sec) {
   if (is_opened_) {
     AWARN << "please call this interface before opening file.";
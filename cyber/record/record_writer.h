@@ -23,6 +23,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "cyber/common/log.h"
 #include "cyber/message/raw_message.h"
@@ -64,6 +65,12 @@ class RecordWriter : public RecordBase {
 
   bool SetIntervalOfFileSegmentation(uint64_t time_sec);
 
+  // Enables XOR-delta encoding of the given channels against the previous
+  // message of the channel, e.g. for high-rate pose/chassis/imu channels
+  // whose consecutive payloads differ in a few fields. RecordReader
+  // reconstructs the payloads transparently. Call before opening the file.
+  bool SetDeltaEncodedChannels(const std::unordered_set<std::string>& channels);
+
   uint64_t GetMessageNumber(const std::string& channel_name) const override;
 
   const std::string& GetMessageType(
@@ -86,6 +93,7 @@ class RecordWriter : public RecordBase {
   uint64_t segment_begin_time_ = 0;
   uint32_t file_index_ = 0;
   MessageNumberMap channel_message_number_map_;
+  std::unordered_set<std::string> delta_channels_;
   MessageTypeMap channel_message_type_map_;
   MessageProtoDescMap channel_proto_desc_map_;
   FileWriterPtr file_writer_ = nullptr;
@@ -0,0 +1,332 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/scheduler/common/routine_statistics.h"
+
+#include <sched.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/environment.h"
+#include "cyber/common/log.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+using apollo::cyber::base::AtomicRWLock;
+using apollo::cyber::base::ReadLockGuard;
+using apollo::cyber::base::WriteLockGuard;
+using apollo::cyber::common::GetEnv;
+
+namespace {
+
+// keep in sync with MAX_PRIO in classic_context.h; including it here would
+// cycle back through Processor
+constexpr uint32_t kMaxPrio = 20;
+// leave this much headroom above measured utilization when sizing groups
+constexpr double kProcessorHeadroom = 1.2;
+
+int FindRoot(std::vector<int>* parent, int x) {
+  while ((*parent)[x] != x) {
+    (*parent)[x] = (*parent)[(*parent)[x]];
+    x = (*parent)[x];
+  }
+  return x;
+}
+
+}  // namespace
+
+RoutineStatistics::RoutineStatistics() {
+  auto advisor = GetEnv("cyber_sched_advisor");
+  if (advisor != "" && std::stoi(advisor)) {
+    enabled_ = true;
+  }
+  start_ns_ = Time::Now().ToNanosecond();
+}
+
+RoutineStatistics::~RoutineStatistics() {
+  if (!enabled_) {
+    return;
+  }
+  bool has_stats = false;
+  {
+    ReadLockGuard<AtomicRWLock> lk(stats_lock_);
+    has_stats = !stats_.empty();
+  }
+  if (has_stats) {
+    DumpProposal("cyber_sched_proposal_" + Time::Now().ToString() + ".conf");
+  }
+}
+
+RoutineStatistics::RoutineStat* RoutineStatistics::GetStat(uint64_t crid) {
+  {
+    ReadLockGuard<AtomicRWLock> lk(stats_lock_);
+    auto it = stats_.find(crid);
+    if (it != stats_.end()) {
+      return it->second.get();
+    }
+  }
+  WriteLockGuard<AtomicRWLock> lk(stats_lock_);
+  auto& stat = stats_[crid];
+  if (stat == nullptr) {
+    stat.reset(new RoutineStat());
+  }
+  return stat.get();
+}
+
+void RoutineStatistics::RecordResume(uint64_t crid, const std::string& name,
+                                     const std::string& group_name,
+                                     uint64_t exec_ns) {
+  auto* stat = GetStat(crid);
+  if (stat->name.empty()) {
+    // only the processor that acquired the croutine gets here, so plain
+    // writes are safe
+    stat->name = name;
+    stat->group_name = group_name;
+  }
+  stat->exec_ns.fetch_add(exec_ns, std::memory_order_relaxed);
+  stat->resumes.fetch_add(1, std::memory_order_relaxed);
+
+  int cpu = sched_getcpu();
+  if (cpu >= 0) {
+    int last = stat->last_cpu.exchange(cpu, std::memory_order_relaxed);
+    if (last >= 0 && last != cpu) {
+      stat->migrations.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+void RoutineStatistics::RecordWakeup(uint64_t waker_crid,
+                                     uint64_t woken_crid) {
+  auto* stat = GetStat(woken_crid);
+  stat->wakeups.fetch_add(1, std::memory_order_relaxed);
+
+  int cpu = sched_getcpu();
+  int last = stat->last_cpu.load(std::memory_order_relaxed);
+  if (cpu >= 0 && last >= 0 && last != cpu) {
+    stat->cross_core_wakeups.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::lock_guard<std::mutex> lk(stat->edge_mutex);
+  ++stat->waker_edges[waker_crid];
+}
+
+bool RoutineStatistics::DumpProposal(const std::string& file_name) {
+  std::vector<std::pair<uint64_t, RoutineStat*>> snapshot;
+  {
+    ReadLockGuard<AtomicRWLock> lk(stats_lock_);
+    for (auto& item : stats_) {
+      snapshot.emplace_back(item.first, item.second.get());
+    }
+  }
+  if (snapshot.empty()) {
+    AWARN << "no routine statistics collected, nothing to propose.";
+    return false;
+  }
+
+  uint64_t wall_ns = Time::Now().ToNanosecond() - start_ns_;
+  if (wall_ns == 0) {
+    wall_ns = 1;
+  }
+
+  std::unordered_map<uint64_t, int> index;
+  for (std::size_t i = 0; i < snapshot.size(); ++i) {
+    index[snapshot[i].first] = static_cast<int>(i);
+  }
+
+  // croutine-to-croutine wakeup edges; wakers outside the scheduler (id 0
+  // or unseen) cannot be co-located and are left out of the clustering
+  struct Edge {
+    int a;
+    int b;
+    uint64_t weight;
+  };
+  std::vector<Edge> edges;
+  for (std::size_t i = 0; i < snapshot.size(); ++i) {
+    std::lock_guard<std::mutex> lk(snapshot[i].second->edge_mutex);
+    for (const auto& edge : snapshot[i].second->waker_edges) {
+      auto it = index.find(edge.first);
+      if (edge.first != 0 && it != index.end() &&
+          it->second != static_cast<int>(i)) {
+        edges.push_back({it->second, static_cast<int>(i), edge.second});
+      }
+    }
+  }
+  std::sort(edges.begin(), edges.end(),
+            [](const Edge& l, const Edge& r) { return l.weight > r.weight; });
+
+  // greedily merge the heaviest wakeup edges into shared groups, capped so
+  // a single group cannot swallow the whole machine
+  std::vector<double> util(snapshot.size());
+  for (std::size_t i = 0; i < snapshot.size(); ++i) {
+    // a croutine runs one slice at a time, so it can never use more than
+    // one core regardless of how short the observation window was
+    util[i] = std::min(
+        1.0,
+        static_cast<double>(
+            snapshot[i].second->exec_ns.load(std::memory_order_relaxed)) /
+            static_cast<double>(wall_ns));
+  }
+  uint32_t cpu_num = std::thread::hardware_concurrency();
+  if (cpu_num == 0) {
+    cpu_num = 1;
+  }
+  // a group may grow to half the machine, but pairing two croutines is
+  // always acceptable even on small machines
+  const double group_util_cap = std::max(2.0, cpu_num / 2.0);
+
+  std::vector<int> parent(snapshot.size());
+  std::vector<double> cluster_util(util);
+  for (std::size_t i = 0; i < snapshot.size(); ++i) {
+    parent[i] = static_cast<int>(i);
+  }
+  uint64_t intra_weight = 0;
+  uint64_t total_weight = 0;
+  for (const auto& edge : edges) {
+    total_weight += edge.weight;
+    int ra = FindRoot(&parent, edge.a);
+    int rb = FindRoot(&parent, edge.b);
+    if (ra == rb) {
+      intra_weight += edge.weight;
+      continue;
+    }
+    if (cluster_util[ra] + cluster_util[rb] > group_util_cap) {
+      continue;
+    }
+    parent[rb] = ra;
+    cluster_util[ra] += cluster_util[rb];
+    intra_weight += edge.weight;
+  }
+
+  std::unordered_map<int, std::vector<int>> clusters;
+  for (std::size_t i = 0; i < snapshot.size(); ++i) {
+    clusters[FindRoot(&parent, static_cast<int>(i))].push_back(
+        static_cast<int>(i));
+  }
+
+  std::ofstream of(file_name, std::ios::trunc);
+  if (!of.is_open()) {
+    AERROR << "failed to open proposal file: " << file_name;
+    return false;
+  }
+
+  uint64_t total_wakeups = 0;
+  uint64_t cross_wakeups = 0;
+  of << "# cyber scheduler placement proposal" << std::endl;
+  of << "# observed " << wall_ns / 1000000000ULL << "s, " << snapshot.size()
+     << " croutines" << std::endl;
+  of << "# name group cpu_ms resumes migrations wakeups cross_core_wakeups"
+     << std::endl;
+  for (const auto& item : snapshot) {
+    const auto* stat = item.second;
+    total_wakeups += stat->wakeups.load(std::memory_order_relaxed);
+    cross_wakeups += stat->cross_core_wakeups.load(std::memory_order_relaxed);
+    of << "# " << (stat->name.empty() ? "<never-resumed>" : stat->name) << " "
+       << stat->group_name << " "
+       << stat->exec_ns.load(std::memory_order_relaxed) / 1000000ULL << " "
+       << stat->resumes.load(std::memory_order_relaxed) << " "
+       << stat->migrations.load(std::memory_order_relaxed) << " "
+       << stat->wakeups.load(std::memory_order_relaxed) << " "
+       << stat->cross_core_wakeups.load(std::memory_order_relaxed)
+       << std::endl;
+  }
+  of << "# measured cross-core wakeup share: "
+     << (total_wakeups == 0 ? 0.0
+                            : 100.0 * static_cast<double>(cross_wakeups) /
+                                  static_cast<double>(total_wakeups))
+     << "%" << std::endl;
+  of << "# predicted cross-core wakeup share with this grouping: "
+     << (total_weight == 0
+             ? 0.0
+             : 100.0 * static_cast<double>(total_weight - intra_weight) /
+                   static_cast<double>(total_weight))
+     << "% (croutine-to-croutine wakeups only)" << std::endl;
+  of << "# replace scheduler_conf in the process group conf with the block"
+     << std::endl;
+  of << "# below, rerun the same drive with cyber_sched_advisor=1 and diff"
+     << std::endl;
+  of << "# the measured share against this report." << std::endl;
+
+  of << "scheduler_conf {" << std::endl;
+  of << "  policy: \"classic\"" << std::endl;
+  of << "  classic_conf {" << std::endl;
+
+  uint32_t next_cpu = 0;
+  int group_id = 0;
+  for (auto& cluster : clusters) {
+    auto& members = cluster.second;
+    // the busiest wakers get the higher priorities so the run queue scan
+    // finds latency-sensitive croutines first
+    std::sort(members.begin(), members.end(), [&snapshot](int l, int r) {
+      return snapshot[l].second->wakeups.load(std::memory_order_relaxed) >
+             snapshot[r].second->wakeups.load(std::memory_order_relaxed);
+    });
+
+    double group_util = 0.0;
+    for (int member : members) {
+      group_util += util[member];
+    }
+    auto proc_num = std::max(
+        1u, static_cast<uint32_t>(std::ceil(group_util * kProcessorHeadroom)));
+    proc_num = std::min(proc_num, cpu_num);
+
+    of << "    groups {" << std::endl;
+    of << "      name: \"advisor_grp_" << group_id << "\"" << std::endl;
+    of << "      processor_num: " << proc_num << std::endl;
+    if (next_cpu + proc_num <= cpu_num) {
+      of << "      affinity: \"range\"" << std::endl;
+      of << "      cpuset: \"" << next_cpu;
+      if (proc_num > 1) {
+        of << "-" << next_cpu + proc_num - 1;
+      }
+      of << "\"" << std::endl;
+      next_cpu += proc_num;
+    }
+    of << "      processor_policy: \"SCHED_OTHER\"" << std::endl;
+    of << "      processor_prio: 0" << std::endl;
+    for (std::size_t rank = 0; rank < members.size(); ++rank) {
+      const auto* stat = snapshot[members[rank]].second;
+      if (stat->name.empty()) {
+        continue;
+      }
+      auto prio = kMaxPrio - 1 -
+                  static_cast<uint32_t>(rank * (kMaxPrio - 1) / members.size());
+      of << "      tasks {" << std::endl;
+      of << "        name: \"" << stat->name << "\"" << std::endl;
+      of << "        prio: " << std::max(1u, prio) << std::endl;
+      of << "      }" << std::endl;
+    }
+    of << "    }" << std::endl;
+    ++group_id;
+  }
+
+  of << "  }" << std::endl;
+  of << "}" << std::endl;
+  of.close();
+  AINFO << "scheduler placement proposal dumped to " << file_name;
+  return true;
+}
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SCHEDULER_COMMON_ROUTINE_STATISTICS_H_
+#define CYBER_SCHEDULER_COMMON_ROUTINE_STATISTICS_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cyber/base/atomic_rw_lock.h"
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+// Placement advisor for the scheduler. When enabled (export
+// cyber_sched_advisor=1) it aggregates per-croutine runtime, wakeup and
+// migration counters from the processors and the data-visitor notify path.
+// On shutdown it dumps a report plus a classic_conf proposal that clusters
+// croutines which frequently wake each other into the same group, so their
+// wakeups stay on the group's cpuset instead of crossing cores. The report
+// records the measured cross-core wakeup share and the share predicted
+// under the proposal; re-running a drive with the proposal applied and
+// diffing the two reports gives the measured improvement.
+class RoutineStatistics {
+ public:
+  struct RoutineStat {
+    std::string name;
+    std::string group_name;
+    std::atomic<uint64_t> exec_ns = {0};
+    std::atomic<uint64_t> resumes = {0};
+    std::atomic<uint64_t> migrations = {0};
+    std::atomic<uint64_t> wakeups = {0};
+    std::atomic<uint64_t> cross_core_wakeups = {0};
+    std::atomic<int> last_cpu = {-1};
+    // waker croutine id -> wakeup count, 0 for non-croutine wakers
+    std::mutex edge_mutex;
+    std::unordered_map<uint64_t, uint64_t> waker_edges;
+  };
+
+  ~RoutineStatistics();
+
+  bool enabled() const { return enabled_; }
+
+  // Called by Processor::Run after every croutine slice.
+  void RecordResume(uint64_t crid, const std::string& name,
+                    const std::string& group_name, uint64_t exec_ns);
+  // Called on the data-visitor notify path; waker_crid is 0 when the
+  // wakeup comes from a plain thread instead of a croutine.
+  void RecordWakeup(uint64_t waker_crid, uint64_t woken_crid);
+
+  // Writes the report and the proposed scheduler conf in proto text
+  // format; report lines are '#' comments so the file loads as a conf.
+  bool DumpProposal(const std::string& file_name);
+
+ private:
+  RoutineStat* GetStat(uint64_t crid);
+
+  bool enabled_ = false;
+  uint64_t start_ns_ = 0;
+  base::AtomicRWLock stats_lock_;
+  std::unordered_map<uint64_t, std::unique_ptr<RoutineStat>> stats_;
+
+  DECLARE_SINGLETON(RoutineStatistics)
+};
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SCHEDULER_COMMON_ROUTINE_STATISTICS_H_
@@ -22,6 +22,7 @@
 
 #include "cyber/common/types.h"
 #include "cyber/event/perf_event_cache.h"
+#include "cyber/scheduler/policy/classic_context.h"
 
 namespace apollo {
 namespace cyber {
@@ -57,10 +58,47 @@ std::shared_ptr<CRoutine> ChoreographyContext::NextRoutine() {
     ++it;
   }
 
+  if (pool_stealing_ && steal_burst_ < steal_burst_cap_) {
+    auto cr = StealFromPool();
+    if (cr != nullptr) {
+      ++steal_burst_;
+      return cr;
+    }
+  }
+
   notified_.clear();
   return nullptr;
 }
 
+std::shared_ptr<CRoutine> ChoreographyContext::StealFromPool() {
+  auto& rq = ClassicContext::cr_group_[DEFAULT_GROUP_NAME];
+  auto& lq = ClassicContext::rq_locks_[DEFAULT_GROUP_NAME];
+  for (int i = MAX_PRIO - 1; i >= 0; --i) {
+    ReadLockGuard<AtomicRWLock> lk(lq.at(i));
+    for (auto& cr : rq.at(i)) {
+      if (!cr->Acquire()) {
+        continue;
+      }
+
+      if (cr->UpdateState() == RoutineState::READY) {
+        PerfEventCache::Instance()->AddSchedEvent(SchedPerf::NEXT_RT, cr->id(),
+                                                  cr->processor_id());
+        return cr;
+      }
+
+      cr->Release();
+    }
+  }
+  return nullptr;
+}
+
+void ChoreographyContext::EnablePoolStealing(uint32_t steal_burst_cap) {
+  if (steal_burst_cap > 0) {
+    steal_burst_cap_ = steal_burst_cap;
+  }
+  pool_stealing_ = true;
+}
+
 bool ChoreographyContext::Enqueue(const std::shared_ptr<CRoutine>& cr) {
   PerfEventCache::Instance()->AddSchedEvent(SchedPerf::RT_CREATE, cr->id(),
                                             cr->processor_id());
@@ -77,6 +115,7 @@ void ChoreographyContext::Notify() {
 }
 
 void ChoreographyContext::Wait() {
+  steal_burst_ = 0;
   std::unique_lock<std::mutex> lk(mtx_wq_);
   cv_wq_.wait_for(lk, std::chrono::milliseconds(1));
 }
@@ -44,7 +44,17 @@ class ChoreographyContext : public ProcessorContext {
   void Notify();
   void Wait() override;
 
+  // Opt-in: fall back to the classic pool's shared queues when all pinned
+  // croutines are waiting, with a cap on consecutive steals.
+  void EnablePoolStealing(uint32_t steal_burst_cap);
+
  private:
+  std::shared_ptr<CRoutine> StealFromPool();
+
+  bool pool_stealing_ = false;
+  uint32_t steal_burst_cap_ = 1;
+  uint32_t steal_burst_ = 0;
+
   std::mutex mtx_wq_;
   std::condition_variable cv_wq_;
 
@@ -31,6 +31,9 @@ using apollo::cyber::event::SchedPerf;
 
 namespace {
 static constexpr auto MIN_SLEEP_INTERVAL = std::chrono::milliseconds(1);
+// Consecutive steals allowed before a processor has to go back to (or wait
+// on) its own partition. Keeps short wakeup bursts on their warm cores.
+static constexpr uint32_t PEER_STEAL_BURST_CAP = 4;
 }
 
 GRP_WQ_MUTEX ClassicContext::mtx_wq_;
@@ -44,6 +47,20 @@ ClassicContext::ClassicContext(const std::string& group_name) {
   InitGroup(group_name);
 }
 
+ClassicContext::ClassicContext(const std::string& group_name,
+                               const std::vector<std::string>& peer_groups) {
+  InitGroup(group_name);
+  for (auto& peer : peer_groups) {
+    peer_rqs_.emplace_back(&cr_group_[peer]);
+    peer_lqs_.emplace_back(&rq_locks_[peer]);
+  }
+}
+
+std::string ClassicContext::NumaGroupName(const std::string& group_name,
+                                          uint32_t numa_node) {
+  return group_name + ":numa" + std::to_string(numa_node);
+}
+
 void ClassicContext::InitGroup(const std::string& group_name) {
   multi_pri_rq_ = &cr_group_[group_name];
   lq_ = &rq_locks_[group_name];
@@ -51,14 +68,11 @@ void ClassicContext::InitGroup(const std::string& group_name) {
   cw_ = &cv_wq_[group_name];
 }
 
-std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
-  if (unlikely(stop_)) {
-    return nullptr;
-  }
-
+std::shared_ptr<CRoutine> ClassicContext::NextRoutineIn(MULTI_PRIO_QUEUE* rq,
+                                                        LOCK_QUEUE* lq) {
   for (int i = MAX_PRIO - 1; i >= 0; --i) {
-    ReadLockGuard<AtomicRWLock> lk(lq_->at(i));
-    for (auto& cr : multi_pri_rq_->at(i)) {
+    ReadLockGuard<AtomicRWLock> lk(lq->at(i));
+    for (auto& cr : rq->at(i)) {
       if (!cr->Acquire()) {
         continue;
       }
@@ -83,7 +97,36 @@ std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
   return nullptr;
 }
 
+std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
+  if (unlikely(stop_)) {
+    return nullptr;
+  }
+
+  auto cr = NextRoutineIn(multi_pri_rq_, lq_);
+  if (cr != nullptr) {
+    steal_burst_ = 0;
+    return cr;
+  }
+
+  // Own partition drained, steal from peer partitions of the same group.
+  // Throttle consecutive steals so that shallow queues keep croutines on
+  // the cores whose caches are still warm with their working set.
+  if (steal_burst_ >= PEER_STEAL_BURST_CAP) {
+    return nullptr;
+  }
+  for (std::size_t i = 0; i < peer_rqs_.size(); ++i) {
+    cr = NextRoutineIn(peer_rqs_[i], peer_lqs_[i]);
+    if (cr != nullptr) {
+      ++steal_burst_;
+      return cr;
+    }
+  }
+
+  return nullptr;
+}
+
 void ClassicContext::Wait() {
+  steal_burst_ = 0;
   std::unique_lock<std::mutex> lk(mtx_wrapper_->Mutex());
   if (stop_) {
     return;
@@ -42,7 +42,10 @@ static constexpr uint32_t MAX_PRIO = 20;
 using CROUTINE_QUEUE = std::vector<std::shared_ptr<CRoutine>>;
 using MULTI_PRIO_QUEUE = std::array<CROUTINE_QUEUE, MAX_PRIO>;
 using CR_GROUP = std::unordered_map<std::string, MULTI_PRIO_QUEUE>;
-using LOCK_QUEUE = std::array<base::AtomicRWLock, MAX_PRIO>;
+// pad each priority's lock so neighbouring heads don't share a line
+struct alignas(CACHELINE_SIZE) PaddedAtomicRWLock : public base::AtomicRWLock {
+};
+using LOCK_QUEUE = std::array<PaddedAtomicRWLock, MAX_PRIO>;
 using RQ_LOCK_GROUP = std::unordered_map<std::string, LOCK_QUEUE>;
 
 using GRP_WQ_MUTEX = std::unordered_map<std::string, MutexWrapper>;
@@ -52,12 +55,18 @@ class ClassicContext : public ProcessorContext {
  public:
   ClassicContext();
   explicit ClassicContext(const std::string &group_name);
+  // NUMA-partitioned context: serves its own partition's queues first and
+  // falls back to stealing from the peer partitions of the same group.
+  ClassicContext(const std::string &group_name,
+                 const std::vector<std::string> &peer_groups);
 
   std::shared_ptr<CRoutine> NextRoutine() override;
   void Wait() override;
   void Shutdown() override;
 
   static void Notify(const std::string &group_name);
+  static std::string NumaGroupName(const std::string &group_name,
+                                   uint32_t numa_node);
 
   alignas(CACHELINE_SIZE) static RQ_LOCK_GROUP rq_locks_;
   alignas(CACHELINE_SIZE) static CR_GROUP cr_group_;
@@ -67,12 +76,17 @@ class ClassicContext : public ProcessorContext {
 
  private:
   void InitGroup(const std::string &group_name);
+  std::shared_ptr<CRoutine> NextRoutineIn(MULTI_PRIO_QUEUE *rq,
+                                          LOCK_QUEUE *lq);
 
   std::chrono::steady_clock::time_point wake_time_;
   bool need_sleep_ = false;
+  uint32_t steal_burst_ = 0;
 
   MULTI_PRIO_QUEUE *multi_pri_rq_ = nullptr;
   LOCK_QUEUE *lq_ = nullptr;
+  std::vector<MULTI_PRIO_QUEUE *> peer_rqs_;
+  std::vector<LOCK_QUEUE *> peer_lqs_;
   MutexWrapper *mtx_wrapper_ = nullptr;
   CvWrapper *cw_ = nullptr;
 };
@@ -73,6 +73,10 @@ SchedulerChoreography::SchedulerChoreography() {
     ParseCpuset(cfg.scheduler_conf().choreography_conf().pool_cpuset(),
                 &pool_cpuset_);
 
+    pool_stealing_ = cfg.scheduler_conf().choreography_conf().pool_stealing();
+    steal_burst_cap_ =
+        cfg.scheduler_conf().choreography_conf().steal_burst_cap();
+
     for (auto& thr : cfg.scheduler_conf().choreography_conf().threads()) {
       inner_thr_confs_[thr.name()] = thr;
     }
@@ -100,7 +104,11 @@ SchedulerChoreography::SchedulerChoreography() {
 void SchedulerChoreography::CreateProcessor() {
   for (uint32_t i = 0; i < proc_num_; i++) {
     auto proc = std::make_shared<Processor>();
+    proc->set_id(static_cast<uint32_t>(processors_.size()));
     auto ctx = std::make_shared<ChoreographyContext>();
+    if (pool_stealing_) {
+      ctx->EnablePoolStealing(steal_burst_cap_);
+    }
 
     proc->BindContext(ctx);
     proc->SetAffinity(choreography_cpuset_, choreography_affinity_, i);
@@ -115,6 +123,7 @@ void SchedulerChoreography::CreateProcessor() {
     auto ctx = std::make_shared<ClassicContext>();
 
     auto proc = std::make_shared<Processor>();
+    proc->set_id(static_cast<uint32_t>(processors_.size()));
     proc->BindContext(ctx);
     proc->SetAffinity(pool_cpuset_, pool_affinity_, i);
     proc->SetSchedPolicy(pool_processor_policy_, pool_processor_prio_);
@@ -57,6 +57,8 @@ class SchedulerChoreography : public Scheduler {
 
   std::string choreography_affinity_;
   std::string pool_affinity_;
+  bool pool_stealing_ = false;
+  uint32_t steal_burst_cap_ = 1;
 
   std::string choreography_processor_policy_;
   std::string pool_processor_policy_;
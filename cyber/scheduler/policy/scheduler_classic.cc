@@ -90,11 +90,19 @@ void SchedulerClassic::CreateProcessor() {
     std::vector<int> cpuset;
     ParseCpuset(group.cpuset(), &cpuset);
 
+    auto numa_num = group.numa_node_num();
+    if (numa_num > 1) {
+      group_numa_num_[group_name] = numa_num;
+      CreateNumaProcessors(group, cpuset);
+      continue;
+    }
+
     for (uint32_t i = 0; i < proc_num; i++) {
       auto ctx = std::make_shared<ClassicContext>(group_name);
       pctxs_.emplace_back(ctx);
 
       auto proc = std::make_shared<Processor>();
+      proc->set_id(static_cast<uint32_t>(processors_.size()));
       proc->BindContext(ctx);
       proc->SetAffinity(cpuset, affinity, i);
       proc->SetSchedPolicy(processor_policy, processor_prio);
@@ -103,6 +111,55 @@ void SchedulerClassic::CreateProcessor() {
   }
 }
 
+void SchedulerClassic::CreateNumaProcessors(
+    const apollo::cyber::proto::SchedGroup& group,
+    const std::vector<int>& cpuset) {
+  auto& group_name = group.name();
+  auto proc_num = group.processor_num();
+  auto numa_num = group.numa_node_num();
+  auto& affinity = group.affinity();
+  auto& processor_policy = group.processor_policy();
+  auto processor_prio = group.processor_prio();
+
+  std::vector<std::string> partitions;
+  for (uint32_t node = 0; node < numa_num; ++node) {
+    partitions.emplace_back(ClassicContext::NumaGroupName(group_name, node));
+  }
+
+  for (uint32_t node = 0; node < numa_num; ++node) {
+    // slice the cpuset contiguously, one slice per socket
+    std::vector<int> node_cpuset;
+    auto chunk = cpuset.size() / numa_num;
+    for (std::size_t i = node * chunk;
+         i < (node + 1 == numa_num ? cpuset.size() : (node + 1) * chunk); ++i) {
+      node_cpuset.emplace_back(cpuset[i]);
+    }
+
+    std::vector<std::string> peers;
+    for (uint32_t other = 0; other < numa_num; ++other) {
+      if (other != node) {
+        peers.emplace_back(partitions[other]);
+      }
+    }
+
+    auto node_proc_num = proc_num / numa_num;
+    if (node < proc_num % numa_num) {
+      ++node_proc_num;
+    }
+    for (uint32_t i = 0; i < node_proc_num; ++i) {
+      auto ctx = std::make_shared<ClassicContext>(partitions[node], peers);
+      pctxs_.emplace_back(ctx);
+
+      auto proc = std::make_shared<Processor>();
+      proc->set_id(static_cast<uint32_t>(processors_.size()));
+      proc->BindContext(ctx);
+      proc->SetAffinity(node_cpuset, affinity, i);
+      proc->SetSchedPolicy(processor_policy, processor_prio);
+      processors_.emplace_back(proc);
+    }
+  }
+}
+
 bool SchedulerClassic::DispatchTask(const std::shared_ptr<CRoutine>& cr) {
   // we use multi-key mutex to prevent race condition
   // when del && add cr with same crid
@@ -135,6 +192,14 @@ bool SchedulerClassic::DispatchTask(const std::shared_ptr<CRoutine>& cr) {
     cr->set_group_name(classic_conf_.groups(0).name());
   }
 
+  {
+    auto it = group_numa_num_.find(cr->group_name());
+    if (it != group_numa_num_.end() && it->second > 1) {
+      cr->set_group_name(ClassicContext::NumaGroupName(
+          cr->group_name(), static_cast<uint32_t>(cr->id() % it->second)));
+    }
+  }
+
   // Check if task prio is reasonable.
   if (cr->priority() >= MAX_PRIO) {
     AWARN << cr->name() << " prio is greater than MAX_PRIO[ << " << MAX_PRIO
@@ -177,6 +242,108 @@ bool SchedulerClassic::NotifyProcessor(uint64_t crid) {
   return false;
 }
 
+void SchedulerClassic::BoostCRoutines(uint64_t waiter_crid,
+                                      const std::vector<uint64_t>& crids) {
+  std::shared_ptr<CRoutine> waiter = nullptr;
+  {
+    ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+    auto it = id_cr_.find(waiter_crid);
+    if (it == id_cr_.end()) {
+      return;
+    }
+    waiter = it->second;
+  }
+  const uint32_t waiter_prio = waiter->priority();
+
+  std::lock_guard<std::mutex> lg(boost_mtx_);
+  if (waiter_boosts_.find(waiter_crid) != waiter_boosts_.end()) {
+    // still blocked from a previous pass, boosts are already in place
+    return;
+  }
+  std::vector<uint64_t> boosted;
+  for (const auto& crid : crids) {
+    if (crid == waiter_crid) {
+      continue;
+    }
+    std::shared_ptr<CRoutine> cr = nullptr;
+    {
+      ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+      auto it = id_cr_.find(crid);
+      if (it == id_cr_.end()) {
+        continue;
+      }
+      cr = it->second;
+    }
+    if (cr->priority() >= waiter_prio) {
+      continue;
+    }
+    auto& state = boosted_crs_[crid];
+    if (state.count == 0) {
+      state.original_prio = cr->priority();
+    }
+    ++state.count;
+    SetCRoutinePriority(cr, waiter_prio);
+    ClassicContext::Notify(cr->group_name());
+    boosted.emplace_back(crid);
+  }
+  if (!boosted.empty()) {
+    waiter_boosts_[waiter_crid] = std::move(boosted);
+  }
+}
+
+void SchedulerClassic::RestoreBoostedCRoutines(uint64_t waiter_crid) {
+  std::lock_guard<std::mutex> lg(boost_mtx_);
+  auto it = waiter_boosts_.find(waiter_crid);
+  if (it == waiter_boosts_.end()) {
+    return;
+  }
+  for (const auto& crid : it->second) {
+    auto state_it = boosted_crs_.find(crid);
+    if (state_it == boosted_crs_.end()) {
+      continue;
+    }
+    if (--state_it->second.count == 0) {
+      std::shared_ptr<CRoutine> cr = nullptr;
+      {
+        ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+        auto cr_it = id_cr_.find(crid);
+        if (cr_it != id_cr_.end()) {
+          cr = cr_it->second;
+        }
+      }
+      if (cr != nullptr) {
+        SetCRoutinePriority(cr, state_it->second.original_prio);
+      }
+      boosted_crs_.erase(state_it);
+    }
+  }
+  waiter_boosts_.erase(it);
+}
+
+void SchedulerClassic::SetCRoutinePriority(const std::shared_ptr<CRoutine>& cr,
+                                           uint32_t prio) {
+  const uint32_t old_prio = cr->priority();
+  if (old_prio == prio) {
+    return;
+  }
+  auto& group_name = cr->group_name();
+  // both runqueue locks are taken in ascending priority order so that
+  // concurrent moves cannot deadlock
+  WriteLockGuard<AtomicRWLock> lk_low(
+      ClassicContext::rq_locks_[group_name].at(std::min(old_prio, prio)));
+  WriteLockGuard<AtomicRWLock> lk_high(
+      ClassicContext::rq_locks_[group_name].at(std::max(old_prio, prio)));
+  auto& src = ClassicContext::cr_group_[group_name].at(old_prio);
+  for (auto it = src.begin(); it != src.end(); ++it) {
+    if ((*it)->id() == cr->id()) {
+      src.erase(it);
+      break;
+    }
+  }
+  cr->set_priority(prio);
+  ClassicContext::cr_group_[group_name].at(prio).emplace_back(cr);
+}
+
 bool SchedulerClassic::RemoveTask(const std::string& name) {
   if (unlikely(stop_)) {
     return true;
@@ -202,7 +369,7 @@ bool SchedulerClassic::RemoveCRoutine(uint64_t crid) {
   std::lock_guard<std::mutex> lg(wrapper->Mutex());
 
   std::shared_ptr<CRoutine> cr = nullptr;
-  int prio;
+  uint32_t prio;
   std::string group_name;
   {
     WriteLockGuard<AtomicRWLock> lk(id_cr_lock_);
@@ -217,17 +384,26 @@ bool SchedulerClassic::RemoveCRoutine(uint64_t crid) {
     }
   }
 
-  WriteLockGuard<AtomicRWLock> lk(
-      ClassicContext::rq_locks_[group_name].at(prio));
-  for (auto it = ClassicContext::cr_group_[group_name].at(prio).begin();
-       it != ClassicContext::cr_group_[group_name].at(prio).end(); ++it) {
-    if ((*it)->id() == crid) {
-      auto cr = *it;
+  // A concurrent priority boost may have moved the croutine to another
+  // runqueue, so fall back to scanning the remaining queues. One lock is
+  // held at a time to stay deadlock-free against SetCRoutinePriority.
+  for (uint32_t i = 0; i < MAX_PRIO + 1; ++i) {
+    uint32_t search_prio = (i == 0) ? prio : i - 1;
+    if (i != 0 && search_prio == prio) {
+      continue;
+    }
+    WriteLockGuard<AtomicRWLock> lk(
+        ClassicContext::rq_locks_[group_name].at(search_prio));
+    auto& queue = ClassicContext::cr_group_[group_name].at(search_prio);
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+      if ((*it)->id() == crid) {
+        auto cr = *it;
 
-      (*it)->Stop();
-      it = ClassicContext::cr_group_[group_name].at(prio).erase(it);
-      cr->Release();
-      return true;
+        (*it)->Stop();
+        it = queue.erase(it);
+        cr->Release();
+        return true;
+      }
     }
   }
 
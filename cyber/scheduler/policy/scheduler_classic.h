@@ -18,6 +18,7 @@
 #define CYBER_SCHEDULER_POLICY_SCHEDULER_CLASSIC_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -40,14 +41,33 @@ class SchedulerClassic : public Scheduler {
   bool RemoveTask(const std::string& name) override;
   bool DispatchTask(const std::shared_ptr<CRoutine>&) override;
 
+  void BoostCRoutines(uint64_t waiter_crid,
+                      const std::vector<uint64_t>& crids) override;
+  void RestoreBoostedCRoutines(uint64_t waiter_crid) override;
+
  private:
   friend Scheduler* Instance();
   SchedulerClassic();
 
   void CreateProcessor();
+  void CreateNumaProcessors(const apollo::cyber::proto::SchedGroup& group,
+                            const std::vector<int>& cpuset);
   bool NotifyProcessor(uint64_t crid) override;
+  void SetCRoutinePriority(const std::shared_ptr<CRoutine>& cr, uint32_t prio);
 
   std::unordered_map<std::string, ClassicTask> cr_confs_;
+  // groups running in NUMA-partitioned mode, value is the partition count
+  std::unordered_map<std::string, uint32_t> group_numa_num_;
+
+  // Priority-inheritance bookkeeping. A croutine boosted by several
+  // waiters keeps its raised priority until the last one restores it.
+  struct BoostState {
+    uint32_t original_prio = 0;
+    uint32_t count = 0;
+  };
+  std::mutex boost_mtx_;
+  std::unordered_map<uint64_t, BoostState> boosted_crs_;
+  std::unordered_map<uint64_t, std::vector<uint64_t>> waiter_boosts_;
 
   ClassicConf classic_conf_;
 };
@@ -24,6 +24,8 @@
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/croutine/croutine.h"
+#include "cyber/event/perf_event_cache.h"
+#include "cyber/scheduler/common/routine_statistics.h"
 #include "cyber/scheduler/processor_context.h"
 
 namespace apollo {
@@ -31,6 +33,8 @@ namespace cyber {
 namespace scheduler {
 
 using apollo::cyber::common::GlobalData;
+using apollo::cyber::event::PerfEventCache;
+using apollo::cyber::event::SchedPerf;
 
 Processor::Processor() { running_.exchange(true); }
 
@@ -83,7 +87,28 @@ void Processor::Run() {
     if (likely(context_ != nullptr)) {
       auto croutine = context_->NextRoutine();
       if (croutine) {
-        croutine->Resume();
+        if (unlikely(croutine->last_exec_processor() !=
+                     static_cast<int>(id_))) {
+          if (croutine->last_exec_processor() != -1) {
+            croutine->IncreaseMigrationCount();
+            PerfEventCache::Instance()->AddSchedEvent(
+                SchedPerf::MIGRATE, croutine->id(), static_cast<int>(id_));
+          }
+          croutine->set_last_exec_processor(static_cast<int>(id_));
+        }
+        auto* stats = RoutineStatistics::Instance();
+        if (unlikely(stats->enabled())) {
+          auto start = std::chrono::steady_clock::now();
+          croutine->Resume();
+          auto exec_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+          stats->RecordResume(croutine->id(), croutine->name(),
+                              croutine->group_name(),
+                              static_cast<uint64_t>(exec_ns));
+        } else {
+          croutine->Resume();
+        }
         croutine->Release();
       } else {
         context_->Wait();
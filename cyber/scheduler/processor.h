@@ -47,6 +47,9 @@ class Processor {
   void SetAffinity(const std::vector<int>&, const std::string&, int);
   void SetSchedPolicy(std::string spolicy, int sched_priority);
 
+  uint32_t id() const { return id_; }
+  void set_id(uint32_t id) { id_ = id; }
+
  private:
   std::shared_ptr<ProcessorContext> context_;
 
@@ -55,6 +58,7 @@ class Processor {
   std::mutex mtx_ctx_;
   std::thread thread_;
 
+  uint32_t id_ = 0;
   std::atomic<pid_t> tid_{-1};
   std::atomic<bool> running_{false};
 };
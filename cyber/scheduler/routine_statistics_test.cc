@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/scheduler/common/routine_statistics.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+TEST(RoutineStatisticsTest, dump_proposal) {
+  // must be set before the singleton is first constructed
+  setenv("cyber_sched_advisor", "1", 1);
+  auto* stats = RoutineStatistics::Instance();
+  ASSERT_TRUE(stats->enabled());
+
+  for (int i = 0; i < 100; ++i) {
+    stats->RecordResume(1, "chatter_reader", "default_grp", 2000000);
+    stats->RecordResume(2, "chatter_writer", "default_grp", 1000000);
+    stats->RecordWakeup(2, 1);
+  }
+  stats->RecordWakeup(0, 2);
+
+  const std::string file_name = "/tmp/routine_statistics_test.conf";
+  ASSERT_TRUE(stats->DumpProposal(file_name));
+
+  std::ifstream ifs(file_name);
+  ASSERT_TRUE(ifs.is_open());
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  const std::string proposal = ss.str();
+
+  // both croutines are wired by a heavy wakeup edge, so the proposal
+  // should place them in one advisor group of the classic policy
+  EXPECT_NE(proposal.find("classic_conf"), std::string::npos);
+  EXPECT_NE(proposal.find("advisor_grp_0"), std::string::npos);
+  EXPECT_EQ(proposal.find("advisor_grp_1"), std::string::npos);
+  EXPECT_NE(proposal.find("name: \"chatter_reader\""), std::string::npos);
+  EXPECT_NE(proposal.find("name: \"chatter_writer\""), std::string::npos);
+  EXPECT_NE(proposal.find("measured cross-core wakeup share"),
+            std::string::npos);
+  std::remove(file_name.c_str());
+}
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
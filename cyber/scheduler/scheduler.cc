@@ -24,8 +24,10 @@
 #include "cyber/common/util.h"
 #include "cyber/data/data_visitor.h"
 #include "cyber/event/perf_event_cache.h"
+#include "cyber/scheduler/common/routine_statistics.h"
 #include "cyber/scheduler/processor.h"
 #include "cyber/scheduler/processor_context.h"
+#include "cyber/service_discovery/topology_manager.h"
 
 namespace apollo {
 namespace cyber {
@@ -40,7 +42,8 @@ bool Scheduler::CreateTask(const RoutineFactory& factory,
 
 bool Scheduler::CreateTask(std::function<void()>&& func,
                            const std::string& name,
-                           std::shared_ptr<DataVisitorBase> visitor) {
+                           std::shared_ptr<DataVisitorBase> visitor,
+                           size_t stack_size) {
   if (unlikely(stop_.load())) {
     ADEBUG << "scheduler is stoped, cannot create task!";
     return false;
@@ -48,7 +51,7 @@ bool Scheduler::CreateTask(std::function<void()>&& func,
 
   auto task_id = GlobalData::RegisterTaskName(name);
 
-  auto cr = std::make_shared<CRoutine>(func);
+  auto cr = std::make_shared<CRoutine>(func, stack_size);
   cr->set_id(task_id);
   cr->set_name(name);
 
@@ -61,12 +64,62 @@ bool Scheduler::CreateTask(std::function<void()>&& func,
       if (unlikely(stop_.load())) {
         return;
       }
+      auto* stats = RoutineStatistics::Instance();
+      if (unlikely(stats->enabled())) {
+        auto* waker = CRoutine::GetCurrentRoutine();
+        stats->RecordWakeup(waker != nullptr ? waker->id() : 0, task_id);
+      }
       this->NotifyProcessor(task_id);
     });
+    // Priority inheritance: while this task blocks on empty buffers, boost
+    // the in-process writers of its channels so a low-priority upstream
+    // producer cannot starve a high-priority consumer.
+    const std::vector<uint64_t> channels = visitor->channel_ids();
+    visitor->RegisterBlockCallbacks(
+        [this, task_id, channels]() {
+          if (unlikely(stop_.load())) {
+            return;
+          }
+          this->BoostUpstreamOf(task_id, channels);
+        },
+        [this, task_id]() {
+          if (unlikely(stop_.load())) {
+            return;
+          }
+          this->RestoreBoostedCRoutines(task_id);
+        });
   }
   return true;
 }
 
+void Scheduler::BoostUpstreamOf(uint64_t crid,
+                                const std::vector<uint64_t>& channels) {
+  auto channel_manager =
+      service_discovery::TopologyManager::Instance()->channel_manager();
+  if (channel_manager == nullptr) {
+    return;
+  }
+  const int process_id = GlobalData::Instance()->ProcessId();
+  std::vector<uint64_t> upstream;
+  for (const auto& channel_id : channels) {
+    std::vector<proto::RoleAttributes> writers;
+    channel_manager->GetWritersOfChannel(GlobalData::GetChannelById(channel_id),
+                                         &writers);
+    for (const auto& writer : writers) {
+      // Only same-process writers are within this scheduler's reach; remote
+      // producers cannot be boosted from here.
+      if (writer.process_id() != process_id) {
+        continue;
+      }
+      // Component croutines are registered under their node's name.
+      upstream.emplace_back(GlobalData::GenerateHashId(writer.node_name()));
+    }
+  }
+  if (!upstream.empty()) {
+    BoostCRoutines(crid, upstream);
+  }
+}
+
 bool Scheduler::NotifyTask(uint64_t crid) {
   if (unlikely(stop_.load())) {
     return true;
@@ -56,8 +56,10 @@ class Scheduler {
   static Scheduler* Instance();
 
   bool CreateTask(const RoutineFactory& factory, const std::string& name);
+  // stack_size of 0 means the scheduler conf default
   bool CreateTask(std::function<void()>&& func, const std::string& name,
-                  std::shared_ptr<DataVisitorBase> visitor = nullptr);
+                  std::shared_ptr<DataVisitorBase> visitor = nullptr,
+                  size_t stack_size = 0);
   bool NotifyTask(uint64_t crid);
 
   void Shutdown();
@@ -70,10 +72,22 @@ class Scheduler {
   virtual bool NotifyProcessor(uint64_t crid) = 0;
   virtual bool RemoveCRoutine(uint64_t crid) = 0;
 
+  // Priority inheritance hooks, implemented by policies with priority
+  // runqueues. BoostCRoutines temporarily raises the given croutines to the
+  // waiter's priority; RestoreBoostedCRoutines undoes every boost the
+  // waiter holds.
+  virtual void BoostCRoutines(uint64_t waiter_crid,
+                              const std::vector<uint64_t>& crids) {}
+  virtual void RestoreBoostedCRoutines(uint64_t waiter_crid) {}
+
  protected:
   Scheduler() : stop_(false) {}
   void ParseCpuset(const std::string&, std::vector<int>*);
 
+  // Boosts the in-process writer croutines of the given channels while
+  // crid is blocked waiting for their data.
+  void BoostUpstreamOf(uint64_t crid, const std::vector<uint64_t>& channels);
+
   AtomicRWLock id_cr_lock_;
   AtomicHashMap<uint64_t, MutexWrapper*> id_map_mutex_;
   std::mutex cr_wl_mtx_;
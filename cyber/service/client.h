@@ -65,6 +65,12 @@ class Client : public ClientBase {
       const Request& request,
       const std::chrono::seconds& timeout_s = std::chrono::seconds(5));
 
+  // Deadline variant for latency-critical control-plane calls: waits at most
+  // deadline and reclaims the pending slot on expiry, so abandoned calls
+  // cannot pile up and a straggler response is simply ignored.
+  SharedResponse SendRequestWithDeadline(
+      SharedRequest request, const std::chrono::nanoseconds& deadline);
+
   SharedFuture AsyncSendRequest(SharedRequest request);
   SharedFuture AsyncSendRequest(const Request& request);
   SharedFuture AsyncSendRequest(SharedRequest request, CallbackType&& cb);
@@ -154,19 +160,37 @@ template <typename Request, typename Response>
 typename Client<Request, Response>::SharedResponse
 Client<Request, Response>::SendRequest(SharedRequest request,
                                        const std::chrono::seconds& timeout_s) {
+  return SendRequestWithDeadline(
+      request, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout_s));
+}
+
+template <typename Request, typename Response>
+typename Client<Request, Response>::SharedResponse
+Client<Request, Response>::SendRequestWithDeadline(
+    SharedRequest request, const std::chrono::nanoseconds& deadline) {
   if (!IsInit()) {
     return nullptr;
   }
-  auto future = AsyncSendRequest(request);
-  if (!future.valid()) {
-    return nullptr;
+  uint64_t sequence_number = 0;
+  SharedFuture future;
+  {
+    std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+    sequence_number = ++sequence_number_;
+    transport::MessageInfo info(writer_id_, sequence_number, writer_id_);
+    request_transmitter_->Transmit(request, info);
+    SharedPromise call_promise = std::make_shared<Promise>();
+    future = SharedFuture(call_promise->get_future());
+    pending_requests_[sequence_number] = std::make_tuple(
+        call_promise, CallbackType([](SharedFuture) {}), future);
   }
-  auto status = future.wait_for(timeout_s);
-  if (status == std::future_status::ready) {
+  if (future.wait_for(deadline) == std::future_status::ready) {
     return future.get();
-  } else {
-    return nullptr;
   }
+  // deadline expired: drop the pending slot so abandoned calls cannot
+  // accumulate in the map waiting for responses that may never come
+  std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+  pending_requests_.erase(sequence_number);
+  return nullptr;
 }
 
 template <typename Request, typename Response>
@@ -116,6 +116,7 @@ void Graph::Insert(const Edge& e) {
   if (!e.dst().IsDummy()) {
     InsertIncomingEdge(e);
   }
+  InvalidateCache();
 }
 
 void Graph::Delete(const Edge& e) {
@@ -134,6 +135,7 @@ void Graph::Delete(const Edge& e) {
   if (!e.dst().IsDummy()) {
     DeleteIncomingEdge(e);
   }
+  InvalidateCache();
 }
 
 uint32_t Graph::GetNumOfEdge() {
@@ -149,17 +151,42 @@ FlowDirection Graph::GetDirectionOf(const Vertice& lhs, const Vertice& rhs) {
   if (lhs.IsDummy() || rhs.IsDummy()) {
     return UNREACHABLE;
   }
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (list_.count(lhs.GetKey()) == 0 || list_.count(rhs.GetKey()) == 0) {
-    return UNREACHABLE;
+  const std::string cache_key = lhs.GetKey() + "->" + rhs.GetKey();
+  uint64_t version = 0;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    auto itr = direction_cache_.find(cache_key);
+    if (itr != direction_cache_.end()) {
+      return itr->second;
+    }
+    version = topo_version_;
   }
-  if (LevelTraverse(lhs, rhs)) {
-    return UPSTREAM;
+
+  FlowDirection direction = UNREACHABLE;
+  {
+    ReadLockGuard<AtomicRWLock> lock(rw_lock_);
+    if (list_.count(lhs.GetKey()) == 0 || list_.count(rhs.GetKey()) == 0) {
+      return UNREACHABLE;
+    }
+    if (LevelTraverse(lhs, rhs)) {
+      direction = UPSTREAM;
+    } else if (LevelTraverse(rhs, lhs)) {
+      direction = DOWNSTREAM;
+    }
   }
-  if (LevelTraverse(rhs, lhs)) {
-    return DOWNSTREAM;
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  // a topology change while we traversed makes this result stale
+  if (version == topo_version_) {
+    direction_cache_[cache_key] = direction;
   }
-  return UNREACHABLE;
+  return direction;
+}
+
+void Graph::InvalidateCache() {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  ++topo_version_;
+  direction_cache_.clear();
 }
 
 void Graph::InsertOutgoingEdge(const Edge& e) {
@@ -18,6 +18,7 @@
 #define CYBER_SERVICE_DISCOVERY_ROLE_GRAPH_H_
 
 #include <stdint.h>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -120,10 +121,18 @@ class Graph {
   void DeleteIncomingEdge(const Edge& e);
   void DeleteCompleteEdge(const Edge& e);
   bool LevelTraverse(const Vertice& start, const Vertice& end);
+  void InvalidateCache();
 
   EdgeInfo edges_;
   AdjacencyList list_;
   base::AtomicRWLock rw_lock_;
+
+  // direction queries traverse the graph, so repeated queries between two
+  // topology changes answer from this cache; any Insert/Delete bumps the
+  // version and drops it
+  std::unordered_map<std::string, FlowDirection> direction_cache_;
+  uint64_t topo_version_ = 0;
+  std::mutex cache_mutex_;
 };
 
 }  // namespace service_discovery
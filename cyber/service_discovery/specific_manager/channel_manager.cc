@@ -296,6 +296,10 @@ void ChannelManager::DisposeLeave(const ChangeMsg& msg) {
 }
 
 void ChannelManager::ScanMessageType(const ChangeMsg& msg) {
+  // an exempted type matches every existing role, skip the per-role scan
+  if (exempted_msg_types_.count(msg.role_attr().message_type()) > 0) {
+    return;
+  }
   uint64_t key = msg.role_attr().channel_id();
   std::string role_type("reader");
   if (msg.role_type() == RoleType::ROLE_WRITER) {
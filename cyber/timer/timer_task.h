@@ -56,9 +56,31 @@ class TimerTask {
   bool oneshot_ = true;
   uint64_t fire_count_ = 0;
 
+ private:
+  uint64_t jitter_sum_ns_ = 0;
+  uint64_t jitter_max_ns_ = 0;
+  uint64_t jitter_count_ = 0;
+
  public:
   uint64_t Id() { return tid_; }
 
+  // deviation between the scheduled deadline and the tick that actually
+  // dispatched the task, accumulated per timer so a jittery timer can be
+  // attributed to its owner
+  void RecordJitter(uint64_t jitter_ns) {
+    jitter_sum_ns_ += jitter_ns;
+    if (jitter_ns > jitter_max_ns_) {
+      jitter_max_ns_ = jitter_ns;
+    }
+    ++jitter_count_;
+  }
+
+  uint64_t AverageJitterNs() {
+    return jitter_count_ == 0 ? 0 : jitter_sum_ns_ / jitter_count_;
+  }
+
+  uint64_t MaxJitterNs() { return jitter_max_ns_; }
+
   void Fire(bool async);
 
   bool Cancel();
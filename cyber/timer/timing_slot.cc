@@ -27,7 +27,8 @@ void TimingSlot::AddTask(const std::shared_ptr<TimerTask>& task) {
 }
 
 void TimingSlot::EnumTaskList(
-    uint64_t deadline, bool async, BoundedQueue<HandlePackage>* hander_queue,
+    uint64_t deadline, uint64_t now_since_start, bool async,
+    BoundedQueue<HandlePackage>* hander_queue,
     BoundedQueue<std::shared_ptr<TimerTask>>* rep_queue) {
   for (auto it = tasks_.begin(); it != tasks_.end();) {
     auto task = it->second;  // *it;
@@ -36,6 +37,12 @@ void TimingSlot::EnumTaskList(
     // std::cout << "judge: task->" << task->deadline << " : " << deadline;
     if (task->deadline_ <= deadline) {
       if (task->rest_rounds_ == 0) {
+        task->RecordJitter(now_since_start > task->deadline_
+                               ? now_since_start - task->deadline_
+                               : task->deadline_ - now_since_start);
+        ADEBUG << "timer id " << task->Id()
+               << " avg jitter ns: " << task->AverageJitterNs()
+               << ", max jitter ns: " << task->MaxJitterNs();
         if (async) {
           HandlePackage hp;
           hp.handle = task->handler_;
@@ -53,7 +53,7 @@ class TimingSlot {
   void AddTask(const std::shared_ptr<TimerTask>& task);
   void RemoveTask(uint64_t id) { tasks_.erase(id); }
 
-  void EnumTaskList(uint64_t deadline, bool async,
+  void EnumTaskList(uint64_t deadline, uint64_t now_since_start, bool async,
                     BoundedQueue<HandlePackage>* hander_queue,
                     BoundedQueue<std::shared_ptr<TimerTask>>* rep_list);
 };  // TimeSlot end
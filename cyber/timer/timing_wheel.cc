@@ -61,10 +61,7 @@ TimingWheel::TimingWheel(const Duration& tick_duration) {
 
 uint64_t TimingWheel::StartTimer(uint64_t interval, CallHandler handler,
                                  bool oneshot) {
-  if (id_counter_ > UINT64_MAX) {
-    AERROR << "Timer ID pool is full.";
-    return -1;
-  } else if (interval > TIMER_TASK_MAX_INTERVAL) {
+  if (interval > TIMER_TASK_MAX_INTERVAL) {
     AERROR << "The interval of timer task MUST less than or equal "
            << TIMER_TASK_MAX_INTERVAL << "ms.";
     return -1;
@@ -74,19 +71,21 @@ uint64_t TimingWheel::StartTimer(uint64_t interval, CallHandler handler,
     return -1;
   }
   auto now = Time::Now().ToNanosecond();
+  uint64_t timer_id = id_counter_.fetch_add(1) + 1;
+  // serialize per task, not across tasks: one timer's slow callback must
+  // never delay the callbacks of an unrelated timer
+  auto task_mutex = std::make_shared<std::mutex>();
   auto task = std::make_shared<TimerTask>(
-      ++id_counter_, now, interval,
-      [handler](void) {
-        static std::mutex task_mutex;
-        std::lock_guard<std::mutex> lock(task_mutex);
+      timer_id, now, interval,
+      [handler, task_mutex](void) {
+        std::lock_guard<std::mutex> lock(*task_mutex);
         handler();
       },
       oneshot);
   if (add_queue_.Enqueue(task)) {
-    ADEBUG << "start timer id: " << id_counter_;
-    return id_counter_;
+    ADEBUG << "start timer id: " << timer_id;
+    return timer_id;
   } else {
-    --id_counter_;
     AERROR << "add queue is full, Enqueue failed!";
     return -1;
   }
@@ -100,8 +99,9 @@ void TimingWheel::Step() {
   uint64_t idx = tick_ & mask_;
   RemoveCancelledTasks(idx);
   FillAddSlot();
-  time_slots_[idx].EnumTaskList(deadline, true, &handler_queue_,
-                                &repeat_queue_);
+  time_slots_[idx].EnumTaskList(deadline,
+                                Time::Now().ToNanosecond() - start_time_, true,
+                                &handler_queue_, &repeat_queue_);
 
   // timing wheel tick one time
   tick_++;
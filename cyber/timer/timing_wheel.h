@@ -18,6 +18,7 @@
 #define CYBER_TIMER_TIMING_WHEEL_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <list>
@@ -65,7 +66,7 @@ class TimingWheel {
 
   void RemoveCancelledTasks(uint64_t slot_index);
 
-  uint64_t id_counter_ = 0;
+  std::atomic<uint64_t> id_counter_ = {0};
 
   uint64_t tick_ = 0;
 
@@ -26,9 +26,11 @@
 #include "cyber/init.h"
 #include "cyber/tools/cyber_recorder/info.h"
 #include "cyber/tools/cyber_recorder/player/player.h"
+#include "cyber/tools/cyber_recorder/record_buffer.h"
 #include "cyber/tools/cyber_recorder/recorder.h"
 #include "cyber/tools/cyber_recorder/recoverer.h"
 #include "cyber/tools/cyber_recorder/spliter.h"
+#include "cyber/tools/cyber_recorder/transformer.h"
 
 using apollo::cyber::common::GetFileName;
 using apollo::cyber::common::StringToUnixSeconds;
@@ -37,14 +39,18 @@ using apollo::cyber::record::HeaderBuilder;
 using apollo::cyber::record::Info;
 using apollo::cyber::record::Player;
 using apollo::cyber::record::PlayParam;
+using apollo::cyber::record::RecordBuffer;
 using apollo::cyber::record::Recorder;
 using apollo::cyber::record::Recoverer;
 using apollo::cyber::record::Spliter;
+using apollo::cyber::record::Transformer;
 
 const char INFO_OPTIONS[] = "h";
 const char RECORD_OPTIONS[] = "o:ac:i:m:h";
+const char BUFFER_OPTIONS[] = "o:ac:n:h";
 const char PLAY_OPTIONS[] = "f:c:lr:b:e:s:d:p:h";
 const char SPLIT_OPTIONS[] = "f:o:c:k:b:e:h";
+const char TRANSFORM_OPTIONS[] = "f:o:c:k:b:e:j:z:h";
 const char RECOVER_OPTIONS[] = "f:o:h";
 
 void DisplayUsage(const std::string& binary);
@@ -58,7 +64,10 @@ void DisplayUsage(const std::string& binary) {
             << "\tinfo\tShow infomation of an exist record.\n"
             << "\tplay\tPlay an exist record.\n"
             << "\trecord\tRecord same topic.\n"
+            << "\tbuffer\tBuffer the last n seconds in memory, flush on "
+               "service trigger.\n"
             << "\tsplit\tSplit an exist record.\n"
+            << "\ttransform\tTransform an exist record with parallel workers.\n"
             << "\trecover\tRecover an exist record.\n"
             << std::endl;
 }
@@ -76,10 +85,14 @@ void DisplayUsage(const std::string& binary, const std::string& command) {
             << std::endl;
   if (command == "record") {
     DisplayUsage(binary, command, RECORD_OPTIONS);
+  } else if (command == "buffer") {
+    DisplayUsage(binary, command, BUFFER_OPTIONS);
   } else if (command == "play") {
     DisplayUsage(binary, command, PLAY_OPTIONS);
   } else if (command == "split") {
     DisplayUsage(binary, command, SPLIT_OPTIONS);
+  } else if (command == "transform") {
+    DisplayUsage(binary, command, TRANSFORM_OPTIONS);
   } else if (command == "recover") {
     DisplayUsage(binary, command, RECOVER_OPTIONS);
   } else {
@@ -145,6 +158,18 @@ void DisplayUsage(const std::string& binary, const std::string& command,
         std::cout << "\t-m, --segment-size <MB>\t\t\t" << command
                   << " segmented every n megabyte(s)" << std::endl;
         break;
+      case 'n':
+        std::cout << "\t-n, --duration <seconds>\t\t" << command
+                  << " the last n second(s) in memory" << std::endl;
+        break;
+      case 'j':
+        std::cout << "\t-j, --jobs <num>\t\t\t" << command << " with n "
+                  << "parallel workers" << std::endl;
+        break;
+      case 'z':
+        std::cout << "\t-z, --chunk-size <MB>\t\t\tre-chunk the output "
+                  << "every n megabyte(s)" << std::endl;
+        break;
       case 'h':
         std::cout << "\t-h, --help\t\t\t\tshow help message" << std::endl;
         break;
@@ -170,7 +195,7 @@ int main(int argc, char** argv) {
   }
 
   int long_index = 0;
-  const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:h";
+  const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:j:z:n:h";
   static const struct option long_opts[] = {
       {"files", required_argument, nullptr, 'f'},
       {"white-channel", required_argument, nullptr, 'c'},
@@ -186,6 +211,9 @@ int main(int argc, char** argv) {
       {"preload", required_argument, nullptr, 'p'},
       {"segment-interval", required_argument, nullptr, 'i'},
       {"segment-size", required_argument, nullptr, 'm'},
+      {"jobs", required_argument, nullptr, 'j'},
+      {"chunk-size", required_argument, nullptr, 'z'},
+      {"duration", required_argument, nullptr, 'n'},
       {"help", no_argument, nullptr, 'h'}};
 
   std::vector<std::string> opt_file_vec;
@@ -200,6 +228,9 @@ int main(int argc, char** argv) {
   uint64_t opt_start = 0;
   uint64_t opt_delay = 0;
   uint32_t opt_preload = 3;
+  uint32_t opt_jobs = 0;
+  uint64_t opt_chunk_size = 0;
+  uint64_t opt_buffer_duration = 30;
   auto opt_header = HeaderBuilder::GetHeader();
 
   do {
@@ -346,6 +377,63 @@ int main(int argc, char** argv) {
           return -1;
         }
         break;
+      case 'j':
+        try {
+          int jobs = std::stoi(optarg);
+          if (jobs < 0) {
+            std::cout << "Argument is less than zero: -j/--jobs "
+                      << std::string(optarg) << std::endl;
+            return -1;
+          }
+          opt_jobs = jobs;
+        } catch (std::invalid_argument& ia) {
+          std::cout << "Invalid argument: -j/--jobs " << std::string(optarg)
+                    << std::endl;
+          return -1;
+        } catch (const std::out_of_range& e) {
+          std::cout << "Argument is out of range: -j/--jobs "
+                    << std::string(optarg) << std::endl;
+          return -1;
+        }
+        break;
+      case 'z':
+        try {
+          int chunk_mb = std::stoi(optarg);
+          if (chunk_mb < 0) {
+            std::cout << "Argument is less than zero: -z/--chunk-size "
+                      << std::string(optarg) << std::endl;
+            return -1;
+          }
+          opt_chunk_size = chunk_mb * 1024 * 1024ULL;
+        } catch (std::invalid_argument& ia) {
+          std::cout << "Invalid argument: -z/--chunk-size "
+                    << std::string(optarg) << std::endl;
+          return -1;
+        } catch (const std::out_of_range& e) {
+          std::cout << "Argument is out of range: -z/--chunk-size "
+                    << std::string(optarg) << std::endl;
+          return -1;
+        }
+        break;
+      case 'n':
+        try {
+          int duration_s = std::stoi(optarg);
+          if (duration_s <= 0) {
+            std::cout << "Argument is not positive: -n/--duration "
+                      << std::string(optarg) << std::endl;
+            return -1;
+          }
+          opt_buffer_duration = duration_s;
+        } catch (std::invalid_argument& ia) {
+          std::cout << "Invalid argument: -n/--duration "
+                    << std::string(optarg) << std::endl;
+          return -1;
+        } catch (const std::out_of_range& e) {
+          std::cout << "Argument is out of range: -n/--duration "
+                    << std::string(optarg) << std::endl;
+          return -1;
+        }
+        break;
       case 'h':
         DisplayUsage(binary, command);
         return 0;
@@ -434,6 +522,32 @@ int main(int argc, char** argv) {
       record_result = record_result && recorder->Stop() ? true : false;
     }
     return record_result ? 0 : -1;
+  } else if (command == "buffer") {
+    if (opt_white_channels.empty() && !opt_all) {
+      std::cout
+          << "MUST specify channels option (-c) or all channels option (-a)."
+          << std::endl;
+      return -1;
+    }
+    if (opt_output_vec.size() > 1) {
+      std::cout << "TOO many ouput file option (-o)." << std::endl;
+      return -1;
+    }
+    if (opt_output_vec.empty()) {
+      opt_output_vec.push_back("incident");
+    }
+    bool buffer_result = true;
+    ::apollo::cyber::Init(argv[0]);
+    auto record_buffer = std::make_shared<RecordBuffer>(
+        opt_output_vec[0], opt_buffer_duration, opt_all, opt_white_channels);
+    buffer_result = buffer_result && record_buffer->Start() ? true : false;
+    if (buffer_result) {
+      while (!::apollo::cyber::IsShutdown()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+      buffer_result = buffer_result && record_buffer->Stop() ? true : false;
+    }
+    return buffer_result ? 0 : -1;
   } else if (command == "split") {
     if (opt_file_vec.empty()) {
       std::cout << "MUST specify file option (-f)." << std::endl;
@@ -452,6 +566,32 @@ int main(int argc, char** argv) {
                     opt_black_channels, opt_begin, opt_end);
     bool split_result = spliter.Proc();
     return split_result ? 0 : -1;
+  } else if (command == "transform") {
+    if (opt_file_vec.empty()) {
+      std::cout << "MUST specify file option (-f)." << std::endl;
+      return -1;
+    }
+    if (opt_file_vec.size() > 1 || opt_output_vec.size() > 1) {
+      std::cout << "TOO many input/output file option (-f/-o)." << std::endl;
+      return -1;
+    }
+    if (opt_output_vec.empty()) {
+      std::string default_output_file = opt_file_vec[0] + ".transform";
+      opt_output_vec.push_back(default_output_file);
+    }
+    ::apollo::cyber::Init(argv[0]);
+    Transformer::Options options;
+    options.input_file = opt_file_vec[0];
+    options.output_file = opt_output_vec[0];
+    options.white_channels = opt_white_channels;
+    options.black_channels = opt_black_channels;
+    options.begin_time = opt_begin;
+    options.end_time = opt_end;
+    options.chunk_raw_size = opt_chunk_size;
+    options.worker_num = opt_jobs;
+    Transformer transformer(options);
+    bool transform_result = transformer.Proc();
+    return transform_result ? 0 : -1;
   }
 
   // unknown command
@@ -49,6 +49,10 @@ PlayTaskBuffer::TaskPtr PlayTaskBuffer::Front() {
   if (tasks_.empty()) {
     return nullptr;
   }
+  // hold back tasks a slower producer might still undercut in time
+  if (tasks_.begin()->first > MinProgressLocked()) {
+    return nullptr;
+  }
   auto res = tasks_.begin()->second;
   return res;
 }
@@ -60,6 +64,40 @@ void PlayTaskBuffer::PopFront() {
   }
 }
 
+void PlayTaskBuffer::ResetProgress(size_t producer_num) {
+  std::lock_guard<std::mutex> lck(mutex_);
+  progress_.assign(producer_num, 0);
+}
+
+void PlayTaskBuffer::UpdateProgress(size_t producer_idx, uint64_t time_ns) {
+  std::lock_guard<std::mutex> lck(mutex_);
+  if (producer_idx < progress_.size() && progress_[producer_idx] < time_ns) {
+    progress_[producer_idx] = time_ns;
+  }
+}
+
+void PlayTaskBuffer::FinishProducer(size_t producer_idx) {
+  UpdateProgress(producer_idx, UINT64_MAX);
+}
+
+bool PlayTaskBuffer::IsLaggard(size_t producer_idx) const {
+  std::lock_guard<std::mutex> lck(mutex_);
+  if (producer_idx >= progress_.size()) {
+    return false;
+  }
+  return progress_[producer_idx] <= MinProgressLocked();
+}
+
+uint64_t PlayTaskBuffer::MinProgressLocked() const {
+  uint64_t min_progress = UINT64_MAX;
+  for (auto progress : progress_) {
+    if (progress < min_progress) {
+      min_progress = progress;
+    }
+  }
+  return min_progress;
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -21,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cyber/tools/cyber_recorder/player/play_task.h"
 
@@ -44,8 +45,22 @@ class PlayTaskBuffer {
   TaskPtr Front();
   void PopFront();
 
+  // Several producers may fill the buffer concurrently, one per record
+  // file. A task is only released by Front once every unfinished producer
+  // has produced past its play time, so the consumer still sees a single
+  // globally time-ordered stream.
+  void ResetProgress(size_t producer_num);
+  void UpdateProgress(size_t producer_idx, uint64_t time_ns);
+  void FinishProducer(size_t producer_idx);
+  // true if this producer is (one of) the furthest behind, the consumer
+  // may be waiting on it and it must not throttle itself
+  bool IsLaggard(size_t producer_idx) const;
+
  private:
+  uint64_t MinProgressLocked() const;
+
   TaskMap tasks_;
+  std::vector<uint64_t> progress_;
   mutable std::mutex mutex_;
 };
 
@@ -236,36 +236,21 @@ void PlayTaskProducer::ThreadFunc() {
     preload_size = kMinTaskBufferSize;
   }
 
-  auto record_viewer = std::make_shared<RecordViewer>(
-      record_readers_, play_param_.begin_time_ns, play_param_.end_time_ns,
-      play_param_.channels_to_play);
-
   uint32_t loop_num = 0;
   while (!is_stopped_.load()) {
     uint64_t plus_time_ns = loop_num * loop_time_ns;
-    auto itr = record_viewer->begin();
-    auto itr_end = record_viewer->end();
 
-    while (itr != itr_end && !is_stopped_.load()) {
-      while (!is_stopped_.load() && task_buffer_->Size() > preload_size) {
-        std::this_thread::sleep_for(
-            std::chrono::nanoseconds(avg_interval_time_ns));
-      }
-      for (; itr != itr_end && !is_stopped_.load(); ++itr) {
-        if (task_buffer_->Size() > preload_size) {
-          break;
-        }
-
-        auto search = writers_.find(itr->channel_name);
-        if (search == writers_.end()) {
-          continue;
-        }
-
-        auto raw_msg = std::make_shared<message::RawMessage>(itr->content);
-        auto task = std::make_shared<PlayTask>(
-            raw_msg, search->second, itr->time, itr->time + plus_time_ns);
-        task_buffer_->Push(task);
-      }
+    // one worker per record file, so chunk reading and parsing scale
+    // across cores; the watermark in the task buffer keeps the consumer's
+    // output stream in global time order
+    task_buffer_->ResetProgress(record_readers_.size());
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < record_readers_.size(); ++i) {
+      workers.emplace_back(&PlayTaskProducer::ProduceFile, this, i,
+                           plus_time_ns, preload_size, avg_interval_time_ns);
+    }
+    for (auto& worker : workers) {
+      worker.join();
     }
 
     if (!play_param_.is_loop_playback) {
@@ -276,6 +261,40 @@ void PlayTaskProducer::ThreadFunc() {
   }
 }
 
+void PlayTaskProducer::ProduceFile(size_t reader_idx, uint64_t plus_time_ns,
+                                   uint32_t preload_size,
+                                   uint64_t avg_interval_time_ns) {
+  auto record_viewer = std::make_shared<RecordViewer>(
+      record_readers_[reader_idx], play_param_.begin_time_ns,
+      play_param_.end_time_ns, play_param_.channels_to_play);
+
+  auto itr = record_viewer->begin();
+  auto itr_end = record_viewer->end();
+  for (; itr != itr_end && !is_stopped_.load(); ++itr) {
+    // the producer the consumer is waiting on must never throttle itself
+    while (!is_stopped_.load() && task_buffer_->Size() > preload_size &&
+           !task_buffer_->IsLaggard(reader_idx)) {
+      std::this_thread::sleep_for(
+          std::chrono::nanoseconds(avg_interval_time_ns));
+    }
+    if (is_stopped_.load()) {
+      break;
+    }
+
+    task_buffer_->UpdateProgress(reader_idx, itr->time + plus_time_ns);
+    auto search = writers_.find(itr->channel_name);
+    if (search == writers_.end()) {
+      continue;
+    }
+
+    auto raw_msg = std::make_shared<message::RawMessage>(itr->content);
+    auto task = std::make_shared<PlayTask>(raw_msg, search->second, itr->time,
+                                           itr->time + plus_time_ns);
+    task_buffer_->Push(task);
+  }
+  task_buffer_->FinishProducer(reader_idx);
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -64,6 +64,8 @@ class PlayTaskProducer {
   bool UpdatePlayParam();
   bool CreateWriters();
   void ThreadFunc();
+  void ProduceFile(size_t reader_idx, uint64_t plus_time_ns,
+                   uint32_t preload_size, uint64_t avg_interval_time_ns);
 
   PlayParam play_param_;
   TaskBufferPtr task_buffer_;
@@ -0,0 +1,288 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/tools/cyber_recorder/record_buffer.h"
+
+#include <utility>
+
+#include "cyber/common/time_conversion.h"
+#include "cyber/record/header_builder.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+using apollo::cyber::common::UnixSecondsToString;
+using apollo::cyber::service_discovery::ChannelManager;
+using apollo::cyber::service_discovery::TopologyManager;
+
+RecordBuffer::RecordBuffer(const std::string& output_prefix,
+                           uint64_t buffer_duration_sec, bool all_channels,
+                           const std::vector<std::string>& channel_vec)
+    : output_prefix_(output_prefix),
+      buffer_duration_ns_(buffer_duration_sec * 1000000000ULL),
+      all_channels_(all_channels),
+      channel_vec_(channel_vec) {}
+
+RecordBuffer::~RecordBuffer() { Stop(); }
+
+bool RecordBuffer::Start() {
+  std::string node_name =
+      "cyber_recorder_buffer_" + std::to_string(getpid());
+  node_ = ::apollo::cyber::CreateNode(node_name);
+  if (node_ == nullptr) {
+    AERROR << "create node failed, node: " << node_name;
+    return false;
+  }
+  if (!InitReadersImpl()) {
+    AERROR << " _init_readers error.";
+    return false;
+  }
+  std::weak_ptr<RecordBuffer> weak_this = shared_from_this();
+  snapshot_service_ = node_->CreateService<SnapshotRequest, SnapshotResponse>(
+      "/apollo/cyber_recorder/snapshot",
+      [weak_this](const std::shared_ptr<SnapshotRequest>& request,
+                  std::shared_ptr<SnapshotResponse>& response) {
+        auto share_this = weak_this.lock();
+        if (!share_this) {
+          response->set_success(false);
+          return;
+        }
+        std::string file_path;
+        uint64_t message_number = 0;
+        bool success = share_this->Snapshot(request->reason(), &file_path,
+                                            &message_number);
+        response->set_success(success);
+        response->set_file_path(file_path);
+        response->set_message_number(message_number);
+      });
+  if (snapshot_service_ == nullptr) {
+    AERROR << "create snapshot service failed.";
+    return false;
+  }
+  is_started_ = true;
+  AINFO << "record buffer started, buffering the last "
+        << buffer_duration_ns_ / 1000000000ULL << " second(s).";
+  return true;
+}
+
+bool RecordBuffer::Stop() {
+  if (!is_started_ || is_stopping_) {
+    return false;
+  }
+  is_stopping_ = true;
+  if (!FreeReadersImpl()) {
+    AERROR << " _free_readers error.";
+    return false;
+  }
+  snapshot_service_.reset();
+  node_.reset();
+  {
+    std::lock_guard<std::mutex> lg(flush_mutex_);
+    if (flush_thread_.joinable()) {
+      flush_thread_.join();
+    }
+  }
+  is_started_ = false;
+  is_stopping_ = false;
+  return true;
+}
+
+bool RecordBuffer::Snapshot(const std::string& reason, std::string* file_path,
+                            uint64_t* message_number) {
+  *file_path = output_prefix_ + "." +
+               UnixSecondsToString(time(nullptr), "%Y%m%d%H%M%S") + ".record";
+
+  std::deque<proto::SingleMessage> messages;
+  std::unordered_map<std::string, ChannelInfo> channels;
+  {
+    std::lock_guard<std::mutex> lg(buffer_mutex_);
+    messages = buffer_;
+    channels = channel_info_map_;
+  }
+  *message_number = messages.size();
+
+  AINFO << "snapshot triggered (" << reason << "), flushing "
+        << *message_number << " message(s) to " << *file_path;
+
+  std::lock_guard<std::mutex> lg(flush_mutex_);
+  if (flush_thread_.joinable()) {
+    flush_thread_.join();
+  }
+  flush_thread_ =
+      std::thread(&RecordBuffer::WriteSnapshotFile, this, *file_path,
+                  std::move(channels), std::move(messages));
+  return true;
+}
+
+void RecordBuffer::WriteSnapshotFile(
+    const std::string& file_path,
+    const std::unordered_map<std::string, ChannelInfo>& channels,
+    const std::deque<proto::SingleMessage>& messages) {
+  RecordWriter writer(HeaderBuilder::GetHeader());
+  if (!writer.Open(file_path)) {
+    AERROR << "open snapshot file failed, file: " << file_path;
+    return;
+  }
+  for (const auto& channel : channels) {
+    if (!writer.WriteChannel(channel.first, channel.second.message_type,
+                             channel.second.proto_desc)) {
+      AERROR << "write channel fail, channel: " << channel.first;
+    }
+  }
+  for (const auto& message : messages) {
+    if (!writer.WriteMessage(message.channel_name(), message.content(),
+                             message.time())) {
+      AERROR << "write message fail, channel: " << message.channel_name();
+      break;
+    }
+  }
+  writer.Close();
+  AINFO << "snapshot written, file: " << file_path
+        << ", message number: " << messages.size();
+}
+
+void RecordBuffer::TopologyCallback(const ChangeMsg& change_message) {
+  ADEBUG << "ChangeMsg in Topology Callback:" << std::endl
+         << change_message.ShortDebugString();
+  if (change_message.role_type() != apollo::cyber::proto::ROLE_WRITER) {
+    ADEBUG << "Change message role type is not ROLE_WRITER.";
+    return;
+  }
+  FindNewChannel(change_message.role_attr());
+}
+
+void RecordBuffer::FindNewChannel(const RoleAttributes& role_attr) {
+  if (!role_attr.has_channel_name() || role_attr.channel_name().empty()) {
+    AWARN << "change message not has a channel name or has an empty one.";
+    return;
+  }
+  if (!role_attr.has_message_type() || role_attr.message_type().empty()) {
+    AWARN << "Change message not has a message type or has an empty one.";
+    return;
+  }
+  if (!role_attr.has_proto_desc() || role_attr.proto_desc().empty()) {
+    AWARN << "Change message not has a proto desc or has an empty one.";
+    return;
+  }
+  if (!all_channels_ &&
+      std::find(channel_vec_.begin(), channel_vec_.end(),
+                role_attr.channel_name()) == channel_vec_.end()) {
+    ADEBUG << "New channel was found, but not in buffer list.";
+    return;
+  }
+  if (channel_reader_map_.find(role_attr.channel_name()) ==
+      channel_reader_map_.end()) {
+    {
+      std::lock_guard<std::mutex> lg(buffer_mutex_);
+      channel_info_map_[role_attr.channel_name()] = {role_attr.message_type(),
+                                                     role_attr.proto_desc()};
+    }
+    InitReaderImpl(role_attr.channel_name(), role_attr.message_type());
+  }
+}
+
+bool RecordBuffer::InitReadersImpl() {
+  std::shared_ptr<ChannelManager> channel_manager =
+      TopologyManager::Instance()->channel_manager();
+
+  // get historical writers
+  std::vector<proto::RoleAttributes> role_attr_vec;
+  channel_manager->GetWriters(&role_attr_vec);
+  for (auto role_attr : role_attr_vec) {
+    FindNewChannel(role_attr);
+  }
+
+  // listen new writers in future
+  change_conn_ = channel_manager->AddChangeListener(
+      std::bind(&RecordBuffer::TopologyCallback, this, std::placeholders::_1));
+  if (!change_conn_.IsConnected()) {
+    AERROR << "change connection is not connected";
+    return false;
+  }
+  return true;
+}
+
+bool RecordBuffer::FreeReadersImpl() {
+  std::shared_ptr<ChannelManager> channel_manager =
+      TopologyManager::Instance()->channel_manager();
+
+  channel_manager->RemoveChangeListener(change_conn_);
+
+  return true;
+}
+
+bool RecordBuffer::InitReaderImpl(const std::string& channel_name,
+                                  const std::string& message_type) {
+  try {
+    std::weak_ptr<RecordBuffer> weak_this = shared_from_this();
+    std::shared_ptr<ReaderBase> reader = nullptr;
+    auto callback = [weak_this, channel_name](
+                        const std::shared_ptr<RawMessage>& raw_message) {
+      auto share_this = weak_this.lock();
+      if (!share_this) {
+        return;
+      }
+      share_this->ReaderCallback(raw_message, channel_name);
+    };
+    ReaderConfig config;
+    config.channel_name = channel_name;
+    config.pending_queue_size =
+        gflags::Int32FromEnv("CYBER_PENDING_QUEUE_SIZE", 50);
+    reader = node_->CreateReader<RawMessage>(config, callback);
+    if (reader == nullptr) {
+      AERROR << "Create reader failed.";
+      return false;
+    }
+    channel_reader_map_[channel_name] = reader;
+    return true;
+  } catch (const std::bad_weak_ptr& e) {
+    AERROR << e.what();
+    return false;
+  }
+}
+
+void RecordBuffer::ReaderCallback(const std::shared_ptr<RawMessage>& message,
+                                  const std::string& channel_name) {
+  if (!is_started_ || is_stopping_) {
+    AERROR << "record buffer is not started or stopping.";
+    return;
+  }
+
+  if (message == nullptr) {
+    AERROR << "message is nullptr, channel: " << channel_name;
+    return;
+  }
+
+  proto::SingleMessage single_msg;
+  single_msg.set_channel_name(channel_name);
+  single_msg.set_content(message->message);
+  single_msg.set_time(Time::Now().ToNanosecond());
+
+  std::lock_guard<std::mutex> lg(buffer_mutex_);
+  buffer_raw_size_ += single_msg.content().size();
+  const uint64_t now = single_msg.time();
+  buffer_.emplace_back(std::move(single_msg));
+  while (!buffer_.empty() &&
+         buffer_.front().time() + buffer_duration_ns_ < now) {
+    buffer_raw_size_ -= buffer_.front().content().size();
+    buffer_.pop_front();
+  }
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
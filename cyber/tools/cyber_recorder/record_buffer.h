@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TOOLS_CYBER_RECORDER_RECORD_BUFFER_H_
+#define CYBER_TOOLS_CYBER_RECORDER_RECORD_BUFFER_H_
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/base/signal.h"
+#include "cyber/cyber.h"
+#include "cyber/message/raw_message.h"
+#include "cyber/proto/record.pb.h"
+#include "cyber/proto/record_snapshot.pb.h"
+#include "cyber/proto/topology_change.pb.h"
+#include "cyber/record/record_writer.h"
+
+using apollo::cyber::Node;
+using apollo::cyber::ReaderBase;
+using apollo::cyber::Service;
+using apollo::cyber::base::Connection;
+using apollo::cyber::message::RawMessage;
+using apollo::cyber::proto::ChangeMsg;
+using apollo::cyber::proto::RoleAttributes;
+using apollo::cyber::proto::SnapshotRequest;
+using apollo::cyber::proto::SnapshotResponse;
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+/**
+ * @brief Rolling in-memory record buffer for incident capture.
+ *
+ * Keeps the messages of the configured channels for the last N seconds in
+ * memory without touching the disk. On trigger — a call to the snapshot
+ * service or to Snapshot() directly — the buffered window is written to a
+ * record file on a background thread, so a disengagement yields a complete
+ * record of the preceding window with zero steady-state disk I/O.
+ */
+class RecordBuffer : public std::enable_shared_from_this<RecordBuffer> {
+ public:
+  RecordBuffer(const std::string& output_prefix,
+               uint64_t buffer_duration_sec, bool all_channels,
+               const std::vector<std::string>& channel_vec);
+  ~RecordBuffer();
+
+  bool Start();
+  bool Stop();
+
+  /**
+   * @brief Flush the buffered window to a record file.
+   * @param reason trigger reason, logged only
+   * @param file_path output record file the snapshot is written to
+   * @param message_number number of messages in the snapshot
+   * @return true if the flush was scheduled; the file itself is written
+   *         on a background thread
+   */
+  bool Snapshot(const std::string& reason, std::string* file_path,
+                uint64_t* message_number);
+
+ private:
+  struct ChannelInfo {
+    std::string message_type;
+    std::string proto_desc;
+  };
+
+  bool InitReadersImpl();
+  bool FreeReadersImpl();
+  bool InitReaderImpl(const std::string& channel_name,
+                      const std::string& message_type);
+  void TopologyCallback(const ChangeMsg& msg);
+  void ReaderCallback(const std::shared_ptr<RawMessage>& message,
+                      const std::string& channel_name);
+  void FindNewChannel(const RoleAttributes& role_attr);
+  void WriteSnapshotFile(
+      const std::string& file_path,
+      const std::unordered_map<std::string, ChannelInfo>& channels,
+      const std::deque<proto::SingleMessage>& messages);
+
+  bool is_started_ = false;
+  bool is_stopping_ = false;
+  std::shared_ptr<Node> node_ = nullptr;
+  std::shared_ptr<Service<SnapshotRequest, SnapshotResponse>>
+      snapshot_service_ = nullptr;
+  Connection<const ChangeMsg&> change_conn_;
+  std::string output_prefix_;
+  uint64_t buffer_duration_ns_;
+  bool all_channels_ = true;
+  std::vector<std::string> channel_vec_;
+  std::unordered_map<std::string, std::shared_ptr<ReaderBase>>
+      channel_reader_map_;
+
+  // ring buffer of the last N seconds and its channel metadata
+  std::mutex buffer_mutex_;
+  std::deque<proto::SingleMessage> buffer_;
+  uint64_t buffer_raw_size_ = 0;
+  std::unordered_map<std::string, ChannelInfo> channel_info_map_;
+
+  // one in-flight snapshot write at a time
+  std::mutex flush_mutex_;
+  std::thread flush_thread_;
+};
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TOOLS_CYBER_RECORDER_RECORD_BUFFER_H_
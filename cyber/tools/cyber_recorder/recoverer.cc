@@ -17,6 +17,7 @@
 #include "cyber/tools/cyber_recorder/recoverer.h"
 
 #include "cyber/base/for_each.h"
+#include "cyber/record/file/delta_codec.h"
 #include "cyber/record/header_builder.h"
 
 namespace apollo {
@@ -105,6 +106,10 @@ bool Recoverer::Proc() {
           AINFO << "one chunk body section broken, skip it";
           break;
         }
+        // The writer re-chunks with its own boundaries and re-encodes
+        // deltas itself, so copied delta payloads could lose their base;
+        // decode them before re-writing.
+        DecodeChunkDeltas(&cbd);
         for (int idx = 0; idx < cbd.messages_size(); ++idx) {
           if (!writer_.WriteMessage(cbd.messages(idx))) {
             AERROR << "add new message failed.";
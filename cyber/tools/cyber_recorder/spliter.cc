@@ -16,6 +16,8 @@
 
 #include "cyber/tools/cyber_recorder/spliter.h"
 
+#include "cyber/record/file/delta_codec.h"
+
 namespace apollo {
 namespace cyber {
 namespace record {
@@ -125,6 +127,10 @@ bool Spliter::Proc() {
           AERROR << "read chunk body section fail.";
           return false;
         }
+        // The writer re-chunks with its own boundaries and re-encodes
+        // deltas itself, so copied delta payloads could lose their base;
+        // decode them before re-writing.
+        DecodeChunkDeltas(&cbd);
         for (int idx = 0; idx < cbd.messages_size(); ++idx) {
           if (!white_channels_.empty() &&
               std::find(white_channels_.begin(), white_channels_.end(),
@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/tools/cyber_recorder/transformer.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "cyber/record/file/delta_codec.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+Transformer::Transformer(const Options& options) : options_(options) {}
+
+Transformer::~Transformer() {}
+
+bool Transformer::KeepChannel(const std::string& channel_name) const {
+  if (!options_.white_channels.empty() &&
+      std::find(options_.white_channels.begin(),
+                options_.white_channels.end(),
+                channel_name) == options_.white_channels.end()) {
+    return false;
+  }
+  return std::find(options_.black_channels.begin(),
+                   options_.black_channels.end(),
+                   channel_name) == options_.black_channels.end();
+}
+
+bool Transformer::Proc() {
+  // check params
+  if (options_.begin_time >= options_.end_time) {
+    AERROR << "begin time larger or equal than end time, begin_time: "
+           << options_.begin_time << ", end_time: " << options_.end_time;
+    return false;
+  }
+  for (const auto& channel_name : options_.white_channels) {
+    if (std::find(options_.black_channels.begin(),
+                  options_.black_channels.end(),
+                  channel_name) != options_.black_channels.end()) {
+      AERROR << "find channel in both of white list and black list, channel: "
+             << channel_name;
+      return false;
+    }
+  }
+
+  AINFO << "transform record file started.";
+
+  // open input file
+  if (!reader_.Open(options_.input_file)) {
+    AERROR << "open input file failed, file: " << options_.input_file;
+    return false;
+  }
+  Header header = reader_.GetHeader();
+  if (options_.begin_time > header.end_time() ||
+      options_.end_time < header.begin_time()) {
+    AERROR << "time range " << options_.begin_time << " to "
+           << options_.end_time << " is not include in this record file.";
+    return false;
+  }
+
+  // open output file; the writer re-chunks and rebuilds the index itself
+  Header new_hdr = HeaderBuilder::GetHeader();
+  if (options_.chunk_raw_size > 0) {
+    new_hdr.set_chunk_raw_size(options_.chunk_raw_size);
+  }
+  if (!writer_.Open(options_.output_file)) {
+    AERROR << "open output file failed. file: " << options_.output_file;
+    return false;
+  }
+  if (!writer_.WriteHeader(new_hdr)) {
+    AERROR << "write header to output file failed. file: "
+           << options_.output_file;
+    return false;
+  }
+
+  uint32_t worker_num = options_.worker_num;
+  if (worker_num == 0) {
+    worker_num = std::thread::hardware_concurrency();
+    if (worker_num < 1) {
+      worker_num = 1;
+    }
+  }
+  const size_t max_pending = worker_num * 2;
+  for (uint32_t i = 0; i < worker_num; ++i) {
+    workers_.emplace_back([this]() { this->Work(); });
+  }
+
+  // read through record file
+  bool ok = true;
+  bool skip_next_chunk_body = false;
+  reader_.Reset();
+  while (ok && !reader_.EndOfFile()) {
+    Section section;
+    if (!reader_.ReadSection(&section)) {
+      AERROR << "read section failed.";
+      ok = false;
+      break;
+    }
+    if (section.type == SectionType::SECTION_INDEX) {
+      break;
+    }
+    switch (section.type) {
+      case SectionType::SECTION_CHANNEL: {
+        Channel chan;
+        if (!reader_.ReadSection<Channel>(section.size, &chan)) {
+          AERROR << "read channel section fail.";
+          ok = false;
+          break;
+        }
+        if (KeepChannel(chan.name())) {
+          writer_.WriteChannel(chan);
+        }
+        break;
+      }
+      case SectionType::SECTION_CHUNK_HEADER: {
+        ChunkHeader chdr;
+        if (!reader_.ReadSection<ChunkHeader>(section.size, &chdr)) {
+          AERROR << "read chunk header section fail.";
+          ok = false;
+          break;
+        }
+        if (options_.begin_time > chdr.end_time() ||
+            options_.end_time < chdr.begin_time()) {
+          skip_next_chunk_body = true;
+        }
+        break;
+      }
+      case SectionType::SECTION_CHUNK_BODY: {
+        if (skip_next_chunk_body) {
+          reader_.SkipSection(section.size);
+          skip_next_chunk_body = false;
+          break;
+        }
+        auto task = std::make_shared<ChunkTask>();
+        if (!reader_.ReadSectionRaw(section.size, &task->raw_body)) {
+          AERROR << "read chunk body section fail.";
+          ok = false;
+          break;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        // bounded queue: commit finished chunks, or wait for the workers
+        while (task_queue_.size() >= max_pending) {
+          if (task_queue_.front()->done_.load()) {
+            if (!CommitFinishedTasks(&lock)) {
+              ok = false;
+              break;
+            }
+          } else {
+            cv_.wait(lock);
+          }
+        }
+        if (!ok) {
+          break;
+        }
+        task_queue_.emplace_back(task);
+        cv_.notify_all();
+        if (!CommitFinishedTasks(&lock)) {
+          ok = false;
+        }
+        break;
+      }
+      default: {
+        AERROR << "this section should not be here, section type: "
+               << section.type;
+        break;
+      }
+    }
+  }
+
+  // commit whatever is still in flight, strictly in submission order
+  if (ok) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (ok && !task_queue_.empty()) {
+      if (task_queue_.front()->done_.load()) {
+        ok = CommitFinishedTasks(&lock);
+      } else {
+        cv_.wait(lock);
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reading_done_ = true;
+    task_queue_.clear();
+    cv_.notify_all();
+  }
+  for (auto& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  workers_.clear();
+
+  writer_.Close();
+  reader_.Close();
+  if (ok) {
+    AINFO << "transform record file done.";
+  }
+  return ok;
+}
+
+std::shared_ptr<Transformer::ChunkTask> Transformer::NextUnclaimedTask() {
+  for (auto& task : task_queue_) {
+    if (!task->claimed_.load()) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+// Writes the messages of every finished task at the queue front. Expects
+// lock held; releases it while writing so the workers keep parsing.
+bool Transformer::CommitFinishedTasks(std::unique_lock<std::mutex>* lock) {
+  while (!task_queue_.empty() && task_queue_.front()->done_.load()) {
+    std::shared_ptr<ChunkTask> task = task_queue_.front();
+    task_queue_.pop_front();
+    cv_.notify_all();
+    lock->unlock();
+    bool write_ok = !task->failed;
+    for (const auto& message : task->messages) {
+      if (!writer_.WriteMessage(message)) {
+        AERROR << "add new message failed.";
+        write_ok = false;
+        break;
+      }
+    }
+    lock->lock();
+    if (!write_ok) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Transformer::Work() {
+  while (true) {
+    std::shared_ptr<ChunkTask> task = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this, &task] {
+        task = NextUnclaimedTask();
+        return task != nullptr || reading_done_;
+      });
+      if (task == nullptr) {
+        break;
+      }
+      task->claimed_.store(true);
+    }
+    // the heavy part runs outside the lock, so workers transform in parallel
+    ChunkBody body;
+    if (!body.ParseFromString(task->raw_body)) {
+      AERROR << "parse chunk body failed.";
+      task->failed = true;
+    } else {
+      task->raw_body.clear();
+      // reconstruct delta payloads; chains never cross chunk boundaries
+      std::unordered_map<std::string, int> last_index;
+      for (int i = 0; i < body.messages_size(); ++i) {
+        auto* message = body.mutable_messages(i);
+        if (message->content_delta()) {
+          const auto it = last_index.find(message->channel_name());
+          if (it == last_index.end()) {
+            AERROR << "Delta message without a base in chunk, channel: "
+                   << message->channel_name();
+            task->failed = true;
+          } else {
+            DeltaXor(body.messages(it->second).content(),
+                     message->mutable_content());
+          }
+          message->clear_content_delta();
+        }
+        last_index[message->channel_name()] = i;
+      }
+      for (int i = 0; i < body.messages_size(); ++i) {
+        const auto& message = body.messages(i);
+        if (!KeepChannel(message.channel_name())) {
+          continue;
+        }
+        if (message.time() < options_.begin_time ||
+            message.time() > options_.end_time) {
+          continue;
+        }
+        task->messages.emplace_back(std::move(*body.mutable_messages(i)));
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task->done_.store(true);
+      cv_.notify_all();
+    }
+  }
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
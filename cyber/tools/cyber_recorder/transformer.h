@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TOOLS_CYBER_RECORDER_TRANSFORMER_H_
+#define CYBER_TOOLS_CYBER_RECORDER_TRANSFORMER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/common/log.h"
+#include "cyber/proto/record.pb.h"
+#include "cyber/record/file/record_file_reader.h"
+#include "cyber/record/file/record_file_writer.h"
+#include "cyber/record/header_builder.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+// Multi-threaded record transform: channel filtering, time-range cutting
+// and re-chunking in one streaming pass. The reader thread walks the input
+// sections sequentially and hands each chunk body to a pool of workers as
+// raw bytes; workers parse, reconstruct delta payloads and filter in
+// parallel, and the filtered messages are committed to the output writer
+// strictly in submission order. The pending queue is bounded, so memory
+// stays at a few chunks regardless of record size.
+class Transformer {
+ public:
+  struct Options {
+    std::string input_file;
+    std::string output_file;
+    std::vector<std::string> white_channels;
+    std::vector<std::string> black_channels;
+    uint64_t begin_time = 0;
+    uint64_t end_time = UINT64_MAX;
+    // Chunk size of the output file, so extractions can re-chunk for
+    // their target consumer. 0 keeps the default.
+    uint64_t chunk_raw_size = 0;
+    // Number of chunk workers, 0 picks from hardware concurrency.
+    uint32_t worker_num = 0;
+  };
+
+  explicit Transformer(const Options& options);
+  virtual ~Transformer();
+  bool Proc();
+
+ private:
+  // One chunk moving through the transform pipeline, mirroring the claim /
+  // done stages of the writer's flush queue.
+  struct ChunkTask {
+    std::string raw_body;
+    std::vector<proto::SingleMessage> messages;
+    std::atomic<bool> claimed_ = {false};
+    std::atomic<bool> done_ = {false};
+    bool failed = false;
+  };
+
+  bool KeepChannel(const std::string& channel_name) const;
+  void Work();
+  std::shared_ptr<ChunkTask> NextUnclaimedTask();
+  bool CommitFinishedTasks(std::unique_lock<std::mutex>* lock);
+
+  Options options_;
+  RecordFileReader reader_;
+  RecordFileWriter writer_;
+  std::deque<std::shared_ptr<ChunkTask>> task_queue_;
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool reading_done_ = false;
+};
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TOOLS_CYBER_RECORDER_TRANSFORMER_H_
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/bridge/batch_decoder.h"
+
+#include <cstring>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+bool BatchDecoder::Receive(const char* data, std::size_t size) {
+  BridgeFrameHeader header;
+  std::string payload;
+  if (!UnpackFrame(data, size, &header, &payload)) {
+    AWARN << "drop malformed bridge frame of " << size << " bytes";
+    return false;
+  }
+  if (header.frame_count == 0 ||
+      (header.flags & BRIDGE_FLAG_PARITY
+           ? header.frame_index != header.frame_count
+           : header.frame_index >= header.frame_count)) {
+    AWARN << "drop bridge frame with invalid index "
+          << header.frame_index << "/" << header.frame_count;
+    return false;
+  }
+
+  auto& groups = channel_groups_[header.channel_id];
+  auto iter = groups.find(header.group_seq);
+  if (iter == groups.end()) {
+    iter = groups.emplace(header.group_seq, Group()).first;
+    iter->second.frame_count = header.frame_count;
+    iter->second.size_xor = header.size_xor;
+    iter->second.payloads.resize(header.frame_count);
+    iter->second.received.resize(header.frame_count, false);
+  }
+  Group* group = &iter->second;
+  if (group->delivered) {
+    // late duplicate or parity of an already delivered group
+    return true;
+  }
+  if (group->frame_count != header.frame_count) {
+    AWARN << "drop bridge frame with inconsistent group size";
+    return false;
+  }
+
+  if (header.flags & BRIDGE_FLAG_PARITY) {
+    group->parity = payload;
+    group->has_parity = true;
+  } else if (!group->received[header.frame_index]) {
+    group->payloads[header.frame_index] = payload;
+    group->received[header.frame_index] = true;
+    ++group->received_count;
+  }
+
+  if (TryDeliver(header.channel_id, header.group_seq, group)) {
+    // keep the delivered marker so stragglers of the group are ignored
+    group->delivered = true;
+    group->payloads.clear();
+    group->parity.clear();
+  }
+  if (groups.size() > kMaxPendingGroups) {
+    // drop the oldest group to bound the reassembly state
+    groups.erase(groups.begin());
+  }
+  return true;
+}
+
+bool BatchDecoder::TryDeliver(uint64_t channel_id, uint32_t group_seq,
+                              Group* group) {
+  if (group->received_count == group->frame_count) {
+    DeliverPayloads(channel_id, *group);
+    return true;
+  }
+  if (group->received_count + 1 != group->frame_count ||
+      !group->has_parity) {
+    return false;
+  }
+
+  // rebuild the single missing frame from the xor parity
+  std::size_t missing = 0;
+  uint32_t missing_size = group->size_xor;
+  std::string rebuilt = group->parity;
+  for (std::size_t i = 0; i < group->frame_count; ++i) {
+    if (!group->received[i]) {
+      missing = i;
+      continue;
+    }
+    const auto& payload = group->payloads[i];
+    missing_size ^= static_cast<uint32_t>(payload.size());
+    for (std::size_t j = 0; j < payload.size(); ++j) {
+      rebuilt[j] = static_cast<char>(rebuilt[j] ^ payload[j]);
+    }
+  }
+  if (missing_size > rebuilt.size()) {
+    AWARN << "fec recovery failed for group " << group_seq;
+    return false;
+  }
+  rebuilt.resize(missing_size);
+  group->payloads[missing] = rebuilt;
+  ADEBUG << "rebuilt lost frame " << missing << " of group " << group_seq
+         << " from parity";
+  DeliverPayloads(channel_id, *group);
+  return true;
+}
+
+void BatchDecoder::DeliverPayloads(uint64_t channel_id, const Group& group) {
+  if (callback_ == nullptr) {
+    return;
+  }
+  std::string stream;
+  for (const auto& payload : group.payloads) {
+    stream.append(payload);
+  }
+  std::size_t offset = 0;
+  while (offset + sizeof(uint32_t) <= stream.size()) {
+    uint32_t size = 0;
+    std::memcpy(&size, stream.data() + offset, sizeof(size));
+    offset += sizeof(size);
+    if (offset + size > stream.size()) {
+      AWARN << "truncated message in bridge group, drop the tail";
+      return;
+    }
+    callback_(channel_id, stream.substr(offset, size));
+    offset += size;
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
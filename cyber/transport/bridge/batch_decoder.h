@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_BRIDGE_BATCH_DECODER_H_
+#define CYBER_TRANSPORT_BRIDGE_BATCH_DECODER_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/transport/bridge/bridge_frame.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// Reassembles bridge frames back into messages. A group is delivered once
+// all data frames arrived, or once all but one arrived and the parity
+// frame allows rebuilding the missing one. Stale incomplete groups are
+// discarded so sustained loss cannot grow the reassembly state.
+class BatchDecoder {
+ public:
+  using MessageCallback =
+      std::function<void(uint64_t channel_id, const std::string& message)>;
+
+  BatchDecoder() = default;
+
+  void SetMessageCallback(const MessageCallback& callback) {
+    callback_ = callback;
+  }
+
+  // @brief: feed one received datagram.
+  bool Receive(const char* data, std::size_t size);
+
+  static const std::size_t kMaxPendingGroups = 8;
+
+ private:
+  struct Group {
+    std::vector<std::string> payloads;
+    std::vector<bool> received;
+    std::string parity;
+    uint32_t size_xor = 0;
+    uint16_t frame_count = 0;
+    std::size_t received_count = 0;
+    bool has_parity = false;
+    bool delivered = false;
+  };
+
+  bool TryDeliver(uint64_t channel_id, uint32_t group_seq, Group* group);
+  void DeliverPayloads(uint64_t channel_id, const Group& group);
+
+  std::unordered_map<uint64_t, std::map<uint32_t, Group>> channel_groups_;
+  MessageCallback callback_;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_BRIDGE_BATCH_DECODER_H_
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/bridge/batch_encoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+BatchEncoder::BatchEncoder(uint64_t channel_id, std::size_t mtu,
+                           bool enable_fec)
+    : channel_id_(channel_id),
+      payload_capacity_(mtu > BRIDGE_HEADER_SIZE ? mtu - BRIDGE_HEADER_SIZE
+                                                 : 0),
+      enable_fec_(enable_fec) {
+  if (payload_capacity_ == 0) {
+    AERROR << "mtu " << mtu << " too small for bridge header";
+  }
+}
+
+bool BatchEncoder::Add(const std::string& message) {
+  if (payload_capacity_ == 0 || callback_ == nullptr) {
+    return false;
+  }
+  const std::size_t needed = sizeof(uint32_t) + message.size();
+  if (needed > kMaxGroupFrames * payload_capacity_) {
+    AERROR << "message of " << message.size()
+           << " bytes exceeds the fec group capacity";
+    return false;
+  }
+  const std::size_t remaining =
+      (kMaxGroupFrames - group_payloads_.size()) * payload_capacity_ -
+      payload_.size();
+  if (needed > remaining) {
+    // a group must end on a message boundary
+    Flush();
+  }
+  const uint32_t size = static_cast<uint32_t>(message.size());
+  std::string data(reinterpret_cast<const char*>(&size), sizeof(size));
+  data.append(message);
+  std::size_t offset = 0;
+  while (offset < data.size()) {
+    const std::size_t space = payload_capacity_ - payload_.size();
+    const std::size_t chunk = std::min(space, data.size() - offset);
+    payload_.append(data, offset, chunk);
+    offset += chunk;
+    if (payload_.size() == payload_capacity_) {
+      group_payloads_.emplace_back(std::move(payload_));
+      payload_.clear();
+    }
+  }
+  return true;
+}
+
+void BatchEncoder::Flush() {
+  if (!payload_.empty()) {
+    group_payloads_.emplace_back(std::move(payload_));
+    payload_.clear();
+  }
+  if (group_payloads_.empty()) {
+    return;
+  }
+
+  uint32_t size_xor = 0;
+  for (const auto& payload : group_payloads_) {
+    size_xor ^= static_cast<uint32_t>(payload.size());
+  }
+
+  BridgeFrameHeader header;
+  std::memset(&header, 0, sizeof(header));
+  header.magic = BRIDGE_MAGIC;
+  header.channel_id = channel_id_;
+  header.group_seq = group_seq_;
+  header.size_xor = size_xor;
+  header.frame_count = static_cast<uint16_t>(group_payloads_.size());
+  for (std::size_t i = 0; i < group_payloads_.size(); ++i) {
+    header.frame_index = static_cast<uint16_t>(i);
+    header.payload_size = static_cast<uint32_t>(group_payloads_[i].size());
+    header.flags = 0;
+    callback_(PackFrame(header, group_payloads_[i]));
+  }
+  if (enable_fec_) {
+    EmitParity();
+  }
+  group_payloads_.clear();
+  ++group_seq_;
+}
+
+void BatchEncoder::EmitParity() {
+  std::size_t parity_size = 0;
+  for (const auto& payload : group_payloads_) {
+    parity_size = std::max(parity_size, payload.size());
+  }
+  std::string parity(parity_size, '\0');
+  uint32_t size_xor = 0;
+  for (const auto& payload : group_payloads_) {
+    size_xor ^= static_cast<uint32_t>(payload.size());
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+      parity[i] = static_cast<char>(parity[i] ^ payload[i]);
+    }
+  }
+
+  BridgeFrameHeader header;
+  std::memset(&header, 0, sizeof(header));
+  header.magic = BRIDGE_MAGIC;
+  header.channel_id = channel_id_;
+  header.group_seq = group_seq_;
+  header.size_xor = size_xor;
+  header.frame_index = static_cast<uint16_t>(group_payloads_.size());
+  header.frame_count = static_cast<uint16_t>(group_payloads_.size());
+  header.flags = BRIDGE_FLAG_PARITY;
+  header.payload_size = static_cast<uint32_t>(parity.size());
+  callback_(PackFrame(header, parity));
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_BRIDGE_BATCH_ENCODER_H_
+#define CYBER_TRANSPORT_BRIDGE_BATCH_ENCODER_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "cyber/transport/bridge/bridge_frame.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// Packs serialized messages of one channel into bridge frames. Small
+// messages are batched until a frame reaches the mtu, large messages span
+// several frames of one fec group; a group always ends on a message
+// boundary so a lost group never desynchronizes the stream. With fec
+// enabled every flushed group is followed by one xor parity frame.
+class BatchEncoder {
+ public:
+  using FrameCallback = std::function<void(const std::string& frame)>;
+
+  BatchEncoder(uint64_t channel_id, std::size_t mtu, bool enable_fec);
+
+  void SetFrameCallback(const FrameCallback& callback) {
+    callback_ = callback;
+  }
+
+  // @brief: queue one serialized message, emitting full frames on the way.
+  bool Add(const std::string& message);
+
+  // @brief: emit the pending partial frame and close the fec group.
+  void Flush();
+
+  std::size_t PayloadCapacity() const { return payload_capacity_; }
+  static const uint16_t kMaxGroupFrames = 255;
+
+ private:
+  void EmitParity();
+
+  uint64_t channel_id_;
+  std::size_t payload_capacity_;
+  bool enable_fec_;
+  uint32_t group_seq_ = 0;
+  uint16_t frame_index_ = 0;
+  std::string payload_;
+  std::vector<std::string> group_payloads_;
+  FrameCallback callback_;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_BRIDGE_BATCH_ENCODER_H_
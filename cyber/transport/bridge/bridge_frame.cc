@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/bridge/bridge_frame.h"
+
+#include <cstring>
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+std::string PackFrame(const BridgeFrameHeader& header,
+                      const std::string& payload) {
+  std::string frame;
+  frame.resize(BRIDGE_HEADER_SIZE + payload.size());
+  std::memcpy(&frame[0], &header, BRIDGE_HEADER_SIZE);
+  if (!payload.empty()) {
+    std::memcpy(&frame[BRIDGE_HEADER_SIZE], payload.data(), payload.size());
+  }
+  return frame;
+}
+
+bool UnpackFrame(const char* data, std::size_t size,
+                 BridgeFrameHeader* header, std::string* payload) {
+  if (data == nullptr || header == nullptr || payload == nullptr) {
+    return false;
+  }
+  if (size < BRIDGE_HEADER_SIZE) {
+    return false;
+  }
+  std::memcpy(header, data, BRIDGE_HEADER_SIZE);
+  if (header->magic != BRIDGE_MAGIC) {
+    return false;
+  }
+  if (size != BRIDGE_HEADER_SIZE + header->payload_size) {
+    return false;
+  }
+  payload->assign(data + BRIDGE_HEADER_SIZE, header->payload_size);
+  return true;
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
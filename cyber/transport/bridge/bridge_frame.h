@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_BRIDGE_BRIDGE_FRAME_H_
+#define CYBER_TRANSPORT_BRIDGE_BRIDGE_FRAME_H_
+
+#include <cstdint>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// Wire format of one bridge datagram: BridgeFrameHeader followed by
+// payload_size bytes of payload. Frames of one fec group share group_seq;
+// the optional parity frame carries BRIDGE_FLAG_PARITY and the xor of all
+// data payloads, so any single lost frame of the group can be rebuilt
+// without retransmission. The header is copied as raw bytes; both ends of
+// the vehicle-to-bench link are little endian x86, so no byte swapping is
+// done.
+struct BridgeFrameHeader {
+  uint32_t magic;
+  uint32_t payload_size;
+  uint64_t channel_id;
+  uint32_t group_seq;
+  uint32_t size_xor;  // xor of the data payload sizes of the group
+  uint16_t frame_index;
+  uint16_t frame_count;  // number of data frames in the group
+  uint16_t flags;
+  uint16_t reserved;
+};
+
+const uint32_t BRIDGE_MAGIC = 0x42524447;  // "BRDG"
+const uint16_t BRIDGE_FLAG_PARITY = 0x0001;
+const std::size_t BRIDGE_HEADER_SIZE = sizeof(BridgeFrameHeader);
+
+std::string PackFrame(const BridgeFrameHeader& header,
+                      const std::string& payload);
+bool UnpackFrame(const char* data, std::size_t size,
+                 BridgeFrameHeader* header, std::string* payload);
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_BRIDGE_BRIDGE_FRAME_H_
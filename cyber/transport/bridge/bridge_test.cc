@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/transport/bridge/batch_decoder.h"
+#include "cyber/transport/bridge/batch_encoder.h"
+#include "cyber/transport/bridge/token_bucket.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+namespace {
+
+const uint64_t kChannelId = 12345;
+const std::size_t kMtu = 128;
+
+class BridgeLoop {
+ public:
+  explicit BridgeLoop(bool enable_fec)
+      : encoder_(kChannelId, kMtu, enable_fec) {
+    encoder_.SetFrameCallback(
+        [this](const std::string& frame) { frames_.push_back(frame); });
+  }
+
+  // deliver all captured frames to a fresh decoder, optionally dropping one
+  void Deliver(int drop_index = -1) {
+    BatchDecoder decoder;
+    decoder.SetMessageCallback(
+        [this](uint64_t channel_id, const std::string& message) {
+          EXPECT_EQ(kChannelId, channel_id);
+          messages_.push_back(message);
+        });
+    for (std::size_t i = 0; i < frames_.size(); ++i) {
+      if (static_cast<int>(i) == drop_index) {
+        continue;
+      }
+      decoder.Receive(frames_[i].data(), frames_[i].size());
+    }
+  }
+
+  BatchEncoder encoder_;
+  std::vector<std::string> frames_;
+  std::vector<std::string> messages_;
+};
+
+}  // namespace
+
+TEST(BridgeTest, batch_small_messages) {
+  BridgeLoop loop(false);
+  EXPECT_TRUE(loop.encoder_.Add("hello"));
+  EXPECT_TRUE(loop.encoder_.Add("bridge"));
+  EXPECT_TRUE(loop.encoder_.Add("world"));
+  EXPECT_TRUE(loop.frames_.empty());
+  loop.encoder_.Flush();
+  // three small messages share one frame
+  ASSERT_EQ(1, loop.frames_.size());
+  loop.Deliver();
+  ASSERT_EQ(3, loop.messages_.size());
+  EXPECT_EQ("hello", loop.messages_[0]);
+  EXPECT_EQ("bridge", loop.messages_[1]);
+  EXPECT_EQ("world", loop.messages_[2]);
+}
+
+TEST(BridgeTest, large_message_spans_frames) {
+  BridgeLoop loop(false);
+  std::string large(1000, 'x');
+  large[0] = 'a';
+  large[999] = 'z';
+  EXPECT_TRUE(loop.encoder_.Add(large));
+  loop.encoder_.Flush();
+  EXPECT_GT(loop.frames_.size(), 1);
+  loop.Deliver();
+  ASSERT_EQ(1, loop.messages_.size());
+  EXPECT_EQ(large, loop.messages_[0]);
+}
+
+TEST(BridgeTest, fec_recovers_single_loss) {
+  BridgeLoop loop(true);
+  std::string large(1000, 'y');
+  EXPECT_TRUE(loop.encoder_.Add(large));
+  EXPECT_TRUE(loop.encoder_.Add("trailer"));
+  loop.encoder_.Flush();
+  // data frames plus one parity frame
+  ASSERT_GT(loop.frames_.size(), 2);
+  // every single data frame is recoverable
+  for (std::size_t drop = 0; drop + 1 < loop.frames_.size(); ++drop) {
+    loop.messages_.clear();
+    loop.Deliver(static_cast<int>(drop));
+    ASSERT_EQ(2, loop.messages_.size());
+    EXPECT_EQ(large, loop.messages_[0]);
+    EXPECT_EQ("trailer", loop.messages_[1]);
+  }
+}
+
+TEST(BridgeTest, loss_without_fec_drops_group) {
+  BridgeLoop loop(false);
+  std::string large(1000, 'y');
+  EXPECT_TRUE(loop.encoder_.Add(large));
+  loop.encoder_.Flush();
+  ASSERT_GT(loop.frames_.size(), 1);
+  loop.Deliver(0);
+  EXPECT_TRUE(loop.messages_.empty());
+}
+
+TEST(BridgeTest, token_bucket_shaping) {
+  // 1000 bytes per second, 500 bytes burst
+  TokenBucket bucket(1000, 500);
+  uint64_t now = 1000000000ULL;
+  EXPECT_TRUE(bucket.Consume(400, now));
+  EXPECT_FALSE(bucket.Consume(400, now));
+  // after 300ms another 300 bytes are available
+  now += 300000000ULL;
+  EXPECT_TRUE(bucket.Consume(400, now));
+  EXPECT_FALSE(bucket.Consume(1, now));
+
+  TokenBucket unshaped(0, 0);
+  EXPECT_TRUE(unshaped.Consume(1000000, now));
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
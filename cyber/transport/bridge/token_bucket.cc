@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/bridge/token_bucket.h"
+
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+TokenBucket::TokenBucket(uint64_t bytes_per_second, uint64_t burst_bytes)
+    : bytes_per_second_(bytes_per_second),
+      burst_bytes_(burst_bytes),
+      tokens_(static_cast<double>(burst_bytes)) {}
+
+bool TokenBucket::Consume(uint64_t bytes) {
+  return Consume(bytes, Time::MonoTime().ToNanosecond());
+}
+
+bool TokenBucket::Consume(uint64_t bytes, uint64_t now_ns) {
+  if (bytes_per_second_ == 0) {
+    // unshaped
+    return true;
+  }
+  if (now_ns > last_refill_ns_) {
+    const double elapsed_sec =
+        static_cast<double>(now_ns - last_refill_ns_) * 1e-9;
+    tokens_ += elapsed_sec * static_cast<double>(bytes_per_second_);
+    if (tokens_ > static_cast<double>(burst_bytes_)) {
+      tokens_ = static_cast<double>(burst_bytes_);
+    }
+    last_refill_ns_ = now_ns;
+  }
+  if (tokens_ < static_cast<double>(bytes)) {
+    return false;
+  }
+  tokens_ -= static_cast<double>(bytes);
+  return true;
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
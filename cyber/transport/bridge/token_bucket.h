@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_BRIDGE_TOKEN_BUCKET_H_
+#define CYBER_TRANSPORT_BRIDGE_TOKEN_BUCKET_H_
+
+#include <cstdint>
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// Byte based token bucket used for per-channel bandwidth shaping on the
+// bridge link. Consume() never blocks; a frame that finds the bucket
+// empty is dropped by the caller, which is the desired behavior for the
+// loss-tolerant channels the bridge carries.
+class TokenBucket {
+ public:
+  TokenBucket(uint64_t bytes_per_second, uint64_t burst_bytes);
+
+  // @brief: take bytes from the bucket, refilled from the mono clock.
+  bool Consume(uint64_t bytes);
+
+  // @brief: same with an explicit timestamp, for tests.
+  bool Consume(uint64_t bytes, uint64_t now_ns);
+
+ private:
+  uint64_t bytes_per_second_;
+  uint64_t burst_bytes_;
+  double tokens_;
+  uint64_t last_refill_ns_ = 0;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_BRIDGE_TOKEN_BUCKET_H_
@@ -0,0 +1,190 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/bridge/udp_bridge.h"
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+UdpBridgeSender::~UdpBridgeSender() { Shutdown(); }
+
+bool UdpBridgeSender::Init(const std::string& remote_ip, uint16_t port,
+                           std::size_t mtu) {
+  if (mtu <= BRIDGE_HEADER_SIZE) {
+    AERROR << "mtu " << mtu << " too small for bridge header";
+    return false;
+  }
+  fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd_ == -1) {
+    AERROR << "create udp bridge socket failed";
+    return false;
+  }
+  std::memset(&remote_addr_, 0, sizeof(remote_addr_));
+  remote_addr_.sin_family = AF_INET;
+  remote_addr_.sin_addr.s_addr = inet_addr(remote_ip.c_str());
+  remote_addr_.sin_port = htons(port);
+  mtu_ = mtu;
+  return true;
+}
+
+void UdpBridgeSender::SetChannelAttr(uint64_t channel_id,
+                                     const BridgeChannelAttr& attr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  attrs_[channel_id] = attr;
+  // a state created before the attr was set is rebuilt on next use
+  channels_.erase(channel_id);
+}
+
+UdpBridgeSender::ChannelState* UdpBridgeSender::GetChannelState(
+    uint64_t channel_id) {
+  auto iter = channels_.find(channel_id);
+  if (iter != channels_.end()) {
+    return &iter->second;
+  }
+  BridgeChannelAttr attr;
+  auto attr_iter = attrs_.find(channel_id);
+  if (attr_iter != attrs_.end()) {
+    attr = attr_iter->second;
+  }
+  ChannelState state;
+  state.encoder.reset(new BatchEncoder(channel_id, mtu_, attr.enable_fec));
+  state.shaper.reset(
+      new TokenBucket(attr.bandwidth_bps / 8, attr.burst_bytes));
+  auto* inserted = &channels_[channel_id];
+  *inserted = std::move(state);
+  inserted->encoder->SetFrameCallback(
+      [this, inserted](const std::string& frame) {
+        SendFrame(inserted, frame);
+      });
+  return inserted;
+}
+
+bool UdpBridgeSender::Send(uint64_t channel_id, const std::string& message) {
+  if (fd_ == -1) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  return GetChannelState(channel_id)->encoder->Add(message);
+}
+
+void UdpBridgeSender::Flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& item : channels_) {
+    item.second.encoder->Flush();
+  }
+}
+
+void UdpBridgeSender::SendFrame(ChannelState* state,
+                                const std::string& frame) {
+  if (!state->shaper->Consume(frame.size())) {
+    const uint64_t dropped = dropped_frames_.fetch_add(1) + 1;
+    if (dropped % 256 == 1) {
+      AWARN << "bridge shaper dropped " << dropped << " frames so far";
+    }
+    return;
+  }
+  const ssize_t sent =
+      sendto(fd_, frame.data(), frame.size(), 0,
+             reinterpret_cast<struct sockaddr*>(&remote_addr_),
+             sizeof(remote_addr_));
+  if (sent < 0) {
+    AWARN << "bridge sendto failed, errno: " << errno;
+  }
+}
+
+void UdpBridgeSender::Shutdown() {
+  if (fd_ != -1) {
+    close(fd_);
+    fd_ = -1;
+  }
+}
+
+UdpBridgeReceiver::~UdpBridgeReceiver() { Shutdown(); }
+
+bool UdpBridgeReceiver::Init(uint16_t port) {
+  fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd_ == -1) {
+    AERROR << "create udp bridge socket failed";
+    return false;
+  }
+  struct sockaddr_in local_addr;
+  std::memset(&local_addr, 0, sizeof(local_addr));
+  local_addr.sin_family = AF_INET;
+  local_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  local_addr.sin_port = htons(port);
+  if (bind(fd_, reinterpret_cast<struct sockaddr*>(&local_addr),
+           sizeof(local_addr)) < 0) {
+    AERROR << "bind udp bridge port " << port << " failed";
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  return true;
+}
+
+void UdpBridgeReceiver::SetMessageCallback(const MessageCallback& callback) {
+  decoder_.SetMessageCallback(callback);
+}
+
+bool UdpBridgeReceiver::Start() {
+  if (fd_ == -1) {
+    return false;
+  }
+  thread_ = std::thread(&UdpBridgeReceiver::RecvLoop, this);
+  return true;
+}
+
+void UdpBridgeReceiver::RecvLoop() {
+  std::vector<char> buf(65536);
+  while (!is_shutdown_.load()) {
+    const ssize_t size = recvfrom(fd_, buf.data(), buf.size(), 0, nullptr,
+                                  nullptr);
+    if (size <= 0) {
+      continue;
+    }
+    decoder_.Receive(buf.data(), static_cast<std::size_t>(size));
+  }
+}
+
+void UdpBridgeReceiver::Shutdown() {
+  if (is_shutdown_.exchange(true)) {
+    return;
+  }
+  if (fd_ != -1) {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+    fd_ = -1;
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_BRIDGE_UDP_BRIDGE_H_
+#define CYBER_TRANSPORT_BRIDGE_UDP_BRIDGE_H_
+
+#include <netinet/in.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "cyber/transport/bridge/batch_decoder.h"
+#include "cyber/transport/bridge/batch_encoder.h"
+#include "cyber/transport/bridge/token_bucket.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+struct BridgeChannelAttr {
+  // use xor parity recovery instead of retransmission
+  bool enable_fec = false;
+  // outbound budget of the channel, 0 means unshaped
+  uint64_t bandwidth_bps = 0;
+  // shaper burst allowance, frames above it are dropped
+  uint64_t burst_bytes = 256 * 1024;
+};
+
+// Vehicle side of the bridge link: batches messages per channel into
+// jumbo frames and sends them over plain udp, shaped per channel so one
+// debugging subscriber cannot starve the link. Frames that exceed the
+// channel budget are dropped instead of queued, keeping the transport
+// threads free of backpressure from the bench.
+class UdpBridgeSender {
+ public:
+  UdpBridgeSender() = default;
+  ~UdpBridgeSender();
+
+  bool Init(const std::string& remote_ip, uint16_t port, std::size_t mtu);
+  void SetChannelAttr(uint64_t channel_id, const BridgeChannelAttr& attr);
+
+  // @brief: queue one serialized message of the channel.
+  bool Send(uint64_t channel_id, const std::string& message);
+
+  // @brief: emit all pending partial frames, to be called once per cycle.
+  void Flush();
+
+  void Shutdown();
+
+  uint64_t dropped_frames() const { return dropped_frames_.load(); }
+
+ private:
+  struct ChannelState {
+    std::unique_ptr<BatchEncoder> encoder;
+    std::unique_ptr<TokenBucket> shaper;
+  };
+
+  ChannelState* GetChannelState(uint64_t channel_id);
+  void SendFrame(ChannelState* state, const std::string& frame);
+
+  int fd_ = -1;
+  std::size_t mtu_ = 0;
+  struct sockaddr_in remote_addr_;
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, ChannelState> channels_;
+  std::unordered_map<uint64_t, BridgeChannelAttr> attrs_;
+  std::atomic<uint64_t> dropped_frames_ = {0};
+};
+
+// Bench side of the bridge link: receives frames, rebuilds lost ones from
+// parity where possible and hands reassembled messages to the callback.
+class UdpBridgeReceiver {
+ public:
+  using MessageCallback = BatchDecoder::MessageCallback;
+
+  UdpBridgeReceiver() = default;
+  ~UdpBridgeReceiver();
+
+  bool Init(uint16_t port);
+  void SetMessageCallback(const MessageCallback& callback);
+  bool Start();
+  void Shutdown();
+
+ private:
+  void RecvLoop();
+
+  int fd_ = -1;
+  BatchDecoder decoder_;
+  std::thread thread_;
+  std::atomic<bool> is_shutdown_ = {false};
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_BRIDGE_UDP_BRIDGE_H_
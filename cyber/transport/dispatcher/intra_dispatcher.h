@@ -43,6 +43,13 @@ class IntraDispatcher : public Dispatcher {
   void OnMessage(uint64_t channel_id, const std::shared_ptr<MessageT>& message,
                  const MessageInfo& message_info);
 
+  // Returns the channel's handler if its listeners consume MessageT directly,
+  // so a same-process transmitter can hand messages straight to it and skip
+  // the per-message lookup and type recovery done by OnMessage. Returns
+  // nullptr when the channel has no listener yet or reads RawMessage.
+  template <typename MessageT>
+  std::shared_ptr<ListenerHandler<MessageT>> GetHandler(uint64_t channel_id);
+
   DECLARE_SINGLETON(IntraDispatcher)
 };
 
@@ -78,6 +85,17 @@ void IntraDispatcher::OnMessage(uint64_t channel_id,
   }
 }
 
+template <typename MessageT>
+std::shared_ptr<ListenerHandler<MessageT>> IntraDispatcher::GetHandler(
+    uint64_t channel_id) {
+  ListenerHandlerBasePtr* handler_base = nullptr;
+  if (!msg_listeners_.Get(channel_id, &handler_base) ||
+      (*handler_base)->IsRawMessage()) {
+    return nullptr;
+  }
+  return std::dynamic_pointer_cast<ListenerHandler<MessageT>>(*handler_base);
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
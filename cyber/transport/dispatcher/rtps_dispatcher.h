@@ -23,6 +23,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/message/message_traits.h"
@@ -65,10 +66,17 @@ class RtpsDispatcher : public Dispatcher {
   }
 
  private:
+  template <typename MessageT>
+  std::function<void(const std::shared_ptr<std::string>&, const MessageInfo&)>
+  MakePooledAdapter(const RoleAttributes& self_attr,
+                    const MessageListener<MessageT>& listener);
+
   void OnMessage(uint64_t channel_id,
                  const std::shared_ptr<std::string>& msg_str,
                  const MessageInfo& msg_info);
   void AddSubscriber(const RoleAttributes& self_attr);
+
+  static const uint32_t kMessagePoolSize = 16;
   // key: channel_id
   std::unordered_map<uint64_t, Subscriber> subs_;
   std::mutex subs_mutex_;
@@ -81,15 +89,8 @@ class RtpsDispatcher : public Dispatcher {
 template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr,
                                  const MessageListener<MessageT>& listener) {
-  auto listener_adapter = [listener](
-                              const std::shared_ptr<std::string>& msg_str,
-                              const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
-    RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
-    listener(msg, msg_info);
-  };
-
-  Dispatcher::AddListener<std::string>(self_attr, listener_adapter);
+  Dispatcher::AddListener<std::string>(
+      self_attr, MakePooledAdapter<MessageT>(self_attr, listener));
   AddSubscriber(self_attr);
 }
 
@@ -97,17 +98,32 @@ template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr,
                                  const RoleAttributes& opposite_attr,
                                  const MessageListener<MessageT>& listener) {
-  auto listener_adapter = [listener](
-                              const std::shared_ptr<std::string>& msg_str,
-                              const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
+  Dispatcher::AddListener<std::string>(
+      self_attr, opposite_attr, MakePooledAdapter<MessageT>(self_attr, listener));
+  AddSubscriber(self_attr);
+}
+
+template <typename MessageT>
+std::function<void(const std::shared_ptr<std::string>&, const MessageInfo&)>
+RtpsDispatcher::MakePooledAdapter(const RoleAttributes& self_attr,
+                                  const MessageListener<MessageT>& listener) {
+  uint32_t pool_size = self_attr.qos_profile().depth();
+  if (pool_size < kMessagePoolSize) {
+    pool_size = kMessagePoolSize;
+  }
+  auto pool = std::make_shared<base::CCObjectPool<MessageT>>(pool_size);
+  pool->ConstructAll();
+  // parse into recycled instances, falling back to a fresh allocation
+  // while downstream holds on to every pooled one
+  return [pool, listener](const std::shared_ptr<std::string>& msg_str,
+                          const MessageInfo& msg_info) {
+    auto msg = pool->GetObject();
+    if (msg == nullptr) {
+      msg = std::make_shared<MessageT>();
+    }
     RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
     listener(msg, msg_info);
   };
-
-  Dispatcher::AddListener<std::string>(self_attr, opposite_attr,
-                                       listener_adapter);
-  AddSubscriber(self_attr);
 }
 
 }  // namespace transport
@@ -45,6 +45,15 @@ void ShmDispatcher::Shutdown() {
   }
 }
 
+SegmentPtr ShmDispatcher::GetSegment(uint64_t channel_id) {
+  ReadLockGuard<AtomicRWLock> lock(segments_lock_);
+  auto it = segments_.find(channel_id);
+  if (it == segments_.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
 void ShmDispatcher::AddSegment(const RoleAttributes& self_attr) {
   uint64_t channel_id = self_attr.channel_id();
   WriteLockGuard<AtomicRWLock> lock(segments_lock_);
@@ -56,7 +65,8 @@ void ShmDispatcher::AddSegment(const RoleAttributes& self_attr) {
   previous_indexes_[channel_id] = UINT32_MAX;
 }
 
-void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
+void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index,
+                                uint32_t batch_size) {
   ADEBUG << "Reading sharedmem message: "
          << GlobalData::GetChannelById(channel_id)
          << " from block: " << block_index;
@@ -69,6 +79,12 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
     return;
   }
 
+  if (batch_size > 1) {
+    ReadBatch(channel_id, rb, batch_size);
+    segments_[channel_id]->ReleaseReadBlock(*rb);
+    return;
+  }
+
   MessageInfo msg_info;
   const char* msg_info_addr =
       reinterpret_cast<char*>(rb->buf) + rb->block->msg_size();
@@ -82,6 +98,49 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
   segments_[channel_id]->ReleaseReadBlock(*rb);
 }
 
+void ShmDispatcher::ReadBatch(uint64_t channel_id,
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              uint32_t batch_size) {
+  uint8_t* cursor = rb->buf;
+  const uint8_t* end = rb->buf + rb->block->msg_size();
+  for (uint32_t i = 0; i < batch_size; ++i) {
+    if (cursor + sizeof(uint32_t) > end) {
+      AERROR << "truncated batch of channel: "
+             << GlobalData::GetChannelById(channel_id);
+      return;
+    }
+    uint32_t entry_size = 0;
+    memcpy(&entry_size, cursor, sizeof(entry_size));
+    cursor += sizeof(entry_size);
+    if (cursor + entry_size + MessageInfo::kSize > end) {
+      AERROR << "truncated batch of channel: "
+             << GlobalData::GetChannelById(channel_id);
+      return;
+    }
+
+    // entry_block only carries per-entry sizes for the listener adapter,
+    // it does not live in shared memory.
+    auto entry_block = std::make_shared<Block>();
+    entry_block->set_msg_size(entry_size);
+    entry_block->set_msg_info_size(MessageInfo::kSize);
+    auto entry_rb = std::make_shared<ReadableBlock>();
+    entry_rb->index = rb->index;
+    entry_rb->block = entry_block.get();
+    entry_rb->buf = cursor;
+    cursor += entry_size;
+
+    MessageInfo msg_info;
+    if (!msg_info.DeserializeFrom(reinterpret_cast<char*>(cursor),
+                                  MessageInfo::kSize)) {
+      AERROR << "error msg info of channel:"
+             << GlobalData::GetChannelById(channel_id);
+      return;
+    }
+    cursor += MessageInfo::kSize;
+    OnMessage(channel_id, entry_rb, msg_info);
+  }
+}
+
 void ShmDispatcher::OnMessage(uint64_t channel_id,
                               const std::shared_ptr<ReadableBlock>& rb,
                               const MessageInfo& msg_info) {
@@ -140,7 +199,7 @@ void ShmDispatcher::ThreadFunc() {
       }
       previous_index = block_index;
 
-      ReadMessage(channel_id, block_index);
+      ReadMessage(channel_id, block_index, readable_info.batch_size());
     }
   }
 }
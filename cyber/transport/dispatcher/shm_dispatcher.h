@@ -23,7 +23,10 @@
 #include <thread>
 #include <unordered_map>
 
+#include "google/protobuf/arena.h"
+
 #include "cyber/base/atomic_rw_lock.h"
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
@@ -60,9 +63,36 @@ class ShmDispatcher : public Dispatcher {
                    const RoleAttributes& opposite_attr,
                    const MessageListener<MessageT>& listener);
 
+  template <typename MessageT>
+  void AddZeroCopyListener(const RoleAttributes& self_attr,
+                           const MessageListener<MessageT>& listener);
+
+  template <typename MessageT>
+  void AddZeroCopyListener(const RoleAttributes& self_attr,
+                           const RoleAttributes& opposite_attr,
+                           const MessageListener<MessageT>& listener);
+
  private:
+  template <typename MessageT>
+  std::function<void(const std::shared_ptr<ReadableBlock>&,
+                     const MessageInfo&)>
+  MakeZeroCopyAdapter(uint64_t channel_id,
+                      const MessageListener<MessageT>& listener);
+
+  template <typename MessageT>
+  std::function<void(const std::shared_ptr<ReadableBlock>&,
+                     const MessageInfo&)>
+  MakePooledAdapter(const RoleAttributes& self_attr,
+                    const MessageListener<MessageT>& listener);
+
+  static const uint32_t kMessagePoolSize = 16;
+
+  SegmentPtr GetSegment(uint64_t channel_id);
   void AddSegment(const RoleAttributes& self_attr);
-  void ReadMessage(uint64_t channel_id, uint32_t block_index);
+  void ReadMessage(uint64_t channel_id, uint32_t block_index,
+                   uint32_t batch_size);
+  void ReadBatch(uint64_t channel_id, const std::shared_ptr<ReadableBlock>& rb,
+                 uint32_t batch_size);
   void OnMessage(uint64_t channel_id, const std::shared_ptr<ReadableBlock>& rb,
                  const MessageInfo& msg_info);
   void ThreadFunc();
@@ -81,34 +111,97 @@ class ShmDispatcher : public Dispatcher {
 template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const MessageListener<MessageT>& listener) {
-  // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
+  Dispatcher::AddListener<ReadableBlock>(
+      self_attr, MakePooledAdapter<MessageT>(self_attr, listener));
+  AddSegment(self_attr);
+}
+
+template <typename MessageT>
+std::function<void(const std::shared_ptr<ReadableBlock>&, const MessageInfo&)>
+ShmDispatcher::MakePooledAdapter(const RoleAttributes& self_attr,
+                                 const MessageListener<MessageT>& listener) {
+  uint32_t pool_size = self_attr.qos_profile().depth();
+  if (pool_size < kMessagePoolSize) {
+    pool_size = kMessagePoolSize;
+  }
+  auto pool = std::make_shared<base::CCObjectPool<MessageT>>(pool_size);
+  pool->ConstructAll();
+  // recycled instances keep their internal buffers, so parsing into them
+  // allocates nothing once the channel reaches steady state; parsing clears
+  // the instance first, so no stale fields leak between messages
+  return [pool, listener](const std::shared_ptr<ReadableBlock>& rb,
+                          const MessageInfo& msg_info) {
+    auto msg = pool->GetObject();
+    if (msg == nullptr) {
+      // downstream still holds every pooled instance, fall back to a fresh
+      // allocation instead of dropping the message
+      msg = std::make_shared<MessageT>();
+    }
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
     listener(msg, msg_info);
   };
+}
 
-  Dispatcher::AddListener<ReadableBlock>(self_attr, listener_adapter);
+template <typename MessageT>
+std::function<void(const std::shared_ptr<ReadableBlock>&, const MessageInfo&)>
+ShmDispatcher::MakeZeroCopyAdapter(uint64_t channel_id,
+                                   const MessageListener<MessageT>& listener) {
+  // Deserialize over the mapped block with an arena, then pin the block with
+  // an extra read lock so the borrowed view outlives the dispatcher loop.
+  // The pin and the arena are both released when the last view goes away.
+  return [this, channel_id, listener](const std::shared_ptr<ReadableBlock>& rb,
+                                      const MessageInfo& msg_info) {
+    auto segment = GetSegment(channel_id);
+    RETURN_IF_NULL(segment);
+    auto pinned = std::make_shared<ReadableBlock>();
+    pinned->index = rb->index;
+    if (!segment->AcquireBlockToRead(pinned.get())) {
+      AERROR << "failed to pin block[" << rb->index << "] of channel "
+             << GlobalData::GetChannelById(channel_id);
+      return;
+    }
+    auto arena = std::make_shared<google::protobuf::Arena>();
+    auto* msg = google::protobuf::Arena::Create<MessageT>(arena.get());
+    if (!message::ParseFromArray(
+            rb->buf, static_cast<int>(rb->block->msg_size()), msg)) {
+      segment->ReleaseReadBlock(*pinned);
+      return;
+    }
+    std::shared_ptr<MessageT> view(msg,
+                                   [arena, segment, pinned](MessageT* raw) {
+                                     (void)raw;
+                                     segment->ReleaseReadBlock(*pinned);
+                                   });
+    listener(view, msg_info);
+  };
+}
+
+template <typename MessageT>
+void ShmDispatcher::AddZeroCopyListener(
+    const RoleAttributes& self_attr, const MessageListener<MessageT>& listener) {
+  AddSegment(self_attr);
+  Dispatcher::AddListener<ReadableBlock>(
+      self_attr,
+      MakeZeroCopyAdapter<MessageT>(self_attr.channel_id(), listener));
+}
+
+template <typename MessageT>
+void ShmDispatcher::AddZeroCopyListener(
+    const RoleAttributes& self_attr, const RoleAttributes& opposite_attr,
+    const MessageListener<MessageT>& listener) {
   AddSegment(self_attr);
+  Dispatcher::AddListener<ReadableBlock>(
+      self_attr, opposite_attr,
+      MakeZeroCopyAdapter<MessageT>(self_attr.channel_id(), listener));
 }
 
 template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const RoleAttributes& opposite_attr,
                                 const MessageListener<MessageT>& listener) {
-  // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
-    RETURN_IF(!message::ParseFromArray(
-        rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
-    listener(msg, msg_info);
-  };
-
-  Dispatcher::AddListener<ReadableBlock>(self_attr, opposite_attr,
-                                         listener_adapter);
+  Dispatcher::AddListener<ReadableBlock>(
+      self_attr, opposite_attr, MakePooledAdapter<MessageT>(self_attr, listener));
   AddSegment(self_attr);
 }
 
@@ -27,6 +27,15 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
+// Opt-in policy for zero-copy receive. Specialize for hot channel message
+// types (e.g. PointCloud, Image) to make their ShmReceiver hand callbacks an
+// arena-deserialized view borrowed from the mapped block, instead of a full
+// copy. Cold channels keep the default copying path.
+template <typename M>
+struct ShmZeroCopyPolicy {
+  static const bool enabled = false;
+};
+
 template <typename M>
 class ShmReceiver : public Receiver<M> {
  public:
@@ -63,9 +72,13 @@ void ShmReceiver<M>::Enable() {
     return;
   }
 
-  dispatcher_->AddListener<M>(
-      this->attr_, std::bind(&ShmReceiver<M>::OnNewMessage, this,
-                             std::placeholders::_1, std::placeholders::_2));
+  auto listener = std::bind(&ShmReceiver<M>::OnNewMessage, this,
+                            std::placeholders::_1, std::placeholders::_2);
+  if (ShmZeroCopyPolicy<M>::enabled) {
+    dispatcher_->AddZeroCopyListener<M>(this->attr_, listener);
+  } else {
+    dispatcher_->AddListener<M>(this->attr_, listener);
+  }
   this->enabled_ = true;
 }
 
@@ -81,10 +94,13 @@ void ShmReceiver<M>::Disable() {
 
 template <typename M>
 void ShmReceiver<M>::Enable(const RoleAttributes& opposite_attr) {
-  dispatcher_->AddListener<M>(
-      this->attr_, opposite_attr,
-      std::bind(&ShmReceiver<M>::OnNewMessage, this, std::placeholders::_1,
-                std::placeholders::_2));
+  auto listener = std::bind(&ShmReceiver<M>::OnNewMessage, this,
+                            std::placeholders::_1, std::placeholders::_2);
+  if (ShmZeroCopyPolicy<M>::enabled) {
+    dispatcher_->AddZeroCopyListener<M>(this->attr_, opposite_attr, listener);
+  } else {
+    dispatcher_->AddListener<M>(this->attr_, opposite_attr, listener);
+  }
 }
 
 template <typename M>
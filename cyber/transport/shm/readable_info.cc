@@ -24,13 +24,25 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
-const size_t ReadableInfo::kSize = sizeof(uint64_t) * 2 + sizeof(uint32_t);
+const size_t ReadableInfo::kSize =
+    sizeof(uint64_t) * 2 + sizeof(uint32_t) * 2;
 
-ReadableInfo::ReadableInfo() : host_id_(0), block_index_(0), channel_id_(0) {}
+ReadableInfo::ReadableInfo()
+    : host_id_(0), block_index_(0), channel_id_(0), batch_size_(1) {}
 
 ReadableInfo::ReadableInfo(uint64_t host_id, uint32_t block_index,
                            uint64_t channel_id)
-    : host_id_(host_id), block_index_(block_index), channel_id_(channel_id) {}
+    : host_id_(host_id),
+      block_index_(block_index),
+      channel_id_(channel_id),
+      batch_size_(1) {}
+
+ReadableInfo::ReadableInfo(uint64_t host_id, uint32_t block_index,
+                           uint64_t channel_id, uint32_t batch_size)
+    : host_id_(host_id),
+      block_index_(block_index),
+      channel_id_(channel_id),
+      batch_size_(batch_size) {}
 
 ReadableInfo::~ReadableInfo() {}
 
@@ -39,6 +51,7 @@ ReadableInfo& ReadableInfo::operator=(const ReadableInfo& other) {
     this->host_id_ = other.host_id_;
     this->block_index_ = other.block_index_;
     this->channel_id_ = other.channel_id_;
+    this->batch_size_ = other.batch_size_;
   }
   return *this;
 }
@@ -52,6 +65,8 @@ bool ReadableInfo::SerializeTo(std::string* dst) const {
               sizeof(block_index_));
   dst->append(reinterpret_cast<char*>(const_cast<uint64_t*>(&channel_id_)),
               sizeof(channel_id_));
+  dst->append(reinterpret_cast<char*>(const_cast<uint32_t*>(&batch_size_)),
+              sizeof(batch_size_));
   return true;
 }
 
@@ -72,6 +87,8 @@ bool ReadableInfo::DeserializeFrom(const char* src, std::size_t len) {
   memcpy(reinterpret_cast<char*>(&block_index_), ptr, sizeof(block_index_));
   ptr += sizeof(block_index_);
   memcpy(reinterpret_cast<char*>(&channel_id_), ptr, sizeof(channel_id_));
+  ptr += sizeof(channel_id_);
+  memcpy(reinterpret_cast<char*>(&batch_size_), ptr, sizeof(batch_size_));
 
   return true;
 }
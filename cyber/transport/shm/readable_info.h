@@ -33,6 +33,8 @@ class ReadableInfo {
  public:
   ReadableInfo();
   ReadableInfo(uint64_t host_id, uint32_t block_index, uint64_t channel_id);
+  ReadableInfo(uint64_t host_id, uint32_t block_index, uint64_t channel_id,
+               uint32_t batch_size);
   virtual ~ReadableInfo();
 
   ReadableInfo& operator=(const ReadableInfo& other);
@@ -50,12 +52,17 @@ class ReadableInfo {
   uint64_t channel_id() const { return channel_id_; }
   void set_channel_id(uint64_t channel_id) { channel_id_ = channel_id; }
 
+  uint32_t batch_size() const { return batch_size_; }
+  void set_batch_size(uint32_t batch_size) { batch_size_ = batch_size; }
+
   static const size_t kSize;
 
  private:
   uint64_t host_id_;
   uint32_t block_index_;
   uint64_t channel_id_;
+  // number of messages packed in the block, 1 for a plain transmit
+  uint32_t batch_size_;
 };
 
 }  // namespace transport
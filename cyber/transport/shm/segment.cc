@@ -16,8 +16,11 @@
 
 #include "cyber/transport/shm/segment.h"
 
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <algorithm>
 
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
 #include "cyber/transport/shm/shm_conf.h"
@@ -25,6 +28,43 @@
 namespace apollo {
 namespace cyber {
 namespace transport {
+namespace {
+
+// MPOL_BIND from linux/mempolicy.h, duplicated here so the transport layer
+// does not grow a libnuma dependency.
+constexpr int kMpolBind = 2;
+// Sample every Nth block acquisition when counting cross-node accesses;
+// getcpu is cheap but not free on the hot path.
+constexpr uint64_t kNumaAccessSampleInterval = 64;
+
+// The NUMA node configured for the channel in the shm conf, -1 if none.
+int LookupPreferredNumaNode(uint64_t channel_id) {
+  auto& g_conf = common::GlobalData::Instance()->Config();
+  if (!g_conf.has_transport_conf() ||
+      !g_conf.transport_conf().has_shm_conf()) {
+    return -1;
+  }
+  const std::string channel_name =
+      common::GlobalData::GetChannelById(channel_id);
+  for (const auto& policy :
+       g_conf.transport_conf().shm_conf().numa_policy()) {
+    if (policy.channel_name() == channel_name) {
+      return policy.numa_node();
+    }
+  }
+  return -1;
+}
+
+int CurrentNumaNode() {
+  unsigned int cpu = 0;
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return -1;
+  }
+  return static_cast<int>(node);
+}
+
+}  // namespace
 
 Segment::Segment(uint64_t channel_id, const ReadWriteMode& mode)
     : init_(false),
@@ -34,7 +74,8 @@ Segment::Segment(uint64_t channel_id, const ReadWriteMode& mode)
       blocks_(nullptr),
       managed_shm_(nullptr),
       block_buf_lock_(),
-      block_buf_addrs_() {
+      block_buf_addrs_(),
+      numa_node_(LookupPreferredNumaNode(channel_id)) {
   id_ = static_cast<key_t>(channel_id);
 }
 
@@ -63,10 +104,17 @@ bool Segment::AcquireBlockToWrite(std::size_t msg_size,
     return false;
   }
 
-  uint32_t index = GetNextWritableBlockIndex();
+  int cls = conf_.FirstFittingClass(msg_size);
+  if (cls < 0) {
+    AERROR << "no size class fits msg_size[" << msg_size << "].";
+    return false;
+  }
+
+  uint32_t index = GetNextWritableBlockIndex(static_cast<uint32_t>(cls));
   writable_block->index = index;
   writable_block->block = &blocks_[index];
   writable_block->buf = block_buf_addrs_[index];
+  CountNodeAccess();
   return true;
 }
 
@@ -106,6 +154,7 @@ bool Segment::AcquireBlockToRead(ReadableBlock* readable_block) {
   }
   readable_block->block = blocks_ + index;
   readable_block->buf = block_buf_addrs_[index];
+  CountNodeAccess();
   return true;
 }
 
@@ -165,6 +214,10 @@ bool Segment::OpenOrCreate() {
     return false;
   }
 
+  // Bind before the placement news below fault the pages in, so they land
+  // on the preferred node instead of wherever the first toucher runs.
+  BindToNumaNode();
+
   // create field state_
   state_ = new (managed_shm_) State(conf_.ceiling_msg_size());
   if (state_ == nullptr) {
@@ -193,10 +246,9 @@ bool Segment::OpenOrCreate() {
   // create block buf
   uint32_t i = 0;
   for (; i < conf_.block_num(); ++i) {
-    uint8_t* addr =
-        new (static_cast<char*>(managed_shm_) + sizeof(State) +
-             conf_.block_num() * sizeof(Block) + i * conf_.block_buf_size())
-            uint8_t[conf_.block_buf_size()];
+    uint8_t* addr = new (static_cast<char*>(managed_shm_) + sizeof(State) +
+                         conf_.block_num() * sizeof(Block) +
+                         conf_.BlockBufOffset(i)) uint8_t[1];
     std::lock_guard<std::mutex> _g(block_buf_lock_);
     block_buf_addrs_[i] = addr;
   }
@@ -241,6 +293,10 @@ bool Segment::OpenOnly() {
     return false;
   }
 
+  // Pages the creator already touched keep their placement; the policy
+  // only steers blocks this process is the first to fault in.
+  BindToNumaNode();
+
   // get field state_
   state_ = reinterpret_cast<State*>(managed_shm_);
   if (state_ == nullptr) {
@@ -268,7 +324,7 @@ bool Segment::OpenOnly() {
   for (; i < conf_.block_num(); ++i) {
     uint8_t* addr = reinterpret_cast<uint8_t*>(
         static_cast<char*>(managed_shm_) + sizeof(State) +
-        conf_.block_num() * sizeof(Block) + i * conf_.block_buf_size());
+        conf_.block_num() * sizeof(Block) + conf_.BlockBufOffset(i));
 
     if (addr == nullptr) {
       break;
@@ -316,6 +372,12 @@ bool Segment::Destroy() {
   }
   init_ = false;
 
+  if (numa_node_ >= 0) {
+    AINFO << "segment[" << id_ << "] numa node[" << numa_node_
+          << "] sampled accesses, local[" << local_access_num() << "] remote["
+          << remote_access_num() << "].";
+  }
+
   try {
     state_->DecreaseReferenceCounts();
     uint32_t reference_counts = state_->reference_counts();
@@ -360,13 +422,50 @@ bool Segment::Recreate() {
   return OpenOrCreate();
 }
 
-uint32_t Segment::GetNextWritableBlockIndex() {
-  uint32_t try_idx = state_->wrote_num();
+void Segment::BindToNumaNode() {
+  if (numa_node_ < 0 || managed_shm_ == nullptr) {
+    return;
+  }
+  if (numa_node_ >= static_cast<int>(sizeof(unsigned long) * 8)) {  // NOLINT
+    AWARN << "numa node[" << numa_node_ << "] out of range, ignored.";
+    return;
+  }
+  unsigned long nodemask = 1UL << numa_node_;  // NOLINT
+  if (syscall(SYS_mbind, managed_shm_, conf_.managed_shm_size(), kMpolBind,
+              &nodemask, sizeof(nodemask) * 8, 0UL) != 0) {
+    AWARN << "mbind segment[" << id_ << "] to numa node[" << numa_node_
+          << "] failed, error code: " << strerror(errno);
+  }
+}
+
+void Segment::CountNodeAccess() {
+  if (numa_node_ < 0) {
+    return;
+  }
+  const uint64_t num = access_num_.fetch_add(1, std::memory_order_relaxed);
+  if (num % kNumaAccessSampleInterval != 0) {
+    return;
+  }
+  const int node = CurrentNumaNode();
+  if (node < 0) {
+    return;
+  }
+  if (node == numa_node_) {
+    local_access_num_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    remote_access_num_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+uint32_t Segment::GetNextWritableBlockIndex(uint32_t cls) {
+  auto& size_class = conf_.size_class(cls);
+  auto first = size_class.first_block;
+  auto num = size_class.block_num;
+  uint32_t try_idx = first + state_->wrote_num() % num;
 
-  auto max_mod_num = conf_.block_num() - 1;
   while (1) {
-    if (try_idx >= conf_.block_num()) {
-      try_idx &= max_mod_num;
+    if (try_idx >= first + num) {
+      try_idx = first;
     }
 
     if (blocks_[try_idx].TryLockForWrite()) {
@@ -21,6 +21,7 @@
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include <sys/types.h>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -61,6 +62,13 @@ class Segment final {
   bool AcquireBlockToRead(ReadableBlock* readable_block);
   void ReleaseReadBlock(const ReadableBlock& readable_block);
 
+  // NUMA node the segment is bound to, -1 when no policy is configured.
+  int numa_node() const { return numa_node_; }
+  // Sampled block acquisitions from the bound node and from other nodes.
+  // Only counted when a placement policy is configured for the channel.
+  uint64_t local_access_num() const { return local_access_num_.load(); }
+  uint64_t remote_access_num() const { return remote_access_num_.load(); }
+
  private:
   bool Init();
   bool OpenOrCreate();
@@ -71,7 +79,9 @@ class Segment final {
   bool Remap();
   bool Recreate();
 
-  uint32_t GetNextWritableBlockIndex();
+  uint32_t GetNextWritableBlockIndex(uint32_t cls);
+  void BindToNumaNode();
+  void CountNodeAccess();
 
   bool init_;
   key_t id_;
@@ -83,6 +93,11 @@ class Segment final {
   void* managed_shm_;
   std::mutex block_buf_lock_;
   std::unordered_map<uint32_t, uint8_t*> block_buf_addrs_;
+
+  int numa_node_;
+  std::atomic<uint64_t> access_num_{0};
+  std::atomic<uint64_t> local_access_num_{0};
+  std::atomic<uint64_t> remote_access_num_{0};
 };
 
 }  // namespace transport
@@ -15,6 +15,9 @@
  *****************************************************************************/
 
 #include "cyber/transport/shm/shm_conf.h"
+
+#include <algorithm>
+
 #include "cyber/common/log.h"
 
 namespace apollo {
@@ -30,9 +33,60 @@ ShmConf::~ShmConf() {}
 void ShmConf::Update(const uint64_t& real_msg_size) {
   ceiling_msg_size_ = GetCeilingMessageSize(real_msg_size);
   block_buf_size_ = GetBlockBufSize(ceiling_msg_size_);
-  block_num_ = GetBlockNum(ceiling_msg_size_);
-  managed_shm_size_ =
-      EXTRA_SIZE + STATE_SIZE + (BLOCK_SIZE + block_buf_size_) * block_num_;
+  BuildSizeClasses();
+  managed_shm_size_ = EXTRA_SIZE + STATE_SIZE;
+  for (auto& cls : classes_) {
+    managed_shm_size_ += (BLOCK_SIZE + cls.buf_size) * cls.block_num;
+  }
+}
+
+void ShmConf::BuildSizeClasses() {
+  classes_.clear();
+  block_num_ = 0;
+  static const uint64_t tiers[] = {MESSAGE_SIZE_16K, MESSAGE_SIZE_128K,
+                                   MESSAGE_SIZE_1M,  MESSAGE_SIZE_8M,
+                                   MESSAGE_SIZE_16M, MESSAGE_SIZE_MORE};
+  uint32_t first = 0;
+  uint64_t offset = 0;
+  for (auto tier : tiers) {
+    if (tier > ceiling_msg_size_) {
+      break;
+    }
+    SizeClass cls;
+    cls.msg_size = tier;
+    cls.buf_size = GetBlockBufSize(tier);
+    // a mixed segment keeps a quarter of each tier's standalone depth,
+    // small traffic no longer burns worst-case blocks
+    if (tier == ceiling_msg_size_ && classes_.empty()) {
+      cls.block_num = GetBlockNum(tier);
+    } else {
+      cls.block_num = std::max(4u, GetBlockNum(tier) / 4);
+    }
+    cls.first_block = first;
+    cls.buf_offset = offset;
+    first += cls.block_num;
+    offset += cls.block_num * cls.buf_size;
+    classes_.emplace_back(cls);
+  }
+  block_num_ = first;
+}
+
+uint64_t ShmConf::BlockBufOffset(uint32_t block_index) const {
+  for (auto& cls : classes_) {
+    if (block_index < cls.first_block + cls.block_num) {
+      return cls.buf_offset + (block_index - cls.first_block) * cls.buf_size;
+    }
+  }
+  return 0;
+}
+
+int ShmConf::FirstFittingClass(uint64_t msg_size) const {
+  for (std::size_t i = 0; i < classes_.size(); ++i) {
+    if (classes_[i].msg_size >= msg_size) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
 }
 
 const uint64_t ShmConf::EXTRA_SIZE = 1024 * 4;
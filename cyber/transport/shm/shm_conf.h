@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 namespace apollo {
 namespace cyber {
@@ -32,20 +33,41 @@ class ShmConf {
 
   void Update(const uint64_t& real_msg_size);
 
+  // A segment is carved into size classes so that a channel which only
+  // occasionally carries a huge message does not reserve every block at the
+  // worst-case size. The table is derived deterministically from
+  // ceiling_msg_size so writer and readers always agree on the layout.
+  struct SizeClass {
+    uint64_t msg_size = 0;
+    uint64_t buf_size = 0;
+    uint32_t block_num = 0;
+    uint32_t first_block = 0;
+    uint64_t buf_offset = 0;
+  };
+
   const uint64_t& ceiling_msg_size() { return ceiling_msg_size_; }
   const uint64_t& block_buf_size() { return block_buf_size_; }
   const uint32_t& block_num() { return block_num_; }
   const uint64_t& managed_shm_size() { return managed_shm_size_; }
 
+  uint32_t class_num() const { return static_cast<uint32_t>(classes_.size()); }
+  const SizeClass& size_class(uint32_t cls) const { return classes_[cls]; }
+  // byte offset of block_index's buffer from the start of the buffer area
+  uint64_t BlockBufOffset(uint32_t block_index) const;
+  // smallest class whose message capacity fits msg_size, -1 if none
+  int FirstFittingClass(uint64_t msg_size) const;
+
  private:
   uint64_t GetCeilingMessageSize(const uint64_t& real_msg_size);
   uint64_t GetBlockBufSize(const uint64_t& ceiling_msg_size);
   uint32_t GetBlockNum(const uint64_t& ceiling_msg_size);
+  void BuildSizeClasses();
 
   uint64_t ceiling_msg_size_;
   uint64_t block_buf_size_;
   uint32_t block_num_;
   uint64_t managed_shm_size_;
+  std::vector<SizeClass> classes_;
 
   // Extra size, Bit
   static const uint64_t EXTRA_SIZE;
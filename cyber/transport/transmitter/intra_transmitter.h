@@ -44,6 +44,7 @@ class IntraTransmitter : public Transmitter<M> {
  private:
   uint64_t channel_id_;
   IntraDispatcherPtr dispatcher_;
+  std::shared_ptr<ListenerHandler<M>> direct_handler_;
 };
 
 template <typename M>
@@ -68,6 +69,7 @@ void IntraTransmitter<M>::Enable() {
 template <typename M>
 void IntraTransmitter<M>::Disable() {
   if (this->enabled_) {
+    direct_handler_ = nullptr;
     dispatcher_ = nullptr;
     this->enabled_ = false;
   }
@@ -81,6 +83,18 @@ bool IntraTransmitter<M>::Transmit(const MessagePtr& msg,
     return false;
   }
 
+  if (direct_handler_ == nullptr) {
+    // a channel keeps one handler object for the process lifetime, so a
+    // successful typed lookup can be cached and every later Transmit hands
+    // the shared_ptr straight to the listeners without serialization,
+    // hash-map lookup or dynamic casts
+    direct_handler_ = dispatcher_->GetHandler<M>(channel_id_);
+  }
+  if (direct_handler_ != nullptr) {
+    direct_handler_->Run(msg, msg_info);
+    return true;
+  }
+
   dispatcher_->OnMessage(channel_id_, msg, msg_info);
   return true;
 }
@@ -21,6 +21,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
@@ -48,6 +49,11 @@ class ShmTransmitter : public Transmitter<M> {
 
   bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
 
+  // Coalesces all pending messages into one block write and a single notify.
+  // Layout per entry: uint32_t payload size, payload, message info.
+  bool TransmitBatch(const std::vector<MessagePtr>& msgs,
+                     const std::vector<MessageInfo>& msg_infos);
+
  private:
   bool Transmit(const M& msg, const MessageInfo& msg_info);
 
@@ -97,6 +103,70 @@ bool ShmTransmitter<M>::Transmit(const MessagePtr& msg,
   return Transmit(*msg, msg_info);
 }
 
+template <typename M>
+bool ShmTransmitter<M>::TransmitBatch(const std::vector<MessagePtr>& msgs,
+                                      const std::vector<MessageInfo>& msg_infos) {
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+  if (msgs.empty() || msgs.size() != msg_infos.size()) {
+    AERROR << "invalid batch, msgs: " << msgs.size()
+           << ", msg_infos: " << msg_infos.size();
+    return false;
+  }
+  if (msgs.size() == 1) {
+    return Transmit(*msgs[0], msg_infos[0]);
+  }
+
+  std::vector<std::size_t> msg_sizes;
+  msg_sizes.reserve(msgs.size());
+  std::size_t total_size = 0;
+  for (auto& msg : msgs) {
+    std::size_t msg_size = message::ByteSize(*msg);
+    msg_sizes.push_back(msg_size);
+    total_size += sizeof(uint32_t) + msg_size + MessageInfo::kSize;
+  }
+
+  WritableBlock wb;
+  if (!segment_->AcquireBlockToWrite(total_size, &wb)) {
+    AERROR << "acquire block failed.";
+    return false;
+  }
+
+  uint8_t* cursor = wb.buf;
+  for (std::size_t i = 0; i < msgs.size(); ++i) {
+    uint32_t entry_size = static_cast<uint32_t>(msg_sizes[i]);
+    memcpy(cursor, &entry_size, sizeof(entry_size));
+    cursor += sizeof(entry_size);
+    if (!message::SerializeToArray(*msgs[i], cursor,
+                                   static_cast<int>(entry_size))) {
+      AERROR << "serialize to array failed.";
+      segment_->ReleaseWrittenBlock(wb);
+      return false;
+    }
+    cursor += entry_size;
+    if (!msg_infos[i].SerializeTo(reinterpret_cast<char*>(cursor),
+                                  MessageInfo::kSize)) {
+      AERROR << "serialize message info failed.";
+      segment_->ReleaseWrittenBlock(wb);
+      return false;
+    }
+    cursor += MessageInfo::kSize;
+  }
+  wb.block->set_msg_size(total_size);
+  wb.block->set_msg_info_size(0);
+  segment_->ReleaseWrittenBlock(wb);
+
+  ReadableInfo readable_info(host_id_, wb.index, channel_id_,
+                             static_cast<uint32_t>(msgs.size()));
+
+  ADEBUG << "Writing sharedmem batch of " << msgs.size() << " messages: "
+         << common::GlobalData::GetChannelById(channel_id_)
+         << " to block: " << wb.index;
+  return notifier_->Notify(readable_info);
+}
+
 template <typename M>
 bool ShmTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
   if (!this->enabled_) {
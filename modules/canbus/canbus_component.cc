@@ -32,6 +32,14 @@ using apollo::control::ControlCommand;
 using apollo::drivers::canbus::CanClientFactory;
 using apollo::guardian::GuardianCommand;
 
+namespace {
+
+// floor on the interval between two chassis state side channel writes,
+// so a fully loaded bus can not tax the RX thread with chassis building
+constexpr double kChassisStateMinIntervalSec = 0.001;
+
+}  // namespace
+
 std::string CanbusComponent::Name() const { return FLAGS_canbus_module_name; }
 
 CanbusComponent::CanbusComponent()
@@ -104,6 +112,16 @@ bool CanbusComponent::Init() {
         << " initialized with canbus conf as : "
         << canbus_conf_.vehicle_parameter().ShortDebugString();
 
+  if (FLAGS_enable_chassis_state_shortcut) {
+    if (chassis_state_shm_.Init()) {
+      message_manager_->SetParseCallback([this] { PublishChassisState(); });
+      AINFO << "The chassis state side channel is enabled.";
+    } else {
+      AERROR << "Failed to init the chassis state shm segment, the side "
+                "channel is disabled.";
+    }
+  }
+
   cyber::ReaderConfig guardian_cmd_reader_config;
   guardian_cmd_reader_config.channel_name = FLAGS_guardian_topic;
   guardian_cmd_reader_config.pending_queue_size =
@@ -167,12 +185,37 @@ bool CanbusComponent::Init() {
 }
 
 void CanbusComponent::PublishChassis() {
-  Chassis chassis = vehicle_controller_->chassis();
+  Chassis chassis;
+  {
+    std::lock_guard<std::mutex> lock(chassis_mutex_);
+    chassis = vehicle_controller_->chassis();
+  }
   common::util::FillHeader(node_->Name(), &chassis);
   chassis_writer_->Write(std::make_shared<Chassis>(chassis));
   ADEBUG << chassis.ShortDebugString();
 }
 
+void CanbusComponent::PublishChassisState() {
+  // runs on the CAN RX thread right after a protocol update
+  const double now = apollo::common::time::Clock::NowInSeconds();
+  if (now - last_chassis_state_time_ < kChassisStateMinIntervalSec) {
+    return;
+  }
+  last_chassis_state_time_ = now;
+
+  Chassis chassis;
+  {
+    std::lock_guard<std::mutex> lock(chassis_mutex_);
+    chassis = vehicle_controller_->chassis();
+  }
+  ChassisState state;
+  state.timestamp_sec = now;
+  state.speed_mps = chassis.speed_mps();
+  state.steering_percentage = chassis.steering_percentage();
+  state.gear_location = static_cast<int32_t>(chassis.gear_location());
+  chassis_state_shm_.Write(state);
+}
+
 void CanbusComponent::PublishChassisDetail() {
   ChassisDetail chassis_detail;
   message_manager_->GetSensorData(&chassis_detail);
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "cyber/cyber.h"
 #include "cyber/timer/timer.h"
 
+#include "modules/canbus/common/chassis_state_shm.h"
 #include "modules/canbus/proto/chassis_detail.pb.h"
 #include "modules/drivers/canbus/proto/can_card_parameter.pb.h"
 #include "modules/guardian/proto/guardian.pb.h"
@@ -82,6 +84,7 @@ class CanbusComponent final : public apollo::cyber::TimerComponent {
  private:
   void PublishChassis();
   void PublishChassisDetail();
+  void PublishChassisState();
   void OnControlCommand(const apollo::control::ControlCommand &control_command);
   void OnGuardianCommand(
       const apollo::guardian::GuardianCommand &guardian_command);
@@ -99,6 +102,11 @@ class CanbusComponent final : public apollo::cyber::TimerComponent {
   std::unique_ptr<MessageManager<::apollo::canbus::ChassisDetail>>
       message_manager_;
   std::unique_ptr<VehicleController> vehicle_controller_;
+  // serializes the chassis construction between the feedback timer and
+  // the CAN RX thread feeding the chassis state side channel
+  std::mutex chassis_mutex_;
+  ChassisStateShm chassis_state_shm_;
+  double last_chassis_state_time_ = 0.0;
   int64_t last_timestamp_ = 0;
   ::apollo::common::monitor::MonitorLogBuffer monitor_logger_buffer_;
   std::shared_ptr<Writer<Chassis>> chassis_writer_;
@@ -49,3 +49,9 @@ DEFINE_int32(guardian_cmd_pending_queue_size, 10,
              "Max guardian cmd pending queue size");
 DEFINE_int32(control_cmd_pending_queue_size, 10,
              "Max control cmd pending queue size");
+
+// publish the minimal chassis state through shared memory on CAN update
+DEFINE_bool(enable_chassis_state_shortcut, false,
+            "Write speed/steering/gear feedback into the shared memory "
+            "side channel immediately upon CAN protocol update, instead "
+            "of only publishing Chassis at the timer frequency");
@@ -42,3 +42,6 @@ DECLARE_bool(receive_guardian);
 
 DECLARE_int32(guardian_cmd_pending_queue_size);
 DECLARE_int32(control_cmd_pending_queue_size);
+
+// chassis state shared memory side channel
+DECLARE_bool(enable_chassis_state_shortcut);
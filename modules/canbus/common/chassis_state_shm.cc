@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/canbus/common/chassis_state_shm.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace canbus {
+
+namespace {
+
+// key of the shared segment, agreed on by the canbus writer and the
+// control reader
+constexpr key_t kChassisStateShmKey = 0x43485353;  // "CHSS"
+
+// a read only has to race a sub-microsecond write, so a couple of
+// retries are plenty
+constexpr int kMaxReadRetry = 5;
+
+}  // namespace
+
+ChassisStateShm::~ChassisStateShm() {
+  if (slot_ != nullptr) {
+    shmdt(slot_);
+    slot_ = nullptr;
+  }
+}
+
+bool ChassisStateShm::Init() {
+  int shm_id = shmget(kChassisStateShmKey, sizeof(Slot), IPC_CREAT | 0666);
+  if (shm_id == -1) {
+    AERROR << "Failed to create the chassis state shm segment.";
+    return false;
+  }
+  void *address = shmat(shm_id, nullptr, 0);
+  if (address == reinterpret_cast<void *>(-1)) {
+    AERROR << "Failed to attach the chassis state shm segment.";
+    return false;
+  }
+  // a freshly created segment is zero-filled, so seq starts at 0 and
+  // readers report the slot as not written yet
+  slot_ = reinterpret_cast<Slot *>(address);
+  return true;
+}
+
+void ChassisStateShm::Write(const ChassisState &state) {
+  if (slot_ == nullptr) {
+    return;
+  }
+  const uint32_t seq = slot_->seq.load(std::memory_order_relaxed);
+  slot_->seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot_->state = state;
+  slot_->seq.store(seq + 2, std::memory_order_release);
+}
+
+bool ChassisStateShm::Read(ChassisState *state) const {
+  if (slot_ == nullptr || state == nullptr) {
+    return false;
+  }
+  for (int i = 0; i < kMaxReadRetry; ++i) {
+    const uint32_t seq_begin = slot_->seq.load(std::memory_order_acquire);
+    if (seq_begin == 0 || (seq_begin & 1) != 0) {
+      // nothing written yet, or a write is in flight
+      continue;
+    }
+    *state = slot_->state;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot_->seq.load(std::memory_order_relaxed) == seq_begin) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace canbus
+}  // namespace apollo
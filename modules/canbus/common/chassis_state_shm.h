@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @namespace apollo::canbus
+ * @brief apollo::canbus
+ */
+namespace apollo {
+namespace canbus {
+
+/**
+ * @brief Minimal POD snapshot of the chassis feedback used by control.
+ */
+struct ChassisState {
+  double timestamp_sec = 0.0;
+  double speed_mps = 0.0;
+  double steering_percentage = 0.0;
+  int32_t gear_location = 0;
+};
+
+/**
+ * @class ChassisStateShm
+ *
+ * @brief Lock-free single-slot side channel for ChassisState over shared
+ * memory. The canbus RX path writes the slot immediately after a protocol
+ * update and control reads it at compute time, bypassing the staleness of
+ * the 100Hz chassis publish cycle. The slot is guarded by a seqlock: the
+ * writer never blocks, and a reader retries when it observes a torn write.
+ */
+class ChassisStateShm {
+ public:
+  ChassisStateShm() = default;
+  ~ChassisStateShm();
+
+  /**
+   * @brief attach the shared memory slot, creating it if necessary.
+   * Both the writer and the readers call this.
+   * @return true if the slot is attached.
+   */
+  bool Init();
+
+  /**
+   * @brief publish a new snapshot into the slot. Wait-free.
+   */
+  void Write(const ChassisState &state);
+
+  /**
+   * @brief read a consistent snapshot from the slot.
+   * @return false if the slot is not attached, nothing has been written
+   * yet, or a concurrent writer kept tearing the read.
+   */
+  bool Read(ChassisState *state) const;
+
+ private:
+  struct Slot {
+    // odd while a write is in flight, bumped to even when it completes
+    std::atomic<uint32_t> seq;
+    ChassisState state;
+  };
+
+  Slot *slot_ = nullptr;
+};
+
+}  // namespace canbus
+}  // namespace apollo
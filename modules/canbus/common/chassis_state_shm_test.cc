@@ -0,0 +1,46 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/canbus/common/chassis_state_shm.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace canbus {
+
+TEST(ChassisStateShmTest, WriteReadRoundTrip) {
+  ChassisStateShm writer;
+  ChassisStateShm reader;
+  ASSERT_TRUE(writer.Init());
+  ASSERT_TRUE(reader.Init());
+
+  ChassisState state;
+  state.timestamp_sec = 1.5;
+  state.speed_mps = 3.25;
+  state.steering_percentage = -12.5;
+  state.gear_location = 2;
+  writer.Write(state);
+
+  ChassisState read_back;
+  ASSERT_TRUE(reader.Read(&read_back));
+  EXPECT_DOUBLE_EQ(1.5, read_back.timestamp_sec);
+  EXPECT_DOUBLE_EQ(3.25, read_back.speed_mps);
+  EXPECT_DOUBLE_EQ(-12.5, read_back.steering_percentage);
+  EXPECT_EQ(2, read_back.gear_location);
+}
+
+}  // namespace canbus
+}  // namespace apollo
@@ -33,6 +33,9 @@ DEFINE_string(end_way_point_filename, "default_end_way_point.txt",
               "End way point of the map, will be sent in RoutingRequest.");
 DEFINE_string(speed_control_filename, "speed_control.pb.txt",
               "The speed control region in a map.");
+DEFINE_bool(use_shared_base_map, false,
+            "Serve the serialized base map from a read-only shared memory "
+            "blob, so all processes on the vehicle share one copy.");
 
 DEFINE_string(vehicle_config_path,
               "/apollo/modules/common/data/vehicle_param.pb.txt",
@@ -29,6 +29,7 @@ DECLARE_string(sim_map_filename);
 DECLARE_string(routing_map_filename);
 DECLARE_string(end_way_point_filename);
 DECLARE_string(speed_control_filename);
+DECLARE_bool(use_shared_base_map);
 
 DECLARE_double(look_forward_time_sec);
 
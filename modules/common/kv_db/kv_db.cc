@@ -17,6 +17,9 @@
 
 #include <sqlite3.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #include "gflags/gflags.h"
 
 #include "cyber/common/log.h"
@@ -88,36 +91,86 @@ class SqliteWraper {
   sqlite3 *db_ = nullptr;
 };
 
+// Read-through cache of the DB, so repeated lookups of the same key never
+// touch sqlite on the caller's thread again. An empty value means the key is
+// known to be absent, matching the DB convention below.
+class KVCache {
+ public:
+  bool Lookup(const std::string &key, std::string *value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto iter = cache_.find(key);
+    if (iter == cache_.end()) {
+      return false;
+    }
+    *value = iter->second;
+    return true;
+  }
+
+  void Update(const std::string &key, const std::string &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_[key] = value;
+  }
+
+  static KVCache *Instance() {
+    static KVCache instance;
+    return &instance;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::string> cache_;
+};
+
+// Queries the value of a key from the DB and caches the result, including a
+// miss. Returns false on DB errors only.
+bool QueryThroughCache(const std::string &key, std::string *value) {
+  if (KVCache::Instance()->Lookup(key, value)) {
+    return true;
+  }
+  SqliteWraper sqlite;
+  if (!sqlite.SQL(StrCat("SELECT value FROM key_value WHERE key='", key, "';"),
+                  value)) {
+    return false;
+  }
+  KVCache::Instance()->Update(key, *value);
+  return true;
+}
+
 }  // namespace
 
 bool KVDB::Put(const std::string &key, const std::string &value) {
   SqliteWraper sqlite;
-  return sqlite.SQL(
+  const bool ret = sqlite.SQL(
       StrCat("INSERT OR REPLACE INTO key_value (key, value) "
              "VALUES ('",
              key, "', '", value, "');"));
+  if (ret) {
+    KVCache::Instance()->Update(key, value);
+  }
+  return ret;
 }
 
 bool KVDB::Delete(const std::string &key) {
   SqliteWraper sqlite;
-  return sqlite.SQL(StrCat("DELETE FROM key_value WHERE key='", key, "';"));
+  const bool ret =
+      sqlite.SQL(StrCat("DELETE FROM key_value WHERE key='", key, "';"));
+  if (ret) {
+    // Empty value means known-absent in the cache.
+    KVCache::Instance()->Update(key, "");
+  }
+  return ret;
 }
 
 bool KVDB::Has(const std::string &key) {
-  SqliteWraper sqlite;
   std::string value;
-  const bool ret = sqlite.SQL(
-      StrCat("SELECT value FROM key_value WHERE key='", key, "';"), &value);
   // Take empty field as non-exist.
-  return ret && !value.empty();
+  return QueryThroughCache(key, &value) && !value.empty();
 }
 
 std::string KVDB::Get(const std::string &key,
                       const std::string &default_value) {
-  SqliteWraper sqlite;
   std::string value;
-  const bool ret = sqlite.SQL(
-      StrCat("SELECT value FROM key_value WHERE key='", key, "';"), &value);
+  const bool ret = QueryThroughCache(key, &value);
   return (ret && !value.empty()) ? value : default_value;
 }
 
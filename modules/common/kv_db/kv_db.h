@@ -30,6 +30,9 @@ namespace common {
  *
  * @brief Lightweight key-value database to store system-wide parameters.
  *        We prefer keys like "apollo:data:commit_id".
+ *        Results are cached in process, so repeated reads never touch the
+ *        DB file again; writes from other processes made after the first
+ *        read of a key are not observed.
  */
 class KVDB {
  public:
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -454,6 +455,47 @@ class AABoxKDTree2d {
     return root_->GetObjects(point, distance);
   }
 
+  /**
+   * @brief Get the nearest object to each point of a batch of target points.
+   *        Queries are traversed in an order sorted along the longer side of
+   *        the bounding box, so consecutive queries revisit subtrees that are
+   *        still warm in cache.
+   * @param points The target points to search nearest objects for.
+   * @return The nearest object of each target point, in input order.
+   */
+  std::vector<ObjectPtr> GetNearestObjects(
+      const std::vector<Vec2d> &points) const {
+    std::vector<ObjectPtr> nearest_objects(points.size(), nullptr);
+    if (root_ == nullptr) {
+      return nearest_objects;
+    }
+    for (const size_t index : SortedQueryOrder(points)) {
+      nearest_objects[index] = root_->GetNearestObject(points[index]);
+    }
+    return nearest_objects;
+  }
+
+  /**
+   * @brief Get objects within a distance to each point of a batch of target
+   *        points, traversed in the same cache-friendly order as
+   *        GetNearestObjects.
+   * @param points The center points of the ranges to search objects.
+   * @param distance The radius of the ranges to search objects.
+   * @return The objects within the specified distance to each target point,
+   *         in input order.
+   */
+  std::vector<std::vector<ObjectPtr>> GetObjects(
+      const std::vector<Vec2d> &points, const double distance) const {
+    std::vector<std::vector<ObjectPtr>> result_objects(points.size());
+    if (root_ == nullptr) {
+      return result_objects;
+    }
+    for (const size_t index : SortedQueryOrder(points)) {
+      result_objects[index] = root_->GetObjects(points[index], distance);
+    }
+    return result_objects;
+  }
+
   /**
    * @brief Get the axis-aligned bounding box of the objects.
    * @return The axis-aligned bounding box of the objects.
@@ -463,6 +505,19 @@ class AABoxKDTree2d {
   }
 
  private:
+  std::vector<size_t> SortedQueryOrder(const std::vector<Vec2d> &points) const {
+    std::vector<size_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    const AABox2d bounding_box = GetBoundingBox();
+    const bool sort_by_x = bounding_box.length() >= bounding_box.width();
+    std::sort(order.begin(), order.end(),
+              [&](const size_t index1, const size_t index2) {
+                return sort_by_x ? points[index1].x() < points[index2].x()
+                                 : points[index1].y() < points[index2].y();
+              });
+    return order;
+  }
+
   std::unique_ptr<AABoxKDTree2dNode<ObjectType>> root_ = nullptr;
 };
 
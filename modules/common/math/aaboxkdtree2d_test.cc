@@ -118,6 +118,47 @@ TEST(AABoxKDTree2dNode, OverallTests) {
   }
 }
 
+TEST(AABoxKDTree2dNode, BatchQueries) {
+  const int kNumBoxes = 50;
+  const int kNumQueries = 100;
+  const double kSize = 100;
+  std::vector<Object> objects;
+  for (int i = 0; i < kNumBoxes; ++i) {
+    const double cx = RandomDouble(-kSize, kSize);
+    const double cy = RandomDouble(-kSize, kSize);
+    const double dx = RandomDouble(-kSize / 10.0, kSize / 10.0);
+    const double dy = RandomDouble(-kSize / 10.0, kSize / 10.0);
+    objects.emplace_back(cx - dx, cy - dy, cx + dx, cy + dy, i);
+  }
+  AABoxKDTree2d<Object> kdtree(objects, AABoxKDTreeParams());
+
+  std::vector<Vec2d> points;
+  for (int i = 0; i < kNumQueries; ++i) {
+    points.emplace_back(RandomDouble(-kSize * 1.5, kSize * 1.5),
+                        RandomDouble(-kSize * 1.5, kSize * 1.5));
+  }
+  const double distance = kSize / 2.0;
+
+  // Batch queries must match the corresponding single-point queries,
+  // in input order.
+  const auto nearest_objects = kdtree.GetNearestObjects(points);
+  const auto range_objects = kdtree.GetObjects(points, distance);
+  ASSERT_EQ(points.size(), nearest_objects.size());
+  ASSERT_EQ(points.size(), range_objects.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(kdtree.GetNearestObject(points[i]), nearest_objects[i]);
+    std::set<int> expected_ids;
+    for (const Object *object : kdtree.GetObjects(points[i], distance)) {
+      expected_ids.insert(object->id());
+    }
+    std::set<int> actual_ids;
+    for (const Object *object : range_objects[i]) {
+      actual_ids.insert(object->id());
+    }
+    EXPECT_EQ(expected_ids, actual_ids);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
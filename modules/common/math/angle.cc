@@ -61,6 +61,19 @@ float tan(Angle8 a) {
   return tan(b);
 }
 
+void SinCosBatch(const float* angles, float* sin_values, float* cos_values,
+                 const std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    // Quantize once and serve both functions from the table. The addition
+    // below wraps around like Angle16 arithmetic does.
+    const int16_t raw =
+        static_cast<int16_t>(std::lround(angles[i] * Angle16::RAD_TO_RAW));
+    sin_values[i] = sin(Angle16(raw));
+    cos_values[i] = sin(
+        Angle16(static_cast<int16_t>(Angle16::RAW_PI_2 - raw)));
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
@@ -276,6 +277,19 @@ float sin(Angle8 a);
 float cos(Angle8 a);
 float tan(Angle8 a);
 
+/**
+ * @brief Computes sine and cosine of a batch of angles through the Angle16
+ * lookup table, so inner loops can drop per-element libm calls. The results
+ * carry Angle16 precision, which is sufficient for localization and object
+ * detection.
+ * @param angles Angles in radians, within [-pi, pi)
+ * @param sin_values Output array for the sines, of the same length
+ * @param cos_values Output array for the cosines, of the same length
+ * @param size Number of angles
+ */
+void SinCosBatch(const float* angles, float* sin_values, float* cos_values,
+                 std::size_t size);
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -53,6 +53,19 @@ TEST(Angle, Angle32) {
   EXPECT_NEAR(1.0, a.to_rad(), 1e-9);
 }
 
+TEST(Angle, SinCosBatch) {
+  const float angles[] = {-3.0f, -static_cast<float>(M_PI_2), -0.5f, 0.0f,
+                          0.5f,  static_cast<float>(M_PI_2),  3.0f};
+  constexpr size_t kSize = sizeof(angles) / sizeof(angles[0]);
+  float sin_values[kSize];
+  float cos_values[kSize];
+  SinCosBatch(angles, sin_values, cos_values, kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    EXPECT_NEAR(std::sin(angles[i]), sin_values[i], 1e-4);
+    EXPECT_NEAR(std::cos(angles[i]), cos_values[i], 1e-4);
+  }
+}
+
 TEST(Angle, operators) {
   auto a = Angle16::from_deg(100.0);
   auto b = a;
@@ -85,6 +85,30 @@ void CartesianFrenetConverter::cartesian_to_frenet(
   return;
 }
 
+void CartesianFrenetConverter::cartesian_to_frenet(
+    const std::vector<double>& rs, const std::vector<double>& rx,
+    const std::vector<double>& ry, const std::vector<double>& rtheta,
+    const std::vector<double>& x, const std::vector<double>& y,
+    std::vector<double>* const ptr_s, std::vector<double>* const ptr_d) {
+  const std::size_t num_points = rs.size();
+  DCHECK_EQ(rx.size(), num_points);
+  DCHECK_EQ(ry.size(), num_points);
+  DCHECK_EQ(rtheta.size(), num_points);
+  DCHECK_EQ(x.size(), num_points);
+  DCHECK_EQ(y.size(), num_points);
+
+  ptr_s->resize(num_points);
+  ptr_d->resize(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const double dx = x[i] - rx[i];
+    const double dy = y[i] - ry[i];
+    const double cross_rd_nd =
+        std::cos(rtheta[i]) * dy - std::sin(rtheta[i]) * dx;
+    (*ptr_s)[i] = rs[i];
+    (*ptr_d)[i] = std::copysign(std::sqrt(dx * dx + dy * dy), cross_rd_nd);
+  }
+}
+
 void CartesianFrenetConverter::frenet_to_cartesian(
     const double rs, const double rx, const double ry, const double rtheta,
     const double rkappa, const double rdkappa,
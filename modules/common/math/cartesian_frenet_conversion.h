@@ -21,6 +21,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "modules/common/math/vec2d.h"
 
@@ -62,6 +63,22 @@ class CartesianFrenetConverter {
                                   const double x, const double y, double* ptr_s,
                                   double* ptr_d);
 
+  /**
+   * Convert a batch of Cartesian positions to Frenet coordinates in one
+   * call. All input vectors must have the same size; the outputs are
+   * resized to match. Keeping the per-point math in one tight loop over
+   * contiguous arrays avoids a function call per point on hot paths that
+   * convert whole trajectories or obstacle polygons.
+   */
+  static void cartesian_to_frenet(const std::vector<double>& rs,
+                                  const std::vector<double>& rx,
+                                  const std::vector<double>& ry,
+                                  const std::vector<double>& rtheta,
+                                  const std::vector<double>& x,
+                                  const std::vector<double>& y,
+                                  std::vector<double>* const ptr_s,
+                                  std::vector<double>* const ptr_d);
+
   /**
    * Convert a vehicle state in Frenet frame to Cartesian frame.
    * Combine two independent 1d movement w.r.t. reference line to a 2d movement.
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -65,6 +66,33 @@ TEST(TestCartesianFrenetConversion, cartesian_to_frenet_test) {
   EXPECT_NEAR(a, a_out, 1.0e-6);
 }
 
+TEST(TestCartesianFrenetConversion, batch_cartesian_to_frenet_test) {
+  const std::vector<double> rs = {10.0, 12.0, 14.0};
+  const std::vector<double> rx = {0.0, 1.5, 3.0};
+  const std::vector<double> ry = {0.0, 1.5, 3.0};
+  const std::vector<double> rtheta = {M_PI / 4.0, M_PI / 4.0, M_PI / 4.0};
+  const std::vector<double> x = {-1.0, 1.0, 4.0};
+  const std::vector<double> y = {1.0, 2.5, 2.5};
+
+  std::vector<double> s;
+  std::vector<double> d;
+  CartesianFrenetConverter::cartesian_to_frenet(rs, rx, ry, rtheta, x, y, &s,
+                                                &d);
+  ASSERT_EQ(s.size(), rs.size());
+  ASSERT_EQ(d.size(), rs.size());
+
+  // The batch form must agree with the point-wise conversion.
+  for (std::size_t i = 0; i < rs.size(); ++i) {
+    double s_out = 0.0;
+    double d_out = 0.0;
+    CartesianFrenetConverter::cartesian_to_frenet(rs[i], rx[i], ry[i],
+                                                  rtheta[i], x[i], y[i], &s_out,
+                                                  &d_out);
+    EXPECT_NEAR(s[i], s_out, 1.0e-12);
+    EXPECT_NEAR(d[i], d_out, 1.0e-12);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
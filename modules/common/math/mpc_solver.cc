@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <memory>
 
+#include "Eigen/Dense"
 #include "cyber/common/log.h"
 #include "modules/common/math/qp_solver/active_set_qp_solver.h"
 #include "modules/common/math/qp_solver/qp_solver.h"
@@ -27,6 +28,68 @@ namespace math {
 
 using Matrix = Eigen::MatrixXd;
 
+namespace {
+
+constexpr double kBoundTolerance = 1e-9;
+
+// Solve the mpc problem without the control bounds by a backward Riccati
+// recursion over the stage-wise (banded) form of the problem, so the cost
+// grows linearly with the horizon instead of cubically as for the
+// condensed dense form. Return false if the unconstrained optimum
+// violates the bounds; the caller then falls back to the constrained QP.
+bool SolveUnconstrainedLinearMPC(
+    const Matrix &matrix_a, const Matrix &matrix_b, const Matrix &matrix_c,
+    const Matrix &matrix_q, const Matrix &matrix_r, const Matrix &matrix_lower,
+    const Matrix &matrix_upper, const Matrix &matrix_initial_state,
+    const std::vector<Matrix> &reference, std::vector<Matrix> *control) {
+  const int horizon = static_cast<int>(reference.size());
+
+  std::vector<Matrix> feedback_gains(horizon);
+  std::vector<Matrix> feedforward_terms(horizon);
+
+  // cost-to-go V(x) = x^T * P * x + 2 * p^T * x + const
+  Matrix matrix_p = matrix_q;
+  Matrix vector_p = -matrix_q * reference[horizon - 1];
+  for (int i = horizon - 1; i >= 0; --i) {
+    const Matrix matrix_h_inverse =
+        (matrix_r + matrix_b.transpose() * matrix_p * matrix_b).inverse();
+    feedback_gains[i] =
+        matrix_h_inverse * matrix_b.transpose() * matrix_p * matrix_a;
+    feedforward_terms[i] = matrix_h_inverse * matrix_b.transpose() *
+                           (matrix_p * matrix_c + vector_p);
+    const Matrix matrix_a_closed = matrix_a - matrix_b * feedback_gains[i];
+    vector_p = matrix_a_closed.transpose() * (matrix_p * matrix_c + vector_p);
+    matrix_p = matrix_a.transpose() * matrix_p * matrix_a_closed;
+    if (i > 0) {
+      matrix_p += matrix_q;
+      vector_p -= matrix_q * reference[i - 1];
+    }
+  }
+
+  std::vector<Matrix> unconstrained_control(horizon);
+  Matrix state = matrix_initial_state;
+  for (int i = 0; i < horizon; ++i) {
+    unconstrained_control[i] =
+        -feedback_gains[i] * state - feedforward_terms[i];
+    for (int j = 0; j < unconstrained_control[i].rows(); ++j) {
+      if (unconstrained_control[i](j, 0) <
+              matrix_lower(j, 0) - kBoundTolerance ||
+          unconstrained_control[i](j, 0) >
+              matrix_upper(j, 0) + kBoundTolerance) {
+        return false;
+      }
+    }
+    state = matrix_a * state + matrix_b * unconstrained_control[i] + matrix_c;
+  }
+
+  for (int i = 0; i < horizon; ++i) {
+    (*control)[i] = unconstrained_control[i];
+  }
+  return true;
+}
+
+}  // namespace
+
 // discrete linear predictive control solver, with control format
 // x(i + 1) = A * x(i) + B * u (i) + C
 bool SolveLinearMPC(const Matrix &matrix_a, const Matrix &matrix_b,
@@ -45,6 +108,16 @@ bool SolveLinearMPC(const Matrix &matrix_a, const Matrix &matrix_b,
 
   size_t horizon = static_cast<size_t>(reference.size());
 
+  // Most control cycles keep the control bounds inactive; the
+  // unconstrained optimum is then also the optimum of the constrained
+  // problem and the Riccati recursion finds it far cheaper than the
+  // condensed QP below.
+  if (SolveUnconstrainedLinearMPC(matrix_a, matrix_b, matrix_c, matrix_q,
+                                  matrix_r, matrix_lower, matrix_upper,
+                                  matrix_initial_state, reference, control)) {
+    return true;
+  }
+
   // Update augment reference matrix_t
   Matrix matrix_t = Matrix::Zero(matrix_b.rows() * horizon, 1);
   for (size_t j = 0; j < horizon; ++j) {
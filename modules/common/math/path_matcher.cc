@@ -22,9 +22,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include "glog/logging.h"
+#include "modules/common/math/cartesian_frenet_conversion.h"
 #include "modules/common/math/linear_interpolation.h"
 
 namespace apollo {
@@ -82,6 +85,70 @@ std::pair<double, double> PathMatcher::GetPathFrenetCoordinate(
   return relative_coordinate;
 }
 
+std::vector<std::pair<double, double>> PathMatcher::GetPathFrenetCoordinates(
+    const std::vector<PathPoint>& reference_line,
+    const std::vector<Vec2d>& points) {
+  CHECK_GT(reference_line.size(), 0);
+
+  // Flatten the reference line coordinates once so the nearest-point scan
+  // below runs over contiguous doubles instead of proto accessors; the
+  // flattening cost is amortized over all query points.
+  const std::size_t num_ref_points = reference_line.size();
+  std::vector<double> ref_x(num_ref_points);
+  std::vector<double> ref_y(num_ref_points);
+  for (std::size_t i = 0; i < num_ref_points; ++i) {
+    ref_x[i] = reference_line[i].x();
+    ref_y[i] = reference_line[i].y();
+  }
+
+  const std::size_t num_points = points.size();
+  std::vector<double> rs(num_points);
+  std::vector<double> rx(num_points);
+  std::vector<double> ry(num_points);
+  std::vector<double> rtheta(num_points);
+  std::vector<double> x(num_points);
+  std::vector<double> y(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    x[i] = points[i].x();
+    y[i] = points[i].y();
+
+    double distance_min = std::numeric_limits<double>::max();
+    std::size_t index_min = 0;
+    for (std::size_t j = 0; j < num_ref_points; ++j) {
+      const double dx = ref_x[j] - x[i];
+      const double dy = ref_y[j] - y[i];
+      const double distance_temp = dx * dx + dy * dy;
+      if (distance_temp < distance_min) {
+        distance_min = distance_temp;
+        index_min = j;
+      }
+    }
+
+    std::size_t index_start = (index_min == 0) ? index_min : index_min - 1;
+    std::size_t index_end =
+        (index_min + 1 == num_ref_points) ? index_min : index_min + 1;
+    const PathPoint matched_path_point =
+        (index_start == index_end)
+            ? reference_line[index_start]
+            : FindProjectionPoint(reference_line[index_start],
+                                  reference_line[index_end], x[i], y[i]);
+    rs[i] = matched_path_point.s();
+    rx[i] = matched_path_point.x();
+    ry[i] = matched_path_point.y();
+    rtheta[i] = matched_path_point.theta();
+  }
+
+  std::vector<double> s;
+  std::vector<double> d;
+  CartesianFrenetConverter::cartesian_to_frenet(rs, rx, ry, rtheta, x, y, &s,
+                                                &d);
+  std::vector<std::pair<double, double>> frenet_coordinates(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    frenet_coordinates[i] = std::make_pair(s[i], d[i]);
+  }
+  return frenet_coordinates;
+}
+
 PathPoint PathMatcher::MatchToPath(const std::vector<PathPoint>& reference_line,
                                    const double s) {
   auto comp = [](const PathPoint& point, const double s) {
@@ -25,6 +25,8 @@
 
 #include "modules/common/proto/pnc_point.pb.h"
 
+#include "modules/common/math/vec2d.h"
+
 namespace apollo {
 namespace common {
 namespace math {
@@ -40,6 +42,15 @@ class PathMatcher {
       const std::vector<PathPoint>& reference_line, const double x,
       const double y);
 
+  /**
+   * @brief batch version of GetPathFrenetCoordinate; the reference line
+   * coordinates are flattened once so every query point is matched against
+   * contiguous arrays instead of re-reading the path point protos.
+   */
+  static std::vector<std::pair<double, double>> GetPathFrenetCoordinates(
+      const std::vector<PathPoint>& reference_line,
+      const std::vector<Vec2d>& points);
+
   static PathPoint MatchToPath(const std::vector<PathPoint>& reference_line,
                                const double s);
 
@@ -301,23 +301,22 @@ bool Polygon2d::ClipConvexHull(const LineSegment2d &line_segment,
     return false;
   }
   std::vector<double> prod(n);
-  std::vector<int> side(n);
   for (size_t i = 0; i < n; ++i) {
     prod[i] = CrossProd(line_segment.start(), line_segment.end(), (*points)[i]);
-    if (std::abs(prod[i]) <= kMathEpsilon) {
-      side[i] = 0;
-    } else {
-      side[i] = ((prod[i] < 0) ? -1 : 1);
-    }
   }
+  const auto side_of = [](const double p) {
+    return std::abs(p) <= kMathEpsilon ? 0 : ((p < 0) ? -1 : 1);
+  };
 
   std::vector<Vec2d> new_points;
+  new_points.reserve(n + 1);
   for (size_t i = 0; i < n; ++i) {
-    if (side[i] >= 0) {
+    const int side_i = side_of(prod[i]);
+    if (side_i >= 0) {
       new_points.push_back((*points)[i]);
     }
     const size_t j = ((i == n - 1) ? 0 : (i + 1));
-    if (side[i] * side[j] < 0) {
+    if (side_i * side_of(prod[j]) < 0) {
       const double ratio = prod[j] / (prod[j] - prod[i]);
       new_points.emplace_back(
           (*points)[i].x() * ratio + (*points)[j].x() * (1.0 - ratio),
@@ -334,6 +333,10 @@ bool Polygon2d::ComputeOverlap(const Polygon2d &other_polygon,
   CHECK_GE(points_.size(), 3);
   CHECK_NOTNULL(overlap_polygon);
   CHECK(is_convex_ && other_polygon.is_convex());
+  if (other_polygon.max_x() < min_x_ || other_polygon.min_x() > max_x_ ||
+      other_polygon.max_y() < min_y_ || other_polygon.min_y() > max_y_) {
+    return false;
+  }
   std::vector<Vec2d> points = other_polygon.points();
   for (int i = 0; i < num_points_; ++i) {
     if (!ClipConvexHull(line_segments_[i], &points)) {
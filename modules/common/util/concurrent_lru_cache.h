@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "modules/common/util/lru_cache.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+/**
+ * @class ConcurrentLRUCache
+ * @brief A sharded LRU cache safe for concurrent use. Keys are hashed onto a
+ * fixed number of shards, each an LRUCache behind its own mutex, so accesses
+ * to different shards never contend on the same lock. Values are copied in
+ * and out to keep lifetimes independent of eviction; use a pointer-like value
+ * type such as std::shared_ptr for large payloads.
+ */
+template <class K, class V>
+class ConcurrentLRUCache {
+ public:
+  explicit ConcurrentLRUCache(const size_t capacity,
+                              const size_t shard_num = kDefaultShardNum)
+      : shard_num_(shard_num > 0 ? shard_num : 1) {
+    const size_t shard_capacity = (capacity + shard_num_ - 1) / shard_num_;
+    shards_.reserve(shard_num_);
+    for (size_t i = 0; i < shard_num_; ++i) {
+      shards_.emplace_back(new Shard(shard_capacity));
+    }
+  }
+
+  /**
+   * @brief Add the value of the key, or refresh it if the key exists.
+   */
+  void Put(const K& key, const V& val) {
+    auto& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache.Put(key, val);
+  }
+
+  /**
+   * @brief Copy the value of the key out and mark it as recently used.
+   * @return Whether the key was found.
+   */
+  bool Get(const K& key, V* const val) {
+    auto& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.GetCopy(key, val);
+  }
+
+  /**
+   * @brief Copy the value of the key out without touching its recency.
+   * @return Whether the key was found.
+   */
+  bool GetSilently(const K& key, V* const val) {
+    auto& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.GetCopySilently(key, val);
+  }
+
+  bool Contains(const K& key) {
+    auto& shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.Contains(key);
+  }
+
+  size_t size() {
+    size_t total = 0;
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      total += shard->cache.size();
+    }
+    return total;
+  }
+
+  void Clear() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache.Clear();
+    }
+  }
+
+ private:
+  static constexpr size_t kDefaultShardNum = 16;
+
+  struct Shard {
+    explicit Shard(const size_t capacity) : cache(capacity) {}
+    std::mutex mutex;
+    LRUCache<K, V> cache;
+  };
+
+  Shard& ShardOf(const K& key) {
+    return *shards_[std::hash<K>()(key) % shard_num_];
+  }
+
+  const size_t shard_num_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
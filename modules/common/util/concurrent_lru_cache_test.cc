@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/util/concurrent_lru_cache.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+TEST(ConcurrentLRUCache, General) {
+  ConcurrentLRUCache<int, int> cache(64);
+  EXPECT_EQ(0, cache.size());
+
+  for (int i = 0; i < 32; ++i) {
+    cache.Put(i, i * i);
+  }
+  EXPECT_EQ(32, cache.size());
+
+  int val = 0;
+  for (int i = 0; i < 32; ++i) {
+    EXPECT_TRUE(cache.Contains(i));
+    EXPECT_TRUE(cache.Get(i, &val));
+    EXPECT_EQ(i * i, val);
+  }
+  EXPECT_FALSE(cache.Get(32, &val));
+  EXPECT_FALSE(cache.Contains(32));
+
+  cache.Clear();
+  EXPECT_EQ(0, cache.size());
+  EXPECT_FALSE(cache.Get(0, &val));
+}
+
+TEST(ConcurrentLRUCache, Eviction) {
+  // One shard makes the LRU order deterministic.
+  ConcurrentLRUCache<int, int> cache(4, 1);
+  for (int i = 0; i < 6; ++i) {
+    cache.Put(i, i);
+  }
+  EXPECT_EQ(4, cache.size());
+  int val = 0;
+  EXPECT_FALSE(cache.Get(0, &val));
+  EXPECT_FALSE(cache.Get(1, &val));
+  for (int i = 2; i < 6; ++i) {
+    EXPECT_TRUE(cache.Get(i, &val));
+    EXPECT_EQ(i, val);
+  }
+}
+
+TEST(ConcurrentLRUCache, ConcurrentAccess) {
+  static constexpr int kThreadNum = 4;
+  static constexpr int kKeyNum = 256;
+  ConcurrentLRUCache<int, int> cache(kKeyNum);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads.emplace_back([&cache]() {
+      int val = 0;
+      for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < kKeyNum; ++i) {
+          cache.Put(i, i);
+          if (cache.Get(i, &val)) {
+            EXPECT_EQ(i, val);
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  int val = 0;
+  for (int i = 0; i < kKeyNum; ++i) {
+    EXPECT_TRUE(cache.Get(i, &val));
+    EXPECT_EQ(i, val);
+  }
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,234 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Serialization cost tracking for the protos that cross process boundaries
+// most often: perception obstacles, prediction, the planning trajectory and
+// lidar point clouds. Run after any schema change to one of these messages:
+//   bazel run //modules/common/util:message_serialization_benchmark -- \
+//       --benchmark_format=json > baseline.json
+// and diff the json against the previous baseline at review time. Each
+// serialize benchmark also reports the wire size of its corpus message in
+// the label, so size regressions show up in the same diff as time
+// regressions.
+
+#include <cmath>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "google/protobuf/arena.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+
+#include "modules/drivers/proto/pointcloud.pb.h"
+#include "modules/perception/proto/perception_obstacle.pb.h"
+#include "modules/planning/proto/planning.pb.h"
+#include "modules/prediction/proto/prediction_obstacle.pb.h"
+
+namespace apollo {
+namespace common {
+namespace {
+
+template <typename MessageT>
+const MessageT* LoadCorpus(const std::string& path) {
+  auto* message = new MessageT();
+  CHECK(cyber::common::GetProtoFromFile(path, message))
+      << "Failed to load corpus from " << path;
+  return message;
+}
+
+const perception::PerceptionObstacles& PerceptionObstaclesCorpus() {
+  static const auto* corpus = LoadCorpus<perception::PerceptionObstacles>(
+      "modules/prediction/testdata/perception_vehicles_pedestrians.pb.txt");
+  return *corpus;
+}
+
+const prediction::PredictionObstacles& PredictionObstaclesCorpus() {
+  static const auto* corpus = LoadCorpus<prediction::PredictionObstacles>(
+      "modules/planning/testdata/sunnyvale_loop_test/2_prediction.pb.txt");
+  return *corpus;
+}
+
+const planning::ADCTrajectory& ADCTrajectoryCorpus() {
+  static const auto* corpus = LoadCorpus<planning::ADCTrajectory>(
+      "modules/planning/testdata/sunnyvale_loop_test/"
+      "result_avoid_change_left_0.pb.txt");
+  return *corpus;
+}
+
+// No recorded PointCloud instance lives in the tree (the localization point
+// clouds are stored in PCL format), so build one at typical 64-beam density
+// instead; the schema cost is what the benchmark tracks.
+const drivers::PointCloud& PointCloudCorpus() {
+  static const auto* corpus = []() {
+    auto* cloud = new drivers::PointCloud();
+    cloud->mutable_header()->set_timestamp_sec(1501183430.16);
+    cloud->mutable_header()->set_module_name("velodyne");
+    cloud->set_frame_id("velodyne64");
+    cloud->set_is_dense(false);
+    cloud->set_measurement_time(1501183430.16);
+    cloud->set_width(1800);
+    cloud->set_height(64);
+    constexpr int kNumPoints = 64 * 1800;
+    constexpr uint64_t kStartStamp = 1501183430161906000ULL;
+    for (int i = 0; i < kNumPoints; ++i) {
+      auto* point = cloud->add_point();
+      const float angle = 0.0035f * static_cast<float>(i);
+      const float range = 10.0f + static_cast<float>(i % 64);
+      point->set_x(range * std::cos(angle));
+      point->set_y(range * std::sin(angle));
+      point->set_z(-1.8f + 0.05f * static_cast<float>(i % 64));
+      point->set_intensity(i % 255);
+      point->set_timestamp(kStartStamp + static_cast<uint64_t>(i) * 1736);
+    }
+    return cloud;
+  }();
+  return *corpus;
+}
+
+template <typename MessageT>
+void SerializeLoop(const MessageT& message, benchmark::State* state) {
+  std::string wire;
+  while (state->KeepRunning()) {
+    wire.clear();
+    message.SerializeToString(&wire);
+  }
+  state->SetLabel("wire_bytes=" + std::to_string(wire.size()));
+  state->SetBytesProcessed(state->iterations() *
+                           static_cast<int64_t>(wire.size()));
+}
+
+template <typename MessageT>
+void ParseLoop(const MessageT& message, benchmark::State* state) {
+  std::string wire;
+  message.SerializeToString(&wire);
+  MessageT parsed;
+  while (state->KeepRunning()) {
+    parsed.ParseFromString(wire);
+  }
+  state->SetBytesProcessed(state->iterations() *
+                           static_cast<int64_t>(wire.size()));
+}
+
+template <typename MessageT>
+void CopyLoop(const MessageT& message, benchmark::State* state) {
+  MessageT copy;
+  while (state->KeepRunning()) {
+    copy.CopyFrom(message);
+  }
+}
+
+// Our protos are not compiled with cc_enable_arenas yet, so today this
+// matches heap parsing; the benchmark exists so the gain (or lack of it)
+// is visible in the baseline diff once arenas are turned on for a message.
+template <typename MessageT>
+void ArenaParseLoop(const MessageT& message, benchmark::State* state) {
+  std::string wire;
+  message.SerializeToString(&wire);
+  while (state->KeepRunning()) {
+    google::protobuf::Arena arena;
+    auto* parsed = google::protobuf::Arena::CreateMessage<MessageT>(&arena);
+    parsed->ParseFromString(wire);
+  }
+  state->SetBytesProcessed(state->iterations() *
+                           static_cast<int64_t>(wire.size()));
+}
+
+void BM_PerceptionObstaclesSerialize(benchmark::State& state) {
+  SerializeLoop(PerceptionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PerceptionObstaclesSerialize);
+
+void BM_PerceptionObstaclesParse(benchmark::State& state) {
+  ParseLoop(PerceptionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PerceptionObstaclesParse);
+
+void BM_PerceptionObstaclesCopy(benchmark::State& state) {
+  CopyLoop(PerceptionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PerceptionObstaclesCopy);
+
+void BM_PerceptionObstaclesArenaParse(benchmark::State& state) {
+  ArenaParseLoop(PerceptionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PerceptionObstaclesArenaParse);
+
+void BM_PredictionObstaclesSerialize(benchmark::State& state) {
+  SerializeLoop(PredictionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PredictionObstaclesSerialize);
+
+void BM_PredictionObstaclesParse(benchmark::State& state) {
+  ParseLoop(PredictionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PredictionObstaclesParse);
+
+void BM_PredictionObstaclesCopy(benchmark::State& state) {
+  CopyLoop(PredictionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PredictionObstaclesCopy);
+
+void BM_PredictionObstaclesArenaParse(benchmark::State& state) {
+  ArenaParseLoop(PredictionObstaclesCorpus(), &state);
+}
+BENCHMARK(BM_PredictionObstaclesArenaParse);
+
+void BM_ADCTrajectorySerialize(benchmark::State& state) {
+  SerializeLoop(ADCTrajectoryCorpus(), &state);
+}
+BENCHMARK(BM_ADCTrajectorySerialize);
+
+void BM_ADCTrajectoryParse(benchmark::State& state) {
+  ParseLoop(ADCTrajectoryCorpus(), &state);
+}
+BENCHMARK(BM_ADCTrajectoryParse);
+
+void BM_ADCTrajectoryCopy(benchmark::State& state) {
+  CopyLoop(ADCTrajectoryCorpus(), &state);
+}
+BENCHMARK(BM_ADCTrajectoryCopy);
+
+void BM_ADCTrajectoryArenaParse(benchmark::State& state) {
+  ArenaParseLoop(ADCTrajectoryCorpus(), &state);
+}
+BENCHMARK(BM_ADCTrajectoryArenaParse);
+
+void BM_PointCloudSerialize(benchmark::State& state) {
+  SerializeLoop(PointCloudCorpus(), &state);
+}
+BENCHMARK(BM_PointCloudSerialize);
+
+void BM_PointCloudParse(benchmark::State& state) {
+  ParseLoop(PointCloudCorpus(), &state);
+}
+BENCHMARK(BM_PointCloudParse);
+
+void BM_PointCloudCopy(benchmark::State& state) {
+  CopyLoop(PointCloudCorpus(), &state);
+}
+BENCHMARK(BM_PointCloudCopy);
+
+void BM_PointCloudArenaParse(benchmark::State& state) {
+  ArenaParseLoop(PointCloudCorpus(), &state);
+}
+BENCHMARK(BM_PointCloudArenaParse);
+
+}  // namespace
+}  // namespace common
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -90,16 +90,30 @@ std::vector<size_t> DownsampleByAngle(const Points &points,
   }
   sampled_indices.push_back(0);
   if (points.size() > 1) {
-    size_t start = 0;
     size_t end = 1;
     double accum_degree = 0.0;
+    // Cache the direction at the last sampled point; it only changes when a
+    // new point is sampled, so each point costs one hypot and one acos.
+    double vec_start_x = points[1].x() - points[0].x();
+    double vec_start_y = points[1].y() - points[0].y();
+    double vec_start_norm = std::hypot(vec_start_x, vec_start_y);
     while (end + 1 < points.size()) {
-      const double angle = GetPathAngle(points, start, end);
-      accum_degree += std::fabs(angle);
+      const double vec_end_x = points[end + 1].x() - points[end].x();
+      const double vec_end_y = points[end + 1].y() - points[end].y();
+      const double vec_end_norm = std::hypot(vec_end_x, vec_end_y);
+      const double dot_product =
+          vec_start_x * vec_end_x + vec_start_y * vec_end_y;
+      const double angle =
+          std::acos(dot_product / (vec_start_norm * vec_end_norm));
+      if (!std::isnan(angle)) {
+        accum_degree += std::fabs(angle);
+      }
 
       if (accum_degree > angle_threshold) {
         sampled_indices.push_back(end);
-        start = end;
+        vec_start_x = vec_end_x;
+        vec_start_y = vec_end_y;
+        vec_start_norm = vec_end_norm;
         accum_degree = 0.0;
       }
       ++end;
@@ -16,7 +16,9 @@
 
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 
+#include <atomic>
 #include <cmath>
+#include <utility>
 
 #include "Eigen/Core"
 
@@ -75,9 +77,30 @@ Status VehicleStateProvider::Update(
 
   vehicle_state_.set_driving_mode(chassis.driving_mode());
 
+  UpdateDeadReckoningCoefficients();
+
   return Status::OK();
 }
 
+void VehicleStateProvider::UpdateDeadReckoningCoefficients() {
+  auto coefficients = std::make_shared<DeadReckoningCoefficients>();
+  coefficients->timestamp = vehicle_state_.timestamp();
+  coefficients->linear_velocity = vehicle_state_.linear_velocity();
+  coefficients->angular_velocity = vehicle_state_.angular_velocity();
+  coefficients->position = Eigen::Vector3d(
+      vehicle_state_.x(), vehicle_state_.y(), vehicle_state_.z());
+  if (vehicle_state_.pose().has_orientation()) {
+    const auto &orientation = vehicle_state_.pose().orientation();
+    Eigen::Quaternion<double> quaternion(orientation.qw(), orientation.qx(),
+                                         orientation.qy(), orientation.qz());
+    coefficients->rotation = quaternion.toRotationMatrix();
+    coefficients->has_orientation = true;
+  }
+  std::atomic_store(&dead_reckoning_,
+                    std::shared_ptr<const DeadReckoningCoefficients>(
+                        std::move(coefficients)));
+}
+
 bool VehicleStateProvider::ConstructExceptLinearVelocity(
     const localization::LocalizationEstimate &localization) {
   if (!localization.has_pose()) {
@@ -201,34 +224,45 @@ const VehicleState &VehicleStateProvider::vehicle_state() const {
 }
 
 math::Vec2d VehicleStateProvider::EstimateFuturePosition(const double t) const {
+  const auto coefficients = std::atomic_load(&dead_reckoning_);
+  if (coefficients == nullptr) {
+    // Update() has not run yet; the default state has zero velocity, so the
+    // future position is the current one.
+    return math::Vec2d(vehicle_state_.x(), vehicle_state_.y());
+  }
+
   Eigen::Vector3d vec_distance(0.0, 0.0, 0.0);
-  double v = vehicle_state_.linear_velocity();
+  const double v = coefficients->linear_velocity;
+  const double omega = coefficients->angular_velocity;
   // Predict distance travel vector
-  if (std::fabs(vehicle_state_.angular_velocity()) < 0.0001) {
+  if (std::fabs(omega) < 0.0001) {
     vec_distance[0] = 0.0;
     vec_distance[1] = v * t;
   } else {
-    vec_distance[0] = -v / vehicle_state_.angular_velocity() *
-                      (1.0 - std::cos(vehicle_state_.angular_velocity() * t));
-    vec_distance[1] = std::sin(vehicle_state_.angular_velocity() * t) * v /
-                      vehicle_state_.angular_velocity();
+    vec_distance[0] = -v / omega * (1.0 - std::cos(omega * t));
+    vec_distance[1] = std::sin(omega * t) * v / omega;
   }
 
   // If we have rotation information, take it into consideration.
-  if (vehicle_state_.pose().has_orientation()) {
-    const auto &orientation = vehicle_state_.pose().orientation();
-    Eigen::Quaternion<double> quaternion(orientation.qw(), orientation.qx(),
-                                         orientation.qy(), orientation.qz());
-    Eigen::Vector3d pos_vec(vehicle_state_.x(), vehicle_state_.y(),
-                            vehicle_state_.z());
-    auto future_pos_3d = quaternion.toRotationMatrix() * vec_distance + pos_vec;
+  if (coefficients->has_orientation) {
+    auto future_pos_3d =
+        coefficients->rotation * vec_distance + coefficients->position;
     return math::Vec2d(future_pos_3d[0], future_pos_3d[1]);
   }
 
   // If no valid rotation information provided from localization,
   // return the estimated future position without rotation.
-  return math::Vec2d(vec_distance[0] + vehicle_state_.x(),
-                     vec_distance[1] + vehicle_state_.y());
+  return math::Vec2d(vec_distance[0] + coefficients->position[0],
+                     vec_distance[1] + coefficients->position[1]);
+}
+
+math::Vec2d VehicleStateProvider::EstimatePositionAtTime(
+    const double timestamp) const {
+  const auto coefficients = std::atomic_load(&dead_reckoning_);
+  if (coefficients == nullptr) {
+    return math::Vec2d(vehicle_state_.x(), vehicle_state_.y());
+  }
+  return EstimateFuturePosition(timestamp - coefficients->timestamp);
 }
 
 math::Vec2d VehicleStateProvider::ComputeCOMPosition(
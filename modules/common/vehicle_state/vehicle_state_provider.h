@@ -23,6 +23,8 @@
 #include <memory>
 #include <string>
 
+#include "Eigen/Core"
+
 #include "cyber/common/macros.h"
 
 #include "modules/canbus/proto/chassis.pb.h"
@@ -167,6 +169,16 @@ class VehicleStateProvider {
    */
   math::Vec2d EstimateFuturePosition(const double t) const;
 
+  /**
+   * @brief Estimate the vehicle position at an absolute timestamp near the
+   *        latest update, using the dead-reckoning coefficients precomputed
+   *        in Update(). Intended for consumers that read state mid-cycle
+   *        and want to compensate the staleness of the last localization.
+   * @param timestamp The absolute query time in seconds.
+   * @return The estimated position at the given timestamp.
+   */
+  math::Vec2d EstimatePositionAtTime(const double timestamp) const;
+
   /**
    * @brief Compute the position of center of mass(COM) of the vehicle,
    *        given the distance from rear wheels to the center of mass.
@@ -182,8 +194,26 @@ class VehicleStateProvider {
   bool ConstructExceptLinearVelocity(
       const localization::LocalizationEstimate& localization);
 
+  // Dead-reckoning coefficients derived once per Update() so that every
+  // future-pose query is a constant-time evaluation: the body-to-world
+  // rotation is already a matrix and the circular-arc terms only need the
+  // cached speed and yaw rate. Published as an immutable snapshot through
+  // an atomic shared_ptr swap, so readers on other threads get a
+  // consistent state without locking.
+  struct DeadReckoningCoefficients {
+    double timestamp = 0.0;
+    double linear_velocity = 0.0;
+    double angular_velocity = 0.0;
+    Eigen::Vector3d position{0.0, 0.0, 0.0};
+    Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+    bool has_orientation = false;
+  };
+
+  void UpdateDeadReckoningCoefficients();
+
   common::VehicleState vehicle_state_;
   localization::LocalizationEstimate original_localization_;
+  std::shared_ptr<const DeadReckoningCoefficients> dead_reckoning_;
 
   DECLARE_SINGLETON(VehicleStateProvider)
 };
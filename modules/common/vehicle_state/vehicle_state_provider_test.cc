@@ -78,6 +78,20 @@ TEST_F(VehicleStateProviderTest, EstimateFuturePosition) {
   EXPECT_NEAR(future_position.y(), 90.393, 1e-3);
 }
 
+TEST_F(VehicleStateProviderTest, EstimatePositionAtTime) {
+  auto vehicle_state_provider = VehicleStateProvider::Instance();
+  vehicle_state_provider->Update(localization_, chassis_);
+  // A query at an absolute timestamp matches the relative-time estimate.
+  const double timestamp = vehicle_state_provider->timestamp();
+  common::math::Vec2d position =
+      vehicle_state_provider->EstimatePositionAtTime(timestamp + 1.0);
+  EXPECT_NEAR(position.x(), 356.707, 1e-3);
+  EXPECT_NEAR(position.y(), 93.276, 1e-3);
+  position = vehicle_state_provider->EstimatePositionAtTime(timestamp);
+  EXPECT_NEAR(position.x(), vehicle_state_provider->x(), 1e-6);
+  EXPECT_NEAR(position.y(), vehicle_state_provider->y(), 1e-6);
+}
+
 }  // namespace vehicle_state_provider
 }  // namespace common
 }  // namespace apollo
@@ -56,3 +56,18 @@ DEFINE_int32(pad_msg_pending_queue_size, 10,
              "Max pad message pending queue size");
 
 DEFINE_bool(reverse_heading_control, false, "test vehicle reverse control");
+
+DEFINE_int32(latency_report_cycle_num, 1000,
+             "The number of control cycles between latency histogram "
+             "reports.");
+
+DEFINE_bool(use_lqr_gain_table, false,
+            "True to look up lateral LQR gains from a table precomputed "
+            "over the speed envelope instead of solving the Riccati "
+            "iteration every cycle");
+
+DEFINE_bool(use_chassis_state_shortcut, false,
+            "True to overlay speed/steering/gear feedback from the canbus "
+            "shared memory side channel onto the chassis message at "
+            "compute time, cutting the feedback staleness from the 100Hz "
+            "publish cycle");
@@ -50,3 +50,9 @@ DECLARE_int32(localization_pending_queue_size);
 DECLARE_int32(pad_msg_pending_queue_size);
 
 DECLARE_bool(reverse_heading_control);
+
+DECLARE_int32(latency_report_cycle_num);
+
+DECLARE_bool(use_lqr_gain_table);
+
+DECLARE_bool(use_chassis_state_shortcut);
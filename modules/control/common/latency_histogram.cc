@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/control/common/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace apollo {
+namespace control {
+
+LatencyHistogram::LatencyHistogram() { buckets_.fill(0); }
+
+void LatencyHistogram::Record(const double time_ms) {
+  int index = static_cast<int>(time_ms / kBucketWidthMs);
+  index = std::max(0, std::min(index, kBucketNum - 1));
+  ++buckets_[index];
+  ++count_;
+  max_ms_ = std::max(max_ms_, time_ms);
+}
+
+double LatencyHistogram::Percentile(const double fraction) const {
+  if (count_ == 0) {
+    return 0.0;
+  }
+  const uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(
+             std::ceil(fraction * static_cast<double>(count_))));
+  uint64_t cumulative = 0;
+  for (int i = 0; i < kBucketNum; ++i) {
+    cumulative += buckets_[i];
+    if (cumulative >= rank) {
+      // the last bucket collects the overflow samples, for which only
+      // the maximum is meaningful
+      return i == kBucketNum - 1 ? max_ms_ : (i + 1) * kBucketWidthMs;
+    }
+  }
+  return max_ms_;
+}
+
+std::string LatencyHistogram::Report() const {
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(2) << "count: " << count_
+         << ", p50: " << Percentile(0.5) << "ms, p99: " << Percentile(0.99)
+         << "ms, p99.9: " << Percentile(0.999) << "ms, max: " << max_ms_
+         << "ms";
+  return report.str();
+}
+
+void LatencyHistogram::Clear() {
+  buckets_.fill(0);
+  count_ = 0;
+  max_ms_ = 0.0;
+}
+
+}  // namespace control
+}  // namespace apollo
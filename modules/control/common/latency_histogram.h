@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Defines the LatencyHistogram class.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/**
+ * @namespace apollo::control
+ * @brief apollo::control
+ */
+namespace apollo {
+namespace control {
+
+/**
+ * @class LatencyHistogram
+ * @brief A fixed-bucket histogram of cycle latencies. All buckets are
+ * preallocated so recording a sample never allocates, making it safe to
+ * keep always on inside the control loop.
+ */
+class LatencyHistogram {
+ public:
+  LatencyHistogram();
+
+  /**
+   * @brief Record one latency sample.
+   * @param time_ms The measured duration in milliseconds.
+   */
+  void Record(const double time_ms);
+
+  /**
+   * @brief Get the value below which the given fraction of the recorded
+   * samples falls, resolved to the bucket width.
+   * @param fraction The requested fraction in (0, 1], e.g. 0.999.
+   * @return The percentile in milliseconds, or 0.0 if nothing recorded.
+   */
+  double Percentile(const double fraction) const;
+
+  /**
+   * @brief Format the sample count, percentiles and maximum for logging.
+   */
+  std::string Report() const;
+
+  /**
+   * @brief Drop all recorded samples.
+   */
+  void Clear();
+
+  uint64_t count() const { return count_; }
+
+ private:
+  // 0.05ms buckets up to 25.6ms; slower cycles land in the last bucket
+  static constexpr int kBucketNum = 512;
+  static constexpr double kBucketWidthMs = 0.05;
+
+  std::array<uint64_t, kBucketNum> buckets_;
+  uint64_t count_ = 0;
+  double max_ms_ = 0.0;
+};
+
+}  // namespace control
+}  // namespace apollo
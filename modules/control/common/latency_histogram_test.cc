@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/control/common/latency_histogram.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace control {
+
+TEST(LatencyHistogramTest, Empty) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(0, histogram.count());
+  EXPECT_DOUBLE_EQ(0.0, histogram.Percentile(0.5));
+  EXPECT_DOUBLE_EQ(0.0, histogram.Percentile(0.999));
+}
+
+TEST(LatencyHistogramTest, Percentile) {
+  LatencyHistogram histogram;
+  // 1000 samples of 1ms and a single slow 10ms outlier
+  for (int i = 0; i < 1000; ++i) {
+    histogram.Record(1.0);
+  }
+  histogram.Record(10.0);
+  EXPECT_EQ(1001, histogram.count());
+  EXPECT_NEAR(1.0, histogram.Percentile(0.5), 0.1);
+  EXPECT_NEAR(1.0, histogram.Percentile(0.99), 0.1);
+  EXPECT_NEAR(10.0, histogram.Percentile(0.9999), 0.1);
+}
+
+TEST(LatencyHistogramTest, OutOfRange) {
+  LatencyHistogram histogram;
+  // samples beyond the bucket range land in the last bucket and do not
+  // corrupt the counts
+  histogram.Record(-1.0);
+  histogram.Record(1000.0);
+  EXPECT_EQ(2, histogram.count());
+  EXPECT_NEAR(1000.0, histogram.Percentile(1.0), 1e-6);
+}
+
+TEST(LatencyHistogramTest, Clear) {
+  LatencyHistogram histogram;
+  histogram.Record(2.0);
+  histogram.Clear();
+  EXPECT_EQ(0, histogram.count());
+  EXPECT_DOUBLE_EQ(0.0, histogram.Percentile(0.5));
+}
+
+}  // namespace control
+}  // namespace apollo
@@ -92,6 +92,11 @@ bool ControlComponent::Init() {
       node_->CreateWriter<ControlCommand>(FLAGS_control_command_topic);
   CHECK(control_cmd_writer_ != nullptr);
 
+  if (FLAGS_use_chassis_state_shortcut && !chassis_state_shm_.Init()) {
+    AERROR << "Failed to attach the chassis state shm segment, falling "
+              "back to the chassis message alone.";
+  }
+
   // set initial vehicle state by cmd
   // need to sleep, because advertised channel is not ready immediately
   // simple test shows a short delay of 80 ms or so
@@ -161,6 +166,22 @@ Status ControlComponent::ProduceControlCommand(
     local_view_.localization = latest_localization_;
   }
 
+  if (FLAGS_use_chassis_state_shortcut) {
+    // overlay the freshest feedback from the canbus side channel; the
+    // chassis message still provides every other field
+    canbus::ChassisState chassis_state;
+    if (chassis_state_shm_.Read(&chassis_state) &&
+        chassis_state.timestamp_sec >
+            local_view_.chassis.header().timestamp_sec()) {
+      local_view_.chassis.set_speed_mps(
+          static_cast<float>(chassis_state.speed_mps));
+      local_view_.chassis.set_steering_percentage(
+          static_cast<float>(chassis_state.steering_percentage));
+      local_view_.chassis.set_gear_location(
+          static_cast<Chassis::GearPosition>(chassis_state.gear_location));
+    }
+  }
+
   Status status = CheckInput(&local_view_);
   // check data
 
@@ -290,6 +311,8 @@ bool ControlComponent::Proc() {
     OnPad(pad_msg);
   }
 
+  double input_timestamp = Clock::NowInSeconds();
+
   if (control_conf_.is_control_test_mode() &&
       control_conf_.control_test_duration() > 0 &&
       (start_timestamp - init_time_) > control_conf_.control_test_duration()) {
@@ -310,7 +333,9 @@ bool ControlComponent::Proc() {
     pad_received_ = false;
   }
 
+  const double input_time_ms = (input_timestamp - start_timestamp) * 1000;
   const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
+  control_command.mutable_latency_stats()->set_input_time_ms(input_time_ms);
   control_command.mutable_latency_stats()->set_total_time_ms(time_diff_ms);
   control_command.mutable_latency_stats()->set_total_time_exceeded(
       time_diff_ms < control_conf_.control_period());
@@ -340,6 +365,21 @@ bool ControlComponent::Proc() {
 
   control_cmd_writer_->Write(std::make_shared<ControlCommand>(control_command));
 
+  input_latency_histogram_.Record(input_time_ms);
+  compute_latency_histogram_.Record((end_timestamp - input_timestamp) * 1000);
+  total_latency_histogram_.Record((Clock::NowInSeconds() - start_timestamp) *
+                                  1000);
+  if (++cycle_num_ % static_cast<uint64_t>(FLAGS_latency_report_cycle_num) ==
+      0) {
+    AINFO << "Control latency over the last " << FLAGS_latency_report_cycle_num
+          << " cycles, input {" << input_latency_histogram_.Report()
+          << "}, compute {" << compute_latency_histogram_.Report()
+          << "}, total {" << total_latency_histogram_.Report() << "}";
+    input_latency_histogram_.Clear();
+    compute_latency_histogram_.Clear();
+    total_latency_histogram_.Clear();
+  }
+
   return true;
 }
 
@@ -22,6 +22,7 @@
 #include "cyber/class_loader/class_loader.h"
 #include "cyber/component/timer_component.h"
 
+#include "modules/canbus/common/chassis_state_shm.h"
 #include "modules/canbus/proto/chassis.pb.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/control/proto/control_cmd.pb.h"
@@ -31,6 +32,7 @@
 #include "modules/planning/proto/planning.pb.h"
 
 #include "modules/common/util/util.h"
+#include "modules/control/common/latency_histogram.h"
 #include "modules/control/controller/controller_agent.h"
 
 /**
@@ -118,6 +120,17 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
 
   LocalView local_view_;
+
+  // low-latency chassis feedback side channel written by the canbus RX
+  // path; overlaid onto the chassis message at compute time
+  canbus::ChassisStateShm chassis_state_shm_;
+
+  // always-on latency histograms over the Proc stages, reported
+  // periodically in the log; recording never allocates
+  LatencyHistogram input_latency_histogram_;
+  LatencyHistogram compute_latency_histogram_;
+  LatencyHistogram total_latency_histogram_;
+  uint64_t cycle_num_ = 0;
 };
 
 CYBER_REGISTER_COMPONENT(ControlComponent)
@@ -45,6 +45,10 @@ using apollo::common::time::Clock;
 
 namespace {
 
+// speed grid of the precomputed LQR gain tables
+constexpr double kGainTableSpeedStep = 0.2;
+constexpr double kGainTableMaxSpeed = 40.0;
+
 std::string GetLogFileName() {
   time_t raw_time;
   char name_buffer[80];
@@ -241,9 +245,89 @@ Status LatController::Init(const ControlConf *control_conf) {
     leadlag_controller_.Init(lat_controller_conf.reverse_leadlag_conf(), ts_);
   }
 
+  if (FLAGS_use_lqr_gain_table) {
+    BuildLqrGainTables();
+  }
+
   return Status::OK();
 }
 
+Matrix LatController::SolveGainAtSpeed(const double speed,
+                                       const bool is_reverse) {
+  const double v = std::max(speed, minimum_speed_protection_);
+  const int matrix_size = basic_state_size_ + preview_window_;
+
+  Matrix matrix_a = matrix_a_;
+  matrix_a(1, 1) = matrix_a_coeff_(1, 1) / v;
+  matrix_a(1, 3) = matrix_a_coeff_(1, 3) / v;
+  matrix_a(3, 1) = matrix_a_coeff_(3, 1) / v;
+  matrix_a(3, 3) = matrix_a_coeff_(3, 3) / v;
+  const Matrix matrix_i = Matrix::Identity(matrix_a.cols(), matrix_a.cols());
+  const Matrix matrix_ad = (matrix_i - ts_ * 0.5 * matrix_a).inverse() *
+                           (matrix_i + ts_ * 0.5 * matrix_a);
+
+  Matrix matrix_adc = Matrix::Zero(matrix_size, matrix_size);
+  Matrix matrix_bdc = Matrix::Zero(matrix_size, 1);
+  matrix_adc.block(0, 0, basic_state_size_, basic_state_size_) = matrix_ad;
+  matrix_bdc.block(0, 0, basic_state_size_, 1) = matrix_bd_;
+  if (preview_window_ > 0) {
+    matrix_bdc(matrix_bdc.rows() - 1, 0) = 1;
+    for (int i = 0; i < preview_window_ - 1; ++i) {
+      matrix_adc(basic_state_size_ + i, basic_state_size_ + 1 + i) = 1;
+    }
+  }
+
+  Matrix matrix_q = matrix_q_;
+  if (is_reverse) {
+    int reverse_q_param_size =
+        control_conf_->lat_controller_conf().reverse_matrix_q_size();
+    for (int i = 0; i < reverse_q_param_size; ++i) {
+      matrix_q(i, i) = control_conf_->lat_controller_conf().reverse_matrix_q(i);
+    }
+  }
+  if (FLAGS_enable_gain_scheduler) {
+    matrix_q(0, 0) *= lat_err_interpolation_->Interpolate(v);
+    matrix_q(2, 2) *= heading_err_interpolation_->Interpolate(v);
+  }
+
+  Matrix matrix_k = Matrix::Zero(1, matrix_size);
+  common::math::SolveLQRProblem(matrix_adc, matrix_bdc, matrix_q, matrix_r_,
+                                lqr_eps_, lqr_max_iteration_, &matrix_k);
+  return matrix_k;
+}
+
+void LatController::BuildLqrGainTables() {
+  const int table_size =
+      static_cast<int>((kGainTableMaxSpeed - minimum_speed_protection_) /
+                       kGainTableSpeedStep) +
+      1;
+  lqr_gain_table_.resize(table_size);
+  reverse_lqr_gain_table_.resize(table_size);
+  for (int i = 0; i < table_size; ++i) {
+    const double speed = minimum_speed_protection_ + i * kGainTableSpeedStep;
+    lqr_gain_table_[i] = SolveGainAtSpeed(speed, false);
+    reverse_lqr_gain_table_[i] = SolveGainAtSpeed(speed, true);
+  }
+  AINFO << "LQR gain tables built with " << table_size
+        << " speed grid points up to " << kGainTableMaxSpeed << " m/s";
+}
+
+void LatController::InterpolateGainFromTable(const double speed,
+                                             const bool is_reverse,
+                                             Matrix *matrix_k) const {
+  const auto &table = is_reverse ? reverse_lqr_gain_table_ : lqr_gain_table_;
+  const double v = std::max(speed, minimum_speed_protection_);
+  const double position =
+      (v - minimum_speed_protection_) / kGainTableSpeedStep;
+  const int index = static_cast<int>(position);
+  if (index >= static_cast<int>(table.size()) - 1) {
+    *matrix_k = table.back();
+    return;
+  }
+  const double ratio = position - index;
+  *matrix_k = (1.0 - ratio) * table[index] + ratio * table[index + 1];
+}
+
 void LatController::CloseLogFile() {
   if (FLAGS_enable_csv_debug && steer_log_file_.is_open()) {
     steer_log_file_.close();
@@ -386,7 +470,14 @@ Status LatController::ComputeControlCommand(
   }
 
   // Add gain scheduler for higher speed steering
-  if (FLAGS_enable_gain_scheduler) {
+  if (FLAGS_use_lqr_gain_table) {
+    // gains were solved over the speed grid at init; blending two
+    // neighboring entries replaces the per-cycle Riccati iteration
+    InterpolateGainFromTable(vehicle_state->linear_velocity(),
+                             VehicleStateProvider::Instance()->gear() ==
+                                 canbus::Chassis::GEAR_REVERSE,
+                             &matrix_k_);
+  } else if (FLAGS_enable_gain_scheduler) {
     matrix_q_updated_(0, 0) =
         matrix_q_(0, 0) *
         lat_err_interpolation_->Interpolate(vehicle_state->linear_velocity());
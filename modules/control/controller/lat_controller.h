@@ -24,6 +24,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Eigen/Core"
 
@@ -111,6 +112,15 @@ class LatController : public Controller {
 
   void UpdateMatrixCompound();
 
+  // solve the LQR gain for one speed grid point, reproducing the
+  // per-cycle model and weight updates
+  Eigen::MatrixXd SolveGainAtSpeed(const double speed, const bool is_reverse);
+
+  void BuildLqrGainTables();
+
+  void InterpolateGainFromTable(const double speed, const bool is_reverse,
+                                Eigen::MatrixXd *matrix_k) const;
+
   double ComputeFeedForward(double ref_curvature) const;
 
   void ComputeLateralErrors(const double x, const double y, const double theta,
@@ -219,6 +229,12 @@ class LatController : public Controller {
 
   double minimum_speed_protection_ = 0.1;
 
+  // LQR gains precomputed at init over the speed envelope; the online
+  // path blends the two neighboring grid entries instead of iterating
+  // the Riccati solve every cycle
+  std::vector<Eigen::MatrixXd> lqr_gain_table_;
+  std::vector<Eigen::MatrixXd> reverse_lqr_gain_table_;
+
   double current_trajectory_timestamp_ = -1.0;
 
   double init_vehicle_x_ = 0.0;
@@ -17,6 +17,7 @@
 #include "modules/dreamview/backend/map/map_service.h"
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <utility>
 
@@ -93,12 +94,21 @@ bool MapService::ReloadMap(bool force_reload) {
   if (force_reload) {
     ret = HDMapUtil::ReloadMaps();
   }
+  ClearCaches();
 
   // Update the x,y-offsets if present.
   UpdateOffsets();
   return ret;
 }
 
+void MapService::ClearCaches() {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  element_ids_cache_.clear();
+  element_ids_lru_.clear();
+  retrieved_cache_.clear();
+  retrieved_lru_.clear();
+}
+
 void MapService::UpdateOffsets() {
   x_offset_ = 0.0;
   y_offset_ = 0.0;
@@ -160,6 +170,46 @@ void MapService::CollectMapElementIds(const PointENU &point, double radius,
   if (!MapReady()) {
     return;
   }
+
+  // Quantize the query to a map tile so consecutive queries while the
+  // vehicle moves (or the view pans) inside one tile are answered from
+  // the cache. The cached query is made from the tile center with the
+  // radius padded by the tile half-diagonal, so its result covers every
+  // query point inside the tile.
+  const double tile_x = std::floor(point.x() / kMapTileSize);
+  const double tile_y = std::floor(point.y() / kMapTileSize);
+  const std::string cache_key = std::to_string(tile_x) + "_" +
+                                std::to_string(tile_y) + "_" +
+                                std::to_string(radius);
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    auto iter = element_ids_cache_.find(cache_key);
+    if (iter != element_ids_cache_.end()) {
+      element_ids_lru_.remove(cache_key);
+      element_ids_lru_.push_back(cache_key);
+      ids->CopyFrom(iter->second);
+      return;
+    }
+  }
+
+  PointENU tile_center;
+  tile_center.set_x((tile_x + 0.5) * kMapTileSize);
+  tile_center.set_y((tile_y + 0.5) * kMapTileSize);
+  const double padded_radius = radius + kMapTileSize * M_SQRT2 * 0.5;
+  CollectMapElementIdsImpl(tile_center, padded_radius, ids);
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (element_ids_cache_.emplace(cache_key, *ids).second) {
+    element_ids_lru_.push_back(cache_key);
+    if (element_ids_cache_.size() > kElementIdsCacheLimit) {
+      element_ids_cache_.erase(element_ids_lru_.front());
+      element_ids_lru_.pop_front();
+    }
+  }
+}
+
+void MapService::CollectMapElementIdsImpl(const PointENU &point, double radius,
+                                          MapElementIds *ids) const {
   boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
 
   std::vector<LaneInfoConstPtr> lanes;
@@ -511,6 +561,36 @@ bool MapService::AddPathFromPassageRegion(
   return true;
 }
 
+bool MapService::RetrieveMapElementsAsBinary(const MapElementIds &ids,
+                                             std::string *serialized) const {
+  const size_t hash = CalculateMapHash(ids);
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    auto iter = retrieved_cache_.find(hash);
+    if (iter != retrieved_cache_.end()) {
+      retrieved_lru_.remove(hash);
+      retrieved_lru_.push_back(hash);
+      *serialized = iter->second;
+      return true;
+    }
+  }
+
+  if (!RetrieveMapElements(ids).SerializeToString(serialized)) {
+    AERROR << "Failed to serialize retrieved map elements.";
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (retrieved_cache_.emplace(hash, *serialized).second) {
+    retrieved_lru_.push_back(hash);
+    if (retrieved_cache_.size() > kRetrievedCacheLimit) {
+      retrieved_cache_.erase(retrieved_lru_.front());
+      retrieved_lru_.pop_front();
+    }
+  }
+  return true;
+}
+
 size_t MapService::CalculateMapHash(const MapElementIds &ids) const {
   static std::hash<std::string> hash_function;
   return hash_function(ids.DebugString());
@@ -20,7 +20,10 @@
 
 #pragma once
 
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "boost/thread/locks.hpp"
@@ -55,6 +58,13 @@ class MapService {
   // javascript clients.
   hdmap::Map RetrieveMapElements(const MapElementIds &ids) const;
 
+  // Same as RetrieveMapElements, but returns the serialized proto. The
+  // map is static between (re)loads, so the serialized result is cached
+  // by the hash of the id set and repeated viewport queries are answered
+  // without re-assembling the element protos.
+  bool RetrieveMapElementsAsBinary(const MapElementIds &ids,
+                                   std::string *serialized) const;
+
   bool GetPoseWithRegardToLane(const double x, const double y, double *theta,
                                double *s) const;
 
@@ -87,6 +97,9 @@ class MapService {
 
  private:
   void UpdateOffsets();
+  void CollectMapElementIdsImpl(const apollo::common::PointENU &point,
+                                double radius, MapElementIds *ids) const;
+  void ClearCaches();
   bool GetNearestLane(const double x, const double y,
                       apollo::hdmap::LaneInfoConstPtr *nearest_lane,
                       double *nearest_s, double *nearest_l) const;
@@ -115,6 +128,19 @@ class MapService {
 
   // RW lock to protect map data
   mutable boost::shared_mutex mutex_;
+
+  // Caches for frontend map queries. The map is static between
+  // (re)loads, so element ids are cached per viewport tile and
+  // retrieved elements are cached as serialized blobs, both with a
+  // bounded LRU. Cleared by ReloadMap().
+  static constexpr double kMapTileSize = 64.0;  // meters
+  static constexpr size_t kElementIdsCacheLimit = 256;
+  static constexpr size_t kRetrievedCacheLimit = 16;
+  mutable std::mutex cache_mutex_;
+  mutable std::unordered_map<std::string, MapElementIds> element_ids_cache_;
+  mutable std::list<std::string> element_ids_lru_;
+  mutable std::unordered_map<size_t, std::string> retrieved_cache_;
+  mutable std::list<size_t> retrieved_lru_;
 };
 
 }  // namespace dreamview
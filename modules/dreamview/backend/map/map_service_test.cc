@@ -62,6 +62,24 @@ TEST_F(MapServiceTest, RetrieveMapElements) {
   EXPECT_EQ("l1", map.lane(0).id().id());
 }
 
+TEST_F(MapServiceTest, RetrieveMapElementsAsBinary) {
+  MapElementIds map_element_ids;
+  map_element_ids.add_lane("l1");
+  std::string serialized;
+  EXPECT_TRUE(map_service->RetrieveMapElementsAsBinary(map_element_ids,
+                                                       &serialized));
+  Map map;
+  EXPECT_TRUE(map.ParseFromString(serialized));
+  EXPECT_EQ(1, map.lane_size());
+  EXPECT_EQ("l1", map.lane(0).id().id());
+
+  // The second retrieval is served from the blob cache.
+  std::string cached;
+  EXPECT_TRUE(
+      map_service->RetrieveMapElementsAsBinary(map_element_ids, &cached));
+  EXPECT_EQ(serialized, cached);
+}
+
 TEST_F(MapServiceTest, GetStartPoint) {
   PointENU start_point;
   EXPECT_TRUE(map_service->GetStartPoint(&start_point));
@@ -148,42 +148,52 @@ void PointCloudUpdater::UpdatePointCloud(
   // Check if last filter process has finished before processing new data.
   if (future_ready_) {
     future_ready_ = false;
-    // transform from drivers::PointCloud to pcl::PointCloud
-    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr(
-        new pcl::PointCloud<pcl::PointXYZ>);
-    pcl_ptr->width = point_cloud->width();
-    pcl_ptr->height = point_cloud->height();
-    pcl_ptr->is_dense = false;
-    pcl_ptr->points.resize(pcl_ptr->width * pcl_ptr->height);
-
-    if (pcl_ptr->width == 0 || pcl_ptr->height == 0) {
-      pcl_ptr->width = 1;
-      pcl_ptr->height = point_cloud->point_size();
-      pcl_ptr->points.resize(point_cloud->point_size());
+    // transform from drivers::PointCloud to pcl::PointCloud. The conversion
+    // buffer is reused across frames: the future_ready_ check above
+    // guarantees the last filter run is done with it.
+    if (conversion_cloud_ == nullptr) {
+      conversion_cloud_.reset(new pcl::PointCloud<pcl::PointXYZ>);
+    }
+    conversion_cloud_->width = point_cloud->width();
+    conversion_cloud_->height = point_cloud->height();
+    conversion_cloud_->is_dense = false;
+    conversion_cloud_->points.resize(conversion_cloud_->width *
+                                     conversion_cloud_->height);
+
+    if (conversion_cloud_->width == 0 || conversion_cloud_->height == 0) {
+      conversion_cloud_->width = 1;
+      conversion_cloud_->height = point_cloud->point_size();
+      conversion_cloud_->points.resize(point_cloud->point_size());
     }
 
-    for (size_t i = 0; i < pcl_ptr->points.size(); ++i) {
+    for (size_t i = 0; i < conversion_cloud_->points.size(); ++i) {
       const auto &point = point_cloud->point(static_cast<int>(i));
-      pcl_ptr->points[i].x = point.x();
-      pcl_ptr->points[i].y = point.y();
-      pcl_ptr->points[i].z = point.z();
+      conversion_cloud_->points[i].x = point.x();
+      conversion_cloud_->points[i].y = point.y();
+      conversion_cloud_->points[i].z = point.z();
     }
-    std::future<void> f =
-        cyber::Async(&PointCloudUpdater::FilterPointCloud, this, pcl_ptr);
+    std::future<void> f = cyber::Async(&PointCloudUpdater::FilterPointCloud,
+                                       this, conversion_cloud_);
     async_future_ = std::move(f);
   }
 }
 
 void PointCloudUpdater::FilterPointCloud(
     pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr) {
-  pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
-  voxel_grid.setInputCloud(pcl_ptr);
-  voxel_grid.setLeafSize(static_cast<float>(FLAGS_voxel_filter_size),
-                         static_cast<float>(FLAGS_voxel_filter_size),
-                         static_cast<float>(FLAGS_voxel_filter_height));
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_filtered_ptr(
-      new pcl::PointCloud<pcl::PointXYZ>);
-  voxel_grid.filter(*pcl_filtered_ptr);
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_filtered_ptr;
+  if (static_cast<int32_t>(pcl_ptr->size()) <=
+      FLAGS_max_filtered_point_cloud_size) {
+    // Already within the display budget, skip the voxel grid.
+    pcl_filtered_ptr = pcl_ptr;
+  } else {
+    pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
+    voxel_grid.setInputCloud(pcl_ptr);
+    voxel_grid.setLeafSize(static_cast<float>(FLAGS_voxel_filter_size),
+                           static_cast<float>(FLAGS_voxel_filter_size),
+                           static_cast<float>(FLAGS_voxel_filter_height));
+    pcl_filtered_ptr.reset(new pcl::PointCloud<pcl::PointXYZ>);
+    voxel_grid.filter(*pcl_filtered_ptr);
+  }
   AINFO << "filtered point cloud data size: " << pcl_filtered_ptr->size();
 
   float z_offset;
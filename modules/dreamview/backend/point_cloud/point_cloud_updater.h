@@ -95,6 +95,10 @@ class PointCloudUpdater {
   // The PointCloud to be pushed to frontend.
   std::string point_cloud_str_;
 
+  // Persistent buffer for the drivers::PointCloud to pcl conversion, only
+  // touched while future_ready_ says no filter task is running.
+  pcl::PointCloud<pcl::PointXYZ>::Ptr conversion_cloud_;
+
   std::future<void> async_future_;
   std::atomic<bool> future_ready_;
 
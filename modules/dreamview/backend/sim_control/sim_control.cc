@@ -300,15 +300,18 @@ void SimControl::Freeze() {
 }
 
 void SimControl::RunOnce() {
-  std::lock_guard<std::mutex> lock(mutex_);
-
   TrajectoryPoint trajectory_point;
   Chassis::GearPosition gear_position;
-  if (!PerfectControlModel(&trajectory_point, &gear_position)) {
-    AERROR << "Failed to calculate next point with perfect control model";
-    return;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!PerfectControlModel(&trajectory_point, &gear_position)) {
+      AERROR << "Failed to calculate next point with perfect control model";
+      return;
+    }
   }
 
+  // Publish outside the lock so reader callbacks are not blocked by the
+  // transport while the car is stepped at 100Hz.
   PublishChassis(trajectory_point.v(), gear_position);
   PublishLocalization(trajectory_point);
 }
@@ -389,8 +392,6 @@ void SimControl::PublishLocalization(const TrajectoryPoint& point) {
   FillHeader("SimControl", localization.get());
 
   auto* pose = localization->mutable_pose();
-  auto prev = prev_point_.path_point();
-  auto next = next_point_.path_point();
 
   // Set position
   pose->mutable_position()->set_x(point.path_point().x());
@@ -406,8 +407,11 @@ void SimControl::PublishLocalization(const TrajectoryPoint& point) {
     Eigen::Vector2d enu_coordinate =
         common::math::RotateVector2d({flu_x, flu_y}, cur_theta);
 
-    enu_coordinate.x() += adc_position_.x();
-    enu_coordinate.y() += adc_position_.y();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      enu_coordinate.x() += adc_position_.x();
+      enu_coordinate.y() += adc_position_.y();
+    }
     pose->mutable_position()->set_x(enu_coordinate.x());
     pose->mutable_position()->set_y(enu_coordinate.y());
   }
@@ -447,9 +451,12 @@ void SimControl::PublishLocalization(const TrajectoryPoint& point) {
 
   localization_writer_->Write(localization);
 
-  adc_position_.set_x(pose->position().x());
-  adc_position_.set_y(pose->position().y());
-  adc_position_.set_z(pose->position().z());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    adc_position_.set_x(pose->position().x());
+    adc_position_.set_y(pose->position().y());
+    adc_position_.set_z(pose->position().z());
+  }
 }
 
 void SimControl::PublishDummyPrediction() {
@@ -67,12 +67,11 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
         if (iter != json.end()) {
           MapElementIds map_element_ids;
           if (JsonStringToMessage(iter->dump(), &map_element_ids).ok()) {
-            auto retrieved = map_service_->RetrieveMapElements(map_element_ids);
-
             std::string retrieved_map_string;
-            retrieved.SerializeToString(&retrieved_map_string);
-
-            map_ws_->SendBinaryData(conn, retrieved_map_string, true);
+            if (map_service_->RetrieveMapElementsAsBinary(
+                    map_element_ids, &retrieved_map_string)) {
+              map_ws_->SendBinaryData(conn, retrieved_map_string, true);
+            }
           } else {
             AERROR << "Failed to parse MapElementIds from json";
           }
@@ -372,16 +371,27 @@ void SimulationWorldUpdater::Start() {
 }
 
 void SimulationWorldUpdater::OnTimer() {
-  sim_world_service_.Update();
-
-  {
-    boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
-    sim_world_service_.GetWireFormatString(
-        FLAGS_sim_map_radius, &simulation_world_,
-        &simulation_world_with_planning_data_);
-    sim_world_service_.GetRelativeMap().SerializeToString(
-        &relative_map_string_);
+  // Updating and serializing the world is expensive. Hand it off to a task
+  // worker so the cyber timer thread is never blocked, and skip a tick
+  // instead of piling up when the last update has not finished yet.
+  if (update_in_progress_.exchange(true)) {
+    AWARN_EVERY(100) << "Skipping one simulation world update as the "
+                     << "previous one is still in flight.";
+    return;
   }
+  cyber::Async([this]() {
+    sim_world_service_.Update();
+
+    {
+      boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
+      sim_world_service_.GetWireFormatString(
+          FLAGS_sim_map_radius, &simulation_world_,
+          &simulation_world_with_planning_data_);
+      sim_world_service_.GetRelativeMap().SerializeToString(
+          &relative_map_string_);
+    }
+    update_in_progress_.store(false);
+  });
 }
 
 bool SimulationWorldUpdater::LoadPOI() {
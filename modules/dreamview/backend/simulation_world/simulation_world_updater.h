@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -151,6 +152,10 @@ class SimulationWorldUpdater {
   // Mutex to protect concurrent access to simulation_world_json_.
   // NOTE: Use boost until we have std version of rwlock support.
   boost::shared_mutex mutex_;
+
+  // Whether a task worker is still updating and serializing the world.
+  // Timer ticks arriving while it is set are dropped instead of queued.
+  std::atomic<bool> update_in_progress_{false};
 };
 
 }  // namespace dreamview
@@ -114,6 +114,16 @@ ErrorCode SocketCanClientRaw::Start() {
     return ErrorCode::CAN_CLIENT_ERROR_BASE;
   }
 
+  // map each preallocated frame buffer into the batched receive
+  // scatter list
+  std::memset(recv_msgs_, 0, sizeof(recv_msgs_));
+  for (int32_t i = 0; i < MAX_CAN_RECV_FRAME_LEN; ++i) {
+    recv_iovecs_[i].iov_base = &recv_frames_[i];
+    recv_iovecs_[i].iov_len = sizeof(recv_frames_[i]);
+    recv_msgs_[i].msg_hdr.msg_iov = &recv_iovecs_[i];
+    recv_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+
   is_started_ = true;
   return ErrorCode::OK;
 }
@@ -164,7 +174,7 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
   return ErrorCode::OK;
 }
 
-// buf size must be 8 bytes, every time, we receive only one frame
+// buf size must be 8 bytes, receive up to frame_num frames in one call
 ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
                                       int32_t *const frame_num) {
   if (!is_started_) {
@@ -179,14 +189,17 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     return ErrorCode::CAN_CLIENT_ERROR_FRAME_NUM;
   }
 
-  for (int32_t i = 0; i < *frame_num && i < MAX_CAN_RECV_FRAME_LEN; ++i) {
-    CanFrame cf;
-    auto ret = read(dev_handler_, &recv_frames_[i], sizeof(recv_frames_[i]));
+  // drain the socket with a single syscall; block only until the first
+  // frame arrives instead of reading the requested frames one by one
+  const int32_t recv_num =
+      recvmmsg(dev_handler_, recv_msgs_, *frame_num, MSG_WAITFORONE, nullptr);
+  if (recv_num < 0) {
+    AERROR << "receive message failed, error code: " << recv_num;
+    return ErrorCode::CAN_CLIENT_ERROR_BASE;
+  }
 
-    if (ret < 0) {
-      AERROR << "receive message failed, error code: " << ret;
-      return ErrorCode::CAN_CLIENT_ERROR_BASE;
-    }
+  for (int32_t i = 0; i < recv_num; ++i) {
+    CanFrame cf;
     if (recv_frames_[i].can_dlc != CANBUS_MESSAGE_LENGTH) {
       AERROR << "recv_frames_[" << i
              << "].can_dlc = " << recv_frames_[i].can_dlc
@@ -199,6 +212,7 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     std::memcpy(cf.data, recv_frames_[i].data, recv_frames_[i].can_dlc);
     frames->push_back(cf);
   }
+  *frame_num = recv_num;
   return ErrorCode::OK;
 }
 
@@ -114,6 +114,9 @@ class SocketCanClientRaw : public CanClient {
   CANCardParameter::CANChannelId port_;
   can_frame send_frames_[MAX_CAN_SEND_FRAME_LEN];
   can_frame recv_frames_[MAX_CAN_RECV_FRAME_LEN];
+  // preallocated scatter list over recv_frames_ for batched receiving
+  struct iovec recv_iovecs_[MAX_CAN_RECV_FRAME_LEN];
+  struct mmsghdr recv_msgs_[MAX_CAN_RECV_FRAME_LEN];
 };
 
 }  // namespace can
@@ -20,7 +20,10 @@
  */
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -31,6 +34,7 @@
 #include "cyber/common/log.h"
 #include "modules/common/proto/error_code.pb.h"
 #include "modules/common/time/time.h"
+#include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/protocol_data.h"
 #include "modules/drivers/canbus/common/byte.h"
 
@@ -85,8 +89,24 @@ class MessageManager {
   virtual void Parse(const uint32_t message_id, const uint8_t *data,
                      int32_t length);
 
+  /**
+   * @brief parse a batch of received CAN frames, holding the sensor data
+   * mutex once for the whole batch
+   * @param frames the received frames
+   */
+  virtual void ParseBatch(const std::vector<CanFrame> &frames);
+
   void ClearSensorData();
 
+  /**
+   * @brief set a callback invoked on the parsing thread after received
+   * frames have been parsed into the sensor data, outside the sensor data
+   * mutex. Must be set before reception starts.
+   */
+  void SetParseCallback(const std::function<void()> &callback) {
+    parse_callback_ = callback;
+  }
+
   std::condition_variable *GetMutableCVar();
 
   /**
@@ -98,8 +118,8 @@ class MessageManager {
       const uint32_t message_id);
 
   /**
-   * @brief get chassis detail. used lock_guard in this function to avoid
-   * concurrent read/write issue.
+   * @brief get chassis detail. Served from the latest snapshot published
+   * by the parsing thread, so the caller never blocks CAN reception.
    * @param chassis_detail chassis_detail to be filled.
    */
   common::ErrorCode GetSensorData(SensorType *const sensor_data);
@@ -109,6 +129,13 @@ class MessageManager {
    */
   void ResetSendMessages();
 
+ private:
+  void CheckPeriod(const uint32_t message_id);
+
+  // publishes sensor_data_ into the next free snapshot slot; the caller
+  // must hold sensor_data_mutex_
+  void PublishSnapshot();
+
  protected:
   template <class T, bool need_check>
   void AddRecvProtocolData();
@@ -116,17 +143,40 @@ class MessageManager {
   template <class T, bool need_check>
   void AddSendProtocolData();
 
+  // Standard CAN frame ids fit in 11 bits, so the protocols registered for
+  // them are dispatched through this dense table in O(1) without hashing.
+  // Extended frame ids fall back to protocol_data_map_.
+  static constexpr uint32_t kDenseDispatchSize = 2048;
+
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> send_protocol_data_;
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> recv_protocol_data_;
 
+  std::array<ProtocolData<SensorType> *, kDenseDispatchSize>
+      dense_protocol_data_{};
   std::unordered_map<uint32_t, ProtocolData<SensorType> *> protocol_data_map_;
   std::unordered_map<uint32_t, CheckIdArg> check_ids_;
   std::set<uint32_t> received_ids_;
 
+  // serializes the writers (parse paths and ClearSensorData); readers go
+  // through the snapshot slots below and never take this mutex, so the
+  // 100Hz publisher can not stall CAN reception
   std::mutex sensor_data_mutex_;
   SensorType sensor_data_;
   bool is_received_on_time_ = false;
 
+  // wait-free snapshot hand-off: the writer copies sensor_data_ into its
+  // slot and swaps it into ready_slot_; the reader swaps the ready slot
+  // out when publish_seq_ moved and otherwise re-reads its own slot
+  SensorType snapshot_[3];
+  int writer_slot_ = 0;
+  int reader_slot_ = 2;
+  std::atomic<int> ready_slot_{1};
+  std::atomic<uint64_t> publish_seq_{0};
+  uint64_t reader_seq_ = 0;
+  std::mutex snapshot_reader_mutex_;
+
+  std::function<void()> parse_callback_;
+
   std::condition_variable cvar_;
 };
 
@@ -139,6 +189,9 @@ void MessageManager<SensorType>::AddRecvProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (static_cast<uint32_t>(T::ID) < kDenseDispatchSize) {
+    dense_protocol_data_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -156,6 +209,9 @@ void MessageManager<SensorType>::AddSendProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (static_cast<uint32_t>(T::ID) < kDenseDispatchSize) {
+    dense_protocol_data_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -168,12 +224,19 @@ template <typename SensorType>
 ProtocolData<SensorType>
     *MessageManager<SensorType>::GetMutableProtocolDataById(
         const uint32_t message_id) {
-  if (protocol_data_map_.find(message_id) == protocol_data_map_.end()) {
+  if (message_id < kDenseDispatchSize) {
+    ProtocolData<SensorType> *protocol_data = dense_protocol_data_[message_id];
+    if (protocol_data != nullptr) {
+      return protocol_data;
+    }
+  }
+  const auto it = protocol_data_map_.find(message_id);
+  if (it == protocol_data_map_.end()) {
     ADEBUG << "Unable to get protocol data because of invalid message_id:"
            << Byte::byte_to_hex(message_id);
     return nullptr;
   }
-  return protocol_data_map_[message_id];
+  return it->second;
 }
 
 template <typename SensorType>
@@ -187,8 +250,54 @@ void MessageManager<SensorType>::Parse(const uint32_t message_id,
   {
     std::lock_guard<std::mutex> lock(sensor_data_mutex_);
     protocol_data->Parse(data, length, &sensor_data_);
+    PublishSnapshot();
   }
   received_ids_.insert(message_id);
+  CheckPeriod(message_id);
+  if (parse_callback_ != nullptr) {
+    parse_callback_();
+  }
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::PublishSnapshot() {
+  snapshot_[writer_slot_].CopyFrom(sensor_data_);
+  writer_slot_ =
+      ready_slot_.exchange(writer_slot_, std::memory_order_acq_rel);
+  publish_seq_.fetch_add(1, std::memory_order_release);
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::ParseBatch(
+    const std::vector<CanFrame> &frames) {
+  std::vector<uint32_t> parsed_ids;
+  parsed_ids.reserve(frames.size());
+  {
+    std::lock_guard<std::mutex> lock(sensor_data_mutex_);
+    for (const auto &frame : frames) {
+      ProtocolData<SensorType> *protocol_data =
+          GetMutableProtocolDataById(frame.id);
+      if (protocol_data == nullptr) {
+        continue;
+      }
+      protocol_data->Parse(frame.data, frame.len, &sensor_data_);
+      parsed_ids.push_back(frame.id);
+    }
+    if (!parsed_ids.empty()) {
+      PublishSnapshot();
+    }
+  }
+  for (const uint32_t message_id : parsed_ids) {
+    received_ids_.insert(message_id);
+    CheckPeriod(message_id);
+  }
+  if (!parsed_ids.empty() && parse_callback_ != nullptr) {
+    parse_callback_();
+  }
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::CheckPeriod(const uint32_t message_id) {
   // check if need to check period
   const auto it = check_ids_.find(message_id);
   if (it != check_ids_.end()) {
@@ -209,6 +318,7 @@ template <typename SensorType>
 void MessageManager<SensorType>::ClearSensorData() {
   std::lock_guard<std::mutex> lock(sensor_data_mutex_);
   sensor_data_.Clear();
+  PublishSnapshot();
 }
 
 template <typename SensorType>
@@ -223,8 +333,16 @@ ErrorCode MessageManager<SensorType>::GetSensorData(
     AERROR << "Failed to get sensor_data due to nullptr.";
     return ErrorCode::CANBUS_ERROR;
   }
-  std::lock_guard<std::mutex> lock(sensor_data_mutex_);
-  sensor_data->CopyFrom(sensor_data_);
+  std::lock_guard<std::mutex> lock(snapshot_reader_mutex_);
+  const uint64_t seq = publish_seq_.load(std::memory_order_acquire);
+  if (seq != reader_seq_) {
+    // take the freshest published slot; the slot handed back will only
+    // be reused by the writer after yet another publish
+    reader_slot_ = ready_slot_.exchange(reader_slot_,
+                                        std::memory_order_acq_rel);
+    reader_seq_ = seq;
+  }
+  sensor_data->CopyFrom(snapshot_[reader_slot_]);
   return ErrorCode::OK;
 }
 
@@ -36,12 +36,21 @@ class MockProtocolData : public ProtocolData<::apollo::canbus::ChassisDetail> {
   MockProtocolData() {}
 };
 
+class MockExtendedProtocolData
+    : public ProtocolData<::apollo::canbus::ChassisDetail> {
+ public:
+  // extended frame id, outside the dense dispatch table
+  static const int32_t ID = 0x18FF0001;
+  MockExtendedProtocolData() {}
+};
+
 class MockMessageManager
     : public MessageManager<::apollo::canbus::ChassisDetail> {
  public:
   MockMessageManager() {
     AddRecvProtocolData<MockProtocolData, true>();
     AddSendProtocolData<MockProtocolData, true>();
+    AddRecvProtocolData<MockExtendedProtocolData, false>();
   }
 };
 
@@ -59,6 +68,20 @@ TEST(MessageManagerTest, GetMutableProtocolDataById) {
   EXPECT_EQ(manager.GetSensorData(nullptr), ErrorCode::CANBUS_ERROR);
 }
 
+TEST(MessageManagerTest, ProtocolDataDispatch) {
+  MockMessageManager manager;
+  // standard frame id through the dense table
+  EXPECT_TRUE(manager.GetMutableProtocolDataById(MockProtocolData::ID) !=
+              nullptr);
+  // extended frame id through the hash map fallback
+  EXPECT_TRUE(
+      manager.GetMutableProtocolDataById(MockExtendedProtocolData::ID) !=
+      nullptr);
+  // unregistered ids on both paths
+  EXPECT_TRUE(manager.GetMutableProtocolDataById(0x112) == nullptr);
+  EXPECT_TRUE(manager.GetMutableProtocolDataById(0x18FF0002) == nullptr);
+}
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
@@ -0,0 +1,188 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "modules/drivers/proto/sensor_image.pb.h"
+
+namespace apollo {
+namespace drivers {
+namespace flat {
+
+/**
+ * @brief Fixed-layout encoding of apollo::drivers::Image.
+ *
+ * The wire format is a small fixed header, the frame_id/encoding strings
+ * and one memcpy-able pixel block, so serialization never walks the pixel
+ * data the way the protobuf bytes field does. It implements the
+ * serialize/parse member functions cyber::message traits look for, so it
+ * can be published on a channel like any other message. Conversion
+ * to/from the proto only happens at record/bridge boundaries.
+ */
+struct FlatImage {
+  // fixed wire header preceding the pixel block
+  struct WireHeader {
+    uint32_t magic;
+    uint32_t width;
+    uint32_t height;
+    uint32_t step;
+    uint32_t frame_id_size;
+    uint32_t encoding_size;
+    uint64_t data_size;
+    double measurement_time;
+    double header_timestamp_sec;
+    uint64_t camera_timestamp;
+    uint32_t sequence_num;
+    uint32_t reserved;
+  };
+
+  static const uint32_t kMagic = 0x46494d31;  // "FIM1"
+
+  std::string frame_id;
+  std::string encoding;
+  double measurement_time = 0.0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t step = 0;
+  double header_timestamp_sec = 0.0;
+  uint64_t camera_timestamp = 0;
+  uint32_t sequence_num = 0;
+
+  std::vector<uint8_t> data;
+
+  int ByteSize() const {
+    return static_cast<int>(sizeof(WireHeader) + frame_id.size() +
+                            encoding.size() + data.size());
+  }
+
+  bool SerializeToArray(void* dst, int size) const {
+    if (dst == nullptr || size < ByteSize()) {
+      return false;
+    }
+    WireHeader wire;
+    wire.magic = kMagic;
+    wire.width = width;
+    wire.height = height;
+    wire.step = step;
+    wire.frame_id_size = static_cast<uint32_t>(frame_id.size());
+    wire.encoding_size = static_cast<uint32_t>(encoding.size());
+    wire.data_size = data.size();
+    wire.measurement_time = measurement_time;
+    wire.header_timestamp_sec = header_timestamp_sec;
+    wire.camera_timestamp = camera_timestamp;
+    wire.sequence_num = sequence_num;
+    wire.reserved = 0;
+
+    char* ptr = reinterpret_cast<char*>(dst);
+    memcpy(ptr, &wire, sizeof(wire));
+    ptr += sizeof(wire);
+    memcpy(ptr, frame_id.data(), frame_id.size());
+    ptr += frame_id.size();
+    memcpy(ptr, encoding.data(), encoding.size());
+    ptr += encoding.size();
+    memcpy(ptr, data.data(), data.size());
+    return true;
+  }
+
+  bool SerializeToString(std::string* str) const {
+    if (str == nullptr) {
+      return false;
+    }
+    str->resize(ByteSize());
+    return SerializeToArray(const_cast<char*>(str->data()),
+                            static_cast<int>(str->size()));
+  }
+
+  bool ParseFromArray(const void* src, int size) {
+    if (src == nullptr || size < static_cast<int>(sizeof(WireHeader))) {
+      return false;
+    }
+    WireHeader wire;
+    const char* ptr = reinterpret_cast<const char*>(src);
+    memcpy(&wire, ptr, sizeof(wire));
+    if (wire.magic != kMagic) {
+      return false;
+    }
+    size_t expected = sizeof(WireHeader) + wire.frame_id_size +
+                      wire.encoding_size + wire.data_size;
+    if (static_cast<size_t>(size) < expected) {
+      return false;
+    }
+    ptr += sizeof(wire);
+    frame_id.assign(ptr, wire.frame_id_size);
+    ptr += wire.frame_id_size;
+    encoding.assign(ptr, wire.encoding_size);
+    ptr += wire.encoding_size;
+    data.resize(wire.data_size);
+    memcpy(data.data(), ptr, wire.data_size);
+    width = wire.width;
+    height = wire.height;
+    step = wire.step;
+    measurement_time = wire.measurement_time;
+    header_timestamp_sec = wire.header_timestamp_sec;
+    camera_timestamp = wire.camera_timestamp;
+    sequence_num = wire.sequence_num;
+    return true;
+  }
+
+  bool ParseFromString(const std::string& str) {
+    return ParseFromArray(str.data(), static_cast<int>(str.size()));
+  }
+
+  static void GetDescriptorString(const std::string& type,
+                                  std::string* desc_str) {
+    (void)type;
+    desc_str->clear();
+  }
+
+  static std::string TypeName() { return "apollo.drivers.flat.FlatImage"; }
+
+  void FromProto(const Image& proto) {
+    frame_id = proto.frame_id();
+    encoding = proto.encoding();
+    measurement_time = proto.measurement_time();
+    width = proto.width();
+    height = proto.height();
+    step = proto.step();
+    header_timestamp_sec = proto.header().timestamp_sec();
+    camera_timestamp = proto.header().camera_timestamp();
+    sequence_num = proto.header().sequence_num();
+    data.assign(proto.data().begin(), proto.data().end());
+  }
+
+  void ToProto(Image* proto) const {
+    proto->Clear();
+    proto->set_frame_id(frame_id);
+    proto->set_encoding(encoding);
+    proto->set_measurement_time(measurement_time);
+    proto->set_width(width);
+    proto->set_height(height);
+    proto->set_step(step);
+    proto->mutable_header()->set_timestamp_sec(header_timestamp_sec);
+    proto->mutable_header()->set_camera_timestamp(camera_timestamp);
+    proto->mutable_header()->set_sequence_num(sequence_num);
+    proto->set_data(std::string(data.begin(), data.end()));
+  }
+};
+
+}  // namespace flat
+}  // namespace drivers
+}  // namespace apollo
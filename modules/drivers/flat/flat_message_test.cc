@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/flat/flat_image.h"
+#include "modules/drivers/flat/flat_point_cloud.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace drivers {
+namespace flat {
+
+TEST(FlatPointCloudTest, wire_roundtrip) {
+  FlatPointCloud cloud;
+  cloud.frame_id = "velodyne128";
+  cloud.is_dense = true;
+  cloud.measurement_time = 1234.5;
+  cloud.width = 4;
+  cloud.height = 1;
+  cloud.header_timestamp_sec = 1234.6;
+  cloud.lidar_timestamp = 1234500000000ULL;
+  cloud.sequence_num = 42;
+  cloud.Reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    cloud.x.emplace_back(1.0f * i);
+    cloud.y.emplace_back(2.0f * i);
+    cloud.z.emplace_back(3.0f * i);
+    cloud.intensity.emplace_back(10u * i);
+    cloud.timestamp.emplace_back(100ull * i);
+  }
+
+  std::string buf;
+  EXPECT_TRUE(cloud.SerializeToString(&buf));
+  EXPECT_EQ(static_cast<int>(buf.size()), cloud.ByteSize());
+
+  FlatPointCloud parsed;
+  EXPECT_TRUE(parsed.ParseFromString(buf));
+  EXPECT_EQ(parsed.frame_id, "velodyne128");
+  EXPECT_TRUE(parsed.is_dense);
+  EXPECT_EQ(parsed.point_num(), 4u);
+  EXPECT_EQ(parsed.sequence_num, 42u);
+  EXPECT_FLOAT_EQ(parsed.x[3], 3.0f);
+  EXPECT_FLOAT_EQ(parsed.y[2], 4.0f);
+  EXPECT_EQ(parsed.intensity[1], 10u);
+  EXPECT_EQ(parsed.timestamp[3], 300ull);
+}
+
+TEST(FlatPointCloudTest, proto_roundtrip) {
+  PointCloud proto;
+  proto.set_frame_id("velodyne64");
+  proto.set_measurement_time(10.5);
+  proto.mutable_header()->set_sequence_num(7);
+  for (int i = 0; i < 3; ++i) {
+    auto* point = proto.add_point();
+    point->set_x(0.5f * i);
+    point->set_intensity(i);
+    point->set_timestamp(i);
+  }
+
+  FlatPointCloud cloud;
+  cloud.FromProto(proto);
+  EXPECT_EQ(cloud.point_num(), 3u);
+
+  PointCloud back;
+  cloud.ToProto(&back);
+  EXPECT_EQ(back.frame_id(), "velodyne64");
+  EXPECT_EQ(back.point_size(), 3);
+  EXPECT_FLOAT_EQ(back.point(2).x(), 1.0f);
+  EXPECT_EQ(back.header().sequence_num(), 7u);
+}
+
+TEST(FlatPointCloudTest, rejects_foreign_payload) {
+  FlatPointCloud cloud;
+  EXPECT_FALSE(cloud.ParseFromString("not a flat point cloud"));
+}
+
+TEST(FlatImageTest, wire_roundtrip) {
+  FlatImage image;
+  image.frame_id = "front_6mm";
+  image.encoding = "rgb8";
+  image.width = 4;
+  image.height = 2;
+  image.step = 12;
+  image.measurement_time = 99.5;
+  image.camera_timestamp = 99500000000ULL;
+  image.sequence_num = 11;
+  image.data.resize(image.step * image.height);
+  for (size_t i = 0; i < image.data.size(); ++i) {
+    image.data[i] = static_cast<uint8_t>(i);
+  }
+
+  std::string buf;
+  EXPECT_TRUE(image.SerializeToString(&buf));
+  EXPECT_EQ(static_cast<int>(buf.size()), image.ByteSize());
+
+  FlatImage parsed;
+  EXPECT_TRUE(parsed.ParseFromString(buf));
+  EXPECT_EQ(parsed.frame_id, "front_6mm");
+  EXPECT_EQ(parsed.encoding, "rgb8");
+  EXPECT_EQ(parsed.data.size(), image.data.size());
+  EXPECT_EQ(parsed.data[13], 13u);
+  EXPECT_EQ(parsed.sequence_num, 11u);
+}
+
+TEST(FlatImageTest, proto_roundtrip) {
+  Image proto;
+  proto.set_frame_id("front_12mm");
+  proto.set_encoding("yuyv");
+  proto.set_width(2);
+  proto.set_height(2);
+  proto.set_step(4);
+  proto.set_data("\x01\x02\x03\x04\x05\x06\x07\x08");
+  proto.mutable_header()->set_camera_timestamp(123);
+
+  FlatImage image;
+  image.FromProto(proto);
+  EXPECT_EQ(image.data.size(), 8u);
+
+  Image back;
+  image.ToProto(&back);
+  EXPECT_EQ(back.frame_id(), "front_12mm");
+  EXPECT_EQ(back.data(), proto.data());
+  EXPECT_EQ(back.header().camera_timestamp(), 123u);
+}
+
+}  // namespace flat
+}  // namespace drivers
+}  // namespace apollo
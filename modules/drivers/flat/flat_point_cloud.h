@@ -0,0 +1,246 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "modules/drivers/proto/pointcloud.pb.h"
+
+namespace apollo {
+namespace drivers {
+namespace flat {
+
+/**
+ * @brief Fixed-layout encoding of apollo::drivers::PointCloud.
+ *
+ * Point attributes are kept in structure-of-arrays vectors so the wire
+ * format is a small fixed header followed by five memcpy-able blocks, and
+ * batch kernels can run over a single contiguous attribute array. It
+ * implements the serialize/parse member functions cyber::message traits
+ * look for, so it can be published on a channel like any other message.
+ * Conversion to/from the proto only happens at record/bridge boundaries.
+ */
+struct FlatPointCloud {
+  // fixed wire header preceding the attribute blocks
+  struct WireHeader {
+    uint32_t magic;
+    uint32_t point_num;
+    uint32_t width;
+    uint32_t height;
+    uint32_t is_dense;
+    uint32_t frame_id_size;
+    double measurement_time;
+    double header_timestamp_sec;
+    uint64_t lidar_timestamp;
+    uint32_t sequence_num;
+    uint32_t reserved;
+  };
+
+  static const uint32_t kMagic = 0x46504331;  // "FPC1"
+
+  std::string frame_id;
+  bool is_dense = false;
+  double measurement_time = 0.0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  double header_timestamp_sec = 0.0;
+  uint64_t lidar_timestamp = 0;
+  uint32_t sequence_num = 0;
+
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<uint32_t> intensity;
+  std::vector<uint64_t> timestamp;
+
+  uint32_t point_num() const { return static_cast<uint32_t>(x.size()); }
+
+  void Reserve(size_t num) {
+    x.reserve(num);
+    y.reserve(num);
+    z.reserve(num);
+    intensity.reserve(num);
+    timestamp.reserve(num);
+  }
+
+  void Clear() {
+    x.clear();
+    y.clear();
+    z.clear();
+    intensity.clear();
+    timestamp.clear();
+  }
+
+  int ByteSize() const {
+    size_t num = x.size();
+    return static_cast<int>(sizeof(WireHeader) + frame_id.size() +
+                            num * (3 * sizeof(float) + sizeof(uint32_t) +
+                                   sizeof(uint64_t)));
+  }
+
+  bool SerializeToArray(void* data, int size) const {
+    if (data == nullptr || size < ByteSize()) {
+      return false;
+    }
+    WireHeader wire;
+    wire.magic = kMagic;
+    wire.point_num = point_num();
+    wire.width = width;
+    wire.height = height;
+    wire.is_dense = is_dense ? 1 : 0;
+    wire.frame_id_size = static_cast<uint32_t>(frame_id.size());
+    wire.measurement_time = measurement_time;
+    wire.header_timestamp_sec = header_timestamp_sec;
+    wire.lidar_timestamp = lidar_timestamp;
+    wire.sequence_num = sequence_num;
+    wire.reserved = 0;
+
+    char* ptr = reinterpret_cast<char*>(data);
+    memcpy(ptr, &wire, sizeof(wire));
+    ptr += sizeof(wire);
+    memcpy(ptr, frame_id.data(), frame_id.size());
+    ptr += frame_id.size();
+    ptr = WriteBlock(ptr, x);
+    ptr = WriteBlock(ptr, y);
+    ptr = WriteBlock(ptr, z);
+    ptr = WriteBlock(ptr, intensity);
+    WriteBlock(ptr, timestamp);
+    return true;
+  }
+
+  bool SerializeToString(std::string* str) const {
+    if (str == nullptr) {
+      return false;
+    }
+    str->resize(ByteSize());
+    return SerializeToArray(const_cast<char*>(str->data()),
+                            static_cast<int>(str->size()));
+  }
+
+  bool ParseFromArray(const void* data, int size) {
+    if (data == nullptr || size < static_cast<int>(sizeof(WireHeader))) {
+      return false;
+    }
+    WireHeader wire;
+    const char* ptr = reinterpret_cast<const char*>(data);
+    memcpy(&wire, ptr, sizeof(wire));
+    if (wire.magic != kMagic) {
+      return false;
+    }
+    size_t num = wire.point_num;
+    size_t expected = sizeof(WireHeader) + wire.frame_id_size +
+                      num * (3 * sizeof(float) + sizeof(uint32_t) +
+                             sizeof(uint64_t));
+    if (static_cast<size_t>(size) < expected) {
+      return false;
+    }
+    ptr += sizeof(wire);
+    frame_id.assign(ptr, wire.frame_id_size);
+    ptr += wire.frame_id_size;
+    is_dense = wire.is_dense != 0;
+    measurement_time = wire.measurement_time;
+    width = wire.width;
+    height = wire.height;
+    header_timestamp_sec = wire.header_timestamp_sec;
+    lidar_timestamp = wire.lidar_timestamp;
+    sequence_num = wire.sequence_num;
+    ptr = ReadBlock(ptr, num, &x);
+    ptr = ReadBlock(ptr, num, &y);
+    ptr = ReadBlock(ptr, num, &z);
+    ptr = ReadBlock(ptr, num, &intensity);
+    ReadBlock(ptr, num, &timestamp);
+    return true;
+  }
+
+  bool ParseFromString(const std::string& str) {
+    return ParseFromArray(str.data(), static_cast<int>(str.size()));
+  }
+
+  static void GetDescriptorString(const std::string& type,
+                                  std::string* desc_str) {
+    (void)type;
+    desc_str->clear();
+  }
+
+  static std::string TypeName() {
+    return "apollo.drivers.flat.FlatPointCloud";
+  }
+
+  void FromProto(const PointCloud& proto) {
+    frame_id = proto.frame_id();
+    is_dense = proto.is_dense();
+    measurement_time = proto.measurement_time();
+    width = proto.width();
+    height = proto.height();
+    header_timestamp_sec = proto.header().timestamp_sec();
+    lidar_timestamp = proto.header().lidar_timestamp();
+    sequence_num = proto.header().sequence_num();
+    Clear();
+    Reserve(proto.point_size());
+    for (const auto& point : proto.point()) {
+      x.emplace_back(point.x());
+      y.emplace_back(point.y());
+      z.emplace_back(point.z());
+      intensity.emplace_back(point.intensity());
+      timestamp.emplace_back(point.timestamp());
+    }
+  }
+
+  void ToProto(PointCloud* proto) const {
+    proto->Clear();
+    proto->set_frame_id(frame_id);
+    proto->set_is_dense(is_dense);
+    proto->set_measurement_time(measurement_time);
+    proto->set_width(width);
+    proto->set_height(height);
+    proto->mutable_header()->set_timestamp_sec(header_timestamp_sec);
+    proto->mutable_header()->set_lidar_timestamp(lidar_timestamp);
+    proto->mutable_header()->set_sequence_num(sequence_num);
+    for (size_t i = 0; i < x.size(); ++i) {
+      auto* point = proto->add_point();
+      point->set_x(x[i]);
+      point->set_y(y[i]);
+      point->set_z(z[i]);
+      point->set_intensity(intensity[i]);
+      point->set_timestamp(timestamp[i]);
+    }
+  }
+
+ private:
+  template <typename AttrT>
+  static char* WriteBlock(char* ptr, const std::vector<AttrT>& block) {
+    size_t bytes = block.size() * sizeof(AttrT);
+    memcpy(ptr, block.data(), bytes);
+    return ptr + bytes;
+  }
+
+  template <typename AttrT>
+  static const char* ReadBlock(const char* ptr, size_t num,
+                               std::vector<AttrT>* block) {
+    block->resize(num);
+    size_t bytes = num * sizeof(AttrT);
+    memcpy(block->data(), ptr, bytes);
+    return ptr + bytes;
+  }
+};
+
+}  // namespace flat
+}  // namespace drivers
+}  // namespace apollo
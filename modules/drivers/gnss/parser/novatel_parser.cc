@@ -18,6 +18,7 @@
 // messages must be
 // logged in order for this parser to work properly.
 //
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -254,7 +255,11 @@ Parser::MessageType NovatelParser::GetMessage(MessagePtr* message_ptr) {
       }
     } else if (header_length_ > 0) {  // Working on header.
       if (buffer_.size() < header_length_) {
-        buffer_.push_back(*data_++);
+        // bulk-copy whatever part of the header is available
+        size_t to_copy = std::min(static_cast<size_t>(data_end_ - data_),
+                                  header_length_ - buffer_.size());
+        buffer_.insert(buffer_.end(), data_, data_ + to_copy);
+        data_ += to_copy;
       } else {
         if (header_length_ == sizeof(novatel::LongHeader)) {
           total_length_ = header_length_ + novatel::CRC_LENGTH +
@@ -273,7 +278,11 @@ Parser::MessageType NovatelParser::GetMessage(MessagePtr* message_ptr) {
       }
     } else if (total_length_ > 0) {
       if (buffer_.size() < total_length_) {  // Working on body.
-        buffer_.push_back(*data_++);
+        // bulk-copy whatever part of the body is available
+        size_t to_copy = std::min(static_cast<size_t>(data_end_ - data_),
+                                  total_length_ - buffer_.size());
+        buffer_.insert(buffer_.end(), data_, data_ + to_copy);
+        data_ += to_copy;
         continue;
       }
       MessageType type = PrepareMessage(message_ptr);
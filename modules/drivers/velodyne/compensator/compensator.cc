@@ -16,14 +16,23 @@
 
 #include "modules/drivers/velodyne/compensator/compensator.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace apollo {
 namespace drivers {
 namespace velodyne {
 
+namespace {
+// Points falling within one bucket share a single interpolated transform.
+// 100us of a 20Hz spin is 0.00013 rad, below the range accuracy driven
+// rotation threshold used in MotionCompensation.
+constexpr uint64_t kTransformBucketNs = 100 * 1000;
+}  // namespace
+
 bool Compensator::QueryPoseAffineFromTF2(const uint64_t& timestamp, void* pose,
                                          const std::string& child_frame_id) {
   cyber::Time query_time(timestamp);
@@ -157,6 +166,28 @@ void Compensator::MotionCompensation(
     double theta = acos(abs_d);
     double sin_theta = sin(theta);
     double c1_sign = (d > 0) ? 1 : -1;
+
+    // interpolate one transform per time bucket up front instead of
+    // one quaternion slerp per point
+    const uint64_t bucket_num =
+        (timestamp_max - timestamp_min) / kTransformBucketNs + 1;
+    std::vector<Eigen::Affine3d, Eigen::aligned_allocator<Eigen::Affine3d>>
+        transforms(bucket_num);
+    for (uint64_t i = 0; i < bucket_num; ++i) {
+      uint64_t tp = std::min(
+          timestamp_min + i * kTransformBucketNs + kTransformBucketNs / 2,
+          timestamp_max);
+      double t = static_cast<double>(timestamp_max - tp) * f;
+
+      Eigen::Translation3d ti(t * translation);
+
+      double c0 = sin((1 - t) * theta) / sin_theta;
+      double c1 = sin(t * theta) / sin_theta * c1_sign;
+      Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
+
+      transforms[i] = ti * qi;
+    }
+
     for (const auto& point : msg->point()) {
       float x_scalar = point.x();
       if (std::isnan(x_scalar)) {
@@ -173,15 +204,8 @@ void Compensator::MotionCompensation(
       Eigen::Vector3d p(x_scalar, y_scalar, z_scalar);
 
       uint64_t tp = point.timestamp();
-      double t = static_cast<double>(timestamp_max - tp) * f;
-
-      Eigen::Translation3d ti(t * translation);
-
-      double c0 = sin((1 - t) * theta) / sin_theta;
-      double c1 = sin(t * theta) / sin_theta * c1_sign;
-      Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
-
-      Eigen::Affine3d trans = ti * qi;
+      const Eigen::Affine3d& trans =
+          transforms[(tp - timestamp_min) / kTransformBucketNs];
       p = trans * p;
 
       auto* point_new = msg_compensated->add_point();
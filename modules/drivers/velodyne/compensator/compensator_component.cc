@@ -33,7 +33,7 @@ bool CompensatorComponent::Init() {
   writer_ = node_->CreateWriter<PointCloud>(config.output_channel());
 
   compensator_.reset(new Compensator(config));
-  compensator_pool_.reset(new CCObjectPool<PointCloud>(pool_size_));
+  compensator_pool_.reset(new CCObjectPool<PointCloud>(pool_size_, true));
   compensator_pool_->ConstructAll();
   for (int i = 0; i < pool_size_; ++i) {
     auto point_cloud = compensator_pool_->GetObject();
@@ -14,6 +14,12 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "cyber/cyber.h"
+
 #include "modules/drivers/velodyne/parser/velodyne_parser.h"
 
 namespace apollo {
@@ -37,8 +43,33 @@ void Velodyne128Parser::GeneratePointcloud(
   // us
   gps_base_usec_ = scan_msg->basetime();
 
-  for (int i = 0; i < scan_msg->firing_pkts_size(); ++i) {
-    Unpack(scan_msg->firing_pkts(i), out_msg);
+  const int pkt_num = scan_msg->firing_pkts_size();
+  out_msg->mutable_point()->Reserve(pkt_num * SCANS_PER_PACKET);
+
+  // resolve per-packet base stamps sequentially so the gps rollover
+  // bookkeeping stays ordered, then convert the packets concurrently
+  std::vector<uint64_t> base_stamps(pkt_num);
+  for (int i = 0; i < pkt_num; ++i) {
+    const RawPacket* raw =
+        (const RawPacket*)scan_msg->firing_pkts(i).data().c_str();
+    double basetime = raw->gps_timestamp;
+    base_stamps[i] =
+        GetGpsStamp(basetime, &previous_packet_stamp_, &gps_base_usec_);
+  }
+
+  std::vector<std::future<std::shared_ptr<PointCloud>>> results;
+  results.reserve(pkt_num);
+  for (int i = 0; i < pkt_num; ++i) {
+    results.emplace_back(cyber::Async([this, &scan_msg, &base_stamps, i]() {
+      auto part = std::make_shared<PointCloud>();
+      UnpackPacket(scan_msg->firing_pkts(i), base_stamps[i], part);
+      return part;
+    }));
+  }
+  // merge in packet order so the output is deterministic
+  for (int i = 0; i < pkt_num; ++i) {
+    auto part = results[i].get();
+    out_msg->mutable_point()->MergeFrom(part->point());
     last_time_stamp_ = out_msg->measurement_time();
   }
 
@@ -70,37 +101,29 @@ void Velodyne128Parser::Order(std::shared_ptr<PointCloud> cloud) {
 
 void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
                                std::shared_ptr<PointCloud> pc) {
-  float azimuth_diff, azimuth_corrected_f;
-  float last_azimuth_diff = 0.0f;
-  uint16_t azimuth = 0;
-  uint16_t azimuth_next = 0;
-  uint16_t azimuth_corrected = 0;
   const RawPacket* raw = (const RawPacket*)pkt.data().c_str();
   double basetime = raw->gps_timestamp;
+  uint64_t base_stamp =
+      GetGpsStamp(basetime, &previous_packet_stamp_, &gps_base_usec_);
+  UnpackPacket(pkt, base_stamp, pc);
+}
+
+void Velodyne128Parser::UnpackPacket(const VelodynePacket& pkt,
+                                     uint64_t base_stamp,
+                                     std::shared_ptr<PointCloud> pc) {
+  const RawPacket* raw = (const RawPacket*)pkt.data().c_str();
 
   for (int block = 0; block < BLOCKS_PER_PACKET; block++) {
-    // Calculate difference between current and next block's azimuth angle.
-    if (block == 0) {
-      azimuth = raw->blocks[block].rotation;
-    } else {
-      azimuth = azimuth_next;
-    }
-    if (block < (BLOCKS_PER_PACKET - 1)) {
-      azimuth_next = raw->blocks[block + 1].rotation;
-      azimuth_diff =
-          static_cast<float>((36000 + azimuth_next - azimuth) % 36000);
-      last_azimuth_diff = azimuth_diff;
-    } else {
-      azimuth_diff = last_azimuth_diff;
-    }
+    // all channels of a sequence fire together, so the rotation
+    // correction is constant within a block
+    uint16_t azimuth = raw->blocks[block].rotation;
+    uint16_t azimuth_corrected = azimuth % 36000;
 
     /*condition added to avoid calculating points which are not
       in the interesting defined area (min_angle < area < max_angle)*/
     for (int j = 0, k = 0; j < SCANS_PER_BLOCK; j++, k += RAW_SCAN_SIZE) {
       uint8_t group = static_cast<uint8_t>(block % 4);
       uint8_t chan_id = static_cast<uint8_t>(j + group * 32);
-      uint8_t firing_order = chan_id / 8;
-      firing_order = 0;
       LaserCorrection& corrections = calibration_.laser_corrections_[chan_id];
       // distance extraction
       // union two_bytes tmp;
@@ -112,8 +135,9 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
           raw_distance.raw_distance * VSL128_DISTANCE_RESOLUTION;
       float distance = real_distance + corrections.dist_correction;
 
-      uint64_t timestamp = static_cast<uint64_t>(GetTimestamp(
-          basetime, (*inner_time_)[block][j], static_cast<uint16_t>(block)));
+      uint64_t timestamp =
+          base_stamp +
+          static_cast<uint64_t>((*inner_time_)[block][j]) * 1000;
       if (!is_scan_valid(azimuth, distance)) {
         // todo orgnized
         if (config_.organized()) {
@@ -130,14 +154,6 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
       // if (pointInRange(distance)) {
       int intensity = static_cast<int>(raw->blocks[block].data[k + 2]);
 
-      /** correct for the laser rotation as a function of timing during the
-       * firings **/
-      azimuth_corrected_f =
-          azimuth +
-          (azimuth_diff * (firing_order * CHANNEL_TDURATION) / SEQ_TDURATION);
-      azimuth_corrected =
-          (static_cast<uint16_t>(round(azimuth_corrected_f))) % 36000;
-
       // add new point
       PointXYZIT* point_new = pc->add_point();
 
@@ -37,7 +37,7 @@ bool VelodyneConvertComponent::Init() {
   conv_->init(velodyne_config);
   writer_ =
       node_->CreateWriter<PointCloud>(velodyne_config.convert_channel_name());
-  point_cloud_pool_.reset(new CCObjectPool<PointCloud>(pool_size_));
+  point_cloud_pool_.reset(new CCObjectPool<PointCloud>(pool_size_, true));
   point_cloud_pool_->ConstructAll();
   for (int i = 0; i < pool_size_; i++) {
     auto point_cloud = point_cloud_pool_->GetObject();
@@ -363,6 +363,10 @@ class Velodyne128Parser : public VelodyneParser {
   uint64_t GetTimestamp(double base_time, float time_offset,
                         uint16_t laser_block_id);
   void Unpack(const VelodynePacket& pkt, std::shared_ptr<PointCloud> pc);
+  // Unpack one packet whose base gps stamp is already resolved, so
+  // packets of one scan can be converted concurrently
+  void UnpackPacket(const VelodynePacket& pkt, uint64_t base_stamp,
+                    std::shared_ptr<PointCloud> pc);
   int IntensityCompensate(const LaserCorrection& corrections,
                           const uint16_t raw_distance, int intensity);
   // Previous Velodyne packet time stamp. (offset to the top hour)
@@ -47,16 +47,40 @@ bool GuardianComponent::Init() {
         control_cmd_.CopyFrom(*cmd);
       });
 
+  guardian_writer_ = node_->CreateWriter<GuardianCommand>(FLAGS_guardian_topic);
+
+  // Prepare the emergency-stop command once, so the bypass path below only
+  // stamps and publishes it. The writer and this command must exist before
+  // the system status reader: its callback may fire as soon as the reader
+  // is created.
+  auto* emergency_control_cmd = emergency_stop_cmd_.mutable_control_command();
+  emergency_control_cmd->set_throttle(0.0);
+  emergency_control_cmd->set_steering_target(0.0);
+  emergency_control_cmd->set_steering_rate(25.0);
+  emergency_control_cmd->set_is_in_safe_mode(true);
+  emergency_control_cmd->set_brake(
+      guardian_conf_.guardian_cmd_emergency_stop_percentage());
+
   system_status_reader_ = node_->CreateReader<SystemStatus>(
       FLAGS_system_status_topic,
       [this](const std::shared_ptr<SystemStatus>& status) {
         ADEBUG << "Received system status data: run system status callback.";
-        std::lock_guard<std::mutex> lock(mutex_);
-        system_status_.CopyFrom(*status);
+        bool emergency_stop = false;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          system_status_.CopyFrom(*status);
+          emergency_stop = guardian_conf_.guardian_enable() &&
+                           system_status_.has_safety_mode_trigger_time() &&
+                           system_status_.require_emergency_stop();
+        }
+        // Publish the prepared emergency-stop command straight from the
+        // callback; waiting for the next timer tick would add up to one
+        // timer period between fault detection and the brake command.
+        if (emergency_stop) {
+          PublishEmergencyStopCommand(status->header().timestamp_sec());
+        }
       });
 
-  guardian_writer_ = node_->CreateWriter<GuardianCommand>(FLAGS_guardian_topic);
-
   return true;
 }
 
@@ -81,6 +105,17 @@ bool GuardianComponent::Proc() {
   return true;
 }
 
+void GuardianComponent::PublishEmergencyStopCommand(
+    const double detection_time_sec) {
+  auto guardian_cmd = std::make_shared<GuardianCommand>(emergency_stop_cmd_);
+  common::util::FillHeader(node_->Name(), guardian_cmd.get());
+  guardian_writer_->Write(guardian_cmd);
+  AINFO << "Emergency stop bypass published, reaction latency: "
+        << (guardian_cmd->header().timestamp_sec() - detection_time_sec) *
+               1000.0
+        << " ms from fault detection to brake command.";
+}
+
 void GuardianComponent::PassThroughControlCommand() {
   std::lock_guard<std::mutex> lock(mutex_);
   guardian_cmd_.mutable_control_command()->CopyFrom(control_cmd_);
@@ -47,6 +47,7 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
  private:
   void PassThroughControlCommand();
   void TriggerSafetyMode();
+  void PublishEmergencyStopCommand(const double detection_time_sec);
 
   apollo::guardian::GuardianConf guardian_conf_;
   apollo::canbus::Chassis chassis_;
@@ -54,6 +55,11 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
   apollo::control::ControlCommand control_cmd_;
   apollo::guardian::GuardianCommand guardian_cmd_;
 
+  // An emergency-stop command prepared at Init() so the system status
+  // callback can publish it immediately, without assembling a proto or
+  // waiting for the next timer tick.
+  apollo::guardian::GuardianCommand emergency_stop_cmd_;
+
   std::shared_ptr<apollo::cyber::Reader<apollo::canbus::Chassis>>
       chassis_reader_;
   std::shared_ptr<apollo::cyber::Reader<apollo::control::ControlCommand>>
@@ -243,49 +243,42 @@ void LocalizationIntegProcess::GetResult(IntegState *state, InsPva *sins_pva,
 
 void LocalizationIntegProcess::MeasureDataProcess(
     const MeasureData &measure_msg) {
-  measure_data_queue_mutex_.lock();
-  measure_data_queue_.push(measure_msg);
-  measure_data_queue_mutex_.unlock();
+  // when the queue is full, drop the oldest measure so the latest
+  // one is always accepted
+  while (!measure_data_queue_.Enqueue(measure_msg)) {
+    MeasureData discard_measure;
+    if (!measure_data_queue_.Dequeue(&discard_measure)) {
+      break;
+    }
+  }
 }
 
 void LocalizationIntegProcess::StartThreadLoop() {
   keep_running_ = true;
   measure_data_queue_size_ = 150;
+  if (!measure_data_queue_.Init(measure_data_queue_size_,
+                                new cyber::base::BlockWaitStrategy())) {
+    AERROR << "Failed to init measure data queue";
+  }
   cyber::Async(&LocalizationIntegProcess::MeasureDataThreadLoop, this);
 }
 
 void LocalizationIntegProcess::StopThreadLoop() {
   if (keep_running_.load()) {
     keep_running_ = false;
+    measure_data_queue_.BreakAllWait();
   }
 }
 
 void LocalizationIntegProcess::MeasureDataThreadLoop() {
   AINFO << "Started measure data process thread";
   while (keep_running_.load()) {
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
-      int size = static_cast<int>(measure_data_queue_.size());
-      while (size > measure_data_queue_size_) {
-        measure_data_queue_.pop();
-        --size;
-      }
-      if (measure_data_queue_.size() == 0) {
-        lock.unlock();
-        cyber::Yield();
-        continue;
-      }
-    }
-
     MeasureData measure;
-    int waiting_num = 0;
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
-      measure = measure_data_queue_.front();
-      measure_data_queue_.pop();
-      waiting_num = static_cast<int>(measure_data_queue_.size());
+    if (!measure_data_queue_.WaitDequeue(&measure)) {
+      continue;
     }
 
+    int waiting_num = static_cast<int>(measure_data_queue_.Size());
     if (waiting_num > measure_data_queue_size_ / 4) {
       AWARN << waiting_num << " measure are waiting to process.";
     }
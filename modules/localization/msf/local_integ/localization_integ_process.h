@@ -16,11 +16,11 @@
 
 #pragma once
 
-#include <queue>
 #include <string>
 
 #include "Eigen/Core"
 #include "Eigen/Geometry"
+#include "cyber/base/bounded_queue.h"
 #include "cyber/cyber.h"
 
 #include "include/sins.h"
@@ -90,9 +90,9 @@ class LocalizationIntegProcess {
   double pva_covariance_[9][9];
 
   std::atomic<bool> keep_running_;
-  std::queue<MeasureData> measure_data_queue_;
+  // lock-free handoff from the sensor callbacks to the measure thread
+  cyber::base::BoundedQueue<MeasureData> measure_data_queue_;
   int measure_data_queue_size_ = 150;
-  std::mutex measure_data_queue_mutex_;
 
   int delay_output_counter_ = 0;
 };
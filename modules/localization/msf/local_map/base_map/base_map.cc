@@ -16,6 +16,8 @@
 
 #include "modules/localization/msf/local_map/base_map/base_map.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -26,6 +28,13 @@ namespace apollo {
 namespace localization {
 namespace msf {
 
+namespace {
+// The max number of forecast rings ahead of the moving direction.
+constexpr int kMaxPreloadRingNum = 3;
+// The number of frames of lead time the preloading aims to keep.
+constexpr double kPreloadHorizonFrameNum = 10.0;
+}  // namespace
+
 BaseMap::BaseMap(BaseMapConfig* map_config)
     : map_config_(map_config),
       map_node_cache_lvl1_(nullptr),
@@ -69,6 +78,7 @@ BaseMapNode* BaseMap::GetMapNodeSafe(const MapNodeIndex& index) {
   boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
   if (map_node_cache_lvl2_->Get(index, &node)) {
     node->SetIsReserved(true);
+    node->InflateMemory();
 
     map_node_cache_lvl1_->Put(index, node);
     return node;
@@ -135,6 +145,7 @@ void BaseMap::LoadMapNodes(std::set<MapNodeIndex>* map_ids) {
     if (map_node_cache_lvl2_->Get(*itr, &node)) {
       // std::cout << "LoadMapNodes find in L2 cache" << std::endl;
       node->SetIsReserved(true);
+      node->InflateMemory();
       map_node_cache_lvl1_->Put(*itr, node);
       itr = map_ids->erase(itr);
     } else {
@@ -167,6 +178,7 @@ void BaseMap::LoadMapNodes(std::set<MapNodeIndex>* map_ids) {
       AINFO << "LoadMapNodes: preload missed, load this node in main thread.\n"
             << *itr;
       node->SetIsReserved(true);
+      node->InflateMemory();
       map_node_cache_lvl1_->Put(*itr, node);
       itr = map_ids->erase(itr);
     } else {
@@ -249,6 +261,11 @@ void BaseMap::LoadMapNodeThreadSafety(MapNodeIndex index, bool is_reserved) {
     AERROR << " Loaded map node: " << index;
   }
   map_node->SetIsReserved(is_reserved);
+  if (!is_reserved) {
+    // preloaded nodes wait in the L2 cache at their on-disk size; the
+    // matrix is rebuilt from the retained body when they are promoted
+    map_node->CompactMemory();
+  }
 
   boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
   BaseMapNode* node_remove = map_node_cache_lvl2_->Put(index, map_node);
@@ -359,40 +376,53 @@ void BaseMap::PreloadMapArea(const Eigen::Vector3d& location,
                                          resolution_id, zone_id);
   map_ids.insert(map_id);
 
-  for (int i = -1; i < 2; ++i) {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + x_direction * 1.5 *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + static_cast<double>(i) *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
-                                           resolution_id, zone_id);
-    map_ids.insert(map_id);
+  // Forecast the nodes ahead along the moving direction. Loading a node
+  // costs a long time (over 100ms), while a fast vehicle can cross a node
+  // in only a few frames, so the number of forecast rings scales with the
+  // motion magnitude to keep enough lead time at high speed.
+  double node_length_x = this->map_config_->map_node_size_x_ *
+                         static_cast<double>(map_pixel_resolution);
+  double node_length_y = this->map_config_->map_node_size_y_ *
+                         static_cast<double>(map_pixel_resolution);
+  int x_ring_num = std::min(
+      kMaxPreloadRingNum,
+      1 + static_cast<int>(std::abs(trans_diff[0]) * kPreloadHorizonFrameNum /
+                           node_length_x));
+  int y_ring_num = std::min(
+      kMaxPreloadRingNum,
+      1 + static_cast<int>(std::abs(trans_diff[1]) * kPreloadHorizonFrameNum /
+                           node_length_y));
+
+  for (int ring = 1; ring <= x_ring_num; ++ring) {
+    for (int i = -1; i < 2; ++i) {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] +
+              x_direction * (0.5 + static_cast<double>(ring)) * node_length_x;
+      pt[1] = location[1] + static_cast<double>(i) * node_length_y;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
+                                             resolution_id, zone_id);
+      map_ids.insert(map_id);
+    }
   }
-  for (int i = -1; i < 2; ++i) {
-    Eigen::Vector3d pt;
-    pt[0] = location[0] + static_cast<double>(i) *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + y_direction * 1.5 *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
-    pt[2] = 0;
-    map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
-                                           resolution_id, zone_id);
-    map_ids.insert(map_id);
+  for (int ring = 1; ring <= y_ring_num; ++ring) {
+    for (int i = -1; i < 2; ++i) {
+      Eigen::Vector3d pt;
+      pt[0] = location[0] + static_cast<double>(i) * node_length_x;
+      pt[1] = location[1] +
+              y_direction * (0.5 + static_cast<double>(ring)) * node_length_y;
+      pt[2] = 0;
+      map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
+                                             resolution_id, zone_id);
+      map_ids.insert(map_id);
+    }
   }
-  {
+  for (int ring = 1; ring <= std::min(x_ring_num, y_ring_num); ++ring) {
     Eigen::Vector3d pt;
-    pt[0] = location[0] + x_direction * 1.5 *
-                              this->map_config_->map_node_size_x_ *
-                              map_pixel_resolution;
-    pt[1] = location[1] + y_direction * 1.5 *
-                              this->map_config_->map_node_size_y_ *
-                              map_pixel_resolution;
+    pt[0] = location[0] +
+            x_direction * (0.5 + static_cast<double>(ring)) * node_length_x;
+    pt[1] = location[1] +
+            y_direction * (0.5 + static_cast<double>(ring)) * node_length_y;
     pt[2] = 0;
     map_id = MapNodeIndex::GetMapNodeIndex(*(this->map_config_), pt,
                                            resolution_id, zone_id);
@@ -37,6 +37,9 @@ class BaseMapMatrix {
   virtual void Init(const BaseMapConfig* config) = 0;
   /**@brief Reset map cells data. */
   virtual void Reset(const BaseMapConfig* config) = 0;
+  /**@brief Release the map cell memory. The matrix can be rebuilt
+   * through Init or LoadBinary afterwards. */
+  virtual void Release() {}
   /**@brief Load the map cell from a binary chunk.
    * @param <return> The size read (the real size of object).
    */
@@ -16,6 +16,8 @@
 
 #include "modules/localization/msf/local_map/base_map/base_map_node.h"
 
+#include <utility>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/localization/msf/local_map/base_map/base_map_matrix.h"
@@ -69,9 +71,39 @@ void BaseMapNode::ResetMapNode() {
   is_changed_ = false;
   data_is_ready_ = false;
   is_reserved_ = false;
+  std::vector<unsigned char>().swap(compressed_body_);
+  if (is_compacted_) {
+    // the matrix was released while compacted, rebuild the cells
+    InitMapMatrix(map_config_);
+    is_compacted_ = false;
+  }
   map_matrix_->Reset(map_config_);
 }
 
+bool BaseMapNode::CompactMemory() {
+  if (is_compacted_) {
+    return true;
+  }
+  if (!data_is_ready_ || is_changed_ || compressed_body_.empty()) {
+    return false;
+  }
+  map_matrix_->Release();
+  is_compacted_ = true;
+  return true;
+}
+
+bool BaseMapNode::InflateMemory() {
+  if (!is_compacted_) {
+    return true;
+  }
+  if (compressed_body_.empty()) {
+    return false;
+  }
+  LoadBodyBinary(&compressed_body_);
+  is_compacted_ = false;
+  return true;
+}
+
 // void BaseMapNode::SetCompressionStrategy(compression::CompressionStrategy*
 // strategy) {
 //     compression_strategy_ = strategy;
@@ -199,6 +231,10 @@ unsigned int BaseMapNode::LoadBinary(FILE* file) {
   read_size = fread(&buf[0], 1, file_body_binary_size_, file);
   CHECK_EQ(read_size, file_body_binary_size_);
   processed_size += LoadBodyBinary(&buf);
+  // retain the body as read from disk so the node can be compacted in
+  // the preload cache and inflated again without a disk round-trip
+  compressed_body_ = std::move(buf);
+  is_compacted_ = false;
   return processed_size;
 }
 
@@ -54,6 +54,16 @@ class BaseMapNode {
   bool Load();
   bool Load(const char* filename);
 
+  /**@brief Release the map cell matrix and keep only the compressed
+   * body read from disk. Only possible for a loaded, unchanged node,
+   * so preloaded nodes wait in memory at their on-disk size. */
+  bool CompactMemory();
+  /**@brief Rebuild the map cell matrix from the retained compressed
+   * body. No-op if the node is not compacted. */
+  bool InflateMemory();
+  /**@brief Get if the node holds only its compressed body. */
+  inline bool GetIsCompacted() const { return is_compacted_; }
+
   // /**@brief Set compression strategy. */
   // void SetCompressionStrategy(compression::CompressionStrategy* strategy);
   /**@brief Get map cell matrix. */
@@ -180,6 +190,13 @@ class BaseMapNode {
   bool is_changed_ = false;
   /* *@brief Indicate map node data is ready*/
   bool data_is_ready_ = false;
+  /**@brief The body binary as read from disk, kept so the matrix can be
+   * released while the node waits in the preload cache and rebuilt
+   * without touching the disk again. */
+  std::vector<unsigned char> compressed_body_;
+  /**@brief If the matrix is released and only compressed_body_ holds
+   * the node data. */
+  bool is_compacted_ = false;
   /**@brief The body binary size in file. It's useful when reading and writing
    * files. */
   mutable unsigned int file_body_binary_size_ = 0;
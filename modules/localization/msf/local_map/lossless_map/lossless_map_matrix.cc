@@ -314,6 +314,15 @@ void LosslessMapMatrix::Reset(unsigned int rows, unsigned int cols) {
   }
 }
 
+void LosslessMapMatrix::Release() {
+  if (map_cells_) {
+    delete[] map_cells_;
+    map_cells_ = nullptr;
+  }
+  rows_ = 0;
+  cols_ = 0;
+}
+
 unsigned int LosslessMapMatrix::LoadBinary(unsigned char* buf) {
   unsigned int* p = reinterpret_cast<unsigned int*>(buf);
   rows_ = *p;
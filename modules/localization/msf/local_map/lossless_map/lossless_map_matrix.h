@@ -149,6 +149,8 @@ class LosslessMapMatrix : public BaseMapMatrix {
   virtual void Init(const BaseMapConfig* config);
   /**@brief Reset map cells data. */
   virtual void Reset(const BaseMapConfig* config);
+  /**@brief Release the map cell memory. */
+  virtual void Release();
 
   void Init(unsigned int rows, unsigned int cols);
   void Reset(unsigned int rows, unsigned int cols);
@@ -106,6 +106,15 @@ void LossyMapMatrix2D::Reset(const BaseMapConfig* config) {
   return;
 }
 
+void LossyMapMatrix2D::Release() {
+  if (map_cells_) {
+    delete[] map_cells_;
+    map_cells_ = nullptr;
+  }
+  rows_ = 0;
+  cols_ = 0;
+}
+
 void LossyMapMatrix2D::Reset(unsigned int rows, unsigned int cols) {
   unsigned int length = rows * cols;
   for (unsigned int i = 0; i < length; ++i) {
@@ -65,6 +65,8 @@ class LossyMapMatrix2D : public BaseMapMatrix {
   virtual void Init(const BaseMapConfig* config);
   /**@brief Reset map cells data. */
   virtual void Reset(const BaseMapConfig* config);
+  /**@brief Release the map cell memory. */
+  virtual void Release();
 
   void Init(unsigned int rows, unsigned int cols);
   void Reset(unsigned int rows, unsigned int cols);
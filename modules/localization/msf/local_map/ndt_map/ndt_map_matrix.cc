@@ -363,6 +363,15 @@ void NdtMapMatrix::Reset(unsigned int rows, unsigned int cols) {
   }
 }
 
+void NdtMapMatrix::Release() {
+  if (map3d_cells_) {
+    delete[] map3d_cells_;
+    map3d_cells_ = NULL;
+  }
+  rows_ = 0;
+  cols_ = 0;
+}
+
 unsigned int NdtMapMatrix::LoadBinary(unsigned char* buf) {
   unsigned int* p = reinterpret_cast<unsigned int*>(buf);
   rows_ = *p;
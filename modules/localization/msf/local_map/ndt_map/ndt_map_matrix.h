@@ -146,6 +146,8 @@ class NdtMapMatrix : public BaseMapMatrix {
   virtual void Init(const BaseMapConfig* config);
   /**@brief Reset the matrix item to default value. */
   virtual void Reset(const BaseMapConfig* config);
+  /**@brief Release the matrix cell memory. */
+  virtual void Release();
 
   /**@brief Initialize the matrix with the size of rows and columns. */
   void Init(unsigned int rows, unsigned int cols);
@@ -25,6 +25,11 @@ int HDMap::LoadMapFromFile(const std::string& map_filename) {
   return impl_.LoadMapFromFile(map_filename);
 }
 
+int HDMap::LoadMapFromRawData(const void* data, size_t size) {
+  AINFO << "Loading HDMap from " << size << " shared bytes ...";
+  return impl_.LoadMapFromRawData(data, size);
+}
+
 int HDMap::LoadMapFromProto(const Map& map_proto) {
   ADEBUG << "Loading HDMap with header: "
          << map_proto.header().ShortDebugString();
@@ -59,6 +59,14 @@ class HDMap {
    */
   int LoadMapFromFile(const std::string& map_filename);
 
+  /**
+   * @brief load map from serialized bytes, e.g. a shared memory blob.
+   * @param data serialized map data
+   * @param size size of the serialized data in bytes
+   * @return 0:success, otherwise failed
+   */
+  int LoadMapFromRawData(const void* data, size_t size);
+
   /**
    * @brief load map from a given protobuf message.
    * @param map_proto map data in protobuf format
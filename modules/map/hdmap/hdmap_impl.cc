@@ -16,8 +16,10 @@ limitations under the License.
 #include "modules/map/hdmap/hdmap_impl.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <set>
+#include <thread>
 #include <unordered_set>
 
 #include "cyber/common/file.h"
@@ -42,6 +44,12 @@ Id CreateHDMapId(const std::string& string_id) {
 constexpr double kLanesSearchRange = 10.0;
 // backward search distance in GetForwardNearestSignalsOnLane
 constexpr int kBackwardDistance = 4;
+// grid size for snapping range lane queries onto cache keys
+constexpr double kLaneQueryGridSize = 2.0;  // meters.
+// the worst-case distance between a query point and its snapped grid center;
+// inflating the cached radius by this keeps the entry a superset of the
+// exact query result.
+constexpr double kLaneQueryMaxSnapError = kLaneQueryGridSize * M_SQRT1_2;
 
 }  // namespace
 
@@ -60,6 +68,14 @@ int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
   return LoadMapFromProto(map_);
 }
 
+int HDMapImpl::LoadMapFromRawData(const void* data, size_t size) {
+  Clear();
+  if (!map_.ParseFromArray(data, static_cast<int>(size))) {
+    return -1;
+  }
+  return LoadMapFromProto(map_);
+}
+
 int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
   if (&map_proto != &map_) {  // avoid an unnecessary copy
     Clear();
@@ -122,8 +138,30 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
       }
     }
   }
+  // All tables are fully built by this point, and PostProcess() only reads
+  // them through const lookups while filling the object's own overlap lists,
+  // so the lane loop (by far the largest on a city-scale map) is sharded
+  // across worker threads.
+  std::vector<LaneInfo*> lanes_to_post_process;
+  lanes_to_post_process.reserve(lane_table_.size());
   for (const auto& lane_ptr_pair : lane_table_) {
-    lane_ptr_pair.second->PostProcess(*this);
+    lanes_to_post_process.push_back(lane_ptr_pair.second.get());
+  }
+  const size_t num_workers =
+      std::max<size_t>(1, std::thread::hardware_concurrency());
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (size_t worker = 0; worker < num_workers; ++worker) {
+    workers.emplace_back(
+        [this, &lanes_to_post_process, worker, num_workers]() {
+          for (size_t i = worker; i < lanes_to_post_process.size();
+               i += num_workers) {
+            lanes_to_post_process[i]->PostProcess(*this);
+          }
+        });
+  }
+  for (auto& worker : workers) {
+    worker.join();
   }
   for (const auto& junction_ptr_pair : junction_table_) {
     junction_ptr_pair.second->PostProcess(*this);
@@ -131,16 +169,24 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
   for (const auto& stop_sign_ptr_pair : stop_sign_table_) {
     stop_sign_ptr_pair.second->PostProcess(*this);
   }
-  BuildLaneSegmentKDTree();
-  BuildJunctionPolygonKDTree();
-  BuildSignalSegmentKDTree();
-  BuildCrosswalkPolygonKDTree();
-  BuildStopSignSegmentKDTree();
-  BuildYieldSignSegmentKDTree();
-  BuildClearAreaPolygonKDTree();
-  BuildSpeedBumpSegmentKDTree();
-  BuildParkingSpacePolygonKDTree();
-  BuildPNCJunctionPolygonKDTree();
+  // Each builder writes a distinct box table and kdtree member, so the ten
+  // spatial indices are constructed concurrently.
+  std::vector<std::thread> kdtree_builders;
+  kdtree_builders.emplace_back(&HDMapImpl::BuildLaneSegmentKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildJunctionPolygonKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildSignalSegmentKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildCrosswalkPolygonKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildStopSignSegmentKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildYieldSignSegmentKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildClearAreaPolygonKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildSpeedBumpSegmentKDTree, this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildParkingSpacePolygonKDTree,
+                               this);
+  kdtree_builders.emplace_back(&HDMapImpl::BuildPNCJunctionPolygonKDTree,
+                               this);
+  for (auto& builder : kdtree_builders) {
+    builder.join();
+  }
   return 0;
 }
 
@@ -215,14 +261,42 @@ int HDMapImpl::GetLanes(const Vec2d& point, double distance,
     return -1;
   }
   lanes->clear();
-  std::vector<std::string> ids;
-  const int status =
-      SearchObjects(point, distance, *lane_segment_kdtree_, &ids);
-  if (status < 0) {
-    return status;
+
+  // Snap the query point onto a coarse grid so the near-identical queries
+  // issued frame over frame by planning, prediction and perception share one
+  // cache entry and one KD-tree descent.
+  const int64_t grid_x =
+      static_cast<int64_t>(std::floor(point.x() / kLaneQueryGridSize));
+  const int64_t grid_y =
+      static_cast<int64_t>(std::floor(point.y() / kLaneQueryGridSize));
+  const std::string key =
+      apollo::common::util::StrCat(grid_x, ",", grid_y, ",", distance);
+
+  std::vector<LaneInfoConstPtr> candidates;
+  if (!lane_query_cache_.Get(key, &candidates)) {
+    const Vec2d grid_center(
+        (static_cast<double>(grid_x) + 0.5) * kLaneQueryGridSize,
+        (static_cast<double>(grid_y) + 0.5) * kLaneQueryGridSize);
+    std::vector<std::string> ids;
+    const int status =
+        SearchObjects(grid_center, distance + kLaneQueryMaxSnapError,
+                      *lane_segment_kdtree_, &ids);
+    if (status < 0) {
+      return status;
+    }
+    candidates.reserve(ids.size());
+    for (const auto& id : ids) {
+      candidates.emplace_back(GetLaneById(CreateHDMapId(id)));
+    }
+    lane_query_cache_.Put(key, candidates);
   }
-  for (const auto& id : ids) {
-    lanes->emplace_back(GetLaneById(CreateHDMapId(id)));
+
+  // The cached entry covers the grid center with an inflated radius, so it is
+  // a superset of the exact result; re-filter by exact distance.
+  for (const auto& lane : candidates) {
+    if (lane->DistanceTo(point) <= distance) {
+      lanes->emplace_back(lane);
+    }
   }
   return 0;
 }
@@ -1331,6 +1405,7 @@ void HDMapImpl::Clear() {
   parking_space_polygon_kdtree_.reset(nullptr);
   pnc_junction_polygon_boxes_.clear();
   pnc_junction_polygon_kdtree_.reset(nullptr);
+  lane_query_cache_.Clear();
 }
 
 }  // namespace hdmap
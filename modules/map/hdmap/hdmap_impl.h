@@ -26,6 +26,7 @@ limitations under the License.
 #include "modules/common/math/line_segment2d.h"
 #include "modules/common/math/polygon2d.h"
 #include "modules/common/math/vec2d.h"
+#include "modules/common/util/concurrent_lru_cache.h"
 #include "modules/map/hdmap/hdmap_common.h"
 #include "modules/map/proto/map.pb.h"
 #include "modules/map/proto/map_clear_area.pb.h"
@@ -86,6 +87,14 @@ class HDMapImpl {
    */
   int LoadMapFromFile(const std::string& map_filename);
 
+  /**
+   * @brief load map from serialized bytes, e.g. a shared memory blob
+   * @param data serialized map data
+   * @param size size of the serialized data in bytes
+   * @return 0:success, otherwise failed
+   */
+  int LoadMapFromRawData(const void* data, size_t size);
+
   /**
    * @brief load map from a protobuf message
    * @param map_proto map data in protobuf format
@@ -395,6 +404,8 @@ class HDMapImpl {
   void Clear();
 
  private:
+  static constexpr size_t kLaneQueryCacheCapacity = 1024;
+
   Map map_;
   LaneTable lane_table_;
   JunctionTable junction_table_;
@@ -438,6 +449,14 @@ class HDMapImpl {
 
   std::vector<PNCJunctionPolygonBox> pnc_junction_polygon_boxes_;
   std::unique_ptr<PNCJunctionPolygonKDTree> pnc_junction_polygon_kdtree_;
+
+  // Cache of range lane queries, keyed by the query point snapped to a coarse
+  // grid. Each entry holds a superset of the lanes within the requested
+  // radius which GetLanes re-filters by exact distance, so cached results are
+  // identical to uncached ones. Cleared whenever a new map is loaded.
+  mutable apollo::common::util::ConcurrentLRUCache<
+      std::string, std::vector<LaneInfoConstPtr>>
+      lane_query_cache_{kLaneQueryCacheCapacity};
 };
 
 }  // namespace hdmap
@@ -16,6 +16,7 @@ limitations under the License.
 
 #include "cyber/common/file.h"
 #include "modules/common/util/string_tokenizer.h"
+#include "modules/map/hdmap/shared_map_blob.h"
 #include "modules/map/relative_map/proto/navigation.pb.h"
 
 namespace apollo {
@@ -70,6 +71,17 @@ std::string RoutingMapFile() {
 
 std::unique_ptr<HDMap> CreateMap(const std::string& map_file_path) {
   std::unique_ptr<HDMap> hdmap(new HDMap());
+  if (FLAGS_use_shared_base_map &&
+      !apollo::common::util::EndWith(map_file_path, ".xml")) {
+    SharedMapBlob blob;
+    if (blob.AttachOrCreate(map_file_path) &&
+        hdmap->LoadMapFromRawData(blob.data(), blob.size()) == 0) {
+      AINFO << "Load HDMap from shared blob success: " << map_file_path;
+      return hdmap;
+    }
+    AWARN << "Failed to load HDMap from shared blob, falling back to file: "
+          << map_file_path;
+  }
   if (hdmap->LoadMapFromFile(map_file_path) != 0) {
     AERROR << "Failed to load HDMap " << map_file_path;
     return nullptr;
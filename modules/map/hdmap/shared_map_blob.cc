@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/map/hdmap/shared_map_blob.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace hdmap {
+namespace {
+
+// Project id mixed with the map file inode by ftok(), 'M' for map.
+constexpr int kSharedMapBlobProjectId = 0x4D;
+// How long an attaching process waits for the creator to finish copying
+// the map into the segment: 3000 * 10ms = 30s.
+constexpr int kReadyWaitIterations = 3000;
+constexpr int kReadyWaitIntervalUs = 10000;
+
+}  // namespace
+
+SharedMapBlob::~SharedMapBlob() {
+  if (addr_ != nullptr) {
+    shmdt(addr_);
+  }
+}
+
+const void* SharedMapBlob::data() const {
+  if (addr_ == nullptr) {
+    return nullptr;
+  }
+  return static_cast<const BlobHeader*>(addr_) + 1;
+}
+
+bool SharedMapBlob::AttachOrCreate(const std::string& map_filename) {
+  struct stat file_stat;
+  if (stat(map_filename.c_str(), &file_stat) != 0) {
+    AERROR << "Failed to stat map file: " << map_filename;
+    return false;
+  }
+  const size_t file_size = static_cast<size_t>(file_stat.st_size);
+  if (file_size == 0) {
+    AERROR << "Map file is empty: " << map_filename;
+    return false;
+  }
+  const key_t key = ftok(map_filename.c_str(), kSharedMapBlobProjectId);
+  if (key == -1) {
+    AERROR << "Failed to derive shm key for map file: " << map_filename;
+    return false;
+  }
+  const size_t total_size = sizeof(BlobHeader) + file_size;
+  int shmid = shmget(key, total_size, IPC_CREAT | IPC_EXCL | 0644);
+  if (shmid >= 0) {
+    // This process won the creation race; copy the file in, then mark
+    // the segment ready so attaching processes may parse from it.
+    void* addr = shmat(shmid, nullptr, 0);
+    if (addr == reinterpret_cast<void*>(-1)) {
+      AERROR << "Failed to attach created map blob segment: " << map_filename;
+      shmctl(shmid, IPC_RMID, nullptr);
+      return false;
+    }
+    auto* header = static_cast<BlobHeader*>(addr);
+    std::ifstream fin(map_filename, std::ios::binary);
+    if (!fin.read(reinterpret_cast<char*>(header + 1),
+                  static_cast<std::streamsize>(file_size))) {
+      AERROR << "Failed to copy map file into shared blob: " << map_filename;
+      shmdt(addr);
+      shmctl(shmid, IPC_RMID, nullptr);
+      return false;
+    }
+    header->size = file_size;
+    header->ready.store(1, std::memory_order_release);
+    addr_ = addr;
+    size_ = file_size;
+    AINFO << "Created shared map blob of " << file_size << " bytes for "
+          << map_filename;
+    return true;
+  }
+
+  // Another process created the segment; attach read-only and wait for
+  // the creator to finish populating it.
+  shmid = shmget(key, 0, 0644);
+  if (shmid < 0) {
+    AERROR << "Failed to open existing map blob segment: " << map_filename;
+    return false;
+  }
+  void* addr = shmat(shmid, nullptr, SHM_RDONLY);
+  if (addr == reinterpret_cast<void*>(-1)) {
+    AERROR << "Failed to attach existing map blob segment: " << map_filename;
+    return false;
+  }
+  const auto* header = static_cast<const BlobHeader*>(addr);
+  bool ready = false;
+  for (int i = 0; i < kReadyWaitIterations; ++i) {
+    if (header->ready.load(std::memory_order_acquire) != 0) {
+      ready = true;
+      break;
+    }
+    usleep(kReadyWaitIntervalUs);
+  }
+  if (!ready) {
+    AWARN << "Shared map blob never became ready, creator may have died: "
+          << map_filename;
+    shmdt(addr);
+    return false;
+  }
+  if (header->size != file_size) {
+    AWARN << "Shared map blob size " << header->size
+          << " does not match file size " << file_size
+          << ", ignoring stale segment: " << map_filename;
+    shmdt(addr);
+    return false;
+  }
+  addr_ = addr;
+  size_ = file_size;
+  AINFO << "Attached shared map blob of " << file_size << " bytes for "
+        << map_filename;
+  return true;
+}
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @namespace apollo::hdmap
+ * @brief apollo::hdmap
+ */
+namespace apollo {
+namespace hdmap {
+
+/**
+ * @class SharedMapBlob
+ *
+ * @brief Read-only shared memory blob holding the serialized bytes of a
+ * map file. The first process to load a map file creates the segment and
+ * copies the file into it; every later process attaches the same physical
+ * pages and parses from them directly, so the serialized map is held in
+ * memory once per vehicle no matter how many processes load it. The
+ * segment is keyed by the map file's inode and outlives its creator, so
+ * it also serves as a warm cache across process restarts.
+ */
+class SharedMapBlob {
+ public:
+  SharedMapBlob() = default;
+  ~SharedMapBlob();
+
+  /**
+   * @brief attach the shared blob of a map file, creating and filling
+   * the segment if this process is the first to load the file.
+   * @param map_filename path of the serialized map file.
+   * @return true on success. On failure the caller should fall back to
+   * reading the file directly.
+   */
+  bool AttachOrCreate(const std::string& map_filename);
+
+  /**
+   * @brief serialized map bytes, valid until this object is destroyed.
+   */
+  const void* data() const;
+
+  /**
+   * @brief size of the serialized map in bytes.
+   */
+  size_t size() const { return size_; }
+
+ private:
+  struct BlobHeader {
+    std::atomic<uint64_t> ready;
+    uint64_t size;
+  };
+
+  void* addr_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/map/hdmap/shared_map_blob.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace hdmap {
+
+TEST(SharedMapBlobTest, CreateThenAttach) {
+  const std::string file_path = "/tmp/shared_map_blob_test.bin";
+  const std::string content = "shared map blob test payload";
+  {
+    std::ofstream fout(file_path, std::ios::binary);
+    fout << content;
+  }
+
+  SharedMapBlob creator;
+  ASSERT_TRUE(creator.AttachOrCreate(file_path));
+  ASSERT_EQ(content.size(), creator.size());
+  EXPECT_EQ(0, memcmp(creator.data(), content.data(), content.size()));
+
+  SharedMapBlob attacher;
+  ASSERT_TRUE(attacher.AttachOrCreate(file_path));
+  ASSERT_EQ(content.size(), attacher.size());
+  EXPECT_EQ(0, memcmp(attacher.data(), content.data(), content.size()));
+
+  std::remove(file_path.c_str());
+}
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -106,6 +106,161 @@ __global__ void DistanceSquare(double x, double y, CudaLineSegment2d* dev_seg,
   }
 }
 
+constexpr int32_t kSegmentTileSize = 256;
+constexpr std::size_t kInitialPointCapacity = 4096;
+
+CudaBatchNearestSegment::CudaBatchNearestSegment() {
+  ReservePoints(kInitialPointCapacity);
+}
+
+CudaBatchNearestSegment::~CudaBatchNearestSegment() {
+  cudaFreeHost(host_seg_);
+  cudaFree(dev_seg_);
+  cudaFreeHost(host_point_);
+  cudaFree(dev_point_);
+  cudaFreeHost(host_result_);
+  cudaFree(dev_result_);
+}
+
+bool CudaBatchNearestSegment::ReservePoints(std::size_t point_num) {
+  if (point_num <= point_capacity_) {
+    return true;
+  }
+  cudaFreeHost(host_point_);
+  cudaFree(dev_point_);
+  cudaFreeHost(host_result_);
+  cudaFree(dev_result_);
+  cudaError_t cudaStatus;
+  cudaStatus =
+      cudaMallocHost((void**)&host_point_, sizeof(double) * 2 * point_num);
+  CHECK_EQ(cudaStatus, cudaSuccess);
+  cudaStatus = cudaMalloc((void**)&dev_point_, sizeof(double) * 2 * point_num);
+  CHECK_EQ(cudaStatus, cudaSuccess);
+  cudaStatus = cudaMallocHost((void**)&host_result_,
+                              sizeof(CudaSegmentQueryResult) * point_num);
+  CHECK_EQ(cudaStatus, cudaSuccess);
+  cudaStatus = cudaMalloc((void**)&dev_result_,
+                          sizeof(CudaSegmentQueryResult) * point_num);
+  CHECK_EQ(cudaStatus, cudaSuccess);
+  point_capacity_ = point_num;
+  return true;
+}
+
+__host__ bool CudaBatchNearestSegment::UpdateLineSegment(
+    const std::vector<apollo::common::math::LineSegment2d>& segments) {
+  if (segments.size() > seg_capacity_) {
+    cudaFreeHost(host_seg_);
+    cudaFree(dev_seg_);
+    cudaError_t cudaStatus;
+    cudaStatus = cudaMallocHost((void**)&host_seg_,
+                                sizeof(CudaLineSegment2d) * segments.size());
+    CHECK_EQ(cudaStatus, cudaSuccess);
+    cudaStatus = cudaMalloc((void**)&dev_seg_,
+                            sizeof(CudaLineSegment2d) * segments.size());
+    CHECK_EQ(cudaStatus, cudaSuccess);
+    seg_capacity_ = segments.size();
+  }
+  seg_size_ = segments.size();
+  for (std::size_t i = 0; i < seg_size_; ++i) {
+    host_seg_[i].x1 = segments[i].start().x();
+    host_seg_[i].y1 = segments[i].start().y();
+    host_seg_[i].x2 = segments[i].end().x();
+    host_seg_[i].y2 = segments[i].end().y();
+  }
+  cudaError_t cudaStatus =
+      cudaMemcpy(dev_seg_, host_seg_, seg_size_ * sizeof(CudaLineSegment2d),
+                 cudaMemcpyHostToDevice);
+  if (cudaStatus != cudaSuccess) {
+    AERROR << "Failed to copy segments to cuda device";
+    return false;
+  }
+  return true;
+}
+
+__global__ void BatchNearestSegment(const double* dev_point,
+                                    const CudaLineSegment2d* dev_seg,
+                                    int32_t seg_size, int32_t point_size,
+                                    CudaSegmentQueryResult* dev_result) {
+  __shared__ CudaLineSegment2d tile[kSegmentTileSize];
+  int32_t index = blockDim.x * blockIdx.x + threadIdx.x;
+  double x = 0.0;
+  double y = 0.0;
+  if (index < point_size) {
+    x = dev_point[2 * index];
+    y = dev_point[2 * index + 1];
+  }
+  int32_t min_index = -1;
+  double min_dist = 1e300;
+  for (int32_t tile_start = 0; tile_start < seg_size;
+       tile_start += kSegmentTileSize) {
+    int32_t tile_len = min(kSegmentTileSize, seg_size - tile_start);
+    for (int32_t i = threadIdx.x; i < tile_len; i += blockDim.x) {
+      tile[i] = dev_seg[tile_start + i];
+    }
+    __syncthreads();
+    if (index < point_size) {
+      for (int32_t i = 0; i < tile_len; ++i) {
+        const auto& seg = tile[i];
+        double x1x = x - seg.x1;
+        double y1y = y - seg.y1;
+        double x1x2 = seg.x2 - seg.x1;
+        double y1y2 = seg.y2 - seg.y1;
+        double length_sqr = x1x2 * x1x2 + y1y2 * y1y2;
+        double dot = x1x * x1x2 + y1y * y1y2;
+        double dist;
+        if (dot < 0) {
+          dist = x1x * x1x + y1y * y1y;
+        } else if (dot > length_sqr) {
+          double x2x = x - seg.x2;
+          double y2y = y - seg.y2;
+          dist = x2x * x2x + y2y * y2y;
+        } else {
+          double prod = x1x * y1y2 - y1y * x1x2;
+          dist = prod * prod / length_sqr;
+        }
+        if (dist < min_dist) {
+          min_dist = dist;
+          min_index = tile_start + i;
+        }
+      }
+    }
+    __syncthreads();
+  }
+  if (index < point_size) {
+    dev_result[index].nearest_index = min_index;
+    dev_result[index].distance_square = min_dist;
+  }
+}
+
+const CudaSegmentQueryResult* CudaBatchNearestSegment::FindNearestSegments(
+    const std::vector<apollo::common::math::Vec2d>& points) {
+  if (seg_size_ == 0 || points.empty()) {
+    return nullptr;
+  }
+  ReservePoints(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    host_point_[2 * i] = points[i].x();
+    host_point_[2 * i + 1] = points[i].y();
+  }
+  cudaError_t cudaStatus =
+      cudaMemcpy(dev_point_, host_point_, sizeof(double) * 2 * points.size(),
+                 cudaMemcpyHostToDevice);
+  if (cudaStatus != cudaSuccess) {
+    AERROR << "Failed to copy query points to cuda device";
+    return nullptr;
+  }
+  BatchNearestSegment<<<(points.size() + 511) / 512, 512>>>(
+      dev_point_, dev_seg_, seg_size_, points.size(), dev_result_);
+  cudaStatus = cudaMemcpy(host_result_, dev_result_,
+                          sizeof(CudaSegmentQueryResult) * points.size(),
+                          cudaMemcpyDeviceToHost);
+  if (cudaStatus != cudaSuccess) {
+    AERROR << "Failed to copy query results from cuda device";
+    return nullptr;
+  }
+  return host_result_;
+}
+
 int CudaNearestSegment::FindNearestSegment(double x, double y) {
   DistanceSquare<<<(kDeviceVecSize + 511) / 512, 512>>>(x, y, dev_seg_,
                                                         dev_dist_, size_);
@@ -49,5 +49,48 @@ class CudaNearestSegment {
   cublasHandle_t handle_;
 };
 
+struct CudaSegmentQueryResult {
+  int32_t nearest_index;
+  double distance_square;
+};
+
+/**
+ * Batched nearest-segment queries against a set of lane boundary segments.
+ * Upload the active route's boundaries once per planning cycle with
+ * UpdateLineSegment(), then answer all obstacle/sample point queries in a
+ * single kernel launch. Results land in a pinned host buffer so consumers
+ * can read them without an extra copy.
+ */
+class CudaBatchNearestSegment {
+ public:
+  CudaBatchNearestSegment();
+
+  bool UpdateLineSegment(
+      const std::vector<apollo::common::math::LineSegment2d>& segments);
+
+  /**
+   * Answer all queries in one launch. The returned pointer refers to a
+   * pinned host buffer owned by this class and stays valid until the next
+   * call; nullptr is returned on failure.
+   */
+  const CudaSegmentQueryResult* FindNearestSegments(
+      const std::vector<apollo::common::math::Vec2d>& points);
+
+  ~CudaBatchNearestSegment();
+
+ private:
+  bool ReservePoints(std::size_t point_num);
+
+  std::size_t seg_size_ = 0;
+  std::size_t seg_capacity_ = 0;
+  std::size_t point_capacity_ = 0;
+  CudaLineSegment2d* host_seg_ = nullptr;
+  CudaLineSegment2d* dev_seg_ = nullptr;
+  double* host_point_ = nullptr;
+  double* dev_point_ = nullptr;
+  CudaSegmentQueryResult* host_result_ = nullptr;
+  CudaSegmentQueryResult* dev_result_ = nullptr;
+};
+
 }  // namespace pnc_map
 }  // namespace apollo
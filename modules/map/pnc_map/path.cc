@@ -389,6 +389,8 @@ void Path::InitPoints() {
   CHECK_EQ(accumulated_s_.size(), num_points_);
   CHECK_EQ(unit_directions_.size(), num_points_);
   CHECK_EQ(segments_.size(), num_segments_);
+
+  projection_grid_.Build(segments_);
 }
 
 void Path::InitLaneSegments() {
@@ -488,20 +490,50 @@ void Path::InitPointIndex() {
   CHECK_EQ(last_point_index_.size(), num_sample_points_);
 }
 
-void Path::GetAllOverlaps(GetOverlapFromLaneFunc GetOverlaps_from_lane,
-                          std::vector<PathOverlap>* const overlaps) const {
-  if (overlaps == nullptr) {
-    return;
+void OverlapDistanceTable::Init(const std::vector<PathOverlap>& overlaps) {
+  prefix_max_end_s_.clear();
+  prefix_max_end_s_.reserve(overlaps.size());
+  double max_end_s = std::numeric_limits<double>::lowest();
+  for (const auto& overlap : overlaps) {
+    max_end_s = std::max(max_end_s, overlap.end_s);
+    prefix_max_end_s_.push_back(max_end_s);
+  }
+}
+
+int OverlapDistanceTable::FirstIndexFrom(const double s) const {
+  auto it = std::lower_bound(prefix_max_end_s_.begin(),
+                             prefix_max_end_s_.end(), s);
+  if (it == prefix_max_end_s_.end()) {
+    return -1;
   }
-  overlaps->clear();
-  std::unordered_map<std::string, std::vector<std::pair<double, double>>>
-      overlaps_by_id;
+  return static_cast<int>(std::distance(prefix_max_end_s_.begin(), it));
+}
+
+void Path::GetAllTypedOverlaps(
+    const std::vector<GetOverlapFromLaneFunc>& overlaps_from_lane,
+    const std::vector<std::vector<PathOverlap>*>& overlaps) const {
+  CHECK_EQ(overlaps_from_lane.size(), overlaps.size());
+  const size_t num_types = overlaps.size();
+  std::vector<
+      std::unordered_map<std::string, std::vector<std::pair<double, double>>>>
+      overlaps_by_id(num_types);
   double s = 0.0;
   for (const auto& lane_segment : lane_segments_) {
     if (lane_segment.lane == nullptr) {
       continue;
     }
-    for (const auto& overlap : GetOverlaps_from_lane(*(lane_segment.lane))) {
+    // which typed lists each overlap of this lane belongs to, keyed by
+    // pointer, so the projection below runs once per overlap instead of
+    // once per type
+    std::unordered_map<const OverlapInfo*, uint32_t> type_masks;
+    for (size_t type = 0; type < num_types; ++type) {
+      for (const auto& overlap :
+           overlaps_from_lane[type](*(lane_segment.lane))) {
+        type_masks[overlap.get()] |= (1u << type);
+      }
+    }
+    for (const auto& item : type_masks) {
+      const OverlapInfo* overlap = item.first;
       const auto& overlap_info =
           overlap->GetObjectOverlapInfo(lane_segment.lane->id());
       if (overlap_info == nullptr) {
@@ -517,35 +549,47 @@ void Path::GetAllOverlaps(GetOverlapFromLaneFunc GetOverlaps_from_lane,
         const double adjusted_end_s =
             std::min(lane_overlap_info.end_s(), lane_segment.end_s) + ref_s;
         for (const auto& object : overlap->overlap().object()) {
-          if (object.id().id() != lane_segment.lane->id().id()) {
-            overlaps_by_id[object.id().id()].emplace_back(adjusted_start_s,
-                                                          adjusted_end_s);
+          if (object.id().id() == lane_segment.lane->id().id()) {
+            continue;
+          }
+          for (size_t type = 0; type < num_types; ++type) {
+            if (item.second & (1u << type)) {
+              overlaps_by_id[type][object.id().id()].emplace_back(
+                  adjusted_start_s, adjusted_end_s);
+            }
           }
         }
       }
     }
     s += lane_segment.end_s - lane_segment.start_s;
   }
-  for (auto& overlaps_one_object : overlaps_by_id) {
-    const std::string& object_id = overlaps_one_object.first;
-    auto& segments = overlaps_one_object.second;
-    std::sort(segments.begin(), segments.end());
-
-    const double kMinOverlapDistanceGap = 1.5;  // in meters.
-    for (const auto& segment : segments) {
-      if (!overlaps->empty() && overlaps->back().object_id == object_id &&
-          segment.first - overlaps->back().end_s <= kMinOverlapDistanceGap) {
-        overlaps->back().end_s =
-            std::max(overlaps->back().end_s, segment.second);
-      } else {
-        overlaps->emplace_back(object_id, segment.first, segment.second);
+  for (size_t type = 0; type < num_types; ++type) {
+    auto* typed_overlaps = overlaps[type];
+    typed_overlaps->clear();
+    for (auto& overlaps_one_object : overlaps_by_id[type]) {
+      const std::string& object_id = overlaps_one_object.first;
+      auto& segments = overlaps_one_object.second;
+      std::sort(segments.begin(), segments.end());
+
+      const double kMinOverlapDistanceGap = 1.5;  // in meters.
+      for (const auto& segment : segments) {
+        if (!typed_overlaps->empty() &&
+            typed_overlaps->back().object_id == object_id &&
+            segment.first - typed_overlaps->back().end_s <=
+                kMinOverlapDistanceGap) {
+          typed_overlaps->back().end_s =
+              std::max(typed_overlaps->back().end_s, segment.second);
+        } else {
+          typed_overlaps->emplace_back(object_id, segment.first,
+                                       segment.second);
+        }
       }
     }
+    std::sort(typed_overlaps->begin(), typed_overlaps->end(),
+              [](const PathOverlap& overlap1, const PathOverlap& overlap2) {
+                return overlap1.start_s < overlap2.start_s;
+              });
   }
-  std::sort(overlaps->begin(), overlaps->end(),
-            [](const PathOverlap& overlap1, const PathOverlap& overlap2) {
-              return overlap1.start_s < overlap2.start_s;
-            });
 }
 
 const PathOverlap* Path::NextLaneOverlap(double s) const {
@@ -560,18 +604,29 @@ const PathOverlap* Path::NextLaneOverlap(double s) const {
 }
 
 void Path::InitOverlaps() {
-  GetAllOverlaps(std::bind(&LaneInfo::cross_lanes, _1), &lane_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::signals, _1), &signal_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::yield_signs, _1), &yield_sign_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::stop_signs, _1), &stop_sign_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::crosswalks, _1), &crosswalk_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::junctions, _1), &junction_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::pnc_junctions, _1),
-                 &pnc_junction_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::clear_areas, _1), &clear_area_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::speed_bumps, _1), &speed_bump_overlaps_);
-  GetAllOverlaps(std::bind(&LaneInfo::parking_spaces, _1),
-                 &parking_space_overlaps_);
+  // every typed overlap list is filled from one pass over the lane
+  // segments instead of one pass per type
+  GetAllTypedOverlaps(
+      {std::bind(&LaneInfo::cross_lanes, _1),
+       std::bind(&LaneInfo::signals, _1),
+       std::bind(&LaneInfo::yield_signs, _1),
+       std::bind(&LaneInfo::stop_signs, _1),
+       std::bind(&LaneInfo::crosswalks, _1),
+       std::bind(&LaneInfo::junctions, _1),
+       std::bind(&LaneInfo::pnc_junctions, _1),
+       std::bind(&LaneInfo::clear_areas, _1),
+       std::bind(&LaneInfo::speed_bumps, _1),
+       std::bind(&LaneInfo::parking_spaces, _1)},
+      {&lane_overlaps_, &signal_overlaps_, &yield_sign_overlaps_,
+       &stop_sign_overlaps_, &crosswalk_overlaps_, &junction_overlaps_,
+       &pnc_junction_overlaps_, &clear_area_overlaps_, &speed_bump_overlaps_,
+       &parking_space_overlaps_});
+
+  signal_overlap_table_.Init(signal_overlaps_);
+  stop_sign_overlap_table_.Init(stop_sign_overlaps_);
+  crosswalk_overlap_table_.Init(crosswalk_overlaps_);
+  pnc_junction_overlap_table_.Init(pnc_junction_overlaps_);
+  clear_area_overlap_table_.Init(clear_area_overlaps_);
 }
 
 MapPathPoint Path::GetSmoothPoint(const InterpolatedIndex& index) const {
@@ -830,6 +885,181 @@ bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
   return true;
 }
 
+void PathProjectionGrid::Build(const std::vector<LineSegment2d>& segments) {
+  cells_.clear();
+  num_cols_ = 0;
+  num_rows_ = 0;
+  if (segments.empty()) {
+    return;
+  }
+  double min_x = std::numeric_limits<double>::infinity();
+  double min_y = std::numeric_limits<double>::infinity();
+  double max_x = -std::numeric_limits<double>::infinity();
+  double max_y = -std::numeric_limits<double>::infinity();
+  double total_length = 0.0;
+  for (const auto& segment : segments) {
+    min_x = std::min({min_x, segment.start().x(), segment.end().x()});
+    min_y = std::min({min_y, segment.start().y(), segment.end().y()});
+    max_x = std::max({max_x, segment.start().x(), segment.end().x()});
+    max_y = std::max({max_y, segment.start().y(), segment.end().y()});
+    total_length += segment.length();
+  }
+  constexpr double kMinCellSize = 2.0;
+  cell_size_ =
+      std::max(2.0 * total_length / static_cast<double>(segments.size()),
+               kMinCellSize);
+  min_x_ = min_x;
+  min_y_ = min_y;
+  // a path is nearly one-dimensional, so the grid stays small; double the
+  // cell size if a degenerate layout would blow the cell count up anyway
+  const size_t kMaxCells = 4 * segments.size() + 1024;
+  while (true) {
+    num_cols_ = static_cast<int>((max_x - min_x_) / cell_size_) + 1;
+    num_rows_ = static_cast<int>((max_y - min_y_) / cell_size_) + 1;
+    if (static_cast<size_t>(num_cols_) * num_rows_ <= kMaxCells) {
+      break;
+    }
+    cell_size_ *= 2.0;
+  }
+  cells_.assign(static_cast<size_t>(num_cols_) * num_rows_, {});
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const auto& segment = segments[i];
+    const int col_begin = static_cast<int>(
+        (std::min(segment.start().x(), segment.end().x()) - min_x_) /
+        cell_size_);
+    const int col_end = static_cast<int>(
+        (std::max(segment.start().x(), segment.end().x()) - min_x_) /
+        cell_size_);
+    const int row_begin = static_cast<int>(
+        (std::min(segment.start().y(), segment.end().y()) - min_y_) /
+        cell_size_);
+    const int row_end = static_cast<int>(
+        (std::max(segment.start().y(), segment.end().y()) - min_y_) /
+        cell_size_);
+    for (int row = row_begin; row <= row_end; ++row) {
+      for (int col = col_begin; col <= col_end; ++col) {
+        cells_[CellIndex(col, row)].push_back(static_cast<int>(i));
+      }
+    }
+  }
+}
+
+void PathProjectionGrid::ScanCell(const Vec2d& point,
+                                  const std::vector<LineSegment2d>& segments,
+                                  int col, int row, int* min_index,
+                                  double* min_distance_sqr) const {
+  if (col < 0 || col >= num_cols_ || row < 0 || row >= num_rows_) {
+    return;
+  }
+  for (const int index : cells_[CellIndex(col, row)]) {
+    const double distance_sqr = segments[index].DistanceSquareTo(point);
+    if (distance_sqr < *min_distance_sqr) {
+      *min_distance_sqr = distance_sqr;
+      *min_index = index;
+    }
+  }
+}
+
+bool PathProjectionGrid::GetNearestSegment(
+    const Vec2d& point, const std::vector<LineSegment2d>& segments,
+    int* min_index, double* min_distance_sqr) const {
+  if (!Ready() || segments.empty()) {
+    return false;
+  }
+  // points outside the grid bounds fall back to the caller's linear scan,
+  // since the ring lower bound below only holds for interior points
+  if (point.x() < min_x_ || point.x() >= min_x_ + num_cols_ * cell_size_ ||
+      point.y() < min_y_ || point.y() >= min_y_ + num_rows_ * cell_size_) {
+    return false;
+  }
+  const int col = static_cast<int>((point.x() - min_x_) / cell_size_);
+  const int row = static_cast<int>((point.y() - min_y_) / cell_size_);
+  *min_index = -1;
+  *min_distance_sqr = std::numeric_limits<double>::infinity();
+  const int max_radius = std::max(num_cols_, num_rows_);
+  for (int radius = 0; radius <= max_radius; ++radius) {
+    if (*min_index >= 0) {
+      // every segment in ring r is at least (r - 1) cells away
+      const double lower_bound = (radius - 1) * cell_size_;
+      if (lower_bound > 0.0 && lower_bound * lower_bound > *min_distance_sqr) {
+        break;
+      }
+    }
+    if (radius == 0) {
+      ScanCell(point, segments, col, row, min_index, min_distance_sqr);
+      continue;
+    }
+    for (int c = col - radius; c <= col + radius; ++c) {
+      ScanCell(point, segments, c, row - radius, min_index, min_distance_sqr);
+      ScanCell(point, segments, c, row + radius, min_index, min_distance_sqr);
+    }
+    for (int r = row - radius + 1; r <= row + radius - 1; ++r) {
+      ScanCell(point, segments, col - radius, r, min_index, min_distance_sqr);
+      ScanCell(point, segments, col + radius, r, min_index, min_distance_sqr);
+    }
+  }
+  return *min_index >= 0;
+}
+
+void Path::ComputeProjectionFromSegment(int min_index, const Vec2d& point,
+                                        double min_distance,
+                                        double* accumulate_s,
+                                        double* lateral) const {
+  const auto& nearest_seg = segments_[min_index];
+  const auto prod = nearest_seg.ProductOntoUnit(point);
+  const auto proj = nearest_seg.ProjectOntoUnit(point);
+  if (min_index == 0) {
+    *accumulate_s = std::min(proj, nearest_seg.length());
+    if (proj < 0) {
+      *lateral = prod;
+    } else {
+      *lateral = (prod > 0.0 ? 1 : -1) * min_distance;
+    }
+  } else if (min_index == num_segments_ - 1) {
+    *accumulate_s = accumulated_s_[min_index] + std::max(0.0, proj);
+    if (proj > 0) {
+      *lateral = prod;
+    } else {
+      *lateral = (prod > 0.0 ? 1 : -1) * min_distance;
+    }
+  } else {
+    *accumulate_s = accumulated_s_[min_index] +
+                    std::max(0.0, std::min(proj, nearest_seg.length()));
+    *lateral = (prod > 0.0 ? 1 : -1) * min_distance;
+  }
+}
+
+bool Path::GetProjectionsBatch(const std::vector<Vec2d>& points,
+                               std::vector<double>* accumulate_s,
+                               std::vector<double>* laterals) const {
+  if (accumulate_s == nullptr || laterals == nullptr) {
+    return false;
+  }
+  accumulate_s->resize(points.size());
+  laterals->resize(points.size());
+  if (segments_.empty()) {
+    return false;
+  }
+  bool all_projected = true;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto& point = points[i];
+    int min_index = -1;
+    double min_distance_sqr = 0.0;
+    if (!use_path_approximation_ &&
+        projection_grid_.GetNearestSegment(point, segments_, &min_index,
+                                           &min_distance_sqr)) {
+      ComputeProjectionFromSegment(min_index, point,
+                                   std::sqrt(min_distance_sqr),
+                                   &(*accumulate_s)[i], &(*laterals)[i]);
+      continue;
+    }
+    if (!GetProjection(point, &(*accumulate_s)[i], &(*laterals)[i])) {
+      all_projected = false;
+    }
+  }
+  return all_projected;
+}
+
 bool Path::GetHeadingAlongPath(const Vec2d& point, double* heading) const {
   if (heading == nullptr) {
     return false;
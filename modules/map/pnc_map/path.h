@@ -100,6 +100,29 @@ struct PathOverlap {
   std::string DebugString() const;
 };
 
+/**
+ * Distance table over a start_s-sorted overlap vector, supporting an
+ * O(log n) query for the first overlap that has not been fully passed at
+ * a given accumulate s. Built once in Path::InitOverlaps, i.e. whenever
+ * the reference line is (re)built, so per-cycle consumers do not rescan
+ * the overlap vectors.
+ */
+class OverlapDistanceTable {
+ public:
+  // overlaps must be sorted by start_s, as produced by
+  // Path::GetAllTypedOverlaps.
+  void Init(const std::vector<PathOverlap>& overlaps);
+
+  // Index of the overlap with the smallest start_s among those with
+  // end_s >= s, or -1 if every overlap ends before s. The running maximum
+  // of end_s over the start_s-sorted overlaps is non-decreasing, which
+  // makes the candidate index binary-searchable.
+  int FirstIndexFrom(const double s) const;
+
+ private:
+  std::vector<double> prefix_max_end_s_;
+};
+
 class MapPathPoint : public common::math::Vec2d {
  public:
   MapPathPoint() = default;
@@ -205,6 +228,41 @@ class PathApproximation {
   std::vector<int> sampled_max_original_projections_to_left_;
 };
 
+/**
+ * @class PathProjectionGrid
+ * @brief Uniform spatial hash over path segments. Batched projection
+ * queries look up the cells around a point instead of scanning every
+ * segment, so projecting thousands of obstacle trajectory points per
+ * cycle costs near-constant work per point. It stores segment indices
+ * only, so it stays valid when the owning Path is copied.
+ */
+class PathProjectionGrid {
+ public:
+  void Build(const std::vector<common::math::LineSegment2d>& segments);
+  bool Ready() const { return num_cols_ > 0; }
+
+  // Find the segment nearest to point. Returns false when the grid is not
+  // built or the point lies outside the grid bounds (caller falls back to
+  // the linear scan).
+  bool GetNearestSegment(const common::math::Vec2d& point,
+                         const std::vector<common::math::LineSegment2d>& segments,
+                         int* min_index, double* min_distance_sqr) const;
+
+ private:
+  int CellIndex(int col, int row) const { return row * num_cols_ + col; }
+  void ScanCell(const common::math::Vec2d& point,
+                const std::vector<common::math::LineSegment2d>& segments,
+                int col, int row, int* min_index,
+                double* min_distance_sqr) const;
+
+  double cell_size_ = 0.0;
+  double min_x_ = 0.0;
+  double min_y_ = 0.0;
+  int num_cols_ = 0;
+  int num_rows_ = 0;
+  std::vector<std::vector<int>> cells_;
+};
+
 class InterpolatedIndex {
  public:
   InterpolatedIndex(int id, double offset) : id(id), offset(offset) {}
@@ -261,6 +319,12 @@ class Path {
   bool GetProjection(const common::math::Vec2d& point, double* accumulate_s,
                      double* lateral, double* distance) const;
 
+  // Project a batch of points in one pass over the spatial grid. Outputs are
+  // resized to points.size(); returns false if any point failed to project.
+  bool GetProjectionsBatch(const std::vector<common::math::Vec2d>& points,
+                           std::vector<double>* accumulate_s,
+                           std::vector<double>* laterals) const;
+
   bool GetHeadingAlongPath(const common::math::Vec2d& point,
                            double* heading) const;
 
@@ -316,6 +380,22 @@ class Path {
     return parking_space_overlaps_;
   }
 
+  const OverlapDistanceTable& signal_overlap_table() const {
+    return signal_overlap_table_;
+  }
+  const OverlapDistanceTable& stop_sign_overlap_table() const {
+    return stop_sign_overlap_table_;
+  }
+  const OverlapDistanceTable& crosswalk_overlap_table() const {
+    return crosswalk_overlap_table_;
+  }
+  const OverlapDistanceTable& pnc_junction_overlap_table() const {
+    return pnc_junction_overlap_table_;
+  }
+  const OverlapDistanceTable& clear_area_overlap_table() const {
+    return clear_area_overlap_table_;
+  }
+
   double GetLaneLeftWidth(const double s) const;
   double GetLaneRightWidth(const double s) const;
   bool GetLaneWidth(const double s, double* lane_left_width,
@@ -341,10 +421,21 @@ class Path {
 
   double GetSample(const std::vector<double>& samples, const double s) const;
 
+  void ComputeProjectionFromSegment(int min_index,
+                                    const common::math::Vec2d& point,
+                                    double min_distance, double* accumulate_s,
+                                    double* lateral) const;
+
   using GetOverlapFromLaneFunc =
       std::function<const std::vector<OverlapInfoConstPtr>&(const LaneInfo&)>;
-  void GetAllOverlaps(GetOverlapFromLaneFunc GetOverlaps_from_lane,
-                      std::vector<PathOverlap>* const overlaps) const;
+  /**
+   * Fills one typed overlap list per accessor in a single pass over the
+   * lane segments; each overlap's projection onto the path is computed
+   * once and shared by all types it belongs to.
+   */
+  void GetAllTypedOverlaps(
+      const std::vector<GetOverlapFromLaneFunc>& overlaps_from_lane,
+      const std::vector<std::vector<PathOverlap>*>& overlaps) const;
 
  protected:
   int num_points_ = 0;
@@ -357,6 +448,7 @@ class Path {
   double length_ = 0.0;
   std::vector<double> accumulated_s_;
   std::vector<common::math::LineSegment2d> segments_;
+  PathProjectionGrid projection_grid_;
   bool use_path_approximation_ = false;
   PathApproximation approximation_;
 
@@ -378,6 +470,12 @@ class Path {
   std::vector<PathOverlap> pnc_junction_overlaps_;
   std::vector<PathOverlap> clear_area_overlaps_;
   std::vector<PathOverlap> speed_bump_overlaps_;
+
+  OverlapDistanceTable signal_overlap_table_;
+  OverlapDistanceTable stop_sign_overlap_table_;
+  OverlapDistanceTable crosswalk_overlap_table_;
+  OverlapDistanceTable pnc_junction_overlap_table_;
+  OverlapDistanceTable clear_area_overlap_table_;
 };
 
 }  // namespace hdmap
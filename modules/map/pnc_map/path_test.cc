@@ -140,6 +140,32 @@ TEST(TestSuite, LaneSegment) {
   }
 }
 
+TEST(TestSuite, overlap_distance_table) {
+  std::vector<PathOverlap> overlaps;
+  overlaps.emplace_back("o1", 5.0, 40.0);
+  overlaps.emplace_back("o2", 10.0, 20.0);
+  overlaps.emplace_back("o3", 30.0, 35.0);
+  overlaps.emplace_back("o4", 50.0, 60.0);
+
+  OverlapDistanceTable table;
+  table.Init(overlaps);
+
+  // before all overlaps: minimal start_s candidate.
+  EXPECT_EQ(0, table.FirstIndexFrom(0.0));
+  // inside "o1", which still spans beyond later short overlaps.
+  EXPECT_EQ(0, table.FirstIndexFrom(25.0));
+  EXPECT_EQ(0, table.FirstIndexFrom(40.0));
+  // past "o1"-"o3", first not fully passed is "o4".
+  EXPECT_EQ(3, table.FirstIndexFrom(45.0));
+  EXPECT_EQ(3, table.FirstIndexFrom(60.0));
+  // past everything.
+  EXPECT_EQ(-1, table.FirstIndexFrom(60.1));
+
+  OverlapDistanceTable empty_table;
+  empty_table.Init({});
+  EXPECT_EQ(-1, empty_table.FirstIndexFrom(0.0));
+}
+
 TEST(TestSuite, hdmap_line_path) {
   Lane lane;
   lane.mutable_id()->set_id("id");
@@ -768,6 +794,34 @@ TEST(TestSuite, hdmap_path_get_smooth_point) {
   EXPECT_NEAR(path.GetSFromIndex(index), segment_length * kNumSegments, 1e-6);
 }
 
+TEST(TestSuite, hdmap_batch_projection) {
+  const double kRadius = 50.0;
+  std::vector<MapPathPoint> points;
+  for (double angle = 0.0; angle <= M_PI_2; angle += 0.02) {
+    points.push_back(
+        MakeMapPathPoint(kRadius * cos(angle), kRadius * sin(angle)));
+  }
+  const Path path(points);
+
+  std::vector<Vec2d> query_points;
+  for (int case_id = 0; case_id < 500; ++case_id) {
+    query_points.emplace_back(RandomDouble(-10.0, kRadius + 10.0),
+                              RandomDouble(-10.0, kRadius + 10.0));
+  }
+  std::vector<double> batch_s;
+  std::vector<double> batch_l;
+  EXPECT_TRUE(path.GetProjectionsBatch(query_points, &batch_s, &batch_l));
+  EXPECT_EQ(batch_s.size(), query_points.size());
+  EXPECT_EQ(batch_l.size(), query_points.size());
+  for (size_t i = 0; i < query_points.size(); ++i) {
+    double s = 0.0;
+    double l = 0.0;
+    EXPECT_TRUE(path.GetProjection(query_points[i], &s, &l));
+    EXPECT_NEAR(batch_s[i], s, 1e-8);
+    EXPECT_NEAR(batch_l[i], l, 1e-8);
+  }
+}
+
 TEST(TestSuite, compute_lane_segments_from_points) {
   std::vector<MapPathPoint> points{
       MakeMapPathPoint(2, 0), MakeMapPathPoint(2, 1), MakeMapPathPoint(2, 2)};
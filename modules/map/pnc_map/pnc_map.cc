@@ -21,13 +21,16 @@
 #include "modules/map/pnc_map/pnc_map.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
+#include <utility>
 
 #include "google/protobuf/text_format.h"
 
 #include "modules/map/proto/map_id.pb.h"
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/util/string_util.h"
 #include "modules/common/util/util.h"
 #include "modules/map/hdmap/hdmap_util.h"
@@ -223,6 +226,7 @@ bool PncMap::UpdateRoutingResponse(const routing::RoutingResponse &routing) {
   range_lane_ids_.clear();
   route_indices_.clear();
   all_lane_ids_.clear();
+  passage_segments_cache_.clear();
   for (int road_index = 0; road_index < routing.road_size(); ++road_index) {
     const auto &road_segment = routing.road(road_index);
     for (int passage_index = 0; passage_index < road_segment.passage_size();
@@ -366,6 +370,24 @@ bool PncMap::PassageToSegments(routing::Passage passage,
   return !segments->empty();
 }
 
+const RouteSegments *PncMap::GetPassageSegments(
+    const int road_index, const int passage_index) const {
+  const std::string key =
+      std::to_string(road_index) + "_" + std::to_string(passage_index);
+  auto iter = passage_segments_cache_.find(key);
+  if (iter == passage_segments_cache_.end()) {
+    auto &segments = passage_segments_cache_[key];
+    // A failed conversion is cached as an empty entry so it is not retried
+    // on every planning cycle.
+    if (!PassageToSegments(routing_.road(road_index).passage(passage_index),
+                           &segments)) {
+      segments.clear();
+    }
+    return segments.empty() ? nullptr : &segments;
+  }
+  return iter->second.empty() ? nullptr : &iter->second;
+}
+
 std::vector<int> PncMap::GetNeighborPassages(const routing::RoadSegment &road,
                                              int start_passage) const {
   CHECK_GE(start_passage, 0);
@@ -452,60 +474,85 @@ bool PncMap::GetRouteSegments(const VehicleState &vehicle_state,
   const auto &road = routing_.road(road_index);
   // raw filter to find all neighboring passages
   auto drive_passages = GetNeighborPassages(road, passage_index);
+  // Warm the passage segments cache from this serial context, so the
+  // concurrent tasks below only perform read-only lookups.
   for (const int index : drive_passages) {
-    const auto &passage = road.passage(index);
-    RouteSegments segments;
-    if (!PassageToSegments(passage, &segments)) {
-      ADEBUG << "Failed to convert passage to lane segments.";
-      continue;
-    }
-    PointENU nearest_point =
-        MakePointENU(adc_state_.x(), adc_state_.y(), adc_state_.z());
-    if (index == passage_index) {
-      nearest_point = adc_waypoint_.lane->GetSmoothPoint(adc_waypoint_.s);
-    }
-    common::SLPoint sl;
-    LaneWaypoint segment_waypoint;
-    if (!segments.GetProjection(nearest_point, &sl, &segment_waypoint)) {
-      ADEBUG << "Failed to get projection from point: "
-             << nearest_point.ShortDebugString();
-      continue;
-    }
-    if (index != passage_index) {
-      if (!segments.CanDriveFrom(adc_waypoint_)) {
-        ADEBUG << "You cannot drive from current waypoint to passage: "
-               << index;
-        continue;
-      }
+    GetPassageSegments(road_index, index);
+  }
+  std::vector<RouteSegments> candidate_segments(drive_passages.size());
+  std::vector<std::future<bool>> results;
+  results.reserve(drive_passages.size());
+  for (size_t i = 0; i < drive_passages.size(); ++i) {
+    results.emplace_back(cyber::Async(
+        &PncMap::BuildPassageRouteSegment, this, road_index, drive_passages[i],
+        passage_index, backward_length, forward_length,
+        &candidate_segments[i]));
+  }
+  for (size_t i = 0; i < drive_passages.size(); ++i) {
+    if (results[i].get()) {
+      route_segments->emplace_back(std::move(candidate_segments[i]));
     }
-    route_segments->emplace_back();
-    const auto last_waypoint = segments.LastWaypoint();
-    if (!ExtendSegments(segments, sl.s() - backward_length,
-                        sl.s() + forward_length, &route_segments->back())) {
-      AERROR << "Failed to extend segments with s=" << sl.s()
-             << ", backward: " << backward_length
-             << ", forward: " << forward_length;
+  }
+  return !route_segments->empty();
+}
+
+bool PncMap::BuildPassageRouteSegment(const int road_index,
+                                      const int passage_index,
+                                      const int adc_passage_index,
+                                      const double backward_length,
+                                      const double forward_length,
+                                      RouteSegments *route_segment) const {
+  const auto *segments = GetPassageSegments(road_index, passage_index);
+  if (segments == nullptr) {
+    ADEBUG << "Failed to convert passage to lane segments.";
+    return false;
+  }
+  PointENU nearest_point =
+      MakePointENU(adc_state_.x(), adc_state_.y(), adc_state_.z());
+  if (passage_index == adc_passage_index) {
+    nearest_point = adc_waypoint_.lane->GetSmoothPoint(adc_waypoint_.s);
+  }
+  common::SLPoint sl;
+  LaneWaypoint segment_waypoint;
+  if (!segments->GetProjection(nearest_point, &sl, &segment_waypoint)) {
+    ADEBUG << "Failed to get projection from point: "
+           << nearest_point.ShortDebugString();
+    return false;
+  }
+  if (passage_index != adc_passage_index) {
+    if (!segments->CanDriveFrom(adc_waypoint_)) {
+      ADEBUG << "You cannot drive from current waypoint to passage: "
+             << passage_index;
       return false;
     }
-    if (route_segments->back().IsWaypointOnSegment(last_waypoint)) {
-      route_segments->back().SetRouteEndWaypoint(last_waypoint);
-    }
-    route_segments->back().SetCanExit(passage.can_exit());
-    route_segments->back().SetNextAction(passage.change_lane_type());
-    std::string route_segment_id =
-        std::to_string(road_index) + "_" + std::to_string(index);
-    route_segments->back().SetId(route_segment_id);
-    route_segments->back().SetStopForDestination(stop_for_destination_);
-    if (index == passage_index) {
-      route_segments->back().SetIsOnSegment(true);
-      route_segments->back().SetPreviousAction(routing::FORWARD);
-    } else if (sl.l() > 0) {
-      route_segments->back().SetPreviousAction(routing::RIGHT);
-    } else {
-      route_segments->back().SetPreviousAction(routing::LEFT);
-    }
   }
-  return !route_segments->empty();
+  const auto last_waypoint = segments->LastWaypoint();
+  if (!ExtendSegments(*segments, sl.s() - backward_length,
+                      sl.s() + forward_length, route_segment)) {
+    AERROR << "Failed to extend segments with s=" << sl.s()
+           << ", backward: " << backward_length
+           << ", forward: " << forward_length;
+    return false;
+  }
+  if (route_segment->IsWaypointOnSegment(last_waypoint)) {
+    route_segment->SetRouteEndWaypoint(last_waypoint);
+  }
+  const auto &passage = routing_.road(road_index).passage(passage_index);
+  route_segment->SetCanExit(passage.can_exit());
+  route_segment->SetNextAction(passage.change_lane_type());
+  std::string route_segment_id =
+      std::to_string(road_index) + "_" + std::to_string(passage_index);
+  route_segment->SetId(route_segment_id);
+  route_segment->SetStopForDestination(stop_for_destination_);
+  if (passage_index == adc_passage_index) {
+    route_segment->SetIsOnSegment(true);
+    route_segment->SetPreviousAction(routing::FORWARD);
+  } else if (sl.l() > 0) {
+    route_segment->SetPreviousAction(routing::RIGHT);
+  } else {
+    route_segment->SetPreviousAction(routing::LEFT);
+  }
+  return true;
 }
 
 bool PncMap::GetNearestPointFromRouting(const VehicleState &state,
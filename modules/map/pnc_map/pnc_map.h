@@ -22,6 +22,7 @@
 
 #include <list>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -98,6 +99,28 @@ class PncMap {
   bool PassageToSegments(routing::Passage passage,
                          RouteSegments *segments) const;
 
+  /**
+   * @brief Memoized PassageToSegments(). The lane set of a passage is fixed
+   * for the lifetime of a routing response, so the lane table lookups are
+   * done at most once per passage per routing update.
+   * @return pointer to the cached segments, or nullptr if the passage cannot
+   * be converted. The pointer stays valid until the next routing update.
+   */
+  const RouteSegments *GetPassageSegments(const int road_index,
+                                          const int passage_index) const;
+
+  /**
+   * @brief Build the route segment the vehicle can drive on for one candidate
+   * passage. Only reads the vehicle state and the cached passage segments, so
+   * candidate passages are processed concurrently in GetRouteSegments().
+   * @return false if the passage should be skipped.
+   */
+  bool BuildPassageRouteSegment(const int road_index, const int passage_index,
+                                const int adc_passage_index,
+                                const double backward_length,
+                                const double forward_length,
+                                RouteSegments *route_segment) const;
+
   bool ProjectToSegments(const common::PointENU &point_enu,
                          const RouteSegments &segments,
                          LaneWaypoint *waypoint) const;
@@ -164,6 +187,14 @@ class PncMap {
     std::array<int, 3> index;
   };
   std::vector<RouteIndex> route_indices_;
+  /**
+   * Cached PassageToSegments() results keyed by "road-index_passage-index".
+   * Cleared on every routing update. Entries are inserted from the serial
+   * part of GetRouteSegments() only, so concurrent passage tasks see a
+   * read-only map.
+   */
+  mutable std::unordered_map<std::string, RouteSegments>
+      passage_segments_cache_;
   int range_start_ = 0;
   int range_end_ = 0;
   // routing ids in range
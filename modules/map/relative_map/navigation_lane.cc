@@ -567,9 +567,11 @@ ProjIndexPair NavigationLane::UpdateProjectionIndex(const common::Path &path,
   double min_d = std::numeric_limits<double>::max();
   const int path_size = path.path_point_size();
   int current_project_index = 0;
+  bool has_last_projection = false;
   auto item_iter = last_project_index_map_.find(line_index);
   if (item_iter != last_project_index_map_.end()) {
     current_project_index = std::max(0, item_iter->second.first);
+    has_last_projection = true;
   }
 
   // A lambda expression for checking the distance between the vehicle's inital
@@ -618,8 +620,12 @@ ProjIndexPair NavigationLane::UpdateProjectionIndex(const common::Path &path,
       min_d = d;
       index = i;
     }
+    // Once a projection from an earlier cycle exists, the vehicle can only
+    // have moved a short distance since then, so the scan is limited to a
+    // window around the last projection instead of the whole navigation
+    // line. The full scan is kept for the first cycle of a line.
     const double kMaxDistance = 50.0;
-    if (current_project_index != 0 && d > kMaxDistance) {
+    if (has_last_projection && d > kMaxDistance) {
       break;
     }
   }
@@ -31,7 +31,7 @@ bool RelativeMapComponent::Init() {
 }
 
 bool RelativeMapComponent::Proc() {
-  auto map_msg = std::make_shared<MapMsg>();
+  auto map_msg = GetMapMsgFromPool();
   if (!relative_map_.Process(map_msg.get())) {
     return false;
   }
@@ -40,6 +40,23 @@ bool RelativeMapComponent::Proc() {
   return true;
 }
 
+std::shared_ptr<MapMsg> RelativeMapComponent::GetMapMsgFromPool() {
+  for (auto& map_msg : map_msg_pool_) {
+    // A use count of 1 means every downstream reader has released the
+    // message, so it cannot be picked up by anyone else anymore and is safe
+    // to recycle.
+    if (map_msg.use_count() == 1) {
+      map_msg->Clear();
+      return map_msg;
+    }
+  }
+  auto map_msg = std::make_shared<MapMsg>();
+  if (map_msg_pool_.size() < kMapMsgPoolSize) {
+    map_msg_pool_.push_back(map_msg);
+  }
+  return map_msg;
+}
+
 bool RelativeMapComponent::InitReaders() {
   perception_reader_ = node_->CreateReader<PerceptionObstacles>(
       FLAGS_perception_obstacle_topic,
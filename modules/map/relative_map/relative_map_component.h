@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "cyber/component/timer_component.h"
 #include "cyber/cyber.h"
@@ -33,6 +34,15 @@ class RelativeMapComponent final : public ::apollo::cyber::TimerComponent {
 
  private:
   bool InitReaders();
+  std::shared_ptr<MapMsg> GetMapMsgFromPool();
+
+  static constexpr size_t kMapMsgPoolSize = 4;
+
+  // A small pool of published messages. A pooled message is reused once all
+  // downstream readers have released it; Clear() keeps the repeated-field
+  // capacity, so steady-state map generation reuses the lane geometry
+  // storage of earlier cycles instead of reallocating it at 10Hz.
+  std::vector<std::shared_ptr<MapMsg>> map_msg_pool_;
 
   std::shared_ptr<::apollo::cyber::Writer<MapMsg>> relative_map_writer_ =
       nullptr;
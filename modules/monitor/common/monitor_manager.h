@@ -53,7 +53,14 @@ class MonitorManager {
   template <class T>
   std::shared_ptr<cyber::Reader<T>> CreateReader(const std::string& channel) {
     if (readers_.find(channel) == readers_.end()) {
-      readers_.emplace(channel, node_->CreateReader<T>(channel));
+      // Monitor only samples the latest message of each channel at a few
+      // Hz, so conflate high-rate channels such as chassis and coalesce
+      // the reader wakeups instead of paying a callback per message.
+      cyber::ReaderConfig config;
+      config.channel_name = channel;
+      config.conflate_latest = true;
+      config.conflation_rate_hz = 10;
+      readers_.emplace(channel, node_->CreateReader<T>(config, nullptr));
     }
     return std::dynamic_pointer_cast<cyber::Reader<T>>(readers_[channel]);
   }
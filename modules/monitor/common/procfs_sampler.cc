@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/monitor/common/procfs_sampler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "gflags/gflags.h"
+#include "modules/common/time/time.h"
+
+DEFINE_double(procfs_sampler_interval, 1.5,
+              "Interval in seconds between background /proc scans.");
+
+namespace apollo {
+namespace monitor {
+namespace {
+
+// Reads a small procfs file into the reused buffer, avoiding a temporary
+// stringstream per file.
+bool ReadProcFile(const std::string& path, std::string* buffer) {
+  std::ifstream fin(path);
+  if (!fin) {
+    return false;
+  }
+  buffer->clear();
+  char chunk[4096];
+  while (fin.read(chunk, sizeof(chunk)) || fin.gcount() > 0) {
+    buffer->append(chunk, static_cast<size_t>(fin.gcount()));
+  }
+  return true;
+}
+
+}  // namespace
+
+ProcfsSampler::ProcfsSampler() {}
+
+ProcfsSampler::~ProcfsSampler() { Stop(); }
+
+void ProcfsSampler::Start() {
+  if (running_.exchange(true)) {
+    return;
+  }
+  // Publish the first snapshot before the thread spins up, so consumers
+  // never see an empty process list.
+  Sample();
+  thread_ = std::thread([this]() {
+    while (running_.load()) {
+      std::this_thread::sleep_for(
+          std::chrono::duration<double>(FLAGS_procfs_sampler_interval));
+      if (!running_.load()) {
+        break;
+      }
+      Sample();
+    }
+  });
+}
+
+void ProcfsSampler::Stop() {
+  running_.store(false);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+std::shared_ptr<const ProcfsSampler::Snapshot> ProcfsSampler::Latest() const {
+  return std::atomic_load(&snapshot_);
+}
+
+void ProcfsSampler::Sample() {
+  auto snapshot = std::make_shared<Snapshot>();
+  snapshot->timestamp = apollo::common::time::Clock::NowInSeconds();
+  const auto last = Latest();
+  snapshot->processes.reserve(last == nullptr ? 256
+                                              : last->processes.size() + 16);
+  for (const auto& cmd_file : cyber::common::Glob("/proc/*/cmdline")) {
+    if (!ReadProcFile(cmd_file, &read_buffer_) || read_buffer_.empty()) {
+      continue;
+    }
+    // In /proc/<PID>/cmdline, the parts are seperated with \0, which will be
+    // converted back to whitespaces here.
+    std::replace(read_buffer_.begin(), read_buffer_.end(), '\0', ' ');
+    snapshot->processes.emplace_back(cmd_file, read_buffer_);
+  }
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const Snapshot>(std::move(snapshot)));
+}
+
+}  // namespace monitor
+}  // namespace apollo
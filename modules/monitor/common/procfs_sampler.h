@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace monitor {
+
+/**
+ * @class ProcfsSampler
+ * @brief Scans /proc in a dedicated background thread so the monitor
+ * component never walks it in its own callback. Each scan reuses one
+ * preallocated read buffer and is published as an immutable snapshot through
+ * an atomic shared_ptr swap, which consumers fetch lock-free with Latest().
+ */
+class ProcfsSampler {
+ public:
+  struct Snapshot {
+    double timestamp = 0.0;
+    // Pairs each /proc/<PID>/cmdline file with its command string.
+    std::vector<std::pair<std::string, std::string>> processes;
+  };
+
+  ~ProcfsSampler();
+
+  // Publishes one snapshot synchronously, then starts the background
+  // thread. Idempotent.
+  void Start();
+  void Stop();
+
+  // The latest published snapshot; never nullptr after Start().
+  std::shared_ptr<const Snapshot> Latest() const;
+
+ private:
+  void Sample();
+
+  std::shared_ptr<const Snapshot> snapshot_;
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+  // Reused by the sampling thread for every cmdline read.
+  std::string read_buffer_;
+
+  DECLARE_SINGLETON(ProcfsSampler)
+};
+
+}  // namespace monitor
+}  // namespace apollo
@@ -16,11 +16,14 @@
 
 #include "modules/monitor/software/process_monitor.h"
 
+#include <algorithm>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "gflags/gflags.h"
 #include "modules/common/util/map_util.h"
 #include "modules/monitor/common/monitor_manager.h"
+#include "modules/monitor/common/procfs_sampler.h"
 #include "modules/monitor/software/summary_monitor.h"
 
 DEFINE_string(process_monitor_name, "ProcessMonitor",
@@ -31,35 +34,62 @@ DEFINE_double(process_monitor_interval, 1.5,
 
 namespace apollo {
 namespace monitor {
+namespace {
 
-ProcessMonitor::ProcessMonitor()
-    : RecurrentRunner(FLAGS_process_monitor_name,
-                      FLAGS_process_monitor_interval) {}
+// Reads /proc/<PID>/cmdline into a whitespace separated command string.
+bool GetCommandString(const std::string& cmd_file, std::string* cmd_string) {
+  if (!cyber::common::GetContent(cmd_file, cmd_string) ||
+      cmd_string->empty()) {
+    return false;
+  }
+  // In /proc/<PID>/cmdline, the parts are seperated with \0, which will be
+  // converted back to whitespaces here.
+  std::replace(cmd_string->begin(), cmd_string->end(), '\0', ' ');
+  return true;
+}
 
-void ProcessMonitor::RunOnce(const double current_time) {
-  // Get running processes.
-  std::vector<std::string> running_processes;
-  for (const auto& cmd_file : cyber::common::Glob("/proc/*/cmdline")) {
-    // Get process command string.
-    std::string cmd_string;
-    if (cyber::common::GetContent(cmd_file, &cmd_string) &&
-        !cmd_string.empty()) {
-      // In /proc/<PID>/cmdline, the parts are seperated with \0, which will be
-      // converted back to whitespaces here.
-      std::replace(cmd_string.begin(), cmd_string.end(), '\0', ' ');
-      running_processes.push_back(cmd_string);
+bool MatchesAllKeywords(const std::string& command,
+                        const apollo::dreamview::ProcessMonitorConfig& config) {
+  for (const std::string& keyword : config.command_keywords()) {
+    if (command.find(keyword) == std::string::npos) {
+      return false;
     }
   }
+  return true;
+}
 
+}  // namespace
+
+ProcessMonitor::ProcessMonitor()
+    : RecurrentRunner(FLAGS_process_monitor_name,
+                      FLAGS_process_monitor_interval) {
+  ProcfsSampler::Instance()->Start();
+}
+
+void ProcessMonitor::RunOnce(const double current_time) {
   auto manager = MonitorManager::Instance();
   const auto& mode = manager->GetHMIMode();
 
+  // The background procfs sampler owns the /proc scans; fetch its latest
+  // snapshot lock-free, and only when some previously matched process is
+  // gone.
+  std::shared_ptr<const ProcfsSampler::Snapshot> snapshot;
+  const auto list_running_processes = [&snapshot]() {
+    if (snapshot == nullptr) {
+      snapshot = ProcfsSampler::Instance()->Latest();
+    }
+  };
+
   // Check HMI modules.
   auto* hmi_modules = manager->GetStatus()->mutable_hmi_modules();
   for (const auto& iter : mode.modules()) {
     const std::string& module_name = iter.first;
     const auto& config = iter.second.process_monitor_config();
-    UpdateStatus(running_processes, config, &hmi_modules->at(module_name));
+    auto* status = &hmi_modules->at(module_name);
+    if (!CheckMatchedProcess(module_name, config, status)) {
+      list_running_processes();
+      UpdateStatus(snapshot->processes, config, module_name, status);
+    }
   }
 
   // Check monitored components.
@@ -70,30 +100,49 @@ void ProcessMonitor::RunOnce(const double current_time) {
         apollo::common::util::ContainsKey(*components, name)) {
       const auto& config = iter.second.process();
       auto* status = components->at(name).mutable_process_status();
-      UpdateStatus(running_processes, config, status);
+      if (!CheckMatchedProcess(name, config, status)) {
+        list_running_processes();
+        UpdateStatus(snapshot->processes, config, name, status);
+      }
     }
   }
 }
 
-void ProcessMonitor::UpdateStatus(
-    const std::vector<std::string>& running_processes,
+bool ProcessMonitor::CheckMatchedProcess(
+    const std::string& key,
     const apollo::dreamview::ProcessMonitorConfig& config,
     ComponentStatus* status) {
+  const auto entry = matched_cmdline_files_.find(key);
+  if (entry == matched_cmdline_files_.end()) {
+    return false;
+  }
+  std::string command;
+  // Re-check the keywords to guard against PID reuse.
+  if (!GetCommandString(entry->second, &command) ||
+      !MatchesAllKeywords(command, config)) {
+    matched_cmdline_files_.erase(entry);
+    return false;
+  }
   status->clear_status();
-  for (const std::string& command : running_processes) {
-    bool all_keywords_matched = true;
-    for (const std::string& keyword : config.command_keywords()) {
-      if (command.find(keyword) == std::string::npos) {
-        all_keywords_matched = false;
-        break;
-      }
-    }
-    if (all_keywords_matched) {
+  SummaryMonitor::EscalateStatus(ComponentStatus::OK, command, status);
+  return true;
+}
+
+void ProcessMonitor::UpdateStatus(
+    const std::vector<std::pair<std::string, std::string>>& running_processes,
+    const apollo::dreamview::ProcessMonitorConfig& config,
+    const std::string& key, ComponentStatus* status) {
+  status->clear_status();
+  for (const auto& process : running_processes) {
+    if (MatchesAllKeywords(process.second, config)) {
       // Process command keywords are all matched. The process is running.
-      SummaryMonitor::EscalateStatus(ComponentStatus::OK, command, status);
+      matched_cmdline_files_[key] = process.first;
+      SummaryMonitor::EscalateStatus(ComponentStatus::OK, process.second,
+                                     status);
       return;
     }
   }
+  matched_cmdline_files_.erase(key);
   SummaryMonitor::EscalateStatus(ComponentStatus::FATAL, "", status);
 }
 
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "modules/dreamview/proto/hmi_mode.pb.h"
@@ -31,10 +33,24 @@ class ProcessMonitor : public RecurrentRunner {
   void RunOnce(const double current_time) override;
 
  private:
-  static void UpdateStatus(
-      const std::vector<std::string>& running_processes,
+  // Scans running_processes, which pairs /proc/<PID>/cmdline files with their
+  // command strings, for a command matching all keywords of the config.
+  void UpdateStatus(
+      const std::vector<std::pair<std::string, std::string>>&
+          running_processes,
+      const apollo::dreamview::ProcessMonitorConfig& config,
+      const std::string& key, ComponentStatus* status);
+
+  // Checks whether the process matched for the key in a previous round is
+  // still running, so the full /proc scan can be skipped in steady state.
+  bool CheckMatchedProcess(
+      const std::string& key,
       const apollo::dreamview::ProcessMonitorConfig& config,
       ComponentStatus* status);
+
+  // Maps each monitored module or component to the /proc/<PID>/cmdline file
+  // of the process it matched last time.
+  std::unordered_map<std::string, std::string> matched_cmdline_files_;
 };
 
 }  // namespace monitor
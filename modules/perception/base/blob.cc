@@ -63,6 +63,8 @@ license and copyright terms herein.
 
 #include "modules/perception/base/blob.h"
 
+#include "modules/perception/base/syncedmem_pool.h"
+
 namespace apollo {
 namespace perception {
 namespace base {
@@ -98,9 +100,11 @@ void Blob<Dtype>::Reshape(const std::vector<int>& shape) {
     shape_data[i] = shape[i];
   }
   if (count_ > capacity_) {
-    capacity_ = count_;
-    data_.reset(
-        new SyncedMemory(capacity_ * sizeof(Dtype), use_cuda_host_malloc_));
+    data_ = SyncedMemoryPool::Instance().Get(count_ * sizeof(Dtype),
+                                             use_cuda_host_malloc_);
+    // the pool may hand back a larger size class, use all of it so the
+    // next growth within the class does not swap buffers
+    capacity_ = static_cast<int>(data_->size() / sizeof(Dtype));
   }
 }
 
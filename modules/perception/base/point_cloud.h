@@ -423,6 +423,96 @@ class AttributePointCloud : public PointCloud<PointT> {
   std::vector<uint8_t> points_label_;
 };
 
+// @brief Structure-of-arrays point cloud, one contiguous array per
+// coordinate, so kernels that touch only a subset of the fields stream
+// through packed memory instead of strided interleaved points
+template <typename T>
+class PlanarPointCloud {
+ public:
+  // @brief default constructor
+  PlanarPointCloud() = default;
+  // @brief destructor
+  ~PlanarPointCloud() = default;
+  // @brief accessor of point size
+  inline size_t size() const { return points_x_.size(); }
+  // @brief whether the cloud is empty
+  inline bool empty() const { return points_x_.empty(); }
+  // @brief reserve function wrapper of coordinate vectors
+  inline void reserve(const size_t size) {
+    points_x_.reserve(size);
+    points_y_.reserve(size);
+    points_z_.reserve(size);
+    points_intensity_.reserve(size);
+  }
+  // @brief resize function wrapper of coordinate vectors
+  inline void resize(const size_t size) {
+    points_x_.resize(size);
+    points_y_.resize(size);
+    points_z_.resize(size);
+    points_intensity_.resize(size);
+  }
+  // @brief clear function wrapper of coordinate vectors
+  inline void clear() {
+    points_x_.clear();
+    points_y_.clear();
+    points_z_.clear();
+    points_intensity_.clear();
+  }
+  // @brief gather a point cloud with interleaved storage into planes
+  template <typename PointT>
+  inline void CopyFrom(const PointCloud<PointT>& rhs) {
+    resize(rhs.size());
+    for (size_t i = 0; i < rhs.size(); ++i) {
+      const PointT& point = rhs[i];
+      points_x_[i] = static_cast<T>(point.x);
+      points_y_[i] = static_cast<T>(point.y);
+      points_z_[i] = static_cast<T>(point.z);
+      points_intensity_[i] = static_cast<T>(point.intensity);
+    }
+  }
+  // @brief scatter the planes back into interleaved storage
+  template <typename PointT>
+  inline void CopyTo(PointCloud<PointT>* rhs) const {
+    rhs->resize(size());
+    for (size_t i = 0; i < size(); ++i) {
+      PointT& point = (*rhs)[i];
+      point.x = static_cast<typename PointT::Type>(points_x_[i]);
+      point.y = static_cast<typename PointT::Type>(points_y_[i]);
+      point.z = static_cast<typename PointT::Type>(points_z_[i]);
+      point.intensity =
+          static_cast<typename PointT::Type>(points_intensity_[i]);
+    }
+  }
+  // @brief check data member consistency
+  bool CheckConsistency() const {
+    return ((points_x_.size() == points_y_.size()) &&
+            (points_x_.size() == points_z_.size()) &&
+            (points_x_.size() == points_intensity_.size()));
+  }
+
+  const std::vector<T>& points_x() const { return points_x_; }
+  const T& points_x(size_t i) const { return points_x_[i]; }
+  std::vector<T>* mutable_points_x() { return &points_x_; }
+
+  const std::vector<T>& points_y() const { return points_y_; }
+  const T& points_y(size_t i) const { return points_y_[i]; }
+  std::vector<T>* mutable_points_y() { return &points_y_; }
+
+  const std::vector<T>& points_z() const { return points_z_; }
+  const T& points_z(size_t i) const { return points_z_[i]; }
+  std::vector<T>* mutable_points_z() { return &points_z_; }
+
+  const std::vector<T>& points_intensity() const { return points_intensity_; }
+  const T& points_intensity(size_t i) const { return points_intensity_[i]; }
+  std::vector<T>* mutable_points_intensity() { return &points_intensity_; }
+
+ protected:
+  std::vector<T> points_x_;
+  std::vector<T> points_y_;
+  std::vector<T> points_z_;
+  std::vector<T> points_intensity_;
+};
+
 // typedef of point cloud indices
 typedef std::shared_ptr<PointIndices> PointIndicesPtr;
 typedef std::shared_ptr<const PointIndices> PointIndicesConstPtr;
@@ -431,6 +521,10 @@ typedef std::shared_ptr<const PointIndices> PointIndicesConstPtr;
 typedef AttributePointCloud<PointF> PointFCloud;
 typedef AttributePointCloud<PointD> PointDCloud;
 
+// typedef of structure-of-arrays point cloud
+typedef PlanarPointCloud<float> PlanarPointFCloud;
+typedef PlanarPointCloud<double> PlanarPointDCloud;
+
 typedef std::shared_ptr<PointFCloud> PointFCloudPtr;
 typedef std::shared_ptr<const PointFCloud> PointFCloudConstPtr;
 
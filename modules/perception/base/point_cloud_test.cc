@@ -348,6 +348,52 @@ TEST(PointCloudTest, attribute_point_cloud_interface_test) {
   EXPECT_EQ(cloud2.points_label().at(1), 5);
 }
 
+TEST(PointCloudTest, planar_point_cloud_interface_test) {
+  using TestPointCloud = AttributePointCloud<PointF>;
+  TestPointCloud cloud;
+  cloud.resize(2);
+  cloud[0].x = 1.f;
+  cloud[0].y = 2.f;
+  cloud[0].z = 3.f;
+  cloud[0].intensity = 4.f;
+  cloud[1].x = 5.f;
+  cloud[1].y = 6.f;
+  cloud[1].z = 7.f;
+  cloud[1].intensity = 8.f;
+
+  PlanarPointFCloud planar_cloud;
+  EXPECT_TRUE(planar_cloud.empty());
+  planar_cloud.reserve(2);
+  planar_cloud.CopyFrom(cloud);
+  EXPECT_EQ(planar_cloud.size(), 2);
+  EXPECT_TRUE(planar_cloud.CheckConsistency());
+  EXPECT_EQ(planar_cloud.points_x(0), 1.f);
+  EXPECT_EQ(planar_cloud.points_y(0), 2.f);
+  EXPECT_EQ(planar_cloud.points_z(0), 3.f);
+  EXPECT_EQ(planar_cloud.points_intensity(0), 4.f);
+  EXPECT_EQ(planar_cloud.points_x(1), 5.f);
+  EXPECT_EQ(planar_cloud.points_y(1), 6.f);
+  EXPECT_EQ(planar_cloud.points_z(1), 7.f);
+  EXPECT_EQ(planar_cloud.points_intensity(1), 8.f);
+
+  planar_cloud.mutable_points_x()->at(0) = 10.f;
+  EXPECT_EQ(planar_cloud.points_x().at(0), 10.f);
+  EXPECT_EQ(planar_cloud.points_y().size(), 2);
+  EXPECT_EQ(planar_cloud.points_z().size(), 2);
+  EXPECT_EQ(planar_cloud.points_intensity().size(), 2);
+
+  PointCloud<PointF> cloud_out;
+  planar_cloud.CopyTo(&cloud_out);
+  EXPECT_EQ(cloud_out.size(), 2);
+  EXPECT_EQ(cloud_out[0].x, 10.f);
+  EXPECT_EQ(cloud_out[0].intensity, 4.f);
+  EXPECT_EQ(cloud_out[1].z, 7.f);
+
+  planar_cloud.clear();
+  EXPECT_EQ(planar_cloud.size(), 0);
+  EXPECT_TRUE(planar_cloud.CheckConsistency());
+}
+
 TEST(PointCloudTest, transform_test) {
   Eigen::Affine3d affine = Eigen::Affine3d::Identity();
   affine.rotate(Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d(1, 0, 0)));
@@ -186,6 +186,36 @@ void SyncedMemory::set_cpu_data(void* data) {
   own_cpu_data_ = false;
 }
 
+void SyncedMemory::Clear() {
+  check_device();
+  // zero owned allocations without releasing them, so the buffer
+  // behaves like a freshly constructed SyncedMemory when reused;
+  // externally set pointers are dropped instead of scrubbed
+  if (cpu_ptr_ && !own_cpu_data_) {
+    cpu_ptr_ = nullptr;
+  }
+  if (cpu_ptr_) {
+    memset(cpu_ptr_, 0, size_);
+  }
+#ifndef PERCEPTION_CPU_ONLY
+  if (gpu_ptr_ && !own_gpu_data_) {
+    gpu_ptr_ = nullptr;
+  }
+  if (gpu_ptr_) {
+    BASE_CUDA_CHECK(cudaMemset(gpu_ptr_, 0, size_));
+  }
+#endif
+  if (cpu_ptr_ && gpu_ptr_) {
+    head_ = SYNCED;
+  } else if (cpu_ptr_) {
+    head_ = HEAD_AT_CPU;
+  } else if (gpu_ptr_) {
+    head_ = HEAD_AT_GPU;
+  } else {
+    head_ = UNINITIALIZED;
+  }
+}
+
 const void* SyncedMemory::gpu_data() {
   check_device();
 #ifndef PERCEPTION_CPU_ONLY
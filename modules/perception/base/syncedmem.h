@@ -108,6 +108,7 @@ class SyncedMemory {
 
   const void* cpu_data();
   void set_cpu_data(void* data);
+  void Clear();
   const void* gpu_data();
   void set_gpu_data(void* data);
   void* mutable_cpu_data();
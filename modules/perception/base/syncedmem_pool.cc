@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/syncedmem_pool.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+std::shared_ptr<SyncedMemory> SyncedMemoryPool::Get(size_t size,
+                                                    bool use_cuda) {
+// TODO(All): remove conditional build
+#ifndef PERCEPTION_BASE_DISABLE_POOL
+  const size_t size_class = SizeClass(size);
+  const int list_id = use_cuda ? 1 : 0;
+  SyncedMemory* ptr = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& bucket = free_buffers_[list_id][size_class];
+    if (!bucket.empty()) {
+      ptr = bucket.back();
+      bucket.pop_back();
+    }
+  }
+  if (ptr == nullptr) {
+    ptr = new SyncedMemory(size_class, use_cuda);
+  } else {
+    // recycled buffers keep their host and device allocations, only the
+    // contents are cleared to match a freshly constructed SyncedMemory
+    ptr->Clear();
+  }
+  return std::shared_ptr<SyncedMemory>(
+      ptr, [this, size_class, list_id](SyncedMemory* mem) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_buffers_[list_id][size_class].push_back(mem);
+      });
+#else
+  return std::shared_ptr<SyncedMemory>(new SyncedMemory(size, use_cuda));
+#endif
+}
+
+size_t SyncedMemoryPool::SizeClass(size_t size) const {
+  size_t size_class = kSyncedMemoryPoolMinSize;
+  while (size_class < size) {
+    size_class <<= 1;
+  }
+  return size_class;
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
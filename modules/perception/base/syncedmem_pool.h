@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/perception/base/syncedmem.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+// @brief minimum pooled buffer size, smaller requests share one class
+static const size_t kSyncedMemoryPoolMinSize = 1 << 12;
+
+// @brief global pool of SyncedMemory buffers bucketed by power-of-two
+// size class; once warmed up, blob reshapes reuse recycled buffers
+// instead of paying a host or device allocation per frame
+class SyncedMemoryPool {
+ public:
+  // @brief Only allow accessing from global instance
+  static SyncedMemoryPool& Instance() {
+    static SyncedMemoryPool pool;
+    return pool;
+  }
+  // @brief get a zeroed buffer of at least the given size, recycled to
+  // the pool when the last holder releases it
+  std::shared_ptr<SyncedMemory> Get(size_t size, bool use_cuda);
+
+  SyncedMemoryPool(const SyncedMemoryPool&) = delete;
+  void operator=(const SyncedMemoryPool&) = delete;
+
+ private:
+  SyncedMemoryPool() = default;
+  ~SyncedMemoryPool() = default;
+  // @brief round up to the enclosing power-of-two size class
+  size_t SizeClass(size_t size) const;
+
+  std::mutex mutex_;
+  // free lists keyed by size class, pageable and pinned kept apart
+  std::unordered_map<size_t, std::vector<SyncedMemory*>> free_buffers_[2];
+};  // class SyncedMemoryPool
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
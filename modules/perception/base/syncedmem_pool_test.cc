@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/syncedmem_pool.h"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+TEST(SyncedMemoryPoolTest, reuse_test) {
+  auto& pool = SyncedMemoryPool::Instance();
+
+  std::shared_ptr<SyncedMemory> mem = pool.Get(100, false);
+  EXPECT_GE(mem->size(), 100);
+  memset(mem->mutable_cpu_data(), 1, 100);
+  SyncedMemory* raw_ptr = mem.get();
+  size_t size = mem->size();
+  mem.reset();
+
+  std::shared_ptr<SyncedMemory> recycled = pool.Get(size, false);
+#ifndef PERCEPTION_BASE_DISABLE_POOL
+  EXPECT_EQ(recycled.get(), raw_ptr);
+#endif
+  // recycled buffers come back cleared
+  const char* cpu_data = static_cast<const char*>(recycled->cpu_data());
+  EXPECT_EQ(cpu_data[0], 0);
+  EXPECT_EQ(cpu_data[99], 0);
+}
+
+TEST(SyncedMemoryPoolTest, size_class_test) {
+  auto& pool = SyncedMemoryPool::Instance();
+
+  // buffers held concurrently are distinct
+  std::shared_ptr<SyncedMemory> mem1 = pool.Get(10, false);
+  std::shared_ptr<SyncedMemory> mem2 = pool.Get(10, false);
+  EXPECT_NE(mem1.get(), mem2.get());
+
+  // size classes round up to at least the requested size
+  const size_t large_size = (1 << 20) + 1;
+  std::shared_ptr<SyncedMemory> mem3 = pool.Get(large_size, false);
+  EXPECT_GE(mem3->size(), large_size);
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -15,6 +15,7 @@
  *****************************************************************************/
 #include "modules/perception/camera/common/data_provider.h"
 #include "cyber/common/log.h"
+#include "modules/perception/inference/utils/resize.h"
 
 namespace apollo {
 namespace perception {
@@ -118,6 +119,8 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
   gray_ready_ = false;
   rgb_ready_ = false;
   bgr_ready_ = false;
+  raw_color_ = base::Color::NONE;
+  undistort_pending_ = false;
 
   bool success = false;
 
@@ -147,38 +150,46 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
   AINFO << "Fill in GPU mode ...";
   if (encoding == "rgb8") {
     if (handler_ != nullptr) {
+      // keep the raw image; undistortion runs lazily on first use, so
+      // fused consumers can skip the intermediate image entirely
       cudaMemcpy(ori_rgb_->mutable_gpu_data(), data,
                  ori_rgb_->rows() * ori_rgb_->width_step(), cudaMemcpyDefault);
-      success = handler_->Handle(*ori_rgb_, rgb_.get());
+      raw_color_ = base::Color::RGB;
+      undistort_pending_ = true;
+      success = true;
     } else {
       cudaMemcpy(rgb_->mutable_gpu_data(), data,
                  rgb_->rows() * rgb_->width_step(), cudaMemcpyDefault);
+      rgb_ready_ = true;
       success = true;
     }
-    rgb_ready_ = true;
   } else if (encoding == "bgr8") {
     if (handler_ != nullptr) {
       cudaMemcpy(ori_bgr_->mutable_gpu_data(), data,
                  ori_bgr_->rows() * ori_bgr_->width_step(), cudaMemcpyDefault);
-      success = handler_->Handle(*ori_bgr_, bgr_.get());
+      raw_color_ = base::Color::BGR;
+      undistort_pending_ = true;
+      success = true;
     } else {
       cudaMemcpy(bgr_->mutable_gpu_data(), data,
                  bgr_->rows() * bgr_->width_step(), cudaMemcpyDefault);
+      bgr_ready_ = true;
       success = true;
     }
-    bgr_ready_ = true;
   } else if (encoding == "gray" || encoding == "y") {
     if (handler_ != nullptr) {
       cudaMemcpy(ori_gray_->mutable_gpu_data(), data,
                  ori_gray_->rows() * ori_gray_->width_step(),
                  cudaMemcpyDefault);
-      success = handler_->Handle(*ori_gray_, gray_.get());
+      raw_color_ = base::Color::GRAY;
+      undistort_pending_ = true;
+      success = true;
     } else {
       cudaMemcpy(gray_->mutable_gpu_data(), data,
                  gray_->rows() * gray_->width_step(), cudaMemcpyDefault);
+      gray_ready_ = true;
       success = true;
     }
-    gray_ready_ = true;
   } else {
     success = false;
     AERROR << "Unrecognized image encoding: " << encoding;
@@ -238,6 +249,50 @@ bool DataProvider::GetImageBlob(const DataProvider::ImageOptions &options,
   return true;
 }
 
+bool DataProvider::FillInputBlob(const DataProvider::ImageOptions &options,
+                                 std::shared_ptr<base::Blob<float>> blob,
+                                 int start_axis, float mean_b, float mean_g,
+                                 float mean_r, bool channel_axis,
+                                 float scale) {
+  if (blob == nullptr) {
+    return false;
+  }
+  if (undistort_pending_ && raw_color_ == options.target_color) {
+    base::RectI roi(0, 0, src_width_, src_height_);
+    if (options.do_crop) {
+      roi = options.crop_roi;
+    }
+    const base::Image8U *raw = nullptr;
+    switch (raw_color_) {
+      case base::Color::RGB:
+        raw = ori_rgb_.get();
+        break;
+      case base::Color::BGR:
+        raw = ori_bgr_.get();
+        break;
+      case base::Color::GRAY:
+        raw = ori_gray_.get();
+        break;
+      default:
+        break;
+    }
+    if (raw != nullptr) {
+      // fused path: undistort + resize + normalization + packing in one
+      // kernel from the raw image
+      return inference::RemapResizeGPU(
+          *raw, blob, src_width_, start_axis, handler_->d_mapx(),
+          handler_->d_mapy(), roi, mean_b, mean_g, mean_r, channel_axis,
+          scale);
+    }
+  }
+  base::Image8U image;
+  if (!GetImage(options, &image)) {
+    return false;
+  }
+  return inference::ResizeGPU(image, blob, src_width_, start_axis, mean_b,
+                              mean_g, mean_r, channel_axis, scale);
+}
+
 bool DataProvider::GetImage(const DataProvider::ImageOptions &options,
                             base::Image8U *image) {
   AINFO << "GetImage ...";
@@ -275,7 +330,36 @@ bool DataProvider::GetImage(const DataProvider::ImageOptions &options,
   return true;
 }
 
+bool DataProvider::EnsureUndistorted() {
+  if (!undistort_pending_) {
+    return true;
+  }
+  bool success = false;
+  switch (raw_color_) {
+    case base::Color::RGB:
+      success = handler_->Handle(*ori_rgb_, rgb_.get());
+      rgb_ready_ = success;
+      break;
+    case base::Color::BGR:
+      success = handler_->Handle(*ori_bgr_, bgr_.get());
+      bgr_ready_ = success;
+      break;
+    case base::Color::GRAY:
+      success = handler_->Handle(*ori_gray_, gray_.get());
+      gray_ready_ = success;
+      break;
+    default:
+      AERROR << "Invalid raw color: " << static_cast<uint8_t>(raw_color_);
+      break;
+  }
+  undistort_pending_ = false;
+  return success;
+}
+
 bool DataProvider::to_gray_image() {
+  if (!EnsureUndistorted()) {
+    return false;
+  }
   if (!gray_ready_) {
     NppiSize roi;
     roi.height = src_height_;
@@ -301,6 +385,9 @@ bool DataProvider::to_gray_image() {
 }
 
 bool DataProvider::to_rgb_image() {
+  if (!EnsureUndistorted()) {
+    return false;
+  }
   if (!rgb_ready_) {
     NppiSize roi;
     roi.height = src_height_;
@@ -325,6 +412,9 @@ bool DataProvider::to_rgb_image() {
 }
 
 bool DataProvider::to_bgr_image() {
+  if (!EnsureUndistorted()) {
+    return false;
+  }
   if (!bgr_ready_) {
     NppiSize roi;
     roi.height = src_height_;
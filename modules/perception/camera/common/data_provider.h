@@ -108,6 +108,18 @@ class DataProvider {
   // image blob with specified size should be filled, required.
   bool GetImage(const ImageOptions &options, base::Image8U *image);
 
+  // @brief: fill a float inference input blob from the raw message.
+  // @param [in]: options, normalization and layout of the input blob
+  // @param [in/out]: blob (NHWC or NCHW per channel_axis)
+  // When undistortion is enabled and the raw encoding already matches the
+  // requested color, the undistortion, resize, normalization and packing
+  // run fused in one kernel from the raw image, so the full resolution
+  // undistorted image is never materialized for this consumer.
+  bool FillInputBlob(const ImageOptions &options,
+                     std::shared_ptr<base::Blob<float>> blob, int start_axis,
+                     float mean_b, float mean_g, float mean_r,
+                     bool channel_axis, float scale);
+
   int src_height() const { return src_height_; }
   int src_width() const { return src_width_; }
   const std::string &sensor_name() const { return sensor_name_; }
@@ -117,10 +129,15 @@ class DataProvider {
   bool to_bgr_image();
 
  protected:
+  // @brief: run the pending undistortion of the raw image, if any.
+  bool EnsureUndistorted();
+
   std::string sensor_name_;
   int src_height_ = 0;
   int src_width_ = 0;
   int device_id_ = -1;
+  base::Color raw_color_ = base::Color::NONE;
+  bool undistort_pending_ = false;
 
   std::shared_ptr<base::Image8U> ori_gray_;
   std::shared_ptr<base::Image8U> ori_rgb_;
@@ -48,6 +48,11 @@ class UndistortionHandler {
   // @brief: Release the resources
   bool Release(void);
 
+  // gpu resident remap tables, for fusing the undistortion into
+  // downstream preprocessing kernels
+  const base::Blob<float> &d_mapx() const { return d_mapx_; }
+  const base::Blob<float> &d_mapy() const { return d_mapy_; }
+
  private:
   base::Blob<float> d_mapx_;
   base::Blob<float> d_mapy_;
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/perception/base/camera.h"
 #include "modules/perception/camera/common/camera_frame.h"
@@ -51,6 +52,20 @@ class BaseObstacleDetector {
   virtual bool Detect(const ObstacleDetectorOptions &options,
                       CameraFrame *frame) = 0;
 
+  // @brief: detect obstacles from simultaneous frames in one batch.
+  // @param [in]: options
+  // @param [in/out]: frames
+  // default implementation falls back to per-frame detection;
+  // detectors with batched inference support should override it.
+  virtual bool BatchDetect(const ObstacleDetectorOptions &options,
+                           const std::vector<CameraFrame *> &frames) {
+    bool status = true;
+    for (auto frame : frames) {
+      status = Detect(options, frame) && status;
+    }
+    return status;
+  }
+
   virtual std::string Name() const = 0;
 
   BaseObstacleDetector(const BaseObstacleDetector &) = delete;
@@ -86,6 +86,80 @@ bool PolyFit(const std::vector<Eigen::Matrix<Dtype, 2, 1>>& pos_vec,
   return true;
 }
 
+// batched version of PolyFit: accumulate the fixed-size normal equations
+// (A^T A) x = A^T b of every lane instance and solve them with fixed-size
+// Eigen kernels, instead of factorizing one dynamic design matrix per lane.
+// moments are accumulated in double to keep the precision of the QR path
+template <typename Dtype>
+bool PolyFitBatch(
+    const std::vector<std::vector<Eigen::Matrix<Dtype, 2, 1>>>& pos_vecs,
+    const int& order,
+    std::vector<Eigen::Matrix<Dtype, max_poly_order + 1, 1>>* coeffs,
+    std::vector<bool>* fit_flags, const bool& is_x_axis = true) {
+  if (coeffs == NULL || fit_flags == NULL) {
+    AERROR << "The coefficient or flag pointer is NULL.";
+    return false;
+  }
+
+  if (order > max_poly_order) {
+    AERROR << "The order of polynomial must be smaller than " << max_poly_order;
+    return false;
+  }
+
+  int nr_instances = static_cast<int>(pos_vecs.size());
+  coeffs->resize(nr_instances);
+  fit_flags->assign(nr_instances, false);
+
+  const int dim = order + 1;
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, max_poly_order + 1,
+                max_poly_order + 1>
+      ata(dim, dim);
+  Eigen::Matrix<double, Eigen::Dynamic, 1, 0, max_poly_order + 1, 1> atb(dim);
+  for (int k = 0; k < nr_instances; ++k) {
+    (*coeffs)[k].setZero();
+    const std::vector<Eigen::Matrix<Dtype, 2, 1>>& pos_vec = pos_vecs[k];
+    int n = static_cast<int>(pos_vec.size());
+    if (n <= order) {
+      ADEBUG << "Not enough points for instance " << k << ". #points = " << n;
+      continue;
+    }
+
+    double moments[2 * max_poly_order + 1] = {0};
+    double rhs[max_poly_order + 1] = {0};
+    for (int i = 0; i < n; ++i) {
+      double x = static_cast<double>(is_x_axis ? pos_vec[i].x()
+                                               : pos_vec[i].y());
+      double y = static_cast<double>(is_x_axis ? pos_vec[i].y()
+                                               : pos_vec[i].x());
+      double x_pow = 1.0;
+      for (int j = 0; j < dim; ++j) {
+        moments[j] += x_pow;
+        rhs[j] += x_pow * y;
+        x_pow *= x;
+      }
+      for (int j = dim; j <= 2 * order; ++j) {
+        moments[j] += x_pow;
+        x_pow *= x;
+      }
+    }
+    for (int i = 0; i < dim; ++i) {
+      for (int j = 0; j < dim; ++j) {
+        ata(i, j) = moments[i + j];
+      }
+      atb(i) = rhs[i];
+    }
+
+    Eigen::Matrix<double, Eigen::Dynamic, 1, 0, max_poly_order + 1, 1> result =
+        ata.ldlt().solve(atb);
+    for (int j = 0; j < dim; ++j) {
+      (*coeffs)[k](j) = static_cast<Dtype>(result(j));
+    }
+    (*fit_flags)[k] = true;
+  }
+
+  return true;
+}
+
 template <typename Dtype>
 bool PolyEval(const Dtype& x, int order,
               const Eigen::Matrix<Dtype, max_poly_order + 1, 1>& coeff,
@@ -733,6 +733,10 @@ void DenselineLanePostprocessor::AddImageLaneline(
 void DenselineLanePostprocessor::PolyFitCameraLaneline(CameraFrame* frame) {
   std::vector<base::LaneLine>& lane_objects = frame->lane_objects;
   int laneline_num = static_cast<int>(lane_objects.size());
+  std::vector<std::vector<Eigen::Matrix<float, 2, 1> > > camera_pos_vecs(
+      laneline_num);
+  std::vector<float> x_starts(laneline_num, 0.0f);
+  std::vector<float> x_ends(laneline_num, 0.0f);
   for (int line_index = 0; line_index < laneline_num; line_index++) {
     const std::vector<base::Point3DF>& camera_point_set =
         lane_objects[line_index].curve_camera_point_set;
@@ -740,8 +744,9 @@ void DenselineLanePostprocessor::PolyFitCameraLaneline(CameraFrame* frame) {
     // x: latitudinal direction
     float x_start = camera_point_set[0].z;
     float x_end = 0.0f;
-    Eigen::Matrix<float, max_poly_order + 1, 1> camera_coeff;
-    std::vector<Eigen::Matrix<float, 2, 1> > camera_pos_vec;
+    std::vector<Eigen::Matrix<float, 2, 1> >& camera_pos_vec =
+        camera_pos_vecs[line_index];
+    camera_pos_vec.reserve(camera_point_set.size());
     for (int i = 0; i < static_cast<int>(camera_point_set.size()); i++) {
       x_end = std::max(camera_point_set[i].z, x_end);
       x_start = std::min(camera_point_set[i].z, x_start);
@@ -749,19 +754,29 @@ void DenselineLanePostprocessor::PolyFitCameraLaneline(CameraFrame* frame) {
       camera_pos << camera_point_set[i].z, camera_point_set[i].x;
       camera_pos_vec.push_back(camera_pos);
     }
+    x_starts[line_index] = x_start;
+    x_ends[line_index] = x_end;
+  }
 
-    bool is_x_axis = true;
-    bool fit_flag =
-        PolyFit(camera_pos_vec, max_poly_order, &camera_coeff, is_x_axis);
-    if (!fit_flag) {
+  // fit all lane instances with one batched least-squares solve
+  bool is_x_axis = true;
+  std::vector<Eigen::Matrix<float, max_poly_order + 1, 1> > camera_coeffs;
+  std::vector<bool> fit_flags;
+  PolyFitBatch(camera_pos_vecs, max_poly_order, &camera_coeffs, &fit_flags,
+               is_x_axis);
+  for (int line_index = 0; line_index < laneline_num; line_index++) {
+    if (!fit_flags[line_index]) {
       continue;
     }
+    const Eigen::Matrix<float, max_poly_order + 1, 1>& camera_coeff =
+        camera_coeffs[line_index];
     lane_objects[line_index].curve_camera_coord.a = camera_coeff(3, 0);
     lane_objects[line_index].curve_camera_coord.b = camera_coeff(2, 0);
     lane_objects[line_index].curve_camera_coord.c = camera_coeff(1, 0);
     lane_objects[line_index].curve_camera_coord.d = camera_coeff(0, 0);
-    lane_objects[line_index].curve_camera_coord.x_start = x_start;
-    lane_objects[line_index].curve_camera_coord.x_end = x_end;
+    lane_objects[line_index].curve_camera_coord.x_start =
+        x_starts[line_index];
+    lane_objects[line_index].curve_camera_coord.x_end = x_ends[line_index];
     lane_objects[line_index].use_type = base::LaneLineUseType::REAL;
   }
   return;
@@ -30,6 +30,24 @@ namespace camera {
 
 using cyber::common::GetAbsolutePath;
 
+namespace {
+
+// @brief view of one batch slot of a batched blob, sharing device memory
+std::shared_ptr<base::Blob<float>> BatchSliceBlob(
+    const std::shared_ptr<base::Blob<float>> &blob, int batch_id) {
+  if (blob == nullptr) {
+    return nullptr;
+  }
+  std::vector<int> shape = blob->shape();
+  shape[0] = 1;
+  auto slice = std::make_shared<base::Blob<float>>(shape);
+  const int step = blob->count() / blob->shape(0);
+  slice->set_gpu_data(blob->mutable_gpu_data() + batch_id * step);
+  return slice;
+}
+
+}  // namespace
+
 void YoloObstacleDetector::LoadInputShape(const yolo::ModelParam &model_param) {
   float offset_ratio = model_param.offset_ratio();
   float cropped_ratio = model_param.cropped_ratio();
@@ -69,6 +87,9 @@ void YoloObstacleDetector::LoadParam(const yolo::YoloParam &yolo_param) {
 
   border_ratio_ = model_param.border_ratio();
 
+  batch_size_ = model_param.max_batch_size() < 1 ? 1
+                                                 : model_param.max_batch_size();
+
   // init NMS
   auto const &nms_param = yolo_param.nms_param();
   nms_.sigma = nms_param.sigma();
@@ -120,7 +141,8 @@ bool YoloObstacleDetector::InitNet(const yolo::YoloParam &yolo_param,
     return false;
   }
   inference_->set_gpu_id(gpu_id_);
-  std::vector<int> shape = {1, height_, width_, 3};
+  inference_->set_max_batch_size(batch_size_);
+  std::vector<int> shape = {batch_size_, height_, width_, 3};
   std::map<std::string, std::vector<int>> shape_map{
       {net_param.input_blob(), shape}};
 
@@ -193,6 +215,35 @@ void YoloObstacleDetector::InitYoloBlob(const yolo::NetworkParam &net_param) {
       inference_->get_blob(yolo_param_.net_param().visible_ratio_blob());
   yolo_blobs_.cut_off_ratio_blob =
       inference_->get_blob(yolo_param_.net_param().cut_off_ratio_blob());
+
+  // per-slot views into the batched network blobs; the result, anchor
+  // and expand blobs stay shared since slots are post-processed in turn
+  auto input_blob = inference_->get_blob(net_param.input_blob());
+  batch_input_blobs_.clear();
+  batch_yolo_blobs_.clear();
+  for (int i = 0; i < batch_size_; ++i) {
+    batch_input_blobs_.push_back(BatchSliceBlob(input_blob, i));
+    YoloBlobs slot_blobs = yolo_blobs_;
+    slot_blobs.loc_blob = BatchSliceBlob(yolo_blobs_.loc_blob, i);
+    slot_blobs.obj_blob = BatchSliceBlob(yolo_blobs_.obj_blob, i);
+    slot_blobs.cls_blob = BatchSliceBlob(yolo_blobs_.cls_blob, i);
+    slot_blobs.ori_blob = BatchSliceBlob(yolo_blobs_.ori_blob, i);
+    slot_blobs.dim_blob = BatchSliceBlob(yolo_blobs_.dim_blob, i);
+    slot_blobs.lof_blob = BatchSliceBlob(yolo_blobs_.lof_blob, i);
+    slot_blobs.lor_blob = BatchSliceBlob(yolo_blobs_.lor_blob, i);
+    slot_blobs.brvis_blob = BatchSliceBlob(yolo_blobs_.brvis_blob, i);
+    slot_blobs.brswt_blob = BatchSliceBlob(yolo_blobs_.brswt_blob, i);
+    slot_blobs.ltvis_blob = BatchSliceBlob(yolo_blobs_.ltvis_blob, i);
+    slot_blobs.ltswt_blob = BatchSliceBlob(yolo_blobs_.ltswt_blob, i);
+    slot_blobs.rtvis_blob = BatchSliceBlob(yolo_blobs_.rtvis_blob, i);
+    slot_blobs.rtswt_blob = BatchSliceBlob(yolo_blobs_.rtswt_blob, i);
+    slot_blobs.area_id_blob = BatchSliceBlob(yolo_blobs_.area_id_blob, i);
+    slot_blobs.visible_ratio_blob =
+        BatchSliceBlob(yolo_blobs_.visible_ratio_blob, i);
+    slot_blobs.cut_off_ratio_blob =
+        BatchSliceBlob(yolo_blobs_.cut_off_ratio_blob, i);
+    batch_yolo_blobs_.push_back(slot_blobs);
+  }
 }
 
 bool YoloObstacleDetector::Init(const ObstacleDetectorInitOptions &options) {
@@ -247,13 +298,20 @@ bool YoloObstacleDetector::InitFeatureExtractor(const std::string &root_dir) {
   feat_options.root_dir = root_dir;
   feat_options.gpu_id = gpu_id_;
   auto feat_blob_name = yolo_param_.net_param().feat_blob();
-  feat_options.feat_blob = inference_->get_blob(feat_blob_name);
+  auto feat_blob = inference_->get_blob(feat_blob_name);
   feat_options.input_height = height_;
   feat_options.input_width = width_;
-  feature_extractor_.reset(BaseFeatureExtractorRegisterer::GetInstanceByName(
-      "TrackingFeatureExtractor"));
-  if (!feature_extractor_->Init(feat_options)) {
-    return false;
+  // one extractor per batch slot, each bound to its feature view
+  feature_extractors_.clear();
+  for (int i = 0; i < batch_size_; ++i) {
+    feat_options.feat_blob = BatchSliceBlob(feat_blob, i);
+    std::shared_ptr<BaseFeatureExtractor> feature_extractor(
+        BaseFeatureExtractorRegisterer::GetInstanceByName(
+            "TrackingFeatureExtractor"));
+    if (!feature_extractor->Init(feat_options)) {
+      return false;
+    }
+    feature_extractors_.push_back(feature_extractor);
   }
   return true;
 }
@@ -263,6 +321,23 @@ bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
   if (frame == nullptr) {
     return false;
   }
+  std::vector<CameraFrame *> frames(1, frame);
+  return BatchDetect(options, frames);
+}
+
+bool YoloObstacleDetector::BatchDetect(
+    const ObstacleDetectorOptions &options,
+    const std::vector<CameraFrame *> &frames) {
+  if (frames.empty() || static_cast<int>(frames.size()) > batch_size_) {
+    AERROR << "Invalid batch of " << frames.size()
+           << " frames, network batch size is " << batch_size_;
+    return false;
+  }
+  for (auto frame : frames) {
+    if (frame == nullptr) {
+      return false;
+    }
+  }
 
   Timer timer;
   if (cudaSetDevice(gpu_id_) != cudaSuccess) {
@@ -270,61 +345,68 @@ bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
     return false;
   }
 
-  auto input_blob = inference_->get_blob(yolo_param_.net_param().input_blob());
   AINFO << "Start: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  DataProvider::ImageOptions image_options;
-  image_options.target_color = base::Color::BGR;
-  image_options.crop_roi = base::RectI(
-      0, offset_y_, static_cast<int>(base_camera_model_->get_width()),
-      static_cast<int>(base_camera_model_->get_height()) - offset_y_);
-  image_options.do_crop = true;
-  frame->data_provider->GetImage(image_options, image_.get());
-  AINFO << "GetImageBlob: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  inference::ResizeGPU(*image_, input_blob, frame->data_provider->src_width(),
-                       0);
-  AINFO << "Resize: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+  // stage every frame into its batch slot of the shared input blob
+  for (size_t i = 0; i < frames.size(); ++i) {
+    DataProvider::ImageOptions image_options;
+    image_options.target_color = base::Color::BGR;
+    image_options.crop_roi = base::RectI(
+        0, offset_y_, static_cast<int>(base_camera_model_->get_width()),
+        static_cast<int>(base_camera_model_->get_height()) - offset_y_);
+    image_options.do_crop = true;
+    frames[i]->data_provider->GetImage(image_options, image_.get());
+    inference::ResizeGPU(*image_, batch_input_blobs_[i],
+                         frames[i]->data_provider->src_width(), 0);
+  }
+  AINFO << "Preprocess: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
 
   /////////////////////////// detection part ///////////////////////////
   inference_->Infer();
-
-  get_objects_gpu(yolo_blobs_, stream_, types_, nms_, yolo_param_.model_param(),
-                  light_vis_conf_threshold_, light_swt_conf_threshold_,
-                  overlapped_.get(), idx_sm_.get(), &(frame->detected_objects));
-
-  AINFO << "GetObj: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  filter_bbox(min_dims_, &(frame->detected_objects));
-  FeatureExtractorOptions feat_options;
-  feat_options.normalized = true;
-  AINFO << "Post1: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  feature_extractor_->Extract(feat_options, frame);
-  AINFO << "Extract: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  recover_bbox(frame->data_provider->src_width(),
-               frame->data_provider->src_height() - offset_y_, offset_y_,
-               &frame->detected_objects);
-
-  // post processing
-  int left_boundary =
-      static_cast<int>(border_ratio_ * static_cast<float>(image_->cols()));
-  int right_boundary = static_cast<int>((1.0f - border_ratio_) *
-                                        static_cast<float>(image_->cols()));
-  for (auto &obj : frame->detected_objects) {
-    // recover alpha
-    obj->camera_supplement.alpha /= ori_cycle_;
-    // get area_id from visible_ratios
-    if (yolo_param_.model_param().num_areas() == 0) {
-      obj->camera_supplement.area_id =
-          get_area_id(obj->camera_supplement.visible_ratios);
-    }
-    // clear cut off ratios
-    auto &box = obj->camera_supplement.box;
-    if (box.xmin >= left_boundary) {
-      obj->camera_supplement.cut_off_ratios[2] = 0;
-    }
-    if (box.xmax <= right_boundary) {
-      obj->camera_supplement.cut_off_ratios[3] = 0;
+  AINFO << "Infer: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+
+  // demultiplex detections per batch slot
+  for (size_t i = 0; i < frames.size(); ++i) {
+    CameraFrame *frame = frames[i];
+    get_objects_gpu(batch_yolo_blobs_[i], stream_, types_, nms_,
+                    yolo_param_.model_param(), light_vis_conf_threshold_,
+                    light_swt_conf_threshold_, overlapped_.get(), idx_sm_.get(),
+                    &(frame->detected_objects));
+
+    AINFO << "GetObj: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+    filter_bbox(min_dims_, &(frame->detected_objects));
+    FeatureExtractorOptions feat_options;
+    feat_options.normalized = true;
+    AINFO << "Post1: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+    feature_extractors_[i]->Extract(feat_options, frame);
+    AINFO << "Extract: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+    recover_bbox(frame->data_provider->src_width(),
+                 frame->data_provider->src_height() - offset_y_, offset_y_,
+                 &frame->detected_objects);
+
+    // post processing
+    int left_boundary =
+        static_cast<int>(border_ratio_ * static_cast<float>(image_->cols()));
+    int right_boundary = static_cast<int>((1.0f - border_ratio_) *
+                                          static_cast<float>(image_->cols()));
+    for (auto &obj : frame->detected_objects) {
+      // recover alpha
+      obj->camera_supplement.alpha /= ori_cycle_;
+      // get area_id from visible_ratios
+      if (yolo_param_.model_param().num_areas() == 0) {
+        obj->camera_supplement.area_id =
+            get_area_id(obj->camera_supplement.visible_ratios);
+      }
+      // clear cut off ratios
+      auto &box = obj->camera_supplement.box;
+      if (box.xmin >= left_boundary) {
+        obj->camera_supplement.cut_off_ratios[2] = 0;
+      }
+      if (box.xmax <= right_boundary) {
+        obj->camera_supplement.cut_off_ratios[3] = 0;
+      }
     }
+    AINFO << "Post2: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
   }
-  AINFO << "Post2: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
 
   return true;
 }
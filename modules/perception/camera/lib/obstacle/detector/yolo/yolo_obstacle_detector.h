@@ -50,6 +50,9 @@ class YoloObstacleDetector : public BaseObstacleDetector {
 
   bool Detect(const ObstacleDetectorOptions &options,
               CameraFrame *frame) override;
+
+  bool BatchDetect(const ObstacleDetectorOptions &options,
+                   const std::vector<CameraFrame *> &frames) override;
   std::string Name() const override { return "YoloObstacleDetector"; }
 
  protected:
@@ -61,7 +64,8 @@ class YoloObstacleDetector : public BaseObstacleDetector {
   bool InitFeatureExtractor(const std::string &root_dir);
 
  private:
-  std::shared_ptr<BaseFeatureExtractor> feature_extractor_;
+  // per batch slot feature extractors, each bound to its feature view
+  std::vector<std::shared_ptr<BaseFeatureExtractor>> feature_extractors_;
   yolo::YoloParam yolo_param_;
   std::shared_ptr<base::BaseCameraModel> base_camera_model_ = nullptr;
   std::shared_ptr<inference::Inference> inference_;
@@ -84,6 +88,12 @@ class YoloObstacleDetector : public BaseObstacleDetector {
   MinDims min_dims_;
   YoloBlobs yolo_blobs_;
 
+  // number of batch slots the network is built with
+  int batch_size_ = 1;
+  // per batch slot views into the batched network blobs
+  std::vector<YoloBlobs> batch_yolo_blobs_;
+  std::vector<std::shared_ptr<base::Blob<float>>> batch_input_blobs_;
+
   std::shared_ptr<base::Image8U> image_ = nullptr;
   std::shared_ptr<base::Blob<bool>> overlapped_ = nullptr;
   std::shared_ptr<base::Blob<int>> idx_sm_ = nullptr;
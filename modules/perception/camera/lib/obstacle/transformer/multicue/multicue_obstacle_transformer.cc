@@ -43,8 +43,9 @@ bool MultiCueObstacleTransformer::Init(
 }
 
 void MultiCueObstacleTransformer::SetObjMapperOptions(
-    base::ObjectPtr obj, Eigen::Matrix3f camera_k_matrix, int width_image,
-    int height_image, ObjMapperOptions *obj_mapper_options, float *theta_ray) {
+    base::ObjectPtr obj, const Eigen::Matrix3f &camera_k_matrix_inverse,
+    int width_image, int height_image, ObjMapperOptions *obj_mapper_options,
+    float *theta_ray) {
   // prepare bbox2d
   float bbox2d[4] = {
       obj->camera_supplement.box.xmin, obj->camera_supplement.box.ymin,
@@ -65,7 +66,7 @@ void MultiCueObstacleTransformer::SetObjMapperOptions(
   Eigen::Vector3f image_point_low_center(box_cent_x, bbox2d[3], 1);
   Eigen::Vector3f point_in_camera =
       static_cast<Eigen::Matrix<float, 3, 1, 0, 3, 1>>(
-          camera_k_matrix.inverse() * image_point_low_center);
+          camera_k_matrix_inverse * image_point_low_center);
   *theta_ray =
       static_cast<float>(atan2(point_in_camera.x(), point_in_camera.z()));
   float rotation_y =
@@ -87,6 +88,8 @@ void MultiCueObstacleTransformer::SetObjMapperOptions(
   obj_mapper_options->check_dimension = multicue_param_.check_dimension();
   obj_mapper_options->type_min_vol_index =
       MatchTemplates(sub_type, dimension_hwl);
+  obj_mapper_options->do_refinement =
+      obj->confidence >= multicue_param_.min_refine_confidence();
 
   ADEBUG << "#2D-to-3D for one obj:";
   ADEBUG << "Obj pred ry:" << rotation_y;
@@ -237,6 +240,9 @@ bool MultiCueObstacleTransformer::Transform(
   const auto &camera2world_pose = frame->camera2world_pose;
   mapper_->Init(k_mat, width_image, height_image);
 
+  // the intrinsics inverse is shared by every detection in the frame
+  const Eigen::Matrix3f camera_k_matrix_inverse = camera_k_matrix.inverse();
+
   ObjMapperOptions obj_mapper_options;
   float object_center[3] = {0};
   float dimension_hwl[3] = {0};
@@ -251,7 +257,7 @@ bool MultiCueObstacleTransformer::Transform(
 
     // set object mapper options
     float theta_ray = 0.0f;
-    SetObjMapperOptions(obj, camera_k_matrix, width_image, height_image,
+    SetObjMapperOptions(obj, camera_k_matrix_inverse, width_image, height_image,
                         &obj_mapper_options, &theta_ray);
 
     // process
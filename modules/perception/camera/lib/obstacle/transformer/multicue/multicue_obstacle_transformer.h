@@ -51,7 +51,8 @@ class MultiCueObstacleTransformer : public BaseObstacleTransformer {
   std::string Name() const override;
 
  private:
-  void SetObjMapperOptions(base::ObjectPtr obj, Eigen::Matrix3f camera_k_matrix,
+  void SetObjMapperOptions(base::ObjectPtr obj,
+                           const Eigen::Matrix3f &camera_k_matrix_inverse,
                            int width_image, int height_image,
                            ObjMapperOptions *obj_mapper_options,
                            float *theta_ray);
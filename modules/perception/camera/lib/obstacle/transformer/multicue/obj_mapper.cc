@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/perception/camera/lib/obstacle/transformer/multicue/obj_mapper.h"
 
+#include <Eigen/Core>
+
 namespace apollo {
 namespace perception {
 namespace camera {
@@ -83,7 +85,8 @@ bool ObjMapper::SolveCenterFromNearestVerticalEdge(const float *bbox,
 }
 
 bool ObjMapper::Solve3dBboxGivenOneFullBboxDimensionOrientation(
-    const float *bbox, const float *hwl, float *ry, float *center) {
+    const float *bbox, const float *hwl, float *ry, float *center,
+    bool do_refinement) {
   const float PI = common::Constant<float>::PI();
   const float PI_HALF = PI / 2;
   const float small_angle_diff =
@@ -104,7 +107,7 @@ bool ObjMapper::Solve3dBboxGivenOneFullBboxDimensionOrientation(
       std::abs(*ry + PI_HALF) < small_angle_diff) {
     *ry = *ry > 0.0f ? PI_HALF : -PI_HALF;
   }
-  if (!truncated) {
+  if (!truncated && do_refinement) {
     PostRefineOrientation(bbox, hwl, center, ry);
     success =
         SolveCenterFromNearestVerticalEdge(bbox, hwl, *ry, center, center_2d);
@@ -172,8 +175,8 @@ bool ObjMapper::Solve3dBbox(const ObjMapperOptions &options, float center[3],
   }
 
   // call 3d solver
-  bool success =
-      Solve3dBboxGivenOneFullBboxDimensionOrientation(bbox, hwl, ry, center);
+  bool success = Solve3dBboxGivenOneFullBboxDimensionOrientation(
+      bbox, hwl, ry, center, options.do_refinement);
 
   // calculate variance for yaw & z
   float yaw_score_mean =
@@ -222,6 +225,9 @@ void ObjMapper::PostRefineOrientation(const float *bbox, const float *hwl,
   const float PI_HALF = PI * 0.5f;
   const float D_RY = 2 * PI / static_cast<float>(kNrBinsRy);
 
+  std::vector<float> bin_score;
+  ScoreRyBinsBatch(bbox, hwl, center, &bin_score);
+
   float ry_test = -PI;
   float ry_best = -PI;
   float score_best = 0.0f;
@@ -234,7 +240,7 @@ void ObjMapper::PostRefineOrientation(const float *bbox, const float *hwl,
       continue;
     }
 
-    float score_test = GetProjectionScore(ry_test, bbox, hwl, center, true);
+    float score_test = bin_score[count_bin % kNrBinsRy];
     if (score_test > score_best) {
       score_best = score_test;
       ry_best = ry_test;
@@ -263,6 +269,62 @@ void ObjMapper::PostRefineOrientation(const float *bbox, const float *hwl,
   }
 }
 
+void ObjMapper::ScoreRyBinsBatch(const float *bbox, const float *hwl,
+                                 const float *center,
+                                 std::vector<float> *bin_score) const {
+  const int kNrBinsRy = static_cast<int>(ry_score_.size());
+  const float PI = common::Constant<float>::PI();
+  const float D_RY = 2 * PI / static_cast<float>(kNrBinsRy);
+
+  float x_corners[8] = {0};
+  float y_corners[8] = {0};
+  float z_corners[8] = {0};
+  GenCorners(hwl[0], hwl[1], hwl[2], x_corners, y_corners, z_corners);
+  Eigen::Map<const Eigen::Matrix<float, 1, 8>> x_cor(x_corners);
+  Eigen::Map<const Eigen::Matrix<float, 1, 8>> y_cor(y_corners);
+  Eigen::Map<const Eigen::Matrix<float, 1, 8>> z_cor(z_corners);
+
+  // rotated + translated corners of every bin, stacked column-wise
+  Eigen::Matrix<float, 3, Eigen::Dynamic> pts(3, 8 * kNrBinsRy);
+  for (int b = 0; b < kNrBinsRy; ++b) {
+    float ry = -PI + D_RY * static_cast<float>(b);
+    float cos_ry = static_cast<float>(cos(ry));
+    float sin_ry = static_cast<float>(sin(ry));
+    pts.block<1, 8>(0, b * 8) =
+        (cos_ry * x_cor + sin_ry * z_cor).array() + center[0];
+    pts.block<1, 8>(1, b * 8) = y_cor.array() + center[1];
+    pts.block<1, 8>(2, b * 8) =
+        (cos_ry * z_cor - sin_ry * x_cor).array() + center[2];
+  }
+
+  // single projection through the intrinsics for all bins
+  Eigen::Map<const Eigen::Matrix<float, 3, 3, Eigen::RowMajor>> k_mat(k_mat_);
+  Eigen::Matrix<float, 3, Eigen::Dynamic> pts_proj = k_mat * pts;
+
+  bin_score->resize(kNrBinsRy);
+  float x_max_flt = static_cast<float>(width_ - 1);
+  float y_max_flt = static_cast<float>(height_ - 1);
+  for (int b = 0; b < kNrBinsRy; ++b) {
+    float x_min = FLT_MAX;
+    float x_max = -FLT_MAX;
+    float y_min = FLT_MAX;
+    float y_max = -FLT_MAX;
+    for (int i = 0; i < 8; ++i) {
+      int col = b * 8 + i;
+      float rec_depth = common::IRec(pts_proj(2, col));
+      x_min = std::min(x_min, pts_proj(0, col) * rec_depth);
+      x_max = std::max(x_max, pts_proj(0, col) * rec_depth);
+      y_min = std::min(y_min, pts_proj(1, col) * rec_depth);
+      y_max = std::max(y_max, pts_proj(1, col) * rec_depth);
+    }
+    x_min = std::min(std::max(x_min, 0.0f), x_max_flt);
+    x_max = std::min(std::max(x_max, 0.0f), x_max_flt);
+    y_min = std::min(std::max(y_min, 0.0f), y_max_flt);
+    y_max = std::min(std::max(y_max, 0.0f), y_max_flt);
+    (*bin_score)[b] = GetJaccardIndex(bbox, x_min, y_min, x_max, y_max);
+  }
+}
+
 void ObjMapper::GetCenter(const float *bbox, const float &z_ref,
                           const float &ry, const float *hwl, float *center,
                           float *x) const {
@@ -34,6 +34,7 @@ struct ObjMapperOptions {
   bool is_veh = true;
   bool check_dimension = true;
   int type_min_vol_index = 0;
+  bool do_refinement = true;
 };
 
 // hyper parameters
@@ -106,8 +107,8 @@ class ObjMapper {
  private:
   bool Solve3dBboxGivenOneFullBboxDimensionOrientation(const float *bbox,
                                                        const float *hwl,
-                                                       float *ry,
-                                                       float *center);
+                                                       float *ry, float *center,
+                                                       bool do_refinement);
 
   bool SolveCenterFromNearestVerticalEdge(const float *bbox, const float *hwl,
                                           float ry, float *center,
@@ -159,6 +160,13 @@ class ObjMapper {
   void PostRefineOrientation(const float *bbox, const float *hwl,
                              const float *center, float *ry);
 
+  // score all ry bins at once: corners of every candidate rotation are
+  // stacked column-wise and pushed through the intrinsics with a single
+  // matrix product instead of one 8-point projection per bin
+  void ScoreRyBinsBatch(const float *bbox, const float *hwl,
+                        const float *center,
+                        std::vector<float> *bin_score) const;
+
   void GetCenter(const float *bbox, const float &z_ref, const float &ry,
                  const float *hwl, float *center,
                  float *x /*init outside*/) const;
@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <thread>
+#include <vector>
 
 namespace apollo {
 namespace perception {
@@ -44,6 +46,7 @@ void PlaneFitGroundDetectorParam::SetDefault() {
   nr_ransac_iter_threshold = 32;
   candidate_filter_threshold = 1.0f;  // 1 meter
   nr_smooth_iter = 1;
+  nr_ground_height_threads = 4;
 }
 
 bool PlaneFitGroundDetectorParam::Validate() const {
@@ -392,19 +395,43 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeight(
   for (r = 0; r < nr_points; ++r) {
     height_above_ground[r] = FLT_MAX;
   }
-  ComputeSignedGroundHeightLine(
-      point_cloud, ground_planes_[0], ground_planes_[0], ground_planes_[1],
-      height_above_ground, 0, nr_points, nr_point_elements);
-  for (r = 1; r < nm1; ++r) {
-    ComputeSignedGroundHeightLine(point_cloud, ground_planes_[r - 1],
-                                  ground_planes_[r], ground_planes_[r + 1],
-                                  height_above_ground, r, nr_points,
+  // each row only reads the planes of its own and adjacent rows and only
+  // writes heights of points binned to its own cells, so rows can be
+  // processed independently
+  auto compute_row = [&](unsigned int row) {
+    const GroundPlaneLiDAR *up = ground_planes_[row > 0 ? row - 1 : 0];
+    const GroundPlaneLiDAR *dn = ground_planes_[row < nm1 ? row + 1 : nm1];
+    ComputeSignedGroundHeightLine(point_cloud, up, ground_planes_[row], dn,
+                                  height_above_ground, row, nr_points,
                                   nr_point_elements);
+  };
+  unsigned int nr_threads = param_.nr_ground_height_threads;
+  if (nr_threads <= 1 || param_.nr_grids_coarse < nr_threads * 2) {
+    for (r = 0; r < param_.nr_grids_coarse; ++r) {
+      compute_row(r);
+    }
+    return;
+  }
+  unsigned int rows_per_thread =
+      (param_.nr_grids_coarse + nr_threads - 1) / nr_threads;
+  std::vector<std::thread> threads;
+  threads.reserve(nr_threads);
+  for (unsigned int t = 0; t < nr_threads; ++t) {
+    unsigned int row_begin = t * rows_per_thread;
+    unsigned int row_end =
+        IMin(row_begin + rows_per_thread, param_.nr_grids_coarse);
+    if (row_begin >= row_end) {
+      break;
+    }
+    threads.push_back(std::thread([&compute_row, row_begin, row_end]() {
+      for (unsigned int row = row_begin; row < row_end; ++row) {
+        compute_row(row);
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
   }
-  ComputeSignedGroundHeightLine(point_cloud, ground_planes_[nm1 - 1],
-                                ground_planes_[nm1], ground_planes_[nm1],
-                                height_above_ground, nm1, nr_points,
-                                nr_point_elements);
 }
 
 void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
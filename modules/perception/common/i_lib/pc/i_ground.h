@@ -190,6 +190,9 @@ struct PlaneFitGroundDetectorParam {
   float candidate_filter_threshold;
   int nr_ransac_iter_threshold;
   int nr_smooth_iter;
+  // number of threads for the point-to-plane height pass, grid rows are
+  // independent so they are processed in parallel, 1 disables threading
+  unsigned int nr_ground_height_threads;
 };
 
 struct PlaneFitPointCandIndices {
@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/fusion/base/sensor_alignment_service.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace fusion {
+
+constexpr size_t TimestampRing::kRingSize;
+
+size_t TimestampRing::Slot(size_t age) const {
+  return (head_ + kRingSize - 1 - age) & (kRingSize - 1);
+}
+
+void TimestampRing::Push(double timestamp) {
+  if (size_ > 0) {
+    const double gap = timestamp - Latest();
+    if (gap <= 0.0) {
+      AWARN << "Dropped non-monotonic timestamp " << timestamp
+            << ", latest is " << Latest();
+      return;
+    }
+    mean_period_ =
+        (size_ == 1) ? gap : 0.9 * mean_period_ + 0.1 * gap;
+  }
+  buffer_[head_] = timestamp;
+  head_ = (head_ + 1) & (kRingSize - 1);
+  if (size_ < kRingSize) {
+    ++size_;
+  }
+}
+
+double TimestampRing::Latest() const { return buffer_[Slot(0)]; }
+
+bool TimestampRing::Nearest(double query, double* nearest) const {
+  if (size_ == 0) {
+    return false;
+  }
+  // Predict how many frames back the query lies, then walk to the local
+  // minimum. With a steady frame rate the prediction is at most one slot
+  // off, so the walk terminates after a step or two.
+  size_t age = 0;
+  if (mean_period_ > 0.0 && query < Latest()) {
+    age = static_cast<size_t>(std::lround((Latest() - query) / mean_period_));
+    age = std::min(age, size_ - 1);
+  }
+  while (age + 1 < size_ && std::fabs(buffer_[Slot(age + 1)] - query) <
+                                std::fabs(buffer_[Slot(age)] - query)) {
+    ++age;
+  }
+  while (age > 0 && std::fabs(buffer_[Slot(age - 1)] - query) <
+                        std::fabs(buffer_[Slot(age)] - query)) {
+    --age;
+  }
+  *nearest = buffer_[Slot(age)];
+  return true;
+}
+
+bool TimestampRing::InterpolationWeights(double query, double* lower,
+                                         double* upper,
+                                         double* weight) const {
+  double nearest = 0.0;
+  if (!Nearest(query, &nearest)) {
+    return false;
+  }
+  *lower = nearest;
+  *upper = nearest;
+  *weight = 0.0;
+  if (nearest <= query) {
+    if (nearest == Latest()) {
+      return nearest == query;
+    }
+    size_t age = 0;
+    while (buffer_[Slot(age)] != nearest) {
+      ++age;
+    }
+    *upper = buffer_[Slot(age - 1)];
+  } else {
+    size_t age = 0;
+    while (buffer_[Slot(age)] != nearest) {
+      ++age;
+    }
+    if (age + 1 >= size_) {
+      return false;
+    }
+    *upper = nearest;
+    *lower = buffer_[Slot(age + 1)];
+  }
+  *weight = (query - *lower) / (*upper - *lower);
+  return true;
+}
+
+void TimestampRing::Clear() {
+  head_ = 0;
+  size_ = 0;
+  mean_period_ = 0.0;
+}
+
+SensorAlignmentService::SensorAlignmentService() {}
+
+void SensorAlignmentService::ObserveTimestamp(const std::string& sensor_id,
+                                              double timestamp) {
+  rings_[sensor_id].Push(timestamp);
+  // Sample the capture-time offset against every other sensor that has
+  // reported, keyed by the ordered pair.
+  for (const auto& pair : rings_) {
+    if (pair.first == sensor_id || pair.second.Size() == 0) {
+      continue;
+    }
+    const double offset = timestamp - pair.second.Latest();
+    DriftStat& stat = pair_stats_[sensor_id + "|" + pair.first];
+    ++stat.count;
+    const double delta = offset - stat.mean;
+    stat.mean += delta / static_cast<double>(stat.count);
+    stat.m2 += delta * (offset - stat.mean);
+  }
+}
+
+bool SensorAlignmentService::GetNearestTimestamp(const std::string& sensor_id,
+                                                 double query,
+                                                 double* nearest) const {
+  const auto& it = rings_.find(sensor_id);
+  if (it == rings_.end()) {
+    return false;
+  }
+  return it->second.Nearest(query, nearest);
+}
+
+bool SensorAlignmentService::GetInterpolationWeights(
+    const std::string& sensor_id, double query, double* lower, double* upper,
+    double* weight) const {
+  const auto& it = rings_.find(sensor_id);
+  if (it == rings_.end()) {
+    return false;
+  }
+  return it->second.InterpolationWeights(query, lower, upper, weight);
+}
+
+bool SensorAlignmentService::GetPairDrift(const std::string& sensor_id,
+                                          const std::string& reference_id,
+                                          double* mean,
+                                          double* std_dev) const {
+  const auto& it = pair_stats_.find(sensor_id + "|" + reference_id);
+  if (it == pair_stats_.end() || it->second.count == 0) {
+    return false;
+  }
+  *mean = it->second.mean;
+  *std_dev = (it->second.count > 1)
+                 ? std::sqrt(it->second.m2 /
+                             static_cast<double>(it->second.count - 1))
+                 : 0.0;
+  return true;
+}
+
+void SensorAlignmentService::Reset() {
+  rings_.clear();
+  pair_stats_.clear();
+}
+
+}  // namespace fusion
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace perception {
+namespace fusion {
+
+// Fixed-size ring of the most recent measurement timestamps of one sensor.
+// Timestamps are expected to arrive in order; out-of-order samples are
+// dropped. Because sensors publish at a near-constant rate, the slot of the
+// nearest timestamp can be predicted from the mean period and then refined
+// locally, which makes the lookup O(1) in the common case instead of a
+// binary search per query.
+class TimestampRing {
+ public:
+  void Push(double timestamp);
+
+  // Finds the cached timestamp closest to query. Returns false when empty.
+  bool Nearest(double query, double* nearest) const;
+
+  // Finds the two cached timestamps bracketing query and the weight of the
+  // upper one, so that (1 - weight) * lower + weight * upper == query.
+  // When query falls outside the cached range, both bounds clamp to the
+  // nearest timestamp, the weight is 0 and false is returned.
+  bool InterpolationWeights(double query, double* lower, double* upper,
+                            double* weight) const;
+
+  double Latest() const;
+  double MeanPeriod() const { return mean_period_; }
+  size_t Size() const { return size_; }
+  void Clear();
+
+ private:
+  size_t Slot(size_t age) const;
+
+  static constexpr size_t kRingSize = 32;  // power of two
+
+  double buffer_[kRingSize];
+  size_t head_ = 0;  // next write slot
+  size_t size_ = 0;
+  // Exponential moving average of the inter-frame gap.
+  double mean_period_ = 0.0;
+};
+
+// Centralized timestamp alignment for fusion. SensorDataManager reports
+// every arriving frame; fusion stages query nearest frames and
+// interpolation weights from the per-sensor rings, and the running offset
+// statistics per sensor pair expose the clock drift that otherwise
+// degrades association silently.
+class SensorAlignmentService {
+ public:
+  void ObserveTimestamp(const std::string& sensor_id, double timestamp);
+
+  bool GetNearestTimestamp(const std::string& sensor_id, double query,
+                           double* nearest) const;
+
+  bool GetInterpolationWeights(const std::string& sensor_id, double query,
+                               double* lower, double* upper,
+                               double* weight) const;
+
+  // Mean and standard deviation of the capture-time offset observed from
+  // sensor_id to reference_id. Returns false before any pairwise sample.
+  bool GetPairDrift(const std::string& sensor_id,
+                    const std::string& reference_id, double* mean,
+                    double* std_dev) const;
+
+  void Reset();
+
+ private:
+  // Welford's online mean / variance of the pairwise timestamp offsets.
+  struct DriftStat {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+  };
+
+  std::unordered_map<std::string, TimestampRing> rings_;
+  std::unordered_map<std::string, DriftStat> pair_stats_;
+
+  DECLARE_SINGLETON(SensorAlignmentService)
+};
+
+}  // namespace fusion
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/fusion/base/sensor_alignment_service.h"
+
+#include <gtest/gtest.h>
+
+namespace apollo {
+namespace perception {
+namespace fusion {
+
+TEST(TimestampRingTest, nearest) {
+  TimestampRing ring;
+  double nearest = 0.0;
+  EXPECT_FALSE(ring.Nearest(100.0, &nearest));
+
+  for (int i = 0; i < 10; ++i) {
+    ring.Push(100.0 + 0.1 * i);
+  }
+  EXPECT_EQ(ring.Size(), 10);
+  EXPECT_DOUBLE_EQ(ring.Latest(), 100.9);
+  EXPECT_NEAR(ring.MeanPeriod(), 0.1, 1e-6);
+
+  EXPECT_TRUE(ring.Nearest(100.34, &nearest));
+  EXPECT_DOUBLE_EQ(nearest, 100.3);
+  EXPECT_TRUE(ring.Nearest(100.36, &nearest));
+  EXPECT_DOUBLE_EQ(nearest, 100.4);
+  // Queries outside the cached range clamp to the ends.
+  EXPECT_TRUE(ring.Nearest(50.0, &nearest));
+  EXPECT_DOUBLE_EQ(nearest, 100.0);
+  EXPECT_TRUE(ring.Nearest(200.0, &nearest));
+  EXPECT_DOUBLE_EQ(nearest, 100.9);
+
+  // Out-of-order samples are dropped.
+  ring.Push(100.5);
+  EXPECT_EQ(ring.Size(), 10);
+  EXPECT_DOUBLE_EQ(ring.Latest(), 100.9);
+
+  // The ring keeps only the newest kRingSize entries.
+  for (int i = 0; i < 40; ++i) {
+    ring.Push(101.0 + 0.1 * i);
+  }
+  EXPECT_TRUE(ring.Nearest(100.0, &nearest));
+  EXPECT_DOUBLE_EQ(nearest, 101.8);
+}
+
+TEST(TimestampRingTest, interpolation_weights) {
+  TimestampRing ring;
+  for (int i = 0; i < 5; ++i) {
+    ring.Push(10.0 + 0.1 * i);
+  }
+
+  double lower = 0.0;
+  double upper = 0.0;
+  double weight = 0.0;
+  EXPECT_TRUE(ring.InterpolationWeights(10.125, &lower, &upper, &weight));
+  EXPECT_DOUBLE_EQ(lower, 10.1);
+  EXPECT_DOUBLE_EQ(upper, 10.2);
+  EXPECT_NEAR(weight, 0.25, 1e-6);
+  EXPECT_NEAR((1.0 - weight) * lower + weight * upper, 10.125, 1e-6);
+
+  // Query beyond the newest sample cannot be bracketed.
+  EXPECT_FALSE(ring.InterpolationWeights(10.5, &lower, &upper, &weight));
+  EXPECT_DOUBLE_EQ(lower, 10.4);
+  EXPECT_DOUBLE_EQ(upper, 10.4);
+  EXPECT_DOUBLE_EQ(weight, 0.0);
+}
+
+TEST(SensorAlignmentServiceTest, pair_drift) {
+  SensorAlignmentService* service = SensorAlignmentService::Instance();
+  service->Reset();
+
+  double mean = 0.0;
+  double std_dev = 0.0;
+  EXPECT_FALSE(service->GetPairDrift("front_radar", "velodyne64", &mean,
+                                     &std_dev));
+
+  // Radar leads lidar by a constant 20ms.
+  for (int i = 0; i < 10; ++i) {
+    service->ObserveTimestamp("velodyne64", 100.0 + 0.1 * i);
+    service->ObserveTimestamp("front_radar", 100.02 + 0.1 * i);
+  }
+  EXPECT_TRUE(service->GetPairDrift("front_radar", "velodyne64", &mean,
+                                    &std_dev));
+  EXPECT_NEAR(mean, 0.02, 1e-6);
+  EXPECT_NEAR(std_dev, 0.0, 1e-6);
+
+  double nearest = 0.0;
+  EXPECT_TRUE(service->GetNearestTimestamp("velodyne64", 100.93, &nearest));
+  EXPECT_DOUBLE_EQ(nearest, 100.9);
+  EXPECT_FALSE(service->GetNearestTimestamp("unknown", 100.93, &nearest));
+
+  service->Reset();
+}
+
+}  // namespace fusion
+}  // namespace perception
+}  // namespace apollo
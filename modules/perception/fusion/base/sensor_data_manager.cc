@@ -19,6 +19,8 @@
 
 #include "cyber/common/log.h"
 
+#include "modules/perception/fusion/base/sensor_alignment_service.h"
+
 namespace apollo {
 namespace perception {
 namespace fusion {
@@ -59,6 +61,8 @@ void SensorDataManager::AddSensorMeasurements(
   }
 
   sensor_ptr->AddFrame(frame_ptr);
+  SensorAlignmentService::Instance()->ObserveTimestamp(sensor_id,
+                                                       frame_ptr->timestamp);
 }
 
 bool SensorDataManager::IsLidar(const base::FrameConstPtr& frame_ptr) {
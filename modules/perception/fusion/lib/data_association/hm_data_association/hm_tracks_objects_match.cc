@@ -18,12 +18,31 @@
 #include <map>
 #include <utility>
 
+#include "modules/common/math/aaboxkdtree2d.h"
 #include "modules/perception/common/graph/secure_matrix.h"
 
 namespace apollo {
 namespace perception {
 namespace fusion {
 
+namespace {
+
+// degenerate aabox wrapper so track centers can be indexed by the kdtree
+struct TrackCenterBox {
+  TrackCenterBox(const ::apollo::common::math::Vec2d& center, size_t index)
+      : box(center, center), index(index) {}
+  const ::apollo::common::math::AABox2d& aabox() const { return box; }
+  // the kdtree queries objects through this; the box is a point, so the
+  // distance to its center is exact
+  double DistanceSquareTo(const ::apollo::common::math::Vec2d& point) const {
+    return point.DistanceSquareTo(box.center());
+  }
+  ::apollo::common::math::AABox2d box;
+  size_t index;
+};
+
+}  // namespace
+
 double HMTrackersObjectsAssociation::s_match_distance_thresh_ = 4.0;
 double HMTrackersObjectsAssociation::s_match_distance_bound_ = 100.0;
 /* this is a slack threshold for camera 2 lidar/radar association.
@@ -306,27 +325,45 @@ void HMTrackersObjectsAssociation::ComputeAssociationDistanceMat(
   opt.ref_point = &tmp;
   association_mat->resize(unassigned_tracks.size());
   for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
-    int fusion_idx = static_cast<int>(unassigned_tracks[i]);
-    (*association_mat)[i].resize(unassigned_measurements.size());
-    const TrackPtr& fusion_track = fusion_tracks[fusion_idx];
-    for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
-      int sensor_idx = static_cast<int>(unassigned_measurements[j]);
-      const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
-      double distance = s_match_distance_thresh_;
+    (*association_mat)[i].assign(unassigned_measurements.size(),
+                                 s_match_distance_thresh_);
+  }
+  // index unassigned track centers with a kdtree so each measurement only
+  // scores the tracks inside the center distance gate; the 2d query is a
+  // superset of the 3d gate, so the exact check below is kept
+  std::vector<TrackCenterBox> track_boxes;
+  track_boxes.reserve(unassigned_tracks.size());
+  for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
+    const Eigen::Vector3d& center =
+        fusion_tracks[unassigned_tracks[i]]->GetFusedObject()->GetBaseObject()
+            ->center;
+    track_boxes.emplace_back(
+        ::apollo::common::math::Vec2d(center(0), center(1)), i);
+  }
+  ::apollo::common::math::AABoxKDTreeParams kdtree_params;
+  kdtree_params.max_leaf_size = 16;
+  ::apollo::common::math::AABoxKDTree2d<TrackCenterBox> track_kdtree(
+      track_boxes, kdtree_params);
+  for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
+    int sensor_idx = static_cast<int>(unassigned_measurements[j]);
+    const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
+    const Eigen::Vector3d& obj_center = sensor_object->GetBaseObject()->center;
+    std::vector<const TrackCenterBox*> candidates = track_kdtree.GetObjects(
+        ::apollo::common::math::Vec2d(obj_center(0), obj_center(1)),
+        s_association_center_dist_threshold_);
+    for (const TrackCenterBox* candidate : candidates) {
+      size_t i = candidate->index;
+      int fusion_idx = static_cast<int>(unassigned_tracks[i]);
+      const TrackPtr& fusion_track = fusion_tracks[fusion_idx];
       double center_dist =
-          (sensor_object->GetBaseObject()->center -
+          (obj_center -
            fusion_track->GetFusedObject()->GetBaseObject()->center)
               .norm();
-      if (center_dist < s_association_center_dist_threshold_) {
-        distance =
-            track_object_distance_.Compute(fusion_track, sensor_object, opt);
-      } else {
-        ADEBUG << "center_distance " << center_dist
-               << " exceeds slack threshold "
-               << s_association_center_dist_threshold_
-               << ", track_id: " << fusion_track->GetTrackId()
-               << ", obs_id: " << sensor_object->GetBaseObject()->track_id;
+      if (center_dist >= s_association_center_dist_threshold_) {
+        continue;
       }
+      double distance =
+          track_object_distance_.Compute(fusion_track, sensor_object, opt);
       (*association_mat)[i][j] = distance;
       ADEBUG << "track_id: " << fusion_track->GetTrackId()
              << ", obs_id: " << sensor_object->GetBaseObject()->track_id
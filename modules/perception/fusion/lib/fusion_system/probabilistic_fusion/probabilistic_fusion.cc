@@ -15,7 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/fusion/lib/fusion_system/probabilistic_fusion/probabilistic_fusion.h"
 
+#include <algorithm>
 #include <map>
+#include <thread>
 #include <utility>
 
 #include "cyber/common/file.h"
@@ -69,6 +71,7 @@ bool ProbabilisticFusion::Init(const FusionInitOptions& init_options) {
   for (int i = 0; i < params.prohibition_sensors_size(); ++i) {
     params_.prohibition_sensors.push_back(params.prohibition_sensors(i));
   }
+  params_.nr_track_update_threads = params.nr_track_update_threads();
 
   // static member initialization from PB config
   Track::SetMaxLidarInvisiblePeriod(params.max_lidar_invisible_period());
@@ -226,12 +229,13 @@ void ProbabilisticFusion::UpdateAssignedTracks(
   // which only has a small difference compared with actural match_distance
   TrackerOptions options;
   options.match_distance = 0;
-  for (size_t i = 0; i < assignments.size(); ++i) {
+  // each assignment targets a distinct track, so updates run in parallel
+  ParallelUpdateTracks(assignments.size(), [&](size_t i) {
     size_t track_ind = assignments[i].first;
     size_t obj_ind = assignments[i].second;
     trackers_[track_ind]->UpdateWithMeasurement(
         options, frame->GetForegroundObjects()[obj_ind], frame->GetTimestamp());
-  }
+  });
 }
 
 void ProbabilisticFusion::UpdateUnassignedTracks(
@@ -245,10 +249,39 @@ void ProbabilisticFusion::UpdateUnassignedTracks(
   TrackerOptions options;
   options.match_distance = 0;
   std::string sensor_id = frame->GetSensorId();
-  for (size_t i = 0; i < unassigned_track_inds.size(); ++i) {
+  ParallelUpdateTracks(unassigned_track_inds.size(), [&](size_t i) {
     size_t track_ind = unassigned_track_inds[i];
     trackers_[track_ind]->UpdateWithoutMeasurement(
         options, sensor_id, frame->GetTimestamp(), frame->GetTimestamp());
+  });
+}
+
+void ProbabilisticFusion::ParallelUpdateTracks(
+    size_t count, const std::function<void(size_t)>& update_func) {
+  size_t nr_threads = params_.nr_track_update_threads;
+  if (nr_threads <= 1 || count < nr_threads * 2) {
+    for (size_t i = 0; i < count; ++i) {
+      update_func(i);
+    }
+    return;
+  }
+  size_t chunk_size = (count + nr_threads - 1) / nr_threads;
+  std::vector<std::thread> threads;
+  threads.reserve(nr_threads);
+  for (size_t t = 0; t < nr_threads; ++t) {
+    size_t begin = t * chunk_size;
+    size_t end = std::min(begin + chunk_size, count);
+    if (begin >= end) {
+      break;
+    }
+    threads.push_back(std::thread([&update_func, begin, end]() {
+      for (size_t i = begin; i < end; ++i) {
+        update_func(i);
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
   }
 }
 
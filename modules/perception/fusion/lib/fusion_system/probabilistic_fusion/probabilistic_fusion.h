@@ -15,6 +15,7 @@
  *****************************************************************************/
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,6 +38,7 @@ struct FusionParams {
   std::string data_association_method;
   std::string gate_keeper_method;
   std::vector<std::string> prohibition_sensors;
+  size_t nr_track_update_threads = 4;
 };
 
 class ProbabilisticFusion : public BaseFusionSystem {
@@ -78,6 +80,12 @@ class ProbabilisticFusion : public BaseFusionSystem {
   void CreateNewTracks(const SensorFramePtr& frame,
                        const std::vector<size_t>& unassigned_obj_inds);
 
+  // @brief: run update_func over [0, count) split across the configured
+  // number of threads, callers must guarantee that different indices
+  // touch different tracks
+  void ParallelUpdateTracks(size_t count,
+                            const std::function<void(size_t)>& update_func);
+
   void CollectObjectsByTrack(double timestamp, const TrackPtr& track,
                              std::vector<base::ObjectPtr>* fused_objects);
 
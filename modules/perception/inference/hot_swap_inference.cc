@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/inference/hot_swap_inference.h"
+
+#include <utility>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+HotSwapInference::HotSwapInference(const EngineBuilder &builder,
+                                   const std::string &proto_file,
+                                   const std::string &weight_file,
+                                   const std::vector<std::string> &outputs,
+                                   const std::vector<std::string> &inputs)
+    : builder_(builder),
+      proto_file_(proto_file),
+      weight_file_(weight_file),
+      output_names_(outputs),
+      input_names_(inputs) {}
+
+HotSwapInference::~HotSwapInference() {
+  if (loader_.joinable()) {
+    loader_.join();
+  }
+}
+
+std::unique_ptr<Inference> HotSwapInference::BuildEngine(
+    const std::string &proto_file, const std::string &weight_file) {
+  std::unique_ptr<Inference> engine(builder_(proto_file, weight_file));
+  if (engine != nullptr) {
+    engine->set_max_batch_size(max_batch_size_);
+    engine->set_gpu_id(gpu_id_);
+  }
+  return engine;
+}
+
+bool HotSwapInference::Init(
+    const std::map<std::string, std::vector<int>> &shapes) {
+  engine_ = BuildEngine(proto_file_, weight_file_);
+  if (engine_ == nullptr || !engine_->Init(shapes)) {
+    AERROR << "Failed to init inference engine: " << proto_file_;
+    return false;
+  }
+  shapes_ = shapes;
+  for (const auto &names : {input_names_, output_names_}) {
+    for (const auto &name : names) {
+      auto blob = engine_->get_blob(name);
+      if (blob == nullptr) {
+        continue;
+      }
+      auto proxy = std::make_shared<base::Blob<float>>();
+      proxy->ReshapeLike(*blob);
+      proxy->ShareData(*blob);
+      proxy_blobs_[name] = proxy;
+    }
+  }
+  return true;
+}
+
+void HotSwapInference::Infer() {
+  if (standby_ready_.load()) {
+    CommitSwap();
+  }
+  engine_->Infer();
+}
+
+std::shared_ptr<base::Blob<float>> HotSwapInference::get_blob(
+    const std::string &name) {
+  auto iter = proxy_blobs_.find(name);
+  if (iter != proxy_blobs_.end()) {
+    return iter->second;
+  }
+  auto blob = engine_->get_blob(name);
+  if (blob == nullptr) {
+    return nullptr;
+  }
+  auto proxy = std::make_shared<base::Blob<float>>();
+  proxy->ReshapeLike(*blob);
+  proxy->ShareData(*blob);
+  proxy_blobs_[name] = proxy;
+  return proxy;
+}
+
+bool HotSwapInference::BeginSwap(const std::string &proto_file,
+                                 const std::string &weight_file) {
+  if (loading_.exchange(true)) {
+    AWARN << "A model swap is already in progress.";
+    return false;
+  }
+  if (standby_ready_.load()) {
+    AWARN << "A prepared model is still waiting to be committed.";
+    loading_.store(false);
+    return false;
+  }
+  if (loader_.joinable()) {
+    loader_.join();
+  }
+  loader_ = std::thread([this, proto_file, weight_file]() {
+    auto engine = BuildEngine(proto_file, weight_file);
+    if (engine == nullptr || !engine->Init(shapes_)) {
+      AERROR << "Failed to load replacement model: " << proto_file;
+      loading_.store(false);
+      return;
+    }
+    // Warm up off the inference path so the first real frame on the new
+    // engine does not pay for lazy allocations or kernel selection.
+    engine->Infer();
+    {
+      std::lock_guard<std::mutex> lock(standby_mutex_);
+      standby_ = std::move(engine);
+    }
+    standby_ready_.store(true);
+    loading_.store(false);
+  });
+  return true;
+}
+
+bool HotSwapInference::CommitSwap() {
+  std::unique_ptr<Inference> standby = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(standby_mutex_);
+    standby = std::move(standby_);
+  }
+  standby_ready_.store(false);
+  if (standby == nullptr) {
+    return false;
+  }
+  // The new engine must expose every blob the consumers already hold a
+  // proxy for; otherwise keep running on the current engine.
+  for (const auto &pair : proxy_blobs_) {
+    if (standby->get_blob(pair.first) == nullptr) {
+      AERROR << "Replacement model misses blob " << pair.first
+             << ", swap aborted.";
+      std::thread([](Inference *engine) { delete engine; }, standby.release())
+          .detach();
+      return false;
+    }
+  }
+  // Inputs already filled for this frame live in the old engine's memory;
+  // carry them over before the proxies are rebound.
+  for (const auto &name : input_names_) {
+    auto iter = proxy_blobs_.find(name);
+    if (iter == proxy_blobs_.end()) {
+      continue;
+    }
+    standby->get_blob(name)->CopyFrom(*(iter->second), true);
+  }
+  for (auto &pair : proxy_blobs_) {
+    auto blob = standby->get_blob(pair.first);
+    pair.second->ReshapeLike(*blob);
+    pair.second->ShareData(*blob);
+  }
+  // Destroy the retired engine off the inference path.
+  std::thread([](Inference *engine) { delete engine; }, engine_.release())
+      .detach();
+  engine_ = std::move(standby);
+  AINFO << "Switched to the newly loaded model.";
+  return true;
+}
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "modules/perception/inference/inference.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+// Double-buffered wrapper around an inference engine that allows the model
+// weights to be replaced at runtime without stalling the perception loop.
+// The standby engine is built and warmed up on a background thread; the
+// switch to it happens at the top of the next Infer() call, i.e. between
+// frames, and the retired engine is destroyed off the inference path.
+//
+// Consumers cache the blob pointers returned by get_blob() at init time, so
+// the wrapper hands out stable proxy blobs and rebinds them to the new
+// engine's blobs (via Blob::ShareData) when a swap commits. This requires
+// the replacement model to keep the blob names of the running one, which is
+// the case for a weight update on the same network architecture.
+class HotSwapInference : public Inference {
+ public:
+  using EngineBuilder = std::function<Inference *(
+      const std::string &proto_file, const std::string &weight_file)>;
+
+  HotSwapInference(const EngineBuilder &builder, const std::string &proto_file,
+                   const std::string &weight_file,
+                   const std::vector<std::string> &outputs,
+                   const std::vector<std::string> &inputs);
+
+  virtual ~HotSwapInference();
+
+  bool Init(const std::map<std::string, std::vector<int>> &shapes) override;
+
+  void Infer() override;
+
+  std::shared_ptr<base::Blob<float>> get_blob(const std::string &name) override;
+
+  // Kicks off loading of a replacement model on a background thread.
+  // Returns false if a previous swap is still being prepared. The new
+  // engine takes effect at the beginning of a later Infer() call.
+  bool BeginSwap(const std::string &proto_file, const std::string &weight_file);
+
+ private:
+  std::unique_ptr<Inference> BuildEngine(const std::string &proto_file,
+                                         const std::string &weight_file);
+  bool CommitSwap();
+
+  EngineBuilder builder_;
+  std::string proto_file_;
+  std::string weight_file_;
+  std::vector<std::string> output_names_;
+  std::vector<std::string> input_names_;
+  std::map<std::string, std::vector<int>> shapes_;
+
+  // Active engine; touched only on the inference thread.
+  std::unique_ptr<Inference> engine_ = nullptr;
+  // Stable blobs handed out to consumers; they share the data of the
+  // corresponding blobs of the active engine.
+  BlobMap proxy_blobs_;
+
+  std::mutex standby_mutex_;
+  std::unique_ptr<Inference> standby_ = nullptr;
+  std::atomic<bool> standby_ready_{false};
+  std::atomic<bool> loading_{false};
+  std::thread loader_;
+};
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
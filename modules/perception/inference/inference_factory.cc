@@ -17,18 +17,36 @@
 #include "modules/perception/inference/inference_factory.h"
 
 #include "modules/perception/inference/caffe/caffe_net.h"
+#include "modules/perception/inference/hot_swap_inference.h"
 #include "modules/perception/inference/tensorrt/rt_net.h"
 
 namespace apollo {
 namespace perception {
 namespace inference {
 
+namespace {
+constexpr char kHotSwapPrefix[] = "HotSwap";
+constexpr size_t kHotSwapPrefixLen = sizeof(kHotSwapPrefix) - 1;
+}  // namespace
+
 Inference *CreateInferenceByName(const std::string &name,
                                  const std::string &proto_file,
                                  const std::string &weight_file,
                                  const std::vector<std::string> &outputs,
                                  const std::vector<std::string> &inputs,
                                  const std::string &model_root) {
+  // "HotSwap<Engine>" wraps <Engine> for runtime model replacement.
+  if (name.compare(0, kHotSwapPrefixLen, kHotSwapPrefix) == 0) {
+    const std::string engine_name = name.substr(kHotSwapPrefixLen);
+    HotSwapInference::EngineBuilder builder =
+        [engine_name, outputs, inputs, model_root](
+            const std::string &proto, const std::string &weight) {
+          return CreateInferenceByName(engine_name, proto, weight, outputs,
+                                       inputs, model_root);
+        };
+    return new HotSwapInference(builder, proto_file, weight_file, outputs,
+                                inputs);
+  }
   if (name == "CaffeNet") {
     return new CaffeNet(proto_file, weight_file, outputs, inputs);
   } else if (name == "RTNet") {
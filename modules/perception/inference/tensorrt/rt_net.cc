@@ -23,6 +23,7 @@
 #include "modules/perception/inference/tensorrt/plugins/argmax_plugin.h"
 #include "modules/perception/inference/tensorrt/plugins/slice_plugin.h"
 #include "modules/perception/inference/tensorrt/plugins/softmax_plugin.h"
+#include "modules/perception/inference/utils/gpu_memory_pool.h"
 
 class RTLogger : public nvinfer1::ILogger {
   void log(Severity severity, const char *msg) override {
@@ -593,7 +594,9 @@ void RTNet::init_blob(std::vector<std::string> *names) {
     nvinfer1::DimsCHW dims = static_cast<nvinfer1::DimsCHW &&>(
         engine->getBindingDimensions(bindingIndex));
     int count = dims.c() * dims.h() * dims.w() * max_batch_size_;
-    cudaMalloc(&buffers_[bindingIndex], count * sizeof(float));
+    buffers_[bindingIndex] =
+        GPUMemoryPool::Instance()->Alloc(count * sizeof(float), model_root_);
+    CHECK_NOTNULL(buffers_[bindingIndex]);
     std::vector<int> shape;
     CHECK(this->shape(name, &shape));
     std::shared_ptr<apollo::perception::base::Blob<float>> blob;
@@ -716,12 +719,17 @@ RTNet::~RTNet() {
     delete calibrator_;
   }
   if (gpu_id_ >= 0) {
+#if CUDART_VERSION >= 10010
+    if (graph_exec_ != nullptr) {
+      cudaGraphExecDestroy(graph_exec_);
+    }
+#endif
     BASE_CUDA_CHECK(cudaStreamDestroy(stream_));
     network_->destroy();
     builder_->destroy();
     context_->destroy();
     for (auto buf : buffers_) {
-      cudaFree(buf);
+      GPUMemoryPool::Instance()->Free(buf);
     }
   }
 }
@@ -729,10 +737,17 @@ RTNet::~RTNet() {
 void RTNet::Infer() {
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+  // push host-resident inputs on this net's own stream, so copies from
+  // networks running concurrently on other streams can overlap instead
+  // of serializing on the legacy default stream
   for (auto name : input_names_) {
     auto blob = get_blob(name);
     if (blob != nullptr) {
-      blob->gpu_data();
+      if (blob->head() == base::SyncedMemory::HEAD_AT_CPU) {
+        blob->data()->async_gpu_push(stream_);
+      } else {
+        blob->gpu_data();
+      }
     }
   }
   // If `out_blob->mutable_cpu_data()` is invoked outside,
@@ -747,7 +762,19 @@ void RTNet::Infer() {
       blob->gpu_data();
     }
   }
+#if CUDART_VERSION >= 10010
+  if (!graph_capture_attempted_) {
+    graph_capture_attempted_ = true;
+    TryCaptureCudaGraph();
+  }
+  if (graph_exec_ != nullptr) {
+    BASE_CUDA_CHECK(cudaGraphLaunch(graph_exec_, stream_));
+  } else {
+    context_->enqueue(max_batch_size_, &buffers_[0], stream_, nullptr);
+  }
+#else
   context_->enqueue(max_batch_size_, &buffers_[0], stream_, nullptr);
+#endif
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
 
   for (auto name : output_names_) {
@@ -757,6 +784,41 @@ void RTNet::Infer() {
     }
   }
 }
+#if CUDART_VERSION >= 10010
+bool RTNet::TryCaptureCudaGraph() {
+  // capture the per-frame launch sequence into a CUDA graph; replay is
+  // valid because the binding buffers are fixed at Init. Capture is a
+  // best effort, any failure leaves graph_exec_ null and Infer keeps
+  // calling enqueue directly.
+  if (cudaStreamBeginCapture(stream_, cudaStreamCaptureModeThreadLocal) !=
+      cudaSuccess) {
+    cudaGetLastError();
+    AWARN << "Failed to begin CUDA graph capture, will use enqueue.";
+    return false;
+  }
+  bool enqueued = context_->enqueue(max_batch_size_, &buffers_[0], stream_,
+                                    nullptr);
+  cudaGraph_t graph = nullptr;
+  if (cudaStreamEndCapture(stream_, &graph) != cudaSuccess || !enqueued ||
+      graph == nullptr) {
+    cudaGetLastError();
+    AWARN << "CUDA graph capture failed, will use enqueue.";
+    return false;
+  }
+  if (cudaGraphInstantiate(&graph_exec_, graph, nullptr, nullptr, 0) !=
+      cudaSuccess) {
+    cudaGetLastError();
+    graph_exec_ = nullptr;
+    cudaGraphDestroy(graph);
+    AWARN << "CUDA graph instantiation failed, will use enqueue.";
+    return false;
+  }
+  cudaGraphDestroy(graph);
+  AINFO << "Captured CUDA graph, replaying it for subsequent inferences.";
+  return true;
+}
+#endif
+
 std::shared_ptr<apollo::perception::base::Blob<float>> RTNet::get_blob(
     const std::string &name) {
   auto iter = blobs_.find(name);
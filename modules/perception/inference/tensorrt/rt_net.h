@@ -173,10 +173,19 @@ class RTNet : public Inference {
 
   bool loadWeights(const std::string &model_file, WeightMap *weight_map);
   void init_blob(std::vector<std::string> *names);
+#if CUDART_VERSION >= 10010
+  bool TryCaptureCudaGraph();
+#endif
 
  private:
   nvinfer1::IExecutionContext *context_ = nullptr;
   cudaStream_t stream_ = 0;
+#if CUDART_VERSION >= 10010
+  // one-shot capture of the enqueue sequence, replayed with a single
+  // graph launch; stays null and enqueue is used if capture fails
+  cudaGraphExec_t graph_exec_ = nullptr;
+  bool graph_capture_attempted_ = false;
+#endif
   std::vector<std::shared_ptr<ArgMax1Plugin>> argmax_plugins_;
   std::vector<std::shared_ptr<SoftmaxPlugin>> softmax_plugins_;
   std::vector<std::shared_ptr<SLICEPlugin>> slice_plugins_;
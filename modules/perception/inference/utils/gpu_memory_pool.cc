@@ -0,0 +1,159 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/inference/utils/gpu_memory_pool.h"
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+namespace {
+
+// all binding buffers of every co-resident net have to fit here
+constexpr size_t kDefaultArenaSize = 512 << 20;
+// matches the alignment cudaMalloc guarantees
+constexpr size_t kBlockAlignment = 256;
+
+size_t AlignUp(size_t size) {
+  return (size + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment;
+}
+
+}  // namespace
+
+GPUMemoryPool::GPUMemoryPool() : arena_size_(kDefaultArenaSize) {}
+
+void GPUMemoryPool::set_arena_size(size_t arena_size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (arena_ != nullptr) {
+    AWARN << "arena already created, ignore new size: " << arena_size;
+    return;
+  }
+  arena_size_ = arena_size;
+}
+
+void GPUMemoryPool::SetQuota(const std::string& owner, size_t quota_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  owner_quota_[owner] = quota_bytes;
+}
+
+bool GPUMemoryPool::CreateArena() {
+  if (arena_ != nullptr) {
+    return true;
+  }
+  cudaError_t code =
+      cudaMalloc(reinterpret_cast<void**>(&arena_), arena_size_);
+  if (code != cudaSuccess) {
+    AERROR << "Failed to reserve gpu arena of " << arena_size_
+           << " bytes: " << cudaGetErrorString(code);
+    arena_ = nullptr;
+    return false;
+  }
+  AINFO << "Reserved gpu arena of " << arena_size_ << " bytes";
+  return true;
+}
+
+void* GPUMemoryPool::Alloc(size_t size, const std::string& owner) {
+  if (size == 0) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const size_t block_size = AlignUp(size);
+
+  const size_t quota = owner_quota_[owner];
+  if (quota > 0 && owner_used_[owner] + block_size > quota) {
+    AERROR << "owner " << owner << " exceeds gpu quota " << quota
+           << " bytes, used: " << owner_used_[owner]
+           << " bytes, requested: " << block_size << " bytes";
+    return nullptr;
+  }
+
+  Block block;
+  block.size = block_size;
+  block.owner = owner;
+
+  void* ptr = nullptr;
+  auto free_iter = free_blocks_.find(block_size);
+  if (free_iter != free_blocks_.end()) {
+    ptr = free_iter->second;
+    free_blocks_.erase(free_iter);
+    block.from_arena = true;
+  } else if (CreateArena() && arena_offset_ + block_size <= arena_size_) {
+    ptr = arena_ + arena_offset_;
+    arena_offset_ += block_size;
+    block.from_arena = true;
+  } else {
+    AWARN << "gpu arena exhausted, fall back to cudaMalloc for " << block_size
+          << " bytes requested by " << owner;
+    cudaError_t code = cudaMalloc(&ptr, block_size);
+    if (code != cudaSuccess) {
+      AERROR << "cudaMalloc failed for " << block_size
+             << " bytes: " << cudaGetErrorString(code);
+      return nullptr;
+    }
+  }
+
+  allocated_blocks_[ptr] = block;
+  owner_used_[owner] += block_size;
+  owner_high_water_[owner] =
+      std::max(owner_high_water_[owner], owner_used_[owner]);
+  total_used_ += block_size;
+  high_water_ = std::max(high_water_, total_used_);
+  return ptr;
+}
+
+void GPUMemoryPool::Free(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = allocated_blocks_.find(ptr);
+  if (iter == allocated_blocks_.end()) {
+    AWARN << "free of unknown gpu block, pass through to cudaFree";
+    cudaFree(ptr);
+    return;
+  }
+  const Block& block = iter->second;
+  owner_used_[block.owner] -= block.size;
+  total_used_ -= block.size;
+  if (block.from_arena) {
+    free_blocks_.insert({block.size, ptr});
+  } else {
+    cudaFree(ptr);
+  }
+  allocated_blocks_.erase(iter);
+}
+
+void GPUMemoryPool::PrintStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  AINFO << "gpu pool used: " << total_used_ << " bytes, high water: "
+        << high_water_ << " bytes, arena: " << arena_offset_ << "/"
+        << arena_size_ << " bytes";
+  for (auto& owner_usage : owner_high_water_) {
+    AINFO << "gpu pool owner " << owner_usage.first
+          << " used: " << owner_used_[owner_usage.first]
+          << " bytes, high water: " << owner_usage.second << " bytes";
+  }
+}
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
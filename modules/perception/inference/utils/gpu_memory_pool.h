@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+// Process-wide pool for long-lived device buffers shared by all inference
+// instances on one GPU. Blocks are carved from a single reserved arena with
+// a bump pointer and recycled through a size-keyed free list, so repeated
+// net setup/teardown with camera, lidar and prediction models co-resident
+// neither fragments the device heap nor stalls in cudaMalloc mid-drive.
+// When the arena is exhausted the pool falls back to plain cudaMalloc with
+// a warning, preserving the old behavior.
+//
+// Callers must ensure no kernel still uses a block when it is freed; the
+// net wrappers only free at teardown after their stream is destroyed.
+class GPUMemoryPool {
+ public:
+  // Only effective before the arena is created by the first Alloc.
+  void set_arena_size(size_t arena_size);
+
+  // Per-owner budget in bytes; zero (the default) means unlimited. Alloc
+  // returns nullptr once an owner would exceed its quota.
+  void SetQuota(const std::string& owner, size_t quota_bytes);
+
+  void* Alloc(size_t size, const std::string& owner);
+
+  void Free(void* ptr);
+
+  // Log current and high-water usage, total and per owner.
+  void PrintStats();
+
+ private:
+  struct Block {
+    size_t size = 0;
+    std::string owner;
+    bool from_arena = false;
+  };
+
+  // must be called with mutex_ held
+  bool CreateArena();
+
+  std::mutex mutex_;
+  size_t arena_size_;
+  char* arena_ = nullptr;
+  size_t arena_offset_ = 0;
+  std::map<void*, Block> allocated_blocks_;
+  std::multimap<size_t, void*> free_blocks_;
+  std::map<std::string, size_t> owner_used_;
+  std::map<std::string, size_t> owner_high_water_;
+  std::map<std::string, size_t> owner_quota_;
+  size_t total_used_ = 0;
+  size_t high_water_ = 0;
+
+  DECLARE_SINGLETON(GPUMemoryPool)
+};
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
@@ -158,6 +158,102 @@ __global__ void resize_linear_kernel_mean(const unsigned char *src,
   }
 }
 
+__global__ void remap_resize_linear_kernel_mean(const unsigned char *src,
+                                                float *dst,
+                                                const float *map_x,
+                                                const float *map_y,
+                                                int channel,
+                                                int height,
+                                                int width,
+                                                int stepwidth,
+                                                int roi_x,
+                                                int roi_y,
+                                                int dst_height,
+                                                int dst_width,
+                                                float fx,
+                                                float fy,
+                                                float mean_b,
+                                                float mean_g,
+                                                float mean_r,
+                                                bool channel_axis,
+                                                float scale) {
+  const int dst_x = blockDim.x * blockIdx.x + threadIdx.x;
+  const int dst_y = blockDim.y * blockIdx.y + threadIdx.y;
+  if (dst_x < dst_width && dst_y < dst_height) {
+    // position of the output pixel inside the undistorted image
+    float und_x = roi_x + (dst_x + 0.5) * fx - 0.5;
+    float und_y = roi_y + (dst_y + 0.5) * fy - 0.5;
+    const int ux1 = __float2int_rd(und_x);
+    const int uy1 = __float2int_rd(und_y);
+    const int ux1_read = max(ux1, 0);
+    const int uy1_read = max(uy1, 0);
+    const int ux2 = ux1 + 1;
+    const int uy2 = uy1 + 1;
+    const int ux2_read = min(ux2, width - 1);
+    const int uy2_read = min(uy2, height - 1);
+    // interpolate the remap tables to fuse the undistortion into the
+    // resize: the result is the source position in the distorted image
+    float w11 = (ux2 - und_x) * (uy2 - und_y);
+    float w12 = (und_x - ux1) * (uy2 - und_y);
+    float w21 = (ux2 - und_x) * (und_y - uy1);
+    float w22 = (und_x - ux1) * (und_y - uy1);
+    int map11 = uy1_read * width + ux1_read;
+    int map12 = uy1_read * width + ux2_read;
+    int map21 = uy2_read * width + ux1_read;
+    int map22 = uy2_read * width + ux2_read;
+    float src_x = w11 * map_x[map11] + w12 * map_x[map12] +
+                  w21 * map_x[map21] + w22 * map_x[map22];
+    float src_y = w11 * map_y[map11] + w12 * map_y[map12] +
+                  w21 * map_y[map21] + w22 * map_y[map22];
+    const int x1 = __float2int_rd(src_x);
+    const int y1 = __float2int_rd(src_y);
+    const int x1_read = max(x1, 0);
+    const int y1_read = max(y1, 0);
+    const int x2 = x1 + 1;
+    const int y2 = y1 + 1;
+    const int x2_read = min(x2, width - 1);
+    const int y2_read = min(y2, height - 1);
+    int src_reg = 0;
+    for (int c = 0; c < channel; c++) {
+      float out = 0;
+
+      int idx11 = (y1_read * stepwidth + x1_read) * channel;
+      src_reg = src[idx11 + c];
+      out = out + (x2 - src_x) * (y2 - src_y) * src_reg;
+      int idx12 = (y1_read * stepwidth + x2_read) * channel;
+      src_reg = src[idx12 + c];
+      out = out + src_reg * (src_x - x1) * (y2 - src_y);
+
+      int idx21 = (y2_read * stepwidth + x1_read) * channel;
+      src_reg = src[idx21 + c];
+      out = out + src_reg * (x2 - src_x) * (src_y - y1);
+
+      int idx22 = (y2_read * stepwidth + x2_read) * channel;
+      src_reg = src[idx22 + c];
+      out = out + src_reg * (src_x - x1) * (src_y - y1);
+      if (out < 0) {
+        out = 0;
+      }
+      if (out > 255) {
+        out = 255;
+      }
+      int dst_idx;
+      if (channel_axis) {
+        dst_idx = (dst_y * dst_width + dst_x) * channel + c;
+      } else {
+        dst_idx = (c * dst_height + dst_y) * dst_width + dst_x;
+      }
+      if (c == 0) {
+        dst[dst_idx] = (out - mean_b) * scale;
+      } else if (c == 1) {
+        dst[dst_idx] = (out - mean_g) * scale;
+      } else if (c == 2) {
+        dst[dst_idx] = (out - mean_r) * scale;
+      }
+    }
+  }
+}
+
 bool ResizeGPU(const base::Image8U &src,
                std::shared_ptr<apollo::perception::base::Blob<float> > dst,
                int stepwidth,
@@ -277,6 +373,59 @@ bool ResizeGPU(const base::Image8U &src,
   return true;
 }
 
+bool RemapResizeGPU(const base::Image8U &src,
+                    std::shared_ptr<apollo::perception::base::Blob<float> > dst,
+                    int stepwidth,
+                    int start_axis,
+                    const base::Blob<float> &map_x,
+                    const base::Blob<float> &map_y,
+                    const base::RectI &roi,
+                    float mean_b,
+                    float mean_g,
+                    float mean_r,
+                    bool channel_axis,
+                    float scale) {
+  int width = dst->shape(2);
+  int height = dst->shape(1);
+  int channel = dst->shape(3);
+  int origin_channel = src.channels();
+  int origin_height = src.rows();
+  int origin_width = src.cols();
+
+  if (!channel_axis) {
+    // channel_axis: false
+    // SRC: 1 H W C
+    // DST: 1 C H W
+    width = dst->shape(3);
+    height = dst->shape(2);
+    channel = dst->shape(1);
+  }
+  // channel_axis: true
+  // SRC: 1 H W C
+  // DST: 1 H W C
+  if (origin_channel != channel) {
+    AERROR << "channel should be the same after resize.";
+    return false;
+  }
+  if (map_x.shape(0) != origin_height || map_x.shape(1) != origin_width) {
+    AERROR << "remap tables should match the source image size.";
+    return false;
+  }
+
+  float fx = static_cast<float>(roi.width) / static_cast<float>(width);
+  float fy = static_cast<float>(roi.height) / static_cast<float>(height);
+  const dim3 block(32, 8);
+  const dim3 grid(divup(width, block.x), divup(height, block.y));
+
+  remap_resize_linear_kernel_mean << < grid, block >> >
+      (src.gpu_data(), dst->mutable_gpu_data() + dst->offset(start_axis),
+          map_x.gpu_data(), map_y.gpu_data(),
+          origin_channel, origin_height, origin_width,
+          stepwidth, roi.x, roi.y, height, width, fx, fy,
+          mean_b, mean_g, mean_r, channel_axis, scale);
+  return true;
+}
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
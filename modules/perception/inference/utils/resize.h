@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "modules/perception/base/blob.h"
+#include "modules/perception/base/box.h"
 #include "modules/perception/base/image.h"
 
 namespace apollo {
@@ -39,6 +40,18 @@ bool ResizeGPU(const base::Image8U &src,
                int stepwidth, int start_axis, float mean_b, float mean_g,
                float mean_r, bool channel_axis, float scale);
 
+// fused undistortion + resize + normalization + packing in one kernel:
+// map_x/map_y are the gpu resident remap tables of the source camera, roi
+// selects the undistorted region to resize from and the output is written
+// to the inference input blob directly (NHWC or NCHW per channel_axis)
+bool RemapResizeGPU(const base::Image8U &src,
+                    std::shared_ptr<apollo::perception::base::Blob<float>> dst,
+                    int stepwidth, int start_axis,
+                    const base::Blob<float> &map_x,
+                    const base::Blob<float> &map_y, const base::RectI &roi,
+                    float mean_b, float mean_g, float mean_r,
+                    bool channel_axis, float scale);
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/lib/utils/perf_stats.h"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+namespace {
+
+double Mean(const std::vector<uint64_t>& samples) {
+  if (samples.empty()) {
+    return 0.0;
+  }
+  uint64_t sum = std::accumulate(samples.begin(), samples.end(), 0ull);
+  return static_cast<double>(sum) / static_cast<double>(samples.size());
+}
+
+}  // namespace
+
+PerfStats::PerfStats() {}
+
+void PerfStats::Add(const std::string& name, uint64_t elapsed_ms) {
+  if (!enabled_) {
+    return;
+  }
+  MutexLock lock(&mutex_);
+  stats_[name].push_back(elapsed_ms);
+}
+
+void PerfStats::PrintStats() {
+  MutexLock lock(&mutex_);
+  for (auto& stat : stats_) {
+    std::vector<uint64_t> samples = stat.second;
+    if (samples.empty()) {
+      continue;
+    }
+    std::sort(samples.begin(), samples.end());
+    const size_t p95_index =
+        std::min(samples.size() - 1, samples.size() * 95 / 100);
+    AINFO << "STAGE " << stat.first << " samples: " << samples.size()
+          << " min: " << samples.front() << " ms"
+          << " mean: " << Mean(samples) << " ms"
+          << " p95: " << samples[p95_index] << " ms"
+          << " max: " << samples.back() << " ms";
+  }
+}
+
+bool PerfStats::WriteBaseline(const std::string& file_path) {
+  MutexLock lock(&mutex_);
+  std::ofstream fout(file_path);
+  if (!fout.is_open()) {
+    AERROR << "Failed to open baseline file: " << file_path;
+    return false;
+  }
+  for (auto& stat : stats_) {
+    fout << stat.first << " " << stat.second.size() << " " << Mean(stat.second)
+         << std::endl;
+  }
+  return true;
+}
+
+bool PerfStats::CompareWithBaseline(const std::string& file_path) {
+  std::ifstream fin(file_path);
+  if (!fin.is_open()) {
+    AERROR << "Failed to open baseline file: " << file_path;
+    return false;
+  }
+  std::map<std::string, double> baseline_mean;
+  std::string name;
+  size_t sample_num = 0;
+  double mean_ms = 0.0;
+  while (fin >> name >> sample_num >> mean_ms) {
+    baseline_mean[name] = mean_ms;
+  }
+
+  MutexLock lock(&mutex_);
+  for (auto& stat : stats_) {
+    const double mean = Mean(stat.second);
+    auto iter = baseline_mean.find(stat.first);
+    if (iter == baseline_mean.end()) {
+      AINFO << "STAGE " << stat.first << " mean: " << mean
+            << " ms, not in baseline";
+      continue;
+    }
+    AINFO << "STAGE " << stat.first << " mean: " << mean
+          << " ms, baseline: " << iter->second
+          << " ms, diff: " << mean - iter->second << " ms";
+  }
+  return true;
+}
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
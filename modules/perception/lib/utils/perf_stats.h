@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/perception/lib/thread/mutex.h"
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+// Aggregates the elapsed times reported by Timer::End into per-name
+// distributions. Collection is disabled by default so the online pipeline
+// keeps its log-only timers; offline benchmark tools switch it on to get
+// per-stage statistics over a frame corpus and to diff against a stored
+// baseline.
+class PerfStats {
+ public:
+  void set_enabled(bool enabled) { enabled_ = enabled; }
+
+  bool enabled() const { return enabled_; }
+
+  void Add(const std::string& name, uint64_t elapsed_ms);
+
+  // Log min/mean/p95/max over all collected samples of every stage.
+  void PrintStats();
+
+  // Write "name sample_num mean_ms" lines, one stage per line.
+  bool WriteBaseline(const std::string& file_path);
+
+  // Log the mean time of every stage against a file written by
+  // WriteBaseline, return false when the file cannot be read.
+  bool CompareWithBaseline(const std::string& file_path);
+
+ private:
+  bool enabled_ = false;
+  Mutex mutex_;
+  std::map<std::string, std::vector<uint64_t>> stats_;
+
+  DECLARE_SINGLETON(PerfStats)
+};
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
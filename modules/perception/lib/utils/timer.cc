@@ -17,6 +17,7 @@
 #include <sys/time.h>
 
 #include "cyber/common/log.h"
+#include "modules/perception/lib/utils/perf_stats.h"
 #include "modules/perception/lib/utils/timer.h"
 
 namespace apollo {
@@ -39,6 +40,7 @@ uint64_t Timer::End(const string &msg) {
   uint64_t elapsed_time = end_time_ - start_time_;
 
   ADEBUG << "TIMER " << msg << " elapsed_time: " << elapsed_time << " ms";
+  PerfStats::Instance()->Add(msg, elapsed_time);
 
   // start new timer.
   start_time_ = end_time_;
@@ -15,8 +15,12 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
+
+#include "cyber/base/concurrent_object_pool.h"
 #include "modules/perception/base/concurrent_object_pool.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
+#include "modules/perception/lidar/common/lidar_log.h"
 
 namespace apollo {
 namespace perception {
@@ -32,6 +36,36 @@ typedef base::ConcurrentObjectPool<LidarFrame, kLidarFramePoolSize,
                                    LidarFrameInitializer>
     LidarFramePool;
 
+// @brief lock-free frame pool for single-producer sensor pipelines,
+// backed by cyber::base::CCObjectPool. Each component owns one instance
+// so pipelines of different sensors never contend on the mutex of the
+// global LidarFramePool. A frame cycles through three states: filling
+// while the producer holds the only reference, inflight while it rides
+// in an output message, and consumed when the last downstream reader
+// drops its reference, which pushes the frame back onto the free list.
+class CCLidarFramePool {
+ public:
+  explicit CCLidarFramePool(
+      uint32_t size = static_cast<uint32_t>(kLidarFramePoolSize)) {
+    pool_.reset(new cyber::base::CCObjectPool<LidarFrame>(size, true));
+    pool_->ConstructAll();
+  }
+
+  std::shared_ptr<LidarFrame> Get() {
+    std::shared_ptr<LidarFrame> frame = pool_->GetObject();
+    if (frame == nullptr) {
+      AWARN << "Lock-free lidar frame pool is exhausted, "
+            << "fall back to heap allocation.";
+      frame.reset(new LidarFrame);
+    }
+    frame->Reset();
+    return frame;
+  }
+
+ private:
+  std::shared_ptr<cyber::base::CCObjectPool<LidarFrame>> pool_;
+};
+
 }  // namespace lidar
 }  // namespace perception
 }  // namespace apollo
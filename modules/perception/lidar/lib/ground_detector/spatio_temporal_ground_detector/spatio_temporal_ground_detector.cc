@@ -60,6 +60,7 @@ bool SpatioTemporalGroundDetector::Init(
   param_->roi_region_rad_z = config_params.roi_rad_z();
   param_->nr_grids_coarse = config_params.grid_size();
   param_->nr_smooth_iter = config_params.nr_smooth_iter();
+  param_->nr_ground_height_threads = config_params.nr_ground_height_threads();
 
   pfdetector_ = new common::PlaneFitGroundDetector(*param_);
   pfdetector_->Init();
@@ -41,11 +41,35 @@ bool MapManager::Init(const MapManagerInitOptions& options) {
   CHECK(cyber::common::GetProtoFromFile(config_file, &config));
   update_pose_ = config.update_pose();
   roi_search_distance_ = config.roi_search_distance();
+  prefetch_roi_ = config.prefetch_roi();
+  prefetch_time_ahead_ = config.prefetch_time_ahead();
+  prefetch_distance_tolerance_ = config.prefetch_distance_tolerance();
   hdmap_input_ = map::HDMapInput::Instance();
   if (!hdmap_input_->Init()) {
     AINFO << "Failed to init hdmap input.";
     return false;
   }
+  if (prefetch_roi_) {
+    prefetch_worker_.Bind([this]() {
+      base::PointD point;
+      point.x = prefetch_x_.load(std::memory_order_acquire);
+      point.y = prefetch_y_.load(std::memory_order_acquire);
+      point.z = prefetch_z_.load(std::memory_order_acquire);
+      std::shared_ptr<RoiCache> cache(new RoiCache);
+      cache->center = point;
+      cache->hdmap_struct.reset(new base::HdmapStruct);
+      if (hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
+                                          cache->hdmap_struct)) {
+        std::atomic_store_explicit(
+            &roi_cache_, std::shared_ptr<const RoiCache>(cache),
+            std::memory_order_release);
+      } else {
+        AINFO << "Failed to prefetch roi from hdmap.";
+      }
+      return true;
+    });
+    prefetch_worker_.Start();
+  }
   return true;
 }
 
@@ -70,6 +94,24 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
   point.x = frame->lidar2world_pose.translation()(0);
   point.y = frame->lidar2world_pose.translation()(1);
   point.z = frame->lidar2world_pose.translation()(2);
+  if (prefetch_roi_) {
+    std::shared_ptr<const RoiCache> cache = std::atomic_load_explicit(
+        &roi_cache_, std::memory_order_acquire);
+    bool hit = false;
+    if (cache != nullptr) {
+      const double diff_x = cache->center.x - point.x;
+      const double diff_y = cache->center.y - point.y;
+      hit = diff_x * diff_x + diff_y * diff_y <
+            prefetch_distance_tolerance_ * prefetch_distance_tolerance_;
+    }
+    if (hit) {
+      frame->hdmap_struct = cache->hdmap_struct;
+      SchedulePrefetch(frame->lidar2world_pose, frame->timestamp);
+      return true;
+    }
+    // cache missing or pose drifted too far from the predicted center,
+    // fall through to the synchronous query
+  }
   if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
                                        frame->hdmap_struct)) {
     frame->hdmap_struct->road_polygons.clear();
@@ -78,8 +120,29 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
     frame->hdmap_struct->junction_polygons.clear();
     AINFO << "Failed to get roi from hdmap.";
   }
+  if (prefetch_roi_) {
+    SchedulePrefetch(frame->lidar2world_pose, frame->timestamp);
+  }
   return true;
 }
+
+void MapManager::SchedulePrefetch(const Eigen::Affine3d& pose,
+                                  double timestamp) {
+  const Eigen::Vector3d position = pose.translation();
+  Eigen::Vector3d predicted = position;
+  if (has_last_position_ && timestamp > last_timestamp_) {
+    const Eigen::Vector3d velocity =
+        (position - last_position_) / (timestamp - last_timestamp_);
+    predicted += velocity * prefetch_time_ahead_;
+  }
+  last_position_ = position;
+  last_timestamp_ = timestamp;
+  has_last_position_ = true;
+  prefetch_x_.store(predicted(0), std::memory_order_release);
+  prefetch_y_.store(predicted(1), std::memory_order_release);
+  prefetch_z_.store(predicted(2), std::memory_order_release);
+  prefetch_worker_.WakeUp();
+}
 bool MapManager::QueryPose(Eigen::Affine3d* sensor2world_pose) const {
   // TODO(...): map-based aligment to refine pose
   return false;
@@ -15,11 +15,14 @@
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <string>
 
 #include "gtest/gtest_prod.h"
 
 #include "modules/perception/base/hdmap_struct.h"
+#include "modules/perception/lib/thread/thread_worker.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 #include "modules/perception/map/hdmap/hdmap_input.h"
 
@@ -50,12 +53,40 @@ class MapManager {
 
   std::string Name() const { return "MapManager"; }
 
+ private:
+  // @brief: ROI prefetched around an extrapolated pose, published by the
+  // prefetch worker and consumed by Update with a lock-free swap-read
+  struct RoiCache {
+    base::PointD center;
+    std::shared_ptr<base::HdmapStruct> hdmap_struct;
+  };
+
+  // @brief: extrapolate pose prefetch_time_ahead_ seconds forward and
+  // wake up the prefetch worker to pull the ROI for the predicted region
+  void SchedulePrefetch(const Eigen::Affine3d& pose, double timestamp);
+
  private:
   LidarFrame* cached_frame_ = nullptr;
   map::HDMapInput* hdmap_input_ = nullptr;
   // params
   bool update_pose_ = false;
   double roi_search_distance_ = 80.0;
+  bool prefetch_roi_ = false;
+  double prefetch_time_ahead_ = 0.2;
+  double prefetch_distance_tolerance_ = 20.0;
+
+  // prefetch thread and its double-buffered output, the worker fills a
+  // fresh back buffer and publishes it atomically while consumers keep
+  // references to the previously published one
+  lib::ThreadWorker prefetch_worker_;
+  std::shared_ptr<const RoiCache> roi_cache_;
+  std::atomic<double> prefetch_x_{0.0};
+  std::atomic<double> prefetch_y_{0.0};
+  std::atomic<double> prefetch_z_{0.0};
+  // pose history for constant velocity extrapolation, Update thread only
+  Eigen::Vector3d last_position_;
+  double last_timestamp_ = 0.0;
+  bool has_last_position_ = false;
 
   FRIEND_TEST(LidarLibMapManagerTest, lidar_map_manager_test);
 };  // class MapManager
@@ -16,9 +16,10 @@
 #include "modules/perception/lidar/lib/object_builder/object_builder.h"
 
 #include <algorithm>
+#include <cmath>
+#include <utility>
 
 #include "modules/perception/common/geometry/common.h"
-#include "modules/perception/common/geometry/convex_hull_2d.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 // #include "modules/perception/lib/io/protobuf_util.h"
 
@@ -29,6 +30,10 @@ namespace lidar {
 static const float kEpsilon = 1e-6f;
 static const float kEpsilonForSize = 1e-2f;
 static const float kEpsilonForLine = 1e-3f;
+// AABB quantization step (meter) of the polygon reuse cache
+static const float kAabbQuantization = 1e-2f;
+static const size_t kPolygonWorkerNum = 4;
+static const size_t kMinObjectsForParallelBuild = 8;
 using apollo::perception::base::PointD;
 using apollo::perception::base::PointF;
 using ObjectPtr = std::shared_ptr<apollo::perception::base::Object>;
@@ -36,6 +41,18 @@ using PointFCloud = apollo::perception::base::PointCloud<PointF>;
 using PolygonDType = apollo::perception::base::PointCloud<PointD>;
 
 bool ObjectBuilder::Init(const ObjectBuilderInitOptions& options) {
+  if (workers_.empty()) {
+    hulls_.resize(kPolygonWorkerNum);
+    workers_.resize(kPolygonWorkerNum);
+    for (size_t i = 0; i < kPolygonWorkerNum; ++i) {
+      workers_[i].reset(new lib::ThreadWorker);
+      workers_[i]->Bind([this, i]() {
+        BuildPolygons(build_objects_, i);
+        return true;
+      });
+      workers_[i]->Start();
+    }
+  }
   return true;
 }
 
@@ -48,9 +65,28 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
   for (size_t i = 0; i < objects->size(); ++i) {
     if (objects->at(i)) {
       objects->at(i)->id = static_cast<int>(i);
-      ComputePolygon2D(objects->at(i));
     }
   }
+  // rotate the polygon reuse cache: last frame's entries become the
+  // lookup side, this frame's entries are collected afresh
+  std::swap(prev_polygon_cache_, curr_polygon_cache_);
+  curr_polygon_cache_.clear();
+  if (hulls_.empty()) {
+    hulls_.resize(1);
+  }
+  next_object_index_.store(0);
+  build_objects_ = objects;
+  if (!workers_.empty() && objects->size() >= kMinObjectsForParallelBuild) {
+    for (auto& worker : workers_) {
+      worker->WakeUp();
+    }
+    for (auto& worker : workers_) {
+      worker->Join();
+    }
+  } else {
+    BuildPolygons(objects, 0);
+  }
+  build_objects_ = nullptr;
   for (size_t i = 0; i < objects->size(); ++i) {
     ComputePolygonSizeCenter(objects->at(i));
     ComputeOtherObjectInformation(objects->at(i));
@@ -58,7 +94,20 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
   return true;
 }
 
-void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
+void ObjectBuilder::BuildPolygons(std::vector<ObjectPtr>* objects,
+                                  size_t worker_id) {
+  if (objects == nullptr) {
+    return;
+  }
+  size_t i = 0;
+  while ((i = next_object_index_.fetch_add(1)) < objects->size()) {
+    if (objects->at(i)) {
+      ComputePolygon2D(objects->at(i), &hulls_[worker_id]);
+    }
+  }
+}
+
+void ObjectBuilder::ComputePolygon2D(ObjectPtr object, HullType* hull) {
   Eigen::Vector3f min_pt;
   Eigen::Vector3f max_pt;
   PointFCloud& cloud = object->lidar_supplement.cloud;
@@ -67,9 +116,56 @@ void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
     SetDefaultValue(min_pt, max_pt, object);
     return;
   }
+  PolygonCacheEntry entry;
+  for (int i = 0; i < 3; ++i) {
+    entry.quantized_aabb[i] =
+        std::lround(min_pt[i] / kAabbQuantization);
+    entry.quantized_aabb[i + 3] =
+        std::lround(max_pt[i] / kAabbQuantization);
+  }
+  entry.point_num = cloud.size();
+  const uint64_t cache_key = PolygonCacheKey(entry);
+  if (LookupPolygonCache(cache_key, entry, &(object->polygon))) {
+    return;
+  }
   LinePerturbation(&cloud);
-  common::ConvexHull2D<PointFCloud, PolygonDType> hull;
-  hull.GetConvexHull(cloud, &(object->polygon));
+  hull->GetConvexHull(cloud, &(object->polygon));
+  entry.polygon = object->polygon;
+  std::lock_guard<std::mutex> lock(polygon_cache_mutex_);
+  curr_polygon_cache_.emplace(cache_key, std::move(entry));
+}
+
+uint64_t ObjectBuilder::PolygonCacheKey(const PolygonCacheEntry& entry) {
+  // FNV-1a over the quantized AABB and the point count
+  uint64_t hash = 14695981039346656037ULL;
+  auto mix = [&hash](uint64_t value) {
+    hash ^= value;
+    hash *= 1099511628211ULL;
+  };
+  for (int i = 0; i < 6; ++i) {
+    mix(static_cast<uint64_t>(entry.quantized_aabb[i]));
+  }
+  mix(static_cast<uint64_t>(entry.point_num));
+  return hash;
+}
+
+bool ObjectBuilder::LookupPolygonCache(const uint64_t cache_key,
+                                       const PolygonCacheEntry& entry,
+                                       PolygonDType* polygon) {
+  // prev_polygon_cache_ is read-only while the polygon pass runs, so
+  // concurrent finds need no lock; verify the stored key against hash
+  // collisions before reusing the polygon
+  const auto iter = prev_polygon_cache_.find(cache_key);
+  if (iter == prev_polygon_cache_.end() ||
+      iter->second.point_num != entry.point_num ||
+      iter->second.quantized_aabb != entry.quantized_aabb) {
+    return false;
+  }
+  *polygon = iter->second.polygon;
+  // carry the entry forward so a still object keeps hitting next frame
+  std::lock_guard<std::mutex> lock(polygon_cache_mutex_);
+  curr_polygon_cache_.emplace(cache_key, iter->second);
+  return true;
 }
 
 void ObjectBuilder::ComputeOtherObjectInformation(ObjectPtr object) {
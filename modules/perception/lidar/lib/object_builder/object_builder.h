@@ -15,14 +15,20 @@
  *****************************************************************************/
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/perception/base/object.h"
 #include "modules/perception/base/point.h"
 #include "modules/perception/base/point_cloud.h"
+#include "modules/perception/common/geometry/convex_hull_2d.h"
 #include "modules/perception/lib/registerer/registerer.h"
+#include "modules/perception/lib/thread/thread_worker.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 
 namespace apollo {
@@ -53,11 +59,48 @@ class ObjectBuilder {
   std::string Name() const { return "ObjectBuilder"; }
 
  private:
+  using PointFCloud =
+      apollo::perception::base::PointCloud<apollo::perception::base::PointF>;
+  using PolygonDType =
+      apollo::perception::base::PointCloud<apollo::perception::base::PointD>;
+  using HullType = common::ConvexHull2D<PointFCloud, PolygonDType>;
+
+  // @brief: cached polygon of one object, keyed by its quantized
+  //         point cloud AABB, for reuse across consecutive frames.
+  struct PolygonCacheEntry {
+    std::array<int64_t, 6> quantized_aabb;
+    size_t point_num = 0;
+    PolygonDType polygon;
+  };
+
   // @brief: calculate 2d polygon.
   //         and fill the convex hull vertices in object->polygon.
+  //         reuses the hull's internal vertex storage across objects.
   // @param [in/out]: ObjectPtr.
+  // @param [in/out]: hull instance owned by the calling worker.
   void ComputePolygon2D(
-      std::shared_ptr<apollo::perception::base::Object> object);
+      std::shared_ptr<apollo::perception::base::Object> object,
+      HullType* hull);
+
+  // @brief: worker routine, pull object indices until exhausted and
+  //         compute their polygons with the worker's own hull.
+  // @param [in/out]: object array of the frame being built.
+  // @param [in]: worker id, selects the pooled hull instance.
+  void BuildPolygons(
+      std::vector<std::shared_ptr<apollo::perception::base::Object>>* objects,
+      size_t worker_id);
+
+  // @brief: hash the quantized AABB and point count of a cache entry.
+  // @param [in]: cache entry with quantized_aabb and point_num filled.
+  static uint64_t PolygonCacheKey(const PolygonCacheEntry& entry);
+
+  // @brief: copy the polygon cached last frame if the object's AABB
+  //         and point count are unchanged, and carry the entry forward.
+  // @param [in]: cache key and the entry computed for this frame.
+  // @param [out]: polygon, filled only on a verified hit.
+  bool LookupPolygonCache(const uint64_t cache_key,
+                          const PolygonCacheEntry& entry,
+                          PolygonDType* polygon);
 
   // @brief: calculate the size, center of polygon.
   // @param [in/out]: ObjectPtr.
@@ -90,6 +133,22 @@ class ObjectBuilder {
   void GetMinMax3D(const apollo::perception::base::PointCloud<
                        apollo::perception::base::PointF>& cloud,
                    Eigen::Vector3f* min_pt, Eigen::Vector3f* max_pt);
+
+  // persistent workers and per-worker hull instances, so hull vertex
+  // buffers are allocated once and reused frame over frame
+  std::vector<std::unique_ptr<lib::ThreadWorker>> workers_;
+  std::vector<HullType> hulls_;
+
+  // object array and index dispenser of the polygon pass in flight
+  std::vector<std::shared_ptr<apollo::perception::base::Object>>*
+      build_objects_ = nullptr;
+  std::atomic<size_t> next_object_index_{0};
+
+  // prev holds the entries collected last frame and is read-only during
+  // the polygon pass; curr collects this frame under the mutex
+  std::unordered_map<uint64_t, PolygonCacheEntry> prev_polygon_cache_;
+  std::unordered_map<uint64_t, PolygonCacheEntry> curr_polygon_cache_;
+  std::mutex polygon_cache_mutex_;
 };  // class ObjectBuilder
 
 }  // namespace lidar
@@ -102,11 +102,10 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
   }
 
   // transform to local
-  base::PointFCloudPtr cloud_local = base::PointFCloudPool::Instance().Get();
   TransformFrame(frame->cloud, frame->lidar2world_pose, polygons_world_,
-                 &polygons_local_, &cloud_local);
+                 &polygons_local_, &cloud_local_);
 
-  bool ret = FilterWithPolygonMask(cloud_local, polygons_local_,
+  bool ret = FilterWithPolygonMask(cloud_local_, polygons_local_,
                                    &(frame->roi_indices));
 
   // set roi points label
@@ -140,7 +139,7 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
 }
 
 bool HdmapROIFilter::FilterWithPolygonMask(
-    const base::PointFCloudPtr& cloud,
+    const base::PlanarPointFCloud& cloud,
     const std::vector<PolygonDType>& map_polygons,
     base::PointIndices* roi_indices) {
   std::vector<Polygon<double>> raw_polygons;
@@ -184,7 +183,7 @@ void HdmapROIFilter::TransformFrame(
     const base::PointFCloudPtr& cloud, const Eigen::Affine3d& vel_pose,
     const std::vector<PolygonDType*>& polygons_world,
     std::vector<PolygonDType>* polygons_local,
-    base::PointFCloudPtr* cloud_local) {
+    base::PlanarPointFCloud* cloud_local) {
   Eigen::Vector3d vel_location = vel_pose.translation();
   Eigen::Matrix3d vel_rot = vel_pose.linear();
   Eigen::Vector3d x_axis = vel_rot.row(0);
@@ -203,30 +202,31 @@ void HdmapROIFilter::TransformFrame(
     }
   }
 
-  // transform cloud
-  (*cloud_local)->clear();
-  (*cloud_local)->resize(cloud->size());
-  for (size_t i = 0; i < (*cloud_local)->size(); ++i) {
+  // transform cloud into planar storage, one contiguous array per axis
+  cloud_local->resize(cloud->size());
+  std::vector<float>& local_x = *cloud_local->mutable_points_x();
+  std::vector<float>& local_y = *cloud_local->mutable_points_y();
+  for (size_t i = 0; i < cloud->size(); ++i) {
     const auto& pt = cloud->at(i);
-    auto& local_pt = (*cloud_local)->at(i);
     Eigen::Vector3d e_pt(pt.x, pt.y, pt.z);
-    local_pt.x = static_cast<float>(x_axis.dot(e_pt));
-    local_pt.y = static_cast<float>(y_axis.dot(e_pt));
+    local_x[i] = static_cast<float>(x_axis.dot(e_pt));
+    local_y[i] = static_cast<float>(y_axis.dot(e_pt));
   }
 }
 
-bool HdmapROIFilter::Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
+bool HdmapROIFilter::Bitmap2dFilter(const base::PlanarPointFCloud& in_cloud,
                                     const Bitmap2D& bitmap,
                                     base::PointIndices* roi_indices) {
   if (!bitmap.Check(Eigen::Vector2d(0.0, 0.0))) {
     AWARN << " Car is not in roi!!.";
     return false;
   }
+  const std::vector<float>& xs = in_cloud.points_x();
+  const std::vector<float>& ys = in_cloud.points_y();
   roi_indices->indices.clear();
-  roi_indices->indices.reserve(in_cloud->size());
-  for (size_t i = 0; i < in_cloud->size(); ++i) {
-    const auto& pt = in_cloud->at(i);
-    Eigen::Vector2d e_pt(pt.x, pt.y);
+  roi_indices->indices.reserve(in_cloud.size());
+  for (size_t i = 0; i < in_cloud.size(); ++i) {
+    Eigen::Vector2d e_pt(xs[i], ys[i]);
     if (!bitmap.IsExists(e_pt)) {
       continue;
     }
@@ -49,14 +49,14 @@ class HdmapROIFilter : public BaseROIFilter {
                       const Eigen::Affine3d& vel_pose,
                       const std::vector<base::PolygonDType*>& polygons_world,
                       std::vector<base::PolygonDType>* polygons_local,
-                      base::PointFCloudPtr* cloud_local);
+                      base::PlanarPointFCloud* cloud_local);
 
   bool FilterWithPolygonMask(
-      const base::PointFCloudPtr& cloud,
+      const base::PlanarPointFCloud& cloud,
       const std::vector<base::PolygonDType>& map_polygons,
       base::PointIndices* roi_indices);
 
-  bool Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
+  bool Bitmap2dFilter(const base::PlanarPointFCloud& in_cloud,
                       const Bitmap2D& bitmap, base::PointIndices* roi_indices);
 
   // parameters for polygons scans convert
@@ -67,6 +67,9 @@ class HdmapROIFilter : public BaseROIFilter {
   bool set_roi_service_ = false;
   std::vector<base::PolygonDType*> polygons_world_;
   std::vector<base::PolygonDType> polygons_local_;
+  // structure-of-arrays local cloud, reused across frames; the bitmap
+  // check only reads x and y so each lives in its own contiguous array
+  base::PlanarPointFCloud cloud_local_;
   Bitmap2D bitmap_;
   ROIServiceContent roi_service_content_;
 
@@ -49,6 +49,17 @@ void SppEngine::Init(size_t width, size_t height, float range,
     return true;
   });
   worker_.Start();
+  // bind cluster statistics worker; the class probability pass is the
+  // heaviest per-cluster traversal (class_num scans of every pixel) and
+  // writes only class_prob/type, so it can run in parallel with the
+  // heading and top-z passes
+  stats_worker_.Bind([&]() {
+    if (data_.class_prob_data != nullptr) {
+      labels_2d_.CalculateClusterClass(data_.class_prob_data, data_.class_num);
+    }
+    return true;
+  });
+  stats_worker_.Start();
 }
 
 size_t SppEngine::ProcessConnectedComponentCluster(
@@ -74,15 +85,14 @@ size_t SppEngine::ProcessConnectedComponentCluster(
                             data_.confidence_threshold,
                             data_.objectness_threshold);
   double filter_time = timer.toc(true);
-  if (data_.class_prob_data != nullptr) {
-    labels_2d_.CalculateClusterClass(data_.class_prob_data, data_.class_num);
-  }
+  stats_worker_.WakeUp();
   if (data_.heading_data != nullptr) {
     labels_2d_.CalculateClusterHeading(data_.heading_data);
   }
   if (data_.z_data != nullptr) {
     labels_2d_.CalculateClusterTopZ(data_.z_data);
   }
+  stats_worker_.Join();
   double chz_time = timer.toc(true);
   // 2. process 2d to 3d
   // first sync between cluster list and label image,
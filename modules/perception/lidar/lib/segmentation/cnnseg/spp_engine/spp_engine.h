@@ -93,6 +93,9 @@ class SppEngine {
   SppData data_;
   // thread worker for sync data
   lib::ThreadWorker worker_;
+  // thread worker for cluster class statistics, overlapped with the
+  // heading and top-z passes which touch disjoint cluster fields
+  lib::ThreadWorker stats_worker_;
 };
 
 }  // namespace lidar
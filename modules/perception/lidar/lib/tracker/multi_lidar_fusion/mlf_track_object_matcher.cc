@@ -16,6 +16,9 @@
 
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_track_object_matcher.h"
 
+#include <cmath>
+#include <unordered_map>
+
 #include "cyber/common/file.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/proto/multi_lidar_fusion_config.pb.h"
@@ -58,6 +61,8 @@ bool MlfTrackObjectMatcher::Init(
 
   bound_value_ = config.bound_value();
   max_match_distance_ = config.max_match_distance();
+  use_gating_grid_ = config.use_gating_grid();
+  gating_distance_ = config.gating_distance();
   return true;
 }
 
@@ -105,10 +110,63 @@ void MlfTrackObjectMatcher::ComputeAssociateMatrix(
     const std::vector<MlfTrackDataPtr> &tracks,
     const std::vector<TrackedObjectPtr> &new_objects,
     common::SecureMat<float> *association_mat) {
+  if (!use_gating_grid_ || gating_distance_ <= 0.f) {
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      for (size_t j = 0; j < new_objects.size(); ++j) {
+        (*association_mat)(i, j) =
+            track_object_distance_->ComputeDistance(new_objects[j], tracks[i]);
+      }
+    }
+    return;
+  }
+  // bucket objects into a uniform grid with gating_distance sized cells,
+  // then evaluate full distance only for pairs within the gate; pairs
+  // outside keep bound_value_ which the gated matchers treat as non-edges,
+  // so association cost scales with local density instead of
+  // tracks * objects
   for (size_t i = 0; i < tracks.size(); ++i) {
     for (size_t j = 0; j < new_objects.size(); ++j) {
-      (*association_mat)(i, j) =
-          track_object_distance_->ComputeDistance(new_objects[j], tracks[i]);
+      (*association_mat)(i, j) = bound_value_;
+    }
+  }
+  auto cell_key = [](int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(y));
+  };
+  const double cell_size = static_cast<double>(gating_distance_);
+  std::unordered_map<uint64_t, std::vector<size_t>> grid;
+  grid.reserve(new_objects.size());
+  for (size_t j = 0; j < new_objects.size(); ++j) {
+    const auto &anchor = new_objects[j]->anchor_point;
+    int x = static_cast<int>(std::floor(anchor(0) / cell_size));
+    int y = static_cast<int>(std::floor(anchor(1) / cell_size));
+    grid[cell_key(x, y)].push_back(j);
+  }
+  const double timestamp = new_objects[0]->object_ptr->latest_tracked_time;
+  const double gate_sqr = cell_size * cell_size;
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    tracks[i]->PredictState(timestamp);
+    const double px = static_cast<double>(tracks[i]->predict_.state(0));
+    const double py = static_cast<double>(tracks[i]->predict_.state(1));
+    const int cx = static_cast<int>(std::floor(px / cell_size));
+    const int cy = static_cast<int>(std::floor(py / cell_size));
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        auto iter = grid.find(cell_key(cx + dx, cy + dy));
+        if (iter == grid.end()) {
+          continue;
+        }
+        for (size_t j : iter->second) {
+          const auto &anchor = new_objects[j]->anchor_point;
+          const double diff_x = anchor(0) - px;
+          const double diff_y = anchor(1) - py;
+          if (diff_x * diff_x + diff_y * diff_y > gate_sqr) {
+            continue;
+          }
+          (*association_mat)(i, j) = track_object_distance_->ComputeDistance(
+              new_objects[j], tracks[i]);
+        }
+      }
     }
   }
 }
@@ -72,6 +72,10 @@ class MlfTrackObjectMatcher {
 
   float bound_value_ = 100.f;
   float max_match_distance_ = 4.0f;
+  // spatial gating over a uniform grid of object positions, pairs outside
+  // the gate keep bound_value_ and skip full distance evaluation
+  bool use_gating_grid_ = true;
+  float gating_distance_ = 30.f;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(MlfTrackObjectMatcher);
@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <sys/resource.h>
+
 #include "Eigen/Dense"
 #include "gflags/gflags.h"
 #include "pcl/io/pcd_io.h"
@@ -30,6 +32,7 @@
 #include "modules/perception/common/point_cloud_processing/common.h"
 #include "modules/perception/common/sensor_manager/sensor_manager.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
+#include "modules/perception/lib/utils/perf_stats.h"
 #include "modules/perception/lidar/app/lidar_obstacle_segmentation.h"
 #include "modules/perception/lidar/app/lidar_obstacle_tracking.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
@@ -45,6 +48,11 @@ DEFINE_double(min_life_time, -1.0, "minimum track time for output");
 DEFINE_bool(use_hdmap, false, "option to enable using hdmap");
 DEFINE_bool(use_tracking_info, false, "option to use tracking info");
 DEFINE_string(sensor_name, "velodyne64", "sensor name");
+DEFINE_bool(stage_stats, false,
+            "option to print per-stage time statistics over the corpus");
+DEFINE_string(perf_baseline, "",
+              "per-stage baseline file, written when absent and "
+              "compared against when present");
 
 namespace apollo {
 namespace perception {
@@ -94,6 +102,10 @@ class OfflineLidarObstaclePerception {
     }
     ADEBUG << "Sensor_name: " << sensor_info_.name;
 
+    if (FLAGS_stage_stats || !FLAGS_perf_baseline.empty()) {
+      lib::PerfStats::Instance()->set_enabled(true);
+    }
+
     return true;
   }
 
@@ -202,6 +214,21 @@ class OfflineLidarObstaclePerception {
       WriteObjectsForNewBenchmark(i, filtered_objects,
                                   output_path + "/" + file_name + ".pcd");
     }
+
+    if (lib::PerfStats::Instance()->enabled()) {
+      lib::PerfStats::Instance()->PrintStats();
+      if (!FLAGS_perf_baseline.empty()) {
+        if (apollo::cyber::common::PathExists(FLAGS_perf_baseline)) {
+          lib::PerfStats::Instance()->CompareWithBaseline(FLAGS_perf_baseline);
+        } else {
+          lib::PerfStats::Instance()->WriteBaseline(FLAGS_perf_baseline);
+        }
+      }
+      struct rusage usage;
+      if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        AINFO << "Peak memory (rss): " << usage.ru_maxrss / 1024 << " MB";
+      }
+    }
   }
 
   bool WriteObjectsForNewBenchmark(size_t frame_id,
@@ -60,6 +60,7 @@ bool FusionComponent::Proc(const std::shared_ptr<SensorFrameMessage>& message) {
                                                        PerceptionObstacles);
   std::shared_ptr<SensorFrameMessage> viz_message(new (std::nothrow)
                                                       SensorFrameMessage);
+  const double start_time = lib::TimeUtil::GetCurrentTime();
   bool status = InternalProc(message, out_message, viz_message);
   if (status == true) {
     // TODO(conver sensor id)
@@ -67,6 +68,18 @@ bool FusionComponent::Proc(const std::shared_ptr<SensorFrameMessage>& message) {
       AINFO << "Fusion receive non " << fusion_main_sensor_
             << " message, skip send.";
     } else {
+      const double cur_time = lib::TimeUtil::GetCurrentTime();
+      auto* latency_stats = out_message->mutable_latency_stats();
+      for (const auto& stage_latency : message->stage_latencies_) {
+        auto* stage = latency_stats->add_stage_latency();
+        stage->set_stage_name(stage_latency.first);
+        stage->set_time_ms(stage_latency.second);
+      }
+      auto* fusion_stage = latency_stats->add_stage_latency();
+      fusion_stage->set_stage_name("sensor_fusion");
+      fusion_stage->set_time_ms((cur_time - start_time) * 1e3);
+      latency_stats->set_total_time_ms((cur_time - message->timestamp_) * 1e3);
+      SetChangeFlags(out_message.get());
       // Send("/apollo/perception/obstacles", out_message);
       writer_->Write(out_message);
       AINFO << "Send fusion processing output message.";
@@ -194,6 +207,57 @@ bool FusionComponent::InternalProc(
   return true;
 }
 
+void FusionComponent::SetChangeFlags(PerceptionObstacles* obstacles) {
+  // An obstacle is unchanged when its position and velocity both stayed
+  // within these thresholds and its classification is the same.
+  constexpr double kPositionChangeThreshold = 0.1;  // meters
+  constexpr double kVelocityChangeThreshold = 0.1;  // meters / second
+  std::map<int, PublishedState> curr_states;
+  for (auto& obstacle : *obstacles->mutable_perception_obstacle()) {
+    uint32_t flags = PerceptionObstacle::CHANGE_NONE;
+    auto iter = published_states_.find(obstacle.id());
+    if (iter == published_states_.end()) {
+      flags |= PerceptionObstacle::CHANGE_NEW;
+    } else {
+      const PublishedState& prev = iter->second;
+      const double dx = obstacle.position().x() - prev.x;
+      const double dy = obstacle.position().y() - prev.y;
+      const double dz = obstacle.position().z() - prev.z;
+      const double dvx = obstacle.velocity().x() - prev.vx;
+      const double dvy = obstacle.velocity().y() - prev.vy;
+      const double dvz = obstacle.velocity().z() - prev.vz;
+      if (dx * dx + dy * dy + dz * dz >
+              kPositionChangeThreshold * kPositionChangeThreshold ||
+          dvx * dvx + dvy * dvy + dvz * dvz >
+              kVelocityChangeThreshold * kVelocityChangeThreshold) {
+        flags |= PerceptionObstacle::CHANGE_POSE;
+      }
+      if (static_cast<int>(obstacle.type()) != prev.type) {
+        flags |= PerceptionObstacle::CHANGE_TYPE;
+      }
+    }
+    obstacle.set_change_flags(flags);
+    if (flags == PerceptionObstacle::CHANGE_NONE) {
+      // Keep diffing against the state at the last flagged change, so the
+      // accumulated drift of a slowly moving obstacle still crosses the
+      // threshold instead of resetting every frame.
+      curr_states[obstacle.id()] = iter->second;
+    } else {
+      curr_states[obstacle.id()] = {
+          obstacle.position().x(), obstacle.position().y(),
+          obstacle.position().z(), obstacle.velocity().x(),
+          obstacle.velocity().y(), obstacle.velocity().z(),
+          static_cast<int>(obstacle.type())};
+    }
+  }
+  for (const auto& prev : published_states_) {
+    if (curr_states.find(prev.first) == curr_states.end()) {
+      obstacles->add_dead_track_id(prev.first);
+    }
+  }
+  published_states_.swap(curr_states);
+}
+
 }  // namespace onboard
 }  // namespace perception
 }  // namespace apollo
@@ -15,6 +15,7 @@
  *****************************************************************************/
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,6 +44,8 @@ class FusionComponent : public cyber::Component<SensorFrameMessage> {
   bool InternalProc(const std::shared_ptr<SensorFrameMessage const>& in_message,
                     std::shared_ptr<PerceptionObstacles> out_message,
                     std::shared_ptr<SensorFrameMessage> viz_message);
+  // Fill change_flags/dead_track_id against the previous publication.
+  void SetChangeFlags(PerceptionObstacles* obstacles);
 
  private:
   static std::mutex s_mutex_;
@@ -53,6 +56,15 @@ class FusionComponent : public cyber::Component<SensorFrameMessage> {
   bool object_in_roi_check_ = false;
   double radius_for_roi_object_check_ = 0;
 
+  // Last published world position, velocity and type per track, used to
+  // derive per-object change flags in the outbound message.
+  struct PublishedState {
+    double x, y, z;
+    double vx, vy, vz;
+    int type;
+  };
+  std::map<int, PublishedState> published_states_;
+
   std::unique_ptr<fusion::ObstacleMultiSensorFusion> fusion_;
   map::HDMapInput* hdmap_input_ = nullptr;
   std::shared_ptr<apollo::cyber::Writer<PerceptionObstacles>> writer_;
@@ -17,6 +17,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cyber/cyber.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
@@ -46,6 +48,10 @@ class LidarFrameMessage {
   ProcessStage process_stage_ = ProcessStage::UNKNOWN_STAGE;
   apollo::common::ErrorCode error_code_ = apollo::common::ErrorCode::OK;
   std::shared_ptr<lidar::LidarFrame> lidar_frame_;
+
+  // (stage name, elapsed ms) appended by each onboard component, carried
+  // downstream until the frame is published.
+  std::vector<std::pair<std::string, double>> stage_latencies_;
 };
 
 }  // namespace onboard
@@ -14,6 +14,10 @@
  * limitations under the License.
  *****************************************************************************/
 #include "modules/perception/onboard/component/radar_detection_component.h"
+
+#include <utility>
+
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/common/sensor_manager/sensor_manager.h"
 #include "modules/perception/lib/utils/perf.h"
 
@@ -53,6 +57,7 @@ bool RadarDetectionComponent::Init() {
   localization_subscriber_.Init(
       odometry_channel_name_,
       odometry_channel_name_ + '_' + comp_config.radar_name());
+  roi_struct_.reset(new base::HdmapStruct);
   return true;
 }
 
@@ -98,7 +103,6 @@ bool RadarDetectionComponent::InternalProc(
     const std::shared_ptr<ContiRadar>& in_message,
     std::shared_ptr<SensorFrameMessage> out_message) {
   PERCEPTION_PERF_FUNCTION_WITH_INDICATOR(radar_info_.name);
-  ContiRadar raw_obstacles = *in_message;
   {
     std::unique_lock<std::mutex> lock(_mutex);
     ++seq_num_;
@@ -112,12 +116,14 @@ bool RadarDetectionComponent::InternalProc(
   PERCEPTION_PERF_BLOCK_START();
   // Init preprocessor_options
   radar::PreprocessorOptions preprocessor_options;
-  ContiRadar corrected_obstacles;
-  radar_preprocessor_->Preprocess(raw_obstacles, preprocessor_options,
-                                  &corrected_obstacles);
+  // Clear keeps the capacity of repeated fields, so the reused message
+  // does not reallocate per frame
+  corrected_obstacles_.Clear();
+  radar_preprocessor_->Preprocess(*in_message, preprocessor_options,
+                                  &corrected_obstacles_);
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(radar_info_.name,
                                            "radar_preprocessor");
-  timestamp = corrected_obstacles.header().timestamp_sec();
+  timestamp = corrected_obstacles_.header().timestamp_sec();
 
   out_message->timestamp_ = timestamp;
   out_message->seq_num_ = seq_num_;
@@ -160,7 +166,11 @@ bool RadarDetectionComponent::InternalProc(
   position.x = radar_trans(0, 3);
   position.y = radar_trans(1, 3);
   position.z = radar_trans(2, 3);
-  options.roi_filter_options.roi.reset(new base::HdmapStruct());
+  roi_struct_->road_polygons.clear();
+  roi_struct_->road_boundary.clear();
+  roi_struct_->hole_polygons.clear();
+  roi_struct_->junction_polygons.clear();
+  options.roi_filter_options.roi = roi_struct_;
   if (FLAGS_obs_enable_hdmap_input) {
     hdmap_input_->GetRoiHDMapStruct(position, radar_forward_distance_,
                                     options.roi_filter_options.roi);
@@ -171,18 +181,18 @@ bool RadarDetectionComponent::InternalProc(
   // Init track_options
   // Init object_builder_options
   std::vector<base::ObjectPtr> radar_objects;
-  if (!radar_perception_->Perceive(corrected_obstacles, options,
+  if (!radar_perception_->Perceive(corrected_obstacles_, options,
                                    &radar_objects)) {
     out_message->error_code_ =
         apollo::common::ErrorCode::PERCEPTION_ERROR_PROCESS;
     AERROR << "RadarDetector Proc failed.";
     return true;
   }
-  out_message->frame_.reset(new base::Frame());
+  out_message->frame_ = base::FramePool::Instance().Get();
   out_message->frame_->sensor_info = radar_info_;
   out_message->frame_->timestamp = timestamp;
   out_message->frame_->sensor2world_pose = radar_trans;
-  out_message->frame_->objects = radar_objects;
+  out_message->frame_->objects = std::move(radar_objects);
 
   const double end_timestamp = lib::TimeUtil::GetCurrentTime();
   const double end_latency =
@@ -21,6 +21,7 @@
 
 #include "cyber/component/component.h"
 #include "modules/localization/proto/localization.pb.h"
+#include "modules/perception/base/hdmap_struct.h"
 #include "modules/perception/base/sensor_meta.h"
 #include "modules/perception/lib/utils/time_util.h"
 #include "modules/perception/map/hdmap/hdmap_input.h"
@@ -82,6 +83,10 @@ class RadarDetectionComponent : public cyber::Component<ContiRadar> {
   TransformWrapper radar2world_trans_;
   TransformWrapper radar2novatel_trans_;
   map::HDMapInput* hdmap_input_;
+  // per-frame buffers reused across messages to avoid reallocation,
+  // Proc of one component instance never runs concurrently
+  ContiRadar corrected_obstacles_;
+  std::shared_ptr<base::HdmapStruct> roi_struct_;
   std::shared_ptr<radar::BasePreprocessor> radar_preprocessor_;
   std::shared_ptr<radar::BaseRadarObstaclePerception> radar_perception_;
   MsgBuffer<LocalizationEstimate> localization_subscriber_;
@@ -51,7 +51,12 @@ bool RecognitionComponent::Proc(
   std::shared_ptr<SensorFrameMessage> out_message =
       std::make_shared<SensorFrameMessage>();
 
+  const double start_time = lib::TimeUtil::GetCurrentTime();
   if (InternalProc(message, out_message)) {
+    out_message->stage_latencies_ = message->stage_latencies_;
+    out_message->stage_latencies_.emplace_back(
+        "lidar_recognition",
+        (lib::TimeUtil::GetCurrentTime() - start_time) * 1e3);
     writer_->Write(out_message);
     AINFO << "Send lidar recognition output message.";
     return true;
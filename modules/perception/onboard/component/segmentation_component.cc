@@ -19,7 +19,6 @@
 #include "modules/perception/lib/utils/perf.h"
 #include "modules/perception/lib/utils/time_util.h"
 #include "modules/perception/lidar/common/lidar_error_code.h"
-#include "modules/perception/lidar/common/lidar_frame_pool.h"
 #include "modules/perception/lidar/common/lidar_log.h"
 #include "modules/perception/onboard/common_flags/common_flags.h"
 
@@ -61,8 +60,12 @@ bool SegmentationComponent::Proc(
   std::shared_ptr<LidarFrameMessage> out_message(new (std::nothrow)
                                                      LidarFrameMessage);
 
+  const double start_time = lib::TimeUtil::GetCurrentTime();
   bool status = InternalProc(message, out_message);
   if (status) {
+    out_message->stage_latencies_.emplace_back(
+        "lidar_segmentation",
+        (lib::TimeUtil::GetCurrentTime() - start_time) * 1e3);
     writer_->Write(out_message);
     AINFO << "Send lidar segment output message.";
   }
@@ -115,7 +118,7 @@ bool SegmentationComponent::InternalProc(
   out_message->error_code_ = apollo::common::ErrorCode::OK;
 
   auto& frame = out_message->lidar_frame_;
-  frame = lidar::LidarFramePool::Instance().Get();
+  frame = frame_pool_.Get();
   frame->cloud = base::PointFCloudPool::Instance().Get();
   frame->timestamp = timestamp;
   frame->sensor_info = sensor_info_;
@@ -22,6 +22,7 @@
 #include "modules/drivers/proto/pointcloud.pb.h"
 #include "modules/perception/lidar/app/lidar_obstacle_segmentation.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
+#include "modules/perception/lidar/common/lidar_frame_pool.h"
 #include "modules/perception/onboard/component/lidar_inner_component_messages.h"
 #include "modules/perception/onboard/proto/lidar_component_config.pb.h"
 #include "modules/perception/onboard/transform_wrapper/transform_wrapper.h"
@@ -55,6 +56,8 @@ class SegmentationComponent : public cyber::Component<drivers::PointCloud> {
   std::string output_channel_name_;
   base::SensorInfo sensor_info_;
   TransformWrapper lidar2world_trans_;
+  // per sensor lock-free frame pool, this component is its only producer
+  lidar::CCLidarFramePool frame_pool_;
   std::unique_ptr<lidar::LidarObstacleSegmentation> segmentor_;
   std::shared_ptr<apollo::cyber::Writer<LidarFrameMessage>> writer_;
 };
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cyber/cyber.h"
 #include "modules/perception/base/frame.h"
@@ -65,6 +67,10 @@ class SensorFrameMessage {
   base::FramePtr frame_;
 
   ProcessStage process_stage_ = ProcessStage::UNKNOWN_STAGE;
+
+  // (stage name, elapsed ms) appended by each onboard component, copied
+  // into PerceptionObstacles.latency_stats when the frame is published.
+  std::vector<std::pair<std::string, double>> stage_latencies_;
 };
 
 }  // namespace onboard
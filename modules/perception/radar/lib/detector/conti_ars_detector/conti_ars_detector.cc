@@ -17,6 +17,8 @@
 
 #include <memory>
 
+#include "modules/perception/base/object_pool_types.h"
+
 namespace apollo {
 namespace perception {
 namespace radar {
@@ -52,8 +54,8 @@ void ContiArsDetector::RawObs2Frame(
   ADEBUG << "radar2novatel: " << radar2novatel;
   ADEBUG << "angular_speed: " << angular_speed;
   ADEBUG << "rotation_radar: " << rotation_radar;
-  for (const auto radar_obs : corrected_obstacles.contiobs()) {
-    base::ObjectPtr radar_object = std::make_shared<base::Object>();
+  for (const auto& radar_obs : corrected_obstacles.contiobs()) {
+    base::ObjectPtr radar_object = base::ObjectPool::Instance().Get();
     radar_object->id = radar_obs.obstacle_id();
     radar_object->track_id = radar_obs.obstacle_id();
     Eigen::Vector4d local_loc(radar_obs.longitude_dist(),
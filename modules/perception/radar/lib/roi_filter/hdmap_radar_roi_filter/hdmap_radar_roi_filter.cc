@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *****************************************************************************/
+#include <utility>
 #include <vector>
 
 #include "modules/perception/radar/lib/roi_filter/hdmap_radar_roi_filter/hdmap_radar_roi_filter.h"
@@ -23,7 +24,8 @@ namespace radar {
 
 bool HdmapRadarRoiFilter::RoiFilter(const RoiFilterOptions& options,
                                     base::FramePtr radar_frame) {
-  std::vector<base::ObjectPtr> origin_objects = radar_frame->objects;
+  std::vector<base::ObjectPtr> origin_objects =
+      std::move(radar_frame->objects);
   return common::ObjectInRoiCheck(options.roi, origin_objects,
                                   &radar_frame->objects);
 }
@@ -26,6 +26,7 @@
 #include "modules/routing/proto/routing.pb.h"
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/math/vec2d.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
@@ -51,6 +52,24 @@ constexpr double kMathEpsilon = 1e-8;
 FrameHistory::FrameHistory()
     : IndexedQueue<uint32_t, Frame>(FLAGS_max_history_frame_num) {}
 
+bool FrameHistory::Add(const uint32_t id, std::unique_ptr<Frame> frame) {
+  if (Find(id)) {
+    return false;
+  }
+  if (capacity_ > 0 && queue_.size() == capacity_) {
+    const uint32_t evicted_id = queue_.front().first;
+    std::shared_ptr<Frame> evicted_frame(std::move(map_[evicted_id]));
+    map_.erase(evicted_id);
+    queue_.pop();
+    // The last reference is released on a task pool worker, so the retired
+    // frame's object graph is destroyed off the planning thread.
+    cyber::Async([evicted_frame]() {});
+  }
+  queue_.push(std::make_pair(id, frame.get()));
+  map_[id] = std::move(frame);
+  return true;
+}
+
 Frame::Frame(uint32_t sequence_num)
     : sequence_num_(sequence_num),
       monitor_logger_buffer_(common::monitor::MonitorMessageItem::PLANNING) {}
@@ -372,6 +391,7 @@ Status Frame::InitFrameData() {
        Obstacle::CreateObstacles(*local_view_.prediction_obstacles)) {
     AddObstacle(*ptr);
   }
+  obstacle_kdtree_.reset(new ObstacleKDTree(obstacles_.Items()));
   if (FLAGS_enable_collision_detection && planning_start_point_.v() < 1e-3) {
     const auto *collision_obstacle = FindCollisionObstacle();
     if (collision_obstacle != nullptr) {
@@ -390,12 +410,13 @@ const Obstacle *Frame::FindCollisionObstacle() const {
     return nullptr;
   }
 
-  const auto &adc_polygon = Polygon2d(EgoInfo::Instance()->ego_box());
-  for (const auto &obstacle : obstacles_.Items()) {
-    if (obstacle->IsVirtual()) {
-      continue;
-    }
-
+  const auto &adc_box = EgoInfo::Instance()->ego_box();
+  const auto &adc_polygon = Polygon2d(adc_box);
+  // Any obstacle polygon overlapping the adc box is within half the box
+  // diagonal of its center; only those need the exact check.
+  const double search_radius = adc_box.diagonal() / 2.0;
+  for (const auto &obstacle :
+       obstacle_kdtree_->GetObstacles(adc_box.center(), search_radius)) {
     const auto &obstacle_polygon = obstacle->PerceptionPolygon();
     if (obstacle_polygon.HasOverlap(adc_polygon)) {
       return obstacle;
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -43,6 +44,7 @@
 #include "modules/planning/common/indexed_queue.h"
 #include "modules/planning/common/local_view.h"
 #include "modules/planning/common/obstacle.h"
+#include "modules/planning/common/obstacle_kdtree.h"
 #include "modules/planning/common/open_space_info.h"
 #include "modules/planning/common/reference_line_info.h"
 #include "modules/planning/common/trajectory/publishable_trajectory.h"
@@ -162,8 +164,26 @@ class Frame {
 
   const LocalView &local_view() const { return local_view_; }
 
+  /**
+   * @brief Absolute Clock timestamp in seconds by which this cycle should
+   * finish; tasks may degrade to their fallback results once it has passed.
+   */
+  double cycle_deadline_timestamp() const { return cycle_deadline_timestamp_; }
+
+  void set_cycle_deadline_timestamp(const double timestamp) {
+    cycle_deadline_timestamp_ = timestamp;
+  }
+
   ThreadSafeIndexedObstacles *GetObstacleList() { return &obstacles_; }
 
+  /**
+   * @brief broad-phase index over this frame's obstacle perception polygons,
+   * shared by all tasks of the cycle. nullptr before Init.
+   */
+  const ObstacleKDTree *obstacle_kdtree() const {
+    return obstacle_kdtree_.get();
+  }
+
   const OpenSpaceInfo &open_space_info() { return *open_space_info_; }
 
   OpenSpaceInfo *mutable_open_space_info() { return open_space_info_.get(); }
@@ -193,6 +213,7 @@ class Frame {
  private:
   uint32_t sequence_num_ = 0;
   LocalView local_view_;
+  double cycle_deadline_timestamp_ = std::numeric_limits<double>::max();
   const hdmap::HDMap *hdmap_ = nullptr;
   common::TrajectoryPoint planning_start_point_;
   common::VehicleState vehicle_state_;
@@ -206,6 +227,7 @@ class Frame {
   const ReferenceLineInfo *drive_reference_line_info_ = nullptr;
 
   ThreadSafeIndexedObstacles obstacles_;
+  std::unique_ptr<ObstacleKDTree> obstacle_kdtree_;
   ChangeLaneDecider change_lane_decider_;
   ADCTrajectory current_frame_planned_trajectory_;  // last published trajectory
 
@@ -224,6 +246,14 @@ class Frame {
 };
 
 class FrameHistory : public IndexedQueue<uint32_t, Frame> {
+ public:
+  /**
+   * @brief Same as IndexedQueue::Add, except the evicted frame is handed to
+   * the task pool for destruction. Tearing down a retired frame's obstacle
+   * and reference line graph is too expensive for the planning loop.
+   */
+  bool Add(const uint32_t id, std::unique_ptr<Frame> frame);
+
  private:
   DECLARE_SINGLETON(FrameHistory)
 };
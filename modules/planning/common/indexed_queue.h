@@ -61,8 +61,9 @@ class IndexedQueue {
     return true;
   }
 
+  // Drop all stored elements; the capacity bound stays in effect so the
+  // queue does not grow without limit after a reset.
   void Clear() {
-    capacity_ = 0;
     while (!queue_.empty()) {
       queue_.pop();
     }
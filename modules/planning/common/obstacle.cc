@@ -19,6 +19,8 @@
  **/
 
 #include <algorithm>
+#include <cmath>
+#include <mutex>
 #include <utility>
 
 #include "cyber/common/log.h"
@@ -43,6 +45,84 @@ namespace {
 const double kStBoundaryDeltaS = 0.2;        // meters
 const double kStBoundarySparseDeltaS = 1.0;  // meters
 const double kStBoundaryDeltaT = 0.05;       // seconds
+
+// Perception polygons of tracked obstacles rarely change shape between
+// cycles; they mostly move rigidly with the obstacle pose. The convex
+// hull of the previous cycle is kept in the obstacle's body frame, so a
+// rigid motion reuses it with one rotate-and-translate per vertex
+// instead of a full hull reconstruction.
+const double kPolygonShapeEpsilon = 0.01;  // meters, per body-frame point
+const size_t kPolygonCacheLimit = 1000;
+
+struct PolygonCacheEntry {
+  std::vector<common::math::Vec2d> local_points;
+  std::vector<common::math::Vec2d> local_hull;
+};
+
+std::mutex polygon_cache_mutex;
+std::unordered_map<int, PolygonCacheEntry> polygon_cache;
+
+bool BuildPolygonWithCache(const int perception_id,
+                           const common::math::Vec2d& position,
+                           const double theta,
+                           const std::vector<common::math::Vec2d>& points,
+                           common::math::Polygon2d* const polygon) {
+  const double cos_theta = std::cos(theta);
+  const double sin_theta = std::sin(theta);
+  std::vector<common::math::Vec2d> local_points;
+  local_points.reserve(points.size());
+  for (const auto& point : points) {
+    const double dx = point.x() - position.x();
+    const double dy = point.y() - position.y();
+    local_points.emplace_back(dx * cos_theta + dy * sin_theta,
+                              -dx * sin_theta + dy * cos_theta);
+  }
+
+  std::lock_guard<std::mutex> lock(polygon_cache_mutex);
+  auto iter = polygon_cache.find(perception_id);
+  if (iter != polygon_cache.end() &&
+      iter->second.local_points.size() == local_points.size()) {
+    bool same_shape = true;
+    for (size_t i = 0; i < local_points.size(); ++i) {
+      if (std::abs(local_points[i].x() - iter->second.local_points[i].x()) >
+              kPolygonShapeEpsilon ||
+          std::abs(local_points[i].y() - iter->second.local_points[i].y()) >
+              kPolygonShapeEpsilon) {
+        same_shape = false;
+        break;
+      }
+    }
+    if (same_shape) {
+      std::vector<common::math::Vec2d> hull_points;
+      hull_points.reserve(iter->second.local_hull.size());
+      for (const auto& point : iter->second.local_hull) {
+        hull_points.emplace_back(
+            position.x() + point.x() * cos_theta - point.y() * sin_theta,
+            position.y() + point.x() * sin_theta + point.y() * cos_theta);
+      }
+      *polygon = common::math::Polygon2d(std::move(hull_points));
+      return true;
+    }
+  }
+
+  if (!common::math::Polygon2d::ComputeConvexHull(points, polygon)) {
+    return false;
+  }
+  if (polygon_cache.size() >= kPolygonCacheLimit) {
+    polygon_cache.clear();
+  }
+  auto& entry = polygon_cache[perception_id];
+  entry.local_points = std::move(local_points);
+  entry.local_hull.clear();
+  entry.local_hull.reserve(polygon->points().size());
+  for (const auto& point : polygon->points()) {
+    const double dx = point.x() - position.x();
+    const double dy = point.y() - position.y();
+    entry.local_hull.emplace_back(dx * cos_theta + dy * sin_theta,
+                                  -dx * sin_theta + dy * cos_theta);
+  }
+  return true;
+}
 }  // namespace
 
 const std::unordered_map<ObjectDecisionType::ObjectTagCase, int,
@@ -82,8 +162,10 @@ Obstacle::Obstacle(const std::string& id,
       polygon_points.emplace_back(point.x(), point.y());
     }
   }
-  CHECK(common::math::Polygon2d::ComputeConvexHull(polygon_points,
-                                                   &perception_polygon_))
+  CHECK(BuildPolygonWithCache(
+      perception_obstacle.id(),
+      {perception_obstacle.position().x(), perception_obstacle.position().y()},
+      perception_obstacle.theta(), polygon_points, &perception_polygon_))
       << "object[" << id << "] polygon is not a valid convex hull.\n"
       << perception_obstacle.DebugString();
 
@@ -100,6 +182,9 @@ Obstacle::Obstacle(const std::string& id,
                    const bool is_static)
     : Obstacle(id, perception_obstacle, obstacle_priority, is_static) {
   trajectory_ = trajectory;
+  if (FLAGS_enable_prediction_trajectory_downsample) {
+    DownsampleTrajectoryPoints(&trajectory_);
+  }
   auto& trajectory_points = *trajectory_.mutable_trajectory_point();
   double cumulative_s = 0.0;
   if (trajectory_points.size() > 0) {
@@ -117,6 +202,144 @@ Obstacle::Obstacle(const std::string& id,
         common::util::DistanceXY(prev.path_point(), cur.path_point());
     trajectory_points[i].mutable_path_point()->set_s(cumulative_s);
   }
+  BuildSampledForecast();
+}
+
+void Obstacle::BuildSampledForecast() {
+  sampled_forecast_ = SampledForecast();
+  const auto& points = trajectory_.trajectory_point();
+  if (points.empty()) {
+    return;
+  }
+  const double resolution = FLAGS_trajectory_time_resolution;
+  const auto num_samples =
+      static_cast<size_t>(FLAGS_trajectory_time_length / resolution) + 1;
+  sampled_forecast_.relative_time.reserve(num_samples);
+  sampled_forecast_.x.reserve(num_samples);
+  sampled_forecast_.y.reserve(num_samples);
+  sampled_forecast_.theta.reserve(num_samples);
+  sampled_forecast_.v.reserve(num_samples);
+
+  if (points.size() < 2) {
+    // mirror the GetPointAtTime fallback: hold the perception pose
+    for (size_t i = 0; i < num_samples; ++i) {
+      sampled_forecast_.relative_time.push_back(resolution *
+                                                static_cast<double>(i));
+      sampled_forecast_.x.push_back(perception_obstacle_.position().x());
+      sampled_forecast_.y.push_back(perception_obstacle_.position().y());
+      sampled_forecast_.theta.push_back(perception_obstacle_.theta());
+      sampled_forecast_.v.push_back(0.0);
+    }
+    sampled_forecast_.num_within_trajectory = 1;
+    return;
+  }
+
+  // single forward sweep over the trajectory instead of one binary search
+  // per query; clamping matches GetPointAtTime
+  const double trajectory_end_time = points.rbegin()->relative_time();
+  int upper = 0;
+  for (size_t i = 0; i < num_samples; ++i) {
+    const double t = resolution * static_cast<double>(i);
+    while (upper < points.size() && points[upper].relative_time() < t) {
+      ++upper;
+    }
+    common::TrajectoryPoint point;
+    if (upper == 0) {
+      point = points[0];
+    } else if (upper == points.size()) {
+      point = points[points.size() - 1];
+    } else {
+      point = common::math::InterpolateUsingLinearApproximation(
+          points[upper - 1], points[upper], t);
+    }
+    sampled_forecast_.relative_time.push_back(t);
+    sampled_forecast_.x.push_back(point.path_point().x());
+    sampled_forecast_.y.push_back(point.path_point().y());
+    sampled_forecast_.theta.push_back(point.path_point().theta());
+    sampled_forecast_.v.push_back(point.v());
+    if (t <= trajectory_end_time) {
+      sampled_forecast_.num_within_trajectory = i + 1;
+    }
+  }
+}
+
+common::math::Box2d Obstacle::GetBoundingBoxAtSample(
+    const size_t index) const {
+  CHECK_LT(index, sampled_forecast_.size());
+  return common::math::Box2d(
+      {sampled_forecast_.x[index], sampled_forecast_.y[index]},
+      sampled_forecast_.theta[index], perception_obstacle_.length(),
+      perception_obstacle_.width());
+}
+
+void Obstacle::DownsampleTrajectoryPoints(prediction::Trajectory* trajectory) {
+  auto& points = *trajectory->mutable_trajectory_point();
+  const int point_num = points.size();
+  if (point_num <= 2) {
+    return;
+  }
+  // max deviation of a dropped point from linear interpolation in time
+  // between the kept neighbors
+  constexpr double kMaxInterpolationError = 0.05;  // meters
+  constexpr double kMaxInterpolationErrorSqr =
+      kMaxInterpolationError * kMaxInterpolationError;
+
+  std::vector<bool> keep(point_num, false);
+  keep.front() = true;
+  keep.back() = true;
+
+  int anchor = 0;
+  while (anchor < point_num - 1) {
+    int next = anchor + 1;
+    // extend the segment while every skipped point stays within tolerance
+    for (int candidate = anchor + 2; candidate < point_num; ++candidate) {
+      const auto& anchor_path = points[anchor].path_point();
+      const auto& candidate_path = points[candidate].path_point();
+      const double time_span = points[candidate].relative_time() -
+                               points[anchor].relative_time();
+      if (time_span <= 0.0) {
+        break;
+      }
+      bool within_tolerance = true;
+      for (int i = anchor + 1; i < candidate; ++i) {
+        const double ratio =
+            (points[i].relative_time() - points[anchor].relative_time()) /
+            time_span;
+        const double dx = anchor_path.x() +
+                          ratio * (candidate_path.x() - anchor_path.x()) -
+                          points[i].path_point().x();
+        const double dy = anchor_path.y() +
+                          ratio * (candidate_path.y() - anchor_path.y()) -
+                          points[i].path_point().y();
+        if (dx * dx + dy * dy > kMaxInterpolationErrorSqr) {
+          within_tolerance = false;
+          break;
+        }
+      }
+      if (!within_tolerance) {
+        break;
+      }
+      next = candidate;
+    }
+    keep[next] = true;
+    anchor = next;
+  }
+
+  int kept_num = 0;
+  for (int i = 0; i < point_num; ++i) {
+    if (!keep[i]) {
+      continue;
+    }
+    if (kept_num != i) {
+      points.SwapElements(kept_num, i);
+    }
+    ++kept_num;
+  }
+  if (kept_num < point_num) {
+    points.DeleteSubrange(kept_num, point_num - kept_num);
+    ADEBUG << "Downsampled prediction trajectory from " << point_num << " to "
+           << kept_num << " points";
+  }
 }
 
 common::TrajectoryPoint Obstacle::GetPointAtTime(
@@ -88,6 +88,41 @@ class Obstacle {
   common::math::Box2d GetBoundingBox(
       const common::TrajectoryPoint& point) const;
 
+  /**
+   * @struct SampledForecast
+   * @brief Flat structure-of-arrays snapshot of the predicted motion, sampled
+   * once on planning's time discretization when the obstacle is created.
+   * Consumers that walk the forecast on that grid (path-time graph,
+   * st-boundary mapping) share these samples instead of re-interpolating the
+   * trajectory per query.
+   */
+  struct SampledForecast {
+    std::vector<double> relative_time;
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> theta;
+    std::vector<double> v;
+    // number of leading samples inside the raw trajectory's time span;
+    // samples after that hold the clamped terminal pose
+    size_t num_within_trajectory = 0;
+
+    size_t size() const { return relative_time.size(); }
+    bool empty() const { return relative_time.empty(); }
+  };
+
+  const SampledForecast& sampled_forecast() const { return sampled_forecast_; }
+
+  /**
+   * @brief Resample the forecast; must be called after the trajectory is
+   * mutated through AddTrajectoryPoint().
+   */
+  void BuildSampledForecast();
+
+  /**
+   * @brief bounding box of the obstacle at a forecast sample
+   */
+  common::math::Box2d GetBoundingBoxAtSample(const size_t index) const;
+
   const common::math::Box2d& PerceptionBoundingBox() const {
     return perception_bounding_box_;
   }
@@ -227,6 +262,13 @@ class Obstacle {
   bool IsValidObstacle(
       const perception::PerceptionObstacle& perception_obstacle);
 
+  // Drop prediction trajectory points that linear interpolation in time
+  // between the kept neighbors reproduces within a few centimeters, so that
+  // straight constant-speed stretches collapse to their end points while
+  // turns and speed changes keep their resolution. GetPointAtTime()
+  // interpolates, so time queries are unaffected.
+  static void DownsampleTrajectoryPoints(prediction::Trajectory* trajectory);
+
  private:
   std::string id_;
   int32_t perception_id_ = 0;
@@ -235,6 +277,7 @@ class Obstacle {
   double speed_ = 0.0;
 
   prediction::Trajectory trajectory_;
+  SampledForecast sampled_forecast_;
   perception::PerceptionObstacle perception_obstacle_;
   common::math::Box2d perception_bounding_box_;
   common::math::Polygon2d perception_polygon_;
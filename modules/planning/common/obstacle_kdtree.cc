@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/common/obstacle_kdtree.h"
+
+#include <cmath>
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::math::AABoxKDTreeParams;
+using apollo::common::math::Vec2d;
+
+namespace {
+
+constexpr double kCacheResolution = 0.01;  // [m]
+
+std::string DistanceCacheKey(const std::string& obstacle_id,
+                             const Vec2d& point) {
+  return obstacle_id + "_" +
+         std::to_string(std::lround(point.x() / kCacheResolution)) + "_" +
+         std::to_string(std::lround(point.y() / kCacheResolution));
+}
+
+}  // namespace
+
+ObstacleKDTree::ObstacleKDTree(const std::vector<const Obstacle*>& obstacles) {
+  object_boxes_.reserve(obstacles.size());
+  for (const auto* obstacle : obstacles) {
+    if (obstacle->IsVirtual() ||
+        obstacle->PerceptionPolygon().num_points() < 3) {
+      continue;
+    }
+    object_boxes_.emplace_back(
+        obstacle->PerceptionPolygon().AABoundingBox(), obstacle,
+        &obstacle->PerceptionPolygon(),
+        static_cast<int>(object_boxes_.size()));
+  }
+  if (object_boxes_.empty()) {
+    return;
+  }
+  AABoxKDTreeParams params;
+  params.max_leaf_dimension = 5.0;  // meters.
+  params.max_leaf_size = 4;
+  kdtree_.reset(new ObstacleAABoxKDTree(object_boxes_, params));
+}
+
+std::vector<const Obstacle*> ObstacleKDTree::GetObstacles(
+    const Vec2d& point, const double distance) const {
+  std::vector<const Obstacle*> obstacles;
+  if (kdtree_ == nullptr) {
+    return obstacles;
+  }
+  const auto boxes = kdtree_->GetObjects(point, distance);
+  obstacles.reserve(boxes.size());
+  for (const auto* box : boxes) {
+    obstacles.push_back(box->object());
+  }
+  return obstacles;
+}
+
+const Obstacle* ObstacleKDTree::GetNearestObstacle(const Vec2d& point) const {
+  if (kdtree_ == nullptr) {
+    return nullptr;
+  }
+  const auto* box = kdtree_->GetNearestObject(point);
+  return box == nullptr ? nullptr : box->object();
+}
+
+double ObstacleKDTree::CachedDistanceTo(const Vec2d& point,
+                                        const Obstacle* obstacle) const {
+  const std::string key = DistanceCacheKey(obstacle->Id(), point);
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    const auto iter = distance_cache_.find(key);
+    if (iter != distance_cache_.end()) {
+      return iter->second;
+    }
+  }
+  const double distance = obstacle->PerceptionPolygon().DistanceTo(point);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  distance_cache_.emplace(key, distance);
+  return distance;
+}
+
+}  // namespace planning
+}  // namespace apollo
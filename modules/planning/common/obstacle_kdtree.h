@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "modules/common/math/aaboxkdtree2d.h"
+#include "modules/common/math/polygon2d.h"
+#include "modules/common/math/vec2d.h"
+#include "modules/map/hdmap/hdmap_common.h"
+#include "modules/planning/common/obstacle.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class ObstacleKDTree
+ * @brief Broad-phase index over the perception polygons of one frame's
+ * obstacles, shared by all tasks of the planning cycle. Built once in
+ * Frame::Init; queries resolve candidate obstacles through an aabox kdtree
+ * so tasks avoid scanning and re-checking every obstacle polygon.
+ *
+ * The index covers perception (current pose) polygons only. Checks against
+ * predicted obstacle poses are time-parameterized and remain with their
+ * respective tasks.
+ */
+class ObstacleKDTree {
+ public:
+  explicit ObstacleKDTree(const std::vector<const Obstacle*>& obstacles);
+
+  /**
+   * @brief obstacles whose perception polygon is within distance of point.
+   */
+  std::vector<const Obstacle*> GetObstacles(const common::math::Vec2d& point,
+                                            const double distance) const;
+
+  /**
+   * @brief the obstacle with the perception polygon nearest to point, or
+   * nullptr when the frame has no polygon obstacles.
+   */
+  const Obstacle* GetNearestObstacle(const common::math::Vec2d& point) const;
+
+  /**
+   * @brief exact distance from point to the obstacle's perception polygon,
+   * memoized by (obstacle id, query point rounded to centimeters) so that
+   * repeated identical queries from different tasks reuse the result.
+   */
+  double CachedDistanceTo(const common::math::Vec2d& point,
+                          const Obstacle* obstacle) const;
+
+ private:
+  using ObstacleAABox =
+      hdmap::ObjectWithAABox<Obstacle, common::math::Polygon2d>;
+  using ObstacleAABoxKDTree = common::math::AABoxKDTree2d<ObstacleAABox>;
+
+  std::vector<ObstacleAABox> object_boxes_;
+  std::unique_ptr<ObstacleAABoxKDTree> kdtree_;
+
+  // narrow-phase cache; mutex guarded since tasks may query concurrently
+  mutable std::unordered_map<std::string, double> distance_cache_;
+  mutable std::mutex cache_mutex_;
+};
+
+}  // namespace planning
+}  // namespace apollo
@@ -20,6 +20,8 @@
 
 #include "modules/planning/common/obstacle.h"
 
+#include <cmath>
+
 #include "cyber/common/file.h"
 #include "gtest/gtest.h"
 
@@ -167,7 +169,60 @@ TEST_F(ObstacleTest, Trajectory) {
   const auto* obstacle = indexed_obstacles_.Find("2156_0");
   ASSERT_TRUE(obstacle);
   const auto& points = obstacle->Trajectory().trajectory_point();
-  EXPECT_EQ(50, points.size());
+  // the 50 prediction points are downsampled at ingestion within an
+  // interpolation error bound of a few centimeters
+  EXPECT_GE(50, points.size());
+  EXPECT_LE(2, points.size());
+}
+
+TEST(Obstacle, DownsampleTrajectoryPoints) {
+  perception::PerceptionObstacle perception_obstacle;
+  perception_obstacle.set_id(1);
+  perception_obstacle.mutable_position()->set_x(0.0);
+  perception_obstacle.mutable_position()->set_y(0.0);
+  perception_obstacle.set_theta(0.0);
+  perception_obstacle.set_length(4.0);
+  perception_obstacle.set_width(2.0);
+  perception_obstacle.set_height(1.5);
+  perception_obstacle.mutable_velocity()->set_x(10.0);
+  perception_obstacle.mutable_velocity()->set_y(0.0);
+
+  // 4 seconds straight at 10 m/s, then 2 seconds on a radius 10 arc
+  prediction::Trajectory trajectory;
+  for (int i = 0; i <= 40; ++i) {
+    auto* point = trajectory.add_trajectory_point();
+    point->mutable_path_point()->set_x(i * 1.0);
+    point->mutable_path_point()->set_y(0.0);
+    point->mutable_path_point()->set_theta(0.0);
+    point->set_v(10.0);
+    point->set_relative_time(i * 0.1);
+  }
+  for (int i = 1; i <= 20; ++i) {
+    auto* point = trajectory.add_trajectory_point();
+    point->mutable_path_point()->set_x(40.0 + 10.0 * std::sin(0.1 * i));
+    point->mutable_path_point()->set_y(10.0 - 10.0 * std::cos(0.1 * i));
+    point->mutable_path_point()->set_theta(0.1 * i);
+    point->set_v(10.0);
+    point->set_relative_time(4.0 + i * 0.1);
+  }
+
+  Obstacle obstacle("1_0", perception_obstacle, trajectory,
+                    prediction::ObstaclePriority::NORMAL, false);
+
+  // the straight stretch collapses to its end points, the arc keeps enough
+  // points to stay within the error bound
+  const auto& points = obstacle.Trajectory().trajectory_point();
+  EXPECT_LE(5, points.size());
+  EXPECT_GE(20, points.size());
+
+  for (const auto& original_point : trajectory.trajectory_point()) {
+    const auto resampled_point =
+        obstacle.GetPointAtTime(original_point.relative_time());
+    const double error = std::hypot(
+        resampled_point.path_point().x() - original_point.path_point().x(),
+        resampled_point.path_point().y() - original_point.path_point().y());
+    EXPECT_LE(error, 0.051);
+  }
 }
 
 TEST_F(ObstacleTest, Perception) {
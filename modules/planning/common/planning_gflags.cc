@@ -24,6 +24,15 @@ DEFINE_double(test_duration, -1.0,
 
 DEFINE_int32(planning_loop_rate, 10, "Loop rate for planning node");
 
+DEFINE_bool(enable_planning_cycle_deadline, false,
+            "True to track the elapsed time of the current planning cycle and "
+            "let expensive tasks degrade to their fallback results instead of "
+            "overrunning the cycle.");
+
+DEFINE_double(planning_cycle_deadline_ms, 80.0,
+              "Budget of one planning cycle in milliseconds; only used when "
+              "enable_planning_cycle_deadline is true.");
+
 // TODO(all) enable this when perception issue is fixed.
 DEFINE_bool(enable_collision_detection, false,
             "enable collision detection in planning");
@@ -118,6 +127,11 @@ DEFINE_double(reference_line_lateral_buffer, 0.5,
 DEFINE_bool(enable_smooth_reference_line, true,
             "enable smooth the map reference line");
 
+DEFINE_bool(enable_parallel_reference_line_planning, false,
+            "Experimental: run the task chains of candidate reference lines "
+            "concurrently, each line with its own task instances. Tasks that "
+            "mutate global planning state must be audited before enabling");
+
 DEFINE_bool(prioritize_change_lane, false,
             "change lane strategy has higher priority, always use a valid "
             "change lane path if such path exists");
@@ -261,6 +275,10 @@ DEFINE_double(virtual_stop_wall_height, 2.0,
 DEFINE_double(prediction_total_time, 5.0, "Total prediction time");
 DEFINE_bool(align_prediction_time, false,
             "enable align prediction data based planning time");
+DEFINE_bool(enable_prediction_trajectory_downsample, true,
+            "downsample obstacle prediction trajectories at frame ingestion, "
+            "keeping linear interpolation in time within a few centimeters of "
+            "the original points");
 
 // Trajectory
 
@@ -312,9 +330,24 @@ DEFINE_bool(
     "Enable multiple thread to calculation curve cost in dp_poly_path.");
 DEFINE_bool(enable_multi_thread_in_dp_st_graph, false,
             "Enable multiple thread to calculation curve cost in dp_st_graph.");
+DEFINE_bool(enable_dp_st_warm_start, false,
+            "Restrict the dp_st_graph search to a corridor around last "
+            "cycle's speed profile; fall back to the full search when the "
+            "corridor has no feasible profile.");
+DEFINE_double(dp_st_warm_start_s_range, 5.0,
+              "Half width, in meters, of the warm start corridor around last "
+              "cycle's speed profile in dp_st_graph.");
 
 /// Lattice Planner
 DEFINE_double(lattice_epsilon, 1e-6, "Epsilon in lattice planner.");
+DEFINE_bool(enable_parallel_lattice_evaluation, false,
+            "Evaluate the lateral costs of lattice trajectory pairs "
+            "concurrently, one cyber task per longitudinal candidate.");
+DEFINE_int32(lattice_beam_width, 0,
+             "If positive, keep only trajectory pairs that can still rank "
+             "among the best lattice_beam_width candidates; longitudinal "
+             "candidates whose lon-only cost already exceeds the bound are "
+             "skipped before pairing. 0 disables pruning.");
 DEFINE_double(default_cruise_speed, 5.0, "default cruise speed");
 DEFINE_bool(enable_auto_tuning, false, "enable auto tuning data emission");
 DEFINE_double(trajectory_time_resolution, 0.1,
@@ -416,6 +449,23 @@ DEFINE_double(speed_bump_speed_limit, 4.4704,
 // navigation mode
 DEFINE_double(navigation_fallback_cruise_time, 8.0,
               "The time range of fallback cruise under navigation mode.");
+DEFINE_bool(enable_navi_rolling_window_reuse, false,
+            "Reuse the previous cycle's navigation-mode path and speed "
+            "solution when cheap corridor checks against fresh perception "
+            "pass.");
+DEFINE_int32(navi_reuse_max_cycles, 5,
+             "Maximum number of consecutive cycles the previous "
+             "navigation-mode solution may be reused before a full replan "
+             "is forced.");
+DEFINE_double(navi_reuse_corridor_half_width, 2.0,
+              "Half width of the corridor around the reused path used to "
+              "validate obstacles, in meters.");
+DEFINE_double(navi_reuse_obstacle_drift_threshold, 1.0,
+              "Maximum SL drift of a known obstacle between cycles before "
+              "the reused solution is invalidated, in meters.");
+DEFINE_double(navi_reuse_min_window_length, 40.0,
+              "Minimum remaining length of the reused path window, in "
+              "meters.");
 
 DEFINE_bool(enable_planning_pad_msg, false,
             "To control whether to enable planning pad message.");
@@ -446,6 +496,11 @@ DEFINE_bool(open_space_planner_switchable, false,
 DEFINE_bool(use_dual_variable_warm_start, true,
             "whether or not enable dual variable warm start ");
 
+DEFINE_bool(enable_open_space_pipelined_smoothing, true,
+            "smooth the first gear segment of the open space trajectory "
+            "separately and hand it out for publishing before the remaining "
+            "segments are smoothed");
+
 DEFINE_bool(use_gear_shift_trajectory, true,
             "allow some time for the vehicle to shift gear");
 
@@ -455,6 +510,10 @@ DEFINE_bool(use_osqp_optimizer_for_reference_line, true,
             "Use OSQP optimizer for reference line optimization.");
 DEFINE_bool(enable_osqp_debug, false,
             "True to turn on OSQP verbose debug output in log.");
+DEFINE_bool(enable_fem_1d_qp_hot_start, false,
+            "True to keep the OSQP workspace of the piecewise jerk path "
+            "problem across planning cycles and re-solve with bound updates "
+            "only when the horizon discretization is unchanged.");
 
 DEFINE_bool(export_chart, false, "export chart in planning");
 DEFINE_bool(enable_record_debug, true,
@@ -45,6 +45,8 @@ DECLARE_string(traffic_rule_config_filename);
 DECLARE_string(smoother_config_filename);
 DECLARE_string(reopt_smoother_config_filename);
 DECLARE_int32(planning_loop_rate);
+DECLARE_bool(enable_planning_cycle_deadline);
+DECLARE_double(planning_cycle_deadline_ms);
 DECLARE_bool(enable_collision_detection);
 DECLARE_string(rtk_trajectory_filename);
 DECLARE_uint64(rtk_trajectory_forward);
@@ -56,6 +58,7 @@ DECLARE_double(reference_line_lateral_buffer);
 
 DECLARE_bool(enable_smooth_reference_line);
 
+DECLARE_bool(enable_parallel_reference_line_planning);
 DECLARE_bool(prioritize_change_lane);
 DECLARE_bool(reckless_change_lane);
 DECLARE_double(change_lane_fail_freeze_time);
@@ -136,6 +139,7 @@ DECLARE_double(virtual_stop_wall_height);
 
 DECLARE_double(prediction_total_time);
 DECLARE_bool(align_prediction_time);
+DECLARE_bool(enable_prediction_trajectory_downsample);
 DECLARE_bool(enable_lag_prediction);
 DECLARE_int32(lag_prediction_min_appear_num);
 DECLARE_double(lag_prediction_max_disappear_num);
@@ -156,12 +160,16 @@ DECLARE_uint32(max_planning_thread_pool_size);
 DECLARE_bool(use_multi_thread_to_add_obstacles);
 DECLARE_bool(enable_multi_thread_in_dp_poly_path);
 DECLARE_bool(enable_multi_thread_in_dp_st_graph);
+DECLARE_bool(enable_dp_st_warm_start);
+DECLARE_double(dp_st_warm_start_s_range);
 
 // lattice planner
 DECLARE_double(lattice_epsilon);
 DECLARE_double(default_cruise_speed);
 
 DECLARE_bool(enable_auto_tuning);
+DECLARE_bool(enable_parallel_lattice_evaluation);
+DECLARE_int32(lattice_beam_width);
 DECLARE_double(trajectory_time_resolution);
 DECLARE_double(trajectory_space_resolution);
 DECLARE_double(lateral_acceleration_bound);
@@ -218,6 +226,11 @@ DECLARE_double(speed_bump_speed_limit);
 
 // navigation mode
 DECLARE_double(navigation_fallback_cruise_time);
+DECLARE_bool(enable_navi_rolling_window_reuse);
+DECLARE_int32(navi_reuse_max_cycles);
+DECLARE_double(navi_reuse_corridor_half_width);
+DECLARE_double(navi_reuse_obstacle_drift_threshold);
+DECLARE_double(navi_reuse_min_window_length);
 
 DECLARE_bool(enable_planning_pad_msg);
 
@@ -229,11 +242,13 @@ DECLARE_bool(enable_perception_obstacles);
 DECLARE_bool(enable_open_space_planner_thread);
 DECLARE_bool(open_space_planner_switchable);
 DECLARE_bool(use_dual_variable_warm_start);
+DECLARE_bool(enable_open_space_pipelined_smoothing);
 DECLARE_bool(use_gear_shift_trajectory);
 
 DECLARE_bool(use_osqp_optimizer_for_qp_st);
 DECLARE_bool(use_osqp_optimizer_for_reference_line);
 DECLARE_bool(enable_osqp_debug);
+DECLARE_bool(enable_fem_1d_qp_hot_start);
 DECLARE_bool(export_chart);
 DECLARE_bool(enable_record_debug);
 
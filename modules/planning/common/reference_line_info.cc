@@ -127,22 +127,20 @@ bool ReferenceLineInfo::Init(const std::vector<const Obstacle*>& obstacles) {
 
 bool ReferenceLineInfo::GetFirstOverlap(
     const std::vector<hdmap::PathOverlap>& path_overlaps,
+    const hdmap::OverlapDistanceTable& overlap_table,
     hdmap::PathOverlap* path_overlap) {
   CHECK_NOTNULL(path_overlap);
   const double start_s = sl_boundary_info_.adc_sl_boundary_.end_s();
   constexpr double kMaxOverlapRange = 500.0;
-  double overlap_min_s = kMaxOverlapRange;
 
-  for (const auto& overlap : path_overlaps) {
-    if (overlap.end_s < start_s) {
-      continue;
-    }
-    if (overlap_min_s > overlap.start_s) {
-      *path_overlap = overlap;
-      overlap_min_s = overlap.start_s;
-    }
+  // path overlaps are sorted by start_s, so the table lookup yields the
+  // overlap with the smallest start_s that is not yet fully passed.
+  const int index = overlap_table.FirstIndexFrom(start_s);
+  if (index < 0 || path_overlaps[index].start_s >= kMaxOverlapRange) {
+    return false;
   }
-  return overlap_min_s < kMaxOverlapRange;
+  *path_overlap = path_overlaps[index];
+  return true;
 }
 
 void ReferenceLineInfo::InitFirstOverlaps() {
@@ -150,31 +148,37 @@ void ReferenceLineInfo::InitFirstOverlaps() {
 
   // crosswalk
   hdmap::PathOverlap crosswalk_overlap;
-  if (GetFirstOverlap(map_path.crosswalk_overlaps(), &crosswalk_overlap)) {
+  if (GetFirstOverlap(map_path.crosswalk_overlaps(),
+                      map_path.crosswalk_overlap_table(), &crosswalk_overlap)) {
     first_encounter_overlaps_.push_back({CROSSWALK, crosswalk_overlap});
   }
 
   // signal
   hdmap::PathOverlap signal_overlap;
-  if (GetFirstOverlap(map_path.signal_overlaps(), &signal_overlap)) {
+  if (GetFirstOverlap(map_path.signal_overlaps(),
+                      map_path.signal_overlap_table(), &signal_overlap)) {
     first_encounter_overlaps_.push_back({SIGNAL, signal_overlap});
   }
 
   // stop_sign
   hdmap::PathOverlap stop_sign_overlap;
-  if (GetFirstOverlap(map_path.stop_sign_overlaps(), &stop_sign_overlap)) {
+  if (GetFirstOverlap(map_path.stop_sign_overlaps(),
+                      map_path.stop_sign_overlap_table(), &stop_sign_overlap)) {
     first_encounter_overlaps_.push_back({STOP_SIGN, stop_sign_overlap});
   }
 
   // clear_zone
   hdmap::PathOverlap clear_area_overlap;
-  if (GetFirstOverlap(map_path.clear_area_overlaps(), &clear_area_overlap)) {
+  if (GetFirstOverlap(map_path.clear_area_overlaps(),
+                      map_path.clear_area_overlap_table(),
+                      &clear_area_overlap)) {
     first_encounter_overlaps_.push_back({CLEAR_AREA, clear_area_overlap});
   }
 
   // pnc_junction
   hdmap::PathOverlap pnc_junction_overlap;
   if (GetFirstOverlap(map_path.pnc_junction_overlaps(),
+                      map_path.pnc_junction_overlap_table(),
                       &pnc_junction_overlap)) {
     first_encounter_overlaps_.push_back({PNC_JUNCTION, pnc_junction_overlap});
   }
@@ -190,6 +194,28 @@ void ReferenceLineInfo::InitFirstOverlaps() {
   }
 }
 
+void ReferenceLineInfo::PrefetchOverlapInfos() {
+  const auto& map_path = reference_line_.map_path();
+  for (const auto& overlap : map_path.crosswalk_overlaps()) {
+    if (crosswalk_info_cache_.count(overlap.object_id) > 0) {
+      continue;
+    }
+    crosswalk_info_cache_[overlap.object_id] =
+        hdmap::HDMapUtil::BaseMap().GetCrosswalkById(
+            hdmap::MakeMapId(overlap.object_id));
+  }
+}
+
+hdmap::CrosswalkInfoConstPtr ReferenceLineInfo::GetCrosswalkInfo(
+    const std::string& overlap_id) const {
+  const auto iter = crosswalk_info_cache_.find(overlap_id);
+  if (iter != crosswalk_info_cache_.end()) {
+    return iter->second;
+  }
+  return hdmap::HDMapUtil::BaseMap().GetCrosswalkById(
+      hdmap::MakeMapId(overlap_id));
+}
+
 bool ReferenceLineInfo::IsInited() const { return is_inited_; }
 
 bool WithinOverlap(const hdmap::PathOverlap& overlap, double s) {
@@ -314,6 +340,11 @@ bool ReferenceLineInfo::AddObstacleHelper(
 
 // AddObstacle is thread safe
 Obstacle* ReferenceLineInfo::AddObstacle(const Obstacle* obstacle) {
+  return AddObstacleInternal(obstacle, nullptr);
+}
+
+Obstacle* ReferenceLineInfo::AddObstacleInternal(
+    const Obstacle* obstacle, const SLBoundary* precomputed_sl) {
   if (!obstacle) {
     AERROR << "The provided obstacle is empty";
     return nullptr;
@@ -325,8 +356,10 @@ Obstacle* ReferenceLineInfo::AddObstacle(const Obstacle* obstacle) {
   }
 
   SLBoundary perception_sl;
-  if (!reference_line_.GetSLBoundary(obstacle->PerceptionBoundingBox(),
-                                     &perception_sl)) {
+  if (precomputed_sl != nullptr) {
+    perception_sl = *precomputed_sl;
+  } else if (!reference_line_.GetSLBoundary(obstacle->PerceptionBoundingBox(),
+                                            &perception_sl)) {
     AERROR << "Failed to get sl boundary for obstacle: " << obstacle->Id();
     return mutable_obstacle;
   }
@@ -362,11 +395,28 @@ Obstacle* ReferenceLineInfo::AddObstacle(const Obstacle* obstacle) {
 
 bool ReferenceLineInfo::AddObstacles(
     const std::vector<const Obstacle*>& obstacles) {
+  // Project every obstacle's bounding box corners against the reference
+  // line in one batched pass; the per-obstacle work below then reuses the
+  // precomputed boundaries instead of projecting corner by corner.
+  std::vector<SLBoundary> sl_boundaries;
+  bool has_batch_sl = false;
+  if (std::find(obstacles.begin(), obstacles.end(), nullptr) ==
+      obstacles.end()) {
+    std::vector<common::math::Box2d> boxes;
+    boxes.reserve(obstacles.size());
+    for (const auto* obstacle : obstacles) {
+      boxes.push_back(obstacle->PerceptionBoundingBox());
+    }
+    has_batch_sl = reference_line_.GetSLBoundariesBatch(boxes, &sl_boundaries);
+  }
+
   if (FLAGS_use_multi_thread_to_add_obstacles) {
     std::vector<std::future<Obstacle*>> results;
-    for (const auto* obstacle : obstacles) {
+    for (size_t i = 0; i < obstacles.size(); ++i) {
       results.push_back(
-          cyber::Async(&ReferenceLineInfo::AddObstacle, this, obstacle));
+          cyber::Async(&ReferenceLineInfo::AddObstacleInternal, this,
+                       obstacles[i],
+                       has_batch_sl ? &sl_boundaries[i] : nullptr));
     }
     for (auto& result : results) {
       if (!result.get()) {
@@ -375,9 +425,10 @@ bool ReferenceLineInfo::AddObstacles(
       }
     }
   } else {
-    for (const auto* obstacle : obstacles) {
-      if (!AddObstacle(obstacle)) {
-        AERROR << "Failed to add obstacle " << obstacle->Id();
+    for (size_t i = 0; i < obstacles.size(); ++i) {
+      if (!AddObstacleInternal(obstacles[i],
+                               has_batch_sl ? &sl_boundaries[i] : nullptr)) {
+        AERROR << "Failed to add obstacle " << obstacles[i]->Id();
         return false;
       }
     }
@@ -807,11 +858,14 @@ int ReferenceLineInfo::GetPnCJunction(
       reference_line_.map_path().pnc_junction_overlaps();
 
   constexpr double kError = 1.0;  // meter
-  for (const auto& overlap : pnc_junction_overlaps) {
-    if (s >= overlap.start_s - kError && s <= overlap.end_s + kError) {
-      *pnc_junction_overlap = overlap;
-      return 1;
-    }
+  // first overlap with end_s >= s - kError; any earlier one fails the
+  // end_s check and any later one starts even further ahead.
+  const int index =
+      reference_line_.map_path().pnc_junction_overlap_table().FirstIndexFrom(
+          s - kError);
+  if (index >= 0 && s >= pnc_junction_overlaps[index].start_s - kError) {
+    *pnc_junction_overlap = pnc_junction_overlaps[index];
+    return 1;
   }
   return 0;
 }
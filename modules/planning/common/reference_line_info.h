@@ -24,6 +24,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -174,6 +175,21 @@ class ReferenceLineInfo {
 
   void InitFirstOverlaps();
 
+  /**
+   * @brief resolve the map objects referenced by this line's path overlaps
+   * once, so the in-cycle traffic rule pass can consume them without
+   * repeated hdmap queries. Safe to run on a worker thread before the rule
+   * pass starts.
+   */
+  void PrefetchOverlapInfos();
+
+  /**
+   * @brief crosswalk referenced by a crosswalk overlap on this line, served
+   * from the prefetched cache when available.
+   */
+  hdmap::CrosswalkInfoConstPtr GetCrosswalkInfo(
+      const std::string& overlap_id) const;
+
   uint32_t GetPriority() const { return reference_line_.GetPriority(); }
 
   void SetPriority(uint32_t priority) { reference_line_.SetPriority(priority); }
@@ -228,7 +244,13 @@ class ReferenceLineInfo {
 
   bool AddObstacleHelper(const std::shared_ptr<Obstacle>& obstacle);
 
+  // Adds an obstacle with an optionally precomputed perception SL
+  // boundary; AddObstacles batches the boundary computation up front.
+  Obstacle* AddObstacleInternal(const Obstacle* obstacle,
+                                const SLBoundary* precomputed_sl);
+
   bool GetFirstOverlap(const std::vector<hdmap::PathOverlap>& path_overlaps,
+                       const hdmap::OverlapDistanceTable& overlap_table,
                        hdmap::PathOverlap* path_overlap);
 
   void SetPathTurnType();
@@ -302,6 +324,13 @@ class ReferenceLineInfo {
 
   hdmap::Lane::LaneTurn path_turn_type_;
 
+  /**
+   * Map objects referenced by this line's path overlaps, resolved once by
+   * PrefetchOverlapInfos so that traffic rules do not repeat the lookups
+   */
+  std::unordered_map<std::string, hdmap::CrosswalkInfoConstPtr>
+      crosswalk_info_cache_;
+
   /**
    * Data generated by speed_bounds_decider for constructing st_graph for
    * different st optimizer
@@ -20,6 +20,8 @@
 
 #include "modules/planning/common/speed/st_boundary.h"
 
+#include <limits>
+
 #include "cyber/common/log.h"
 #include "modules/common/math/math_utils.h"
 #include "modules/planning/common/planning_gflags.h"
@@ -34,8 +36,11 @@ STBoundary::STBoundary(
     const std::vector<std::pair<STPoint, STPoint>>& point_pairs) {
   CHECK(IsValid(point_pairs)) << "The input point_pairs are NOT valid";
 
+  raw_point_num_ = point_pairs.size();
   std::vector<std::pair<STPoint, STPoint>> reduced_pairs(point_pairs);
   RemoveRedundantPoints(&reduced_pairs);
+  simplify_tolerance_ = AdaptiveSimplifyTolerance(reduced_pairs);
+  SimplifyPoints(simplify_tolerance_, &reduced_pairs);
 
   for (const auto& item : reduced_pairs) {
     // use same t for both points
@@ -61,6 +66,12 @@ STBoundary::STBoundary(
   }
   min_t_ = lower_points_.front().t();
   max_t_ = lower_points_.back().t();
+
+  if (raw_point_num_ > lower_points_.size()) {
+    ADEBUG << "st boundary simplified from " << raw_point_num_ << " to "
+           << lower_points_.size() << " point pairs with tolerance "
+           << simplify_tolerance_;
+  }
 }
 
 bool STBoundary::IsPointNear(const common::math::LineSegment2d& seg,
@@ -115,6 +126,87 @@ void STBoundary::RemoveRedundantPoints(
   point_pairs->resize(i + 1);
 }
 
+double STBoundary::AdaptiveSimplifyTolerance(
+    const std::vector<std::pair<STPoint, STPoint>>& point_pairs) {
+  // base equals the redundancy threshold in RemoveRedundantPoints, so a
+  // near or slow obstacle keeps its full resolution
+  constexpr double kBaseTolerance = 0.1;
+  constexpr double kMaxTolerance = 0.5;
+  // an obstacle 50m ahead or closing at 10m/s doubles the base tolerance
+  constexpr double kDistanceScale = 50.0;
+  constexpr double kSpeedScale = 10.0;
+  if (point_pairs.size() <= 2) {
+    return kBaseTolerance;
+  }
+
+  double min_s = std::numeric_limits<double>::max();
+  for (const auto& item : point_pairs) {
+    min_s = std::fmin(min_s, item.first.s());
+  }
+  min_s = std::fmax(min_s, 0.0);
+
+  const auto& front = point_pairs.front().first;
+  const auto& back = point_pairs.back().first;
+  double relative_speed = 0.0;
+  if (back.t() > front.t()) {
+    relative_speed = std::fabs((back.s() - front.s()) / (back.t() - front.t()));
+  }
+
+  return std::fmin(kMaxTolerance,
+                   kBaseTolerance * (1.0 + min_s / kDistanceScale +
+                                     relative_speed / kSpeedScale));
+}
+
+void STBoundary::SimplifyPoints(
+    const double tolerance,
+    std::vector<std::pair<STPoint, STPoint>>* point_pairs) {
+  if (!point_pairs || point_pairs->size() <= 2) {
+    return;
+  }
+  const auto& pairs = *point_pairs;
+  std::vector<bool> keep(pairs.size(), false);
+  keep.front() = true;
+  keep.back() = true;
+
+  const double tolerance_sqr = tolerance * tolerance;
+  std::vector<std::pair<size_t, size_t>> ranges;
+  ranges.emplace_back(0, pairs.size() - 1);
+  while (!ranges.empty()) {
+    const size_t begin = ranges.back().first;
+    const size_t end = ranges.back().second;
+    ranges.pop_back();
+    if (end <= begin + 1) {
+      continue;
+    }
+    LineSegment2d lower_seg(pairs[begin].first, pairs[end].first);
+    LineSegment2d upper_seg(pairs[begin].second, pairs[end].second);
+    double max_dist_sqr = tolerance_sqr;
+    size_t split = begin;
+    for (size_t i = begin + 1; i < end; ++i) {
+      const double dist_sqr =
+          std::fmax(lower_seg.DistanceSquareTo(pairs[i].first),
+                    upper_seg.DistanceSquareTo(pairs[i].second));
+      if (dist_sqr > max_dist_sqr) {
+        max_dist_sqr = dist_sqr;
+        split = i;
+      }
+    }
+    if (split != begin) {
+      keep[split] = true;
+      ranges.emplace_back(begin, split);
+      ranges.emplace_back(split, end);
+    }
+  }
+
+  size_t kept = 0;
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    if (keep[i]) {
+      point_pairs->at(kept++) = pairs[i];
+    }
+  }
+  point_pairs->resize(kept);
+}
+
 bool STBoundary::IsValid(
     const std::vector<std::pair<STPoint, STPoint>>& point_pairs) const {
   if (point_pairs.size() < 2) {
@@ -109,6 +109,12 @@ class STBoundary : public common::math::Polygon2d {
   std::vector<STPoint> upper_points() const { return upper_points_; }
   std::vector<STPoint> lower_points() const { return lower_points_; }
 
+  // Simplification stats: number of input point pairs before the build-time
+  // simplification and the tolerance used; the surviving point count is
+  // lower_points().size(). StBoundaryMapper aggregates these per frame.
+  size_t raw_point_num() const { return raw_point_num_; }
+  double simplify_tolerance() const { return simplify_tolerance_; }
+
   STBoundary CutOffByT(const double t) const;
 
  private:
@@ -122,6 +128,22 @@ class STBoundary : public common::math::Polygon2d {
   void RemoveRedundantPoints(
       std::vector<std::pair<STPoint, STPoint>>* point_pairs);
 
+  FRIEND_TEST(StBoundaryTest, adaptive_simplify_tolerance);
+  // Tolerance for the Douglas-Peucker pass below, scaled up from the base
+  // redundancy threshold with the boundary's distance ahead of the ADC and
+  // its closing speed: far or fast-moving obstacles do not need
+  // per-trajectory-point resolution.
+  static double AdaptiveSimplifyTolerance(
+      const std::vector<std::pair<STPoint, STPoint>>& point_pairs);
+
+  FRIEND_TEST(StBoundaryTest, simplify_points);
+  // Douglas-Peucker simplification over the lower and upper chains jointly;
+  // a point pair survives when either chain deviates from the chord by more
+  // than tolerance. Fewer surviving pairs directly shrinks the DpStGraph
+  // state space and the speed QP constraint matrices.
+  void SimplifyPoints(const double tolerance,
+                      std::vector<std::pair<STPoint, STPoint>>* point_pairs);
+
   FRIEND_TEST(StBoundaryTest, get_index_range);
   bool GetIndexRange(const std::vector<STPoint>& points, const double t,
                      size_t* left, size_t* right) const;
@@ -134,6 +156,8 @@ class STBoundary : public common::math::Polygon2d {
 
   std::string id_;
   double characteristic_length_ = 1.0;
+  size_t raw_point_num_ = 0;
+  double simplify_tolerance_ = 0.0;
   double min_s_ = std::numeric_limits<double>::max();
   double max_s_ = std::numeric_limits<double>::lowest();
   double min_t_ = std::numeric_limits<double>::max();
@@ -151,5 +151,45 @@ TEST(StBoundaryTest, remove_redundant_points) {
   EXPECT_DOUBLE_EQ(points[1].second.t(), 0.5);
 }
 
+TEST(StBoundaryTest, simplify_points) {
+  std::vector<std::pair<STPoint, STPoint>> points;
+  points.emplace_back(STPoint(0.0, 0.0), STPoint(1.0, 0.0));
+  points.emplace_back(STPoint(0.5, 1.0), STPoint(1.5, 1.0));
+  // 0.3 kink, below a 0.4 tolerance but above 0.2
+  points.emplace_back(STPoint(1.3, 2.0), STPoint(2.3, 2.0));
+  points.emplace_back(STPoint(1.5, 3.0), STPoint(2.5, 3.0));
+  points.emplace_back(STPoint(2.0, 4.0), STPoint(3.0, 4.0));
+
+  auto coarse = points;
+  STBoundary st_boundary;
+  st_boundary.SimplifyPoints(0.4, &coarse);
+  EXPECT_EQ(coarse.size(), 2);
+  EXPECT_DOUBLE_EQ(coarse.front().first.t(), 0.0);
+  EXPECT_DOUBLE_EQ(coarse.back().first.t(), 4.0);
+
+  auto fine = points;
+  st_boundary.SimplifyPoints(0.2, &fine);
+  EXPECT_EQ(fine.size(), 3);
+  EXPECT_DOUBLE_EQ(fine[1].first.t(), 2.0);
+  EXPECT_DOUBLE_EQ(fine[1].first.s(), 1.3);
+}
+
+TEST(StBoundaryTest, adaptive_simplify_tolerance) {
+  std::vector<std::pair<STPoint, STPoint>> near_static;
+  near_static.emplace_back(STPoint(0.0, 0.0), STPoint(1.0, 0.0));
+  near_static.emplace_back(STPoint(0.0, 4.0), STPoint(1.0, 4.0));
+  near_static.emplace_back(STPoint(0.0, 8.0), STPoint(1.0, 8.0));
+  const double near_tol = STBoundary::AdaptiveSimplifyTolerance(near_static);
+  EXPECT_DOUBLE_EQ(near_tol, 0.1);
+
+  std::vector<std::pair<STPoint, STPoint>> far_fast;
+  far_fast.emplace_back(STPoint(50.0, 0.0), STPoint(55.0, 0.0));
+  far_fast.emplace_back(STPoint(90.0, 4.0), STPoint(95.0, 4.0));
+  far_fast.emplace_back(STPoint(130.0, 8.0), STPoint(135.0, 8.0));
+  const double far_tol = STBoundary::AdaptiveSimplifyTolerance(far_fast);
+  EXPECT_GT(far_tol, near_tol);
+  EXPECT_LE(far_tol, 0.5);
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -21,6 +21,7 @@
 #include "modules/planning/common/speed_profile_generator.h"
 
 #include <algorithm>
+#include <cmath>
 
 #include "cyber/common/log.h"
 #include "modules/planning/common/ego_info.h"
@@ -35,6 +36,37 @@ using common::SpeedPoint;
 using common::TrajectoryPoint;
 using common::math::Vec2d;
 
+namespace {
+
+// One constant-jerk segment of a stop profile. The boundary state is
+// precomputed so that sampling only evaluates the closed-form cubic
+// within the segment it falls into.
+struct JerkSegment {
+  double start_t = 0.0;
+  double s = 0.0;
+  double v = 0.0;
+  double a = 0.0;
+  double jerk = 0.0;
+};
+
+void AppendSegment(const double duration, const double jerk,
+                   std::vector<JerkSegment>* segments) {
+  if (duration <= 0.0) {
+    return;
+  }
+  auto& prev = segments->back();
+  prev.jerk = jerk;
+  JerkSegment next;
+  next.start_t = prev.start_t + duration;
+  next.s = prev.s + prev.v * duration + 0.5 * prev.a * duration * duration +
+           jerk * duration * duration * duration / 6.0;
+  next.v = prev.v + prev.a * duration + 0.5 * jerk * duration * duration;
+  next.a = prev.a + jerk * duration;
+  segments->push_back(next);
+}
+
+}  // namespace
+
 std::vector<SpeedPoint> SpeedProfileGenerator::GenerateInitSpeedProfile(
     const TrajectoryPoint& planning_init_point,
     const ReferenceLineInfo* reference_line_info) {
@@ -125,7 +157,7 @@ SpeedData SpeedProfileGenerator::GenerateFallbackSpeedProfile() {
   const double init_v = EgoInfo::Instance()->start_point().v();
   const double init_a = EgoInfo::Instance()->start_point().a();
   if (init_v > FLAGS_polynomial_speed_fallback_velocity) {
-    auto speed_data = GenerateStopProfileFromPolynomial(init_v, init_a);
+    auto speed_data = GenerateConstantJerkStopProfile(init_v, init_a);
     if (!speed_data.empty()) {
       return speed_data;
     }
@@ -158,46 +190,83 @@ SpeedData SpeedProfileGenerator::GenerateStopProfile(const double init_speed,
   return speed_data;
 }
 
-SpeedData SpeedProfileGenerator::GenerateStopProfileFromPolynomial(
+SpeedData SpeedProfileGenerator::GenerateConstantJerkStopProfile(
     const double init_speed, const double init_acc) {
-  AERROR << "Slowing down the car with polynomial.";
-  constexpr double kMaxT = 4.0;
-  for (double t = 2.0; t <= kMaxT; t += 0.5) {
-    for (double s = 0.0;
-         s < std::min(50.0, EgoInfo::Instance()->front_clear_distance() - 0.3);
-         s += 1.0) {
-      QuinticPolynomialCurve1d curve(0.0, init_speed, init_acc, s, 0.0, 0.0, t);
-      if (!IsValidProfile(curve)) {
-        continue;
-      }
-      constexpr double kUnitT = 0.02;
-      SpeedData speed_data;
-      for (double curve_t = 0.0; curve_t <= t; curve_t += kUnitT) {
-        const double curve_s = curve.Evaluate(0, curve_t);
-        const double curve_v = curve.Evaluate(1, curve_t);
-        const double curve_a = curve.Evaluate(2, curve_t);
-        const double curve_da = curve.Evaluate(3, curve_t);
-        speed_data.AppendSpeedPoint(curve_s, curve_t, curve_v, curve_a,
-                                    curve_da);
-      }
-      return speed_data;
+  AERROR << "Slowing down the car with a constant jerk profile.";
+  const double jerk = std::fabs(FLAGS_longitudinal_jerk_lower_bound);
+  const double max_dec = std::fabs(FLAGS_longitudinal_acceleration_lower_bound);
+  if (init_speed <= 0.0 || jerk <= 0.0 || max_dec <= 0.0) {
+    return SpeedData();
+  }
+
+  // The profile ramps the acceleration down with constant jerk, optionally
+  // holds the peak deceleration, and ramps back to zero exactly when the
+  // speed reaches zero. All segment boundaries have closed forms, so no
+  // search or polynomial fitting is needed.
+  std::vector<JerkSegment> segments;
+  segments.reserve(5);
+  JerkSegment init;
+  init.v = init_speed;
+  init.a = init_acc;
+  segments.push_back(init);
+
+  if (init_acc < 0.0 &&
+      init_speed < init_acc * init_acc / (2.0 * jerk)) {
+    // Already decelerating so hard that the car stops before the
+    // acceleration can be released; ramp up until v hits zero.
+    const double discriminant = init_acc * init_acc - 2.0 * jerk * init_speed;
+    const double release_time =
+        (-init_acc - std::sqrt(std::fmax(0.0, discriminant))) / jerk;
+    AppendSegment(release_time, jerk, &segments);
+  } else {
+    // Peak deceleration of the jerk-limited triangle that stops exactly at
+    // v = 0, clamped to the vehicle's deceleration limit.
+    double peak_dec =
+        std::sqrt(jerk * init_speed + 0.5 * init_acc * init_acc);
+    peak_dec = std::fmin(peak_dec, max_dec);
+
+    // Ramp to the peak deceleration from whichever side we start on.
+    if (init_acc > -peak_dec) {
+      AppendSegment((init_acc + peak_dec) / jerk, -jerk, &segments);
+    } else {
+      AppendSegment((-peak_dec - init_acc) / jerk, jerk, &segments);
     }
+
+    // Hold the peak until releasing with constant jerk lands on v = 0.
+    const double release_speed = peak_dec * peak_dec / (2.0 * jerk);
+    const double hold_time =
+        (segments.back().v - release_speed) / peak_dec;
+    AppendSegment(hold_time, 0.0, &segments);
+    AppendSegment(peak_dec / jerk, jerk, &segments);
   }
-  return SpeedData();
-}
 
-bool SpeedProfileGenerator::IsValidProfile(
-    const QuinticPolynomialCurve1d& curve) {
-  for (double evaluate_t = 0.1; evaluate_t <= curve.ParamLength();
-       evaluate_t += 0.2) {
-    const double v = curve.Evaluate(1, evaluate_t);
-    const double a = curve.Evaluate(2, evaluate_t);
-    constexpr double kEpsilon = 1e-3;
-    if (v < -kEpsilon || a < -5.0) {
-      return false;
+  const double stop_t = segments.back().start_t;
+  const double stop_s = segments.back().s;
+  const double unit_t = FLAGS_fallback_time_unit;
+  const double total_t = std::fmax(FLAGS_fallback_total_time, stop_t);
+
+  SpeedData speed_data;
+  speed_data.reserve(static_cast<size_t>(total_t / unit_t) + 2);
+  size_t index = 0;
+  for (double t = 0.0; t < total_t; t += unit_t) {
+    if (t >= stop_t) {
+      speed_data.AppendSpeedPoint(stop_s, t, 0.0, 0.0, 0.0);
+      continue;
     }
+    while (index + 1 < segments.size() &&
+           segments[index + 1].start_t <= t) {
+      ++index;
+    }
+    const auto& seg = segments[index];
+    const double dt = t - seg.start_t;
+    const double s = seg.s + seg.v * dt + 0.5 * seg.a * dt * dt +
+                     seg.jerk * dt * dt * dt / 6.0;
+    const double v = std::fmax(0.0, seg.v + seg.a * dt +
+                                        0.5 * seg.jerk * dt * dt);
+    const double a = seg.a + seg.jerk * dt;
+    speed_data.AppendSpeedPoint(s, t, v, a, seg.jerk);
   }
-  return true;
+  return speed_data;
 }
 
 SpeedData SpeedProfileGenerator::GenerateFixedDistanceCreepProfile(
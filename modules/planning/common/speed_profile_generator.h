@@ -27,7 +27,6 @@
 
 #include "modules/planning/common/reference_line_info.h"
 #include "modules/planning/common/speed/speed_data.h"
-#include "modules/planning/math/curve1d/quintic_polynomial_curve1d.h"
 
 namespace apollo {
 namespace planning {
@@ -56,10 +55,8 @@ class SpeedProfileGenerator {
   static SpeedData GenerateStopProfile(const double init_speed,
                                        const double init_acc);
 
-  static SpeedData GenerateStopProfileFromPolynomial(const double init_speed,
-                                                     const double init_acc);
-
-  static bool IsValidProfile(const QuinticPolynomialCurve1d& curve);
+  static SpeedData GenerateConstantJerkStopProfile(const double init_speed,
+                                                   const double init_acc);
 };
 
 }  // namespace planning
@@ -67,10 +67,19 @@ class DiscretizedTrajectory : public std::vector<common::TrajectoryPoint> {
 
   void PrependTrajectoryPoints(
       const std::vector<common::TrajectoryPoint>& trajectory_points) {
-    if (!empty() && trajectory_points.size() > 1) {
-      CHECK(trajectory_points.back().relative_time() < front().relative_time());
+    PrependTrajectoryPoints(trajectory_points.begin(),
+                            trajectory_points.end());
+  }
+
+  // range overload so callers can prepend a slice of an existing buffer
+  // without materializing a temporary vector of trajectory points.
+  void PrependTrajectoryPoints(
+      std::vector<common::TrajectoryPoint>::const_iterator first,
+      std::vector<common::TrajectoryPoint>::const_iterator last) {
+    if (!empty() && last - first > 1) {
+      CHECK((last - 1)->relative_time() < front().relative_time());
     }
-    insert(begin(), trajectory_points.begin(), trajectory_points.end());
+    insert(begin(), first, last);
   }
 
   const common::TrajectoryPoint& TrajectoryPointAt(const size_t index) const;
@@ -36,9 +36,9 @@ using apollo::common::TrajectoryPoint;
 using apollo::common::VehicleState;
 using apollo::common::math::Vec2d;
 
-std::vector<TrajectoryPoint>
-TrajectoryStitcher::ComputeReinitStitchingTrajectory(
-    const VehicleState& vehicle_state) {
+void TrajectoryStitcher::ComputeReinitStitchingTrajectory(
+    const VehicleState& vehicle_state,
+    std::vector<TrajectoryPoint>* stitching_trajectory) {
   TrajectoryPoint init_point;
   init_point.mutable_path_point()->set_s(0.0);
   init_point.mutable_path_point()->set_x(vehicle_state.x());
@@ -50,7 +50,8 @@ TrajectoryStitcher::ComputeReinitStitchingTrajectory(
   init_point.set_a(vehicle_state.linear_acceleration());
   init_point.set_relative_time(0.0);
 
-  return std::vector<TrajectoryPoint>(1, init_point);
+  stitching_trajectory->clear();
+  stitching_trajectory->push_back(std::move(init_point));
 }
 
 // only used in navigation mode
@@ -95,18 +96,33 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
     const VehicleState& vehicle_state, const double current_timestamp,
     const double planning_cycle_time,
     const PublishableTrajectory* prev_trajectory, std::string* replan_reason) {
+  std::vector<TrajectoryPoint> stitching_trajectory;
+  ComputeStitchingTrajectory(vehicle_state, current_timestamp,
+                             planning_cycle_time, prev_trajectory,
+                             replan_reason, &stitching_trajectory);
+  return stitching_trajectory;
+}
+
+void TrajectoryStitcher::ComputeStitchingTrajectory(
+    const VehicleState& vehicle_state, const double current_timestamp,
+    const double planning_cycle_time,
+    const PublishableTrajectory* prev_trajectory, std::string* replan_reason,
+    std::vector<TrajectoryPoint>* stitching_trajectory) {
   if (!FLAGS_enable_trajectory_stitcher) {
     *replan_reason = "stitch is disabled by gflag.";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
   if (!prev_trajectory) {
     *replan_reason = "replan for no previous trajectory.";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   if (vehicle_state.driving_mode() != canbus::Chassis::COMPLETE_AUTO_DRIVE) {
     *replan_reason = "replan for manual mode.";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   size_t prev_trajectory_size = prev_trajectory->NumOfPoints();
@@ -116,7 +132,8 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
            << "] size is zero! Previous planning not exist or failed. Use "
               "origin car status instead.";
     *replan_reason = "replan for empty previous trajectory.";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   const double veh_rel_time =
@@ -131,13 +148,15 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
     *replan_reason =
         "replan for current time smaller than the previous trajectory's first "
         "time.";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
   if (time_matched_index + 1 >= prev_trajectory_size) {
     AWARN << "current time beyond the previous trajectory's last time";
     *replan_reason =
         "replan for current time beyond the previous trajectory's last time";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   auto time_matched_point = prev_trajectory->TrajectoryPointAt(
@@ -145,7 +164,8 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
 
   if (!time_matched_point.has_path_point()) {
     *replan_reason = "replan for previous trajectory missed path point";
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   size_t position_matched_index = prev_trajectory->QueryNearestPointWithBuffer(
@@ -169,7 +189,8 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
         std::to_string(lat_diff));
     AERROR << msg;
     *replan_reason = msg;
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   if (std::fabs(lon_diff) > FLAGS_replan_longitudinal_distance_threshold) {
@@ -179,7 +200,8 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
         std::to_string(lon_diff));
     AERROR << msg;
     *replan_reason = msg;
-    return ComputeReinitStitchingTrajectory(vehicle_state);
+    return ComputeReinitStitchingTrajectory(vehicle_state,
+                                            stitching_trajectory);
   }
 
   double forward_rel_time =
@@ -197,23 +219,24 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
   auto matched_index = std::min(time_matched_index, position_matched_index);
 
   constexpr size_t kNumPreCyclePoint = 20;
-  std::vector<TrajectoryPoint> stitching_trajectory(
+  // assign reuses the storage the caller keeps across cycles.
+  stitching_trajectory->assign(
       prev_trajectory->begin() +
           std::max(0, static_cast<int>(matched_index - kNumPreCyclePoint)),
       prev_trajectory->begin() + forward_time_index + 1);
-  ADEBUG << "stitching_trajectory size: " << stitching_trajectory.size();
+  ADEBUG << "stitching_trajectory size: " << stitching_trajectory->size();
 
-  const double zero_s = stitching_trajectory.back().path_point().s();
-  for (auto& tp : stitching_trajectory) {
+  const double zero_s = stitching_trajectory->back().path_point().s();
+  for (auto& tp : *stitching_trajectory) {
     if (!tp.has_path_point()) {
       *replan_reason = "replan for previous trajectory missed path point";
-      return ComputeReinitStitchingTrajectory(vehicle_state);
+      return ComputeReinitStitchingTrajectory(vehicle_state,
+                                              stitching_trajectory);
     }
     tp.set_relative_time(tp.relative_time() + prev_trajectory->header_time() -
                          current_timestamp);
     tp.mutable_path_point()->set_s(tp.path_point().s() - zero_s);
   }
-  return stitching_trajectory;
 }
 
 std::pair<double, double> TrajectoryStitcher::ComputePositionProjection(
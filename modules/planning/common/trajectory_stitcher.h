@@ -46,13 +46,25 @@ class TrajectoryStitcher {
       const double planning_cycle_time,
       const PublishableTrajectory* prev_trajectory, std::string* replan_reason);
 
+  /**
+   * @brief variant writing into a caller-owned buffer, so the caller can
+   * keep one preallocated vector across planning cycles instead of
+   * reallocating the trajectory point protos at the head of every cycle.
+   */
+  static void ComputeStitchingTrajectory(
+      const common::VehicleState& vehicle_state, const double current_timestamp,
+      const double planning_cycle_time,
+      const PublishableTrajectory* prev_trajectory, std::string* replan_reason,
+      std::vector<common::TrajectoryPoint>* stitching_trajectory);
+
  private:
   static std::pair<double, double> ComputePositionProjection(
       const double x, const double y,
       const common::TrajectoryPoint& matched_trajectory_point);
 
-  static std::vector<common::TrajectoryPoint> ComputeReinitStitchingTrajectory(
-      const common::VehicleState& vehicle_state);
+  static void ComputeReinitStitchingTrajectory(
+      const common::VehicleState& vehicle_state,
+      std::vector<common::TrajectoryPoint>* stitching_trajectory);
 };
 
 }  // namespace planning
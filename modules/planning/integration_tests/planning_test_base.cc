@@ -23,6 +23,7 @@
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/localization/proto/localization.pb.h"
 #include "modules/perception/proto/traffic_light_detection.pb.h"
+#include "modules/planning/common/planning_context.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/prediction/proto/prediction_obstacle.pb.h"
 #include "modules/routing/proto/routing.pb.h"
@@ -48,6 +49,8 @@ DEFINE_string(test_traffic_light_file, "", "The traffic light test file");
 DEFINE_string(test_relative_map_file, "", "The relative map test file");
 DEFINE_string(test_previous_planning_file, "",
               "The previous planning test file");
+DEFINE_string(test_planning_snapshot_file, "",
+              "planning state snapshot restored before the first cycle");
 
 void PlanningTestBase::SetUpTestCase() {
   FLAGS_use_multi_thread_to_add_obstacles = false;
@@ -178,6 +181,10 @@ void PlanningTestBase::SetUp() {
     planning_->last_publishable_trajectory_.reset(
         new PublishableTrajectory(prev_planning));
   }
+  if (!FLAGS_test_planning_snapshot_file.empty()) {
+    CHECK(LoadPlanningSnapshot(FLAGS_test_data_dir + "/" +
+                               FLAGS_test_planning_snapshot_file));
+  }
   for (auto& config : *(planning_->traffic_rule_configs_.mutable_config())) {
     auto iter = rule_enabled_.find(config.rule_id());
     if (iter != rule_enabled_.end()) {
@@ -266,6 +273,42 @@ bool PlanningTestBase::RunPlanning(const std::string& test_case_name,
   return true;
 }
 
+bool PlanningTestBase::SavePlanningSnapshot(const std::string& snapshot_file) {
+  PlanningSnapshot snapshot;
+  snapshot.mutable_planning_status()->CopyFrom(
+      PlanningContext::Planningstatus());
+  if (planning_->last_publishable_trajectory_ != nullptr) {
+    planning_->last_publishable_trajectory_->PopulateTrajectoryProtobuf(
+        snapshot.mutable_previous_trajectory());
+  }
+  snapshot.set_timestamp_sec(Clock::NowInSeconds());
+  if (!cyber::common::SetProtoToASCIIFile(snapshot, snapshot_file)) {
+    AERROR << "failed to save planning snapshot: " << snapshot_file;
+    return false;
+  }
+  return true;
+}
+
+bool PlanningTestBase::LoadPlanningSnapshot(const std::string& snapshot_file) {
+  PlanningSnapshot snapshot;
+  if (!cyber::common::GetProtoFromASCIIFile(snapshot_file, &snapshot)) {
+    AERROR << "failed to load planning snapshot: " << snapshot_file;
+    return false;
+  }
+  PlanningContext::MutablePlanningStatus()->CopyFrom(
+      snapshot.planning_status());
+  if (snapshot.has_previous_trajectory()) {
+    planning_->last_publishable_trajectory_.reset(
+        new PublishableTrajectory(snapshot.previous_trajectory()));
+  }
+  if (snapshot.has_timestamp_sec()) {
+    Clock::SetNowInSeconds(snapshot.timestamp_sec());
+  }
+  // Scenario selection and the per-cycle ScenarioInfo cache are rebuilt
+  // by ScenarioManager from the restored status on the next cycle.
+  return true;
+}
+
 bool PlanningTestBase::IsValidTrajectory(const ADCTrajectory& trajectory) {
   for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
     const auto& point = trajectory.trajectory_point(i);
@@ -20,6 +20,7 @@
 
 #include "gtest/gtest.h"
 
+#include "modules/planning/proto/planning_snapshot.pb.h"
 #include "modules/planning/proto/traffic_rule_config.pb.h"
 
 #define protected public
@@ -70,6 +71,7 @@ DECLARE_string(test_prediction_file);
 DECLARE_string(test_traffic_light_file);
 DECLARE_string(test_relative_map_file);
 DECLARE_string(test_previous_planning_file);
+DECLARE_string(test_planning_snapshot_file);
 
 class PlanningTestBase : public ::testing::Test {
  public:
@@ -88,6 +90,16 @@ class PlanningTestBase : public ::testing::Test {
   TrafficRuleConfig* GetTrafficRuleConfig(
       const TrafficRuleConfig::RuleId& rule_id);
 
+  /**
+   * Save the cross-cycle planning state (planning status, previous
+   * published trajectory and mock clock) so a later run can resume from
+   * this cycle boundary instead of replaying the scenario from cold
+   * start. Restore via FLAGS_test_planning_snapshot_file or
+   * LoadPlanningSnapshot().
+   */
+  bool SavePlanningSnapshot(const std::string& snapshot_file);
+  bool LoadPlanningSnapshot(const std::string& snapshot_file);
+
  protected:
   void TrimPlanning(ADCTrajectory* origin, bool no_trajectory_point);
   bool FeedTestData();
@@ -34,7 +34,6 @@ namespace apollo {
 namespace planning {
 
 using apollo::common::PathPoint;
-using apollo::common::TrajectoryPoint;
 using apollo::common::math::Box2d;
 using apollo::common::math::lerp;
 using apollo::common::math::PathMatcher;
@@ -66,9 +65,11 @@ SLBoundary PathTimeGraph::ComputeObstacleBoundary(
   double start_l(std::numeric_limits<double>::max());
   double end_l(std::numeric_limits<double>::lowest());
 
-  for (const auto& point : vertices) {
-    auto sl_point = PathMatcher::GetPathFrenetCoordinate(discretized_ref_points,
-                                                         point.x(), point.y());
+  // Convert all vertices in one call; the matcher flattens the reference
+  // line once instead of re-scanning it per vertex.
+  const auto sl_points =
+      PathMatcher::GetPathFrenetCoordinates(discretized_ref_points, vertices);
+  for (const auto& sl_point : sl_points) {
     start_s = std::fmin(start_s, sl_point.first);
     end_s = std::fmax(end_s, sl_point.first);
     start_l = std::fmin(start_l, sl_point.second);
@@ -149,10 +150,18 @@ void PathTimeGraph::SetStaticObstacle(
 void PathTimeGraph::SetDynamicObstacle(
     const Obstacle* obstacle,
     const std::vector<PathPoint>& discretized_ref_points) {
-  double relative_time = time_range_.first;
-  while (relative_time < time_range_.second) {
-    TrajectoryPoint point = obstacle->GetPointAtTime(relative_time);
-    Box2d box = obstacle->GetBoundingBox(point);
+  // the shared forecast already holds the obstacle poses on the same time
+  // grid this loop used to rebuild through GetPointAtTime
+  const Obstacle::SampledForecast& forecast = obstacle->sampled_forecast();
+  for (size_t i = 0; i < forecast.size(); ++i) {
+    const double relative_time = forecast.relative_time[i];
+    if (relative_time < time_range_.first) {
+      continue;
+    }
+    if (relative_time >= time_range_.second) {
+      break;
+    }
+    Box2d box = obstacle->GetBoundingBoxAtSample(i);
     SLBoundary sl_boundary =
         ComputeObstacleBoundary(box.GetAllCorners(), discretized_ref_points);
 
@@ -170,7 +179,6 @@ void PathTimeGraph::SetDynamicObstacle(
           path_time_obstacle_map_.end()) {
         break;
       } else {
-        relative_time += FLAGS_trajectory_time_resolution;
         continue;
       }
     }
@@ -190,7 +198,6 @@ void PathTimeGraph::SetDynamicObstacle(
         SetPathTimePoint(obstacle->Id(), sl_boundary.start_s(), relative_time));
     path_time_obstacle_map_[obstacle->Id()].set_upper_right_point(
         SetPathTimePoint(obstacle->Id(), sl_boundary.end_s(), relative_time));
-    relative_time += FLAGS_trajectory_time_resolution;
   }
 }
 
@@ -57,6 +57,28 @@ double LatticeTrajectory1d::Evaluate(const std::uint32_t order,
   }
 }
 
+void LatticeTrajectory1d::EvaluateDerivatives(
+    const double param, std::array<double, 4>* values) const {
+  double param_length = ptr_trajectory1d_->ParamLength();
+  if (param < param_length) {
+    ptr_trajectory1d_->EvaluateDerivatives(param, values);
+    return;
+  }
+
+  // do constant acceleration extrapolation, consistent with Evaluate();
+  // the boundary conditions are evaluated only once for all the orders.
+  double p = ptr_trajectory1d_->Evaluate(0, param_length);
+  double v = ptr_trajectory1d_->Evaluate(1, param_length);
+  double a = ptr_trajectory1d_->Evaluate(2, param_length);
+
+  double t = param - param_length;
+
+  (*values)[0] = p + v * t + 0.5 * a * t * t;
+  (*values)[1] = v + a * t;
+  (*values)[2] = a;
+  (*values)[3] = 0.0;
+}
+
 double LatticeTrajectory1d::ParamLength() const {
   return ptr_trajectory1d_->ParamLength();
 }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -36,6 +37,9 @@ class LatticeTrajectory1d : public Curve1d {
 
   virtual double Evaluate(const std::uint32_t order, const double param) const;
 
+  virtual void EvaluateDerivatives(const double param,
+                                   std::array<double, 4>* values) const;
+
   virtual double ParamLength() const;
 
   virtual std::string ToString() const;
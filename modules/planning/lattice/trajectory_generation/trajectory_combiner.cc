@@ -45,15 +45,16 @@ DiscretizedTrajectory TrajectoryCombiner::Combine(
   while (t_param < FLAGS_trajectory_time_length) {
     // linear extrapolation is handled internally in LatticeTrajectory1d;
     // no worry about t_param > lon_trajectory.ParamLength() situation
-    double s = lon_trajectory.Evaluate(0, t_param);
+    std::array<double, 4> lon_values;
+    lon_trajectory.EvaluateDerivatives(t_param, &lon_values);
+    double s = lon_values[0];
     if (last_s > 0.0) {
       s = std::max(last_s, s);
     }
     last_s = s;
 
-    double s_dot =
-        std::max(FLAGS_lattice_epsilon, lon_trajectory.Evaluate(1, t_param));
-    double s_ddot = lon_trajectory.Evaluate(2, t_param);
+    double s_dot = std::max(FLAGS_lattice_epsilon, lon_values[1]);
+    double s_ddot = lon_values[2];
     if (s > s_ref_max) {
       break;
     }
@@ -61,9 +62,11 @@ DiscretizedTrajectory TrajectoryCombiner::Combine(
     double relative_s = s - s0;
     // linear extrapolation is handled internally in LatticeTrajectory1d;
     // no worry about s_param > lat_trajectory.ParamLength() situation
-    double d = lat_trajectory.Evaluate(0, relative_s);
-    double d_prime = lat_trajectory.Evaluate(1, relative_s);
-    double d_pprime = lat_trajectory.Evaluate(2, relative_s);
+    std::array<double, 4> lat_values;
+    lat_trajectory.EvaluateDerivatives(relative_s, &lat_values);
+    double d = lat_values[0];
+    double d_prime = lat_values[1];
+    double d_pprime = lat_values[2];
 
     PathPoint matched_ref_point = PathMatcher::MatchToPath(reference_line, s);
 
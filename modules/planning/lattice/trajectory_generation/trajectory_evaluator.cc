@@ -21,9 +21,11 @@
 #include "modules/planning/lattice/trajectory_generation/trajectory_evaluator.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/trajectory1d/piecewise_acceleration_trajectory1d.h"
@@ -56,6 +58,11 @@ TrajectoryEvaluator::TrajectoryEvaluator(
   path_time_intervals_ = path_time_graph_->GetPathBlockingIntervals(
       start_time, end_time, FLAGS_trajectory_time_resolution);
 
+  for (double t = start_time; t < end_time;
+       t += FLAGS_trajectory_time_resolution) {
+    time_samples_.emplace_back(t);
+  }
+
   reference_s_dot_ = ComputeLongitudinalGuideVelocity(planning_target);
 
   // if we have a stop point along the reference line,
@@ -64,6 +71,10 @@ TrajectoryEvaluator::TrajectoryEvaluator(
   if (planning_target.has_stop_point()) {
     stop_point = planning_target.stop_point().s();
   }
+
+  // Lon cost terms are independent of the lat candidate; compute them once
+  // per lon trajectory instead of once per pair.
+  std::vector<std::pair<double, PtrTrajectory1d>> lon_candidates;
   for (const auto& lon_trajectory : lon_trajectories) {
     double lon_end_s = lon_trajectory->Evaluate(0, end_time);
     if (init_s[0] < stop_point &&
@@ -74,17 +85,65 @@ TrajectoryEvaluator::TrajectoryEvaluator(
     if (!ConstraintChecker1d::IsValidLongitudinalTrajectory(*lon_trajectory)) {
       continue;
     }
-    for (const auto& lat_trajectory : lat_trajectories) {
-      /**
-       * The validity of the code needs to be verified.
-      if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
-                                                         *lon_trajectory)) {
-        continue;
+    lon_candidates.emplace_back(
+        EvaluateLonCost(planning_target, lon_trajectory), lon_trajectory);
+  }
+
+  const int beam_width = FLAGS_lattice_beam_width;
+  if (beam_width > 0) {
+    // Ascending lon cost order, so pruning can stop at the first candidate
+    // whose lower bound already exceeds the beam bound.
+    std::sort(lon_candidates.begin(), lon_candidates.end(),
+              [](const std::pair<double, PtrTrajectory1d>& left,
+                 const std::pair<double, PtrTrajectory1d>& right) {
+                return left.first < right.first;
+              });
+  }
+
+  const bool evaluate_in_parallel =
+      FLAGS_enable_parallel_lattice_evaluation && lon_candidates.size() > 1;
+  std::vector<std::vector<double>> all_lat_costs(lon_candidates.size());
+  if (evaluate_in_parallel) {
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < lon_candidates.size(); ++i) {
+      results.push_back(cyber::Async(&TrajectoryEvaluator::EvaluateLatCosts,
+                                     this, lon_candidates[i].second,
+                                     &lat_trajectories, &all_lat_costs[i]));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+  }
+
+  // max-heap over the best beam_width costs kept so far; its top is the
+  // admissible pruning bound.
+  std::priority_queue<double> best_costs;
+  double beam_bound = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < lon_candidates.size(); ++i) {
+    const double lon_cost = lon_candidates[i].first;
+    if (beam_width > 0 && lon_cost >= beam_bound) {
+      break;
+    }
+    const auto& lon_trajectory = lon_candidates[i].second;
+    if (!evaluate_in_parallel) {
+      EvaluateLatCosts(lon_trajectory, &lat_trajectories, &all_lat_costs[i]);
+    }
+    for (size_t j = 0; j < lat_trajectories.size(); ++j) {
+      const double cost = lon_cost + all_lat_costs[i][j];
+      if (beam_width > 0) {
+        if (cost >= beam_bound) {
+          continue;
+        }
+        best_costs.push(cost);
+        if (best_costs.size() > static_cast<size_t>(beam_width)) {
+          best_costs.pop();
+        }
+        if (best_costs.size() == static_cast<size_t>(beam_width)) {
+          beam_bound = best_costs.top();
+        }
       }
-      */
-      double cost = Evaluate(planning_target, lon_trajectory, lat_trajectory);
-      cost_queue_.emplace(Trajectory1dPair(lon_trajectory, lat_trajectory),
-                          cost);
+      cost_queue_.emplace(
+          Trajectory1dPair(lon_trajectory, lat_trajectories[j]), cost);
     }
   }
   ADEBUG << "Number of valid 1d trajectory pairs: " << cost_queue_.size();
@@ -162,14 +221,64 @@ double TrajectoryEvaluator::Evaluate(
          lat_comfort_cost * FLAGS_weight_lat_comfort;
 }
 
+double TrajectoryEvaluator::EvaluateLonCost(
+    const PlanningTarget& planning_target,
+    const PtrTrajectory1d& lon_trajectory) const {
+  double lon_objective_cost =
+      LonObjectiveCost(lon_trajectory, planning_target, reference_s_dot_);
+
+  double lon_jerk_cost = LonComfortCost(lon_trajectory);
+
+  double lon_collision_cost = LonCollisionCost(lon_trajectory);
+
+  double centripetal_acc_cost = CentripetalAccelerationCost(lon_trajectory);
+
+  return lon_objective_cost * FLAGS_weight_lon_objective +
+         lon_jerk_cost * FLAGS_weight_lon_jerk +
+         lon_collision_cost * FLAGS_weight_lon_collision +
+         centripetal_acc_cost * FLAGS_weight_centripetal_acceleration;
+}
+
+void TrajectoryEvaluator::EvaluateLatCosts(
+    const PtrTrajectory1d& lon_trajectory,
+    const std::vector<PtrTrajectory1d>* lat_trajectories,
+    std::vector<double>* lat_costs) const {
+  // decides the longitudinal evaluation horizon for lateral trajectories.
+  double evaluation_horizon =
+      std::min(FLAGS_decision_horizon,
+               lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
+  std::vector<double> s_values;
+  for (double s = 0.0; s < evaluation_horizon;
+       s += FLAGS_trajectory_space_resolution) {
+    s_values.emplace_back(s);
+  }
+
+  lat_costs->clear();
+  lat_costs->reserve(lat_trajectories->size());
+  for (const auto& lat_trajectory : *lat_trajectories) {
+    /**
+     * The validity of the code needs to be verified.
+    if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
+                                                       *lon_trajectory)) {
+      continue;
+    }
+    */
+    lat_costs->emplace_back(
+        LatOffsetCost(lat_trajectory, s_values) * FLAGS_weight_lat_offset +
+        LatComfortCost(lon_trajectory, lat_trajectory) *
+            FLAGS_weight_lat_comfort);
+  }
+}
+
 double TrajectoryEvaluator::LatOffsetCost(
     const PtrTrajectory1d& lat_trajectory,
     const std::vector<double>& s_values) const {
   double lat_offset_start = lat_trajectory->Evaluate(0, 0.0);
+  std::vector<double> lat_offsets;
+  lat_trajectory->EvaluateBatch(0, s_values, &lat_offsets);
   double cost_sqr_sum = 0.0;
   double cost_abs_sum = 0.0;
-  for (const auto& s : s_values) {
-    double lat_offset = lat_trajectory->Evaluate(0, s);
+  for (const auto& lat_offset : lat_offsets) {
     double cost = lat_offset / FLAGS_lat_offset_bound;
     if (lat_offset * lat_offset_start < 0.0) {
       cost_sqr_sum += cost * cost * FLAGS_weight_opposite_side_offset;
@@ -186,15 +295,17 @@ double TrajectoryEvaluator::LatComfortCost(
     const PtrTrajectory1d& lon_trajectory,
     const PtrTrajectory1d& lat_trajectory) const {
   double max_cost = 0.0;
-  for (double t = 0.0; t < FLAGS_trajectory_time_length;
-       t += FLAGS_trajectory_time_resolution) {
-    double s = lon_trajectory->Evaluate(0, t);
-    double s_dot = lon_trajectory->Evaluate(1, t);
-    double s_dotdot = lon_trajectory->Evaluate(2, t);
-
-    double relative_s = s - init_s_[0];
-    double l_prime = lat_trajectory->Evaluate(1, relative_s);
-    double l_primeprime = lat_trajectory->Evaluate(2, relative_s);
+  std::array<double, 4> lon_values;
+  std::array<double, 4> lat_values;
+  for (const auto& t : time_samples_) {
+    lon_trajectory->EvaluateDerivatives(t, &lon_values);
+    double s_dot = lon_values[1];
+    double s_dotdot = lon_values[2];
+
+    double relative_s = lon_values[0] - init_s_[0];
+    lat_trajectory->EvaluateDerivatives(relative_s, &lat_values);
+    double l_prime = lat_values[1];
+    double l_primeprime = lat_values[2];
     double cost = l_primeprime * s_dot * s_dot + l_prime * s_dotdot;
     max_cost = std::max(max_cost, std::fabs(cost));
   }
@@ -203,11 +314,11 @@ double TrajectoryEvaluator::LatComfortCost(
 
 double TrajectoryEvaluator::LonComfortCost(
     const PtrTrajectory1d& lon_trajectory) const {
+  std::vector<double> jerk_values;
+  lon_trajectory->EvaluateBatch(3, time_samples_, &jerk_values);
   double cost_sqr_sum = 0.0;
   double cost_abs_sum = 0.0;
-  for (double t = 0.0; t < FLAGS_trajectory_time_length;
-       t += FLAGS_trajectory_time_resolution) {
-    double jerk = lon_trajectory->Evaluate(3, t);
+  for (const auto& jerk : jerk_values) {
     double cost = jerk / FLAGS_longitudinal_jerk_upper_bound;
     cost_sqr_sum += cost * cost;
     cost_abs_sum += std::fabs(cost);
@@ -223,11 +334,14 @@ double TrajectoryEvaluator::LonObjectiveCost(
   double dist_s =
       lon_trajectory->Evaluate(0, t_max) - lon_trajectory->Evaluate(0, 0.0);
 
+  std::vector<double> s_dot_values;
+  lon_trajectory->EvaluateBatch(1, time_samples_, &s_dot_values);
   double speed_cost_sqr_sum = 0.0;
   double speed_cost_weight_sum = 0.0;
-  for (size_t i = 0; i < ref_s_dots.size(); ++i) {
+  size_t num_samples = std::min(ref_s_dots.size(), s_dot_values.size());
+  for (size_t i = 0; i < num_samples; ++i) {
     double t = static_cast<double>(i) * FLAGS_trajectory_time_resolution;
-    double cost = ref_s_dots[i] - lon_trajectory->Evaluate(1, t);
+    double cost = ref_s_dots[i] - s_dot_values[i];
     speed_cost_sqr_sum += t * t * std::fabs(cost);
     speed_cost_weight_sum += t * t;
   }
@@ -243,15 +357,18 @@ double TrajectoryEvaluator::LonObjectiveCost(
 // while constructing trajectory evaluator
 double TrajectoryEvaluator::LonCollisionCost(
     const PtrTrajectory1d& lon_trajectory) const {
+  std::vector<double> traj_s_values;
+  lon_trajectory->EvaluateBatch(0, time_samples_, &traj_s_values);
   double cost_sqr_sum = 0.0;
   double cost_abs_sum = 0.0;
-  for (size_t i = 0; i < path_time_intervals_.size(); ++i) {
+  size_t num_samples =
+      std::min(path_time_intervals_.size(), traj_s_values.size());
+  for (size_t i = 0; i < num_samples; ++i) {
     const auto& pt_interval = path_time_intervals_[i];
     if (pt_interval.empty()) {
       continue;
     }
-    double t = static_cast<double>(i) * FLAGS_trajectory_time_resolution;
-    double traj_s = lon_trajectory->Evaluate(0, t);
+    double traj_s = traj_s_values[i];
     double sigma = FLAGS_lon_collision_cost_std;
     for (const auto& m : pt_interval) {
       double dist = 0.0;
@@ -274,10 +391,13 @@ double TrajectoryEvaluator::CentripetalAccelerationCost(
   // Assumes the vehicle is not obviously deviate from the reference line.
   double centripetal_acc_sum = 0.0;
   double centripetal_acc_sqr_sum = 0.0;
-  for (double t = 0.0; t < FLAGS_trajectory_time_length;
-       t += FLAGS_trajectory_time_resolution) {
-    double s = lon_trajectory->Evaluate(0, t);
-    double v = lon_trajectory->Evaluate(1, t);
+  std::vector<double> s_values;
+  std::vector<double> v_values;
+  lon_trajectory->EvaluateBatch(0, time_samples_, &s_values);
+  lon_trajectory->EvaluateBatch(1, time_samples_, &v_values);
+  for (size_t i = 0; i < time_samples_.size(); ++i) {
+    double s = s_values[i];
+    double v = v_values[i];
     PathPoint ref_point = PathMatcher::MatchToPath(*reference_line_, s);
     CHECK(ref_point.has_kappa());
     double centripetal_acc = v * v * ref_point.kappa();
@@ -74,6 +74,19 @@ class TrajectoryEvaluator {
                   const std::shared_ptr<Curve1d>& lat_trajectory,
                   std::vector<double>* cost_components = nullptr) const;
 
+  // Weighted sum of the cost terms that depend only on the lon trajectory.
+  // Lat cost terms are non-negative, so this is an admissible lower bound
+  // for every pair built from the lon trajectory.
+  double EvaluateLonCost(const PlanningTarget& planning_target,
+                         const std::shared_ptr<Curve1d>& lon_trajectory) const;
+
+  // Weighted sum of the remaining, lat-dependent cost terms for every lat
+  // candidate paired with the given lon trajectory.
+  void EvaluateLatCosts(
+      const std::shared_ptr<Curve1d>& lon_trajectory,
+      const std::vector<std::shared_ptr<Curve1d>>* lat_trajectories,
+      std::vector<double>* lat_costs) const;
+
   double LatOffsetCost(const std::shared_ptr<Curve1d>& lat_trajectory,
                        const std::vector<double>& s_values) const;
 
@@ -117,6 +130,10 @@ class TrajectoryEvaluator {
   std::array<double, 3> init_s_;
 
   std::vector<double> reference_s_dot_;
+
+  // time grid shared by the per-trajectory cost terms, so the 1d curves
+  // can be evaluated in batches over it.
+  std::vector<double> time_samples_;
 };
 
 }  // namespace planning
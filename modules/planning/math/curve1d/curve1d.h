@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <array>
 #include <string>
+#include <vector>
 
 namespace apollo {
 namespace planning {
@@ -36,6 +38,28 @@ class Curve1d {
   virtual double Evaluate(const std::uint32_t order,
                           const double param) const = 0;
 
+  // Evaluates the curve and its first three derivatives at param in one
+  // call. The default forwards to Evaluate() once per order; polynomial
+  // curves override it to share the power terms across the orders.
+  virtual void EvaluateDerivatives(const double param,
+                                   std::array<double, 4>* values) const {
+    for (std::uint32_t order = 0; order < 4; ++order) {
+      (*values)[order] = Evaluate(order, param);
+    }
+  }
+
+  // Evaluates one derivative order over an array of params. The default
+  // forwards to Evaluate() once per param; polynomial curves override it
+  // to hoist the coefficients out of the loop.
+  virtual void EvaluateBatch(const std::uint32_t order,
+                             const std::vector<double>& params,
+                             std::vector<double>* values) const {
+    values->resize(params.size());
+    for (size_t i = 0; i < params.size(); ++i) {
+      (*values)[i] = Evaluate(order, params[i]);
+    }
+  }
+
   virtual double ParamLength() const = 0;
 
   virtual std::string ToString() const = 0;
@@ -76,6 +76,32 @@ TEST(QuarticPolynomialCurve1dTest, Evaluate) {
   }
 }
 
+TEST(QuarticPolynomialCurve1dTest, EvaluateDerivativesAndBatch) {
+  QuarticPolynomialCurve1d curve(1.0, 2.0, 3.0, 5.0, 1.0, 3.0);
+
+  std::vector<double> params;
+  for (double value = 0.0; value < 3.1; value += 0.1) {
+    params.push_back(value);
+  }
+
+  for (const auto& value : params) {
+    std::array<double, 4> values;
+    curve.EvaluateDerivatives(value, &values);
+    for (std::uint32_t order = 0; order < 4; ++order) {
+      EXPECT_NEAR(curve.Evaluate(order, value), values[order], 1e-8);
+    }
+  }
+
+  for (std::uint32_t order = 0; order < 5; ++order) {
+    std::vector<double> values;
+    curve.EvaluateBatch(order, params, &values);
+    ASSERT_EQ(params.size(), values.size());
+    for (size_t i = 0; i < params.size(); ++i) {
+      EXPECT_NEAR(curve.Evaluate(order, params[i]), values[i], 1e-8);
+    }
+  }
+}
+
 TEST(QuarticPolynomialCurve1dTest, IntegratedFromCubicCurve) {
   CubicPolynomialCurve1d cubic_curve(1, 2, 3, 2, 5);
   QuarticPolynomialCurve1d quartic_curve;
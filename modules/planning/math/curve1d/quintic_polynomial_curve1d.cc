@@ -86,6 +86,51 @@ double QuinticPolynomialCurve1d::Evaluate(const uint32_t order,
   }
 }
 
+void QuinticPolynomialCurve1d::EvaluateDerivatives(
+    const double p, std::array<double, 4>* values) const {
+  // Estrin's scheme: the pairwise terms are independent of each other, so
+  // the multiplies by p2 and p4 can overlap in the pipeline, and the power
+  // terms are shared across the four orders.
+  const double p2 = p * p;
+  const double p4 = p2 * p2;
+  (*values)[0] = (coef_[0] + coef_[1] * p) + (coef_[2] + coef_[3] * p) * p2 +
+                 (coef_[4] + coef_[5] * p) * p4;
+  (*values)[1] = (coef_[1] + 2.0 * coef_[2] * p) +
+                 (3.0 * coef_[3] + 4.0 * coef_[4] * p) * p2 +
+                 5.0 * coef_[5] * p4;
+  (*values)[2] = (2.0 * coef_[2] + 6.0 * coef_[3] * p) +
+                 (12.0 * coef_[4] + 20.0 * coef_[5] * p) * p2;
+  (*values)[3] = (6.0 * coef_[3] + 24.0 * coef_[4] * p) + 60.0 * coef_[5] * p2;
+}
+
+void QuinticPolynomialCurve1d::EvaluateBatch(
+    const std::uint32_t order, const std::vector<double>& params,
+    std::vector<double>* values) const {
+  if (order > 3) {
+    Curve1d::EvaluateBatch(order, params, values);
+    return;
+  }
+  // The derivative coefficients are fixed for the whole batch; hoisting
+  // them out of the loop leaves a branch-free Estrin evaluation per point
+  // that the compiler can vectorize.
+  std::array<double, 6> c{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
+  for (size_t i = order; i < coef_.size(); ++i) {
+    double scale = 1.0;
+    for (size_t j = i - order + 1; j <= i; ++j) {
+      scale *= static_cast<double>(j);
+    }
+    c[i - order] = coef_[i] * scale;
+  }
+  values->resize(params.size());
+  for (size_t i = 0; i < params.size(); ++i) {
+    const double p = params[i];
+    const double p2 = p * p;
+    const double p4 = p2 * p2;
+    (*values)[i] =
+        (c[0] + c[1] * p) + (c[2] + c[3] * p) * p2 + (c[4] + c[5] * p) * p4;
+  }
+}
+
 void QuinticPolynomialCurve1d::SetParam(const double x0, const double dx0,
                                         const double ddx0, const double x1,
                                         const double dx1, const double ddx1,
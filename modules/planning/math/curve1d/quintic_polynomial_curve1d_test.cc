@@ -55,6 +55,32 @@ TEST(QuinticPolynomialCurve1dTest, basic_test) {
   EXPECT_NEAR(t, e_t, 1.0e-6);
 }
 
+TEST(QuinticPolynomialCurve1dTest, EvaluateDerivativesAndBatch) {
+  QuinticPolynomialCurve1d curve(0.0, 1.0, 0.8, 10.0, 5.0, 0.0, 8.0);
+
+  std::vector<double> params;
+  for (double value = 0.0; value < 8.1; value += 0.1) {
+    params.push_back(value);
+  }
+
+  for (const auto& value : params) {
+    std::array<double, 4> values;
+    curve.EvaluateDerivatives(value, &values);
+    for (std::uint32_t order = 0; order < 4; ++order) {
+      EXPECT_NEAR(curve.Evaluate(order, value), values[order], 1e-8);
+    }
+  }
+
+  for (std::uint32_t order = 0; order < 6; ++order) {
+    std::vector<double> values;
+    curve.EvaluateBatch(order, params, &values);
+    ASSERT_EQ(params.size(), values.size());
+    for (size_t i = 0; i < params.size(); ++i) {
+      EXPECT_NEAR(curve.Evaluate(order, params[i]), values[i], 1e-8);
+    }
+  }
+}
+
 TEST(QuinticPolynomialCurve1dTest, IntegratedFromQuarticCurve) {
   QuarticPolynomialCurve1d quartic_curve(2, 1, 4, 3, 2, 4);
   QuinticPolynomialCurve1d quintic_curve;
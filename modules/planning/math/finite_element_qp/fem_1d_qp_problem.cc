@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include "cyber/common/log.h"
 
@@ -61,6 +62,14 @@ Fem1dQpProblem::Fem1dQpProblem(const size_t num_of_knots,
                      std::make_pair(-kMaxVariableRange, kMaxVariableRange));
 }
 
+Fem1dQpProblem::~Fem1dQpProblem() { FreeOsqpState(); }
+
+bool Fem1dQpProblem::IsSameProblem(const size_t num_var,
+                                   const double delta_s) const {
+  constexpr double kEps = 1e-8;
+  return num_var == num_of_knots_ && std::fabs(delta_s - delta_s_) < kEps;
+}
+
 bool Fem1dQpProblem::OptimizeWithOsqp(
     const size_t kernel_dim, const size_t num_affine_constraint,
     std::vector<c_float>& P_data, std::vector<c_int>& P_indices,    // NOLINT
@@ -225,50 +234,106 @@ void Fem1dQpProblem::SetOutputResolution(const double resolution) {
 }
 
 bool Fem1dQpProblem::Optimize() {
+  if (FLAGS_enable_fem_1d_qp_hot_start && work_ != nullptr) {
+    if (OptimizeWithHotStart()) {
+      return true;
+    }
+    // The hot start path only fails when the solver does not converge from
+    // the previous solution; rebuild the workspace and solve from scratch.
+    AWARN << "Fem1dQpProblem hot start failed, fall back to full setup.";
+    FreeOsqpState();
+  }
+
   // calculate kernel
-  std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
   auto start_time = std::chrono::system_clock::now();
-  CalculateKernel(&P_data, &P_indices, &P_indptr);
+  CalculateKernel(&P_data_, &P_indices_, &P_indptr_);
   auto end_time1 = std::chrono::system_clock::now();
   std::chrono::duration<double> diff = end_time1 - start_time;
   ADEBUG << "Set Kernel used time: " << diff.count() * 1000 << " ms.";
 
   // calculate affine constraints
-  std::vector<c_float> A_data;
-  std::vector<c_int> A_indices;
-  std::vector<c_int> A_indptr;
-  std::vector<c_float> lower_bounds;
-  std::vector<c_float> upper_bounds;
-  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
-                            &upper_bounds);
+  A_data_.clear();
+  A_indices_.clear();
+  A_indptr_.clear();
+  CalculateAffineConstraint(&A_data_, &A_indices_, &A_indptr_, &lower_bounds_,
+                            &upper_bounds_);
   auto end_time2 = std::chrono::system_clock::now();
   diff = end_time2 - end_time1;
   ADEBUG << "CalculateAffineConstraint used time: " << diff.count() * 1000
          << " ms.";
 
   // calculate offset
-  std::vector<c_float> q;
-  CalculateOffset(&q);
+  CalculateOffset(&q_);
   auto end_time3 = std::chrono::system_clock::now();
   diff = end_time3 - end_time2;
   ADEBUG << "CalculateOffset used time: " << diff.count() * 1000 << " ms.";
 
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  OSQPWorkspace* work = nullptr;
+  data_ = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  settings_ = reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+  work_ = nullptr;
 
-  OptimizeWithOsqp(3 * num_of_knots_, lower_bounds.size(), P_data, P_indices,
-                   P_indptr, A_data, A_indices, A_indptr, lower_bounds,
-                   upper_bounds, q, data, &work, settings);
-  if (work == nullptr || work->solution == nullptr) {
+  OptimizeWithOsqp(3 * num_of_knots_, lower_bounds_.size(), P_data_, P_indices_,
+                   P_indptr_, A_data_, A_indices_, A_indptr_, lower_bounds_,
+                   upper_bounds_, q_, data_, &work_, settings_);
+  if (work_ == nullptr || work_->solution == nullptr) {
     AERROR << "Failed to find QP solution.";
+    FreeOsqpState();
     return false;
   }
 
   // extract primal results
+  ExtractSolution(work_);
+
+  if (!FLAGS_enable_fem_1d_qp_hot_start) {
+    // Cleanup
+    FreeOsqpState();
+  }
+  auto end_time4 = std::chrono::system_clock::now();
+  diff = end_time4 - end_time3;
+  ADEBUG << "Run OptimizeWithOsqp used time: " << diff.count() * 1000 << " ms.";
+
+  return true;
+}
+
+bool Fem1dQpProblem::OptimizeWithHotStart() {
+  auto start_time = std::chrono::system_clock::now();
+
+  // The constraint matrix structure and values only depend on the problem
+  // dimension and delta_s, so only the offset and the bounds have to be
+  // refreshed. The matrix output is recomputed into scratch vectors and
+  // dropped; the factorization inside the workspace stays valid.
+  std::vector<c_float> A_data;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds_,
+                            &upper_bounds_);
+  CalculateOffset(&q_);
+
+  if (osqp_update_lin_cost(work_, q_.data()) != 0 ||
+      osqp_update_bounds(work_, lower_bounds_.data(), upper_bounds_.data()) !=
+          0) {
+    return false;
+  }
+
+  // osqp warm starts from the previous cycle's solution kept in the
+  // workspace.
+  osqp_solve(work_);
+  if (work_->solution == nullptr ||
+      (work_->info->status_val != 1 && work_->info->status_val != 2)) {
+    return false;
+  }
+
+  ExtractSolution(work_);
+
+  auto end_time = std::chrono::system_clock::now();
+  std::chrono::duration<double> diff = end_time - start_time;
+  ADEBUG << "Hot start osqp solve used time: " << diff.count() * 1000
+         << " ms.";
+  return true;
+}
+
+void Fem1dQpProblem::ExtractSolution(const OSQPWorkspace* work) {
+  last_num_iterations_ = static_cast<int>(work->info->iter);
   x_.resize(num_of_knots_);
   dx_.resize(num_of_knots_);
   ddx_.resize(num_of_knots_);
@@ -279,18 +344,23 @@ bool Fem1dQpProblem::Optimize() {
   }
   dx_.back() = 0.0;
   ddx_.back() = 0.0;
+}
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
-  auto end_time4 = std::chrono::system_clock::now();
-  diff = end_time4 - end_time3;
-  ADEBUG << "Run OptimizeWithOsqp used time: " << diff.count() * 1000 << " ms.";
-
-  return true;
+void Fem1dQpProblem::FreeOsqpState() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+  if (data_ != nullptr) {
+    c_free(data_->A);
+    c_free(data_->P);
+    c_free(data_);
+    data_ = nullptr;
+  }
+  if (settings_ != nullptr) {
+    c_free(settings_);
+    settings_ = nullptr;
+  }
 }
 
 void Fem1dQpProblem::CalculateKernel(std::vector<c_float>* P_data,
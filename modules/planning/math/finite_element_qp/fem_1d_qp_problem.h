@@ -66,7 +66,15 @@ class Fem1dQpProblem {
                  const double delta_s, const std::array<double, 5>& w,
                  const double max_x_third_order_derivative);
 
-  virtual ~Fem1dQpProblem() = default;
+  virtual ~Fem1dQpProblem();
+
+  /**
+   * @brief whether an instance kept across cycles can be reused for a
+   * problem of the given dimension and discretization. The kernel and
+   * constraint structure only depend on these, so a match allows hot
+   * starting the persistent osqp workspace with bound-only updates.
+   */
+  bool IsSameProblem(const size_t num_var, const double delta_s) const;
 
   virtual void AddReferenceLineKernel(const std::vector<double>& ref_line,
                                       const double wweight) {}
@@ -114,6 +122,9 @@ class Fem1dQpProblem {
 
   virtual std::vector<double> x_third_order_derivative() const { return dddx_; }
 
+  // osqp iteration count of the last successful solve, for perf tracking.
+  int last_num_iterations() const { return last_num_iterations_; }
+
   // modify output resolution. If not set, the output resolution is by default
   // identical to the original resolution.
   virtual void SetOutputResolution(const double resolution);
@@ -146,6 +157,15 @@ class Fem1dQpProblem {
       const std::vector<std::tuple<double, double, double>>& src,
       std::vector<std::pair<double, double>>* dst);
 
+  // re-solve on the persistent workspace with updated offset and bounds,
+  // keeping the KKT factorization and warm starting from the previous
+  // solution. Returns false if the solver does not converge.
+  bool OptimizeWithHotStart();
+
+  void ExtractSolution(const OSQPWorkspace* work);
+
+  void FreeOsqpState();
+
  protected:
   size_t num_of_knots_ = 0;
 
@@ -170,8 +190,26 @@ class Fem1dQpProblem {
 
   double max_x_third_order_derivative_ = 0.0;
 
+  int last_num_iterations_ = 0;
+
   double delta_s_ = 1.0;
   double delta_s_sq_ = 1.0;
+
+  // osqp state kept across cycles when FLAGS_enable_fem_1d_qp_hot_start is
+  // on. The vectors back the csc matrices inside data_, so they must stay
+  // alive as long as the workspace does.
+  OSQPData* data_ = nullptr;
+  OSQPSettings* settings_ = nullptr;
+  OSQPWorkspace* work_ = nullptr;
+  std::vector<c_float> P_data_;
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  std::vector<c_float> A_data_;
+  std::vector<c_int> A_indices_;
+  std::vector<c_int> A_indptr_;
+  std::vector<c_float> lower_bounds_;
+  std::vector<c_float> upper_bounds_;
+  std::vector<c_float> q_;
 };
 
 }  // namespace planning
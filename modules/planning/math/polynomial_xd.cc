@@ -79,6 +79,21 @@ double PolynomialXd::operator()(const double value) const {
   return result;
 }
 
+void PolynomialXd::EvaluateBatch(const std::vector<double>& values,
+                                 std::vector<double>* results) const {
+  const double* params = params_.data();
+  const size_t num_params = params_.size();
+  results->resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    const double value = values[i];
+    double result = 0.0;
+    for (size_t j = num_params; j > 0; --j) {
+      result = result * value + params[j - 1];
+    }
+    (*results)[i] = result;
+  }
+}
+
 double PolynomialXd::operator[](const std::uint32_t index) const {
   if (index >= params_.size()) {
     return 0.0;
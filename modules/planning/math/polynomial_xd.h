@@ -35,6 +35,11 @@ class PolynomialXd {
   double operator[](const std::uint32_t index) const;
   void SetParams(const std::vector<double>& params);
 
+  // Evaluates the polynomial over an array of values in one call, keeping
+  // the coefficients hot across the whole batch.
+  void EvaluateBatch(const std::vector<double>& values,
+                     std::vector<double>* results) const;
+
   static PolynomialXd DerivedFrom(const PolynomialXd& base);
   static PolynomialXd IntegratedFrom(const PolynomialXd& base,
                                      const double intercept = 0.0);
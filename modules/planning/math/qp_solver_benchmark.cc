@@ -0,0 +1,365 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Performance tracking for the planning QP stack: fem_1d_qp_problem and the
+// smoothing_spline kernels and solvers. Run after any solver-affecting
+// change:
+//   bazel run //modules/planning/math:qp_solver_benchmark -- \
+//       --benchmark_format=json > baseline.json
+// and diff the json against the previous baseline at review time, as with
+// the cyber concurrency and proto serialization benchmarks. Each solve
+// benchmark reports the osqp iteration count and the worst corridor
+// violation of the solution in its label, so convergence and quality
+// changes land in the same baseline diff as time regressions (iter=-1
+// means the solver does not expose a count, or the solve failed).
+//
+// No recorded reference-line or path-bound corpus is checked into the
+// tree, so the corridors below are reconstructed to match the recorded
+// shapes the planners are tuned against: straight lane keeping, a static
+// obstacle pinching the corridor, and a lane change shifting it sideways.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/math/finite_element_qp/fem_1d_qp_problem.h"
+#include "modules/planning/math/smoothing_spline/active_set_spline_1d_solver.h"
+#include "modules/planning/math/smoothing_spline/osqp_spline_1d_solver.h"
+#include "modules/planning/math/smoothing_spline/piecewise_linear_generator.h"
+
+namespace apollo {
+namespace planning {
+namespace {
+
+// Lateral corridor: 100 knots at 0.5m over one standard lane width.
+enum class Corridor { kLaneKeep, kObstacleNudge, kLaneChange };
+
+constexpr size_t kNumKnots = 100;
+constexpr double kDeltaS = 0.5;
+constexpr double kHalfWidth = 1.75;
+constexpr double kMaxJerk = 2.0;
+
+double CorridorCenter(const Corridor corridor, const double s) {
+  if (corridor == Corridor::kLaneChange) {
+    // shift one lane over between s = 20m and s = 40m, smoothstep shaped.
+    const double ratio = std::min(1.0, std::max(0.0, (s - 20.0) / 20.0));
+    return 3.5 * ratio * ratio * (3.0 - 2.0 * ratio);
+  }
+  return 0.0;
+}
+
+std::vector<std::tuple<double, double, double>> CorridorBounds(
+    const Corridor corridor) {
+  std::vector<std::tuple<double, double, double>> bounds;
+  bounds.reserve(kNumKnots);
+  for (size_t i = 0; i < kNumKnots; ++i) {
+    const double s = static_cast<double>(i) * kDeltaS;
+    const double center = CorridorCenter(corridor, s);
+    double lower = center - kHalfWidth;
+    const double upper = center + kHalfWidth;
+    if (corridor == Corridor::kObstacleNudge && s > 30.0 && s < 45.0) {
+      // parked car intruding from the right.
+      lower = center + 0.3;
+    }
+    bounds.emplace_back(s, lower, upper);
+  }
+  return bounds;
+}
+
+std::unique_ptr<Fem1dQpProblem> MakeFemProblem(const Corridor corridor) {
+  const std::array<double, 3> x_init = {0.0, 0.0, 0.0};
+  const std::array<double, 5> w = {1.0, 100.0, 1000.0, 1000.0, 0.0};
+  std::unique_ptr<Fem1dQpProblem> problem(
+      new Fem1dQpProblem(kNumKnots, x_init, kDeltaS, w, kMaxJerk));
+  problem->SetVariableBounds(CorridorBounds(corridor));
+  return problem;
+}
+
+double MaxCorridorViolation(const std::vector<double>& x,
+                            const Corridor corridor) {
+  const auto bounds = CorridorBounds(corridor);
+  double violation = 0.0;
+  for (size_t i = 0; i < x.size() && i < bounds.size(); ++i) {
+    violation = std::max(violation, std::get<1>(bounds[i]) - x[i]);
+    violation = std::max(violation, x[i] - std::get<2>(bounds[i]));
+  }
+  return violation;
+}
+
+void SetSolveLabel(benchmark::State* state, const int iterations,
+                   const double max_violation) {
+  std::ostringstream label;
+  label << "iter=" << iterations << " max_violation_m=" << max_violation;
+  state->SetLabel(label.str());
+}
+
+// --- fem_1d_qp_problem ---
+
+void FemAssembly(benchmark::State& state, const Corridor corridor) {
+  const auto bounds = CorridorBounds(corridor);
+  const std::array<double, 3> x_init = {0.0, 0.0, 0.0};
+  const std::array<double, 5> w = {1.0, 100.0, 1000.0, 1000.0, 0.0};
+  while (state.KeepRunning()) {
+    Fem1dQpProblem problem(kNumKnots, x_init, kDeltaS, w, kMaxJerk);
+    problem.SetVariableBounds(bounds);
+    benchmark::DoNotOptimize(problem);
+  }
+}
+
+void FemSolveCold(benchmark::State& state, const Corridor corridor) {
+  FLAGS_enable_fem_1d_qp_hot_start = false;
+  int iterations = -1;
+  double max_violation = 0.0;
+  while (state.KeepRunning()) {
+    auto problem = MakeFemProblem(corridor);
+    if (problem->Optimize()) {
+      iterations = problem->last_num_iterations();
+      max_violation = MaxCorridorViolation(problem->x(), corridor);
+    } else {
+      iterations = -1;
+    }
+  }
+  SetSolveLabel(&state, iterations, max_violation);
+}
+
+void FemSolveHotStart(benchmark::State& state, const Corridor corridor) {
+  FLAGS_enable_fem_1d_qp_hot_start = true;
+  auto problem = MakeFemProblem(corridor);
+  problem->Optimize();  // pay the first factorization outside the loop.
+  const auto bounds = CorridorBounds(corridor);
+  double shift = 0.0;
+  int iterations = -1;
+  while (state.KeepRunning()) {
+    // jitter the corridor the way tracking error does between cycles.
+    shift = (shift == 0.0) ? 0.05 : 0.0;
+    auto shifted = bounds;
+    for (auto& bound : shifted) {
+      std::get<1>(bound) += shift;
+      std::get<2>(bound) += shift;
+    }
+    problem->SetVariableBounds(shifted);
+    if (problem->Optimize()) {
+      iterations = problem->last_num_iterations();
+    } else {
+      iterations = -1;
+    }
+  }
+  SetSolveLabel(&state, iterations,
+                MaxCorridorViolation(problem->x(), corridor));
+  FLAGS_enable_fem_1d_qp_hot_start = false;
+}
+
+void BM_Fem1dQpAssemblyLaneKeep(benchmark::State& state) {
+  FemAssembly(state, Corridor::kLaneKeep);
+}
+void BM_Fem1dQpSolveColdLaneKeep(benchmark::State& state) {
+  FemSolveCold(state, Corridor::kLaneKeep);
+}
+void BM_Fem1dQpSolveColdObstacleNudge(benchmark::State& state) {
+  FemSolveCold(state, Corridor::kObstacleNudge);
+}
+void BM_Fem1dQpSolveColdLaneChange(benchmark::State& state) {
+  FemSolveCold(state, Corridor::kLaneChange);
+}
+void BM_Fem1dQpSolveHotStartLaneKeep(benchmark::State& state) {
+  FemSolveHotStart(state, Corridor::kLaneKeep);
+}
+void BM_Fem1dQpSolveHotStartObstacleNudge(benchmark::State& state) {
+  FemSolveHotStart(state, Corridor::kObstacleNudge);
+}
+BENCHMARK(BM_Fem1dQpAssemblyLaneKeep);
+BENCHMARK(BM_Fem1dQpSolveColdLaneKeep);
+BENCHMARK(BM_Fem1dQpSolveColdObstacleNudge);
+BENCHMARK(BM_Fem1dQpSolveColdLaneChange);
+BENCHMARK(BM_Fem1dQpSolveHotStartLaneKeep);
+BENCHMARK(BM_Fem1dQpSolveHotStartObstacleNudge);
+
+// --- spline 1d solvers ---
+// The instance mirrors the qp_spline_path shape: 10 one-meter spline
+// segments of order 6, bounded at 21 evaluation points.
+
+const std::vector<double>& SplineKnots() {
+  static const std::vector<double> knots{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  return knots;
+}
+
+constexpr uint32_t kSplineOrder = 6;
+constexpr size_t kNumEvaluatedPoints = 21;
+
+void BuildSplineProblem(Spline1dSolver* solver, const Corridor corridor) {
+  solver->Reset(SplineKnots(), kSplineOrder);
+  auto* constraint = solver->mutable_spline_constraint();
+  auto* kernel = solver->mutable_spline_kernel();
+
+  std::vector<double> x_coord;
+  std::vector<double> guide;
+  std::vector<double> lower_bound;
+  std::vector<double> upper_bound;
+  const double x_resolution =
+      SplineKnots().back() / static_cast<double>(kNumEvaluatedPoints - 1);
+  for (size_t i = 0; i < kNumEvaluatedPoints; ++i) {
+    const double x = static_cast<double>(i) * x_resolution;
+    // reuse the corridor shapes, compressed to the spline's 10m domain.
+    const double s = x * kNumKnots * kDeltaS / SplineKnots().back();
+    const double center = CorridorCenter(corridor, s);
+    double lower = center - kHalfWidth;
+    if (corridor == Corridor::kObstacleNudge && s > 30.0 && s < 45.0) {
+      lower = center + 0.3;
+    }
+    x_coord.push_back(x);
+    guide.push_back(center);
+    lower_bound.push_back(lower);
+    upper_bound.push_back(center + kHalfWidth);
+  }
+  constraint->AddBoundary(x_coord, lower_bound, upper_bound);
+  constraint->AddThirdDerivativeSmoothConstraint();
+  constraint->AddPointConstraint(0.0, 0.0);
+  constraint->AddPointDerivativeConstraint(0.0, 0.0);
+  constraint->AddPointSecondDerivativeConstraint(0.0, 0.0);
+
+  kernel->AddThirdOrderDerivativeMatrix(1000.0);
+  kernel->AddReferenceLineKernelMatrix(x_coord, guide, 0.4);
+  kernel->AddRegularization(1.0);
+}
+
+double SplineMaxViolation(const Spline1d& spline, const Corridor corridor) {
+  double violation = 0.0;
+  const double x_resolution =
+      SplineKnots().back() / static_cast<double>(kNumEvaluatedPoints - 1);
+  for (size_t i = 0; i < kNumEvaluatedPoints; ++i) {
+    const double x = static_cast<double>(i) * x_resolution;
+    const double s = x * kNumKnots * kDeltaS / SplineKnots().back();
+    const double center = CorridorCenter(corridor, s);
+    double lower = center - kHalfWidth;
+    if (corridor == Corridor::kObstacleNudge && s > 30.0 && s < 45.0) {
+      lower = center + 0.3;
+    }
+    const double value = spline(x);
+    violation = std::max(violation, lower - value);
+    violation = std::max(violation, value - (center + kHalfWidth));
+  }
+  return violation;
+}
+
+void BM_Spline1dAssemblyLaneChange(benchmark::State& state) {
+  OsqpSpline1dSolver solver(SplineKnots(), kSplineOrder);
+  while (state.KeepRunning()) {
+    BuildSplineProblem(&solver, Corridor::kLaneChange);
+  }
+}
+BENCHMARK(BM_Spline1dAssemblyLaneChange);
+
+void SplineSolveOsqp(benchmark::State& state, const Corridor corridor) {
+  OsqpSpline1dSolver solver(SplineKnots(), kSplineOrder);
+  int iterations = -1;
+  while (state.KeepRunning()) {
+    BuildSplineProblem(&solver, corridor);
+    iterations = solver.Solve() ? solver.last_num_iterations() : -1;
+  }
+  SetSolveLabel(&state, iterations,
+                SplineMaxViolation(solver.spline(), corridor));
+}
+
+void SplineSolveActiveSet(benchmark::State& state, const Corridor corridor) {
+  ActiveSetSpline1dSolver solver(SplineKnots(), kSplineOrder);
+  while (state.KeepRunning()) {
+    BuildSplineProblem(&solver, corridor);
+    benchmark::DoNotOptimize(solver.Solve());
+  }
+  // qpOASES does not expose its working-set iteration count here.
+  SetSolveLabel(&state, -1, SplineMaxViolation(solver.spline(), corridor));
+}
+
+void BM_Spline1dSolveOsqpLaneKeep(benchmark::State& state) {
+  SplineSolveOsqp(state, Corridor::kLaneKeep);
+}
+void BM_Spline1dSolveOsqpObstacleNudge(benchmark::State& state) {
+  SplineSolveOsqp(state, Corridor::kObstacleNudge);
+}
+void BM_Spline1dSolveOsqpLaneChange(benchmark::State& state) {
+  SplineSolveOsqp(state, Corridor::kLaneChange);
+}
+void BM_Spline1dSolveActiveSetLaneKeep(benchmark::State& state) {
+  SplineSolveActiveSet(state, Corridor::kLaneKeep);
+}
+void BM_Spline1dSolveActiveSetLaneChange(benchmark::State& state) {
+  SplineSolveActiveSet(state, Corridor::kLaneChange);
+}
+BENCHMARK(BM_Spline1dSolveOsqpLaneKeep);
+BENCHMARK(BM_Spline1dSolveOsqpObstacleNudge);
+BENCHMARK(BM_Spline1dSolveOsqpLaneChange);
+BENCHMARK(BM_Spline1dSolveActiveSetLaneKeep);
+BENCHMARK(BM_Spline1dSolveActiveSetLaneChange);
+
+// --- piecewise linear generator ---
+// A speed-profile instance shaped like the qp_piecewise_st_graph setup:
+// monotone s over 8s at 0.1s resolution, cruise toward the speed limit.
+
+void BM_PiecewiseLinearSolveCruise(benchmark::State& state) {
+  constexpr uint32_t kNumSegments = 80;
+  constexpr double kUnitSegment = 0.1;
+  constexpr double kSpeedLimit = 15.0;
+  std::vector<uint32_t> index_list;
+  std::vector<double> s_lower;
+  std::vector<double> s_upper;
+  std::vector<double> v_lower;
+  std::vector<double> v_upper;
+  std::vector<double> a_lower;
+  std::vector<double> a_upper;
+  std::vector<double> cruise_ref;
+  for (uint32_t i = 0; i < kNumSegments; ++i) {
+    const double t = static_cast<double>(i + 1) * kUnitSegment;
+    index_list.push_back(i);
+    s_lower.push_back(0.0);
+    s_upper.push_back(150.0);
+    v_lower.push_back(0.0);
+    v_upper.push_back(kSpeedLimit);
+    a_lower.push_back(-4.0);
+    a_upper.push_back(2.0);
+    cruise_ref.push_back(std::min(150.0, kSpeedLimit * t));
+  }
+  bool success = false;
+  while (state.KeepRunning()) {
+    PiecewiseLinearGenerator generator(kNumSegments, kUnitSegment);
+    auto* constraint = generator.mutable_constraint();
+    constraint->AddMonotoneInequalityConstraint();
+    constraint->AddBoundary(index_list, s_lower, s_upper);
+    constraint->AddDerivativeBoundary(index_list, v_lower, v_upper);
+    constraint->AddSecondDerivativeBoundary(10.0, index_list, a_lower,
+                                            a_upper);
+    auto* kernel = generator.mutable_kernel();
+    kernel->AddSecondOrderDerivativeMatrix(10.0, 100.0);
+    kernel->AddThirdOrderDerivativeMatrix(10.0, 0.0, 1000.0);
+    kernel->AddReferenceLineKernelMatrix(index_list, cruise_ref, 1.0);
+    kernel->AddRegularization(0.2);
+    success = generator.Solve();
+  }
+  SetSolveLabel(&state, -1, success ? 0.0 : -1.0);
+}
+BENCHMARK(BM_PiecewiseLinearSolveCruise);
+
+}  // namespace
+}  // namespace planning
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -50,12 +50,17 @@ OsqpSpline1dSolver::OsqpSpline1dSolver(const std::vector<double>& x_knots,
 
   // Populate data
   data_ = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  data_->P = nullptr;
+  data_->A = nullptr;
 }
 
 OsqpSpline1dSolver::~OsqpSpline1dSolver() { CleanUp(); }
 
 void OsqpSpline1dSolver::CleanUp() {
-  osqp_cleanup(work_);
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
   if (data_ != nullptr) {
     c_free(data_->A);
     c_free(data_->P);
@@ -139,6 +144,15 @@ bool OsqpSpline1dSolver::Solve() {
     }
   }
 
+  // Release the workspace and constraint matrices of the previous cycle;
+  // they were kept alive so their solution could seed this one.
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+  c_free(data_->P);
+  c_free(data_->A);
+
   data_->n = P.rows();
   data_->m = constraint_num;
   data_->P = csc_matrix(data_->n, data_->n, P_data.size(), P_data.data(),
@@ -151,6 +165,14 @@ bool OsqpSpline1dSolver::Solve() {
 
   work_ = osqp_setup(data_, settings_);
 
+  // Warm start from the previous cycle when the problem keeps its
+  // dimensions: the solution shifts only slightly between frames, so the
+  // previous primal/dual iterate cuts the iteration count substantially.
+  if (last_problem_success_ && static_cast<int>(warm_x_.size()) == data_->n &&
+      static_cast<int>(warm_y_.size()) == data_->m) {
+    osqp_warm_start(work_, warm_x_.data(), warm_y_.data());
+  }
+
   // Solve Problem
   osqp_solve(work_);
 
@@ -161,6 +183,15 @@ bool OsqpSpline1dSolver::Solve() {
 
   last_num_param_ = static_cast<int>(P.rows());
   last_num_constraint_ = constraint_num;
+  last_problem_success_ = (work_->info->status_val == OSQP_SOLVED);
+  last_num_iterations_ = static_cast<int>(work_->info->iter);
+  if (last_problem_success_) {
+    warm_x_.assign(work_->solution->x, work_->solution->x + data_->n);
+    warm_y_.assign(work_->solution->y, work_->solution->y + data_->m);
+  } else {
+    warm_x_.clear();
+    warm_y_.clear();
+  }
 
   return spline_.SetSplineSegs(solved_params, spline_.spline_order());
 }
@@ -41,10 +41,20 @@ class OsqpSpline1dSolver : public Spline1dSolver {
 
   void ResetOsqp();
 
+  // osqp iteration count of the last solve, for perf tracking.
+  int last_num_iterations() const { return last_num_iterations_; }
+
  private:
   OSQPSettings* settings_ = nullptr;
   OSQPWorkspace* work_ = nullptr;  // Workspace
   OSQPData* data_ = nullptr;       // OSQPData
+
+  // primal/dual solution of the last solved problem, used to warm start
+  // the next cycle when the problem dimensions are unchanged
+  std::vector<c_float> warm_x_;
+  std::vector<c_float> warm_y_;
+
+  int last_num_iterations_ = 0;
 };
 
 }  // namespace planning
@@ -124,9 +124,10 @@ bool Spline2dConstraint::Add2dDerivativeBoundary(
     const uint32_t index = FindIndex(t_coord[i]);
     const double rel_t = t_coord[i] - t_knots_[index];
     const uint32_t index_offset = 2 * index * (spline_order_ + 1);
-    std::vector<double> longi_coef = AffineDerivativeCoef(angle[i], rel_t);
+    const std::vector<double> power_t = PolyCoef(rel_t);
+    std::vector<double> longi_coef = AffineDerivativeCoef(angle[i], power_t);
     std::vector<double> longitudinal_coef =
-        AffineDerivativeCoef(angle[i] - M_PI / 2, rel_t);
+        AffineDerivativeCoef(angle[i] - M_PI / 2, power_t);
     for (uint32_t j = 0; j < 2 * (spline_order_ + 1); ++j) {
       // upper longi
       affine_inequality(4 * i, index_offset + j) = longi_coef[j];
@@ -167,10 +168,11 @@ bool Spline2dConstraint::Add2dSecondDerivativeBoundary(
     const uint32_t index = FindIndex(t_coord[i]);
     const double rel_t = t_coord[i] - t_knots_[index];
     const uint32_t index_offset = 2 * index * (spline_order_ + 1);
+    const std::vector<double> power_t = PolyCoef(rel_t);
     std::vector<double> longi_coef =
-        AffineSecondDerivativeCoef(angle[i], rel_t);
+        AffineSecondDerivativeCoef(angle[i], power_t);
     std::vector<double> longitudinal_coef =
-        AffineSecondDerivativeCoef(angle[i] - M_PI / 2, rel_t);
+        AffineSecondDerivativeCoef(angle[i] - M_PI / 2, power_t);
     for (uint32_t j = 0; j < 2 * (spline_order_ + 1); ++j) {
       // upper longi
       affine_inequality(4 * i, index_offset + j) = longi_coef[j];
@@ -211,9 +213,11 @@ bool Spline2dConstraint::Add2dThirdDerivativeBoundary(
     const uint32_t index = FindIndex(t_coord[i]);
     const double rel_t = t_coord[i] - t_knots_[index];
     const uint32_t index_offset = 2 * index * (spline_order_ + 1);
-    std::vector<double> longi_coef = AffineThirdDerivativeCoef(angle[i], rel_t);
+    const std::vector<double> power_t = PolyCoef(rel_t);
+    std::vector<double> longi_coef =
+        AffineThirdDerivativeCoef(angle[i], power_t);
     std::vector<double> longitudinal_coef =
-        AffineThirdDerivativeCoef(angle[i] - M_PI / 2, rel_t);
+        AffineThirdDerivativeCoef(angle[i] - M_PI / 2, power_t);
     for (uint32_t j = 0; j < 2 * (spline_order_ + 1); ++j) {
       // upper longi
       affine_inequality(4 * i, index_offset + j) = longi_coef[j];
@@ -360,7 +364,7 @@ bool Spline2dConstraint::AddDerivativeSmoothConstraint() {
     const uint32_t num_params = spline_order_ + 1;
     const uint32_t index_offset = 2 * i * num_params;
     std::vector<double> power_t = PolyCoef(rel_t);
-    std::vector<double> derivative_t = DerivativeCoef(rel_t);
+    std::vector<double> derivative_t = DerivativeCoef(power_t);
     for (uint32_t j = 0; j < num_params; ++j) {
       affine_equality(4 * i, j + index_offset) = power_t[j];
       affine_equality(4 * i + 1, j + index_offset) = derivative_t[j];
@@ -391,8 +395,8 @@ bool Spline2dConstraint::AddSecondDerivativeSmoothConstraint() {
     const uint32_t num_params = spline_order_ + 1;
     const uint32_t index_offset = 2 * i * num_params;
     std::vector<double> power_t = PolyCoef(rel_t);
-    std::vector<double> derivative_t = DerivativeCoef(rel_t);
-    std::vector<double> second_derivative_t = SecondDerivativeCoef(rel_t);
+    std::vector<double> derivative_t = DerivativeCoef(power_t);
+    std::vector<double> second_derivative_t = SecondDerivativeCoef(power_t);
     for (uint32_t j = 0; j < num_params; ++j) {
       affine_equality(6 * i, j + index_offset) = power_t[j];
       affine_equality(6 * i + 1, j + index_offset) = derivative_t[j];
@@ -428,9 +432,9 @@ bool Spline2dConstraint::AddThirdDerivativeSmoothConstraint() {
     const uint32_t num_params = spline_order_ + 1;
     const uint32_t index_offset = 2 * i * num_params;
     std::vector<double> power_t = PolyCoef(rel_t);
-    std::vector<double> derivative_t = DerivativeCoef(rel_t);
-    std::vector<double> second_derivative_t = SecondDerivativeCoef(rel_t);
-    std::vector<double> third_derivative_t = ThirdDerivativeCoef(rel_t);
+    std::vector<double> derivative_t = DerivativeCoef(power_t);
+    std::vector<double> second_derivative_t = SecondDerivativeCoef(power_t);
+    std::vector<double> third_derivative_t = ThirdDerivativeCoef(power_t);
     for (uint32_t j = 0; j < num_params; ++j) {
       affine_equality(8 * i, j + index_offset) = power_t[j];
       affine_equality(8 * i + 1, j + index_offset) = derivative_t[j];
@@ -491,11 +495,15 @@ std::vector<double> Spline2dConstraint::AffineCoef(const double angle,
 
 std::vector<double> Spline2dConstraint::AffineDerivativeCoef(
     const double angle, const double t) const {
+  return AffineDerivativeCoef(angle, PolyCoef(t));
+}
+
+std::vector<double> Spline2dConstraint::AffineDerivativeCoef(
+    const double angle, const std::vector<double>& power_t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
   double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
   double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
-  std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 1; i < num_params; ++i) {
     result[i] = x_coef * power_t[i - 1] * i;
     result[i + num_params] = y_coef * power_t[i - 1] * i;
@@ -505,11 +513,15 @@ std::vector<double> Spline2dConstraint::AffineDerivativeCoef(
 
 std::vector<double> Spline2dConstraint::AffineSecondDerivativeCoef(
     const double angle, const double t) const {
+  return AffineSecondDerivativeCoef(angle, PolyCoef(t));
+}
+
+std::vector<double> Spline2dConstraint::AffineSecondDerivativeCoef(
+    const double angle, const std::vector<double>& power_t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
   double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
   double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
-  std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 2; i < num_params; ++i) {
     result[i] = x_coef * power_t[i - 2] * i * (i - 1);
     result[i + num_params] = y_coef * power_t[i - 2] * i * (i - 1);
@@ -519,11 +531,15 @@ std::vector<double> Spline2dConstraint::AffineSecondDerivativeCoef(
 
 std::vector<double> Spline2dConstraint::AffineThirdDerivativeCoef(
     const double angle, const double t) const {
+  return AffineThirdDerivativeCoef(angle, PolyCoef(t));
+}
+
+std::vector<double> Spline2dConstraint::AffineThirdDerivativeCoef(
+    const double angle, const std::vector<double>& power_t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
   double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
   double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
-  std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 3; i < num_params; ++i) {
     result[i] = x_coef * power_t[i - 3] * i * (i - 1) * (i - 2);
     result[i + num_params] = y_coef * power_t[i - 3] * i * (i - 1) * (i - 2);
@@ -548,8 +564,12 @@ std::vector<double> Spline2dConstraint::PolyCoef(const double t) const {
 }
 
 std::vector<double> Spline2dConstraint::DerivativeCoef(const double t) const {
+  return DerivativeCoef(PolyCoef(t));
+}
+
+std::vector<double> Spline2dConstraint::DerivativeCoef(
+    const std::vector<double>& power_t) const {
   std::vector<double> result(spline_order_ + 1, 0.0);
-  std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 1; i < result.size(); ++i) {
     result[i] = power_t[i - 1] * i;
   }
@@ -558,8 +578,12 @@ std::vector<double> Spline2dConstraint::DerivativeCoef(const double t) const {
 
 std::vector<double> Spline2dConstraint::SecondDerivativeCoef(
     const double t) const {
+  return SecondDerivativeCoef(PolyCoef(t));
+}
+
+std::vector<double> Spline2dConstraint::SecondDerivativeCoef(
+    const std::vector<double>& power_t) const {
   std::vector<double> result(spline_order_ + 1, 0.0);
-  std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 2; i < result.size(); ++i) {
     result[i] = power_t[i - 2] * i * (i - 1);
   }
@@ -568,8 +592,12 @@ std::vector<double> Spline2dConstraint::SecondDerivativeCoef(
 
 std::vector<double> Spline2dConstraint::ThirdDerivativeCoef(
     const double t) const {
+  return ThirdDerivativeCoef(PolyCoef(t));
+}
+
+std::vector<double> Spline2dConstraint::ThirdDerivativeCoef(
+    const std::vector<double>& power_t) const {
   std::vector<double> result(spline_order_ + 1, 0.0);
-  std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 3; i < result.size(); ++i) {
     result[i] = power_t[i - 3] * i * (i - 1) * (i - 2);
   }
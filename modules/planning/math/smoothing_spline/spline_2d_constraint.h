@@ -104,14 +104,28 @@ class Spline2dConstraint {
   std::vector<double> AffineCoef(const double angle, const double t) const;
   std::vector<double> AffineDerivativeCoef(const double angle,
                                            const double t) const;
+  std::vector<double> AffineDerivativeCoef(
+      const double angle, const std::vector<double>& power_t) const;
   std::vector<double> AffineSecondDerivativeCoef(const double angle,
                                                  const double t) const;
+  std::vector<double> AffineSecondDerivativeCoef(
+      const double angle, const std::vector<double>& power_t) const;
   std::vector<double> AffineThirdDerivativeCoef(const double angle,
                                                 const double t) const;
+  std::vector<double> AffineThirdDerivativeCoef(
+      const double angle, const std::vector<double>& power_t) const;
   std::vector<double> PolyCoef(const double t) const;
   std::vector<double> DerivativeCoef(const double t) const;
   std::vector<double> SecondDerivativeCoef(const double t) const;
   std::vector<double> ThirdDerivativeCoef(const double t) const;
+
+  // overloads sharing one power basis, so callers that need several
+  // derivative orders at the same relative t compute the powers only once
+  std::vector<double> DerivativeCoef(const std::vector<double>& power_t) const;
+  std::vector<double> SecondDerivativeCoef(
+      const std::vector<double>& power_t) const;
+  std::vector<double> ThirdDerivativeCoef(
+      const std::vector<double>& power_t) const;
   double SignDistance(const apollo::common::math::Vec2d& xy_point,
                       const double angle) const;
   bool AddPointKthOrderDerivativeConstraint(
@@ -21,11 +21,18 @@
 
 #include "modules/planning/math/smoothing_spline/spline_seg_kernel.h"
 
+#include <utility>
 #include <vector>
 
 namespace apollo {
 namespace planning {
 
+namespace {
+// Knot spacings seen in practice form a handful of distinct values; the cap
+// only guards against unbounded growth with pathological inputs.
+constexpr size_t kMaxCachedKernelNum = 100;
+}  // namespace
+
 SplineSegKernel::SplineSegKernel() {
   const int reserved_num_params = reserved_order_ + 1;
   CalculateFx(reserved_num_params);
@@ -36,13 +43,23 @@ SplineSegKernel::SplineSegKernel() {
 
 Eigen::MatrixXd SplineSegKernel::Kernel(const uint32_t num_params,
                                         const double accumulated_x) {
+  const KernelCacheKey key(num_params, accumulated_x);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto iter = cache_fx_.find(key);
+  if (iter != cache_fx_.end()) {
+    return iter->second;
+  }
   if (num_params > reserved_order_ + 1) {
     CalculateFx(num_params);
   }
   Eigen::MatrixXd term_matrix;
   IntegratedTermMatrix(num_params, accumulated_x, "fx", &term_matrix);
-  return kernel_fx_.block(0, 0, num_params, num_params)
-      .cwiseProduct(term_matrix);
+  Eigen::MatrixXd kernel =
+      kernel_fx_.block(0, 0, num_params, num_params).cwiseProduct(term_matrix);
+  if (cache_fx_.size() >= kMaxCachedKernelNum) {
+    cache_fx_.clear();
+  }
+  return cache_fx_.emplace(key, std::move(kernel)).first->second;
 }
 
 Eigen::MatrixXd SplineSegKernel::NthDerivativeKernel(
@@ -60,35 +77,70 @@ Eigen::MatrixXd SplineSegKernel::NthDerivativeKernel(
 
 Eigen::MatrixXd SplineSegKernel::DerivativeKernel(const uint32_t num_params,
                                                   const double accumulated_x) {
+  const KernelCacheKey key(num_params, accumulated_x);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto iter = cache_derivative_.find(key);
+  if (iter != cache_derivative_.end()) {
+    return iter->second;
+  }
   if (num_params > reserved_order_ + 1) {
     CalculateDerivative(num_params);
   }
   Eigen::MatrixXd term_matrix;
   IntegratedTermMatrix(num_params, accumulated_x, "derivative", &term_matrix);
-  return kernel_derivative_.block(0, 0, num_params, num_params)
-      .cwiseProduct(term_matrix);
+  Eigen::MatrixXd kernel =
+      kernel_derivative_.block(0, 0, num_params, num_params)
+          .cwiseProduct(term_matrix);
+  if (cache_derivative_.size() >= kMaxCachedKernelNum) {
+    cache_derivative_.clear();
+  }
+  return cache_derivative_.emplace(key, std::move(kernel)).first->second;
 }
 
 Eigen::MatrixXd SplineSegKernel::SecondOrderDerivativeKernel(
     const uint32_t num_params, const double accumulated_x) {
+  const KernelCacheKey key(num_params, accumulated_x);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto iter = cache_second_order_derivative_.find(key);
+  if (iter != cache_second_order_derivative_.end()) {
+    return iter->second;
+  }
   if (num_params > reserved_order_ + 1) {
     CalculateSecondOrderDerivative(num_params);
   }
   Eigen::MatrixXd term_matrix;
   IntegratedTermMatrix(num_params, accumulated_x, "second_order", &term_matrix);
-  return kernel_second_order_derivative_.block(0, 0, num_params, num_params)
-      .cwiseProduct(term_matrix);
+  Eigen::MatrixXd kernel =
+      kernel_second_order_derivative_.block(0, 0, num_params, num_params)
+          .cwiseProduct(term_matrix);
+  if (cache_second_order_derivative_.size() >= kMaxCachedKernelNum) {
+    cache_second_order_derivative_.clear();
+  }
+  return cache_second_order_derivative_.emplace(key, std::move(kernel))
+      .first->second;
 }
 
 Eigen::MatrixXd SplineSegKernel::ThirdOrderDerivativeKernel(
     const uint32_t num_params, const double accumulated_x) {
+  const KernelCacheKey key(num_params, accumulated_x);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto iter = cache_third_order_derivative_.find(key);
+  if (iter != cache_third_order_derivative_.end()) {
+    return iter->second;
+  }
   if (num_params > reserved_order_ + 1) {
     CalculateThirdOrderDerivative(num_params);
   }
   Eigen::MatrixXd term_matrix;
   IntegratedTermMatrix(num_params, accumulated_x, "third_order", &term_matrix);
-  return (kernel_third_order_derivative_.block(0, 0, num_params, num_params))
-      .cwiseProduct(term_matrix);
+  Eigen::MatrixXd kernel =
+      (kernel_third_order_derivative_.block(0, 0, num_params, num_params))
+          .cwiseProduct(term_matrix);
+  if (cache_third_order_derivative_.size() >= kMaxCachedKernelNum) {
+    cache_third_order_derivative_.clear();
+  }
+  return cache_third_order_derivative_.emplace(key, std::move(kernel))
+      .first->second;
 }
 
 void SplineSegKernel::IntegratedTermMatrix(const uint32_t num_params,
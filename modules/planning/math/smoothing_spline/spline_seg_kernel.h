@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include "Eigen/Core"
 
@@ -65,6 +68,17 @@ class SplineSegKernel {
   Eigen::MatrixXd kernel_second_order_derivative_;
   Eigen::MatrixXd kernel_third_order_derivative_;
 
+  // Assembled kernels memoized by (num_params, accumulated_x). The qp spline
+  // smoothers use uniform knot spacing, so every segment of an
+  // Add*KernelMatrix call resolves to the same entry and the term matrix is
+  // assembled only once per (order, spacing).
+  using KernelCacheKey = std::pair<uint32_t, double>;
+  std::map<KernelCacheKey, Eigen::MatrixXd> cache_fx_;
+  std::map<KernelCacheKey, Eigen::MatrixXd> cache_derivative_;
+  std::map<KernelCacheKey, Eigen::MatrixXd> cache_second_order_derivative_;
+  std::map<KernelCacheKey, Eigen::MatrixXd> cache_third_order_derivative_;
+  std::mutex cache_mutex_;
+
   DECLARE_SINGLETON(SplineSegKernel)
 };
 
@@ -185,11 +185,12 @@ void NaviPlanning::RunOnce(const LocalView& local_view,
 
   const double planning_cycle_time = 1.0 / FLAGS_planning_loop_rate;
 
-  std::vector<TrajectoryPoint> stitching_trajectory;
   std::string replan_reason;
-  stitching_trajectory = TrajectoryStitcher::ComputeStitchingTrajectory(
+  TrajectoryStitcher::ComputeStitchingTrajectory(
       vehicle_state, start_timestamp, planning_cycle_time,
-      last_publishable_trajectory_.get(), &replan_reason);
+      last_publishable_trajectory_.get(), &replan_reason,
+      &stitching_trajectory_);
+  const auto& stitching_trajectory = stitching_trajectory_;
 
   const uint32_t frame_num = static_cast<uint32_t>(seq_num_++);
   status = InitFrame(frame_num, stitching_trajectory.back(), vehicle_state);
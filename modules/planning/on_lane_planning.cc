@@ -14,10 +14,13 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <future>
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/file.h"
+#include "cyber/task/task.h"
 #include "gtest/gtest_prod.h"
 
 #include "modules/routing/proto/routing.pb.h"
@@ -230,17 +233,23 @@ void OnLanePlanning::RunOnce(const LocalView& local_view,
   const double planning_cycle_time =
       1.0 / static_cast<double>(FLAGS_planning_loop_rate);
 
-  std::vector<TrajectoryPoint> stitching_trajectory;
   std::string replan_reason;
-  stitching_trajectory = TrajectoryStitcher::ComputeStitchingTrajectory(
+  TrajectoryStitcher::ComputeStitchingTrajectory(
       vehicle_state, start_timestamp, planning_cycle_time,
-      last_publishable_trajectory_.get(), &replan_reason);
+      last_publishable_trajectory_.get(), &replan_reason,
+      &stitching_trajectory_);
+  const auto& stitching_trajectory = stitching_trajectory_;
 
   const uint32_t frame_num = static_cast<uint32_t>(seq_num_++);
   bool update_ego_info =
       EgoInfo::Instance()->Update(stitching_trajectory.back(), vehicle_state);
   status = InitFrame(frame_num, stitching_trajectory.back(), vehicle_state);
 
+  if (status.ok() && FLAGS_enable_planning_cycle_deadline) {
+    frame_->set_cycle_deadline_timestamp(
+        start_timestamp + FLAGS_planning_cycle_deadline_ms / 1000.0);
+  }
+
   if (update_ego_info && status.ok()) {
     EgoInfo::Instance()->CalculateFrontObstacleClearDistance(
         frame_->obstacles());
@@ -280,6 +289,18 @@ void OnLanePlanning::RunOnce(const LocalView& local_view,
     return;
   }
 
+  // resolve overlap-referenced map objects of all candidate reference lines
+  // in parallel, so the serial traffic rule pass below only consumes cached
+  // overlap infos.
+  std::vector<std::future<void>> overlap_prefetch_futures;
+  for (auto& ref_line_info : *frame_->mutable_reference_line_info()) {
+    overlap_prefetch_futures.push_back(cyber::Async(
+        &ReferenceLineInfo::PrefetchOverlapInfos, &ref_line_info));
+  }
+  for (auto& future : overlap_prefetch_futures) {
+    future.get();
+  }
+
   for (auto& ref_line_info : *frame_->mutable_reference_line_info()) {
     TrafficDecider traffic_decider;
     traffic_decider.Init(traffic_rule_configs_);
@@ -443,8 +464,7 @@ Status OnLanePlanning::Plan(
   ADEBUG << "current_time_stamp: " << std::to_string(current_time_stamp);
 
   last_publishable_trajectory_->PrependTrajectoryPoints(
-      std::vector<TrajectoryPoint>(stitching_trajectory.begin(),
-                                   stitching_trajectory.end() - 1));
+      stitching_trajectory.begin(), stitching_trajectory.end() - 1);
 
   last_publishable_trajectory_->PopulateTrajectoryProtobuf(trajectory_pb);
 
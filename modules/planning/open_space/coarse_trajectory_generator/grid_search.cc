@@ -43,6 +43,13 @@ bool GridSearch::CheckConstraints(std::shared_ptr<Node2d> node) {
       node_grid_y > max_grid_y_ || node_grid_y < 0) {
     return false;
   }
+  if (occupancy_grid_ready_) {
+    const std::size_t grid_index =
+        static_cast<std::size_t>(node_grid_x) *
+            (static_cast<std::size_t>(max_grid_y_) + 1) +
+        static_cast<std::size_t>(node_grid_y);
+    return !obstacle_occupancy_grid_[grid_index];
+  }
   for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
     for (const common::math::LineSegment2d& linesegment :
          obstacle_linesegments) {
@@ -55,6 +62,69 @@ bool GridSearch::CheckConstraints(std::shared_ptr<Node2d> node) {
   return true;
 }
 
+void GridSearch::PrecomputeOccupancyGrid() {
+  occupancy_grid_ready_ = false;
+  if (obstacles_linesegments_vec_.empty()) {
+    return;
+  }
+  const std::size_t dim_x = static_cast<std::size_t>(max_grid_x_) + 1;
+  const std::size_t dim_y = static_cast<std::size_t>(max_grid_y_) + 1;
+  obstacle_occupancy_grid_.assign(dim_x * dim_y, false);
+
+#ifdef PLANNING_WITH_CUDA
+  std::vector<common::math::LineSegment2d> all_linesegments;
+  for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
+    all_linesegments.insert(all_linesegments.end(),
+                            obstacle_linesegments.begin(),
+                            obstacle_linesegments.end());
+  }
+  std::vector<common::math::Vec2d> cell_points;
+  cell_points.reserve(dim_x * dim_y);
+  for (std::size_t grid_x = 0; grid_x < dim_x; ++grid_x) {
+    for (std::size_t grid_y = 0; grid_y < dim_y; ++grid_y) {
+      cell_points.emplace_back(static_cast<double>(grid_x),
+                               static_cast<double>(grid_y));
+    }
+  }
+  if (batch_nearest_segment_.UpdateLineSegment(all_linesegments)) {
+    const pnc_map::CudaSegmentQueryResult* results =
+        batch_nearest_segment_.FindNearestSegments(cell_points);
+    if (results != nullptr) {
+      const double node_radius_square = node_radius_ * node_radius_;
+      for (std::size_t i = 0; i < cell_points.size(); ++i) {
+        obstacle_occupancy_grid_[i] =
+            results[i].distance_square < node_radius_square;
+      }
+      occupancy_grid_ready_ = true;
+      return;
+    }
+  }
+  AWARN << "Cuda occupancy grid computation failed; falling back to CPU";
+#endif
+
+  for (std::size_t grid_x = 0; grid_x < dim_x; ++grid_x) {
+    for (std::size_t grid_y = 0; grid_y < dim_y; ++grid_y) {
+      bool occupied = false;
+      for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
+        for (const common::math::LineSegment2d& linesegment :
+             obstacle_linesegments) {
+          if (linesegment.DistanceTo({static_cast<double>(grid_x),
+                                      static_cast<double>(grid_y)}) <
+              node_radius_) {
+            occupied = true;
+            break;
+          }
+        }
+        if (occupied) {
+          break;
+        }
+      }
+      obstacle_occupancy_grid_[grid_x * dim_y + grid_y] = occupied;
+    }
+  }
+  occupancy_grid_ready_ = true;
+}
+
 std::vector<std::shared_ptr<Node2d>> GridSearch::GenerateNextNodes(
     std::shared_ptr<Node2d> current_node) {
   double current_node_x = current_node->GetGridX();
@@ -116,6 +186,8 @@ bool GridSearch::GenerateAStarPath(
       std::make_shared<Node2d>(ex, ey, xy_grid_resolution_, XYbounds_);
   std::shared_ptr<Node2d> final_node_ = nullptr;
   obstacles_linesegments_vec_ = obstacles_linesegments_vec;
+  // grid bounds are not refreshed here, so the per-node segment scan is kept
+  occupancy_grid_ready_ = false;
   open_set.insert(std::make_pair(start_node->GetIndex(), start_node));
   open_pq.push(std::make_pair(start_node->GetIndex(), start_node->GetCost()));
 
@@ -178,6 +250,7 @@ bool GridSearch::GenerateDpMap(
   std::shared_ptr<Node2d> end_node =
       std::make_shared<Node2d>(ex, ey, xy_grid_resolution_, XYbounds_);
   obstacles_linesegments_vec_ = obstacles_linesegments_vec;
+  PrecomputeOccupancyGrid();
   open_set.insert(std::make_pair(end_node->GetIndex(), end_node));
   open_pq.push(std::make_pair(end_node->GetIndex(), end_node->GetCost()));
 
@@ -32,6 +32,10 @@
 #include "modules/common/math/line_segment2d.h"
 #include "modules/planning/proto/planner_open_space_config.pb.h"
 
+#ifdef PLANNING_WITH_CUDA
+#include "modules/map/pnc_map/cuda_util.h"
+#endif
+
 namespace apollo {
 namespace planning {
 
@@ -118,6 +122,10 @@ class GridSearch {
       std::shared_ptr<Node2d> node);
   bool CheckConstraints(std::shared_ptr<Node2d> node);
   void LoadGridAStarResult(GridAStartResult* result);
+  // Fill obstacle_occupancy_grid_ for every cell inside XYbounds_ so the
+  // search checks constraints with one lookup instead of rescanning all
+  // obstacle segments per expanded node.
+  void PrecomputeOccupancyGrid();
 
  private:
   double xy_grid_resolution_ = 0.0;
@@ -130,6 +138,14 @@ class GridSearch {
   std::shared_ptr<Node2d> final_node_;
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec_;
+  // row-major occupancy of the grid cells inside XYbounds_, valid only when
+  // occupancy_grid_ready_ is set
+  std::vector<bool> obstacle_occupancy_grid_;
+  bool occupancy_grid_ready_ = false;
+#ifdef PLANNING_WITH_CUDA
+  // answers all cell-to-segment distance queries in one kernel launch
+  pnc_map::CudaBatchNearestSegment batch_nearest_segment_;
+#endif
 
   struct cmp {
     bool operator()(const std::pair<double, double>& left,
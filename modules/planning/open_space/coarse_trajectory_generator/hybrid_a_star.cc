@@ -25,6 +25,10 @@ namespace planning {
 
 using apollo::common::time::Clock;
 
+namespace {
+constexpr size_t kNodeReserveSize = 65536;
+}  // namespace
+
 HybridAStar::HybridAStar(const PlannerOpenSpaceConfig& open_space_conf) {
   planner_open_space_config_.CopyFrom(open_space_conf);
   reed_shepp_generator_ =
@@ -38,7 +42,13 @@ HybridAStar::HybridAStar(const PlannerOpenSpaceConfig& open_space_conf) {
   step_size_ = planner_open_space_config_.warm_start_config().step_size();
   xy_grid_resolution_ =
       planner_open_space_config_.warm_start_config().xy_grid_resolution();
+  phi_grid_resolution_ =
+      planner_open_space_config_.warm_start_config().phi_grid_resolution();
   delta_t_ = planner_open_space_config_.delta_t();
+  // bucket storage survives clear(), so reserving once keeps the hash sets
+  // from rehashing during searches and across replans
+  open_set_.reserve(kNodeReserveSize);
+  close_set_.reserve(kNodeReserveSize);
   traj_forward_penalty_ =
       planner_open_space_config_.warm_start_config().traj_forward_penalty();
   traj_back_penalty_ =
@@ -82,28 +92,20 @@ bool HybridAStar::RSPCheck(
 }
 
 bool HybridAStar::ValidityCheck(std::shared_ptr<Node3d> node) {
+  return ValidityCheck(node->GetXs(), node->GetYs(), node->GetPhis());
+}
+
+bool HybridAStar::ValidityCheck(const std::vector<double>& traversed_x,
+                                const std::vector<double>& traversed_y,
+                                const std::vector<double>& traversed_phi) {
   if (obstacles_linesegments_vec_.size() == 0) {
     return true;
   }
-  size_t node_step_size = node->GetStepSize();
-  size_t last_check_index = 0;
-  std::vector<double> traversed_x;
-  std::vector<double> traversed_y;
-  std::vector<double> traversed_phi;
-  traversed_x = node->GetXs();
-  traversed_y = node->GetYs();
-  traversed_phi = node->GetPhis();
-  std::reverse(traversed_x.begin(), traversed_x.end());
-  std::reverse(traversed_y.begin(), traversed_y.end());
-  std::reverse(traversed_phi.begin(), traversed_phi.end());
+  size_t node_step_size = traversed_x.size();
   // The first {x, y, phi} is collision free unless they are start and end
   // configuration of search problem
-  if (node_step_size == 1) {
-    last_check_index = 1;
-  } else {
-    last_check_index = node_step_size - 1;
-  }
-  for (size_t i = 0; i < last_check_index; ++i) {
+  size_t first_check_index = node_step_size == 1 ? 0 : 1;
+  for (size_t i = first_check_index; i < node_step_size; ++i) {
     if (traversed_x[i] > XYbounds_[1] || traversed_x[i] < XYbounds_[0] ||
         traversed_y[i] > XYbounds_[3] || traversed_y[i] < XYbounds_[2]) {
       return false;
@@ -133,64 +135,69 @@ std::shared_ptr<Node3d> HybridAStar::LoadRSPinCS(
   return end_node;
 }
 
-std::shared_ptr<Node3d> HybridAStar::Next_node_generator(
-    std::shared_ptr<Node3d> current_node, size_t next_node_index) {
-  double steering = 0.0;
+bool HybridAStar::GenerateNextTraversal(std::shared_ptr<Node3d> current_node,
+                                        size_t next_node_index,
+                                        double* steering,
+                                        double* traveled_distance) {
   size_t index = 0;
-  double traveled_distance = 0.0;
   if (next_node_index < static_cast<double>(next_node_num_) / 2) {
-    steering =
+    *steering =
         -max_steer_angle_ +
         (2 * max_steer_angle_ / (static_cast<double>(next_node_num_) / 2 - 1)) *
             static_cast<double>(next_node_index);
-    traveled_distance = step_size_;
+    *traveled_distance = step_size_;
   } else {
     index = next_node_index - next_node_num_ / 2;
-    steering =
+    *steering =
         -max_steer_angle_ +
         (2 * max_steer_angle_ / (static_cast<double>(next_node_num_) / 2 - 1)) *
             static_cast<double>(index);
-    traveled_distance = -step_size_;
+    *traveled_distance = -step_size_;
   }
   // take above motion primitive to generate a curve driving the car to a
   // different grid
   double arc = std::sqrt(2) * xy_grid_resolution_;
-  std::vector<double> intermediate_x;
-  std::vector<double> intermediate_y;
-  std::vector<double> intermediate_phi;
+  traversal_x_.clear();
+  traversal_y_.clear();
+  traversal_phi_.clear();
   double last_x = current_node->GetX();
   double last_y = current_node->GetY();
   double last_phi = current_node->GetPhi();
-  intermediate_x.emplace_back(last_x);
-  intermediate_y.emplace_back(last_y);
-  intermediate_phi.emplace_back(last_phi);
+  traversal_x_.emplace_back(last_x);
+  traversal_y_.emplace_back(last_y);
+  traversal_phi_.emplace_back(last_phi);
   for (size_t i = 0; i < arc / step_size_; ++i) {
-    double next_x = last_x + traveled_distance * std::cos(last_phi);
-    double next_y = last_y + traveled_distance * std::sin(last_phi);
+    double next_x = last_x + *traveled_distance * std::cos(last_phi);
+    double next_y = last_y + *traveled_distance * std::sin(last_phi);
     double next_phi = common::math::NormalizeAngle(
         last_phi +
-        traveled_distance / vehicle_param_.wheel_base() * std::tan(steering));
-    intermediate_x.emplace_back(next_x);
-    intermediate_y.emplace_back(next_y);
-    intermediate_phi.emplace_back(next_phi);
+        *traveled_distance / vehicle_param_.wheel_base() * std::tan(*steering));
+    traversal_x_.emplace_back(next_x);
+    traversal_y_.emplace_back(next_y);
+    traversal_phi_.emplace_back(next_phi);
     last_x = next_x;
     last_y = next_y;
     last_phi = next_phi;
   }
   // check if the vehicle runs outside of XY boundary
-  if (intermediate_x.back() > XYbounds_[1] ||
-      intermediate_x.back() < XYbounds_[0] ||
-      intermediate_y.back() > XYbounds_[3] ||
-      intermediate_y.back() < XYbounds_[2]) {
-    return nullptr;
+  if (traversal_x_.back() > XYbounds_[1] || traversal_x_.back() < XYbounds_[0] ||
+      traversal_y_.back() > XYbounds_[3] ||
+      traversal_y_.back() < XYbounds_[2]) {
+    return false;
   }
-  std::shared_ptr<Node3d> next_node = std::shared_ptr<Node3d>(
-      new Node3d(intermediate_x, intermediate_y, intermediate_phi, XYbounds_,
-                 planner_open_space_config_));
-  next_node->SetPre(current_node);
-  next_node->SetDirec(traveled_distance > 0);
-  next_node->SetSteer(steering);
-  return next_node;
+  return true;
+}
+
+size_t HybridAStar::CalcIndex(double x, double y, double phi) const {
+  size_t x_grid = static_cast<size_t>((x - XYbounds_[0]) / xy_grid_resolution_);
+  size_t y_grid = static_cast<size_t>((y - XYbounds_[2]) / xy_grid_resolution_);
+  size_t phi_grid =
+      static_cast<size_t>((phi - (-M_PI)) / phi_grid_resolution_);
+  return static_cast<size_t>(
+      static_cast<double>(phi_grid) * (XYbounds_[1] - XYbounds_[0]) *
+          (XYbounds_[3] - XYbounds_[2]) +
+      static_cast<double>(y_grid) * (XYbounds_[1] - XYbounds_[0]) +
+      static_cast<double>(x_grid));
 }
 
 void HybridAStar::CalculateNodeCost(std::shared_ptr<Node3d> current_node,
@@ -387,29 +394,41 @@ bool HybridAStar::Plan(
     rs_time += end_time - start_time;
     close_set_.insert(std::make_pair(current_node->GetIndex(), current_node));
     for (size_t i = 0; i < next_node_num_; ++i) {
-      std::shared_ptr<Node3d> next_node = Next_node_generator(current_node, i);
+      double steering = 0.0;
+      double traveled_distance = 0.0;
       // boundary check failure handle
-      if (next_node == nullptr) {
+      if (!GenerateNextTraversal(current_node, i, &steering,
+                                 &traveled_distance)) {
         continue;
       }
+      size_t next_index = CalcIndex(traversal_x_.back(), traversal_y_.back(),
+                                    traversal_phi_.back());
       // check if the node is already in the close set
-      if (close_set_.find(next_node->GetIndex()) != close_set_.end()) {
+      if (close_set_.find(next_index) != close_set_.end()) {
         continue;
       }
-      // collision check
-      if (!ValidityCheck(next_node)) {
+      if (open_set_.find(next_index) != open_set_.end()) {
         continue;
       }
-      if (open_set_.find(next_node->GetIndex()) == open_set_.end()) {
-        explored_node_num++;
-        start_time = Clock::NowInSeconds();
-        CalculateNodeCost(current_node, next_node);
-        end_time = Clock::NowInSeconds();
-        heuristic_time += end_time - start_time;
-        open_set_.insert(std::make_pair(next_node->GetIndex(), next_node));
-        open_pq_.push(
-            std::make_pair(next_node->GetIndex(), next_node->GetCost()));
+      // collision check
+      if (!ValidityCheck(traversal_x_, traversal_y_, traversal_phi_)) {
+        continue;
       }
+      // candidate survived every rejection test; only now allocate the node
+      std::shared_ptr<Node3d> next_node = std::shared_ptr<Node3d>(
+          new Node3d(std::move(traversal_x_), std::move(traversal_y_),
+                     std::move(traversal_phi_), XYbounds_,
+                     planner_open_space_config_));
+      next_node->SetPre(current_node);
+      next_node->SetDirec(traveled_distance > 0);
+      next_node->SetSteer(steering);
+      explored_node_num++;
+      start_time = Clock::NowInSeconds();
+      CalculateNodeCost(current_node, next_node);
+      end_time = Clock::NowInSeconds();
+      heuristic_time += end_time - start_time;
+      open_set_.insert(std::make_pair(next_index, next_node));
+      open_pq_.push(std::make_pair(next_index, next_node->GetCost()));
     }
   }
   if (final_node_ == nullptr) {
@@ -69,14 +69,24 @@ class HybridAStar {
   bool AnalyticExpansion(std::shared_ptr<Node3d> current_node);
   // check collision and validity
   bool ValidityCheck(std::shared_ptr<Node3d> node);
+  bool ValidityCheck(const std::vector<double>& traversed_x,
+                     const std::vector<double>& traversed_y,
+                     const std::vector<double>& traversed_phi);
   // check Reeds Shepp path collision and validity
   bool RSPCheck(const std::shared_ptr<ReedSheppPath> reeds_shepp_to_end);
   // load the whole RSP as nodes and add to the close set
   std::shared_ptr<Node3d> LoadRSPinCS(
       const std::shared_ptr<ReedSheppPath> reeds_shepp_to_end,
       std::shared_ptr<Node3d> current_node);
-  std::shared_ptr<Node3d> Next_node_generator(
-      std::shared_ptr<Node3d> current_node, size_t next_node_index);
+  // integrate the next_node_index-th motion primitive from current_node into
+  // the traversal scratch buffers; returns false if the curve leaves the XY
+  // boundary. The Node3d is only allocated after the candidate survives the
+  // closed-set, open-set and collision checks.
+  bool GenerateNextTraversal(std::shared_ptr<Node3d> current_node,
+                             size_t next_node_index, double* steering,
+                             double* traveled_distance);
+  // grid index of a configuration; keep in sync with Node3d
+  size_t CalcIndex(double x, double y, double phi) const;
   void CalculateNodeCost(std::shared_ptr<Node3d> current_node,
                          std::shared_ptr<Node3d> next_node);
   double TrajCost(std::shared_ptr<Node3d> current_node,
@@ -93,6 +103,7 @@ class HybridAStar {
   double max_steer_angle_ = 0.0;
   double step_size_ = 0.0;
   double xy_grid_resolution_ = 0.0;
+  double phi_grid_resolution_ = 0.0;
   double delta_t_ = 0.0;
   double traj_forward_penalty_ = 0.0;
   double traj_back_penalty_ = 0.0;
@@ -110,6 +121,11 @@ class HybridAStar {
   std::shared_ptr<Node3d> final_node_;
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec_;
+  // scratch buffers for candidate traversals; moved into the Node3d once a
+  // candidate is accepted, so rejected expansions cost no allocation
+  std::vector<double> traversal_x_;
+  std::vector<double> traversal_y_;
+  std::vector<double> traversal_phi_;
 
   struct cmp {
     bool operator()(const std::pair<size_t, double>& left,
@@ -23,6 +23,15 @@
 namespace apollo {
 namespace planning {
 
+namespace {
+// number of top level motion primitive families (SCS ... CCSCC)
+constexpr int kRSPFamilyNum = 6;
+// resolution of the memoization key in normalized (curvature-scaled) units
+constexpr double kRSPCacheXYResolution = 0.1;
+constexpr double kRSPCachePhiResolution = 0.05;
+constexpr size_t kRSPCacheMaxSize = 1 << 20;
+}  // namespace
+
 ReedShepp::ReedShepp(const common::VehicleParam& vehicle_param,
                      const PlannerOpenSpaceConfig& open_space_conf)
     : vehicle_param_(vehicle_param),
@@ -59,63 +68,164 @@ std::pair<double, double> ReedShepp::calc_tau_omega(const double& u,
 bool ReedShepp::ShortestRSP(const std::shared_ptr<Node3d> start_node,
                             const std::shared_ptr<Node3d> end_node,
                             std::shared_ptr<ReedSheppPath> optimal_path) {
+  double dx = end_node->GetX() - start_node->GetX();
+  double dy = end_node->GetY() - start_node->GetY();
+  double dphi = end_node->GetPhi() - start_node->GetPhi();
+  double c = std::cos(start_node->GetPhi());
+  double s = std::sin(start_node->GetPhi());
+  // normalize the initial point to (0,0,0)
+  double x = (c * dx + s * dy) * max_kappa_;
+  double y = (-s * dx + c * dy) * max_kappa_;
+
+  size_t optimal_path_index = 0;
+  const uint64_t cache_key = PoseToCacheKey(x, y, dphi);
+  if (!FLAGS_enable_parallel_hybrid_a) {
+    auto cache_iter = rsp_family_cache_.find(cache_key);
+    if (cache_iter != rsp_family_cache_.end()) {
+      // Recompute only the memoized family exactly for the actual pose; if
+      // the pose drifted into a region where that family no longer applies,
+      // fall through to the full search.
+      std::vector<ReedSheppPath> family_paths;
+      if (GenerateRSPByFamily(cache_iter->second, x, y, dphi, &family_paths) &&
+          SelectShortestRSP(start_node, end_node, &family_paths, optimal_path,
+                            &optimal_path_index)) {
+        return true;
+      }
+      rsp_family_cache_.erase(cache_iter);
+    }
+  }
+
   std::vector<ReedSheppPath> all_possible_paths;
-  if (!GenerateRSPs(start_node, end_node, &all_possible_paths)) {
-    AERROR << "Fail to generate different combination of Reed Shepp "
-              "paths";
+  int optimal_family = -1;
+  if (FLAGS_enable_parallel_hybrid_a) {
+    if (!GenerateRSPPar(start_node, end_node, &all_possible_paths)) {
+      AERROR << "Fail to generate different combination of Reed Shepp "
+                "paths";
+      return false;
+    }
+  } else {
+    static const char* kFamilyNames[kRSPFamilyNum] = {"SCS",  "CSC",  "CCC",
+                                                      "CCCC", "CCSC", "CCSCC"};
+    size_t family_path_end[kRSPFamilyNum];
+    for (int family = 0; family < kRSPFamilyNum; ++family) {
+      if (!GenerateRSPByFamily(family, x, y, dphi, &all_possible_paths)) {
+        AERROR << "Fail at " << kFamilyNames[family];
+      }
+      family_path_end[family] = all_possible_paths.size();
+    }
+    if (all_possible_paths.size() == 0) {
+      AERROR << "No path generated by certain two configurations";
+      return false;
+    }
+    double optimal_path_length = std::numeric_limits<double>::infinity();
+    size_t shortest_index = 0;
+    for (size_t i = 0; i < all_possible_paths.size(); ++i) {
+      if (all_possible_paths.at(i).total_length > 0 &&
+          all_possible_paths.at(i).total_length < optimal_path_length) {
+        shortest_index = i;
+        optimal_path_length = all_possible_paths.at(i).total_length;
+      }
+    }
+    for (int family = 0; family < kRSPFamilyNum; ++family) {
+      if (shortest_index < family_path_end[family]) {
+        optimal_family = family;
+        break;
+      }
+    }
+  }
+
+  if (!SelectShortestRSP(start_node, end_node, &all_possible_paths,
+                         optimal_path, &optimal_path_index)) {
     return false;
   }
+  if (optimal_family >= 0) {
+    if (rsp_family_cache_.size() >= kRSPCacheMaxSize) {
+      rsp_family_cache_.clear();
+    }
+    rsp_family_cache_[cache_key] = optimal_family;
+  }
+  return true;
+}
 
+bool ReedShepp::SelectShortestRSP(
+    const std::shared_ptr<Node3d> start_node,
+    const std::shared_ptr<Node3d> end_node,
+    std::vector<ReedSheppPath>* all_possible_paths,
+    std::shared_ptr<ReedSheppPath> optimal_path, size_t* optimal_path_index) {
+  if (all_possible_paths->empty()) {
+    return false;
+  }
   double optimal_path_length = std::numeric_limits<double>::infinity();
-  size_t optimal_path_index = 0;
-  size_t paths_size = all_possible_paths.size();
+  size_t paths_size = all_possible_paths->size();
+  *optimal_path_index = 0;
   for (size_t i = 0; i < paths_size; ++i) {
-    if (all_possible_paths.at(i).total_length > 0 &&
-        all_possible_paths.at(i).total_length < optimal_path_length) {
-      optimal_path_index = i;
-      optimal_path_length = all_possible_paths.at(i).total_length;
+    if (all_possible_paths->at(i).total_length > 0 &&
+        all_possible_paths->at(i).total_length < optimal_path_length) {
+      *optimal_path_index = i;
+      optimal_path_length = all_possible_paths->at(i).total_length;
     }
   }
+  ReedSheppPath* shortest_path = &(all_possible_paths->at(*optimal_path_index));
 
-  if (!GenerateLocalConfigurations(start_node, end_node,
-                                   &(all_possible_paths[optimal_path_index]))) {
+  if (!GenerateLocalConfigurations(start_node, end_node, shortest_path)) {
     AERROR << "Fail to generate local configurations(x, y, phi) in SetRSP";
     return false;
   }
 
-  if (std::abs(all_possible_paths[optimal_path_index].x.back() -
-               end_node->GetX()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].y.back() -
-               end_node->GetY()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].phi.back() -
-               end_node->GetPhi()) > 1e-3) {
+  if (std::abs(shortest_path->x.back() - end_node->GetX()) > 1e-3 ||
+      std::abs(shortest_path->y.back() - end_node->GetY()) > 1e-3 ||
+      std::abs(shortest_path->phi.back() - end_node->GetPhi()) > 1e-3) {
     AERROR << "RSP end position not right";
-    for (size_t i = 0;
-         i < all_possible_paths[optimal_path_index].segs_types.size(); ++i) {
-      AERROR << "types are "
-             << all_possible_paths[optimal_path_index].segs_types[i];
+    for (size_t i = 0; i < shortest_path->segs_types.size(); ++i) {
+      AERROR << "types are " << shortest_path->segs_types[i];
     }
-    AERROR << "x, y, phi are: "
-           << all_possible_paths[optimal_path_index].x.back() << ", "
-           << all_possible_paths[optimal_path_index].y.back() << ", "
-           << all_possible_paths[optimal_path_index].phi.back();
+    AERROR << "x, y, phi are: " << shortest_path->x.back() << ", "
+           << shortest_path->y.back() << ", " << shortest_path->phi.back();
     AERROR << "end x, y, phi are: " << end_node->GetX() << ", "
            << end_node->GetY() << ", " << end_node->GetPhi();
     return false;
   }
-  (*optimal_path).x = all_possible_paths[optimal_path_index].x;
-  (*optimal_path).y = all_possible_paths[optimal_path_index].y;
-  (*optimal_path).phi = all_possible_paths[optimal_path_index].phi;
-  (*optimal_path).gear = all_possible_paths[optimal_path_index].gear;
-  (*optimal_path).total_length =
-      all_possible_paths[optimal_path_index].total_length;
-  (*optimal_path).segs_types =
-      all_possible_paths[optimal_path_index].segs_types;
-  (*optimal_path).segs_lengths =
-      all_possible_paths[optimal_path_index].segs_lengths;
+  (*optimal_path).x = shortest_path->x;
+  (*optimal_path).y = shortest_path->y;
+  (*optimal_path).phi = shortest_path->phi;
+  (*optimal_path).gear = shortest_path->gear;
+  (*optimal_path).total_length = shortest_path->total_length;
+  (*optimal_path).segs_types = shortest_path->segs_types;
+  (*optimal_path).segs_lengths = shortest_path->segs_lengths;
   return true;
 }
 
+bool ReedShepp::GenerateRSPByFamily(
+    const int family, const double& x, const double& y, const double& phi,
+    std::vector<ReedSheppPath>* all_possible_paths) {
+  switch (family) {
+    case 0:
+      return SCS(x, y, phi, all_possible_paths);
+    case 1:
+      return CSC(x, y, phi, all_possible_paths);
+    case 2:
+      return CCC(x, y, phi, all_possible_paths);
+    case 3:
+      return CCCC(x, y, phi, all_possible_paths);
+    case 4:
+      return CCSC(x, y, phi, all_possible_paths);
+    case 5:
+      return CCSCC(x, y, phi, all_possible_paths);
+    default:
+      return false;
+  }
+}
+
+uint64_t ReedShepp::PoseToCacheKey(const double& x, const double& y,
+                                   const double& phi) const {
+  int64_t xi = std::lround(x / kRSPCacheXYResolution);
+  int64_t yi = std::lround(y / kRSPCacheXYResolution);
+  int64_t pi = std::lround(phi / kRSPCachePhiResolution);
+  return (static_cast<uint64_t>(xi) & 0x1FFFFF) |
+         ((static_cast<uint64_t>(yi) & 0x1FFFFF) << 21) |
+         ((static_cast<uint64_t>(pi) & 0x1FFFFF) << 42);
+}
+
 bool ReedShepp::GenerateRSPs(const std::shared_ptr<Node3d> start_node,
                              const std::shared_ptr<Node3d> end_node,
                              std::vector<ReedSheppPath>* all_possible_paths) {
@@ -24,6 +24,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -82,6 +83,20 @@ class ReedShepp {
   bool GenerateRSPPar(const std::shared_ptr<Node3d> start_node,
                       const std::shared_ptr<Node3d> end_node,
                       std::vector<ReedSheppPath>* all_possible_paths);
+  // Generate the candidates of a single motion primitive family
+  // (0:SCS 1:CSC 2:CCC 3:CCCC 4:CCSC 5:CCSCC)
+  bool GenerateRSPByFamily(const int family, const double& x, const double& y,
+                           const double& phi,
+                           std::vector<ReedSheppPath>* all_possible_paths);
+  // Pick the shortest candidate, interpolate it and copy it into optimal_path
+  bool SelectShortestRSP(const std::shared_ptr<Node3d> start_node,
+                         const std::shared_ptr<Node3d> end_node,
+                         std::vector<ReedSheppPath>* all_possible_paths,
+                         std::shared_ptr<ReedSheppPath> optimal_path,
+                         size_t* optimal_path_index);
+  // discretized normalized relative pose, used as memoization key
+  uint64_t PoseToCacheKey(const double& x, const double& y,
+                          const double& phi) const;
   // Set local exact configurations profile of each movement primitive
   bool GenerateLocalConfigurations(const std::shared_ptr<Node3d> start_node,
                                    const std::shared_ptr<Node3d> end_node,
@@ -140,6 +155,11 @@ class ReedShepp {
   common::VehicleParam vehicle_param_;
   PlannerOpenSpaceConfig planner_open_space_config_;
   double max_kappa_;
+  // Memoized optimal primitive family keyed by the discretized normalized
+  // relative pose. On a hit only that family is recomputed exactly for the
+  // actual pose, so the result stays exact; a stale hit falls back to the
+  // full search.
+  std::unordered_map<uint64_t, int> rsp_family_cache_;
 };
 }  // namespace planning
 }  // namespace apollo
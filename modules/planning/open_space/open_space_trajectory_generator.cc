@@ -157,81 +157,242 @@ apollo::common::Status OpenSpaceTrajectoryGenerator::Plan(
   uWS.row(0) = steer;
   uWS.row(1) = a;
 
-  // Step 8 : Formulate distance approach problem
-  // solution from distance approach
-  ADEBUG << "Start forming state warm start problem with configs setting : "
-         << planner_open_space_config_.dual_variable_warm_start_config()
-                .ShortDebugString();
-
   // result for distance approach problem
   Eigen::MatrixXd l_warm_up;
   Eigen::MatrixXd n_warm_up;
+  Eigen::MatrixXd state_result_ds;
+  Eigen::MatrixXd control_result_ds;
+  Eigen::MatrixXd time_result_ds;
+  Eigen::MatrixXd dual_l_result_ds;
+  Eigen::MatrixXd dual_n_result_ds;
+
+  partial_trajectory_updated_.store(false);
+
+  // Smoothing per gear segment lets the first executable segment be handed
+  // out through UpdatePartialTrajectory() while the remaining segments are
+  // still being smoothed. Segments shorter than kMinSegmentHorizon are not
+  // worth a separate solve.
+  constexpr size_t kMinSegmentHorizon = 5;
+  const size_t gear_shift_index = FirstGearShiftIndex(result);
+  const bool pipeline_smoothing =
+      FLAGS_enable_open_space_pipelined_smoothing &&
+      gear_shift_index >= kMinSegmentHorizon &&
+      horizon_ - gear_shift_index >= kMinSegmentHorizon;
+
+  if (pipeline_smoothing) {
+    const size_t first_horizon = gear_shift_index;
+    const size_t second_horizon = horizon_ - gear_shift_index;
+
+    // Step 8 : Smooth the first gear segment, which ends at the gear shift
+    // point with zero speed
+    Eigen::MatrixXd xF1(4, 1);
+    xF1 << xWS(0, first_horizon), xWS(1, first_horizon), xWS(2, first_horizon),
+        0.0;
+    Eigen::MatrixXd xWS1 = xWS.block(0, 0, 4, first_horizon + 1);
+    Eigen::MatrixXd uWS1 = uWS.block(0, 0, 2, first_horizon);
+    Eigen::MatrixXd l_warm_up_1;
+    Eigen::MatrixXd n_warm_up_1;
+    Eigen::MatrixXd state_result_1;
+    Eigen::MatrixXd control_result_1;
+    Eigen::MatrixXd time_result_1;
+    Eigen::MatrixXd dual_l_result_1;
+    Eigen::MatrixXd dual_n_result_1;
+    if (!SmoothTrajectorySegment(x0, xF1, last_time_u, first_horizon, xWS1,
+                                 uWS1, obstacles_num, obstacles_edges_num,
+                                 obstacles_A, obstacles_b, &l_warm_up_1,
+                                 &n_warm_up_1, &state_result_1,
+                                 &control_result_1, &time_result_1,
+                                 &dual_l_result_1, &dual_n_result_1)) {
+      return Status(ErrorCode::PLANNING_ERROR,
+                    "Distance approach problem failed to solve on the first "
+                    "gear segment");
+    }
+
+    // hand out the first executable segment before the tail is smoothed
+    Eigen::MatrixXd first_segment_states = state_result_1;
+    RescaleToWorldFrame(rotate_angle, translate_origin, &first_segment_states);
+    LoadPartialTrajectory(first_segment_states, control_result_1,
+                          time_result_1);
+
+    // Step 9 : Smooth the remaining gear segments, starting from the smoothed
+    // gear shift point so that the spliced trajectory stays continuous
+    Eigen::MatrixXd x02 = state_result_1.col(first_horizon);
+    x02(3, 0) = 0.0;
+    Eigen::MatrixXd last_time_u2 = Eigen::MatrixXd::Zero(2, 1);
+    Eigen::MatrixXd xWS2 = xWS.block(0, first_horizon, 4, second_horizon + 1);
+    Eigen::MatrixXd uWS2 = uWS.block(0, first_horizon, 2, second_horizon);
+    Eigen::MatrixXd l_warm_up_2;
+    Eigen::MatrixXd n_warm_up_2;
+    Eigen::MatrixXd state_result_2;
+    Eigen::MatrixXd control_result_2;
+    Eigen::MatrixXd time_result_2;
+    Eigen::MatrixXd dual_l_result_2;
+    Eigen::MatrixXd dual_n_result_2;
+    if (!SmoothTrajectorySegment(x02, xF, last_time_u2, second_horizon, xWS2,
+                                 uWS2, obstacles_num, obstacles_edges_num,
+                                 obstacles_A, obstacles_b, &l_warm_up_2,
+                                 &n_warm_up_2, &state_result_2,
+                                 &control_result_2, &time_result_2,
+                                 &dual_l_result_2, &dual_n_result_2)) {
+      return Status(ErrorCode::PLANNING_ERROR,
+                    "Distance approach problem failed to solve on the "
+                    "remaining gear segments");
+    }
+
+    // splice the two segments, the gear shift point appearing once
+    state_result_ds.resize(4, horizon_ + 1);
+    state_result_ds << state_result_1, state_result_2.rightCols(second_horizon);
+    control_result_ds.resize(2, horizon_ + 1);
+    control_result_ds << control_result_1.leftCols(first_horizon),
+        control_result_2;
+    time_result_ds.resize(1, horizon_ + 1);
+    time_result_ds << time_result_1.leftCols(first_horizon), time_result_2;
+    l_warm_up.resize(l_warm_up_1.rows(), horizon_ + 1);
+    l_warm_up << l_warm_up_1, l_warm_up_2.rightCols(second_horizon);
+    n_warm_up.resize(n_warm_up_1.rows(), horizon_ + 1);
+    n_warm_up << n_warm_up_1, n_warm_up_2.rightCols(second_horizon);
+    dual_l_result_ds.resize(dual_l_result_1.rows(), horizon_ + 1);
+    dual_l_result_ds << dual_l_result_1,
+        dual_l_result_2.rightCols(second_horizon);
+    dual_n_result_ds.resize(dual_n_result_1.rows(), horizon_ + 1);
+    dual_n_result_ds << dual_n_result_1,
+        dual_n_result_2.rightCols(second_horizon);
+  } else {
+    // Step 8 & 9 : Smooth the whole horizon in one distance approach problem
+    if (!SmoothTrajectorySegment(x0, xF, last_time_u, horizon_, xWS, uWS,
+                                 obstacles_num, obstacles_edges_num,
+                                 obstacles_A, obstacles_b, &l_warm_up,
+                                 &n_warm_up, &state_result_ds,
+                                 &control_result_ds, &time_result_ds,
+                                 &dual_l_result_ds, &dual_n_result_ds)) {
+      return Status(ErrorCode::PLANNING_ERROR,
+                    "Distance approach problem failed to solve");
+    }
+  }
+
+  // record debug info
+  if (FLAGS_enable_record_debug) {
+    open_space_debug_.Clear();
+    RecordDebugInfo(xWS, uWS, l_warm_up, n_warm_up, dual_l_result_ds,
+                    dual_n_result_ds, state_result_ds, control_result_ds,
+                    time_result_ds, XYbounds_, obstacles_vertices_vec);
+  }
+  // rescale the states to the world frame
+  RescaleToWorldFrame(rotate_angle, translate_origin, &state_result_ds);
+
+  LoadTrajectory(state_result_ds, control_result_ds, time_result_ds);
+
+  return Status::OK();
+}
+
+bool OpenSpaceTrajectoryGenerator::SmoothTrajectorySegment(
+    const Eigen::MatrixXd& x0, const Eigen::MatrixXd& xF,
+    const Eigen::MatrixXd& last_time_u, const size_t horizon,
+    const Eigen::MatrixXd& xWS, const Eigen::MatrixXd& uWS,
+    const size_t obstacles_num, const Eigen::MatrixXi& obstacles_edges_num,
+    const Eigen::MatrixXd& obstacles_A, const Eigen::MatrixXd& obstacles_b,
+    Eigen::MatrixXd* l_warm_up, Eigen::MatrixXd* n_warm_up,
+    Eigen::MatrixXd* state_result, Eigen::MatrixXd* control_result,
+    Eigen::MatrixXd* time_result, Eigen::MatrixXd* dual_l_result,
+    Eigen::MatrixXd* dual_n_result) {
+  // Formulate dual variable warm start problem
+  ADEBUG << "Start forming state warm start problem with configs setting : "
+         << planner_open_space_config_.dual_variable_warm_start_config()
+                .ShortDebugString();
 
   if (FLAGS_use_dual_variable_warm_start) {
     bool dual_variable_warm_start_status = dual_variable_warm_start_->Solve(
-        horizon_, ts_, ego_, obstacles_num, obstacles_edges_num, obstacles_A,
-        obstacles_b, xWS, &l_warm_up, &n_warm_up);
+        horizon, ts_, ego_, obstacles_num, obstacles_edges_num, obstacles_A,
+        obstacles_b, xWS, l_warm_up, n_warm_up);
 
     if (dual_variable_warm_start_status) {
       ADEBUG << "Dual variable problem solved successfully!";
     } else {
-      return Status(ErrorCode::PLANNING_ERROR,
-                    "Dual variable problem failed to solve");
+      AERROR << "Dual variable problem failed to solve";
+      return false;
     }
   } else {
-    l_warm_up =
-        0.5 * Eigen::MatrixXd::Ones(obstacles_edges_num.sum(), horizon_ + 1);
-    n_warm_up = 0.5 * Eigen::MatrixXd::Ones(4 * obstacles_num, horizon_ + 1);
+    *l_warm_up =
+        0.5 * Eigen::MatrixXd::Ones(obstacles_edges_num.sum(), horizon + 1);
+    *n_warm_up = 0.5 * Eigen::MatrixXd::Ones(4 * obstacles_num, horizon + 1);
   }
 
-  // Step 9 : Formulate distance approach problem
-  // solution from distance approach
+  // Formulate distance approach problem
   ADEBUG << "Start Forming Distance approach problem with configs setting : "
          << planner_open_space_config_.distance_approach_config()
                 .ShortDebugString();
-  // result for distance approach problem
-  Eigen::MatrixXd state_result_ds;
-  Eigen::MatrixXd control_result_ds;
-  Eigen::MatrixXd time_result_ds;
-  Eigen::MatrixXd dual_l_result_ds;
-  Eigen::MatrixXd dual_n_result_ds;
 
   bool distance_approach_status = distance_approach_->Solve(
-      x0, xF, last_time_u, horizon_, ts_, ego_, xWS, uWS, l_warm_up, n_warm_up,
+      x0, xF, last_time_u, horizon, ts_, ego_, xWS, uWS, *l_warm_up, *n_warm_up,
       XYbounds_, obstacles_num, obstacles_edges_num, obstacles_A, obstacles_b,
-      &state_result_ds, &control_result_ds, &time_result_ds, &dual_l_result_ds,
-      &dual_n_result_ds);
+      state_result, control_result, time_result, dual_l_result, dual_n_result);
 
   if (distance_approach_status) {
     ADEBUG << "Distance approach problem solved successfully!";
   } else {
-    return Status(ErrorCode::PLANNING_ERROR,
-                  "Distance approach problem failed to solve");
+    AERROR << "Distance approach problem failed to solve";
+    return false;
   }
+  return true;
+}
 
-  // record debug info
-  if (FLAGS_enable_record_debug) {
-    open_space_debug_.Clear();
-    RecordDebugInfo(xWS, uWS, l_warm_up, n_warm_up, dual_l_result_ds,
-                    dual_n_result_ds, state_result_ds, control_result_ds,
-                    time_result_ds, XYbounds_, obstacles_vertices_vec);
-  }
-  // rescale the states to the world frame
-  for (size_t i = 0; i < horizon_ + 1; ++i) {
-    double tmp_x = state_result_ds(0, i);
-    state_result_ds(0, i) = state_result_ds(0, i) * std::cos(rotate_angle) -
-                            state_result_ds(1, i) * std::sin(rotate_angle);
-    state_result_ds(1, i) = tmp_x * std::sin(rotate_angle) +
-                            state_result_ds(1, i) * std::cos(rotate_angle);
-    state_result_ds(0, i) += translate_origin.x();
-    state_result_ds(1, i) += translate_origin.y();
-    state_result_ds(2, i) =
-        common::math::NormalizeAngle(state_result_ds(2, i) + rotate_angle);
+size_t OpenSpaceTrajectoryGenerator::FirstGearShiftIndex(
+    const HybridAStartResult& result) const {
+  constexpr double kepsilon = 1e-6;
+  int direction = 0;
+  size_t point_num = result.v.size();
+  for (size_t i = 0; i < point_num; ++i) {
+    if (result.v[i] > kepsilon) {
+      if (direction < 0) {
+        return i - 1;
+      }
+      direction = 1;
+    } else if (result.v[i] < -kepsilon) {
+      if (direction > 0) {
+        return i - 1;
+      }
+      direction = -1;
+    }
   }
+  return 0;
+}
 
-  LoadTrajectory(state_result_ds, control_result_ds, time_result_ds);
+void OpenSpaceTrajectoryGenerator::RescaleToWorldFrame(
+    const double& rotate_angle, const Vec2d& translate_origin,
+    Eigen::MatrixXd* state_result) {
+  size_t point_num = state_result->cols();
+  for (size_t i = 0; i < point_num; ++i) {
+    double tmp_x = (*state_result)(0, i);
+    (*state_result)(0, i) = (*state_result)(0, i) * std::cos(rotate_angle) -
+                            (*state_result)(1, i) * std::sin(rotate_angle);
+    (*state_result)(1, i) = tmp_x * std::sin(rotate_angle) +
+                            (*state_result)(1, i) * std::cos(rotate_angle);
+    (*state_result)(0, i) += translate_origin.x();
+    (*state_result)(1, i) += translate_origin.y();
+    (*state_result)(2, i) =
+        common::math::NormalizeAngle((*state_result)(2, i) + rotate_angle);
+  }
+}
 
-  return Status::OK();
+void OpenSpaceTrajectoryGenerator::LoadPartialTrajectory(
+    const Eigen::MatrixXd& state_result, const Eigen::MatrixXd& control_result,
+    const Eigen::MatrixXd& time_result) {
+  std::lock_guard<std::mutex> lock(partial_trajectory_mutex_);
+  partial_trajectory_.Clear();
+  double relative_time = 0.0;
+  size_t point_num = state_result.cols();
+  for (size_t i = 0; i < point_num; ++i) {
+    auto* point = partial_trajectory_.add_trajectory_point();
+    point->mutable_path_point()->set_x(state_result(0, i));
+    point->mutable_path_point()->set_y(state_result(1, i));
+    point->mutable_path_point()->set_theta(state_result(2, i));
+    point->set_relative_time(relative_time);
+    relative_time += time_result(0, i);
+    point->set_v(state_result(3, i));
+    point->set_steer(control_result(0, i));
+    point->set_a(control_result(1, i));
+  }
+  partial_trajectory_updated_.store(true);
 }
 
 void OpenSpaceTrajectoryGenerator::UpdateTrajectory(
@@ -241,6 +402,19 @@ void OpenSpaceTrajectoryGenerator::UpdateTrajectory(
       *(trajectory_to_end_.mutable_trajectory_point()));
 }
 
+bool OpenSpaceTrajectoryGenerator::UpdatePartialTrajectory(
+    apollo::common::Trajectory* trajectory_to_end) {
+  if (!partial_trajectory_updated_.load()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(partial_trajectory_mutex_);
+  trajectory_to_end->Clear();
+  trajectory_to_end->mutable_trajectory_point()->CopyFrom(
+      *(partial_trajectory_.mutable_trajectory_point()));
+  partial_trajectory_updated_.store(false);
+  return true;
+}
+
 void OpenSpaceTrajectoryGenerator::UpdateDebugInfo(
     planning_internal::OpenSpaceDebug* open_space_debug) {
   open_space_debug->Clear();
@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "Eigen/Eigen"
@@ -86,6 +88,15 @@ class OpenSpaceTrajectoryGenerator {
 
   void UpdateTrajectory(apollo::common::Trajectory* trajectory_to_end);
 
+  /**
+   * @brief Fetch the smoothed first gear segment of the trajectory being
+   *        planned, if a new one is available. Returns false when no fresh
+   *        partial trajectory is ready. The segment ends at the first gear
+   *        shift point with zero speed, so it is executable on its own while
+   *        the remaining segments are still being smoothed.
+   */
+  bool UpdatePartialTrajectory(apollo::common::Trajectory* trajectory_to_end);
+
   void UpdateDebugInfo(
       ::apollo::planning_internal::OpenSpaceDebug* open_space_debug);
 
@@ -116,6 +127,31 @@ class OpenSpaceTrajectoryGenerator {
       const std::vector<double>& end_pose, const double& rotate_angle,
       const Vec2d& translate_origin);
 
+  // run dual variable warm start and the distance approach smoother over one
+  // gear segment of the warm start trajectory
+  bool SmoothTrajectorySegment(
+      const Eigen::MatrixXd& x0, const Eigen::MatrixXd& xF,
+      const Eigen::MatrixXd& last_time_u, const size_t horizon,
+      const Eigen::MatrixXd& xWS, const Eigen::MatrixXd& uWS,
+      const size_t obstacles_num, const Eigen::MatrixXi& obstacles_edges_num,
+      const Eigen::MatrixXd& obstacles_A, const Eigen::MatrixXd& obstacles_b,
+      Eigen::MatrixXd* l_warm_up, Eigen::MatrixXd* n_warm_up,
+      Eigen::MatrixXd* state_result, Eigen::MatrixXd* control_result,
+      Eigen::MatrixXd* time_result, Eigen::MatrixXd* dual_l_result,
+      Eigen::MatrixXd* dual_n_result);
+
+  // index of the last point of the first gear segment in the warm start
+  // result, 0 when the trajectory has no gear shift
+  size_t FirstGearShiftIndex(const HybridAStartResult& result) const;
+
+  void RescaleToWorldFrame(const double& rotate_angle,
+                           const Vec2d& translate_origin,
+                           Eigen::MatrixXd* state_result);
+
+  void LoadPartialTrajectory(const Eigen::MatrixXd& state_result,
+                             const Eigen::MatrixXd& control_result,
+                             const Eigen::MatrixXd& time_result);
+
   std::unique_ptr<::apollo::planning::HybridAStar> warm_start_;
   std::unique_ptr<::apollo::planning::DistanceApproachProblem>
       distance_approach_;
@@ -138,6 +174,9 @@ class OpenSpaceTrajectoryGenerator {
   Eigen::MatrixXd ego_;
   std::vector<double> XYbounds_;
   apollo::common::Trajectory trajectory_to_end_;
+  apollo::common::Trajectory partial_trajectory_;
+  std::atomic<bool> partial_trajectory_updated_{false};
+  std::mutex partial_trajectory_mutex_;
   apollo::planning_internal::OpenSpaceDebug open_space_debug_;
 };
 
@@ -104,6 +104,23 @@ bool DistanceApproachProblem::Solve(
                      .ipopt_config()
                      .ipopt_mu_init());
 
+  if (planner_open_space_config_.distance_approach_config()
+          .enable_hot_start() &&
+      last_solve_succeeded_) {
+    // Re-smoothing case: the warm start trajectory comes from the previous
+    // converged solution, so start ipopt at the supplied point with a small
+    // barrier parameter instead of running the initial barrier phase cold.
+    // A failed solve resets last_solve_succeeded_, which restores the cold
+    // start on the next attempt.
+    app->Options()->SetStringValue("warm_start_init_point", "yes");
+    app->Options()->SetNumericValue("warm_start_bound_push", 1e-7);
+    app->Options()->SetNumericValue("warm_start_mult_bound_push", 1e-7);
+    app->Options()->SetNumericValue(
+        "mu_init", planner_open_space_config_.distance_approach_config()
+                       .ipopt_config()
+                       .warm_start_mu_init());
+  }
+
   Ipopt::ApplicationReturnStatus status = app->Initialize();
   if (status != Ipopt::Solve_Succeeded) {
     AERROR << "*** Distiance Approach problem error during initialization!";
@@ -133,8 +150,9 @@ bool DistanceApproachProblem::Solve(
   ptop->get_optimization_results(state_result, control_result, time_result,
                                  dual_l_result, dual_n_result);
 
-  return status == Ipopt::Solve_Succeeded ||
-         status == Ipopt::Solved_To_Acceptable_Level;
+  last_solve_succeeded_ = status == Ipopt::Solve_Succeeded ||
+                          status == Ipopt::Solved_To_Acceptable_Level;
+  return last_solve_succeeded_;
 }
 
 }  // namespace planning
@@ -56,6 +56,10 @@ class DistanceApproachProblem {
 
  private:
   PlannerOpenSpaceConfig planner_open_space_config_;
+  // Whether the previous Solve() converged. A successful solve means the
+  // warm start supplied on the next cycle is near-optimal, so ipopt can be
+  // hot-started past its initial barrier phase.
+  bool last_solve_succeeded_ = false;
 };
 
 }  // namespace planning
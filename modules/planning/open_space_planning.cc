@@ -156,11 +156,12 @@ void OpenSpacePlanning::RunOnce(const LocalView& local_view,
 
   const double planning_cycle_time = FLAGS_open_space_planning_period;
 
-  std::vector<TrajectoryPoint> stitching_trajectory;
   std::string replan_reason;
-  stitching_trajectory = TrajectoryStitcher::ComputeStitchingTrajectory(
+  TrajectoryStitcher::ComputeStitchingTrajectory(
       vehicle_state, start_timestamp, planning_cycle_time,
-      last_publishable_trajectory_.get(), &replan_reason);
+      last_publishable_trajectory_.get(), &replan_reason,
+      &stitching_trajectory_);
+  const auto& stitching_trajectory = stitching_trajectory_;
 
   const size_t frame_num = seq_num_++;
   status = InitFrame(static_cast<uint32_t>(frame_num),
@@ -282,8 +283,8 @@ Status OpenSpacePlanning::Plan(
     ADEBUG << "current_time_stamp: " << std::to_string(current_time_stamp);
 
     last_publishable_trajectory_->PrependTrajectoryPoints(
-        std::vector<TrajectoryPoint>(last_stitching_trajectory_.begin(),
-                                     last_stitching_trajectory_.end() - 1));
+        last_stitching_trajectory_.begin(),
+        last_stitching_trajectory_.end() - 1);
 
     // save the publishable trajectory for use when no planning is generated
     last_trajectory_ = std::make_unique<PublishableTrajectory>(
@@ -150,6 +150,10 @@ Status NaviPlanner::PlanOnReferenceLine(
   auto* heuristic_speed_data = reference_line_info->mutable_speed_data();
   auto speed_profile =
       GenerateInitSpeedProfile(planning_init_point, reference_line_info);
+  // a non-empty init profile is the previous cycle's speed solution
+  // re-anchored at the current position; without it there is nothing to
+  // carry over into the rolling window.
+  const bool has_reanchored_speed = !speed_profile.empty();
   if (speed_profile.empty()) {
     speed_profile = GenerateSpeedHotStart(planning_init_point);
     ADEBUG << "Using dummy hot start for speed vector";
@@ -158,22 +162,30 @@ Status NaviPlanner::PlanOnReferenceLine(
 
   auto ret = Status::OK();
 
-  for (auto& task : tasks_) {
-    const double start_timestamp = Clock::NowInSeconds();
-    ret = task->Execute(frame, reference_line_info);
-    if (!ret.ok()) {
-      AERROR << "Failed to run tasks[" << task->Name()
-             << "], Error message: " << ret.error_message();
-      break;
-    }
-    const double end_timestamp = Clock::NowInSeconds();
-    const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
+  if (FLAGS_enable_navi_rolling_window_reuse && has_reanchored_speed &&
+      TryRollingWindowReuse(planning_init_point, reference_line_info)) {
+    ++solution_reuse_cycles_;
+    ADEBUG << "Reused previous cycle's rolling-window solution, cycle "
+           << solution_reuse_cycles_;
+  } else {
+    solution_reuse_cycles_ = 0;
+    for (auto& task : tasks_) {
+      const double start_timestamp = Clock::NowInSeconds();
+      ret = task->Execute(frame, reference_line_info);
+      if (!ret.ok()) {
+        AERROR << "Failed to run tasks[" << task->Name()
+               << "], Error message: " << ret.error_message();
+        break;
+      }
+      const double end_timestamp = Clock::NowInSeconds();
+      const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
 
-    ADEBUG << "after task " << task->Name() << ":"
-           << reference_line_info->PathSpeedDebugString() << std::endl;
-    ADEBUG << task->Name() << " time spend: " << time_diff_ms << " ms.";
+      ADEBUG << "after task " << task->Name() << ":"
+             << reference_line_info->PathSpeedDebugString() << std::endl;
+      ADEBUG << task->Name() << " time spend: " << time_diff_ms << " ms.";
 
-    RecordDebugInfo(reference_line_info, task->Name(), time_diff_ms);
+      RecordDebugInfo(reference_line_info, task->Name(), time_diff_ms);
+    }
   }
 
   RecordObstacleDebugInfo(reference_line_info);
@@ -228,6 +240,115 @@ Status NaviPlanner::PlanOnReferenceLine(
   return Status::OK();
 }
 
+bool NaviPlanner::TryRollingWindowReuse(
+    const TrajectoryPoint& planning_init_point,
+    ReferenceLineInfo* reference_line_info) {
+  if (solution_reuse_cycles_ >=
+      static_cast<uint32_t>(FLAGS_navi_reuse_max_cycles)) {
+    ADEBUG << "Reuse budget exhausted, forcing a full replan.";
+    return false;
+  }
+  const auto* last_frame = FrameHistory::Instance()->Latest();
+  if (last_frame == nullptr) {
+    return false;
+  }
+  const auto* last_info = last_frame->DriveReferenceLineInfo();
+  if (last_info == nullptr) {
+    return false;
+  }
+  const auto& last_path = last_info->path_data();
+  if (last_path.Empty()) {
+    return false;
+  }
+
+  // Re-anchor the previous solution at the current position and make sure
+  // the vehicle has not diverged from it laterally.
+  Vec2d xy_point(planning_init_point.path_point().x(),
+                 planning_init_point.path_point().y());
+  SLPoint sl_point;
+  if (!last_info->reference_line().XYToSL(xy_point, &sl_point)) {
+    return false;
+  }
+  const double s_diff = sl_point.s();
+  const auto matched_point =
+      last_path.frenet_frame_path().EvaluateByS(s_diff);
+  constexpr double kMaxLateralDivergence = 0.5;
+  if (std::fabs(sl_point.l() - matched_point.l()) > kMaxLateralDivergence) {
+    ADEBUG << "Vehicle diverged from the previous path, replanning.";
+    return false;
+  }
+  const double remaining_window =
+      last_path.discretized_path().Length() - s_diff;
+  if (remaining_window < FLAGS_navi_reuse_min_window_length) {
+    ADEBUG << "Previous path too short to reuse: " << remaining_window;
+    return false;
+  }
+
+  // Cheap corridor checks against the fresh perception: reject the reuse
+  // when a new obstacle shows up inside the corridor or a known one
+  // drifted more than the threshold since the last cycle.
+  // Longitudinal gaps are measured relative to the vehicle so that the
+  // previous boundaries (against the last reference line) and the fresh
+  // ones (against the current line) are comparable.
+  const auto& last_decision = last_info->path_decision();
+  const double adc_s = reference_line_info->AdcSlBoundary().end_s();
+  for (const auto* obstacle :
+       reference_line_info->path_decision()->obstacles().Items()) {
+    if (obstacle->IsVirtual()) {
+      continue;
+    }
+    const auto& sl = obstacle->PerceptionSLBoundary();
+    const bool in_corridor =
+        sl.end_s() > adc_s && sl.start_s() < adc_s + remaining_window &&
+        sl.start_l() < FLAGS_navi_reuse_corridor_half_width &&
+        sl.end_l() > -FLAGS_navi_reuse_corridor_half_width;
+    if (!in_corridor) {
+      continue;
+    }
+    const auto* last_obstacle = last_decision.obstacles().Find(obstacle->Id());
+    if (last_obstacle == nullptr) {
+      ADEBUG << "New obstacle " << obstacle->Id()
+             << " in the corridor, replanning.";
+      return false;
+    }
+    const auto& last_sl = last_obstacle->PerceptionSLBoundary();
+    const double gap_drift =
+        std::fabs((sl.start_s() - adc_s) - (last_sl.start_s() - s_diff));
+    const double lateral_drift = std::fabs(sl.start_l() - last_sl.start_l());
+    if (std::fmax(gap_drift, lateral_drift) >
+        FLAGS_navi_reuse_obstacle_drift_threshold) {
+      ADEBUG << "Obstacle " << obstacle->Id() << " drifted since the last "
+             << "cycle, replanning.";
+      return false;
+    }
+  }
+
+  // Install the previous path shifted into the current rolling window. The
+  // frenet projection against the current reference line is rebuilt by
+  // SetDiscretizedPath. The re-anchored speed profile is already in place
+  // as the heuristic speed data.
+  std::vector<common::PathPoint> path_points;
+  path_points.reserve(last_path.discretized_path().size());
+  for (const auto& point : last_path.discretized_path()) {
+    if (point.s() < s_diff) {
+      continue;
+    }
+    common::PathPoint shifted_point = point;
+    shifted_point.set_s(point.s() - s_diff);
+    path_points.push_back(std::move(shifted_point));
+  }
+  if (path_points.size() < 2) {
+    return false;
+  }
+  auto* path_data = reference_line_info->mutable_path_data();
+  path_data->SetReferenceLine(&reference_line_info->reference_line());
+  if (!path_data->SetDiscretizedPath(DiscretizedPath(path_points))) {
+    ADEBUG << "Failed to project the reused path on the reference line.";
+    return false;
+  }
+  return true;
+}
+
 void NaviPlanner::RecordObstacleDebugInfo(
     ReferenceLineInfo* reference_line_info) {
   if (!FLAGS_enable_record_debug) {
@@ -99,6 +99,17 @@ class NaviPlanner : public PlannerWithReferenceLine {
   std::vector<common::SpeedPoint> GenerateSpeedHotStart(
       const common::TrajectoryPoint& planning_init_point);
 
+  /**
+   * @brief try to reuse the previous cycle's path solution in the rolling
+   * window; on highways the world changes slowly and a full replan is
+   * often unnecessary. The reused path is validated against the fresh
+   * perception with cheap corridor checks and installed into
+   * reference_line_info on success.
+   * @return true if the previous solution passed validation and was reused.
+   */
+  bool TryRollingWindowReuse(const common::TrajectoryPoint& planning_init_point,
+                             ReferenceLineInfo* reference_line_info);
+
   void GenerateFallbackPathProfile(const ReferenceLineInfo* reference_line_info,
                                    PathData* path_data);
 
@@ -120,6 +131,8 @@ class NaviPlanner : public PlannerWithReferenceLine {
  private:
   apollo::common::util::Factory<TaskConfig::TaskType, NaviTask> task_factory_;
   std::vector<std::unique_ptr<NaviTask>> tasks_;
+  // number of consecutive cycles the previous solution has been reused
+  uint32_t solution_reuse_cycles_ = 0;
 };
 
 }  // namespace planning
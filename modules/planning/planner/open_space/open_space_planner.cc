@@ -103,6 +103,18 @@ apollo::common::Status OpenSpacePlanner::Plan(
       return Status::OK();
     }
 
+    // Publish the smoothed first gear segment as soon as the planning thread
+    // hands it out, so the vehicle starts moving while the remaining gear
+    // segments are still being smoothed.
+    if (open_space_trajectory_generator_->UpdatePartialTrajectory(
+            &trajectory_to_end_)) {
+      std::lock_guard<std::mutex> lock(open_space_mutex_);
+      open_space_trajectory_generator_->GetStitchingTrajectory(
+          &stitching_trajectory_);
+      LoadTrajectoryToFrame(frame);
+      return Status::OK();
+    }
+
     return Status(ErrorCode::OK,
                   "Waiting for planning thread in OpenSpacePlanner");
 
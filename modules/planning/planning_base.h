@@ -88,6 +88,9 @@ class PlanningBase {
   TrafficRuleConfigs traffic_rule_configs_;
   std::unique_ptr<Planner> planner_;
   std::unique_ptr<PublishableTrajectory> last_publishable_trajectory_;
+  // reused across planning cycles so stitching writes into preallocated
+  // trajectory point storage instead of reallocating it every cycle.
+  std::vector<common::TrajectoryPoint> stitching_trajectory_;
   std::unique_ptr<PlannerDispatcher> planner_dispatcher_;
 };
 
@@ -137,20 +137,41 @@ bool PlanningComponent::Proc(
     return false;
   }
 
-  ADCTrajectory adc_trajectory_pb;
-  planning_base_->RunOnce(local_view_, &adc_trajectory_pb);
-  auto start_time = adc_trajectory_pb.header().timestamp_sec();
-  common::util::FillHeader(node_->Name(), &adc_trajectory_pb);
+  auto adc_trajectory_pb = AllocateTrajectoryMessage();
+  planning_base_->RunOnce(local_view_, adc_trajectory_pb.get());
+  auto start_time = adc_trajectory_pb->header().timestamp_sec();
+  common::util::FillHeader(node_->Name(), adc_trajectory_pb.get());
 
   // modify trajectory relative time due to the timestamp change in header
-  const double dt = start_time - adc_trajectory_pb.header().timestamp_sec();
-  for (auto& p : *adc_trajectory_pb.mutable_trajectory_point()) {
+  const double dt = start_time - adc_trajectory_pb->header().timestamp_sec();
+  for (auto& p : *adc_trajectory_pb->mutable_trajectory_point()) {
     p.set_relative_time(p.relative_time() + dt);
   }
-  planning_writer_->Write(std::make_shared<ADCTrajectory>(adc_trajectory_pb));
+  planning_writer_->Write(adc_trajectory_pb);
   return true;
 }
 
+std::shared_ptr<ADCTrajectory> PlanningComponent::AllocateTrajectoryMessage() {
+  if (trajectory_pool_.empty()) {
+    trajectory_pool_.resize(kTrajectoryPoolSize);
+  }
+  for (std::size_t i = 0; i < trajectory_pool_.size(); ++i) {
+    auto& slot = trajectory_pool_[trajectory_pool_index_];
+    trajectory_pool_index_ =
+        (trajectory_pool_index_ + 1) % trajectory_pool_.size();
+    if (slot == nullptr) {
+      slot = std::make_shared<ADCTrajectory>();
+      return slot;
+    }
+    if (slot.use_count() == 1) {
+      slot->Clear();
+      return slot;
+    }
+  }
+  // Every pooled message is still referenced by the transport layer.
+  return std::make_shared<ADCTrajectory>();
+}
+
 void PlanningComponent::CheckRerouting() {
   auto* rerouting =
       PlanningContext::MutablePlanningStatus()->mutable_rerouting();
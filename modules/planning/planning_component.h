@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "cyber/class_loader/class_loader.h"
 #include "cyber/component/component.h"
@@ -56,6 +57,12 @@ class PlanningComponent final
  private:
   void CheckRerouting();
   bool CheckInput();
+  /**@brief Get an outbound trajectory message from the reuse pool.
+   * A pooled message is handed out again once the transport layer has
+   * released it; Clear() keeps the allocated capacity of the repeated
+   * trajectory point array, so a steady-state cycle rewrites the points
+   * in place and publishes without copying the filled message. */
+  std::shared_ptr<ADCTrajectory> AllocateTrajectoryMessage();
 
   std::shared_ptr<cyber::Reader<perception::TrafficLightDetection>>
       traffic_light_reader_;
@@ -77,6 +84,10 @@ class PlanningComponent final
   std::unique_ptr<PlanningBase> planning_base_;
 
   PlanningConfig config_;
+
+  static constexpr std::size_t kTrajectoryPoolSize = 4;
+  std::vector<std::shared_ptr<ADCTrajectory>> trajectory_pool_;
+  std::size_t trajectory_pool_index_ = 0;
 };
 
 CYBER_REGISTER_COMPONENT(PlanningComponent)
@@ -46,21 +46,29 @@ using apollo::hdmap::InterpolatedIndex;
 
 ReferenceLine::ReferenceLine(
     const std::vector<ReferencePoint>& reference_points)
-    : reference_points_(reference_points),
-      map_path_(std::move(std::vector<hdmap::MapPathPoint>(
-          reference_points.begin(), reference_points.end()))) {
-  CHECK_EQ(map_path_.num_points(), reference_points_.size());
+    : data_(std::make_shared<SharedData>(
+          reference_points, MapPath(std::vector<hdmap::MapPathPoint>(
+                                reference_points.begin(),
+                                reference_points.end())))) {
+  CHECK_EQ(data_->map_path.num_points(), data_->reference_points.size());
 }
 
-ReferenceLine::ReferenceLine(const MapPath& hdmap_path)
-    : map_path_(hdmap_path) {
+ReferenceLine::ReferenceLine(const MapPath& hdmap_path) {
+  data_->map_path = hdmap_path;
   for (const auto& point : hdmap_path.path_points()) {
     DCHECK(!point.lane_waypoints().empty());
     const auto& lane_waypoint = point.lane_waypoints()[0];
-    reference_points_.emplace_back(
+    data_->reference_points.emplace_back(
         hdmap::MapPathPoint(point, point.heading(), lane_waypoint), 0.0, 0.0);
   }
-  CHECK_EQ(map_path_.num_points(), reference_points_.size());
+  CHECK_EQ(data_->map_path.num_points(), data_->reference_points.size());
+}
+
+ReferenceLine::SharedData* ReferenceLine::OwnData() {
+  if (data_.use_count() > 1) {
+    data_ = std::make_shared<SharedData>(*data_);
+  }
+  return data_.get();
 }
 
 bool ReferenceLine::Stitch(const ReferenceLine& other) {
@@ -68,7 +76,7 @@ bool ReferenceLine::Stitch(const ReferenceLine& other) {
     AWARN << "The other reference line is empty";
     return true;
   }
-  auto first_point = reference_points_.front();
+  auto first_point = data_->reference_points.front();
   common::SLPoint first_sl;
   if (!other.XYToSL(first_point, &first_sl)) {
     AWARN << "failed to project the first point to the other reference line";
@@ -77,7 +85,7 @@ bool ReferenceLine::Stitch(const ReferenceLine& other) {
   constexpr double kStitchingError = 2e-2;
   bool first_join = first_sl.s() > 0 && first_sl.s() < other.Length() &&
                     std::fabs(first_sl.l()) < kStitchingError;
-  auto last_point = reference_points_.back();
+  auto last_point = data_->reference_points.back();
   common::SLPoint last_sl;
   if (!other.XYToSL(last_point, &last_sl)) {
     AWARN << "failed to project the last point to the other reference line";
@@ -104,21 +112,26 @@ bool ReferenceLine::Stitch(const ReferenceLine& other) {
   }
   const auto& accumulated_s = other.map_path().accumulated_s();
   auto lower = accumulated_s.begin();
+  OwnData();
   if (first_join) {
     lower = std::lower_bound(accumulated_s.begin(), accumulated_s.end(),
                              first_sl.s());
     size_t start_i = std::distance(accumulated_s.begin(), lower);
-    reference_points_.insert(reference_points_.begin(), other_points.begin(),
-                             other_points.begin() + start_i);
+    data_->reference_points.insert(data_->reference_points.begin(),
+                                   other_points.begin(),
+                                   other_points.begin() + start_i);
   }
   if (last_join) {
     auto upper = std::upper_bound(lower, accumulated_s.end(), last_sl.s());
     auto end_i = std::distance(accumulated_s.begin(), upper);
-    reference_points_.insert(reference_points_.end(),
-                             other_points.begin() + end_i, other_points.end());
-  }
-  map_path_ = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
-      reference_points_.begin(), reference_points_.end())));
+    data_->reference_points.insert(data_->reference_points.end(),
+                                   other_points.begin() + end_i,
+                                   other_points.end());
+  }
+  data_->map_path = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
+      data_->reference_points.begin(), data_->reference_points.end())));
+  vertex_lane_speed_limit_.clear();
+  interior_lane_speed_limit_.clear();
   return true;
 }
 
@@ -126,14 +139,14 @@ ReferencePoint ReferenceLine::GetNearestReferencePoint(
     const common::math::Vec2d& xy) const {
   double min_dist = std::numeric_limits<double>::max();
   size_t min_index = 0;
-  for (size_t i = 0; i < reference_points_.size(); ++i) {
-    const double distance = DistanceXY(xy, reference_points_[i]);
+  for (size_t i = 0; i < data_->reference_points.size(); ++i) {
+    const double distance = DistanceXY(xy, data_->reference_points[i]);
     if (distance < min_dist) {
       min_dist = distance;
       min_index = i;
     }
   }
-  return reference_points_[min_index];
+  return data_->reference_points[min_index];
 }
 
 bool ReferenceLine::Shrink(const common::math::Vec2d& point,
@@ -148,14 +161,17 @@ bool ReferenceLine::Shrink(const common::math::Vec2d& point,
 
 bool ReferenceLine::Shrink(const double s, double look_backward,
                            double look_forward) {
-  const auto& accumulated_s = map_path_.accumulated_s();
+  // take ownership first: the accumulated_s reference below must come from
+  // the payload that is actually going to be modified
+  OwnData();
+  const auto& accumulated_s = data_->map_path.accumulated_s();
   size_t start_index = 0;
   if (s > look_backward) {
     auto it_lower = std::lower_bound(accumulated_s.begin(), accumulated_s.end(),
                                      s - look_backward);
     start_index = std::distance(accumulated_s.begin(), it_lower);
   }
-  size_t end_index = reference_points_.size();
+  size_t end_index = data_->reference_points.size();
   if (s + look_forward < Length()) {
     auto start_it = accumulated_s.begin();
     std::advance(start_it, start_index);
@@ -163,22 +179,24 @@ bool ReferenceLine::Shrink(const double s, double look_backward,
         std::upper_bound(start_it, accumulated_s.end(), s + look_forward);
     end_index = std::distance(accumulated_s.begin(), it_higher);
   }
-  reference_points_.erase(reference_points_.begin() + end_index,
-                          reference_points_.end());
-  reference_points_.erase(reference_points_.begin(),
-                          reference_points_.begin() + start_index);
-  if (reference_points_.size() < 2) {
+  data_->reference_points.erase(data_->reference_points.begin() + end_index,
+                                data_->reference_points.end());
+  data_->reference_points.erase(data_->reference_points.begin(),
+                                data_->reference_points.begin() + start_index);
+  if (data_->reference_points.size() < 2) {
     AERROR << "Too few reference points after shrinking.";
     return false;
   }
-  map_path_ = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
-      reference_points_.begin(), reference_points_.end())));
+  data_->map_path = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
+      data_->reference_points.begin(), data_->reference_points.end())));
+  vertex_lane_speed_limit_.clear();
+  interior_lane_speed_limit_.clear();
   return true;
 }
 
 common::FrenetFramePoint ReferenceLine::GetFrenetPoint(
     const common::PathPoint& path_point) const {
-  if (reference_points_.empty()) {
+  if (data_->reference_points.empty()) {
     return common::FrenetFramePoint();
   }
 
@@ -209,33 +227,33 @@ common::FrenetFramePoint ReferenceLine::GetFrenetPoint(
 }
 
 ReferencePoint ReferenceLine::GetNearestReferencePoint(const double s) const {
-  const auto& accumulated_s = map_path_.accumulated_s();
+  const auto& accumulated_s = data_->map_path.accumulated_s();
   if (s < accumulated_s.front() - 1e-2) {
     AWARN << "The requested s " << s << " < 0";
-    return reference_points_.front();
+    return data_->reference_points.front();
   }
   if (s > accumulated_s.back() + 1e-2) {
     AWARN << "The requested s " << s << " > reference line length "
           << accumulated_s.back();
-    return reference_points_.back();
+    return data_->reference_points.back();
   }
   auto it_lower =
       std::lower_bound(accumulated_s.begin(), accumulated_s.end(), s);
   if (it_lower == accumulated_s.begin()) {
-    return reference_points_.front();
+    return data_->reference_points.front();
   } else {
     auto index = std::distance(accumulated_s.begin(), it_lower);
     if (std::fabs(accumulated_s[index - 1] - s) <
         std::fabs(accumulated_s[index] - s)) {
-      return reference_points_[index - 1];
+      return data_->reference_points[index - 1];
     } else {
-      return reference_points_[index];
+      return data_->reference_points[index];
     }
   }
 }
 
 size_t ReferenceLine::GetNearestReferenceIndex(const double s) const {
-  const auto& accumulated_s = map_path_.accumulated_s();
+  const auto& accumulated_s = data_->map_path.accumulated_s();
   if (s < accumulated_s.front() - 1e-2) {
     AWARN << "The requested s " << s << " < 0";
     return 0;
@@ -243,7 +261,7 @@ size_t ReferenceLine::GetNearestReferenceIndex(const double s) const {
   if (s > accumulated_s.back() + 1e-2) {
     AWARN << "The requested s " << s << " > reference line length "
           << accumulated_s.back();
-    return reference_points_.size() - 1;
+    return data_->reference_points.size() - 1;
   }
   auto it_lower =
       std::lower_bound(accumulated_s.begin(), accumulated_s.end(), s);
@@ -262,34 +280,34 @@ std::vector<ReferencePoint> ReferenceLine::GetReferencePoints(
   auto start_index = GetNearestReferenceIndex(start_s);
   auto end_index = GetNearestReferenceIndex(end_s);
   if (start_index < end_index) {
-    ref_points.assign(reference_points_.begin() + start_index,
-                      reference_points_.begin() + end_index);
+    ref_points.assign(data_->reference_points.begin() + start_index,
+                      data_->reference_points.begin() + end_index);
   }
   return ref_points;
 }
 
 ReferencePoint ReferenceLine::GetReferencePoint(const double s) const {
-  const auto& accumulated_s = map_path_.accumulated_s();
+  const auto& accumulated_s = data_->map_path.accumulated_s();
   if (s < accumulated_s.front() - 1e-2) {
     AWARN << "The requested s " << s << " < 0";
-    return reference_points_.front();
+    return data_->reference_points.front();
   }
   if (s > accumulated_s.back() + 1e-2) {
     AWARN << "The requested s " << s << " > reference line length "
           << accumulated_s.back();
-    return reference_points_.back();
+    return data_->reference_points.back();
   }
 
-  auto interpolate_index = map_path_.GetIndexFromS(s);
+  auto interpolate_index = data_->map_path.GetIndexFromS(s);
 
   size_t index = interpolate_index.id;
   size_t next_index = index + 1;
-  if (next_index >= reference_points_.size()) {
-    next_index = reference_points_.size() - 1;
+  if (next_index >= data_->reference_points.size()) {
+    next_index = data_->reference_points.size() - 1;
   }
 
-  const auto& p0 = reference_points_[index];
-  const auto& p1 = reference_points_[next_index];
+  const auto& p0 = data_->reference_points[index];
+  const auto& p1 = data_->reference_points[next_index];
 
   const double s0 = accumulated_s[index];
   const double s1 = accumulated_s[next_index];
@@ -314,7 +332,7 @@ double ReferenceLine::FindMinDistancePoint(const ReferencePoint& p0,
 
 ReferencePoint ReferenceLine::GetReferencePoint(const double x,
                                                 const double y) const {
-  CHECK_GE(reference_points_.size(), 0);
+  CHECK_GE(data_->reference_points.size(), 0);
 
   auto func_distance_square = [](const ReferencePoint& point, const double x,
                                  const double y) {
@@ -323,11 +341,11 @@ ReferencePoint ReferenceLine::GetReferencePoint(const double x,
     return dx * dx + dy * dy;
   };
 
-  double d_min = func_distance_square(reference_points_.front(), x, y);
+  double d_min = func_distance_square(data_->reference_points.front(), x, y);
   size_t index_min = 0;
 
-  for (size_t i = 1; i < reference_points_.size(); ++i) {
-    double d_temp = func_distance_square(reference_points_[i], x, y);
+  for (size_t i = 1; i < data_->reference_points.size(); ++i) {
+    double d_temp = func_distance_square(data_->reference_points[i], x, y);
     if (d_temp < d_min) {
       d_min = d_temp;
       index_min = i;
@@ -335,28 +353,29 @@ ReferencePoint ReferenceLine::GetReferencePoint(const double x,
   }
 
   size_t index_start = (index_min == 0 ? index_min : index_min - 1);
-  size_t index_end =
-      (index_min + 1 == reference_points_.size() ? index_min : index_min + 1);
+  size_t index_end = (index_min + 1 == data_->reference_points.size()
+                          ? index_min
+                          : index_min + 1);
 
   if (index_start == index_end) {
-    return reference_points_[index_start];
+    return data_->reference_points[index_start];
   }
 
-  double s0 = map_path_.accumulated_s()[index_start];
-  double s1 = map_path_.accumulated_s()[index_end];
+  double s0 = data_->map_path.accumulated_s()[index_start];
+  double s1 = data_->map_path.accumulated_s()[index_end];
 
   double s = ReferenceLine::FindMinDistancePoint(
-      reference_points_[index_start], s0, reference_points_[index_end], s1, x,
-      y);
+      data_->reference_points[index_start], s0,
+      data_->reference_points[index_end], s1, x, y);
 
-  return Interpolate(reference_points_[index_start], s0,
-                     reference_points_[index_end], s1, s);
+  return Interpolate(data_->reference_points[index_start], s0,
+                     data_->reference_points[index_end], s1, s);
 }
 
 bool ReferenceLine::SLToXY(const SLPoint& sl_point,
                            common::math::Vec2d* const xy_point) const {
   CHECK_NOTNULL(xy_point);
-  if (map_path_.num_points() < 2) {
+  if (data_->map_path.num_points() < 2) {
     AERROR << "The reference line has too few points.";
     return false;
   }
@@ -373,7 +392,7 @@ bool ReferenceLine::XYToSL(const common::math::Vec2d& xy_point,
   DCHECK_NOTNULL(sl_point);
   double s = 0.0;
   double l = 0.0;
-  if (!map_path_.GetProjection(xy_point, &s, &l)) {
+  if (!data_->map_path.GetProjection(xy_point, &s, &l)) {
     AERROR << "Can't get nearest point from path.";
     return false;
   }
@@ -382,6 +401,21 @@ bool ReferenceLine::XYToSL(const common::math::Vec2d& xy_point,
   return true;
 }
 
+bool ReferenceLine::XYToSL(const std::vector<common::math::Vec2d>& xy_points,
+                           std::vector<SLPoint>* const sl_points) const {
+  DCHECK_NOTNULL(sl_points);
+  std::vector<double> accumulate_s;
+  std::vector<double> laterals;
+  const bool ret =
+      data_->map_path.GetProjectionsBatch(xy_points, &accumulate_s, &laterals);
+  sl_points->resize(xy_points.size());
+  for (size_t i = 0; i < xy_points.size(); ++i) {
+    (*sl_points)[i].set_s(accumulate_s[i]);
+    (*sl_points)[i].set_l(laterals[i]);
+  }
+  return ret;
+}
+
 ReferencePoint ReferenceLine::InterpolateWithMatchedIndex(
     const ReferencePoint& p0, const double s0, const ReferencePoint& p1,
     const double s1, const InterpolatedIndex& index) const {
@@ -392,7 +426,7 @@ ReferencePoint ReferenceLine::InterpolateWithMatchedIndex(
   DCHECK_LE(s0 - 1.0e-6, s) << " s: " << s << " is less than s0 :" << s0;
   DCHECK_LE(s, s1 + 1.0e-6) << "s: " << s << " is larger than s1: " << s1;
 
-  auto map_path_point = map_path_.GetSmoothPoint(index);
+  auto map_path_point = data_->map_path.GetSmoothPoint(index);
   const double kappa = common::math::lerp(p0.kappa(), s0, p1.kappa(), s1, s);
   const double dkappa = common::math::lerp(p0.dkappa(), s0, p1.dkappa(), s1, s);
 
@@ -438,25 +472,25 @@ ReferencePoint ReferenceLine::Interpolate(const ReferencePoint& p0,
 }
 
 const std::vector<ReferencePoint>& ReferenceLine::reference_points() const {
-  return reference_points_;
+  return data_->reference_points;
 }
 
-const MapPath& ReferenceLine::map_path() const { return map_path_; }
+const MapPath& ReferenceLine::map_path() const { return data_->map_path; }
 
 bool ReferenceLine::GetLaneWidth(const double s, double* const lane_left_width,
                                  double* const lane_right_width) const {
-  if (map_path_.path_points().empty()) {
+  if (data_->map_path.path_points().empty()) {
     return false;
   }
-  return map_path_.GetLaneWidth(s, lane_left_width, lane_right_width);
+  return data_->map_path.GetLaneWidth(s, lane_left_width, lane_right_width);
 }
 
 bool ReferenceLine::GetRoadWidth(const double s, double* const road_left_width,
                                  double* const road_right_width) const {
-  if (map_path_.path_points().empty()) {
+  if (data_->map_path.path_points().empty()) {
     return false;
   }
-  return map_path_.GetRoadWidth(s, road_left_width, road_right_width);
+  return data_->map_path.GetRoadWidth(s, road_left_width, road_right_width);
 }
 
 void ReferenceLine::GetLaneFromS(
@@ -499,13 +533,13 @@ bool ReferenceLine::IsOnLane(const SLBoundary& sl_boundary) const {
   double middle_s = (sl_boundary.start_s() + sl_boundary.end_s()) / 2.0;
   double lane_left_width = 0.0;
   double lane_right_width = 0.0;
-  map_path_.GetLaneWidth(middle_s, &lane_left_width, &lane_right_width);
+  data_->map_path.GetLaneWidth(middle_s, &lane_left_width, &lane_right_width);
   return !(sl_boundary.start_l() > lane_left_width ||
            sl_boundary.end_l() < -lane_right_width);
 }
 
 bool ReferenceLine::IsOnLane(const SLPoint& sl_point) const {
-  if (sl_point.s() <= 0 || sl_point.s() > map_path_.length()) {
+  if (sl_point.s() <= 0 || sl_point.s() > data_->map_path.length()) {
     return false;
   }
   double left_width = 0.0;
@@ -520,7 +554,7 @@ bool ReferenceLine::IsOnLane(const SLPoint& sl_point) const {
 
 bool ReferenceLine::IsBlockRoad(const common::math::Box2d& box2d,
                                 double gap) const {
-  return map_path_.OverlapWith(box2d, gap);
+  return data_->map_path.OverlapWith(box2d, gap);
 }
 
 bool ReferenceLine::IsOnRoad(const common::math::Vec2d& vec2d_point) const {
@@ -538,13 +572,13 @@ bool ReferenceLine::IsOnRoad(const SLBoundary& sl_boundary) const {
   double middle_s = (sl_boundary.start_s() + sl_boundary.end_s()) / 2.0;
   double road_left_width = 0.0;
   double road_right_width = 0.0;
-  map_path_.GetRoadWidth(middle_s, &road_left_width, &road_right_width);
+  data_->map_path.GetRoadWidth(middle_s, &road_left_width, &road_right_width);
   return !(sl_boundary.start_l() > road_left_width ||
            sl_boundary.end_l() < -road_right_width);
 }
 
 bool ReferenceLine::IsOnRoad(const SLPoint& sl_point) const {
-  if (sl_point.s() <= 0 || sl_point.s() > map_path_.length()) {
+  if (sl_point.s() <= 0 || sl_point.s() > data_->map_path.length()) {
     return false;
   }
   double road_left_width = 0.0;
@@ -565,13 +599,13 @@ bool ReferenceLine::GetApproximateSLBoundary(
   double s = 0.0;
   double l = 0.0;
   double distance = 0.0;
-  if (!map_path_.GetProjectionWithHueristicParams(box.center(), start_s, end_s,
-                                                  &s, &l, &distance)) {
+  if (!data_->map_path.GetProjectionWithHueristicParams(
+          box.center(), start_s, end_s, &s, &l, &distance)) {
     AERROR << "Can't get projection point from path.";
     return false;
   }
 
-  auto projected_point = map_path_.GetSmoothPoint(s);
+  auto projected_point = data_->map_path.GetSmoothPoint(s);
   auto rotated_box = box;
   rotated_box.RotateFromCenter(-projected_point.heading());
 
@@ -625,9 +659,46 @@ bool ReferenceLine::GetSLBoundary(const common::math::Box2d& box,
   return true;
 }
 
+bool ReferenceLine::GetSLBoundariesBatch(
+    const std::vector<common::math::Box2d>& boxes,
+    std::vector<SLBoundary>* const sl_boundaries) const {
+  DCHECK_NOTNULL(sl_boundaries);
+  std::vector<common::math::Vec2d> corners;
+  corners.reserve(boxes.size() * 4);
+  for (const auto& box : boxes) {
+    const auto box_corners = box.GetAllCorners();
+    corners.insert(corners.end(), box_corners.begin(), box_corners.end());
+  }
+  std::vector<SLPoint> sl_points;
+  if (!XYToSL(corners, &sl_points)) {
+    AERROR << "failed to batch project " << corners.size()
+           << " box corners on reference line.";
+    return false;
+  }
+  sl_boundaries->resize(boxes.size());
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    double start_s(std::numeric_limits<double>::max());
+    double end_s(std::numeric_limits<double>::lowest());
+    double start_l(std::numeric_limits<double>::max());
+    double end_l(std::numeric_limits<double>::lowest());
+    for (size_t j = i * 4; j < i * 4 + 4; ++j) {
+      start_s = std::fmin(start_s, sl_points[j].s());
+      end_s = std::fmax(end_s, sl_points[j].s());
+      start_l = std::fmin(start_l, sl_points[j].l());
+      end_l = std::fmax(end_l, sl_points[j].l());
+    }
+    auto& sl_boundary = (*sl_boundaries)[i];
+    sl_boundary.set_start_s(start_s);
+    sl_boundary.set_end_s(end_s);
+    sl_boundary.set_start_l(start_l);
+    sl_boundary.set_end_l(end_l);
+  }
+  return true;
+}
+
 std::vector<hdmap::LaneSegment> ReferenceLine::GetLaneSegments(
     const double start_s, const double end_s) const {
-  return map_path_.GetLaneSegments(start_s, end_s);
+  return data_->map_path.GetLaneSegments(start_s, end_s);
 }
 
 bool ReferenceLine::GetSLBoundary(const hdmap::Polygon& polygon,
@@ -675,7 +746,8 @@ bool ReferenceLine::HasOverlap(const common::math::Box2d& box) const {
     ADEBUG << "ref_s out of range:" << mid_s;
     return false;
   }
-  if (!map_path_.GetLaneWidth(mid_s, &lane_left_width, &lane_right_width)) {
+  if (!data_->map_path.GetLaneWidth(mid_s, &lane_left_width,
+                                    &lane_right_width)) {
     AERROR << "failed to get width at s = " << mid_s;
     return false;
   }
@@ -688,31 +760,99 @@ bool ReferenceLine::HasOverlap(const common::math::Box2d& box) const {
 
 std::string ReferenceLine::DebugString() const {
   const auto limit =
-      std::min(reference_points_.size(),
+      std::min(data_->reference_points.size(),
                static_cast<size_t>(FLAGS_trajectory_point_num_for_debug));
   return apollo::common::util::StrCat(
-      "point num:", reference_points_.size(),
+      "point num:", data_->reference_points.size(),
       apollo::common::util::PrintDebugStringIter(
-          reference_points_.begin(), reference_points_.begin() + limit, ""));
+          data_->reference_points.begin(),
+          data_->reference_points.begin() + limit, ""));
 }
 
 double ReferenceLine::GetSpeedLimitFromS(const double s) const {
-  for (const auto& speed_limit : speed_limit_) {
-    if (s >= speed_limit.start_s && s <= speed_limit.end_s) {
-      return speed_limit.speed_limit;
+  // The override segments are sorted by start_s and disjoint, so at most the
+  // two segments before the insertion point can cover s (two only when s sits
+  // exactly on a shared boundary); prefer the earlier one to keep the result
+  // of the former linear scan.
+  auto it_upper = std::upper_bound(
+      speed_limit_.begin(), speed_limit_.end(), s,
+      [](const double s, const SpeedLimit& limit) {
+        return s < limit.start_s;
+      });
+  for (int step = 2; step >= 1; --step) {
+    if (std::distance(speed_limit_.begin(), it_upper) >= step) {
+      const auto& limit = *(it_upper - step);
+      if (s >= limit.start_s && s <= limit.end_s) {
+        return limit.speed_limit;
+      }
     }
   }
-  const auto& map_path_point = GetReferencePoint(s);
-  double speed_limit = FLAGS_planning_upper_speed_limit;
-  for (const auto& lane_waypoint : map_path_point.lane_waypoints()) {
-    if (lane_waypoint.lane == nullptr) {
-      AWARN << "lane_waypoint.lane is nullptr";
+  return GetLaneSpeedLimitFromS(s);
+}
+
+double ReferenceLine::GetLaneSpeedLimitFromS(const double s) const {
+  if (data_->map_path.num_points() == 0) {
+    return FLAGS_planning_upper_speed_limit;
+  }
+  if (vertex_lane_speed_limit_.size() !=
+      static_cast<size_t>(data_->map_path.num_points())) {
+    BuildLaneSpeedLimitProfile();
+  }
+  const auto index = data_->map_path.GetIndexFromS(s);
+  if (std::abs(index.offset) > common::math::kMathEpsilon) {
+    return index.id < data_->map_path.num_segments()
+               ? interior_lane_speed_limit_[index.id]
+               : FLAGS_planning_upper_speed_limit;
+  }
+  return vertex_lane_speed_limit_[index.id];
+}
+
+void ReferenceLine::BuildLaneSpeedLimitProfile() const {
+  const size_t num_points = static_cast<size_t>(data_->map_path.num_points());
+  vertex_lane_speed_limit_.assign(num_points,
+                                  FLAGS_planning_upper_speed_limit);
+  interior_lane_speed_limit_.assign(num_points,
+                                    FLAGS_planning_upper_speed_limit);
+  const auto& path_points = data_->map_path.path_points();
+  const auto& lane_segments_to_next_point =
+      data_->map_path.lane_segments_to_next_point();
+  for (size_t i = 0; i < num_points; ++i) {
+    const auto& lane_waypoints = path_points[i].lane_waypoints();
+    double vertex_limit = FLAGS_planning_upper_speed_limit;
+    for (const auto& lane_waypoint : lane_waypoints) {
+      if (lane_waypoint.lane == nullptr) {
+        AWARN << "lane_waypoint.lane is nullptr";
+        continue;
+      }
+      vertex_limit =
+          std::fmin(lane_waypoint.lane->lane().speed_limit(), vertex_limit);
+    }
+    vertex_lane_speed_limit_[i] = vertex_limit;
+
+    // Between two path points GetSmoothPoint keeps a single lane waypoint:
+    // the one on the lane segment towards the next point if present, the
+    // first waypoint otherwise.
+    if (lane_waypoints.empty()) {
       continue;
     }
-    speed_limit =
-        std::fmin(lane_waypoint.lane->lane().speed_limit(), speed_limit);
+    auto ref_lane_waypoint = lane_waypoints[0];
+    if (i < lane_segments_to_next_point.size() &&
+        lane_segments_to_next_point[i].lane != nullptr) {
+      for (const auto& lane_waypoint : lane_waypoints) {
+        if (lane_waypoint.lane != nullptr &&
+            lane_waypoint.lane->id().id() ==
+                lane_segments_to_next_point[i].lane->id().id()) {
+          ref_lane_waypoint = lane_waypoint;
+          break;
+        }
+      }
+    }
+    if (ref_lane_waypoint.lane != nullptr) {
+      interior_lane_speed_limit_[i] =
+          std::fmin(ref_lane_waypoint.lane->lane().speed_limit(),
+                    FLAGS_planning_upper_speed_limit);
+    }
   }
-  return speed_limit;
 }
 
 void ReferenceLine::AddSpeedLimit(double start_s, double end_s,
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -39,11 +40,14 @@ namespace planning {
 class ReferenceLine {
  public:
   ReferenceLine() = default;
+  // Copies share the geometry payload, see SharedData below; copying a
+  // reference line is O(1).
   explicit ReferenceLine(const ReferenceLine& reference_line) = default;
   template <typename Iterator>
   explicit ReferenceLine(const Iterator begin, const Iterator end)
-      : reference_points_(begin, end),
-        map_path_(std::move(std::vector<hdmap::MapPathPoint>(begin, end))) {}
+      : data_(std::make_shared<SharedData>(
+            std::vector<ReferencePoint>(begin, end),
+            hdmap::Path(std::vector<hdmap::MapPathPoint>(begin, end)))) {}
   explicit ReferenceLine(const std::vector<ReferencePoint>& reference_points);
   explicit ReferenceLine(const hdmap::Path& hdmap_path);
 
@@ -104,6 +108,11 @@ class ReferenceLine {
                      SLBoundary* const sl_boundary) const;
   bool GetSLBoundary(const hdmap::Polygon& polygon,
                      SLBoundary* const sl_boundary) const;
+  // Compute the SL boundaries of several boxes at once. All corner points
+  // are projected in a single batched pass over the path's spatial grid,
+  // which is much cheaper than calling GetSLBoundary per box.
+  bool GetSLBoundariesBatch(const std::vector<common::math::Box2d>& boxes,
+                            std::vector<SLBoundary>* const sl_boundaries) const;
 
   bool SLToXY(const common::SLPoint& sl_point,
               common::math::Vec2d* const xy_point) const;
@@ -113,6 +122,11 @@ class ReferenceLine {
   bool XYToSL(const XYPoint& xy, common::SLPoint* const sl_point) const {
     return XYToSL(common::math::Vec2d(xy.x(), xy.y()), sl_point);
   }
+  // Project a batch of points in one pass over the underlying path's
+  // spatial grid; much cheaper than per-point XYToSL for obstacle
+  // trajectory sets.
+  bool XYToSL(const std::vector<common::math::Vec2d>& xy_points,
+              std::vector<common::SLPoint>* const sl_points) const;
 
   bool GetLaneWidth(const double s, double* const lane_left_width,
                     double* const lane_right_width) const;
@@ -159,7 +173,7 @@ class ReferenceLine {
    */
   bool HasOverlap(const common::math::Box2d& box) const;
 
-  double Length() const { return map_path_.length(); }
+  double Length() const { return data_->map_path.length(); }
 
   std::string DebugString() const;
 
@@ -171,7 +185,7 @@ class ReferenceLine {
 
   void SetPriority(uint32_t priority) { priority_ = priority; }
 
-  const hdmap::Path& GetMapPath() const { return map_path_; }
+  const hdmap::Path& GetMapPath() const { return data_->map_path; }
 
  private:
   /**
@@ -203,6 +217,14 @@ class ReferenceLine {
                                      const ReferencePoint& p1, const double s1,
                                      const double x, const double y);
 
+  /**
+   * @brief Look up the lane speed limit at s from the precomputed profile
+   * instead of interpolating a full ReferencePoint per query.
+   */
+  double GetLaneSpeedLimitFromS(const double s) const;
+
+  void BuildLaneSpeedLimitProfile() const;
+
  private:
   struct SpeedLimit {
     double start_s = 0.0;
@@ -216,8 +238,35 @@ class ReferenceLine {
    * This speed limit overrides the lane speed limit
    **/
   std::vector<SpeedLimit> speed_limit_;
-  std::vector<ReferencePoint> reference_points_;
-  hdmap::Path map_path_;
+  /**
+   * Lane speed limits per map path point, built on first query and kept
+   * until the underlying path changes. The vertex entry applies exactly at
+   * a path point; the interior entry applies between a point and its
+   * successor, mirroring how hdmap::Path::GetSmoothPoint selects lane
+   * waypoints.
+   **/
+  mutable std::vector<double> vertex_lane_speed_limit_;
+  mutable std::vector<double> interior_lane_speed_limit_;
+  /**
+   * Geometry payload shared across copies. GetReferenceLines hands a copy
+   * of every reference line to the planning thread each cycle and
+   * ReferenceLineInfo copies it once more; sharing the point and path
+   * slabs makes those copies O(1) instead of several MB of memcpy. The
+   * rare mutations (Stitch, Shrink) clone the payload first when other
+   * copies still reference it, so holders of older copies are unaffected.
+   **/
+  struct SharedData {
+    SharedData() = default;
+    SharedData(std::vector<ReferencePoint> points, hdmap::Path path)
+        : reference_points(std::move(points)), map_path(std::move(path)) {}
+    std::vector<ReferencePoint> reference_points;
+    hdmap::Path map_path;
+  };
+  // Clones the payload if other copies still reference it; must be called
+  // before mutating reference_points or map_path.
+  SharedData* OwnData();
+
+  std::shared_ptr<SharedData> data_ = std::make_shared<SharedData>();
   uint32_t priority_ = 0;
 };
 
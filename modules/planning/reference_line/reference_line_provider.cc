@@ -72,17 +72,38 @@ ReferenceLineProvider::ReferenceLineProvider(
                                         &smoother_config_))
       << "Failed to load smoother config file "
       << FLAGS_smoother_config_filename;
+  smoother_ = CreateSmoother();
+  is_initialized_ = true;
+}
+
+std::unique_ptr<ReferenceLineSmoother> ReferenceLineProvider::CreateSmoother()
+    const {
   if (smoother_config_.has_qp_spline()) {
-    smoother_.reset(new QpSplineReferenceLineSmoother(smoother_config_));
+    return std::unique_ptr<ReferenceLineSmoother>(
+        new QpSplineReferenceLineSmoother(smoother_config_));
   } else if (smoother_config_.has_spiral()) {
-    smoother_.reset(new SpiralReferenceLineSmoother(smoother_config_));
+    return std::unique_ptr<ReferenceLineSmoother>(
+        new SpiralReferenceLineSmoother(smoother_config_));
   } else if (smoother_config_.has_cos_theta()) {
-    smoother_.reset(new CosThetaReferenceLineSmoother(smoother_config_));
-  } else {
-    CHECK(false) << "unknown smoother config "
-                 << smoother_config_.DebugString();
+    return std::unique_ptr<ReferenceLineSmoother>(
+        new CosThetaReferenceLineSmoother(smoother_config_));
   }
-  is_initialized_ = true;
+  CHECK(false) << "unknown smoother config " << smoother_config_.DebugString();
+  return nullptr;
+}
+
+ReferenceLineSmoother* ReferenceLineProvider::GetSmootherForSegment(
+    const std::string& segment_id) {
+  if (segment_id.empty()) {
+    return smoother_.get();
+  }
+  auto iter = segment_smoothers_.find(segment_id);
+  if (iter == segment_smoothers_.end()) {
+    iter = segment_smoothers_
+               .emplace(segment_id, CreateSmoother())
+               .first;
+  }
+  return iter->second.get();
 }
 
 bool ReferenceLineProvider::UpdateRoutingResponse(
@@ -565,6 +586,8 @@ bool ReferenceLineProvider::CreateReferenceLine(
         AERROR << "Failed to update routing in pnc map";
         return false;
       }
+      // segment ids restart with the new routing, drop the stale solvers
+      segment_smoothers_.clear();
     }
   }
 
@@ -665,7 +688,8 @@ bool ReferenceLineProvider::ExtendReferenceLine(const VehicleState &state,
   }
   hdmap::Path path(shifted_segments);
   ReferenceLine new_ref(path);
-  if (!SmoothPrefixedReferenceLine(*prev_ref, new_ref, reference_line)) {
+  if (!SmoothPrefixedReferenceLine(*prev_ref, new_ref, reference_line,
+                                   GetSmootherForSegment(segments->Id()))) {
     AWARN << "Failed to smooth forward shifted reference line";
     return SmoothRouteSegment(*segments, reference_line);
   }
@@ -844,20 +868,28 @@ void ReferenceLineProvider::GetAnchorPoints(
 bool ReferenceLineProvider::SmoothRouteSegment(const RouteSegments &segments,
                                                ReferenceLine *reference_line) {
   hdmap::Path path(segments);
-  return SmoothReferenceLine(ReferenceLine(path), reference_line);
+  return SmoothReferenceLine(ReferenceLine(path), reference_line,
+                             GetSmootherForSegment(segments.Id()));
 }
 
 bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
     const ReferenceLine &prefix_ref, const ReferenceLine &raw_ref,
-    ReferenceLine *reference_line) {
+    ReferenceLine *reference_line, ReferenceLineSmoother *smoother) {
   if (!FLAGS_enable_smooth_reference_line) {
     *reference_line = raw_ref;
     return true;
   }
+  // bounds for anchors snapped to last cycle's smoothed line: tight enough
+  // that the solver keeps the overlap where it was, loose enough that the
+  // new spline knots do not make exact interpolation infeasible
+  constexpr double kPrefixAnchorBound = 0.1;
   // generate anchor points:
   std::vector<AnchorPoint> anchor_points;
   GetAnchorPoints(raw_ref, &anchor_points);
-  // modify anchor points based on prefix_ref
+  // Snap every anchor in the overlap to the previous smoothed line, so the
+  // QP effectively only optimizes the newly-extended tail and its start
+  // matches the already-driven prefix.
+  bool is_first_prefix_anchor = true;
   for (auto &point : anchor_points) {
     common::SLPoint sl_point;
     Vec2d xy{point.path_point.x(), point.path_point.y()};
@@ -872,14 +904,20 @@ bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
     point.path_point.set_y(prefix_ref_point.y());
     point.path_point.set_z(0.0);
     point.path_point.set_theta(prefix_ref_point.heading());
-    point.longitudinal_bound = 1e-6;
-    point.lateral_bound = 1e-6;
-    point.enforced = true;
-    break;
+    if (is_first_prefix_anchor) {
+      point.longitudinal_bound = 1e-6;
+      point.lateral_bound = 1e-6;
+      point.enforced = true;
+      is_first_prefix_anchor = false;
+    } else {
+      point.longitudinal_bound =
+          std::min(point.longitudinal_bound, kPrefixAnchorBound);
+      point.lateral_bound = std::min(point.lateral_bound, kPrefixAnchorBound);
+    }
   }
 
-  smoother_->SetAnchorPoints(anchor_points);
-  if (!smoother_->Smooth(raw_ref, reference_line)) {
+  smoother->SetAnchorPoints(anchor_points);
+  if (!smoother->Smooth(raw_ref, reference_line)) {
     AERROR << "Failed to smooth prefixed reference line with anchor points";
     return false;
   }
@@ -891,7 +929,8 @@ bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
 }
 
 bool ReferenceLineProvider::SmoothReferenceLine(
-    const ReferenceLine &raw_reference_line, ReferenceLine *reference_line) {
+    const ReferenceLine &raw_reference_line, ReferenceLine *reference_line,
+    ReferenceLineSmoother *smoother) {
   if (!FLAGS_enable_smooth_reference_line) {
     *reference_line = raw_reference_line;
     return true;
@@ -899,8 +938,8 @@ bool ReferenceLineProvider::SmoothReferenceLine(
   // generate anchor points:
   std::vector<AnchorPoint> anchor_points;
   GetAnchorPoints(raw_reference_line, &anchor_points);
-  smoother_->SetAnchorPoints(anchor_points);
-  if (!smoother_->Smooth(raw_reference_line, reference_line)) {
+  smoother->SetAnchorPoints(anchor_points);
+  if (!smoother->Smooth(raw_reference_line, reference_line)) {
     AERROR << "Failed to smooth reference line with anchor points";
     return false;
   }
@@ -26,6 +26,7 @@
 #include <memory>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -113,11 +114,23 @@ class ReferenceLineProvider {
                                   const ReferenceLine& smoothed) const;
 
   bool SmoothReferenceLine(const ReferenceLine& raw_reference_line,
-                           ReferenceLine* reference_line);
+                           ReferenceLine* reference_line,
+                           ReferenceLineSmoother* smoother);
 
   bool SmoothPrefixedReferenceLine(const ReferenceLine& prefix_ref,
                                    const ReferenceLine& raw_ref,
-                                   ReferenceLine* reference_line);
+                                   ReferenceLine* reference_line,
+                                   ReferenceLineSmoother* smoother);
+
+  std::unique_ptr<ReferenceLineSmoother> CreateSmoother() const;
+
+  /**
+   * @brief Get the smoother dedicated to one route segment. Consecutive
+   * cycles of the same segment then pose QP problems of identical size to
+   * the same solver instance, so its warm start from last cycle's solution
+   * kicks in instead of a cold re-initialization.
+   */
+  ReferenceLineSmoother* GetSmootherForSegment(const std::string& segment_id);
 
   void GetAnchorPoints(const ReferenceLine& reference_line,
                        std::vector<AnchorPoint>* anchor_points) const;
@@ -157,6 +170,9 @@ class ReferenceLineProvider {
   std::atomic<bool> is_stop_{false};
 
   std::unique_ptr<ReferenceLineSmoother> smoother_;
+  // per-route-segment smoothers, keyed by RouteSegments::Id()
+  std::unordered_map<std::string, std::unique_ptr<ReferenceLineSmoother>>
+      segment_smoothers_;
   ReferenceLineSmootherConfig smoother_config_;
 
   std::mutex pnc_map_mutex_;
@@ -20,9 +20,13 @@
 
 #include "modules/planning/scenarios/lane_follow/lane_follow_stage.h"
 
+#include <future>
+#include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/math_utils.h"
 #include "modules/common/time/time.h"
 #include "modules/common/util/string_tokenizer.h"
@@ -41,6 +45,7 @@
 #include "modules/planning/tasks/optimizers/qp_spline_path/qp_spline_path_optimizer.h"
 #include "modules/planning/tasks/optimizers/qp_spline_st_speed/qp_spline_st_speed_optimizer.h"
 #include "modules/planning/tasks/optimizers/speed_decider/speed_decider.h"
+#include "modules/planning/tasks/task_factory.h"
 
 namespace apollo {
 namespace planning {
@@ -111,6 +116,10 @@ void LaneFollowStage::RecordDebugInfo(ReferenceLineInfo* reference_line_info,
 
 Stage::StageStatus LaneFollowStage::Process(
     const TrajectoryPoint& planning_start_point, Frame* frame) {
+  if (FLAGS_enable_parallel_reference_line_planning &&
+      frame->mutable_reference_line_info()->size() > 1) {
+    return ProcessParallel(planning_start_point, frame);
+  }
   bool has_drivable_reference_line = false;
   bool disable_low_priority_path = false;
   for (auto& reference_line_info : *frame->mutable_reference_line_info()) {
@@ -137,9 +146,104 @@ Stage::StageStatus LaneFollowStage::Process(
                                      : StageStatus::ERROR;
 }
 
+Stage::StageStatus LaneFollowStage::ProcessParallel(
+    const TrajectoryPoint& planning_start_point, Frame* frame) {
+  std::vector<ReferenceLineInfo*> drivable_lines;
+  for (auto& reference_line_info : *frame->mutable_reference_line_info()) {
+    if (reference_line_info.IsDrivable()) {
+      drivable_lines.push_back(&reference_line_info);
+    }
+  }
+  std::vector<std::future<Status>> results;
+  results.reserve(drivable_lines.size());
+  for (size_t i = 0; i < drivable_lines.size(); ++i) {
+    results.emplace_back(
+        cyber::Async(static_cast<Status (LaneFollowStage::*)(
+                         const TrajectoryPoint&, Frame*, ReferenceLineInfo*,
+                         const std::vector<Task*>*)>(
+                         &LaneFollowStage::PlanOnReferenceLine),
+                     this, planning_start_point, frame, drivable_lines[i],
+                     &TaskChainForLine(i)));
+  }
+  bool has_drivable_reference_line = false;
+  bool disable_low_priority_path = false;
+  for (size_t i = 0; i < drivable_lines.size(); ++i) {
+    auto cur_status = results[i].get();
+    if (cur_status.ok() && drivable_lines[i]->IsDrivable()) {
+      has_drivable_reference_line = true;
+      if (FLAGS_prioritize_change_lane &&
+          drivable_lines[i]->IsChangeLanePath() &&
+          drivable_lines[i]->Cost() < kStraightForwardLineCost) {
+        disable_low_priority_path = true;
+      }
+    } else {
+      drivable_lines[i]->SetDrivable(false);
+    }
+  }
+  // The serial loop skips planning lines ranked after a cheap change lane
+  // path; here they are already planned, so exclude them from trajectory
+  // selection instead.
+  if (disable_low_priority_path) {
+    bool seen_prioritized_line = false;
+    for (auto& reference_line_info : *frame->mutable_reference_line_info()) {
+      if (seen_prioritized_line) {
+        reference_line_info.SetDrivable(false);
+        continue;
+      }
+      if (reference_line_info.IsDrivable() &&
+          reference_line_info.IsChangeLanePath() &&
+          reference_line_info.Cost() < kStraightForwardLineCost) {
+        seen_prioritized_line = true;
+      }
+    }
+  }
+  return has_drivable_reference_line ? StageStatus::RUNNING
+                                     : StageStatus::ERROR;
+}
+
+const std::vector<Task*>& LaneFollowStage::TaskChainForLine(
+    size_t line_index) {
+  if (line_index == 0) {
+    return TaskList();
+  }
+  while (extra_task_lists_.size() < line_index) {
+    std::unordered_map<TaskConfig::TaskType, const TaskConfig*, std::hash<int>>
+        config_map;
+    for (const auto& task_config : config().task_config()) {
+      config_map[task_config.task_type()] = &task_config;
+    }
+    std::map<TaskConfig::TaskType, std::unique_ptr<Task>> chain_tasks;
+    std::vector<Task*> task_list;
+    for (int i = 0; i < config().task_type_size(); ++i) {
+      auto task_type = config().task_type(i);
+      auto iter = chain_tasks.find(task_type);
+      if (iter == chain_tasks.end()) {
+        auto ptr = TaskFactory::CreateTask(*config_map[task_type]);
+        task_list.push_back(ptr.get());
+        chain_tasks[task_type] = std::move(ptr);
+      } else {
+        task_list.push_back(iter->second.get());
+      }
+    }
+    for (auto& type_and_task : chain_tasks) {
+      extra_tasks_.push_back(std::move(type_and_task.second));
+    }
+    extra_task_lists_.push_back(std::move(task_list));
+  }
+  return extra_task_lists_[line_index - 1];
+}
+
 Status LaneFollowStage::PlanOnReferenceLine(
     const TrajectoryPoint& planning_start_point, Frame* frame,
     ReferenceLineInfo* reference_line_info) {
+  return PlanOnReferenceLine(planning_start_point, frame, reference_line_info,
+                             &TaskList());
+}
+
+Status LaneFollowStage::PlanOnReferenceLine(
+    const TrajectoryPoint& planning_start_point, Frame* frame,
+    ReferenceLineInfo* reference_line_info,
+    const std::vector<Task*>* task_list) {
   if (!reference_line_info->IsChangeLanePath()) {
     reference_line_info->AddCost(kStraightForwardLineCost);
   }
@@ -156,7 +260,7 @@ Status LaneFollowStage::PlanOnReferenceLine(
 
   auto ret = Status::OK();
 
-  for (auto* optimizer : task_list_) {
+  for (auto* optimizer : *task_list) {
     const double start_timestamp = Clock::NowInSeconds();
     ret = optimizer->Execute(frame, reference_line_info);
     if (!ret.ok()) {
@@ -65,8 +65,27 @@ class LaneFollowStage : public Stage {
                        const std::string& name, const double time_diff_ms);
 
  private:
+  // Plan drivable reference lines concurrently, each with its own task
+  // chain. Used when FLAGS_enable_parallel_reference_line_planning is set
+  // and more than one line is drivable.
+  StageStatus ProcessParallel(
+      const common::TrajectoryPoint& planning_init_point, Frame* frame);
+
+  common::Status PlanOnReferenceLine(
+      const common::TrajectoryPoint& planning_start_point, Frame* frame,
+      ReferenceLineInfo* reference_line_info,
+      const std::vector<Task*>* task_list);
+
+  // Task chain for the line_index-th concurrently planned line. Chain 0 is
+  // the stage's own task list; extra chains are built lazily from the stage
+  // config because Task instances keep per-execution state and cannot be
+  // shared between lines running in parallel.
+  const std::vector<Task*>& TaskChainForLine(size_t line_index);
+
   ScenarioConfig config_;
   std::unique_ptr<Stage> stage_;
+  std::vector<std::unique_ptr<Task>> extra_tasks_;
+  std::vector<std::vector<Task*>> extra_task_lists_;
 };
 
 }  // namespace lane_follow
@@ -53,6 +53,14 @@ void Scenario::Init() {
   current_stage_ = CreateStage(*stage_config_map_[config_.stage_type(0)]);
 }
 
+void Scenario::Reset() {
+  scenario_status_ = STATUS_UNKNOWN;
+  msg_.clear();
+  ADEBUG << "reset to stage "
+         << ScenarioConfig::StageType_Name(config_.stage_type(0));
+  current_stage_ = CreateStage(*stage_config_map_[config_.stage_type(0)]);
+}
+
 Scenario::ScenarioStatus Scenario::Process(
     const common::TrajectoryPoint& planning_init_point, Frame* frame) {
   if (current_stage_->stage_type() == ScenarioConfig::NO_STAGE) {
@@ -84,6 +84,13 @@ class Scenario {
 
   virtual void Init();
 
+  /**
+   * @brief reset a pooled scenario to its initial stage and status so it can
+   * be re-entered without reconstructing the scenario object. Scenarios
+   * holding per-approach context should override this to refresh it.
+   */
+  virtual void Reset();
+
   const std::string& Name() const;
   const std::string& GetMsg() const { return msg_; }
 
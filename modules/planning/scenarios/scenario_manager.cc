@@ -49,10 +49,25 @@ bool ScenarioManager::Init(
   RegisterScenarios();
   default_scenario_type_ = ScenarioConfig::LANE_FOLLOW;
   supported_scenarios_ = supported_scenarios;
-  current_scenario_ = CreateScenario(default_scenario_type_);
+  current_scenario_ = GetScenario(default_scenario_type_);
   return true;
 }
 
+Scenario* ScenarioManager::GetScenario(
+    ScenarioConfig::ScenarioType scenario_type) {
+  auto iter = scenario_pool_.find(scenario_type);
+  if (iter != scenario_pool_.end()) {
+    return iter->second.get();
+  }
+  auto scenario = CreateScenario(scenario_type);
+  if (scenario == nullptr) {
+    return nullptr;
+  }
+  auto* scenario_ptr = scenario.get();
+  scenario_pool_[scenario_type] = std::move(scenario);
+  return scenario_ptr;
+}
+
 std::unique_ptr<Scenario> ScenarioManager::CreateScenario(
     ScenarioConfig::ScenarioType scenario_type) {
   std::unique_ptr<Scenario> ptr;
@@ -244,7 +259,7 @@ ScenarioConfig::ScenarioType ScenarioManager::SelectSidePassScenario(
     return ScenarioConfig::SIDE_PASS;
   }
 
-  auto scenario = CreateScenario(ScenarioConfig::SIDE_PASS);
+  auto* scenario = GetScenario(ScenarioConfig::SIDE_PASS);
   if (scenario->IsTransferable(*current_scenario_, frame)) {
     return ScenarioConfig::SIDE_PASS;
   }
@@ -264,10 +279,11 @@ bool ScenarioManager::SelectScenario(
     return true;
   }
 
-  auto scenario = CreateScenario(type);
+  auto* scenario = GetScenario(type);
   if (scenario->IsTransferable(*current_scenario_, frame)) {
     AINFO << "switch to scenario: " << scenario->Name();
-    current_scenario_ = std::move(scenario);
+    scenario->Reset();
+    current_scenario_ = scenario;
     return true;
   }
   return false;
@@ -427,7 +443,10 @@ void ScenarioManager::ScenarioDispatch(const common::TrajectoryPoint& ego_point,
   UpdatePlanningContext(frame, scenario_type);
 
   if (current_scenario_->scenario_type() != scenario_type) {
-    current_scenario_ = CreateScenario(scenario_type);
+    current_scenario_ = GetScenario(scenario_type);
+    if (current_scenario_ != nullptr) {
+      current_scenario_->Reset();
+    }
   }
 }
 
@@ -530,7 +549,8 @@ void ScenarioManager::ScenarioSelfVote(const common::TrajectoryPoint& ego_point,
   if (current_scenario_->scenario_type() != default_scenario_type_) {
     AINFO << "select default scenario: "
           << ScenarioConfig::ScenarioType_Name(default_scenario_type_);
-    current_scenario_ = CreateScenario(default_scenario_type_);
+    current_scenario_ = GetScenario(default_scenario_type_);
+    current_scenario_->Reset();
   }
 }
 
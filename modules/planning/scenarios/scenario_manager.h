@@ -35,7 +35,7 @@ class ScenarioManager final {
 
   bool Init(const std::set<ScenarioConfig::ScenarioType>& supported_scenarios);
 
-  Scenario* mutable_scenario() { return current_scenario_.get(); }
+  Scenario* mutable_scenario() { return current_scenario_; }
 
   void Update(const common::TrajectoryPoint& ego_point, const Frame& frame);
 
@@ -50,6 +50,14 @@ class ScenarioManager final {
   std::unique_ptr<Scenario> CreateScenario(
       ScenarioConfig::ScenarioType scenario_type);
 
+  /**
+   * @brief scenario instance from the pre-instantiated pool; created and
+   * initialized on first use so scenario switches do not reconstruct the
+   * whole task pipeline. Callers switching to the returned scenario must
+   * call Reset() on it first.
+   */
+  Scenario* GetScenario(ScenarioConfig::ScenarioType scenario_type);
+
   void RegisterScenarios();
 
   ScenarioConfig::ScenarioType SelectChangeLaneScenario(const Frame& frame);
@@ -91,7 +99,13 @@ class ScenarioManager final {
   std::unordered_map<ScenarioConfig::ScenarioType, ScenarioConfig,
                      std::hash<int>> config_map_;
 
-  std::unique_ptr<Scenario> current_scenario_;
+  // pool of pre-instantiated scenarios, keyed by type; owns the instance
+  // current_scenario_ points to.
+  std::unordered_map<ScenarioConfig::ScenarioType, std::unique_ptr<Scenario>,
+                     std::hash<int>>
+      scenario_pool_;
+
+  Scenario* current_scenario_ = nullptr;
   ScenarioConfig::ScenarioType default_scenario_type_;
   std::set<ScenarioConfig::ScenarioType> supported_scenarios_;
   ScenarioContext scenario_context_;
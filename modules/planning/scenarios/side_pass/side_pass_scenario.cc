@@ -95,6 +95,17 @@ SidePassScenario::SidePassScenario(const ScenarioConfig& config,
       PlanningContext::GetScenarioInfo()->side_pass_front_blocking_obstacle_id;
 }
 
+void SidePassScenario::Reset() {
+  // clear the per-activation context before the pooled instance is
+  // re-entered for a new blocking obstacle.
+  side_pass_context_.path_data_.Clear();
+  side_pass_context_.pass_obstacle_stuck_cycle_num_ = 0;
+  side_pass_context_.backup_stage_cycle_num_ = 0;
+  side_pass_context_.front_blocking_obstacle_id_ =
+      PlanningContext::GetScenarioInfo()->side_pass_front_blocking_obstacle_id;
+  Scenario::Reset();
+}
+
 std::unique_ptr<Stage> SidePassScenario::CreateStage(
     const ScenarioConfig::StageConfig& stage_config) {
   if (s_stage_factory_.Empty()) {
@@ -48,6 +48,8 @@ class SidePassScenario : public Scenario {
   bool IsTransferable(const Scenario& current_scenario,
                       const Frame& frame) override;
 
+  void Reset() override;
+
   std::unique_ptr<Stage> CreateStage(
       const ScenarioConfig::StageConfig& stage_config) override;
 
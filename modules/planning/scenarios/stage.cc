@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "modules/common/time/time.h"
 #include "modules/planning/common/speed_profile_generator.h"
 #include "modules/planning/tasks/task_factory.h"
 
@@ -30,6 +31,7 @@ namespace apollo {
 namespace planning {
 namespace scenario {
 
+using common::time::Clock;
 using hdmap::PathOverlap;
 
 namespace {
@@ -83,7 +85,14 @@ bool Stage::ExecuteTaskOnReferenceLine(
 
     auto ret = common::Status::OK();
     for (auto* task : task_list_) {
+      const double start_timestamp = Clock::NowInSeconds();
       ret = task->Execute(frame, &reference_line_info);
+      const double time_diff_ms =
+          (Clock::NowInSeconds() - start_timestamp) * 1000.0;
+      auto* task_stats =
+          reference_line_info.mutable_latency_stats()->add_task_stats();
+      task_stats->set_name(task->Name());
+      task_stats->set_time_ms(time_diff_ms);
       if (!ret.ok()) {
         AERROR << "Failed to run tasks[" << task->Name()
                << "], Error message: " << ret.error_message();
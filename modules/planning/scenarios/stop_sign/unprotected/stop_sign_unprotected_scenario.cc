@@ -84,6 +84,16 @@ void StopSignUnprotectedScenario::Init() {
   init_ = true;
 }
 
+void StopSignUnprotectedScenario::Reset() {
+  scenario_status_ = STATUS_UNKNOWN;
+  msg_.clear();
+  // the pooled instance may be re-entered at a different stop sign; rerun
+  // Init so the context follows the one recorded in the planning context.
+  // Init also recreates the initial stage.
+  init_ = false;
+  Init();
+}
+
 void StopSignUnprotectedScenario::RegisterStages() {
   if (!s_stage_factory_.Empty()) {
     s_stage_factory_.Clear();
@@ -55,6 +55,8 @@ class StopSignUnprotectedScenario : public Scenario {
 
   void Init() override;
 
+  void Reset() override;
+
   std::unique_ptr<Stage> CreateStage(
       const ScenarioConfig::StageConfig& stage_config);
 
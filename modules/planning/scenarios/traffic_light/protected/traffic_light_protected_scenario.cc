@@ -63,6 +63,15 @@ void TrafficLightProtectedScenario::Init() {
   init_ = true;
 }
 
+void TrafficLightProtectedScenario::Reset() {
+  scenario_status_ = STATUS_UNKNOWN;
+  msg_.clear();
+  // rerun Init so the pooled instance follows the traffic light currently
+  // recorded in the planning context; Init recreates the initial stage.
+  init_ = false;
+  Init();
+}
+
 apollo::common::util::Factory<
     ScenarioConfig::StageType, Stage,
     Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
@@ -47,6 +47,8 @@ class TrafficLightProtectedScenario : public Scenario {
 
   void Init() override;
 
+  void Reset() override;
+
   std::unique_ptr<Stage> CreateStage(
       const ScenarioConfig::StageConfig& stage_config);
 
@@ -49,6 +49,8 @@ class TrafficLightUnprotectedRightTurnScenario : public Scenario {
 
   void Init() override;
 
+  void Reset() override;
+
   std::unique_ptr<Stage> CreateStage(
       const ScenarioConfig::StageConfig& stage_config);
 
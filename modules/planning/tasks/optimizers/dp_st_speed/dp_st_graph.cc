@@ -135,6 +135,17 @@ Status DpStGraph::Search(SpeedData* const speed_data) {
   }
 
   if (!RetrieveSpeedProfile(speed_data).ok()) {
+    if (!warm_start_rows_.empty()) {
+      // The corridor around last cycle's profile no longer contains a
+      // feasible profile; redo the search over the full table.
+      AWARN << "Warm start corridor is infeasible, "
+            << "fall back to full dp search.";
+      warm_start_rows_.clear();
+      if (InitCostTable().ok() && CalculateTotalCost().ok() &&
+          RetrieveSpeedProfile(speed_data).ok()) {
+        return Status::OK();
+      }
+    }
     const std::string msg = "Retrieve best speed profile failed.";
     AERROR << msg;
     return Status(ErrorCode::PLANNING_ERROR, msg);
@@ -142,6 +153,31 @@ Status DpStGraph::Search(SpeedData* const speed_data) {
   return Status::OK();
 }
 
+void DpStGraph::SetWarmStartSpeedProfile(
+    const SpeedData& reference_speed_data) {
+  warm_start_rows_.clear();
+  if (reference_speed_data.empty()) {
+    return;
+  }
+  const uint32_t dim_t = dp_st_speed_config_.matrix_dimension_t();
+  const uint32_t max_row = dp_st_speed_config_.matrix_dimension_s() - 1;
+  warm_start_rows_.reserve(dim_t);
+  double curr_t = 0.0;
+  for (uint32_t c = 0; c < dim_t; ++c, curr_t += unit_t_) {
+    SpeedPoint speed_point;
+    if (!reference_speed_data.EvaluateByTime(curr_t, &speed_point)) {
+      // Beyond the reference horizon; extend with the last known position so
+      // late columns still get a corridor.
+      speed_point = reference_speed_data.back();
+    }
+    const double s = std::fmax(0.0, speed_point.s());
+    warm_start_rows_.push_back(
+        std::min(max_row, static_cast<uint32_t>(s / unit_s_)));
+  }
+  warm_start_row_range_ = std::max(
+      1u, static_cast<uint32_t>(FLAGS_dp_st_warm_start_s_range / unit_s_));
+}
+
 Status DpStGraph::InitCostTable() {
   uint32_t dim_s = dp_st_speed_config_.matrix_dimension_s();
   uint32_t dim_t = dp_st_speed_config_.matrix_dimension_t();
@@ -172,6 +208,21 @@ Status DpStGraph::CalculateTotalCost() {
     size_t highest_row = 0;
     auto lowest_row = cost_table_.back().size() - 1;
 
+    if (c > 0 && c < warm_start_rows_.size()) {
+      // Keep the search inside the corridor around the reference profile. An
+      // empty intersection with the reachable band makes the column empty and
+      // the caller falls back to the full search.
+      const uint32_t guide_row = warm_start_rows_[c];
+      next_lowest_row = std::max(
+          next_lowest_row,
+          static_cast<size_t>(guide_row > warm_start_row_range_
+                                  ? guide_row - warm_start_row_range_
+                                  : 0));
+      next_highest_row = std::min(
+          next_highest_row,
+          static_cast<size_t>(guide_row + warm_start_row_range_));
+    }
+
     int count = static_cast<int>(next_highest_row) -
                 static_cast<int>(next_lowest_row) + 1;
     if (count > 0) {
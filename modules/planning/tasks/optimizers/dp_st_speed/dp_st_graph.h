@@ -50,6 +50,13 @@ class DpStGraph {
 
   apollo::common::Status Search(SpeedData* const speed_data);
 
+  /**
+   * Restrict the search to a corridor around a reference speed profile,
+   * typically last cycle's result shifted into the current frame. The full
+   * table is searched again if the corridor turns out to be infeasible.
+   */
+  void SetWarmStartSpeedProfile(const SpeedData& reference_speed_data);
+
  private:
   apollo::common::Status InitCostTable();
 
@@ -107,6 +114,11 @@ class DpStGraph {
   // cost_table_[t][s]
   // row: s, col: t --- NOTICE: Please do NOT change.
   std::vector<std::vector<StGraphPoint>> cost_table_;
+
+  // warm_start_rows_[t]: row of the reference speed profile at column t.
+  // Empty when no warm start is active.
+  std::vector<uint32_t> warm_start_rows_;
+  uint32_t warm_start_row_range_ = 0;
 };
 
 }  // namespace planning
@@ -20,6 +20,7 @@
 
 #include "modules/planning/tasks/optimizers/dp_st_speed/dp_st_speed_optimizer.h"
 
+#include <cmath>
 #include <vector>
 
 #include "modules/planning/proto/planning_internal.pb.h"
@@ -50,6 +51,11 @@ bool DpStSpeedOptimizer::SearchStGraph(SpeedData* speed_data) const {
                      reference_line_info_->path_decision()->obstacles().Items(),
                      init_point_, adc_sl_boundary_);
 
+  if (FLAGS_enable_dp_st_warm_start &&
+      reference_line_info_->Lanes().Id() == last_lane_id_) {
+    st_graph.SetWarmStartSpeedProfile(ShiftedLastSpeedProfile());
+  }
+
   if (!st_graph.Search(speed_data).ok()) {
     AERROR << "failed to search graph with dynamic programming.";
     return false;
@@ -57,6 +63,28 @@ bool DpStSpeedOptimizer::SearchStGraph(SpeedData* speed_data) const {
   return true;
 }
 
+SpeedData DpStSpeedOptimizer::ShiftedLastSpeedProfile() const {
+  SpeedData shifted;
+  if (last_speed_data_.empty()) {
+    return shifted;
+  }
+  const double cycle_time =
+      1.0 / static_cast<double>(FLAGS_planning_loop_rate);
+  common::SpeedPoint anchor;
+  if (!last_speed_data_.EvaluateByTime(cycle_time, &anchor)) {
+    return shifted;
+  }
+  for (const auto& point : last_speed_data_) {
+    if (point.t() < cycle_time) {
+      continue;
+    }
+    shifted.AppendSpeedPoint(std::fmax(0.0, point.s() - anchor.s()),
+                             point.t() - cycle_time, point.v(), point.a(),
+                             point.da());
+  }
+  return shifted;
+}
+
 Status DpStSpeedOptimizer::Process(const SLBoundary& adc_sl_boundary,
                                    const PathData& path_data,
                                    const common::TrajectoryPoint& init_point,
@@ -77,10 +105,14 @@ Status DpStSpeedOptimizer::Process(const SLBoundary& adc_sl_boundary,
     const std::string msg(Name() +
                           ":Failed to search graph with dynamic programming.");
     AERROR << msg;
+    last_speed_data_.clear();
+    last_lane_id_.clear();
     RecordDebugInfo(*speed_data, reference_line_info_->mutable_st_graph_data()
                                      ->mutable_st_graph_debug());
     return Status(ErrorCode::PLANNING_ERROR, msg);
   }
+  last_speed_data_ = *speed_data;
+  last_lane_id_ = reference_line_info_->Lanes().Id();
   RecordDebugInfo(
       *speed_data,
       reference_line_info_->mutable_st_graph_data()->mutable_st_graph_debug());
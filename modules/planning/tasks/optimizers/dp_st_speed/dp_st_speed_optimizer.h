@@ -25,6 +25,7 @@
 #include "modules/planning/proto/dp_st_speed_config.pb.h"
 #include "modules/planning/proto/planning_internal.pb.h"
 
+#include "modules/planning/common/speed/speed_data.h"
 #include "modules/planning/tasks/optimizers/speed_optimizer.h"
 
 namespace apollo {
@@ -50,11 +51,20 @@ class DpStSpeedOptimizer : public SpeedOptimizer {
 
   bool SearchStGraph(SpeedData* speed_data) const;
 
+  // Last cycle's speed profile shifted into the current frame, used to warm
+  // start the dp search. Returns an empty profile when no usable result from
+  // last cycle is available.
+  SpeedData ShiftedLastSpeedProfile() const;
+
  private:
   common::TrajectoryPoint init_point_;
   const ReferenceLine* reference_line_ = nullptr;
   SLBoundary adc_sl_boundary_;
   DpStSpeedConfig dp_st_speed_config_;
+
+  // warm start state carried across planning cycles
+  SpeedData last_speed_data_;
+  std::string last_lane_id_;
 };
 
 }  // namespace planning
@@ -20,6 +20,7 @@
 
 #include "modules/planning/tasks/optimizers/path_optimizer.h"
 
+#include "cyber/common/log.h"
 #include "modules/planning/common/planning_gflags.h"
 
 namespace apollo {
@@ -32,6 +33,13 @@ PathOptimizer::PathOptimizer(const TaskConfig& config) : Task(config) {}
 Status PathOptimizer::Execute(Frame* frame,
                               ReferenceLineInfo* const reference_line_info) {
   Task::Execute(frame, reference_line_info);
+  if (IsCycleDeadlineExceeded() && !reference_line_info->path_data().Empty()) {
+    // A usable path from an earlier task is already in place; skip the
+    // refinement instead of overrunning the cycle.
+    AWARN << "Cycle deadline passed before " << Name()
+          << "; keeping the existing path";
+    return Status::OK();
+  }
   auto ret = Process(
       reference_line_info->speed_data(), reference_line_info->reference_line(),
       frame->PlanningStartPoint(), reference_line_info->mutable_path_data());
@@ -65,8 +65,14 @@ common::Status PiecewiseJerkPathOptimizer::Process(
   std::array<double, 3> init_lateral_state{frenet_point.l(), frenet_point.dl(),
                                            frenet_point.ddl()};
 
-  auto fem_1d_qp_ = std::make_unique<Fem1dQpProblem>(
-      num_of_points, init_lateral_state, delta_s, w, FLAGS_lateral_jerk_bound);
+  if (!FLAGS_enable_fem_1d_qp_hot_start || fem_1d_qp_ == nullptr ||
+      !fem_1d_qp_->IsSameProblem(num_of_points, delta_s)) {
+    fem_1d_qp_ = std::make_unique<Fem1dQpProblem>(
+        num_of_points, init_lateral_state, delta_s, w,
+        FLAGS_lateral_jerk_bound);
+  } else {
+    fem_1d_qp_->ResetInitConditions(init_lateral_state);
+  }
 
   auto start_time = std::chrono::system_clock::now();
 
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include "modules/planning/math/finite_element_qp/fem_1d_qp_problem.h"
 #include "modules/planning/tasks/optimizers/path_optimizer.h"
 
 namespace apollo {
@@ -36,6 +39,10 @@ class PiecewiseJerkPathOptimizer : public PathOptimizer {
                          const ReferenceLine& reference_line,
                          const common::TrajectoryPoint& init_point,
                          PathData* const path_data) override;
+
+  // kept across planning cycles so that the osqp workspace can be hot
+  // started when the horizon discretization is unchanged.
+  std::unique_ptr<Fem1dQpProblem> fem_1d_qp_;
 };
 
 }  // namespace planning
@@ -35,8 +35,13 @@ QpSplinePathOptimizer::QpSplinePathOptimizer(const TaskConfig& config)
   qp_spline_path_config_ = config.qp_spline_path_config();
 
   std::vector<double> init_knots;
-  spline_solver_.reset(new ActiveSetSpline1dSolver(
-      init_knots, qp_spline_path_config_.spline_order()));
+  if (qp_spline_path_config_.use_osqp_solver()) {
+    spline_solver_.reset(new OsqpSpline1dSolver(
+        init_knots, qp_spline_path_config_.spline_order()));
+  } else {
+    spline_solver_.reset(new ActiveSetSpline1dSolver(
+        init_knots, qp_spline_path_config_.spline_order()));
+  }
   SetName("QpSplinePathOptimizer");
 }
 
@@ -29,6 +29,7 @@
 #include "modules/planning/proto/qp_spline_path_config.pb.h"
 
 #include "modules/planning/math/smoothing_spline/active_set_spline_1d_solver.h"
+#include "modules/planning/math/smoothing_spline/osqp_spline_1d_solver.h"
 #include "modules/planning/tasks/optimizers/path_optimizer.h"
 
 namespace apollo {
@@ -47,7 +47,8 @@ QpSplineStSpeedOptimizer::QpSplineStSpeedOptimizer(const TaskConfig& config)
   qp_st_speed_config_ = config.qp_st_speed_config();
   std::vector<double> init_knots;
 
-  if (FLAGS_use_osqp_optimizer_for_qp_st) {
+  if (FLAGS_use_osqp_optimizer_for_qp_st ||
+      qp_st_speed_config_.use_osqp_solver()) {
     spline_solver_.reset(new OsqpSpline1dSolver(init_knots, 5));
   } else {
     spline_solver_.reset(new ActiveSetSpline1dSolver(init_knots, 5));
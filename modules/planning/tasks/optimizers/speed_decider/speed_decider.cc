@@ -181,6 +181,54 @@ bool SpeedDecider::IsFollowTooClose(const Obstacle& obstacle) const {
   return distance < std::pow((ego_speed - obs_speed), 2) * 0.5 / decel;
 }
 
+SpeedDecider::FollowClass SpeedDecider::ClassifyFollow(
+    const Obstacle& obstacle) const {
+  const auto& boundary = obstacle.st_boundary();
+  if (!CheckIsFollowByT(boundary) ||
+      boundary.max_t() - boundary.min_t() <= FLAGS_follow_min_time_sec) {
+    return FOLLOW_NONE;
+  }
+  const auto box = obstacle.PerceptionBoundingBox();
+  common::SLPoint sl_point;
+  reference_line_->XYToSL({box.center_x(), box.center_y()}, &sl_point);
+  if (std::abs(sl_point.l()) >= FLAGS_follow_min_obs_lateral_distance) {
+    return FOLLOW_NONE;
+  }
+  // stop for low_speed decelerating, follow for high speed or low speed
+  // accelerating
+  return IsFollowTooClose(obstacle) ? FOLLOW_TOO_CLOSE : FOLLOW_NORMAL;
+}
+
+SpeedDecider::DecisionAction SpeedDecider::LookupDecision(
+    StPosition position, bool keep_clear, FollowClass follow_class,
+    bool blocking) {
+  // table indexed by [position - 1][keep_clear][follow_class][blocking],
+  // built once so the per-obstacle path is a plain lookup
+  struct Table {
+    DecisionAction entry[3][2][3][2];
+    Table() {
+      for (int f = 0; f < 3; ++f) {
+        for (int b = 0; b < 2; ++b) {
+          entry[ABOVE - 1][0][f][b] = ACTION_OVERTAKE;
+          entry[ABOVE - 1][1][f][b] = ACTION_IGNORE;
+          entry[BELOW - 1][1][f][b] = ACTION_STOP_KEEP_CLEAR;
+          for (int k = 0; k < 2; ++k) {
+            entry[CROSS - 1][k][f][b] = b ? ACTION_STOP_CROSS : ACTION_NONE;
+          }
+        }
+        entry[BELOW - 1][0][f][0] = ACTION_YIELD;
+        entry[BELOW - 1][0][f][1] = ACTION_YIELD;
+      }
+      for (int b = 0; b < 2; ++b) {
+        entry[BELOW - 1][0][FOLLOW_TOO_CLOSE][b] = ACTION_STOP_TOO_CLOSE;
+        entry[BELOW - 1][0][FOLLOW_NORMAL][b] = ACTION_FOLLOW;
+      }
+    }
+  };
+  static const Table table;
+  return table.entry[position - 1][keep_clear][follow_class][blocking];
+}
+
 Status SpeedDecider::MakeObjectDecision(
     const SpeedData& speed_profile, PathDecision* const path_decision) const {
   if (speed_profile.size() < 2) {
@@ -204,86 +252,88 @@ Status SpeedDecider::MakeObjectDecision(
       continue;
     }
 
+    const bool is_keep_clear =
+        boundary.boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR;
     auto position = GetStPosition(path_decision, speed_profile, boundary);
-    if (boundary.boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR) {
-      if (CheckKeepClearBlocked(path_decision, *obstacle)) {
-        position = BELOW;
-      }
+    if (is_keep_clear && CheckKeepClearBlocked(path_decision, *obstacle)) {
+      position = BELOW;
     }
 
-    auto box = obstacle->PerceptionBoundingBox();
-    common::SLPoint start_sl_point;
-    reference_line_->XYToSL({box.center_x(), box.center_y()}, &start_sl_point);
-    double start_abs_l = std::abs(start_sl_point.l());
-
-    switch (position) {
-      case BELOW:
-        if (boundary.boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR) {
-          ObjectDecisionType stop_decision;
-          if (CreateStopDecision(*mutable_obstacle, &stop_decision, 0.0)) {
-            mutable_obstacle->AddLongitudinalDecision("dp_st_graph/keep_clear",
-                                                      stop_decision);
-          }
-        } else if (CheckIsFollowByT(boundary) &&
-                   (boundary.max_t() - boundary.min_t() >
-                    FLAGS_follow_min_time_sec) &&
-                   start_abs_l < FLAGS_follow_min_obs_lateral_distance) {
-          // stop for low_speed decelerating
-          if (IsFollowTooClose(*mutable_obstacle)) {
-            ObjectDecisionType stop_decision;
-            if (CreateStopDecision(*mutable_obstacle, &stop_decision,
-                                   -FLAGS_min_stop_distance_obstacle)) {
-              mutable_obstacle->AddLongitudinalDecision("dp_st_graph/too_close",
-                                                        stop_decision);
-            }
-          } else {  // high speed or low speed accelerating
-            // FOLLOW decision
-            ObjectDecisionType follow_decision;
-            if (CreateFollowDecision(*mutable_obstacle, &follow_decision)) {
-              mutable_obstacle->AddLongitudinalDecision("dp_st_graph",
-                                                        follow_decision);
-            }
-          }
-        } else {
-          // YIELD decision
-          ObjectDecisionType yield_decision;
-          if (CreateYieldDecision(*mutable_obstacle, &yield_decision)) {
-            mutable_obstacle->AddLongitudinalDecision("dp_st_graph",
-                                                      yield_decision);
-          }
+    // the follow classification is the only predicate that needs the
+    // lateral projection, so skip it unless it can affect the decision
+    FollowClass follow_class = FOLLOW_NONE;
+    if (position == BELOW && !is_keep_clear) {
+      follow_class = ClassifyFollow(*mutable_obstacle);
+    }
+
+    const auto action =
+        LookupDecision(position, is_keep_clear, follow_class,
+                       mutable_obstacle->IsBlockingObstacle());
+    switch (action) {
+      case ACTION_STOP_KEEP_CLEAR: {
+        ObjectDecisionType stop_decision;
+        if (CreateStopDecision(*mutable_obstacle, &stop_decision, 0.0)) {
+          mutable_obstacle->AddLongitudinalDecision("dp_st_graph/keep_clear",
+                                                    stop_decision);
         }
         break;
-      case ABOVE:
-        if (boundary.boundary_type() == STBoundary::BoundaryType::KEEP_CLEAR) {
-          ObjectDecisionType ignore;
-          ignore.mutable_ignore();
-          mutable_obstacle->AddLongitudinalDecision("dp_st_graph", ignore);
-        } else {
-          // OVERTAKE decision
-          ObjectDecisionType overtake_decision;
-          if (CreateOvertakeDecision(*mutable_obstacle, &overtake_decision)) {
-            mutable_obstacle->AddLongitudinalDecision("dp_st_graph/overtake",
-                                                      overtake_decision);
-          }
+      }
+      case ACTION_STOP_TOO_CLOSE: {
+        ObjectDecisionType stop_decision;
+        if (CreateStopDecision(*mutable_obstacle, &stop_decision,
+                               -FLAGS_min_stop_distance_obstacle)) {
+          mutable_obstacle->AddLongitudinalDecision("dp_st_graph/too_close",
+                                                    stop_decision);
         }
         break;
-      case CROSS:
-        if (mutable_obstacle->IsBlockingObstacle()) {
-          ObjectDecisionType stop_decision;
-          if (CreateStopDecision(*mutable_obstacle, &stop_decision,
-                                 -FLAGS_min_stop_distance_obstacle)) {
-            mutable_obstacle->AddLongitudinalDecision("dp_st_graph/cross",
-                                                      stop_decision);
-          }
-          const std::string msg =
-              "Failed to find a solution for crossing obstacle:" +
-              mutable_obstacle->Id();
-          AERROR << msg;
-          return Status(ErrorCode::PLANNING_ERROR, msg);
+      }
+      case ACTION_FOLLOW: {
+        ObjectDecisionType follow_decision;
+        if (CreateFollowDecision(*mutable_obstacle, &follow_decision)) {
+          mutable_obstacle->AddLongitudinalDecision("dp_st_graph",
+                                                    follow_decision);
         }
         break;
+      }
+      case ACTION_YIELD: {
+        ObjectDecisionType yield_decision;
+        if (CreateYieldDecision(*mutable_obstacle, &yield_decision)) {
+          mutable_obstacle->AddLongitudinalDecision("dp_st_graph",
+                                                    yield_decision);
+        }
+        break;
+      }
+      case ACTION_IGNORE: {
+        ObjectDecisionType ignore;
+        ignore.mutable_ignore();
+        mutable_obstacle->AddLongitudinalDecision("dp_st_graph", ignore);
+        break;
+      }
+      case ACTION_OVERTAKE: {
+        ObjectDecisionType overtake_decision;
+        if (CreateOvertakeDecision(*mutable_obstacle, &overtake_decision)) {
+          mutable_obstacle->AddLongitudinalDecision("dp_st_graph/overtake",
+                                                    overtake_decision);
+        }
+        break;
+      }
+      case ACTION_STOP_CROSS: {
+        ObjectDecisionType stop_decision;
+        if (CreateStopDecision(*mutable_obstacle, &stop_decision,
+                               -FLAGS_min_stop_distance_obstacle)) {
+          mutable_obstacle->AddLongitudinalDecision("dp_st_graph/cross",
+                                                    stop_decision);
+        }
+        const std::string msg =
+            "Failed to find a solution for crossing obstacle:" +
+            mutable_obstacle->Id();
+        AERROR << msg;
+        return Status(ErrorCode::PLANNING_ERROR, msg);
+      }
+      case ACTION_NONE:
+        break;
       default:
-        AERROR << "Unknown position:" << position;
+        AERROR << "Unknown decision action:" << action;
     }
     AppendIgnoreDecision(mutable_obstacle);
   }
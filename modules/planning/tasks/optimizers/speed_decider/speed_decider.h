@@ -41,10 +41,42 @@ class SpeedDecider : public Task {
     CROSS = 3,
   };
 
+  enum FollowClass {
+    FOLLOW_NONE = 0,
+    FOLLOW_TOO_CLOSE = 1,
+    FOLLOW_NORMAL = 2,
+  };
+
+  enum DecisionAction {
+    ACTION_NONE = 0,
+    ACTION_IGNORE = 1,
+    ACTION_STOP_KEEP_CLEAR = 2,
+    ACTION_STOP_TOO_CLOSE = 3,
+    ACTION_FOLLOW = 4,
+    ACTION_YIELD = 5,
+    ACTION_OVERTAKE = 6,
+    ACTION_STOP_CROSS = 7,
+  };
+
   StPosition GetStPosition(const PathDecision* const path_decision,
                            const SpeedData& speed_profile,
                            const STBoundary& st_boundary) const;
 
+  /**
+   * @brief classify how the ADC should follow an obstacle below the speed
+   * profile. The lateral projection onto the reference line is only done
+   * here, so obstacles that end up above or crossing never pay for it.
+   **/
+  FollowClass ClassifyFollow(const Obstacle& obstacle) const;
+
+  /**
+   * @brief look up the longitudinal decision for one obstacle in a table
+   * precompiled over (st position, keep clear, follow class, blocking).
+   **/
+  static DecisionAction LookupDecision(StPosition position, bool keep_clear,
+                                       FollowClass follow_class,
+                                       bool blocking);
+
   bool CheckKeepClearCrossable(const PathDecision* const path_decision,
                                const SpeedData& speed_profile,
                                const STBoundary& keep_clear_st_boundary) const;
@@ -20,8 +20,10 @@
 
 #include "modules/planning/tasks/optimizers/speed_optimizer.h"
 
+#include "cyber/common/log.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/speed_limit.h"
+#include "modules/planning/common/speed_profile_generator.h"
 
 namespace apollo {
 namespace planning {
@@ -30,12 +32,27 @@ using apollo::common::Status;
 using apollo::planning_internal::StGraphBoundaryDebug;
 using apollo::planning_internal::STGraphDebug;
 
+constexpr double kSpeedOptimizationFallbackCost = 2e4;
+
 SpeedOptimizer::SpeedOptimizer(const TaskConfig& config) : Task(config) {}
 
 Status SpeedOptimizer::Execute(Frame* frame,
                                ReferenceLineInfo* reference_line_info) {
   Task::Execute(frame, reference_line_info);
 
+  if (IsCycleDeadlineExceeded()) {
+    // The heuristic profile currently in speed_data ignores obstacles, so
+    // degrade to the stopping fallback profile rather than keeping it.
+    AWARN << "Cycle deadline passed before " << Name()
+          << "; degrading to the fallback speed profile";
+    *reference_line_info->mutable_speed_data() =
+        SpeedProfileGenerator::GenerateFallbackSpeedProfile();
+    reference_line_info->AddCost(kSpeedOptimizationFallbackCost);
+    reference_line_info->set_trajectory_type(ADCTrajectory::SPEED_FALLBACK);
+    RecordDebugInfo(reference_line_info->speed_data());
+    return Status::OK();
+  }
+
   auto ret = Process(
       reference_line_info->AdcSlBoundary(), reference_line_info->path_data(),
       frame->PlanningStartPoint(), reference_line_info->reference_line(),
@@ -67,7 +67,39 @@ StBoundaryMapper::StBoundaryMapper(const SLBoundary& adc_sl_boundary,
       vehicle_param_(common::VehicleConfigHelper::GetConfig().vehicle_param()),
       planning_distance_(planning_distance),
       planning_time_(planning_time),
-      is_change_lane_(is_change_lane) {}
+      is_change_lane_(is_change_lane) {
+  InitAdcSampleBoxes();
+}
+
+void StBoundaryMapper::InitAdcSampleBoxes() {
+  const auto& path_points = path_data_.discretized_path();
+  if (path_points.size() < 2) {
+    return;
+  }
+  const int default_num_point = 50;
+  if (path_points.size() > 2 * static_cast<size_t>(default_num_point)) {
+    const auto ratio = path_points.size() / default_num_point;
+    std::vector<PathPoint> sampled_path_points;
+    for (size_t i = 0; i < path_points.size(); ++i) {
+      if (i % ratio == 0) {
+        sampled_path_points.push_back(path_points[i]);
+      }
+    }
+    sampled_discretized_path_ = DiscretizedPath(sampled_path_points);
+  } else {
+    sampled_discretized_path_ = DiscretizedPath(path_points);
+  }
+  const double step_length = vehicle_param_.front_edge_to_center();
+  const auto path_len =
+      std::min(FLAGS_max_trajectory_len, sampled_discretized_path_.Length());
+  for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
+    const auto curr_adc_path_point = sampled_discretized_path_.Evaluate(
+        path_s + sampled_discretized_path_.front().s());
+    adc_sample_s_.push_back(path_s);
+    adc_sample_boxes_.push_back(GetAdcBoundingBox(
+        curr_adc_path_point, speed_bounds_config_.boundary_buffer()));
+  }
+}
 
 Status StBoundaryMapper::CreateStBoundary(PathDecision* path_decision) const {
   const auto& obstacles = path_decision->obstacles();
@@ -158,6 +190,23 @@ Status StBoundaryMapper::CreateStBoundary(PathDecision* path_decision) const {
     }
   }
 
+  // per-frame simplification stats: how many ST constraint points the
+  // build-time simplification removed across all mapped boundaries
+  size_t raw_point_num = 0;
+  size_t kept_point_num = 0;
+  size_t boundary_num = 0;
+  for (const auto* obstacle : obstacles.Items()) {
+    const auto& boundary = obstacle->st_boundary();
+    if (boundary.IsEmpty()) {
+      continue;
+    }
+    raw_point_num += boundary.raw_point_num();
+    kept_point_num += boundary.lower_points().size();
+    ++boundary_num;
+  }
+  ADEBUG << "mapped " << boundary_num << " st boundaries, simplified "
+         << raw_point_num << " raw point pairs down to " << kept_point_num;
+
   return Status::OK();
 }
 
@@ -281,37 +330,23 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
     }
   } else {
     const int default_num_point = 50;
-    DiscretizedPath discretized_path;
-    if (path_points.size() > 2 * default_num_point) {
-      const auto ratio = path_points.size() / default_num_point;
-      std::vector<PathPoint> sampled_path_points;
-      for (size_t i = 0; i < path_points.size(); ++i) {
-        if (i % ratio == 0) {
-          sampled_path_points.push_back(path_points[i]);
-        }
-      }
-      discretized_path = DiscretizedPath(sampled_path_points);
-    } else {
-      discretized_path = DiscretizedPath(path_points);
-    }
-    for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
-      const auto& trajectory_point = trajectory.trajectory_point(i);
-      const Box2d obs_box = obstacle.GetBoundingBox(trajectory_point);
-
-      double trajectory_point_time = trajectory_point.relative_time();
-      constexpr double kNegtiveTimeThreshold = -1.0;
-      if (trajectory_point_time < kNegtiveTimeThreshold) {
-        continue;
-      }
+    const DiscretizedPath& discretized_path = sampled_discretized_path_;
+    // walk the shared forecast sampled on planning's time grid instead of
+    // re-deriving a box from every raw prediction point; samples past the
+    // trajectory's own time span only repeat the terminal pose and are
+    // skipped
+    const Obstacle::SampledForecast& forecast = obstacle.sampled_forecast();
+    for (size_t i = 0; i < forecast.num_within_trajectory; ++i) {
+      const Box2d obs_box = obstacle.GetBoundingBoxAtSample(i);
+      double trajectory_point_time = forecast.relative_time[i];
 
       const double step_length = vehicle_param_.front_edge_to_center();
-      auto path_len =
-          std::min(FLAGS_max_trajectory_len, discretized_path.Length());
-      for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
-        const auto curr_adc_path_point =
-            discretized_path.Evaluate(path_s + discretized_path.front().s());
-        if (CheckOverlap(curr_adc_path_point, obs_box,
-                         speed_bounds_config_.boundary_buffer())) {
+      // coarse scan over the precomputed adc footprint boxes;
+      // Box2d::HasOverlap rejects on axis-aligned bounds before the full
+      // separating-axis test, so far-away obstacles fail fast
+      for (size_t k = 0; k < adc_sample_boxes_.size(); ++k) {
+        const double path_s = adc_sample_s_[k];
+        if (obs_box.HasOverlap(adc_sample_boxes_[k])) {
           // found overlap, start searching with higher resolution
           const double backward_distance = -step_length;
           const double forward_distance = vehicle_param_.length() +
@@ -430,6 +465,11 @@ Status StBoundaryMapper::MapWithDecision(
 bool StBoundaryMapper::CheckOverlap(const PathPoint& path_point,
                                     const Box2d& obs_box,
                                     const double buffer) const {
+  return obs_box.HasOverlap(GetAdcBoundingBox(path_point, buffer));
+}
+
+Box2d StBoundaryMapper::GetAdcBoundingBox(const PathPoint& path_point,
+                                          const double buffer) const {
   double left_delta_l = 0.0;
   double right_delta_l = 0.0;
   if (is_change_lane_) {
@@ -451,10 +491,9 @@ bool StBoundaryMapper::CheckOverlap(const PathPoint& path_point,
           .rotate(path_point.theta());
   Vec2d center = Vec2d(path_point.x(), path_point.y()) + vec_to_center;
 
-  const Box2d adc_box =
-      Box2d(center, path_point.theta(), vehicle_param_.length() + 2 * buffer,
-            vehicle_param_.width() + 2 * buffer);
-  return obs_box.HasOverlap(adc_box);
+  return Box2d(center, path_point.theta(),
+               vehicle_param_.length() + 2 * buffer,
+               vehicle_param_.width() + 2 * buffer);
 }
 
 }  // namespace planning
@@ -54,6 +54,17 @@ class StBoundaryMapper {
                     const apollo::common::math::Box2d& obs_box,
                     const double buffer) const;
 
+  apollo::common::math::Box2d GetAdcBoundingBox(
+      const apollo::common::PathPoint& path_point, const double buffer) const;
+
+  /**
+   * Sample the path and precompute the adc footprint box at every coarse
+   * scan position. The path, vehicle shape and buffers are fixed per mapper,
+   * so these boxes are shared by the coarse overlap scan of every obstacle
+   * trajectory point instead of being rebuilt per point.
+   */
+  void InitAdcSampleBoxes();
+
   /**
    * Creates valid st boundary upper_points and lower_points
    * If return true, upper_points.size() > 1 and
@@ -81,6 +92,9 @@ class StBoundaryMapper {
   const double planning_distance_;
   const double planning_time_;
   bool is_change_lane_ = false;
+  DiscretizedPath sampled_discretized_path_;
+  std::vector<double> adc_sample_s_;
+  std::vector<apollo::common::math::Box2d> adc_sample_boxes_;
 };
 
 }  // namespace planning
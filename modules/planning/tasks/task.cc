@@ -22,6 +22,9 @@
 
 #include "modules/planning/proto/planning_config.pb.h"
 
+#include "modules/common/time/time.h"
+#include "modules/planning/common/planning_gflags.h"
+
 namespace apollo {
 namespace planning {
 
@@ -44,5 +47,13 @@ Status Task::Execute(Frame* frame) {
   return Status::OK();
 }
 
+bool Task::IsCycleDeadlineExceeded() const {
+  if (!FLAGS_enable_planning_cycle_deadline || frame_ == nullptr) {
+    return false;
+  }
+  return common::time::Clock::NowInSeconds() >
+         frame_->cycle_deadline_timestamp();
+}
+
 }  // namespace planning
 }  // namespace apollo
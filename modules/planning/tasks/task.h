@@ -49,6 +49,13 @@ class Task {
   virtual apollo::common::Status Execute(Frame* frame);
 
  protected:
+  /**
+   * @brief true when deadline-aware execution is on and the current cycle
+   * has used up its budget; expensive tasks should fall back instead of
+   * overrunning the cycle.
+   */
+  bool IsCycleDeadlineExceeded() const;
+
   Frame* frame_ = nullptr;
   ReferenceLineInfo* reference_line_info_ = nullptr;
 
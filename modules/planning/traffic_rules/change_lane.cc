@@ -128,6 +128,8 @@ bool ChangeLane::CreateGuardObstacle(
     tp->mutable_path_point()->set_s(s);
     tp->mutable_path_point()->set_kappa(ref_point.kappa());
   }
+  // keep the shared forecast in sync with the extended trajectory
+  obstacle->BuildSampledForecast();
   return true;
 }
 
@@ -46,7 +46,6 @@ using apollo::common::math::Vec2d;
 using apollo::common::time::Clock;
 using apollo::common::util::WithinBound;
 using apollo::hdmap::CrosswalkInfoConstPtr;
-using apollo::hdmap::HDMapUtil;
 using apollo::hdmap::PathOverlap;
 using apollo::perception::PerceptionObstacle;
 using CrosswalkToStop =
@@ -103,8 +102,8 @@ void Crosswalk::MakeDecisions(Frame* const frame,
 
   const auto& reference_line = reference_line_info->reference_line();
   for (auto crosswalk_overlap : crosswalk_overlaps_) {
-    auto crosswalk_ptr = HDMapUtil::BaseMap().GetCrosswalkById(
-        hdmap::MakeMapId(crosswalk_overlap->object_id));
+    auto crosswalk_ptr =
+        reference_line_info->GetCrosswalkInfo(crosswalk_overlap->object_id);
     std::string crosswalk_id = crosswalk_ptr->id().id();
 
     // skip crosswalk if master vehicle body already passes the stop line
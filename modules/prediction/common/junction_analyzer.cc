@@ -31,31 +31,50 @@ using apollo::hdmap::JunctionInfo;
 using apollo::hdmap::LaneInfo;
 using ConstLaneInfoPtr = std::shared_ptr<const LaneInfo>;
 
-std::shared_ptr<const JunctionInfo> JunctionAnalyzer::junction_info_ptr_;
-std::unordered_map<std::string, JunctionExit> JunctionAnalyzer::junction_exits_;
-std::unordered_map<std::string, JunctionFeature>
-    JunctionAnalyzer::junction_features_;
+std::unordered_map<std::string, JunctionAnalyzer::JunctionCacheEntry>
+    JunctionAnalyzer::junction_cache_;
+std::deque<std::string> JunctionAnalyzer::junction_id_queue_;
+JunctionAnalyzer::JunctionCacheEntry* JunctionAnalyzer::current_entry_ =
+    nullptr;
 
 void JunctionAnalyzer::Init(const std::string& junction_id) {
-  if (junction_info_ptr_ != nullptr &&
-      junction_info_ptr_->id().id() == junction_id) {
+  if (current_entry_ != nullptr &&
+      current_entry_->junction_info_ptr->id().id() == junction_id) {
     return;
   }
-  Clear();
-  junction_info_ptr_ = PredictionMap::JunctionById(junction_id);
-  SetAllJunctionExits();
+  auto iter = junction_cache_.find(junction_id);
+  if (iter != junction_cache_.end()) {
+    current_entry_ = &iter->second;
+    return;
+  }
+  // Junctions along a drive are encountered roughly in order, so FIFO
+  // eviction keeps the active ones resident. Note element pointers of
+  // std::unordered_map stay valid across insert/erase.
+  constexpr size_t kMaxCachedJunctionNum = 16;
+  while (junction_cache_.size() >= kMaxCachedJunctionNum) {
+    junction_cache_.erase(junction_id_queue_.front());
+    junction_id_queue_.pop_front();
+  }
+  JunctionCacheEntry* entry = &junction_cache_[junction_id];
+  junction_id_queue_.push_back(junction_id);
+  entry->junction_info_ptr = PredictionMap::JunctionById(junction_id);
+  SetAllJunctionExits(entry);
+  current_entry_ = entry;
+  // warm the range so per-obstacle feature queries are lookups only
+  ComputeJunctionRange();
 }
 
 void JunctionAnalyzer::Clear() {
   // Clear all data
-  junction_info_ptr_ = nullptr;
-  junction_exits_.clear();
-  junction_features_.clear();
+  current_entry_ = nullptr;
+  junction_cache_.clear();
+  junction_id_queue_.clear();
 }
 
-void JunctionAnalyzer::SetAllJunctionExits() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  for (const auto& overlap_id : junction_info_ptr_->junction().overlap_id()) {
+void JunctionAnalyzer::SetAllJunctionExits(JunctionCacheEntry* entry) {
+  CHECK_NOTNULL(entry->junction_info_ptr);
+  const auto& junction = entry->junction_info_ptr->junction();
+  for (const auto& overlap_id : junction.overlap_id()) {
     auto overlap_info_ptr = PredictionMap::OverlapById(overlap_id.id());
     if (overlap_info_ptr == nullptr) {
       continue;
@@ -75,7 +94,7 @@ void JunctionAnalyzer::SetAllJunctionExits() {
           junction_exit.set_exit_heading(lane_info_ptr->Heading(s));
           junction_exit.set_exit_width(lane_info_ptr->GetWidth(s));
           // add junction_exit to hashtable
-          junction_exits_[lane_id] = junction_exit;
+          entry->junction_exits[lane_id] = junction_exit;
         }
       }
     }
@@ -98,7 +117,7 @@ std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
     std::unordered_set<std::string> visited_exit_lanes;
     if (IsExitLane(curr_lane_id) &&
         visited_exit_lanes.find(curr_lane_id) == visited_exit_lanes.end()) {
-      junction_exits.push_back(junction_exits_[curr_lane_id]);
+      junction_exits.push_back(current_entry_->junction_exits[curr_lane_id]);
       visited_exit_lanes.insert(curr_lane_id);
       continue;
     }
@@ -116,8 +135,10 @@ std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
 
 const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
     const std::string& start_lane_id) {
-  if (junction_features_.find(start_lane_id) != junction_features_.end()) {
-    return junction_features_[start_lane_id];
+  CHECK_NOTNULL(current_entry_);
+  auto& junction_features = current_entry_->junction_features;
+  if (junction_features.find(start_lane_id) != junction_features.end()) {
+    return junction_features[start_lane_id];
   }
   JunctionFeature junction_feature;
   junction_feature.set_junction_id(GetJunctionId());
@@ -129,8 +150,8 @@ const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
   }
   junction_feature.mutable_enter_lane()->set_lane_id(start_lane_id);
   junction_feature.add_start_lane_id(start_lane_id);
-  junction_features_[start_lane_id] = junction_feature;
-  return junction_features_[start_lane_id];
+  junction_features[start_lane_id] = junction_feature;
+  return junction_features[start_lane_id];
 }
 
 JunctionFeature JunctionAnalyzer::GetJunctionFeature(
@@ -161,27 +182,35 @@ JunctionFeature JunctionAnalyzer::GetJunctionFeature(
 }
 
 bool JunctionAnalyzer::IsExitLane(const std::string& lane_id) {
-  return junction_exits_.find(lane_id) != junction_exits_.end();
+  CHECK_NOTNULL(current_entry_);
+  return current_entry_->junction_exits.find(lane_id) !=
+         current_entry_->junction_exits.end();
 }
 
 const std::string& JunctionAnalyzer::GetJunctionId() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  return junction_info_ptr_->id().id();
+  CHECK_NOTNULL(current_entry_);
+  CHECK_NOTNULL(current_entry_->junction_info_ptr);
+  return current_entry_->junction_info_ptr->id().id();
 }
 
 double JunctionAnalyzer::ComputeJunctionRange() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  if (!junction_info_ptr_->junction().has_polygon() ||
-      junction_info_ptr_->junction().polygon().point_size() < 3) {
+  CHECK_NOTNULL(current_entry_);
+  CHECK_NOTNULL(current_entry_->junction_info_ptr);
+  if (current_entry_->junction_range > 0.0) {
+    return current_entry_->junction_range;
+  }
+  const auto& junction = current_entry_->junction_info_ptr->junction();
+  if (!junction.has_polygon() || junction.polygon().point_size() < 3) {
     AERROR << "Junction [" << GetJunctionId()
            << "] has not enough polygon points to compute range";
-    return FLAGS_defualt_junction_range;
+    current_entry_->junction_range = FLAGS_defualt_junction_range;
+    return current_entry_->junction_range;
   }
   double x_min = std::numeric_limits<double>::infinity();
   double x_max = -std::numeric_limits<double>::infinity();
   double y_min = std::numeric_limits<double>::infinity();
   double y_max = -std::numeric_limits<double>::infinity();
-  for (const auto& point : junction_info_ptr_->junction().polygon().point()) {
+  for (const auto& point : junction.polygon().point()) {
     x_min = std::min(x_min, point.x());
     x_max = std::max(x_max, point.x());
     y_min = std::min(y_min, point.y());
@@ -189,8 +218,8 @@ double JunctionAnalyzer::ComputeJunctionRange() {
   }
   double dx = std::abs(x_max - x_min);
   double dy = std::abs(y_max - y_min);
-  double range = std::sqrt(dx * dx + dy * dy);
-  return range;
+  current_entry_->junction_range = std::sqrt(dx * dx + dy * dy);
+  return current_entry_->junction_range;
 }
 
 }  // namespace prediction
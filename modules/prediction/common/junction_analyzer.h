@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -70,9 +71,26 @@ class JunctionAnalyzer {
 
  private:
   /**
-   * @brief Set all junction exits in the hashtable junction_exits_
+   * Per-junction cache entry. The junction-level part (exits, range) is
+   * computed once when a junction is first encountered; the per-start-lane
+   * features accumulate on demand. Entries are keyed by junction ID and
+   * kept across cycles, so obstacles in different junctions no longer
+   * rebuild each other's data every frame.
    */
-  static void SetAllJunctionExits();
+  struct JunctionCacheEntry {
+    // junction_info pointer associated to the junction ID
+    std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr;
+    double junction_range = 0.0;
+    // Hashtable: exit_lane_id -> junction_exit
+    std::unordered_map<std::string, JunctionExit> junction_exits;
+    // Hashtable: start_lane_id -> junction_feature
+    std::unordered_map<std::string, JunctionFeature> junction_features;
+  };
+
+  /**
+   * @brief Set all junction exits in the hashtable entry->junction_exits
+   */
+  static void SetAllJunctionExits(JunctionCacheEntry* entry);
 
   /**
    * @brief Get all filtered junction exits associated to start lane ID
@@ -90,12 +108,12 @@ class JunctionAnalyzer {
   static bool IsExitLane(const std::string& lane_id);
 
  private:
-  // junction_info pointer associated to the input junction_id
-  static std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr_;
-  // Hashtable: exit_lane_id -> junction_exit
-  static std::unordered_map<std::string, JunctionExit> junction_exits_;
-  // Hashtable: start_lane_id -> junction_feature
-  static std::unordered_map<std::string, JunctionFeature> junction_features_;
+  // Hashtable: junction_id -> cache entry, bounded FIFO eviction
+  static std::unordered_map<std::string, JunctionCacheEntry> junction_cache_;
+  // Insertion order of the cached junction IDs, oldest in front
+  static std::deque<std::string> junction_id_queue_;
+  // Entry selected by the last Init call; never null after Init
+  static JunctionCacheEntry* current_entry_;
 };
 
 }  // namespace prediction
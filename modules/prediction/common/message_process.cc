@@ -83,6 +83,12 @@ bool MessageProcess::Init() {
 void MessageProcess::OnPerception(
     const perception::PerceptionObstacles& perception_obstacles,
     PredictionObstacles* const prediction_obstacles) {
+  ContainerProcess(perception_obstacles);
+  PredictObstacles(prediction_obstacles);
+}
+
+void MessageProcess::ContainerProcess(
+    const perception::PerceptionObstacles& perception_obstacles) {
   // Insert obstacle
   auto end_time1 = std::chrono::system_clock::now();
   auto ptr_obstacles_container =
@@ -167,11 +173,20 @@ void MessageProcess::OnPerception(
   auto end_time7 = std::chrono::system_clock::now();
   diff = end_time7 - end_time6;
   ADEBUG << "Time to evaluate: " << diff.count() * 1000 << " msec.";
+}
+
+void MessageProcess::PredictObstacles(
+    PredictionObstacles* const prediction_obstacles) {
+  // No trajectory generation when dumping features offline
+  if (FLAGS_prediction_offline_mode == 1) {
+    return;
+  }
 
   // Make predictions
+  auto end_time1 = std::chrono::system_clock::now();
   PredictorManager::Instance()->Run();
-  auto end_time8 = std::chrono::system_clock::now();
-  diff = end_time8 - end_time7;
+  auto end_time2 = std::chrono::system_clock::now();
+  std::chrono::duration<double> diff = end_time2 - end_time1;
   ADEBUG << "Time to predict: " << diff.count() * 1000 << " msec.";
 
   // Get predicted obstacles
@@ -40,6 +40,16 @@ class MessageProcess {
       const perception::PerceptionObstacles &perception_obstacles,
       PredictionObstacles *const prediction_obstacles);
 
+  // The two stages of OnPerception, split out so that the component can
+  // overlap the predictor stage with the next frame. ContainerProcess
+  // updates the containers, lane graphs and model evaluations for the
+  // given frame; PredictObstacles generates the predicted trajectories
+  // from that state.
+  static void ContainerProcess(
+      const perception::PerceptionObstacles &perception_obstacles);
+
+  static void PredictObstacles(PredictionObstacles *const prediction_obstacles);
+
   static void OnLocalization(
       const localization::LocalizationEstimate &localization);
 
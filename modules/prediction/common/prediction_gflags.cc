@@ -140,6 +140,10 @@ DEFINE_string(evaluator_vehicle_junction_mlp_file,
               "Vehicle junction MLP model file");
 DEFINE_int32(max_num_obstacles, 300,
              "maximal number of obstacles stored in obstacles container.");
+DEFINE_int32(max_num_cached_lane_graphs, 500,
+             "maximal number of lane graphs cached across frames.");
+DEFINE_double(lane_graph_cache_s_interval, 20.0,
+              "s interval for bucketing cached lane graphs along a lane.");
 DEFINE_double(valid_position_diff_threshold, 0.5,
               "threshold of valid position difference");
 DEFINE_double(valid_position_diff_rate_threshold, 0.075,
@@ -203,6 +207,11 @@ DEFINE_bool(enable_lane_sequence_acc, false,
 DEFINE_bool(enable_trim_prediction_trajectory, true,
             "If trim the prediction trajectory to avoid crossing"
             "protected adc planning trajectory.");
+DEFINE_bool(enable_async_obstacle_prediction, false,
+            "If predict obstacle trajectories as concurrent cyber tasks.");
+DEFINE_bool(enable_pipelined_prediction, false,
+            "If run the predictor stage and result publishing as a cyber "
+            "task overlapping the next frame's container update.");
 DEFINE_double(adc_trajectory_search_length, 10.0,
               "How far to search junction along adc planning trajectory");
 DEFINE_double(virtual_lane_radius, 0.5, "Radius to search virtual lanes");
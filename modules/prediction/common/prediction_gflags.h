@@ -90,6 +90,8 @@ DECLARE_string(evaluator_vehicle_rnn_file);
 DECLARE_string(evaluator_vehicle_cruise_mlp_file);
 DECLARE_string(evaluator_vehicle_junction_mlp_file);
 DECLARE_int32(max_num_obstacles);
+DECLARE_int32(max_num_cached_lane_graphs);
+DECLARE_double(lane_graph_cache_s_interval);
 DECLARE_double(valid_position_diff_threshold);
 DECLARE_double(valid_position_diff_rate_threshold);
 DECLARE_double(split_rate);
@@ -125,6 +127,8 @@ DECLARE_double(lane_sequence_threshold_junction);
 DECLARE_double(lane_change_dist);
 DECLARE_bool(enable_lane_sequence_acc);
 DECLARE_bool(enable_trim_prediction_trajectory);
+DECLARE_bool(enable_async_obstacle_prediction);
+DECLARE_bool(enable_pipelined_prediction);
 DECLARE_double(adc_trajectory_search_length);
 DECLARE_double(virtual_lane_radius);
 DECLARE_double(default_lateral_approach_speed);
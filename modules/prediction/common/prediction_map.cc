@@ -72,6 +72,11 @@ std::shared_ptr<const JunctionInfo> PredictionMap::JunctionById(
   return HDMapUtil::BaseMap().GetJunctionById(hdmap::MakeMapId(str_id));
 }
 
+std::shared_ptr<const PNCJunctionInfo> PredictionMap::PNCJunctionById(
+    const std::string& str_id) {
+  return HDMapUtil::BaseMap().GetPNCJunctionById(hdmap::MakeMapId(str_id));
+}
+
 std::shared_ptr<const OverlapInfo> PredictionMap::OverlapById(
     const std::string& str_id) {
   return HDMapUtil::BaseMap().GetOverlapById(hdmap::MakeMapId(str_id));
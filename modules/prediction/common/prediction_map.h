@@ -83,6 +83,14 @@ class PredictionMap {
   static std::shared_ptr<const hdmap::JunctionInfo> JunctionById(
       const std::string& id);
 
+  /**
+   * @brief Get a shared pointer to a PNC junction by PNC junction ID.
+   * @param id The ID of the target PNC junction ID in the form of string.
+   * @return A shared pointer to the PNC junction with the input ID.
+   */
+  static std::shared_ptr<const hdmap::PNCJunctionInfo> PNCJunctionById(
+      const std::string& id);
+
   /**
    * @brief Get a shared pointer to a overlap by overlap ID.
    * @param id The ID of the target overlap ID in the form of string.
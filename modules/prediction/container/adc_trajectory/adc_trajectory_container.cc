@@ -46,6 +46,16 @@ void ADCTrajectoryContainer::Insert(
   ADEBUG << "Received a planning message ["
          << adc_trajectory_.ShortDebugString() << "].";
 
+  // Find ADC lane sequence
+  SetLaneSequence();
+  ADEBUG << "Generate an ADC lane id sequence [" << ToString(adc_lane_seq_)
+         << "].";
+
+  // Refresh junction candidates only when routing changed the corridor
+  if (adc_lane_seq_ != corridor_lane_seq_) {
+    BuildCorridorJunctionCache();
+  }
+
   // Find junction
   SetJunctionPolygon();
   ADEBUG << "Generate a polygon [" << adc_junction_polygon_.DebugString()
@@ -53,11 +63,6 @@ void ADCTrajectoryContainer::Insert(
   SetPNCJunctionPolygon();
   ADEBUG << "Generate a polygon [" << adc_pnc_junction_polygon_.DebugString()
          << "].";
-
-  // Find ADC lane sequence
-  SetLaneSequence();
-  ADEBUG << "Generate an ADC lane id sequence [" << ToString(adc_lane_seq_)
-         << "].";
 }
 
 bool ADCTrajectoryContainer::IsPointInJunction(const PathPoint& point) const {
@@ -98,6 +103,68 @@ bool ADCTrajectoryContainer::IsProtected() const {
          adc_trajectory_.right_of_way_status() == ADCTrajectory::PROTECTED;
 }
 
+void ADCTrajectoryContainer::BuildCorridorJunctionCache() {
+  corridor_lane_seq_ = adc_lane_seq_;
+  corridor_junctions_.clear();
+  corridor_pnc_junctions_.clear();
+
+  std::unordered_set<std::string> seen_junction_ids;
+  for (const auto& lane_id : corridor_lane_seq_) {
+    auto lane_info = PredictionMap::LaneById(lane_id);
+    if (lane_info == nullptr) {
+      continue;
+    }
+    for (const auto& overlap : lane_info->junctions()) {
+      for (const auto& object : overlap->overlap().object()) {
+        if (!object.has_junction_overlap_info()) {
+          continue;
+        }
+        const std::string& junction_id = object.id().id();
+        if (!seen_junction_ids.insert(junction_id).second) {
+          continue;
+        }
+        auto junction = PredictionMap::JunctionById(junction_id);
+        if (junction == nullptr || !junction->junction().has_polygon()) {
+          continue;
+        }
+        std::vector<Vec2d> vertices;
+        for (const auto& point : junction->junction().polygon().point()) {
+          vertices.emplace_back(point.x(), point.y());
+        }
+        if (vertices.size() >= 3) {
+          corridor_junctions_.push_back({junction, Polygon2d{vertices}});
+        }
+      }
+    }
+    for (const auto& overlap : lane_info->pnc_junctions()) {
+      for (const auto& object : overlap->overlap().object()) {
+        if (!object.has_pnc_junction_overlap_info()) {
+          continue;
+        }
+        const std::string& junction_id = object.id().id();
+        if (!seen_junction_ids.insert(junction_id).second) {
+          continue;
+        }
+        auto junction = PredictionMap::PNCJunctionById(junction_id);
+        if (junction == nullptr ||
+            !junction->pnc_junction().has_polygon()) {
+          continue;
+        }
+        std::vector<Vec2d> vertices;
+        for (const auto& point : junction->pnc_junction().polygon().point()) {
+          vertices.emplace_back(point.x(), point.y());
+        }
+        if (vertices.size() >= 3) {
+          corridor_pnc_junctions_.push_back({junction, Polygon2d{vertices}});
+        }
+      }
+    }
+  }
+  ADEBUG << "Cached " << corridor_junctions_.size() << " junctions and "
+         << corridor_pnc_junctions_.size()
+         << " PNC junctions along the route corridor.";
+}
+
 void ADCTrajectoryContainer::SetJunctionPolygon() {
   std::shared_ptr<const JunctionInfo> junction_info(nullptr);
 
@@ -120,10 +187,22 @@ void ADCTrajectoryContainer::SetJunctionPolygon() {
 
     double x = adc_trajectory_.trajectory_point(i).path_point().x();
     double y = adc_trajectory_.trajectory_point(i).path_point().y();
-    std::vector<std::shared_ptr<const JunctionInfo>> junctions =
-        PredictionMap::GetJunctions({x, y}, FLAGS_junction_search_radius);
-    if (!junctions.empty() && junctions.front() != nullptr) {
-      junction_info = junctions.front();
+    if (!corridor_lane_seq_.empty()) {
+      // Validate against the precomputed corridor candidates only
+      for (const auto& candidate : corridor_junctions_) {
+        if (candidate.polygon.DistanceTo({x, y}) <
+            FLAGS_junction_search_radius) {
+          junction_info = candidate.junction;
+          break;
+        }
+      }
+    } else {
+      // No corridor lanes in the planning message; fall back to a map scan
+      std::vector<std::shared_ptr<const JunctionInfo>> junctions =
+          PredictionMap::GetJunctions({x, y}, FLAGS_junction_search_radius);
+      if (!junctions.empty() && junctions.front() != nullptr) {
+        junction_info = junctions.front();
+      }
     }
   }
 
@@ -162,10 +241,22 @@ void ADCTrajectoryContainer::SetPNCJunctionPolygon() {
 
     double x = adc_trajectory_.trajectory_point(i).path_point().x();
     double y = adc_trajectory_.trajectory_point(i).path_point().y();
-    std::vector<std::shared_ptr<const PNCJunctionInfo>> junctions =
-        PredictionMap::GetPNCJunctions({x, y}, FLAGS_junction_search_radius);
-    if (!junctions.empty() && junctions.front() != nullptr) {
-      junction_info = junctions.front();
+    if (!corridor_lane_seq_.empty()) {
+      // Validate against the precomputed corridor candidates only
+      for (const auto& candidate : corridor_pnc_junctions_) {
+        if (candidate.polygon.DistanceTo({x, y}) <
+            FLAGS_junction_search_radius) {
+          junction_info = candidate.pnc_junction;
+          break;
+        }
+      }
+    } else {
+      // No corridor lanes in the planning message; fall back to a map scan
+      std::vector<std::shared_ptr<const PNCJunctionInfo>> junctions =
+          PredictionMap::GetPNCJunctions({x, y}, FLAGS_junction_search_radius);
+      if (!junctions.empty() && junctions.front() != nullptr) {
+        junction_info = junctions.front();
+      }
     }
   }
 
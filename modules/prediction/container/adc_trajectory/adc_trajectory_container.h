@@ -103,6 +103,13 @@ class ADCTrajectoryContainer : public Container {
   const std::vector<std::string>& GetADCLaneIDSequence() const;
 
  private:
+  /**
+   * @brief Rebuild the junction candidates along the route corridor. Only
+   * called when the planned lane sequence changes, so the per-message
+   * junction search degenerates to local polygon tests.
+   */
+  void BuildCorridorJunctionCache();
+
   void SetJunctionPolygon();
 
   void SetPNCJunctionPolygon();
@@ -138,6 +145,20 @@ class ADCTrajectoryContainer : public Container {
   std::unordered_set<std::string> adc_lane_ids_;
   std::vector<std::string> adc_lane_seq_;
   std::mutex adc_trajectory_mutex_;
+
+  // Junctions overlapping the route corridor lanes, precomputed once per
+  // lane sequence (i.e. routing / reference line) change.
+  struct CorridorJunction {
+    std::shared_ptr<const hdmap::JunctionInfo> junction;
+    common::math::Polygon2d polygon;
+  };
+  struct CorridorPNCJunction {
+    std::shared_ptr<const hdmap::PNCJunctionInfo> pnc_junction;
+    common::math::Polygon2d polygon;
+  };
+  std::vector<CorridorJunction> corridor_junctions_;
+  std::vector<CorridorPNCJunction> corridor_pnc_junctions_;
+  std::vector<std::string> corridor_lane_seq_;
 };
 
 }  // namespace prediction
@@ -21,6 +21,7 @@
 #include <limits>
 #include <list>
 #include <unordered_set>
+#include <utility>
 
 #include "modules/prediction/common/junction_analyzer.h"
 #include "modules/prediction/common/prediction_gflags.h"
@@ -148,7 +149,7 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
   }
 
   // Set ID, Type, and Status of the feature.
-  Feature feature;
+  Feature feature = TakeHistoryBuffer();
   if (!SetId(perception_obstacle, &feature, prediction_obstacle_id)) {
     return false;
   }
@@ -176,10 +177,19 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
     }
   }
 
-  // Set obstacle lane features
+  // Set obstacle lane features. An obstacle flagged as unchanged has
+  // not moved since its last publication, so its lane association is
+  // still valid and the HDMap queries can be skipped.
   if (type_ != PerceptionObstacle::PEDESTRIAN) {
-    SetCurrentLanes(&feature);
-    SetNearbyLanes(&feature);
+    if (perception_obstacle.has_change_flags() &&
+        perception_obstacle.change_flags() ==
+            PerceptionObstacle::CHANGE_NONE &&
+        history_size() > 0 && latest_feature().has_lane()) {
+      feature.mutable_lane()->CopyFrom(latest_feature().lane());
+    } else {
+      SetCurrentLanes(&feature);
+      SetNearbyLanes(&feature);
+    }
   }
 
   if (FLAGS_adjust_vehicle_heading_by_lane &&
@@ -187,8 +197,9 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
     AdjustHeadingByLane(&feature);
   }
 
-  // Insert obstacle feature to history
-  InsertFeatureToHistory(feature);
+  // Insert obstacle feature to history, the local feature is not used
+  // afterwards so its heavy repeated fields can be moved.
+  InsertFeatureToHistory(std::move(feature));
 
   // Set obstacle motion status
   if (FLAGS_use_navigation_mode) {
@@ -1529,6 +1540,21 @@ void Obstacle::InsertFeatureToHistory(const Feature& feature) {
   ADEBUG << "Obstacle [" << id_ << "] inserted a frame into the history.";
 }
 
+void Obstacle::InsertFeatureToHistory(Feature&& feature) {
+  feature_history_.emplace_front(std::move(feature));
+  ADEBUG << "Obstacle [" << id_ << "] inserted a frame into the history.";
+}
+
+Feature Obstacle::TakeHistoryBuffer() {
+  if (recycled_features_.empty()) {
+    return Feature();
+  }
+  Feature feature = std::move(recycled_features_.back());
+  recycled_features_.pop_back();
+  feature.Clear();
+  return feature;
+}
+
 std::unique_ptr<Obstacle> Obstacle::Create(
     const PerceptionObstacle& perception_obstacle, const double timestamp,
     const int prediction_id) {
@@ -1558,6 +1584,7 @@ void Obstacle::DiscardOutdatedHistory() {
   const double latest_ts = feature_history_.front().timestamp();
   while (latest_ts - feature_history_.back().timestamp() >=
          FLAGS_max_history_time) {
+    recycled_features_.push_back(std::move(feature_history_.back()));
     feature_history_.pop_back();
   }
   auto num_of_discarded_frames = num_of_frames - feature_history_.size();
@@ -307,6 +307,14 @@ class Obstacle {
 
   void InsertFeatureToHistory(const Feature& feature);
 
+  void InsertFeatureToHistory(Feature&& feature);
+
+  /**
+   * @brief Get a cleared feature buffer, reusing one discarded from
+   *        the history when available
+   */
+  Feature TakeHistoryBuffer();
+
   void SetJunctionFeatureWithEnterLane(const std::string& enter_lane_id,
                                        Feature* const feature_ptr);
 
@@ -329,6 +337,11 @@ class Obstacle {
 
   std::deque<Feature> feature_history_;
 
+  // features discarded from the history, kept for reuse; protobuf
+  // Clear keeps the capacity of repeated fields, so recycled features
+  // do not reallocate their lane graph and polygon storage
+  std::vector<Feature> recycled_features_;
+
   common::math::KalmanFilter<double, 6, 2, 0> kf_motion_tracker_;
 
   common::math::KalmanFilter<double, 2, 2, 4> kf_pedestrian_tracker_;
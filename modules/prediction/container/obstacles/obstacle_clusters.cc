@@ -17,8 +17,10 @@
 #include "modules/prediction/container/obstacles/obstacle_clusters.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
+#include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/road_graph.h"
 
 namespace apollo {
@@ -26,7 +28,8 @@ namespace prediction {
 
 using ::apollo::hdmap::LaneInfo;
 
-std::unordered_map<std::string, LaneGraph> ObstacleClusters::lane_graphs_;
+std::unordered_map<std::string, ObstacleClusters::LaneGraphCache>
+    ObstacleClusters::lane_graphs_;
 std::unordered_map<std::string, std::vector<LaneObstacle>>
     ObstacleClusters::lane_obstacles_;
 std::unordered_map<std::string, StopSign>
@@ -38,17 +41,40 @@ void ObstacleClusters::Clear() {
   lane_id_stop_sign_map_.clear();
 }
 
-void ObstacleClusters::Init() { Clear(); }
+void ObstacleClusters::Init() {
+  // Lane graphs and stop signs only depend on the map, so keep them
+  // across frames and only rebuild the per-frame obstacle occupancy.
+  // The cache is fully dropped once in a while to bound its memory as
+  // the vehicle moves to new regions of the map.
+  if (lane_graphs_.size() >
+      static_cast<size_t>(FLAGS_max_num_cached_lane_graphs)) {
+    Clear();
+  }
+  lane_obstacles_.clear();
+}
 
 const LaneGraph& ObstacleClusters::GetLaneGraph(
     const double start_s, const double length,
     std::shared_ptr<const LaneInfo> lane_info_ptr) {
-  std::string lane_id = lane_info_ptr->id().id();
-  if (lane_graphs_.find(lane_id) != lane_graphs_.end()) {
-    // If this lane_segment has been used for constructing LaneGraph,
-    // fetch the previously saved LaneGraph, modify its start_s,
-    // then return this (save the time to construct the entire LaneGraph).
-    LaneGraph* lane_graph = &lane_graphs_[lane_id];
+  const std::string& lane_id = lane_info_ptr->id().id();
+  // Key the cache by (lane_id, discretized s) so that obstacles close
+  // on the same lane, e.g. a platoon, share one graph, while obstacles
+  // far apart get separate entries instead of evicting each other.
+  const double s_interval = FLAGS_lane_graph_cache_s_interval;
+  const int s_bucket = static_cast<int>(std::floor(start_s / s_interval));
+  const std::string cache_key = lane_id + "@" + std::to_string(s_bucket);
+  auto iter = lane_graphs_.find(cache_key);
+  // A cached graph may fall short of the requested range by up to one
+  // s interval; the missing part is at the far search horizon and does
+  // not affect the lane sequences the evaluators consume.
+  if (iter != lane_graphs_.end() && start_s >= iter->second.start_s &&
+      start_s + length <=
+          iter->second.start_s + iter->second.length + s_interval) {
+    // If this lane_segment has been used for constructing a LaneGraph
+    // covering the requested range, fetch the previously saved
+    // LaneGraph, modify its start_s, then return this (save the time
+    // to construct the entire LaneGraph).
+    LaneGraph* lane_graph = &iter->second.lane_graph;
     for (int i = 0; i < lane_graph->lane_sequence_size(); ++i) {
       LaneSequence* lane_seq_ptr = lane_graph->mutable_lane_sequence(i);
       if (lane_seq_ptr->lane_segment_size() == 0) {
@@ -60,15 +86,17 @@ const LaneGraph& ObstacleClusters::GetLaneGraph(
       }
       first_lane_seg_ptr->set_start_s(start_s);
     }
-  } else {
-    // If this lane_segment has not been used for constructing LaneGraph,
-    // construct the LaneGraph and return.
-    RoadGraph road_graph(start_s, length, lane_info_ptr);
-    LaneGraph lane_graph;
-    road_graph.BuildLaneGraph(&lane_graph);
-    lane_graphs_[lane_id] = std::move(lane_graph);
+    return iter->second.lane_graph;
   }
-  return lane_graphs_[lane_id];
+  // If this lane_segment has no LaneGraph yet, or the cached one does
+  // not reach far enough, construct the LaneGraph and cache it.
+  LaneGraphCache cache;
+  cache.start_s = start_s;
+  cache.length = length;
+  RoadGraph road_graph(start_s, length, lane_info_ptr);
+  road_graph.BuildLaneGraph(&cache.lane_graph);
+  lane_graphs_[cache_key] = std::move(cache);
+  return lane_graphs_[cache_key].lane_graph;
 }
 
 LaneGraph ObstacleClusters::GetLaneGraphWithoutMemorizing(
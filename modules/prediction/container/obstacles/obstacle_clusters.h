@@ -32,7 +32,9 @@ namespace prediction {
 class ObstacleClusters {
  public:
   /**
-   * @brief Remove all lane graphs
+   * @brief Prepare for a new frame; lane graphs are map-only and
+   *        are carried over across frames, only the per-frame
+   *        obstacle occupancy is rebuilt
    */
   static void Init();
 
@@ -122,12 +124,18 @@ class ObstacleClusters {
       GetLaneObstacles() { return lane_obstacles_; }
 
  private:
+  struct LaneGraphCache {
+    double start_s = 0.0;
+    double length = 0.0;
+    LaneGraph lane_graph;
+  };
+
   ObstacleClusters() = delete;
 
   static void Clear();
 
  private:
-  static std::unordered_map<std::string, LaneGraph> lane_graphs_;
+  static std::unordered_map<std::string, LaneGraphCache> lane_graphs_;
   static std::unordered_map<std::string, std::vector<LaneObstacle>>
       lane_obstacles_;
   static std::unordered_map<std::string, StopSign> lane_id_stop_sign_map_;
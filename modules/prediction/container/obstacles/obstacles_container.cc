@@ -44,9 +44,8 @@ void ObstaclesContainer::Insert(const ::google::protobuf::Message& message) {
   curr_frame_non_predictable_obstacle_ids_.clear();
   curr_frame_id_perception_obstacle_map_.clear();
 
-  PerceptionObstacles perception_obstacles;
-  perception_obstacles.CopyFrom(
-      dynamic_cast<const PerceptionObstacles&>(message));
+  const PerceptionObstacles& perception_obstacles =
+      dynamic_cast<const PerceptionObstacles&>(message);
 
   // Get the new timestamp and update it in the class
   // - If it's more than 10sec later than the most recent one, clear the
@@ -47,7 +47,7 @@ CruiseMLPEvaluator::CruiseMLPEvaluator() {
              FLAGS_evaluator_cruise_vehicle_cutin_model_file);
 }
 
-void CruiseMLPEvaluator::Clear() {}
+void CruiseMLPEvaluator::Clear() { obstacle_feature_values_map_.clear(); }
 
 void CruiseMLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
   // Sanity checks.
@@ -128,7 +128,13 @@ void CruiseMLPEvaluator::ExtractFeatureValues(
 
   // Extract obstacle related features.
   std::vector<double> obstacle_feature_values;
-  SetObstacleFeatureValues(obstacle_ptr, &obstacle_feature_values);
+  auto it = obstacle_feature_values_map_.find(id);
+  if (it == obstacle_feature_values_map_.end()) {
+    SetObstacleFeatureValues(obstacle_ptr, &obstacle_feature_values);
+    obstacle_feature_values_map_[id] = obstacle_feature_values;
+  } else {
+    obstacle_feature_values = it->second;
+  }
   if (obstacle_feature_values.size() != OBSTACLE_FEATURE_SIZE) {
     ADEBUG << "Obstacle [" << id << "] has fewer than "
            << "expected obstacle feature_values "
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/prediction/evaluator/evaluator.h"
@@ -116,6 +117,11 @@ class CruiseMLPEvaluator : public Evaluator {
   static const size_t SINGLE_LANE_FEATURE_SIZE = 4;
   static const size_t LANE_POINTS_SIZE = 20;
 
+  // obstacle features only depend on the history, not on the lane
+  // sequence, so they are computed once per obstacle and shared by all
+  // of its lane sequences
+  std::unordered_map<int, std::vector<double>> obstacle_feature_values_map_;
+
   std::shared_ptr<network::CruiseModel> go_model_ptr_;
   std::shared_ptr<network::CruiseModel> cutin_model_ptr_;
 };
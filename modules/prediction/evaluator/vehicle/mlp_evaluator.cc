@@ -17,6 +17,7 @@
 #include "modules/prediction/evaluator/vehicle/mlp_evaluator.h"
 
 #include <limits>
+#include <utility>
 
 #include "cyber/common/file.h"
 #include "modules/prediction/common/feature_output.h"
@@ -75,20 +76,30 @@ void MLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
     return;
   }
 
+  std::vector<std::vector<double>> feature_values_batch(
+      lane_graph_ptr->lane_sequence_size());
   for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
     LaneSequence* lane_sequence_ptr = lane_graph_ptr->mutable_lane_sequence(i);
     CHECK(lane_sequence_ptr != nullptr);
-    std::vector<double> feature_values;
-    ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr, &feature_values);
+    ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr,
+                         &feature_values_batch[i]);
     // Insert features to DataForLearning
     if (FLAGS_prediction_offline_mode == 2 && !obstacle_ptr->IsNearJunction()) {
-      FeatureOutput::InsertDataForLearning(*latest_feature_ptr, feature_values,
-                                           "mlp");
+      FeatureOutput::InsertDataForLearning(*latest_feature_ptr,
+                                           feature_values_batch[i], "mlp");
       ADEBUG << "Save extracted features for learning locally.";
       return;  // Skip Compute probability for offline mode
     }
-    double probability = ComputeProbability(feature_values);
+  }
+
+  // Run all lane sequences of this obstacle through the model in one
+  // forward pass instead of one small matrix-vector product each.
+  std::vector<double> probabilities;
+  ComputeProbabilities(feature_values_batch, &probabilities);
 
+  for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
+    LaneSequence* lane_sequence_ptr = lane_graph_ptr->mutable_lane_sequence(i);
+    double probability = probabilities[i];
     double centripetal_acc_probability =
         ValidationChecker::ProbabilityByCentripetalAcceleration(
             *lane_sequence_ptr, speed);
@@ -335,68 +346,97 @@ void MLPEvaluator::LoadModel(const std::string& model_file) {
   CHECK(cyber::common::GetProtoFromFile(model_file, model_ptr_.get()))
       << "Unable to load model file: " << model_file << ".";
 
+  // Convert the layer parameters to Eigen once, so that evaluation runs
+  // as dense matrix products instead of per-neuron accessor loops.
+  layer_weights_.clear();
+  layer_biases_.clear();
+  layer_activation_funcs_.clear();
+  for (int i = 0; i < model_ptr_->num_layer(); ++i) {
+    const Layer& layer = model_ptr_->layer(i);
+    Eigen::MatrixXd weights(layer.layer_input_dim(), layer.layer_output_dim());
+    for (int row = 0; row < layer.layer_input_dim(); ++row) {
+      for (int col = 0; col < layer.layer_output_dim(); ++col) {
+        weights(row, col) = layer.layer_input_weight().rows(row).columns(col);
+      }
+    }
+    Eigen::VectorXd bias(layer.layer_output_dim());
+    for (int col = 0; col < layer.layer_output_dim(); ++col) {
+      bias(col) = layer.layer_bias().columns(col);
+    }
+    layer_weights_.push_back(std::move(weights));
+    layer_biases_.push_back(std::move(bias));
+    layer_activation_funcs_.push_back(layer.layer_activation_func());
+  }
+
   AINFO << "Succeeded in loading the model file: " << model_file << ".";
 }
 
-double MLPEvaluator::ComputeProbability(
-    const std::vector<double>& feature_values) {
+void MLPEvaluator::ComputeProbabilities(
+    const std::vector<std::vector<double>>& feature_values_batch,
+    std::vector<double>* probabilities) {
   CHECK_NOTNULL(model_ptr_.get());
-  double probability = 0.0;
-
-  if (model_ptr_->dim_input() != static_cast<int>(feature_values.size())) {
-    ADEBUG << "Model feature size not consistent with model proto definition. "
-           << "model input dim = " << model_ptr_->dim_input()
-           << "; feature value size = " << feature_values.size();
-    return probability;
+  probabilities->assign(feature_values_batch.size(), 0.0);
+
+  int dim_input = model_ptr_->dim_input();
+  std::vector<size_t> valid_indices;
+  for (size_t i = 0; i < feature_values_batch.size(); ++i) {
+    if (static_cast<int>(feature_values_batch[i].size()) == dim_input) {
+      valid_indices.push_back(i);
+    } else {
+      ADEBUG << "Model feature size not consistent with model proto "
+             << "definition. model input dim = " << dim_input
+             << "; feature value size = " << feature_values_batch[i].size();
+    }
   }
-  std::vector<double> layer_input;
-  layer_input.reserve(model_ptr_->dim_input());
-  std::vector<double> layer_output;
-
-  // normalization
-  for (int i = 0; i < model_ptr_->dim_input(); ++i) {
-    double mean = model_ptr_->samples_mean().columns(i);
-    double std = model_ptr_->samples_std().columns(i);
-    layer_input.push_back(
-        apollo::prediction::math_util::Normalize(feature_values[i], mean, std));
+  if (valid_indices.empty()) {
+    return;
   }
 
+  // normalization, one row per lane sequence
+  Eigen::MatrixXd layer_input(valid_indices.size(), dim_input);
+  for (size_t r = 0; r < valid_indices.size(); ++r) {
+    const std::vector<double>& feature_values =
+        feature_values_batch[valid_indices[r]];
+    for (int i = 0; i < dim_input; ++i) {
+      double mean = model_ptr_->samples_mean().columns(i);
+      double std = model_ptr_->samples_std().columns(i);
+      layer_input(r, i) = apollo::prediction::math_util::Normalize(
+          feature_values[i], mean, std);
+    }
+  }
+
+  Eigen::MatrixXd layer_output;
   for (int i = 0; i < model_ptr_->num_layer(); ++i) {
     if (i > 0) {
-      layer_input.swap(layer_output);
-      layer_output.clear();
+      layer_input = std::move(layer_output);
     }
-    const Layer& layer = model_ptr_->layer(i);
-    for (int col = 0; col < layer.layer_output_dim(); ++col) {
-      double neuron_output = layer.layer_bias().columns(col);
-      for (int row = 0; row < layer.layer_input_dim(); ++row) {
-        double weight = layer.layer_input_weight().rows(row).columns(col);
-        neuron_output += (layer_input[row] * weight);
-      }
-      if (layer.layer_activation_func() == Layer::RELU) {
-        neuron_output = apollo::prediction::math_util::Relu(neuron_output);
-      } else if (layer.layer_activation_func() == Layer::SIGMOID) {
-        neuron_output = apollo::prediction::math_util::Sigmoid(neuron_output);
-      } else if (layer.layer_activation_func() == Layer::TANH) {
-        neuron_output = std::tanh(neuron_output);
-      } else {
-        AERROR << "Undefined activation function ["
-               << layer.layer_activation_func()
-               << "]. A default sigmoid will be used instead.";
-        neuron_output = apollo::prediction::math_util::Sigmoid(neuron_output);
-      }
-      layer_output.push_back(neuron_output);
+    layer_output = (layer_input * layer_weights_[i]).rowwise() +
+                   layer_biases_[i].transpose();
+    if (layer_activation_funcs_[i] == Layer::RELU) {
+      layer_output = layer_output.unaryExpr(
+          [](double x) { return apollo::prediction::math_util::Relu(x); });
+    } else if (layer_activation_funcs_[i] == Layer::SIGMOID) {
+      layer_output = layer_output.unaryExpr(
+          [](double x) { return apollo::prediction::math_util::Sigmoid(x); });
+    } else if (layer_activation_funcs_[i] == Layer::TANH) {
+      layer_output =
+          layer_output.unaryExpr([](double x) { return std::tanh(x); });
+    } else {
+      AERROR << "Undefined activation function [" << layer_activation_funcs_[i]
+             << "]. A default sigmoid will be used instead.";
+      layer_output = layer_output.unaryExpr(
+          [](double x) { return apollo::prediction::math_util::Sigmoid(x); });
     }
   }
 
-  if (layer_output.size() != 1) {
+  if (layer_output.cols() != 1) {
     AERROR << "Model output layer has incorrect # outputs: "
-           << layer_output.size();
-  } else {
-    probability = layer_output[0];
+           << layer_output.cols();
+    return;
+  }
+  for (size_t r = 0; r < valid_indices.size(); ++r) {
+    (*probabilities)[valid_indices[r]] = layer_output(r, 0);
   }
-
-  return probability;
 }
 
 }  // namespace prediction
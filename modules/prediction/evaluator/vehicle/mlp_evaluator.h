@@ -21,6 +21,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "Eigen/Dense"
+
 #include "modules/prediction/evaluator/evaluator.h"
 #include "modules/prediction/proto/fnn_vehicle_model.pb.h"
 
@@ -90,9 +92,14 @@ class MLPEvaluator : public Evaluator {
   void LoadModel(const std::string& model_file);
 
   /**
-   * @brief Compute probability
+   * @brief Compute probabilities for a batch of lane sequences with
+   *        a single forward pass through the model
+   * @param Feature values of every lane sequence, one vector each
+   * @param Output probabilities, one per lane sequence
    */
-  double ComputeProbability(const std::vector<double>& feature_values);
+  void ComputeProbabilities(
+      const std::vector<std::vector<double>>& feature_values_batch,
+      std::vector<double>* probabilities);
 
   /**
    * @brief Save offline feature values in proto
@@ -108,6 +115,13 @@ class MLPEvaluator : public Evaluator {
   static const size_t LANE_FEATURE_SIZE = 40;
 
   std::unique_ptr<FnnVehicleModel> model_ptr_;
+
+  // Model parameters converted to Eigen at load time, so that all lane
+  // sequences of an obstacle run through a few dense matrix products
+  // instead of per-neuron protobuf accessor loops.
+  std::vector<Eigen::MatrixXd> layer_weights_;
+  std::vector<Eigen::VectorXd> layer_biases_;
+  std::vector<Layer::ActivationFunc> layer_activation_funcs_;
 };
 
 }  // namespace prediction
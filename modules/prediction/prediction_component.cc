@@ -21,6 +21,7 @@
 
 #include "cyber/common/file.h"
 #include "cyber/record/record_reader.h"
+#include "cyber/task/task.h"
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/util/message_util.h"
 
@@ -45,7 +46,11 @@ using apollo::perception::PerceptionObstacle;
 using apollo::perception::PerceptionObstacles;
 using apollo::planning::ADCTrajectory;
 
-PredictionComponent::~PredictionComponent() {}
+PredictionComponent::~PredictionComponent() {
+  if (prediction_future_.valid()) {
+    prediction_future_.wait();
+  }
+}
 
 std::string PredictionComponent::Name() const {
   return FLAGS_prediction_module_name;
@@ -120,6 +125,13 @@ bool PredictionComponent::Proc(
   ADEBUG << "Time for updating PoseContainer: " << diff.count() * 1000
          << " msec.";
 
+  // The predictor stage of the last frame reads the containers and lane
+  // graph clusters that the steps below mutate; wait for it to finish
+  // before updating them.
+  if (prediction_future_.valid()) {
+    prediction_future_.get();
+  }
+
   // Read planning info. of last frame and call OnPlanning to update
   // the ADCTrajectoryContainer
   planning_reader_->Observe();
@@ -136,6 +148,22 @@ bool PredictionComponent::Proc(
   // Get all perception_obstacles of this frame and call OnPerception to
   // process them all.
   auto perception_msg = *perception_obstacles;
+  if (FLAGS_enable_pipelined_prediction) {
+    // Bring containers, lane graphs and model evaluations up to date for
+    // this frame, then generate and publish the trajectories on a cyber
+    // task so that the predictor stage overlaps the idle time before the
+    // next perception frame.
+    MessageProcess::ContainerProcess(perception_msg);
+    const double frame_start_time = frame_start_time_;
+    prediction_future_ =
+        cyber::Async([this, perception_msg, frame_start_time] {
+          PredictionObstacles prediction_obstacles;
+          MessageProcess::PredictObstacles(&prediction_obstacles);
+          PublishPrediction(perception_msg, frame_start_time,
+                            &prediction_obstacles);
+        });
+    return true;
+  }
   PredictionObstacles prediction_obstacles;
   MessageProcess::OnPerception(perception_msg, &prediction_obstacles);
   auto end_time4 = std::chrono::system_clock::now();
@@ -143,21 +171,28 @@ bool PredictionComponent::Proc(
   ADEBUG << "Time for updating PerceptionContainer: " << diff.count() * 1000
          << " msec.";
 
+  PublishPrediction(perception_msg, frame_start_time_, &prediction_obstacles);
+  return true;
+}
+
+void PredictionComponent::PublishPrediction(
+    const PerceptionObstacles& perception_msg, double frame_start_time,
+    PredictionObstacles* const prediction_obstacles) {
   // Postprocess prediction obstacles message
-  prediction_obstacles.set_start_timestamp(frame_start_time_);
-  prediction_obstacles.set_end_timestamp(Clock::NowInSeconds());
-  prediction_obstacles.mutable_header()->set_lidar_timestamp(
+  prediction_obstacles->set_start_timestamp(frame_start_time);
+  prediction_obstacles->set_end_timestamp(Clock::NowInSeconds());
+  prediction_obstacles->mutable_header()->set_lidar_timestamp(
       perception_msg.header().lidar_timestamp());
-  prediction_obstacles.mutable_header()->set_camera_timestamp(
+  prediction_obstacles->mutable_header()->set_camera_timestamp(
       perception_msg.header().camera_timestamp());
-  prediction_obstacles.mutable_header()->set_radar_timestamp(
+  prediction_obstacles->mutable_header()->set_radar_timestamp(
       perception_msg.header().radar_timestamp());
 
-  prediction_obstacles.set_perception_error_code(perception_msg.error_code());
+  prediction_obstacles->set_perception_error_code(perception_msg.error_code());
 
   if (FLAGS_prediction_test_mode) {
     for (auto const& prediction_obstacle :
-         prediction_obstacles.prediction_obstacle()) {
+         prediction_obstacles->prediction_obstacle()) {
       for (auto const& trajectory : prediction_obstacle.trajectory()) {
         for (auto const& trajectory_point : trajectory.trajectory_point()) {
           if (!ValidationChecker::ValidTrajectoryPoint(trajectory_point)) {
@@ -171,10 +206,9 @@ bool PredictionComponent::Proc(
   }
 
   // Publish output
-  common::util::FillHeader(node_->Name(), &prediction_obstacles);
+  common::util::FillHeader(node_->Name(), prediction_obstacles);
   prediction_writer_->Write(
-      std::make_shared<PredictionObstacles>(prediction_obstacles));
-  return true;
+      std::make_shared<PredictionObstacles>(*prediction_obstacles));
 }
 
 }  // namespace prediction
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <string>
 
@@ -66,6 +67,17 @@ class PredictionComponent
   void OfflineProcessFeatureProtoFile(const std::string& features_proto_file);
 
  private:
+  /**
+   * @brief Postprocess and publish the prediction obstacles message.
+   * @param Perception message the prediction was made from.
+   * @param Start time of the frame being published.
+   * @param Prediction obstacles message to publish.
+   */
+  void PublishPrediction(
+      const perception::PerceptionObstacles& perception_msg,
+      double frame_start_time,
+      PredictionObstacles* const prediction_obstacles);
+
   double component_start_time_ = 0.0;
 
   double frame_start_time_ = 0.0;
@@ -76,6 +88,8 @@ class PredictionComponent
       localization_reader_;
 
   std::shared_ptr<cyber::Writer<PredictionObstacles>> prediction_writer_;
+
+  std::future<void> prediction_future_;
 };
 
 CYBER_REGISTER_COMPONENT(PredictionComponent)
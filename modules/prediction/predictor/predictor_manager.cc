@@ -16,6 +16,10 @@
 
 #include "modules/prediction/predictor/predictor_manager.h"
 
+#include <future>
+#include <vector>
+
+#include "cyber/task/task.h"
 #include "modules/prediction/common/feature_output.h"
 #include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/prediction_system_gflags.h"
@@ -138,6 +142,13 @@ void PredictorManager::Run() {
           AdapterConfig::PLANNING_TRAJECTORY);
 
   CHECK_NOTNULL(obstacles_container);
+
+  if (FLAGS_enable_async_obstacle_prediction &&
+      FLAGS_prediction_offline_mode == 0) {
+    RunParallel(obstacles_container, adc_trajectory_container);
+    return;
+  }
+
   for (const int id : obstacles_container->curr_frame_obstacle_ids()) {
     if (id < 0) {
       ADEBUG << "The obstacle has invalid id [" << id << "].";
@@ -168,60 +179,118 @@ void PredictorManager::Run() {
   }
 }
 
+void PredictorManager::RunParallel(
+    ObstaclesContainer* obstacles_container,
+    ADCTrajectoryContainer* adc_trajectory_container) {
+  const std::vector<int> obstacle_ids =
+      obstacles_container->curr_frame_obstacle_ids();
+  std::vector<PredictionObstacle> prediction_obstacle_slots(
+      obstacle_ids.size());
+  std::vector<std::future<void>> futures;
+  futures.reserve(obstacle_ids.size());
+  for (size_t i = 0; i < obstacle_ids.size(); ++i) {
+    const int id = obstacle_ids[i];
+    if (id < 0) {
+      ADEBUG << "The obstacle has invalid id [" << id << "].";
+      continue;
+    }
+    PredictionObstacle* prediction_obstacle = &prediction_obstacle_slots[i];
+    Obstacle* obstacle = obstacles_container->GetObstacle(id);
+    // if obstacle == nullptr, that means obstacle is not predictable
+    // Checkout the logic of non-predictable in obstacle.cc
+    if (obstacle == nullptr) {
+      prediction_obstacle->set_timestamp(
+          obstacles_container->GetPerceptionObstacle(id).timestamp());
+      prediction_obstacle->set_is_static(true);
+      continue;
+    }
+    // Every task runs its own predictor instance, so the trajectory
+    // scratch state is never shared between concurrent obstacles.
+    futures.emplace_back(cyber::Async(
+        [this, obstacle, prediction_obstacle, adc_trajectory_container]() {
+          ObstacleConf::PredictorType predictor_type =
+              SelectPredictorType(obstacle, prediction_obstacle);
+          std::unique_ptr<Predictor> predictor =
+              CreatePredictor(predictor_type);
+          RunPredictor(predictor.get(), obstacle, prediction_obstacle,
+                       adc_trajectory_container);
+        }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  // Assemble the output message in the original obstacle order.
+  for (size_t i = 0; i < obstacle_ids.size(); ++i) {
+    const int id = obstacle_ids[i];
+    if (id < 0) {
+      continue;
+    }
+    PredictionObstacle* prediction_obstacle = &prediction_obstacle_slots[i];
+    prediction_obstacle->set_predicted_period(
+        FLAGS_prediction_trajectory_time_length);
+    prediction_obstacle->mutable_perception_obstacle()->CopyFrom(
+        obstacles_container->GetPerceptionObstacle(id));
+    prediction_obstacles_.add_prediction_obstacle()->CopyFrom(
+        *prediction_obstacle);
+  }
+}
+
 void PredictorManager::PredictObstacle(
     Obstacle* obstacle, PredictionObstacle* const prediction_obstacle,
     ADCTrajectoryContainer* adc_trajectory_container) {
   CHECK_NOTNULL(obstacle);
-  Predictor* predictor = nullptr;
+  ObstacleConf::PredictorType predictor_type =
+      SelectPredictorType(obstacle, prediction_obstacle);
+  RunPredictor(GetPredictor(predictor_type), obstacle, prediction_obstacle,
+               adc_trajectory_container);
+}
+
+ObstacleConf::PredictorType PredictorManager::SelectPredictorType(
+    Obstacle* obstacle, PredictionObstacle* const prediction_obstacle) {
   prediction_obstacle->set_timestamp(obstacle->timestamp());
   if (obstacle->ToIgnore()) {
     ADEBUG << "Ignore obstacle [" << obstacle->id() << "]";
-    predictor = GetPredictor(ObstacleConf::EMPTY_PREDICTOR);
     prediction_obstacle->mutable_priority()->set_priority(
         ObstaclePriority::IGNORE);
-  } else if (obstacle->IsStill()) {
+    return ObstacleConf::EMPTY_PREDICTOR;
+  }
+  if (obstacle->IsStill()) {
     ADEBUG << "Still obstacle [" << obstacle->id() << "]";
-    predictor = GetPredictor(ObstacleConf::EMPTY_PREDICTOR);
-  } else {
-    switch (obstacle->type()) {
-      case PerceptionObstacle::VEHICLE: {
-        if (obstacle->HasJunctionFeatureWithExits() &&
-            !obstacle->IsCloseToJunctionExit()) {
-          predictor = GetPredictor(vehicle_in_junction_predictor_);
-          CHECK_NOTNULL(predictor);
-        } else if (obstacle->IsOnLane()) {
-          predictor = GetPredictor(vehicle_on_lane_predictor_);
-          CHECK_NOTNULL(predictor);
-        } else {
-          predictor = GetPredictor(vehicle_off_lane_predictor_);
-          CHECK_NOTNULL(predictor);
-        }
-        break;
-      }
-      case PerceptionObstacle::PEDESTRIAN: {
-        predictor = GetPredictor(pedestrian_predictor_);
-        break;
+    return ObstacleConf::EMPTY_PREDICTOR;
+  }
+  switch (obstacle->type()) {
+    case PerceptionObstacle::VEHICLE: {
+      if (obstacle->HasJunctionFeatureWithExits() &&
+          !obstacle->IsCloseToJunctionExit()) {
+        return vehicle_in_junction_predictor_;
+      } else if (obstacle->IsOnLane()) {
+        return vehicle_on_lane_predictor_;
       }
-      case PerceptionObstacle::BICYCLE: {
-        if (obstacle->IsOnLane()) {
-          predictor = GetPredictor(cyclist_on_lane_predictor_);
-          // TODO(kechxu) add a specific predictor in junction
-        } else {
-          predictor = GetPredictor(cyclist_off_lane_predictor_);
-        }
-        break;
+      return vehicle_off_lane_predictor_;
+    }
+    case PerceptionObstacle::PEDESTRIAN: {
+      return pedestrian_predictor_;
+    }
+    case PerceptionObstacle::BICYCLE: {
+      if (obstacle->IsOnLane()) {
+        // TODO(kechxu) add a specific predictor in junction
+        return cyclist_on_lane_predictor_;
       }
-      default: {
-        if (obstacle->IsOnLane()) {
-          predictor = GetPredictor(default_on_lane_predictor_);
-        } else {
-          predictor = GetPredictor(default_off_lane_predictor_);
-        }
-        break;
+      return cyclist_off_lane_predictor_;
+    }
+    default: {
+      if (obstacle->IsOnLane()) {
+        return default_on_lane_predictor_;
       }
+      return default_off_lane_predictor_;
     }
   }
+}
 
+void PredictorManager::RunPredictor(
+    Predictor* predictor, Obstacle* obstacle,
+    PredictionObstacle* const prediction_obstacle,
+    ADCTrajectoryContainer* adc_trajectory_container) {
   if (predictor != nullptr) {
     predictor->Predict(obstacle);
     if (FLAGS_enable_trim_prediction_trajectory &&
@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 
+#include "modules/prediction/container/obstacles/obstacles_container.h"
 #include "modules/prediction/predictor/predictor.h"
 #include "modules/prediction/proto/prediction_conf.pb.h"
 
@@ -75,6 +76,34 @@ class PredictorManager {
   const PredictionObstacles& prediction_obstacles();
 
  private:
+  /**
+   * @brief Predict all obstacles of the frame as concurrent cyber tasks
+   * @param A pointer to obstacles_container
+   * @param A pointer to adc_trajectory_container
+   */
+  void RunParallel(ObstaclesContainer* obstacles_container,
+                   ADCTrajectoryContainer* adc_trajectory_container);
+
+  /**
+   * @brief Select the predictor type for an obstacle
+   * @param A pointer to the specific obstacle
+   * @param A pointer to prediction_obstacle
+   * @return The predictor type to run for this obstacle
+   */
+  ObstacleConf::PredictorType SelectPredictorType(
+      Obstacle* obstacle, PredictionObstacle* const prediction_obstacle);
+
+  /**
+   * @brief Run one predictor and fill the prediction obstacle
+   * @param A pointer to the predictor, may be nullptr
+   * @param A pointer to the specific obstacle
+   * @param A pointer to prediction_obstacle
+   * @param A pointer to adc_trajectory_container
+   */
+  void RunPredictor(Predictor* predictor, Obstacle* obstacle,
+                    PredictionObstacle* const prediction_obstacle,
+                    ADCTrajectoryContainer* adc_trajectory_container);
+
   /**
    * @brief Register a predictor by type
    * @param Predictor type
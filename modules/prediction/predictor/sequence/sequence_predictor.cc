@@ -18,6 +18,7 @@
 
 #include <limits>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include "modules/prediction/common/prediction_gflags.h"
@@ -65,6 +66,21 @@ void SequencePredictor::FilterLaneSequences(
   std::pair<int, double> change(-1, -1.0);
   std::pair<int, double> all(-1, -1.0);
 
+  auto adc_container =
+      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
+          AdapterConfig::PLANNING_TRAJECTORY);
+  CHECK_NOTNULL(adc_container);
+
+  // The change type and the ADC projection distance only depend on the
+  // first lane segment, so sequences sharing a prefix share the results
+  // instead of re-querying the map for every sequence.
+  std::unordered_map<std::string, LaneChangeType> prefix_change_type;
+  std::unordered_map<std::string, double> prefix_distance;
+  // The own-lane containment test only depends on the obstacle itself;
+  // evaluate it at most once and share it across all sequences.
+  bool own_lane_evaluated = false;
+  bool obs_within_its_own_lane = false;
+
   /**
    * Filter out those obstacles that are close to the ADC
    * so that we will ignore them and drive normally unless
@@ -72,7 +88,15 @@ void SequencePredictor::FilterLaneSequences(
    */
   for (int i = 0; i < num_lane_sequence; ++i) {
     const LaneSequence& sequence = lane_graph.lane_sequence(i);
-    lane_change_type[i] = GetLaneChangeType(lane_id, sequence);
+    const std::string& prefix_lane_id = sequence.lane_segment(0).lane_id();
+    auto type_iter = prefix_change_type.find(prefix_lane_id);
+    if (type_iter == prefix_change_type.end()) {
+      type_iter = prefix_change_type
+                      .emplace(prefix_lane_id,
+                               GetLaneChangeType(lane_id, sequence))
+                      .first;
+    }
+    lane_change_type[i] = type_iter->second;
 
     if (lane_change_type[i] != LaneChangeType::LEFT &&
         lane_change_type[i] != LaneChangeType::RIGHT &&
@@ -82,33 +106,29 @@ void SequencePredictor::FilterLaneSequences(
     }
 
     // The obstacle has interference with ADC within a small distance
-    double distance = GetLaneChangeDistanceWithADC(sequence);
+    double distance = std::numeric_limits<double>::max();
+    if (adc_container->HasOverlap(sequence)) {
+      auto dist_iter = prefix_distance.find(prefix_lane_id);
+      if (dist_iter == prefix_distance.end()) {
+        dist_iter =
+            prefix_distance
+                .emplace(prefix_lane_id,
+                         GetADCProjectionDistance(
+                             prefix_lane_id,
+                             sequence.lane_segment(0).start_s()))
+                .first;
+      }
+      distance = dist_iter->second;
+    } else {
+      ADEBUG << "The sequence [" << ToString(sequence)
+             << "] has no overlap with ADC.";
+    }
     ADEBUG << "Distance to ADC " << std::fixed << std::setprecision(6)
            << distance;
     if (distance > 0.0 && distance < FLAGS_lane_change_dist) {
-      bool obs_within_its_own_lane = true;
-      for (int j = 0; j < feature.polygon_point_size(); j++) {
-        Eigen::Vector2d position(feature.polygon_point(j).x(),
-                                 feature.polygon_point(j).y());
-        std::shared_ptr<const LaneInfo> lane_info =
-            PredictionMap::LaneById(lane_id);
-        if (lane_info == nullptr) {
-          obs_within_its_own_lane = false;
-          break;
-        }
-
-        double lane_s = 0.0;
-        double lane_l = 0.0;
-        PredictionMap::GetProjection(position, lane_info, &lane_s, &lane_l);
-
-        double left = 0.0;
-        double right = 0.0;
-        lane_info->GetWidth(lane_s, &left, &right);
-
-        if (lane_l > left || lane_l < -right) {
-          obs_within_its_own_lane = false;
-          break;
-        }
+      if (!own_lane_evaluated) {
+        obs_within_its_own_lane = IsObstacleWithinItsOwnLane(feature, lane_id);
+        own_lane_evaluated = true;
       }
 
       if (obs_within_its_own_lane) {
@@ -191,14 +211,9 @@ SequencePredictor::LaneChangeType SequencePredictor::GetLaneChangeType(
 
 double SequencePredictor::GetLaneChangeDistanceWithADC(
     const LaneSequence& lane_sequence) {
-  auto pose_container =
-      ContainerManager::Instance()->GetContainer<PoseContainer>(
-          AdapterConfig::LOCALIZATION);
   auto adc_container =
       ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
           AdapterConfig::PLANNING_TRAJECTORY);
-
-  CHECK_NOTNULL(pose_container);
   CHECK_NOTNULL(adc_container);
 
   if (!adc_container->HasOverlap(lane_sequence)) {
@@ -207,20 +222,29 @@ double SequencePredictor::GetLaneChangeDistanceWithADC(
     return std::numeric_limits<double>::max();
   }
 
+  return GetADCProjectionDistance(lane_sequence.lane_segment(0).lane_id(),
+                                  lane_sequence.lane_segment(0).start_s());
+}
+
+double SequencePredictor::GetADCProjectionDistance(const std::string& lane_id,
+                                                   const double start_s) {
+  auto pose_container =
+      ContainerManager::Instance()->GetContainer<PoseContainer>(
+          AdapterConfig::LOCALIZATION);
+  CHECK_NOTNULL(pose_container);
+
   Eigen::Vector2d adc_position;
   if (pose_container->ToPerceptionObstacle() != nullptr) {
     adc_position[0] = pose_container->ToPerceptionObstacle()->position().x();
     adc_position[1] = pose_container->ToPerceptionObstacle()->position().y();
 
-    std::string obstacle_lane_id = lane_sequence.lane_segment(0).lane_id();
-    double obstacle_lane_s = lane_sequence.lane_segment(0).start_s();
     double lane_s = 0.0;
     double lane_l = 0.0;
     if (PredictionMap::GetProjection(adc_position,
-                                     PredictionMap::LaneById(obstacle_lane_id),
-                                     &lane_s, &lane_l)) {
-      ADEBUG << "Distance with ADC is " << std::fabs(lane_s - obstacle_lane_s);
-      return obstacle_lane_s - lane_s;
+                                     PredictionMap::LaneById(lane_id), &lane_s,
+                                     &lane_l)) {
+      ADEBUG << "Distance with ADC is " << std::fabs(lane_s - start_s);
+      return start_s - lane_s;
     }
   }
 
@@ -228,6 +252,31 @@ double SequencePredictor::GetLaneChangeDistanceWithADC(
   return std::numeric_limits<double>::max();
 }
 
+bool SequencePredictor::IsObstacleWithinItsOwnLane(const Feature& feature,
+                                                   const std::string& lane_id) {
+  std::shared_ptr<const LaneInfo> lane_info = PredictionMap::LaneById(lane_id);
+  if (lane_info == nullptr) {
+    return false;
+  }
+  for (int j = 0; j < feature.polygon_point_size(); j++) {
+    Eigen::Vector2d position(feature.polygon_point(j).x(),
+                             feature.polygon_point(j).y());
+
+    double lane_s = 0.0;
+    double lane_l = 0.0;
+    PredictionMap::GetProjection(position, lane_info, &lane_s, &lane_l);
+
+    double left = 0.0;
+    double right = 0.0;
+    lane_info->GetWidth(lane_s, &left, &right);
+
+    if (lane_l > left || lane_l < -right) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool SequencePredictor::LaneSequenceWithMaxProb(const LaneChangeType& type,
                                                 const double probability,
                                                 const double max_prob) {
@@ -86,6 +86,27 @@ class SequencePredictor : public Predictor {
    */
   double GetLaneChangeDistanceWithADC(const LaneSequence& lane_sequence);
 
+  /**
+   * @brief Get the distance from the ADC projection to a lane-sequence
+   *        start position. Only depends on the first lane segment, so
+   *        sequences sharing a prefix can share the result.
+   * @param Lane id of the first lane segment
+   * @param Start s of the first lane segment
+   * @return Lane change distance with ADC
+   */
+  double GetADCProjectionDistance(const std::string& lane_id,
+                                  const double start_s);
+
+  /**
+   * @brief Check if all polygon points of the obstacle are within the
+   *        boundary of its current lane
+   * @param Obstacle feature
+   * @param Current lane id
+   * @return Boolean if the obstacle is within its own lane
+   */
+  bool IsObstacleWithinItsOwnLane(const Feature& feature,
+                                  const std::string& lane_id);
+
   /**
    * @brief Draw constant acceleration trajectory points
    * @param Obstacle
@@ -30,5 +30,10 @@ DEFINE_double(min_length_for_lane_change, 1.0,
 DEFINE_bool(enable_change_lane_in_result, true,
             "contain change lane operator in result");
 
+DEFINE_bool(enable_incremental_routing, false,
+            "True to repair a re-route locally by searching only up to the "
+            "first surviving node of the previous route and splicing its "
+            "tail, instead of solving the full problem again");
+
 DEFINE_uint32(routing_response_history_interval_ms, 1000,
               "ms, emit routing resposne for this time interval");
@@ -16,6 +16,9 @@
 
 #include "modules/routing/core/navigator.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "cyber/common/file.h"
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/graph/sub_topo_graph.h"
@@ -81,6 +84,20 @@ void SetErrorCode(const common::ErrorCode& error_code_id,
   }
 }
 
+bool IsNodeBlacklisted(const TopoRangeManager& range_manager,
+                       const NodeWithRange& node) {
+  const auto* ranges = range_manager.Find(node.GetTopoNode());
+  if (ranges == nullptr) {
+    return false;
+  }
+  for (const auto& range : *ranges) {
+    if (range.StartS() < node.EndS() && range.EndS() > node.StartS()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void PrintDebugData(const std::vector<NodeWithRange>& nodes) {
   AINFO << "Route lane id\tis virtual\tstart s\tend s";
   for (const auto& node : nodes) {
@@ -201,6 +218,61 @@ bool Navigator::SearchRouteByStrategy(
   return true;
 }
 
+bool Navigator::SearchRouteIncremental(
+    const std::vector<const TopoNode*>& way_nodes,
+    const std::vector<double>& way_s,
+    std::vector<NodeWithRange>* const result_nodes) const {
+  if (way_nodes.size() != 2 || last_result_nodes_.empty()) {
+    return false;
+  }
+  if (way_nodes.back() != last_dest_node_ ||
+      std::fabs(way_s.back() - last_dest_s_) > 1e-3) {
+    return false;
+  }
+  const size_t route_size = last_result_nodes_.size();
+  // the maximal suffix of the previous route untouched by the black list
+  size_t rejoin_index = 0;
+  for (size_t i = route_size; i > 0; --i) {
+    if (IsNodeBlacklisted(topo_range_manager_, last_result_nodes_[i - 1])) {
+      rejoin_index = i;
+      break;
+    }
+  }
+  // rejoin behind the new start if it still lies on the previous route
+  for (size_t i = 0; i < route_size; ++i) {
+    if (last_result_nodes_[i].GetTopoNode() == way_nodes.front()) {
+      rejoin_index = std::max(rejoin_index, i + 1);
+      break;
+    }
+  }
+  if (rejoin_index >= route_size) {
+    // nothing left of the previous route to splice
+    return false;
+  }
+  const auto& rejoin_node = last_result_nodes_[rejoin_index];
+  std::vector<const TopoNode*> head_way_nodes = {way_nodes.front(),
+                                                 rejoin_node.GetTopoNode()};
+  std::vector<double> head_way_s = {way_s.front(), rejoin_node.StartS()};
+  std::vector<NodeWithRange> head_nodes;
+  if (!SearchRouteByStrategy(graph_.get(), head_way_nodes, head_way_s,
+                             &head_nodes)) {
+    AWARN << "Failed to reach the previous route at lane "
+          << rejoin_node.LaneId() << ", fall back to full search.";
+    return false;
+  }
+  head_nodes.insert(head_nodes.end(),
+                    last_result_nodes_.begin() + rejoin_index,
+                    last_result_nodes_.end());
+  result_nodes->clear();
+  if (!MergeRoute(head_nodes, result_nodes)) {
+    return false;
+  }
+  AINFO << "Incremental re-route rejoined the previous route at lane "
+        << rejoin_node.LaneId() << ", reused " << route_size - rejoin_index
+        << " of " << route_size << " nodes.";
+  return true;
+}
+
 bool Navigator::SearchRoute(const RoutingRequest& request,
                             RoutingResponse* const response) {
   if (!ShowRequestInfo(request, graph_.get())) {
@@ -224,7 +296,12 @@ bool Navigator::SearchRoute(const RoutingRequest& request,
   }
 
   std::vector<NodeWithRange> result_nodes;
-  if (!SearchRouteByStrategy(graph_.get(), way_nodes, way_s, &result_nodes)) {
+  bool route_found = false;
+  if (FLAGS_enable_incremental_routing) {
+    route_found = SearchRouteIncremental(way_nodes, way_s, &result_nodes);
+  }
+  if (!route_found &&
+      !SearchRouteByStrategy(graph_.get(), way_nodes, way_s, &result_nodes)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_RESPONSE,
                  "Failed to find route with request!",
                  response->mutable_status());
@@ -238,6 +315,10 @@ bool Navigator::SearchRoute(const RoutingRequest& request,
   result_nodes.front().SetStartS(request.waypoint().begin()->s());
   result_nodes.back().SetEndS(request.waypoint().rbegin()->s());
 
+  last_result_nodes_ = result_nodes;
+  last_dest_node_ = way_nodes.back();
+  last_dest_s_ = way_s.back();
+
   if (!result_generator_->GeneratePassageRegion(
           graph_->MapVersion(), request, result_nodes, topo_range_manager_,
           response)) {
@@ -51,12 +51,24 @@ class Navigator {
   bool MergeRoute(const std::vector<NodeWithRange>& node_vec,
                   std::vector<NodeWithRange>* const result_node_vec) const;
 
+  // Repair a re-route locally: search only from the new start to the
+  // first surviving node of the previous route and splice its tail.
+  // Returns false when the previous route cannot be reused.
+  bool SearchRouteIncremental(
+      const std::vector<const TopoNode*>& way_nodes,
+      const std::vector<double>& way_s,
+      std::vector<NodeWithRange>* const result_nodes) const;
+
  private:
   bool is_ready_ = false;
   std::unique_ptr<TopoGraph> graph_;
 
   TopoRangeManager topo_range_manager_;
 
+  std::vector<NodeWithRange> last_result_nodes_;
+  const TopoNode* last_dest_node_ = nullptr;
+  double last_dest_s_ = 0.0;
+
   std::unique_ptr<BlackListRangeGenerator> black_list_generator_;
   std::unique_ptr<ResultGenerator> result_generator_;
 };
@@ -218,7 +218,7 @@ void SubTopoGraph::InitSubEdge(const TopoNode* topo_node) {
 
 void SubTopoGraph::InitInSubNodeSubEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::vector<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* in_edge : origin_edge) {
     if (GetSubNodes(in_edge->FromNode(), &other_sub_nodes)) {
@@ -245,7 +245,7 @@ void SubTopoGraph::InitInSubNodeSubEdge(
 
 void SubTopoGraph::InitOutSubNodeSubEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::vector<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* out_edge : origin_edge) {
     if (GetSubNodes(out_edge->ToNode(), &other_sub_nodes)) {
@@ -295,7 +295,7 @@ void SubTopoGraph::AddPotentialEdge(const TopoNode* topo_node) {
 
 void SubTopoGraph::AddPotentialInEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::vector<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* in_edge : origin_edge) {
     if (GetSubNodes(in_edge->FromNode(), &other_sub_nodes)) {
@@ -328,7 +328,7 @@ void SubTopoGraph::AddPotentialInEdge(
 
 void SubTopoGraph::AddPotentialOutEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::vector<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* out_edge : origin_edge) {
     if (GetSubNodes(out_edge->ToNode(), &other_sub_nodes)) {
@@ -76,10 +76,10 @@ class SubTopoGraph {
 
   void InitInSubNodeSubEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::vector<const TopoEdge*>& origin_edge);
   void InitOutSubNodeSubEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::vector<const TopoEdge*>& origin_edge);
 
   bool GetSubNodes(const TopoNode* node,
                    std::unordered_set<TopoNode*>* const sub_nodes) const;
@@ -87,10 +87,10 @@ class SubTopoGraph {
   void AddPotentialEdge(const TopoNode* topo_node);
   void AddPotentialInEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::vector<const TopoEdge*>& origin_edge);
   void AddPotentialOutEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::vector<const TopoEdge*>& origin_edge);
 
  private:
   std::vector<std::shared_ptr<TopoNode>> topo_nodes_;
@@ -32,12 +32,14 @@ bool TopoGraph::LoadNodes(const Graph& graph) {
     AERROR << "No nodes found in topology graph.";
     return false;
   }
+  // the arena is sized exactly so that node pointers handed out below
+  // never get invalidated by reallocation
+  topo_nodes_.reserve(graph.node_size());
+  node_index_map_.reserve(graph.node_size());
   for (const auto& node : graph.node()) {
     node_index_map_[node.lane_id()] = static_cast<int>(topo_nodes_.size());
-    std::shared_ptr<TopoNode> topo_node;
-    topo_node.reset(new TopoNode(node));
-    road_node_map_[node.road_id()].insert(topo_node.get());
-    topo_nodes_.push_back(std::move(topo_node));
+    topo_nodes_.emplace_back(node);
+    road_node_map_[node.road_id()].insert(&topo_nodes_.back());
   }
   return true;
 }
@@ -48,20 +50,19 @@ bool TopoGraph::LoadEdges(const Graph& graph) {
     AINFO << "0 edges found in topology graph, but it's fine";
     return true;
   }
+  topo_edges_.reserve(graph.edge_size());
   for (const auto& edge : graph.edge()) {
-    const std::string& from_lane_id = edge.from_lane_id();
-    const std::string& to_lane_id = edge.to_lane_id();
-    if (node_index_map_.count(from_lane_id) != 1 ||
-        node_index_map_.count(to_lane_id) != 1) {
+    const auto from_iter = node_index_map_.find(edge.from_lane_id());
+    const auto to_iter = node_index_map_.find(edge.to_lane_id());
+    if (from_iter == node_index_map_.end() ||
+        to_iter == node_index_map_.end()) {
       return false;
     }
-    std::shared_ptr<TopoEdge> topo_edge;
-    TopoNode* from_node = topo_nodes_[node_index_map_[from_lane_id]].get();
-    TopoNode* to_node = topo_nodes_[node_index_map_[to_lane_id]].get();
-    topo_edge.reset(new TopoEdge(edge, from_node, to_node));
-    from_node->AddOutEdge(topo_edge.get());
-    to_node->AddInEdge(topo_edge.get());
-    topo_edges_.push_back(std::move(topo_edge));
+    TopoNode* from_node = &topo_nodes_[from_iter->second];
+    TopoNode* to_node = &topo_nodes_[to_iter->second];
+    topo_edges_.emplace_back(edge, from_node, to_node);
+    from_node->AddOutEdge(&topo_edges_.back());
+    to_node->AddInEdge(&topo_edges_.back());
   }
   return true;
 }
@@ -93,7 +94,7 @@ const TopoNode* TopoGraph::GetNode(const std::string& id) const {
   if (iter == node_index_map_.end()) {
     return nullptr;
   }
-  return topo_nodes_[iter->second].get();
+  return &topo_nodes_[iter->second];
 }
 
 void TopoGraph::GetNodesByRoadId(
@@ -16,7 +16,6 @@
 
 #pragma once
 
-#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -50,8 +49,10 @@ class TopoGraph {
  private:
   std::string map_version_;
   std::string map_district_;
-  std::vector<std::shared_ptr<TopoNode> > topo_nodes_;
-  std::vector<std::shared_ptr<TopoEdge> > topo_edges_;
+  // nodes and edges live in contiguous arenas sized up front, so pointers
+  // into them stay valid and graph traversal stays cache friendly
+  std::vector<TopoNode> topo_nodes_;
+  std::vector<TopoEdge> topo_edges_;
   std::unordered_map<std::string, int> node_index_map_;
   std::unordered_map<std::string, std::unordered_set<const TopoNode*> >
       road_node_map_;
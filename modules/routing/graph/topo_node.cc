@@ -176,45 +176,45 @@ const std::vector<NodeSRange>& TopoNode::RightOutRange() const {
   return right_out_sorted_range_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromAllEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::InFromAllEdge() const {
   return in_from_all_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromLeftEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::InFromLeftEdge() const {
   return in_from_left_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromRightEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::InFromRightEdge() const {
   return in_from_right_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromLeftOrRightEdge()
+const std::vector<const TopoEdge*>& TopoNode::InFromLeftOrRightEdge()
     const {
   return in_from_left_or_right_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromPreEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::InFromPreEdge() const {
   return in_from_pre_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToAllEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::OutToAllEdge() const {
   return out_to_all_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToLeftEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::OutToLeftEdge() const {
   return out_to_left_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToRightEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::OutToRightEdge() const {
   return out_to_right_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToLeftOrRightEdge()
+const std::vector<const TopoEdge*>& TopoNode::OutToLeftOrRightEdge()
     const {
   return out_to_left_or_right_edge_set_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToSucEdge() const {
+const std::vector<const TopoEdge*>& TopoNode::OutToSucEdge() const {
   return out_to_suc_edge_set_;
 }
 
@@ -261,18 +261,18 @@ void TopoNode::AddInEdge(const TopoEdge* edge) {
   }
   switch (edge->Type()) {
     case TET_LEFT:
-      in_from_right_edge_set_.insert(edge);
-      in_from_left_or_right_edge_set_.insert(edge);
+      in_from_right_edge_set_.push_back(edge);
+      in_from_left_or_right_edge_set_.push_back(edge);
       break;
     case TET_RIGHT:
-      in_from_left_edge_set_.insert(edge);
-      in_from_left_or_right_edge_set_.insert(edge);
+      in_from_left_edge_set_.push_back(edge);
+      in_from_left_or_right_edge_set_.push_back(edge);
       break;
     default:
-      in_from_pre_edge_set_.insert(edge);
+      in_from_pre_edge_set_.push_back(edge);
       break;
   }
-  in_from_all_edge_set_.insert(edge);
+  in_from_all_edge_set_.push_back(edge);
   in_edge_map_[edge->FromNode()] = edge;
 }
 
@@ -285,18 +285,18 @@ void TopoNode::AddOutEdge(const TopoEdge* edge) {
   }
   switch (edge->Type()) {
     case TET_LEFT:
-      out_to_left_edge_set_.insert(edge);
-      out_to_left_or_right_edge_set_.insert(edge);
+      out_to_left_edge_set_.push_back(edge);
+      out_to_left_or_right_edge_set_.push_back(edge);
       break;
     case TET_RIGHT:
-      out_to_right_edge_set_.insert(edge);
-      out_to_left_or_right_edge_set_.insert(edge);
+      out_to_right_edge_set_.push_back(edge);
+      out_to_left_or_right_edge_set_.push_back(edge);
       break;
     default:
-      out_to_suc_edge_set_.insert(edge);
+      out_to_suc_edge_set_.push_back(edge);
       break;
   }
-  out_to_all_edge_set_.insert(edge);
+  out_to_all_edge_set_.push_back(edge);
   out_edge_map_[edge->ToNode()] = edge;
 }
 
@@ -18,7 +18,6 @@
 
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "modules/routing/graph/topo_range.h"
@@ -52,16 +51,16 @@ class TopoNode {
   const std::vector<NodeSRange>& LeftOutRange() const;
   const std::vector<NodeSRange>& RightOutRange() const;
 
-  const std::unordered_set<const TopoEdge*>& InFromAllEdge() const;
-  const std::unordered_set<const TopoEdge*>& InFromLeftEdge() const;
-  const std::unordered_set<const TopoEdge*>& InFromRightEdge() const;
-  const std::unordered_set<const TopoEdge*>& InFromLeftOrRightEdge() const;
-  const std::unordered_set<const TopoEdge*>& InFromPreEdge() const;
-  const std::unordered_set<const TopoEdge*>& OutToAllEdge() const;
-  const std::unordered_set<const TopoEdge*>& OutToLeftEdge() const;
-  const std::unordered_set<const TopoEdge*>& OutToRightEdge() const;
-  const std::unordered_set<const TopoEdge*>& OutToLeftOrRightEdge() const;
-  const std::unordered_set<const TopoEdge*>& OutToSucEdge() const;
+  const std::vector<const TopoEdge*>& InFromAllEdge() const;
+  const std::vector<const TopoEdge*>& InFromLeftEdge() const;
+  const std::vector<const TopoEdge*>& InFromRightEdge() const;
+  const std::vector<const TopoEdge*>& InFromLeftOrRightEdge() const;
+  const std::vector<const TopoEdge*>& InFromPreEdge() const;
+  const std::vector<const TopoEdge*>& OutToAllEdge() const;
+  const std::vector<const TopoEdge*>& OutToLeftEdge() const;
+  const std::vector<const TopoEdge*>& OutToRightEdge() const;
+  const std::vector<const TopoEdge*>& OutToLeftOrRightEdge() const;
+  const std::vector<const TopoEdge*>& OutToSucEdge() const;
 
   const TopoEdge* GetInEdgeFrom(const TopoNode* from_node) const;
   const TopoEdge* GetOutEdgeTo(const TopoNode* to_node) const;
@@ -95,16 +94,18 @@ class TopoNode {
   std::vector<NodeSRange> left_out_sorted_range_;
   std::vector<NodeSRange> right_out_sorted_range_;
 
-  std::unordered_set<const TopoEdge*> in_from_all_edge_set_;
-  std::unordered_set<const TopoEdge*> in_from_left_edge_set_;
-  std::unordered_set<const TopoEdge*> in_from_right_edge_set_;
-  std::unordered_set<const TopoEdge*> in_from_left_or_right_edge_set_;
-  std::unordered_set<const TopoEdge*> in_from_pre_edge_set_;
-  std::unordered_set<const TopoEdge*> out_to_all_edge_set_;
-  std::unordered_set<const TopoEdge*> out_to_left_edge_set_;
-  std::unordered_set<const TopoEdge*> out_to_right_edge_set_;
-  std::unordered_set<const TopoEdge*> out_to_left_or_right_edge_set_;
-  std::unordered_set<const TopoEdge*> out_to_suc_edge_set_;
+  // adjacency is kept in packed arrays so that route search walks
+  // contiguous memory; duplicates are rejected through the edge maps below
+  std::vector<const TopoEdge*> in_from_all_edge_set_;
+  std::vector<const TopoEdge*> in_from_left_edge_set_;
+  std::vector<const TopoEdge*> in_from_right_edge_set_;
+  std::vector<const TopoEdge*> in_from_left_or_right_edge_set_;
+  std::vector<const TopoEdge*> in_from_pre_edge_set_;
+  std::vector<const TopoEdge*> out_to_all_edge_set_;
+  std::vector<const TopoEdge*> out_to_left_edge_set_;
+  std::vector<const TopoEdge*> out_to_right_edge_set_;
+  std::vector<const TopoEdge*> out_to_left_or_right_edge_set_;
+  std::vector<const TopoEdge*> out_to_suc_edge_set_;
 
   std::unordered_map<const TopoNode*, const TopoEdge*> out_edge_map_;
   std::unordered_map<const TopoNode*, const TopoEdge*> in_edge_map_;
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <limits>
 #include <queue>
+#include <unordered_set>
 
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/graph/sub_topo_graph.h"
@@ -29,11 +30,12 @@ namespace {
 
 struct SearchNode {
   const TopoNode* topo_node = nullptr;
+  int index = -1;
   double f = std::numeric_limits<double>::max();
 
   SearchNode() = default;
-  explicit SearchNode(const TopoNode* node)
-      : topo_node(node), f(std::numeric_limits<double>::max()) {}
+  SearchNode(const TopoNode* node, int node_index)
+      : topo_node(node), index(node_index) {}
   SearchNode(const SearchNode& search_node) = default;
 
   bool operator<(const SearchNode& node) const {
@@ -174,16 +176,42 @@ bool AdjustLaneChange(std::vector<const TopoNode*>* const result_node_vec) {
   return true;
 }
 
-bool Reconstruct(
-    const std::unordered_map<const TopoNode*, const TopoNode*>& came_from,
-    const TopoNode* dest_node, std::vector<NodeWithRange>* result_nodes) {
-  std::vector<const TopoNode*> result_node_vec;
-  result_node_vec.push_back(dest_node);
+}  // namespace
+
+AStarStrategy::AStarStrategy(bool enable_change)
+    : change_lane_enabled_(enable_change) {}
+
+void AStarStrategy::Clear() {
+  node_index_map_.clear();
+  indexed_nodes_.clear();
+  states_.clear();
+}
+
+int AStarStrategy::GetNodeIndex(const TopoNode* node) {
+  const auto iter = node_index_map_.find(node);
+  if (iter != node_index_map_.end()) {
+    return iter->second;
+  }
+  const int index = static_cast<int>(indexed_nodes_.size());
+  node_index_map_.emplace(node, index);
+  indexed_nodes_.push_back(node);
+  states_.emplace_back();
+  return index;
+}
+
+int AStarStrategy::FindNodeIndex(const TopoNode* node) const {
+  const auto iter = node_index_map_.find(node);
+  if (iter == node_index_map_.end()) {
+    return -1;
+  }
+  return iter->second;
+}
 
-  auto iter = came_from.find(dest_node);
-  while (iter != came_from.end()) {
-    result_node_vec.push_back(iter->second);
-    iter = came_from.find(iter->second);
+bool AStarStrategy::Reconstruct(
+    int dest_index, std::vector<NodeWithRange>* result_nodes) const {
+  std::vector<const TopoNode*> result_node_vec;
+  for (int index = dest_index; index >= 0; index = states_[index].came_from) {
+    result_node_vec.push_back(indexed_nodes_[index]);
   }
   std::reverse(result_node_vec.begin(), result_node_vec.end());
   if (!AdjustLaneChange(&result_node_vec)) {
@@ -198,19 +226,6 @@ bool Reconstruct(
   return true;
 }
 
-}  // namespace
-
-AStarStrategy::AStarStrategy(bool enable_change)
-    : change_lane_enabled_(enable_change) {}
-
-void AStarStrategy::Clear() {
-  closed_set_.clear();
-  open_set_.clear();
-  came_from_.clear();
-  enter_s_.clear();
-  g_score_.clear();
-}
-
 double AStarStrategy::HeuristicCost(const TopoNode* src_node,
                                     const TopoNode* dest_node) {
   const auto& src_point = src_node->AnchorPoint();
@@ -229,13 +244,15 @@ bool AStarStrategy::Search(const TopoGraph* graph,
 
   std::priority_queue<SearchNode> open_set_detail;
 
-  SearchNode src_search_node(src_node);
+  const int src_index = GetNodeIndex(src_node);
+  SearchNode src_search_node(src_node, src_index);
   src_search_node.f = HeuristicCost(src_node, dest_node);
   open_set_detail.push(src_search_node);
 
-  open_set_.insert(src_node);
-  g_score_[src_node] = 0.0;
-  enter_s_[src_node] = src_node->StartS();
+  states_[src_index].in_open = true;
+  states_[src_index].g_score = 0.0;
+  states_[src_index].enter_s = src_node->StartS();
+  states_[src_index].has_enter_s = true;
 
   SearchNode current_node;
   std::unordered_set<const TopoEdge*> next_edge_set;
@@ -243,21 +260,22 @@ bool AStarStrategy::Search(const TopoGraph* graph,
   while (!open_set_detail.empty()) {
     current_node = open_set_detail.top();
     const auto* from_node = current_node.topo_node;
+    const int from_index = current_node.index;
     if (current_node.topo_node == dest_node) {
-      if (!Reconstruct(came_from_, from_node, result_nodes)) {
+      if (!Reconstruct(from_index, result_nodes)) {
         AERROR << "Failed to reconstruct route.";
         return false;
       }
       return true;
     }
-    open_set_.erase(from_node);
+    states_[from_index].in_open = false;
     open_set_detail.pop();
 
-    if (closed_set_.count(from_node) != 0) {
+    if (states_[from_index].closed) {
       // if showed before, just skip...
       continue;
     }
-    closed_set_.emplace(from_node);
+    states_[from_index].closed = true;
 
     // if residual_s is less than FLAGS_min_length_for_lane_change, only move
     // forward
@@ -267,6 +285,8 @@ bool AStarStrategy::Search(const TopoGraph* graph,
             ? from_node->OutToAllEdge()
             : from_node->OutToSucEdge();
     double tentative_g_score = 0.0;
+    const double from_node_g_score = states_[from_index].g_score;
+    const double from_node_enter_s = states_[from_index].enter_s;
     next_edge_set.clear();
     for (const auto* edge : neighbor_edges) {
       sub_edge_set.clear();
@@ -276,29 +296,31 @@ bool AStarStrategy::Search(const TopoGraph* graph,
 
     for (const auto* edge : next_edge_set) {
       const auto* to_node = edge->ToNode();
-      if (closed_set_.count(to_node) == 1) {
+      // GetNodeIndex may grow states_, so slots are addressed by index
+      // rather than by reference below
+      const int to_index = GetNodeIndex(to_node);
+      if (states_[to_index].closed) {
         continue;
       }
       if (GetResidualS(edge, to_node) < FLAGS_min_length_for_lane_change) {
         continue;
       }
-      tentative_g_score =
-          g_score_[current_node.topo_node] + GetCostToNeighbor(edge);
+      tentative_g_score = from_node_g_score + GetCostToNeighbor(edge);
       if (edge->Type() != TopoEdgeType::TET_FORWARD) {
         tentative_g_score -=
             (edge->FromNode()->Cost() + edge->ToNode()->Cost()) / 2;
       }
       double f = tentative_g_score + HeuristicCost(to_node, dest_node);
-      if (open_set_.count(to_node) != 0 && f >= g_score_[to_node]) {
+      if (states_[to_index].in_open && f >= states_[to_index].g_score) {
         continue;
       }
       // if to_node is reached by forward, reset enter_s to start_s
       if (edge->Type() == TopoEdgeType::TET_FORWARD) {
-        enter_s_[to_node] = to_node->StartS();
+        states_[to_index].enter_s = to_node->StartS();
       } else {
         // else, add enter_s with FLAGS_min_length_for_lane_change
         double to_node_enter_s =
-            (enter_s_[from_node] + FLAGS_min_length_for_lane_change) /
+            (from_node_enter_s + FLAGS_min_length_for_lane_change) /
             from_node->Length() * to_node->Length();
         // enter s could be larger than end_s but should be less than length
         to_node_enter_s = std::min(to_node_enter_s, to_node->Length());
@@ -306,17 +328,16 @@ bool AStarStrategy::Search(const TopoGraph* graph,
         if (to_node_enter_s > to_node->EndS() && to_node == dest_node) {
           continue;
         }
-        enter_s_[to_node] = to_node_enter_s;
+        states_[to_index].enter_s = to_node_enter_s;
       }
+      states_[to_index].has_enter_s = true;
 
-      g_score_[to_node] = f;
-      SearchNode next_node(to_node);
+      states_[to_index].g_score = f;
+      SearchNode next_node(to_node, to_index);
       next_node.f = f;
       open_set_detail.push(next_node);
-      came_from_[to_node] = from_node;
-      if (open_set_.count(to_node) == 0) {
-        open_set_.insert(to_node);
-      }
+      states_[to_index].came_from = from_index;
+      states_[to_index].in_open = true;
     }
   }
   AERROR << "Failed to find goal lane with id: " << dest_node->LaneId();
@@ -325,12 +346,12 @@ bool AStarStrategy::Search(const TopoGraph* graph,
 
 double AStarStrategy::GetResidualS(const TopoNode* node) {
   double start_s = node->StartS();
-  const auto iter = enter_s_.find(node);
-  if (iter != enter_s_.end()) {
-    if (iter->second > node->EndS()) {
+  const int index = FindNodeIndex(node);
+  if (index >= 0 && states_[index].has_enter_s) {
+    if (states_[index].enter_s > node->EndS()) {
       return 0.0;
     }
-    start_s = iter->second;
+    start_s = states_[index].enter_s;
   } else {
     AWARN << "lane " << node->LaneId() << "(" << node->StartS() << ", "
           << node->EndS() << "not found in enter_s map";
@@ -356,9 +377,10 @@ double AStarStrategy::GetResidualS(const TopoEdge* edge,
   }
   double start_s = to_node->StartS();
   const auto* from_node = edge->FromNode();
-  const auto iter = enter_s_.find(from_node);
-  if (iter != enter_s_.end()) {
-    double temp_s = iter->second / from_node->Length() * to_node->Length();
+  const int from_index = FindNodeIndex(from_node);
+  if (from_index >= 0 && states_[from_index].has_enter_s) {
+    double temp_s = states_[from_index].enter_s / from_node->Length() *
+                    to_node->Length();
     start_s = std::max(start_s, temp_s);
   } else {
     AWARN << "lane " << from_node->LaneId() << "(" << from_node->StartS()
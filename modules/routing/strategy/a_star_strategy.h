@@ -16,8 +16,8 @@
 
 #pragma once
 
+#include <limits>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "modules/routing/strategy/strategy.h"
@@ -35,18 +35,34 @@ class AStarStrategy : public Strategy {
                       std::vector<NodeWithRange>* const result_nodes);
 
  private:
+  // Per-node search state. All state of a node sits in one flat array
+  // slot, so the hot loop touches contiguous memory instead of several
+  // hash maps.
+  struct SearchState {
+    double g_score = std::numeric_limits<double>::max();
+    double enter_s = 0.0;
+    int came_from = -1;
+    bool in_open = false;
+    bool closed = false;
+    bool has_enter_s = false;
+  };
+
   void Clear();
+  // Returns the state slot of the node, creating it on first touch.
+  int GetNodeIndex(const TopoNode* node);
+  // Returns the state slot of the node or -1 if it has not been touched.
+  int FindNodeIndex(const TopoNode* node) const;
+  bool Reconstruct(int dest_index,
+                   std::vector<NodeWithRange>* result_nodes) const;
   double HeuristicCost(const TopoNode* src_node, const TopoNode* dest_node);
   double GetResidualS(const TopoNode* node);
   double GetResidualS(const TopoEdge* edge, const TopoNode* to_node);
 
  private:
   bool change_lane_enabled_;
-  std::unordered_set<const TopoNode*> open_set_;
-  std::unordered_set<const TopoNode*> closed_set_;
-  std::unordered_map<const TopoNode*, const TopoNode*> came_from_;
-  std::unordered_map<const TopoNode*, double> g_score_;
-  std::unordered_map<const TopoNode*, double> enter_s_;
+  std::unordered_map<const TopoNode*, int> node_index_map_;
+  std::vector<const TopoNode*> indexed_nodes_;
+  std::vector<SearchState> states_;
 };
 
 }  // namespace routing
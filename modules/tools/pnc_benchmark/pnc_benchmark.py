@@ -0,0 +1,313 @@
+#!/usr/bin/env python
+
+###############################################################################
+# Copyright 2019 The Apollo Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+"""
+Full-stack PnC throughput benchmark.
+
+Drives planning + prediction + routing against dreamview's SimControl with
+a synthetic dense-traffic world. Planning is triggered by prediction and
+prediction by perception, so publishing the world faster than the 10Hz
+sensor rate runs the whole stack faster than real time. At the end a
+scorecard with sustained cycle rates, per-module CPU and p50/p99/p99.9
+latencies is printed.
+
+Prerequisite: dreamview, routing, prediction and planning are running,
+e.g. through scripts/pnc_benchmark.sh.
+
+Usage:
+    pnc_benchmark.py --duration 60 --world_rate 30 --num_obstacles 40
+"""
+import argparse
+import json
+import math
+import os
+import threading
+import time
+
+from cyber_py import cyber
+from modules.localization.proto import localization_pb2
+from modules.perception.proto import perception_obstacle_pb2
+from modules.planning.proto import planning_pb2
+from modules.prediction.proto import prediction_pb2
+from modules.routing.proto import routing_pb2
+
+DREAMVIEW_WS_URL = 'ws://localhost:8888/websocket'
+
+MODULE_PATTERNS = {
+    'planning': 'planning.dag',
+    'prediction': 'prediction.dag',
+    'routing': 'routing.dag',
+    'dreamview': 'dreamview',
+}
+
+
+def toggle_sim_control(enable):
+    """Toggles dreamview's SimControl through its websocket."""
+    try:
+        import websocket
+    except ImportError:
+        print('websocket-client not installed, cannot toggle SimControl; '
+              'enable it manually in dreamview')
+        return False
+    try:
+        conn = websocket.create_connection(DREAMVIEW_WS_URL, timeout=5)
+        conn.send(json.dumps({'type': 'ToggleSimControl', 'enable': enable}))
+        conn.close()
+        return True
+    except Exception as e:
+        print('failed to reach dreamview at %s: %s' % (DREAMVIEW_WS_URL, e))
+        return False
+
+
+def send_routing_request(node):
+    """Publishes the default sunnyvale loop routing request."""
+    routing_request = routing_pb2.RoutingRequest()
+    routing_request.header.timestamp_sec = time.time()
+    routing_request.header.module_name = 'pnc_benchmark'
+    routing_request.header.sequence_num = 0
+
+    waypoint = routing_request.waypoint.add()
+    waypoint.pose.x = 587696.82286
+    waypoint.pose.y = 4141446.66696
+    waypoint.id = '1-1'
+    waypoint.s = 1
+
+    waypoint = routing_request.waypoint.add()
+    waypoint.pose.x = 586948.740120
+    waypoint.pose.y = 4141171.118641
+    waypoint.id = '1-1'
+    waypoint.s = 80
+
+    writer = node.create_writer('/apollo/routing_request',
+                                routing_pb2.RoutingRequest)
+    time.sleep(2.0)
+    writer.write(routing_request)
+
+
+class DenseTrafficWorld(object):
+    """Publishes a ring of vehicles around the ADC at a fixed rate."""
+
+    def __init__(self, node, num_obstacles):
+        self.num_obstacles = num_obstacles
+        self.start_time = time.time()
+        self.adc_pose = None
+        self.lock = threading.Lock()
+        self.sequence_num = 0
+        self.writer = node.create_writer(
+            '/apollo/perception/obstacles',
+            perception_obstacle_pb2.PerceptionObstacles)
+        node.create_reader('/apollo/localization/pose',
+                           localization_pb2.LocalizationEstimate,
+                           self.on_localization)
+
+    def on_localization(self, localization):
+        with self.lock:
+            self.adc_pose = (localization.pose.position.x,
+                             localization.pose.position.y,
+                             localization.pose.heading)
+
+    def publish(self):
+        with self.lock:
+            pose = self.adc_pose
+        if pose is None:
+            return
+        x, y, heading = pose
+        obstacles = perception_obstacle_pb2.PerceptionObstacles()
+        now = time.time()
+        obstacles.header.timestamp_sec = now
+        obstacles.header.module_name = 'perception_obstacle'
+        obstacles.header.sequence_num = self.sequence_num
+        self.sequence_num += 1
+        # Two rows of vehicles per side, crawling along the ADC heading.
+        for i in range(self.num_obstacles):
+            row = i // 4
+            lane = i % 4
+            lon = 15.0 + 12.0 * row
+            lat = (lane - 1.5) * 3.5
+            obstacle = obstacles.perception_obstacle.add()
+            obstacle.id = i + 1
+            obstacle.position.x = (x + lon * math.cos(heading) -
+                                   lat * math.sin(heading))
+            obstacle.position.y = (y + lon * math.sin(heading) +
+                                   lat * math.cos(heading))
+            obstacle.position.z = 0.0
+            obstacle.theta = heading
+            obstacle.velocity.x = 2.0 * math.cos(heading)
+            obstacle.velocity.y = 2.0 * math.sin(heading)
+            obstacle.velocity.z = 0.0
+            obstacle.length = 4.5
+            obstacle.width = 2.0
+            obstacle.height = 1.6
+            obstacle.tracking_time = max(0.0, now - self.start_time)
+            obstacle.type = perception_obstacle_pb2.PerceptionObstacle.VEHICLE
+            obstacle.timestamp = now
+        self.writer.write(obstacles)
+
+
+class CpuSampler(object):
+    """Samples per-module CPU usage from /proc."""
+
+    def __init__(self):
+        self.pids = {}
+        for module, pattern in MODULE_PATTERNS.items():
+            self.pids[module] = self.find_pids(pattern)
+        self.clock_ticks = os.sysconf('SC_CLK_TCK')
+
+    @staticmethod
+    def find_pids(pattern):
+        pids = []
+        for pid in os.listdir('/proc'):
+            if not pid.isdigit():
+                continue
+            try:
+                with open('/proc/%s/cmdline' % pid) as f:
+                    cmdline = f.read()
+            except IOError:
+                continue
+            if pattern in cmdline:
+                pids.append(int(pid))
+        return pids
+
+    def snapshot(self):
+        usage = {}
+        for module, pids in self.pids.items():
+            total = 0.0
+            for pid in pids:
+                try:
+                    with open('/proc/%d/stat' % pid) as f:
+                        fields = f.read().split()
+                except IOError:
+                    continue
+                total += (int(fields[13]) + int(fields[14]))
+            usage[module] = total / self.clock_ticks
+        return usage
+
+
+class CycleCollector(object):
+    """Records arrival times and planning latencies."""
+
+    def __init__(self, node):
+        self.lock = threading.Lock()
+        self.planning_arrivals = []
+        self.prediction_arrivals = []
+        self.planning_latencies_ms = []
+        node.create_reader('/apollo/planning', planning_pb2.ADCTrajectory,
+                           self.on_planning)
+        node.create_reader('/apollo/prediction',
+                           prediction_pb2.PredictionObstacles,
+                           self.on_prediction)
+
+    def on_planning(self, trajectory):
+        with self.lock:
+            self.planning_arrivals.append(time.time())
+            if trajectory.HasField('latency_stats'):
+                self.planning_latencies_ms.append(
+                    trajectory.latency_stats.total_time_ms)
+
+    def on_prediction(self, _prediction):
+        with self.lock:
+            self.prediction_arrivals.append(time.time())
+
+
+def percentile(values, ratio):
+    if not values:
+        return float('nan')
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(math.ceil(ratio * len(ordered))) - 1)
+    return ordered[max(0, index)]
+
+
+def print_rate_line(name, arrivals, duration):
+    rate = len(arrivals) / duration if duration > 0 else float('nan')
+    intervals = [(b - a) * 1000.0 for a, b in zip(arrivals, arrivals[1:])]
+    print('  %-12s %6.1f cycles/s  interval p50 %6.1f ms  '
+          'p99 %6.1f ms  p99.9 %6.1f ms' %
+          (name, rate, percentile(intervals, 0.5), percentile(intervals, 0.99),
+           percentile(intervals, 0.999)))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='full-stack PnC throughput benchmark')
+    parser.add_argument('--duration', type=float, default=60.0,
+                        help='measurement window in seconds')
+    parser.add_argument('--world_rate', type=float, default=30.0,
+                        help='perception world publish rate in Hz')
+    parser.add_argument('--num_obstacles', type=int, default=40,
+                        help='number of vehicles in the traffic world')
+    parser.add_argument('--warmup', type=float, default=10.0,
+                        help='seconds to run before measuring')
+    args = parser.parse_args()
+
+    cyber.init()
+    node = cyber.Node('pnc_benchmark')
+
+    toggle_sim_control(True)
+    send_routing_request(node)
+
+    world = DenseTrafficWorld(node, args.num_obstacles)
+    collector = CycleCollector(node)
+
+    period = 1.0 / args.world_rate
+    end_of_warmup = time.time() + args.warmup
+    while time.time() < end_of_warmup:
+        world.publish()
+        time.sleep(period)
+
+    sampler = CpuSampler()
+    cpu_start = sampler.snapshot()
+    with collector.lock:
+        collector.planning_arrivals = []
+        collector.prediction_arrivals = []
+        collector.planning_latencies_ms = []
+
+    start = time.time()
+    deadline = start + args.duration
+    while time.time() < deadline:
+        world.publish()
+        time.sleep(period)
+    elapsed = time.time() - start
+    cpu_end = sampler.snapshot()
+
+    toggle_sim_control(False)
+
+    with collector.lock:
+        planning_arrivals = list(collector.planning_arrivals)
+        prediction_arrivals = list(collector.prediction_arrivals)
+        latencies = list(collector.planning_latencies_ms)
+
+    print('')
+    print('==================== PnC benchmark scorecard ====================')
+    print('window: %.1f s, world rate: %.1f Hz, obstacles: %d' %
+          (elapsed, args.world_rate, args.num_obstacles))
+    print('sustained cycle rates:')
+    print_rate_line('planning', planning_arrivals, elapsed)
+    print_rate_line('prediction', prediction_arrivals, elapsed)
+    print('planning latency: p50 %.1f ms  p99 %.1f ms  p99.9 %.1f ms' %
+          (percentile(latencies, 0.5), percentile(latencies, 0.99),
+           percentile(latencies, 0.999)))
+    print('per-module CPU (cores):')
+    for module in sorted(cpu_start):
+        cores = (cpu_end.get(module, 0.0) - cpu_start[module]) / elapsed
+        print('  %-12s %5.2f' % (module, cores))
+    print('=================================================================')
+
+    cyber.shutdown()
+
+
+if __name__ == '__main__':
+    main()
@@ -16,6 +16,8 @@
 # limitations under the License.
 ###############################################################################
 
+import json
+
 from common.statistical_analyzer import StatisticalAnalyzer
 from common.statistical_analyzer import PrintColors
 
@@ -23,6 +25,10 @@ from common.statistical_analyzer import PrintColors
 class LidarEndToEndAnalyzer:
     """control analyzer"""
 
+    # modules in data flow order; the lidar_timestamp stamped by the driver
+    # is copied into every downstream header and acts as the lineage id
+    MODULE_HOPS = ['lidar', 'perception', 'prediction', 'planning', 'control']
+
     def __init__(self):
         """init"""
         self.control_endtoend_latency = []
@@ -31,6 +37,9 @@ class LidarEndToEndAnalyzer:
         self.planning_endtoend_latency = []
         self.planning_unprocessed_lidar_timestamps = []
 
+        # lidar_timestamp -> {module: header timestamp_sec}
+        self.traces = {}
+
     def put_control(self, control_cmd):
         """put control data"""
         if control_cmd.header.lidar_timestamp in \
@@ -41,6 +50,7 @@ class LidarEndToEndAnalyzer:
             self.control_endtoend_latency.append(
                 (control_cmd.header.timestamp_sec -
                 control_cmd.header.lidar_timestamp * 1.0e-9) * 1000.0)
+        self.put_trace('control', control_cmd.header)
 
     def put_planning(self, planning_cmd):
         """put control data"""
@@ -52,6 +62,21 @@ class LidarEndToEndAnalyzer:
             self.planning_endtoend_latency.append(
                 (planning_cmd.header.timestamp_sec -
                 planning_cmd.header.lidar_timestamp * 1.0e-9) * 1000.0)
+        self.put_trace('planning', planning_cmd.header)
+
+    def put_perception(self, perception_obstacles):
+        """put perception data"""
+        self.put_trace('perception', perception_obstacles.header)
+
+    def put_prediction(self, prediction_obstacles):
+        """put prediction data"""
+        self.put_trace('prediction', prediction_obstacles.header)
+
+    def put_trace(self, module, header):
+        """record one hop of an already started trace"""
+        if header.lidar_timestamp in self.traces:
+            self.traces[header.lidar_timestamp].setdefault(
+                module, header.timestamp_sec)
 
     def put_lidar(self, point_cloud):
         """put lidar data"""
@@ -59,6 +84,8 @@ class LidarEndToEndAnalyzer:
             point_cloud.header.lidar_timestamp)
         self.planning_unprocessed_lidar_timestamps.append(
             point_cloud.header.lidar_timestamp)
+        self.traces[point_cloud.header.lidar_timestamp] = \
+            {'lidar': point_cloud.header.lidar_timestamp * 1.0e-9}
 
     def print_endtoend_latency(self):
         """print_endtoend_latency"""
@@ -80,3 +107,24 @@ class LidarEndToEndAnalyzer:
         print PrintColors.FAIL + "  - MISS # OF LIDAR: " + \
             str(len(self.planning_unprocessed_lidar_timestamps)) + \
             PrintColors.ENDC
+
+        for upstream, downstream in zip(self.MODULE_HOPS, self.MODULE_HOPS[1:]):
+            latency_list = []
+            for trace in self.traces.values():
+                if upstream in trace and downstream in trace:
+                    latency_list.append(
+                        (trace[downstream] - trace[upstream]) * 1000.0)
+            print PrintColors.HEADER + "* Hop " + upstream + " -> " + \
+                downstream + " Latency (ms)" + PrintColors.ENDC
+            StatisticalAnalyzer().print_statistical_results(latency_list)
+
+    def save_endtoend_traces(self, trace_file):
+        """dump per-lidar-frame traces to a json file for offline queries"""
+        traces = []
+        for lidar_timestamp in sorted(self.traces.keys()):
+            trace = {'lidar_timestamp': lidar_timestamp}
+            trace.update(self.traces[lidar_timestamp])
+            traces.append(trace)
+        with open(trace_file, 'w') as f:
+            json.dump(traces, f, sort_keys=True)
+        print "saved " + str(len(traces)) + " endtoend traces to " + trace_file
@@ -16,6 +16,7 @@
 # limitations under the License.
 ###############################################################################
 
+import json
 import sys
 import argparse
 import matplotlib.pyplot as plt
@@ -29,10 +30,12 @@ from module_planning_analyzer import PlannigAnalyzer
 from modules.perception.proto import perception_obstacle_pb2
 from modules.prediction.proto import prediction_obstacle_pb2
 from lidar_endtoend_analyzer import LidarEndToEndAnalyzer
+from module_perception_analyzer import PerceptionAnalyzer
 
 
 def process(control_analyzer, planning_analyzer, lidar_endtoend_analyzer,
-            is_simulation, plot_planning_path, plot_planning_refpath, all_data):
+            perception_analyzer, is_simulation, plot_planning_path,
+            plot_planning_refpath, all_data):
     is_auto_drive = False
 
     for msg in reader.read_messages():
@@ -82,6 +85,8 @@ def process(control_analyzer, planning_analyzer, lidar_endtoend_analyzer,
                 continue
             perception = perception_obstacle_pb2.PerceptionObstacles()
             perception.ParseFromString(msg.message)
+            lidar_endtoend_analyzer.put_perception(perception)
+            perception_analyzer.put(perception)
 
         if msg.topic == "/apollo/prediction":
             if ((not is_auto_drive) and (not all_data)) or is_simulation or \
@@ -89,6 +94,7 @@ def process(control_analyzer, planning_analyzer, lidar_endtoend_analyzer,
                 continue
             prediction = prediction_obstacle_pb2.PredictionObstacles()
             prediction.ParseFromString(msg.message)
+            lidar_endtoend_analyzer.put_prediction(prediction)
 
 if __name__ == "__main__":
     if len(sys.argv) < 2:
@@ -115,6 +121,17 @@ if __name__ == "__main__":
     parser.add_argument(
         "-a", "--alldata", action="store_const", const=True,
         help="Analyze all data (both auto and manual), otherwise auto data only without this option.")
+
+    parser.add_argument(
+        "-trace", "--endtoendtrace", action="store", type=str,
+        help="Specify a json file to dump per-lidar-frame endtoend traces "
+             "(hop timestamps keyed by lidar_timestamp) for offline queries.")
+
+    parser.add_argument(
+        "-gate", "--latencygate", action="store", type=str,
+        help="Specify a json file of planning task name -> p95 latency "
+             "budget in ms; print machine readable results and exit "
+             "non-zero when any budget is exceeded.")
     args = parser.parse_args()
 
     record_file = args.file
@@ -123,17 +140,26 @@ if __name__ == "__main__":
     control_analyzer = ControlAnalyzer()
     planning_analyzer = PlannigAnalyzer(args.simulation)
     lidar_endtoend_analyzer = LidarEndToEndAnalyzer()
+    perception_analyzer = PerceptionAnalyzer()
 
-    process(control_analyzer, planning_analyzer,
-            lidar_endtoend_analyzer, args.simulation, args.planningpath,
+    process(control_analyzer, planning_analyzer, lidar_endtoend_analyzer,
+            perception_analyzer, args.simulation, args.planningpath,
             args.planningrefpath, args.alldata)
 
     if args.simulation:
         planning_analyzer.print_simulation_results()
+    elif args.latencygate:
+        with open(args.latencygate) as f:
+            task_budgets_ms = json.load(f)
+        if not planning_analyzer.print_latency_gate_results(task_budgets_ms):
+            sys.exit(1)
     elif args.planningpath or args.planningrefpath:
         plt.axis('equal')
         plt.show()
     else:
         control_analyzer.print_latency_statistics()
         planning_analyzer.print_latency_statistics()
+        perception_analyzer.print_latency_statistics()
         lidar_endtoend_analyzer.print_endtoend_latency()
+        if args.endtoendtrace:
+            lidar_endtoend_analyzer.save_endtoend_traces(args.endtoendtrace)
@@ -0,0 +1,52 @@
+#!/usr/bin/env python
+
+###############################################################################
+# Copyright 2019 The Apollo Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+from common.statistical_analyzer import StatisticalAnalyzer
+from common.statistical_analyzer import PrintColors
+
+
+class PerceptionAnalyzer:
+    """perception latency analyzer"""
+
+    def __init__(self):
+        """init"""
+        self.module_latency = []
+        self.stage_latency = {}
+
+    def put(self, perception_obstacles):
+        """put"""
+        latency_stats = perception_obstacles.latency_stats
+        if latency_stats.HasField('total_time_ms'):
+            self.module_latency.append(latency_stats.total_time_ms)
+        for stage in latency_stats.stage_latency:
+            self.stage_latency.setdefault(stage.stage_name, []) \
+                .append(stage.time_ms)
+
+    def print_latency_statistics(self):
+        """print_latency_statistics"""
+        print "\n\n"
+        print PrintColors.HEADER + "--- Perception Latency (ms) ---" + \
+            PrintColors.ENDC
+        StatisticalAnalyzer().print_statistical_results(self.module_latency)
+
+        print PrintColors.HEADER + "--- Perception Stage Latency (ms) ---" + \
+            PrintColors.ENDC
+        for stage_name in sorted(self.stage_latency.keys()):
+            print PrintColors.BOLD + stage_name + PrintColors.ENDC
+            StatisticalAnalyzer().print_statistical_results(
+                self.stage_latency[stage_name])
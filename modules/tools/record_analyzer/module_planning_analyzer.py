@@ -16,6 +16,8 @@
 # limitations under the License.
 ###############################################################################
 
+import json
+
 from common.statistical_analyzer import StatisticalAnalyzer
 from common.statistical_analyzer import PrintColors
 from common.distribution_analyzer import DistributionAnalyzer
@@ -33,6 +35,7 @@ class PlannigAnalyzer:
     def __init__(self, is_simulation):
         """init"""
         self.module_latency = []
+        self.task_latency = {}
         self.trajectory_type_dist = {}
         self.estop_reason_dist = {}
         self.error_code_analyzer = ErrorCodeAnalyzer()
@@ -51,6 +54,9 @@ class PlannigAnalyzer:
         if not self.is_simulation:
             latency = adc_trajectory.latency_stats.total_time_ms
             self.module_latency.append(latency)
+            for task_stats in adc_trajectory.latency_stats.task_stats:
+                self.task_latency.setdefault(task_stats.name, []) \
+                    .append(task_stats.time_ms)
 
             self.error_code_analyzer.put(
                 adc_trajectory.header.status.error_code)
@@ -148,6 +154,13 @@ class PlannigAnalyzer:
             PrintColors.ENDC
         StatisticalAnalyzer().print_statistical_results(self.module_latency)
 
+        print PrintColors.HEADER + "--- Planning Task Latency (ms) ---" + \
+            PrintColors.ENDC
+        for task_name in sorted(self.task_latency.keys()):
+            print PrintColors.BOLD + task_name + PrintColors.ENDC
+            StatisticalAnalyzer().print_statistical_results(
+                self.task_latency[task_name])
+
         print PrintColors.HEADER + "--- Planning Trajectroy Type Distribution" \
                                    " ---" + PrintColors.ENDC
         DistributionAnalyzer().print_distribution_results(
@@ -198,6 +211,29 @@ class PlannigAnalyzer:
 
         print str(results)
 
+    def print_latency_gate_results(self, task_budgets_ms):
+        """check per-task p95 latency against budgets given as a dict of
+        task name -> budget in ms, print machine readable results and
+        return True when every budget holds"""
+        results = {}
+        all_passed = True
+        for task_name, budget_ms in task_budgets_ms.items():
+            data = self.task_latency.get(task_name, [])
+            result = {'budget_ms': budget_ms, 'cycle_num': len(data)}
+            if len(data) == 0:
+                result['pass'] = False
+            else:
+                arr = np.array(data)
+                result['p50_ms'] = round(float(np.percentile(arr, 50)), 3)
+                result['p95_ms'] = round(float(np.percentile(arr, 95)), 3)
+                result['p99_ms'] = round(float(np.percentile(arr, 99)), 3)
+                result['pass'] = result['p95_ms'] <= budget_ms
+            if not result['pass']:
+                all_passed = False
+            results[task_name] = result
+        print json.dumps(results, sort_keys=True)
+        return all_passed
+
     def plot_path(self, plt, adc_trajectory):
         path_coords = self.trim_path_by_distance(adc_trajectory, 5.0)
         x = []
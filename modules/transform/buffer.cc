@@ -16,11 +16,36 @@
 
 #include "modules/transform/buffer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "tf2/LinearMath/Transform.h"
+
 #include "cyber/cyber.h"
 
 namespace apollo {
 namespace transform {
 
+namespace {
+
+uint64_t PackFramePair(int32_t target_index, int32_t source_index) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(target_index)) << 32) |
+         static_cast<uint32_t>(source_index);
+}
+
+tf2::Transform ToTf2Transform(const geometry_msgs::TransformStamped& msg) {
+  return tf2::Transform(
+      tf2::Quaternion(msg.transform.rotation.x, msg.transform.rotation.y,
+                      msg.transform.rotation.z, msg.transform.rotation.w),
+      tf2::Vector3(msg.transform.translation.x, msg.transform.translation.y,
+                   msg.transform.translation.z));
+}
+
+}  // namespace
+
 static constexpr float kSecondToNanoFactor = 1e9f;
 
 Buffer::Buffer() : BufferCore() { Init(); }
@@ -78,6 +103,8 @@ void Buffer::SubscriptionCallbackImpl(
   }
   last_update_ = now;
 
+  std::vector<geometry_msgs::TransformStamped> received_msgs;
+  received_msgs.reserve(msg_evt->transforms_size());
   for (int i = 0; i < msg_evt->transforms_size(); i++) {
     try {
       geometry_msgs::TransformStamped trans_stamped;
@@ -108,11 +135,164 @@ void Buffer::SubscriptionCallbackImpl(
         static_msgs_.push_back(trans_stamped);
       }
       setTransform(trans_stamped, authority, is_static);
+      received_msgs.push_back(trans_stamped);
     } catch (tf2::TransformException& ex) {
       std::string temp = ex.what();
       AERROR << "Failure to set recieved transform:" << temp.c_str();
     }
   }
+  PublishSnapshot(received_msgs, is_static);
+  if (is_static && !received_msgs.empty()) {
+    RebuildStaticChains();
+  }
+}
+
+void Buffer::RebuildStaticChains() {
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  auto table = std::make_shared<StaticChainTable>();
+  auto& frame_index = table->frame_index;
+  std::vector<std::string> frame_names;
+  const auto intern = [&frame_index, &frame_names](const std::string& frame) {
+    const auto it = frame_index.find(frame);
+    if (it != frame_index.end()) {
+      return it->second;
+    }
+    const int32_t index = static_cast<int32_t>(frame_names.size());
+    frame_index.emplace(frame, index);
+    frame_names.push_back(frame);
+    return index;
+  };
+
+  // Keep only the latest broadcast per directed edge.
+  std::unordered_map<uint64_t, const geometry_msgs::TransformStamped*> edges;
+  for (const auto& msg : static_msgs_) {
+    edges[PackFramePair(intern(msg.header.frame_id),
+                        intern(msg.child_frame_id))] = &msg;
+  }
+
+  // Undirected adjacency over static edges only; each entry maps the
+  // neighbor frame's coordinates into this frame's coordinates.
+  struct StaticEdge {
+    int32_t neighbor;
+    tf2::Transform transform;
+    uint64_t stamp;
+  };
+  std::vector<std::vector<StaticEdge>> adjacency(frame_names.size());
+  for (const auto& edge : edges) {
+    const int32_t parent = static_cast<int32_t>(edge.first >> 32);
+    const int32_t child = static_cast<int32_t>(edge.first & 0xFFFFFFFF);
+    const tf2::Transform transform = ToTf2Transform(*edge.second);
+    const uint64_t stamp = edge.second->header.stamp;
+    adjacency[parent].push_back({child, transform, stamp});
+    adjacency[child].push_back({parent, transform.inverse(), stamp});
+  }
+
+  // Precompose the chain from every frame to everything it can reach
+  // through static edges alone. The static graph is tiny, so the all-pairs
+  // sweep is cheap and runs only when /tf_static is received.
+  const int32_t num_frames = static_cast<int32_t>(frame_names.size());
+  std::vector<bool> visited(num_frames);
+  for (int32_t target = 0; target < num_frames; ++target) {
+    std::fill(visited.begin(), visited.end(), false);
+    visited[target] = true;
+    // Each pending entry holds the frame reached so far and the composed
+    // transform mapping it into the target frame.
+    std::queue<StaticEdge> pending;
+    pending.push({target, tf2::Transform::getIdentity(), 0});
+    while (!pending.empty()) {
+      const StaticEdge node = pending.front();
+      pending.pop();
+      for (const auto& edge : adjacency[node.neighbor]) {
+        if (visited[edge.neighbor]) {
+          continue;
+        }
+        visited[edge.neighbor] = true;
+        StaticEdge chain{edge.neighbor, node.transform * edge.transform,
+                         std::max(node.stamp, edge.stamp)};
+        geometry_msgs::TransformStamped& composed =
+            table->chains[PackFramePair(target, edge.neighbor)];
+        composed.header.stamp = chain.stamp;
+        composed.header.frame_id = frame_names[target];
+        composed.child_frame_id = frame_names[edge.neighbor];
+        const tf2::Vector3& translation = chain.transform.getOrigin();
+        composed.transform.translation.x = translation.x();
+        composed.transform.translation.y = translation.y();
+        composed.transform.translation.z = translation.z();
+        const tf2::Quaternion rotation = chain.transform.getRotation();
+        composed.transform.rotation.x = rotation.x();
+        composed.transform.rotation.y = rotation.y();
+        composed.transform.rotation.z = rotation.z();
+        composed.transform.rotation.w = rotation.w();
+        pending.push(chain);
+      }
+    }
+  }
+  std::atomic_store(&static_chains_,
+                    std::shared_ptr<const StaticChainTable>(std::move(table)));
+}
+
+bool Buffer::GetFromStaticChains(
+    const std::string& target_frame, const std::string& source_frame,
+    geometry_msgs::TransformStamped* transform) const {
+  const auto table = std::atomic_load(&static_chains_);
+  if (table == nullptr) {
+    return false;
+  }
+  const auto target_it = table->frame_index.find(target_frame);
+  if (target_it == table->frame_index.end()) {
+    return false;
+  }
+  const auto source_it = table->frame_index.find(source_frame);
+  if (source_it == table->frame_index.end()) {
+    return false;
+  }
+  const auto chain_it = table->chains.find(
+      PackFramePair(target_it->second, source_it->second));
+  if (chain_it == table->chains.end()) {
+    return false;
+  }
+  *transform = chain_it->second;
+  return true;
+}
+
+void Buffer::PublishSnapshot(
+    const std::vector<geometry_msgs::TransformStamped>& transforms,
+    bool is_static) {
+  if (transforms.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  auto old_snapshot = std::atomic_load(&snapshot_);
+  auto new_snapshot =
+      std::make_shared<Snapshot>(old_snapshot ? *old_snapshot : Snapshot());
+  for (const auto& trans_stamped : transforms) {
+    auto& entry = (*new_snapshot)[trans_stamped.header.frame_id + "/" +
+                                  trans_stamped.child_frame_id];
+    entry.transform = trans_stamped;
+    entry.is_static = is_static;
+  }
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const Snapshot>(std::move(new_snapshot)));
+}
+
+bool Buffer::GetFromSnapshot(
+    const std::string& target_frame, const std::string& source_frame,
+    uint64_t time_ns, geometry_msgs::TransformStamped* transform) const {
+  auto snapshot = std::atomic_load(&snapshot_);
+  if (snapshot == nullptr) {
+    return false;
+  }
+  const auto it = snapshot->find(target_frame + "/" + source_frame);
+  if (it == snapshot->end()) {
+    return false;
+  }
+  // static edges hold for any query time; dynamic edges are only served
+  // for latest-time (0) queries, everything else needs interpolation
+  if (!it->second.is_static && time_ns != 0) {
+    return false;
+  }
+  *transform = it->second.transform;
+  return true;
 }
 
 void Buffer::TF2MsgToCyber(
@@ -149,9 +329,13 @@ void Buffer::TF2MsgToCyber(
 apollo::transform::TransformStamped Buffer::lookupTransform(
     const std::string& target_frame, const std::string& source_frame,
     const cyber::Time& time, const float timeout_second) const {
-  tf2::Time tf2_time(time.ToNanosecond());
-  geometry_msgs::TransformStamped tf2_trans_stamped =
-      lookupTransform(target_frame, source_frame, tf2_time);
+  geometry_msgs::TransformStamped tf2_trans_stamped;
+  if (!GetFromStaticChains(target_frame, source_frame, &tf2_trans_stamped) &&
+      !GetFromSnapshot(target_frame, source_frame, time.ToNanosecond(),
+                       &tf2_trans_stamped)) {
+    tf2::Time tf2_time(time.ToNanosecond());
+    tf2_trans_stamped = lookupTransform(target_frame, source_frame, tf2_time);
+  }
   apollo::transform::TransformStamped trans_stamped;
   TF2MsgToCyber(tf2_trans_stamped, trans_stamped);
   return trans_stamped;
@@ -173,6 +357,12 @@ bool Buffer::canTransform(const std::string& target_frame,
                           const std::string& source_frame,
                           const cyber::Time& time, const float timeout_second,
                           std::string* errstr) const {
+  geometry_msgs::TransformStamped snapshot_transform;
+  if (GetFromStaticChains(target_frame, source_frame, &snapshot_transform) ||
+      GetFromSnapshot(target_frame, source_frame, time.ToNanosecond(),
+                      &snapshot_transform)) {
+    return true;
+  }
   uint64_t timeout_ns =
       static_cast<uint64_t>(timeout_second * kSecondToNanoFactor);
   uint64_t start_time = cyber::Time::Now().ToNanosecond();
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tf2/buffer_core.h"
@@ -131,6 +133,40 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
       const geometry_msgs::TransformStamped& tf2_trans_stamped,
       apollo::transform::TransformStamped& trans_stamped) const;  // NOLINT
 
+  // RCU-style snapshot of the latest transform per direct edge. Writers
+  // publish a fresh immutable map on every /tf callback; readers resolve
+  // static edges and latest-time lookups against their copy without
+  // taking the tf2 buffer mutex.
+  struct SnapshotEntry {
+    geometry_msgs::TransformStamped transform;
+    bool is_static = false;
+  };
+  using Snapshot = std::unordered_map<std::string, SnapshotEntry>;
+
+  void PublishSnapshot(
+      const std::vector<geometry_msgs::TransformStamped>& transforms,
+      bool is_static);
+  bool GetFromSnapshot(const std::string& target_frame,
+                       const std::string& source_frame, uint64_t time_ns,
+                       geometry_msgs::TransformStamped* transform) const;
+
+  // Integer-indexed static frame graph. Frame names are interned into
+  // compact indices, and every frame pair connected purely by static edges
+  // is precomposed into a single cached transform, so multi-hop static
+  // chains (e.g. lidar->imu->novatel) cost one lookup of a packed id pair
+  // instead of a tf2 tree walk. Chains crossing a dynamic edge are absent
+  // from the table and fall through to dynamic composition.
+  struct StaticChainTable {
+    std::unordered_map<std::string, int32_t> frame_index;
+    // Keyed by (target_index << 32) | source_index.
+    std::unordered_map<uint64_t, geometry_msgs::TransformStamped> chains;
+  };
+
+  void RebuildStaticChains();
+  bool GetFromStaticChains(const std::string& target_frame,
+                           const std::string& source_frame,
+                           geometry_msgs::TransformStamped* transform) const;
+
   std::unique_ptr<cyber::Node> node_;
   std::shared_ptr<cyber::Reader<apollo::transform::TransformStampeds>>
       message_subscriber_tf_;
@@ -139,6 +175,10 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
 
   cyber::Time last_update_;
   std::vector<geometry_msgs::TransformStamped> static_msgs_;
+
+  std::shared_ptr<const Snapshot> snapshot_;
+  std::shared_ptr<const StaticChainTable> static_chains_;
+  std::mutex snapshot_mutex_;
   DECLARE_SINGLETON(Buffer)
 };  // class
 
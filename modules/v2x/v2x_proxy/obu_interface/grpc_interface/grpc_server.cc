@@ -52,9 +52,10 @@ grpc::Status GrpcServerImpl::SendPerceptionObstacles(
     AERROR << "SendPerceptionObstacles request has no header";
     return Status::CANCELLED;
   }
+  auto obstacles = std::make_shared<PerceptionObstacles>(*request);
   {
     std::lock_guard<std::mutex> guard(obstacles_mutex_);
-    latest_obstacles_.CopyFrom(*request);
+    latest_obstacles_ = std::move(obstacles);
   }
   response->set_status(true);
   ADEBUG << "SendPerceptionObstacles response success.";
@@ -78,9 +79,22 @@ grpc::Status GrpcServerImpl::SendV2xTrafficLight(
     AERROR << "SendV2xTrafficLight request has no header";
     return Status::CANCELLED;
   }
+  auto traffic_light = std::make_shared<IntersectionTrafficLightData>(*request);
   {
     std::lock_guard<std::mutex> guard(traffic_light_mutex_);
-    latest_trafficlight_.CopyFrom(*request);
+    // Multiple RSUs can deliver overlapping phase updates out of order
+    // during a message storm; only keep updates whose timestamps move
+    // forward so the published phases stay monotonic.
+    if (latest_trafficlight_ != nullptr &&
+        traffic_light->header().timestamp_sec() <
+            latest_trafficlight_->header().timestamp_sec()) {
+      response->set_status(false);
+      response->set_info("stale v2x traffic light dropped");
+      AWARN << "SendV2xTrafficLight request is older than the latest "
+               "accepted one, dropped";
+      return Status::CANCELLED;
+    }
+    latest_trafficlight_ = std::move(traffic_light);
   }
   if (first_recv_flag_) {
     auto msg = std::make_shared<StatusResponse>();
@@ -99,30 +113,33 @@ grpc::Status GrpcServerImpl::SendV2xTrafficLight(
 
 void GrpcServerImpl::GetMsgFromGrpc(
     const std::shared_ptr<PerceptionObstacles>& ptr) {
-  if (latest_obstacles_.perception_obstacle_size() == 0) {
-    AERROR << "GetMsgFromGrpc PerceptionObstacles is invaild";
-    return;
+  std::shared_ptr<PerceptionObstacles> obstacles;
+  {
+    std::lock_guard<std::mutex> guard(obstacles_mutex_);
+    obstacles = latest_obstacles_;
   }
-  if (!latest_obstacles_.has_header()) {
+  if (obstacles == nullptr || obstacles->perception_obstacle_size() == 0 ||
+      !obstacles->has_header()) {
     AERROR << "GetMsgFromGrpc PerceptionObstacles is invaild";
     return;
   }
-  std::lock_guard<std::mutex> guard(obstacles_mutex_);
-  ptr->CopyFrom(latest_obstacles_);
+  ptr->CopyFrom(*obstacles);
 }
 
 void GrpcServerImpl::GetMsgFromGrpc(
     const std::shared_ptr<IntersectionTrafficLightData>& ptr) {
-  if (!latest_trafficlight_.has_current_lane_trafficlight()) {
-    AERROR << "GetMsgFromGrpc IntersectionTrafficLightData is invaild";
-    return;
+  std::shared_ptr<IntersectionTrafficLightData> traffic_light;
+  {
+    std::lock_guard<std::mutex> guard(traffic_light_mutex_);
+    traffic_light = latest_trafficlight_;
   }
-  if (!latest_trafficlight_.has_header()) {
+  if (traffic_light == nullptr ||
+      !traffic_light->has_current_lane_trafficlight() ||
+      !traffic_light->has_header()) {
     AERROR << "GetMsgFromGrpc IntersectionTrafficLightData is invaild";
     return;
   }
-  std::lock_guard<std::mutex> guard(traffic_light_mutex_);
-  ptr->CopyFrom(latest_trafficlight_);
+  ptr->CopyFrom(*traffic_light);
 }
 
 }  // namespace v2x
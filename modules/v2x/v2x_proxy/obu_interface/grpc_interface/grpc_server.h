@@ -66,8 +66,12 @@ class GrpcServerImpl final : public ObuToCar::Service {
  private:
   std::mutex traffic_light_mutex_;
   std::mutex obstacles_mutex_;
-  apollo::perception::PerceptionObstacles latest_obstacles_;
-  IntersectionTrafficLightData latest_trafficlight_;
+  // The latest messages are held by pointer and exchanged with a pointer
+  // swap, so the receive path never copies a proto while holding a lock and
+  // a burst of messages cannot back up behind a reader.
+  std::shared_ptr<apollo::perception::PerceptionObstacles> latest_obstacles_ =
+      nullptr;
+  std::shared_ptr<IntersectionTrafficLightData> latest_trafficlight_ = nullptr;
   bool init_flag_ = false;
   bool first_recv_flag_ = true;
   std::unique_ptr<cyber::Node> node_;
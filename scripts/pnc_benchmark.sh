@@ -0,0 +1,57 @@
+#!/usr/bin/env bash
+
+###############################################################################
+# Copyright 2019 The Apollo Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+# Full-stack PnC throughput benchmark: launches planning, prediction and
+# routing against dreamview's SimControl, drives them with a synthetic
+# dense-traffic world faster than real time, and prints a scorecard with
+# sustained cycle rates, per-module CPU and p50/p99/p99.9 latencies.
+# Extra arguments are forwarded to pnc_benchmark.py, e.g.
+#   scripts/pnc_benchmark.sh --duration 120 --world_rate 50
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+DREAMVIEW_URL="http://localhost:8888"
+
+cd "${DIR}/.."
+
+source "${DIR}/apollo_base.sh"
+
+function start_stack() {
+    ./scripts/dreamview.sh start
+    sleep 2
+    http_status="$(curl -o /dev/null -I -L -s -w '%{http_code}' ${DREAMVIEW_URL})"
+    if [ "$http_status" != "200" ]; then
+        echo "Failed to start Dreamview. Please check /apollo/data/log for more information"
+        exit 1
+    fi
+    ./scripts/routing.sh start
+    ./scripts/prediction.sh start
+    ./scripts/planning.sh start
+    sleep 3  # wait for the modules to finish initialization
+}
+
+function stop_stack() {
+    ./scripts/planning.sh stop
+    ./scripts/prediction.sh stop
+    ./scripts/routing.sh stop
+    ./scripts/dreamview.sh stop
+}
+
+trap stop_stack EXIT
+
+start_stack
+python modules/tools/pnc_benchmark/pnc_benchmark.py "$@"